@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+# Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+"""Reports which ops set the arena high-water mark.
+
+MicroAllocator writes the memory plan of a model as a JSON timeline when an
+arena timeline writer is set (see micro_arena_timeline.h); the benchmark
+executables construct MicroBenchmarkRunner with log_arena_timeline set, so
+they log one per model. This script reads those timelines and prints,
+for each model:
+
+- the planned arena size against the most bytes live at any one scope, which
+  no layout can go below,
+- the scopes whose buffers reach furthest into the arena, with their op, the
+  bytes live there and the fragmentation below their high-water mark, and
+- the buffers live at the scopes that reach the top of the arena, largest
+  first.
+
+Fragmentation at a scope is the share of the arena below the end of its
+highest buffer that holds no live buffer.
+
+  # Host build:
+  arena_timeline.py --build-dir build_host
+  # Board, from the serial output of a benchmark:
+  arena_timeline.py person_detection.log
+"""
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import argparse
+import json
+import sys
+
+from check_benchmarks import REPORT_START
+from check_benchmarks import run_executables
+
+TIMELINE_START = '{"arena_timeline"'
+
+
+def parse_timelines(text):
+  """Returns (name, timeline) for every timeline found in `text`.
+
+  A timeline is named after the first benchmark report that follows it,
+  as the benchmarks log the plan of a model before its report.
+  """
+  decoder = json.JSONDecoder()
+  timelines = []
+  start = text.find(TIMELINE_START)
+  while start >= 0:
+    try:
+      timeline, end = decoder.raw_decode(text, start)
+    except ValueError as e:
+      print("Skipping a truncated timeline at offset %d: %s" % (start, e))
+      start = text.find(TIMELINE_START, start + len(TIMELINE_START))
+      continue
+    next_timeline = text.find(TIMELINE_START, end)
+    name = "timeline %d" % len(timelines)
+    report = text.find(REPORT_START, end)
+    if report >= 0 and (next_timeline < 0 or report < next_timeline):
+      try:
+        name = decoder.raw_decode(text, report)[0]["model"]
+      except ValueError:
+        pass
+    timelines.append((name, timeline))
+    start = next_timeline
+  return timelines
+
+
+class Timeline(object):
+  """Live buffers and arena use at each allocation scope."""
+
+  def __init__(self, timeline):
+    self.arena_bytes = timeline["arena_bytes"]
+    self.buffers = timeline["buffers"]
+    self.op_names = {}
+    self.scope_ops = {}
+    for op in timeline["ops"]:
+      self.op_names[(op["subgraph"], op["node"])] = op["op"]
+      self.scope_ops[op["scope"]] = op
+    self.scopes = []
+    for scope in range(timeline["scopes"]):
+      live = [b for b in self.buffers if b["first"] <= scope <= b["last"]]
+      live_bytes = sum(b["size"] for b in live)
+      extent = max([b["offset"] + b["size"] for b in live] or [0])
+      self.scopes.append({
+        "scope": scope,
+        "live": sorted(live, key=lambda b: -b["size"]),
+        "live_bytes": live_bytes,
+        "extent": extent,
+        "fragmentation": 1.0 - live_bytes / extent if extent else 0.0,
+      })
+
+  def scope_name(self, scope):
+    op = self.scope_ops.get(scope)
+    if op is None:
+      return "inputs of a subgraph"
+    return "%s (subgraph %d node %d)" % (op["op"], op["subgraph"], op["node"])
+
+  def buffer_name(self, buf):
+    if buf["op"] < 0:
+      owner = "subgraph input"
+    else:
+      owner = "%s node %d" % (
+          self.op_names.get((buf["subgraph"], buf["op"]), "?"), buf["op"])
+    what = "tensor" if buf["kind"] == "tensor" else "scratch"
+    return "%s %d of %s" % (what, buf["index"], owner)
+
+
+def report(name, timeline, top):
+  t = Timeline(timeline)
+  peak_live = max([s["live_bytes"] for s in t.scopes] or [0])
+  tensors = sum(1 for b in t.buffers if b["kind"] == "tensor")
+  print("== %s: %d buffers (%d tensors, %d scratch), %d scopes" %
+        (name, len(t.buffers), tensors, len(t.buffers) - tensors,
+         len(t.scopes)))
+  print("Arena: %d bytes planned, at most %d bytes live at once" %
+        (t.arena_bytes, peak_live))
+  if t.arena_bytes:
+    print("Layout overhead: %d bytes (%.1f%%)" %
+          (t.arena_bytes - peak_live,
+           100.0 * (t.arena_bytes - peak_live) / t.arena_bytes))
+
+  ranked = sorted(t.scopes, key=lambda s: (-s["extent"], -s["live_bytes"]))
+  print("Top scopes by high-water mark:")
+  print("  %5s  %-40s %9s %9s %6s" %
+        ("scope", "op", "extent", "live", "frag"))
+  for s in ranked[:top]:
+    print("  %5d  %-40s %9d %9d %5.1f%%" %
+          (s["scope"], t.scope_name(s["scope"]), s["extent"],
+           s["live_bytes"], 100.0 * s["fragmentation"]))
+  for s in ranked[:top]:
+    if s["extent"] < t.arena_bytes:
+      break
+    print("Buffers live at scope %d, %s:" %
+          (s["scope"], t.scope_name(s["scope"])))
+    for b in s["live"]:
+      print("  %8d bytes at %8d, scopes %d-%d: %s" %
+            (b["size"], b["offset"], b["first"], b["last"],
+             t.buffer_name(b)))
+  print()
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+  parser.add_argument("log", nargs="*",
+                      help="Captured output to read timelines from.")
+  parser.add_argument("--build-dir",
+                      help="Host build directory to run the benchmarks from.")
+  parser.add_argument("--model", help="Only reports this model.")
+  parser.add_argument("--top", type=int, default=5,
+                      help="How many scopes to list per model.")
+  args = parser.parse_args()
+
+  text = ""
+  if args.build_dir:
+    text += run_executables(args.build_dir)
+  for log in args.log:
+    with open(log) as f:
+      text += f.read()
+
+  # A board logs its timelines on every pass, so keep the last of each model.
+  timelines = {}
+  for name, timeline in parse_timelines(text):
+    timelines[name] = timeline
+  if args.model:
+    timelines = {k: v for k, v in timelines.items() if k == args.model}
+  if not timelines:
+    print("No arena timelines found.")
+    return 1
+  for name in sorted(timelines):
+    report(name, timelines[name], args.top)
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(main())
@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+# Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+"""Compares benchmark reports with the checked-in baseline.
+
+The benchmark executables print one JSON report per model (see
+micro_benchmark_report.h). This script collects those reports, either by
+running the executables of a host build or by reading serial logs captured
+from a board, and compares them with baseline.json. It exits with status 1 if
+any model got slower or uses more arena than the baseline allows.
+
+  # Host build:
+  check_benchmarks.py --build-dir build_host
+  # Board, from the serial output of one or more benchmark executables:
+  check_benchmarks.py --log person_detection.log --log micro_speech.log
+  # Accept the current numbers as the new baseline for their platform:
+  check_benchmarks.py --build-dir build_host --update
+"""
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+BENCHMARK_EXECUTABLES = [
+  "examples/hello_world/hello_world_benchmark",
+  "examples/micro_speech_small/micro_speech_small_benchmark",
+  "examples/micro_speech_large/micro_speech_large_benchmark",
+  "examples/person_detection/person_detection_benchmark",
+]
+
+DEFAULT_BASELINE = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                "baseline.json")
+
+# Timing statistics kept in the baseline, for "invoke" and for each op.
+TIMING_KEYS = ["min_ticks", "mean_ticks", "p99_ticks"]
+
+REPORT_START = '{"model"'
+
+
+def parse_reports(text):
+  """Returns every benchmark report found in `text`, in order."""
+  decoder = json.JSONDecoder()
+  reports = []
+  start = text.find(REPORT_START)
+  while start >= 0:
+    try:
+      report, end = decoder.raw_decode(text, start)
+      reports.append(report)
+    except ValueError as e:
+      print("Skipping a truncated report at offset %d: %s" % (start, e))
+      end = start + len(REPORT_START)
+    start = text.find(REPORT_START, end)
+  return reports
+
+
+def run_executables(build_dir):
+  text = ""
+  with tempfile.TemporaryDirectory() as scratch:
+    for executable in BENCHMARK_EXECUTABLES:
+      path = os.path.join(os.path.abspath(build_dir), executable)
+      if not os.path.exists(path):
+        print("Missing benchmark executable %s" % path)
+        continue
+      print("Running %s" % path)
+      # The person detection benchmark writes a trace to its first argument.
+      result = subprocess.run([path, os.path.join(scratch, "trace.json")],
+                              cwd=scratch, stdout=subprocess.PIPE,
+                              universal_newlines=True, check=False)
+      if result.returncode != 0:
+        print("%s exited with status %d" % (path, result.returncode))
+      text += result.stdout
+  return text
+
+
+def summarize(report):
+  """Keeps the parts of a report that the baseline records.
+
+  "invoke" is None if the benchmark failed before timing any invocation.
+  """
+  invoke = report["invoke"]
+  summary = {
+    "arena_used_bytes": report["arena"]["used_bytes"],
+    "ticks_per_second": report["ticks_per_second"],
+    "invoke": (None if invoke is None else
+               {key: invoke[key] for key in TIMING_KEYS}),
+    "ops": [],
+  }
+  for op in report["ops"]:
+    entry = {"tag": op["tag"]}
+    entry.update({key: op[key] for key in TIMING_KEYS})
+    summary["ops"].append(entry)
+  return summary
+
+
+class Comparison(object):
+  """Collects regressions and improvements beyond the tolerances."""
+
+  def __init__(self, tolerances):
+    self.tolerances = tolerances
+    self.regressions = []
+    self.improvements = []
+
+  def check(self, name, tolerance_key, baseline, current):
+    tolerance = self.tolerances.get(tolerance_key)
+    if tolerance is None or baseline is None:
+      return
+    limit = baseline * (1.0 + tolerance)
+    change = (current - baseline) / baseline if baseline else 0.0
+    line = "%s: %d -> %d (%+.1f%%, tolerance %.1f%%)" % (
+        name, baseline, current, 100.0 * change, 100.0 * tolerance)
+    if current > limit:
+      self.regressions.append(line)
+    elif current < baseline * (1.0 - tolerance):
+      self.improvements.append(line)
+
+
+def compare_model(comparison, model, baseline, current):
+  if current["invoke"] is None:
+    comparison.regressions.append("%s: no invocation was timed" % model)
+    return
+  # Ticks are not normalised, so numbers taken at another clock rate (another
+  # host, or a board at another clk_sys) cannot be compared.
+  old_rate = baseline["ticks_per_second"]
+  new_rate = current["ticks_per_second"]
+  if abs(new_rate - old_rate) > 0.05 * old_rate:
+    comparison.regressions.append(
+        "%s: ran at %d ticks per second, the baseline at %d; record the "
+        "baseline on this machine with --update" % (model, new_rate, old_rate))
+    return
+  comparison.check("%s arena used bytes" % model, "arena_used_bytes",
+                   baseline["arena_used_bytes"], current["arena_used_bytes"])
+  for key in TIMING_KEYS:
+    comparison.check("%s invoke %s" % (model, key), "invoke_" + key,
+                     baseline["invoke"][key], current["invoke"][key])
+
+  baseline_tags = [op["tag"] for op in baseline["ops"]]
+  current_tags = [op["tag"] for op in current["ops"]]
+  if baseline_tags != current_tags:
+    comparison.regressions.append(
+        "%s: the op sequence changed from %d to %d ops, update the baseline"
+        % (model, len(baseline_tags), len(current_tags)))
+    return
+
+  # Ops that take only a small share of the invocation are too noisy to
+  # compare on their own; the end-to-end numbers still cover them.
+  min_share = comparison.tolerances.get("op_min_share", 0.0)
+  invoke_mean = baseline["invoke"]["mean_ticks"]
+  for index, (old, new) in enumerate(zip(baseline["ops"], current["ops"])):
+    if old["mean_ticks"] < min_share * invoke_mean:
+      continue
+    for key in TIMING_KEYS:
+      comparison.check("%s op %d %s %s" % (model, index, old["tag"], key),
+                       "op_" + key, old[key], new[key])
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+  parser.add_argument("--build-dir",
+                      help="Host build directory to run the benchmarks from.")
+  parser.add_argument("--log", action="append", default=[],
+                      help="Captured benchmark output to read reports from.")
+  parser.add_argument("--baseline", default=DEFAULT_BASELINE)
+  parser.add_argument("--output",
+                      help="Writes the collected reports to this file.")
+  parser.add_argument("--update", action="store_true",
+                      help="Replaces the baseline of the reported platforms.")
+  args = parser.parse_args()
+
+  text = ""
+  if args.build_dir:
+    text += run_executables(args.build_dir)
+  for log in args.log:
+    with open(log) as f:
+      text += f.read()
+
+  # A board prints its reports on every pass, so keep the last of each model.
+  reports = {}
+  for report in parse_reports(text):
+    reports[(report["platform"], report["model"])] = report
+  if not reports:
+    print("No benchmark reports found.")
+    return 1
+
+  if args.output:
+    with open(args.output, "w") as f:
+      json.dump(list(reports.values()), f, indent=2)
+      f.write("\n")
+
+  with open(args.baseline) as f:
+    baseline = json.load(f)
+
+  if args.update:
+    for (platform, model), report in sorted(reports.items()):
+      if report["invoke"] is None:
+        print("Not recording %s on %s: no invocation was timed."
+              % (model, platform))
+        continue
+      baseline["platforms"].setdefault(platform, {})[model] = summarize(report)
+    with open(args.baseline, "w") as f:
+      json.dump(baseline, f, indent=2, sort_keys=True)
+      f.write("\n")
+    print("Updated %s with %d models." % (args.baseline, len(reports)))
+    return 0
+
+  platforms = sorted(set(platform for platform, _ in reports))
+  failed = False
+  for platform in platforms:
+    expected = baseline["platforms"].get(platform)
+    if expected is None:
+      print("No baseline for platform %s; run with --update to record one."
+            % platform)
+      failed = True
+      continue
+    tolerances = dict(baseline["tolerances"]["default"])
+    tolerances.update(baseline["tolerances"].get(platform, {}))
+    comparison = Comparison(tolerances)
+    for model in sorted(expected):
+      report = reports.get((platform, model))
+      if report is None:
+        comparison.regressions.append("%s: no report" % model)
+        continue
+      if report["dropped_events"]:
+        comparison.regressions.append(
+            "%s: %d profiler events dropped" %
+            (model, report["dropped_events"]))
+      compare_model(comparison, model, expected[model], summarize(report))
+
+    for line in comparison.improvements:
+      print("[%s] improved %s" % (platform, line))
+    for line in comparison.regressions:
+      print("[%s] REGRESSION %s" % (platform, line))
+    if comparison.regressions:
+      failed = True
+    print("[%s] %d models, %d regressions, %d improvements" %
+          (platform, len(expected), len(comparison.regressions),
+           len(comparison.improvements)))
+
+  if failed:
+    print("Benchmarks FAILED against %s" % args.baseline)
+    return 1
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(main())
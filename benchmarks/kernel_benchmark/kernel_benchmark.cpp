@@ -0,0 +1,759 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <cstdint>
+#include <cstring>
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/depthwise_conv.h"
+#include "tensorflow/lite/micro/kernels/kernel_runner.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_time.h"
+#include "tensorflow/lite/micro/system_setup.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+#include "third_party/cmsis_nn/Include/arm_nnfunctions.h"
+
+/*
+ * Kernel benchmark. Sweeps CONV_2D and DEPTHWISE_CONV_2D over input and
+ * output channel counts, depth multipliers, spatial sizes, filter sizes,
+ * strides and padding, and prints one CSV row per run:
+ *
+ * - "kernel" rows time the TFLM kernel through KernelRunner, for int8 and
+ *   int16 activations, including the per-invocation overhead of the kernel.
+ * - Path rows time each CMSIS-NN function that arm_convolve_wrapper_s8,
+ *   arm_depthwise_conv_wrapper_s8 or their s16 counterparts can dispatch to
+ *   and that accepts the shape, called directly on the same data.
+ *   "dispatched" marks the function the wrapper picks and "fastest" the
+ *   quickest one.
+ *
+ * Ticks are CPU cycles on the board, so ticks/MAC is cycles per MAC. The run
+ * ends with, for each function the wrappers dispatch to, how often it was
+ * also the fastest and which function beat it otherwise.
+ */
+
+namespace tflite {
+namespace {
+
+constexpr int kRepeats = 3;
+constexpr int kMaxChannels = 64;
+constexpr int kMaxActivationBytes = 32 * 1024;
+constexpr int kMaxFilterBytes = 40 * 1024;
+constexpr int kScratchBytes = 16 * 1024;
+
+constexpr float kInputScale = 0.5f;
+constexpr float kFilterScale = 0.01f;
+constexpr float kOutputScale = 1.0f;
+
+alignas(16) uint8_t input_buffer[kMaxActivationBytes];
+alignas(16) uint8_t output_buffer[kMaxActivationBytes];
+alignas(16) int8_t reference_output[kMaxActivationBytes];
+alignas(16) int8_t filter_buffer[kMaxFilterBytes];
+alignas(16) int64_t bias_buffer[kMaxChannels];
+alignas(16) int8_t scratch_buffer[kScratchBytes];
+int32_t output_multipliers[kMaxChannels];
+int32_t output_shifts[kMaxChannels];
+
+enum KernelType { kConv, kDepthwiseConv };
+
+struct Shape {
+  KernelType kernel;
+  int input_height;
+  int input_width;
+  int input_channels;
+  // A multiple of input_channels for DEPTHWISE_CONV_2D.
+  int output_channels;
+  int filter_height;
+  int filter_width;
+  int stride;
+  TfLitePadding padding;
+
+  int output_height() const {
+    return OutputSize(input_height, filter_height);
+  }
+  int output_width() const { return OutputSize(input_width, filter_width); }
+
+  // Padding before the first row or column, as TFLM computes it and passes
+  // it to CMSIS-NN.
+  int pad_height() const {
+    return Padding(input_height, filter_height, output_height());
+  }
+  int pad_width() const {
+    return Padding(input_width, filter_width, output_width());
+  }
+
+  int depth_multiplier() const { return output_channels / input_channels; }
+
+  uint32_t macs() const {
+    const uint32_t per_output = filter_height * filter_width *
+                                (kernel == kConv ? input_channels : 1);
+    return static_cast<uint32_t>(output_height()) * output_width() *
+           output_channels * per_output;
+  }
+
+  int filter_elements() const {
+    return filter_height * filter_width * output_channels *
+           (kernel == kConv ? input_channels : 1);
+  }
+
+ private:
+  int OutputSize(int input, int filter) const {
+    return padding == kTfLitePaddingSame ? (input + stride - 1) / stride
+                                         : (input - filter) / stride + 1;
+  }
+  int Padding(int input, int filter, int output) const {
+    const int total = (output - 1) * stride + filter - input;
+    return total > 0 ? total / 2 : 0;
+  }
+};
+
+Shape ConvShape(int size, int input_channels, int output_channels,
+                int filter, int stride, TfLitePadding padding) {
+  return {kConv,  size,   size,   input_channels, output_channels,
+          filter, filter, stride, padding};
+}
+
+Shape DepthwiseConvShape(int size, int channels, int depth_multiplier,
+                         int filter, int stride, TfLitePadding padding) {
+  return {kDepthwiseConv, size,   size,   channels, channels * depth_multiplier,
+          filter,         filter, stride, padding};
+}
+
+const char* KernelName(KernelType kernel) {
+  return kernel == kConv ? "CONV_2D" : "DEPTHWISE_CONV_2D";
+}
+
+// Deterministic pseudo-random fill, so runs on different boards see the same
+// data.
+void FillRandom(int8_t* data, int count, uint32_t seed) {
+  uint32_t state = seed;
+  for (int i = 0; i < count; ++i) {
+    state = state * 1664525u + 1013904223u;
+    data[i] = static_cast<int8_t>(state >> 24);
+  }
+}
+
+uint32_t TicksPerMacX100(uint32_t ticks, uint32_t macs) {
+  if (macs == 0) {
+    return 0;
+  }
+  return static_cast<uint32_t>(static_cast<uint64_t>(ticks) * 100 / macs);
+}
+
+void PrintRow(const Shape& shape, const char* dtype, const char* path,
+              bool dispatched, bool fastest, uint32_t ticks) {
+  const uint32_t ticks_per_mac = TicksPerMacX100(ticks, shape.macs());
+  MicroPrintf("%s,%s,%dx%dx%d,%dx%dx%d,%dx%d,%d,%s,%s,%d,%d,%u,%u,%u.%02u",
+              KernelName(shape.kernel), dtype, shape.input_height,
+              shape.input_width, shape.input_channels, shape.output_height(),
+              shape.output_width(), shape.output_channels,
+              shape.filter_height, shape.filter_width, shape.stride,
+              shape.padding == kTfLitePaddingSame ? "same" : "valid", path,
+              dispatched ? 1 : 0,
+              fastest ? 1 : 0, static_cast<unsigned>(ticks),
+              static_cast<unsigned>(shape.macs()),
+              static_cast<unsigned>(ticks_per_mac / 100),
+              static_cast<unsigned>(ticks_per_mac % 100));
+}
+
+// Times the TFLM kernel through KernelRunner with `T` activations and
+// `BiasT` bias. Returns 0 if the kernel rejects the shape.
+template <typename T, typename BiasT>
+uint32_t RunKernel(const Shape& shape) {
+  // Filters and biases are per output channel.
+  const int channels = shape.output_channels;
+  int input_dims_data[] = {4, 1, shape.input_height, shape.input_width,
+                           shape.input_channels};
+  int output_dims_data[] = {4, 1, shape.output_height(), shape.output_width(),
+                            channels};
+  int filter_dims_data[] = {4, channels, shape.filter_height,
+                            shape.filter_width, shape.input_channels};
+  if (shape.kernel == kDepthwiseConv) {
+    filter_dims_data[1] = 1;
+    filter_dims_data[4] = channels;
+  }
+  int bias_dims_data[] = {1, channels};
+  TfLiteIntArray* input_dims = testing::IntArrayFromInts(input_dims_data);
+  TfLiteIntArray* output_dims = testing::IntArrayFromInts(output_dims_data);
+  TfLiteIntArray* filter_dims = testing::IntArrayFromInts(filter_dims_data);
+  TfLiteIntArray* bias_dims = testing::IntArrayFromInts(bias_dims_data);
+
+  // Quantization arrays hold their length in the first element.
+  float filter_scales[kMaxChannels + 1];
+  int filter_zero_points[kMaxChannels + 1];
+  float bias_scales[kMaxChannels + 1];
+  int bias_zero_points[kMaxChannels + 1];
+  filter_scales[0] = static_cast<float>(channels);
+  filter_zero_points[0] = channels;
+  bias_scales[0] = static_cast<float>(channels);
+  bias_zero_points[0] = channels;
+  for (int c = 1; c <= channels; ++c) {
+    filter_scales[c] = kFilterScale;
+    filter_zero_points[c] = 0;
+  }
+  TfLiteFloatArray* filter_scale_array =
+      testing::FloatArrayFromFloats(filter_scales);
+  TfLiteAffineQuantization filter_quant;
+  TfLiteAffineQuantization bias_quant;
+  const int quantized_dimension = shape.kernel == kConv ? 0 : 3;
+
+  float input_scales[] = {1, kInputScale};
+  int input_zero_points[] = {1, 0};
+  TfLiteAffineQuantization input_quant = {
+      testing::FloatArrayFromFloats(input_scales),
+      testing::IntArrayFromInts(input_zero_points), 0};
+  float output_scales[] = {1, kOutputScale};
+  int output_zero_points[] = {1, 0};
+  TfLiteAffineQuantization output_quant = {
+      testing::FloatArrayFromFloats(output_scales),
+      testing::IntArrayFromInts(output_zero_points), 0};
+
+  TfLiteTensor tensors[] = {
+      testing::CreateQuantizedTensor(reinterpret_cast<T*>(input_buffer),
+                                     input_dims, kInputScale, 0),
+      testing::CreatePerChannelQuantizedTensor(
+          filter_buffer, filter_dims, filter_scale_array,
+          testing::IntArrayFromInts(filter_zero_points), &filter_quant,
+          quantized_dimension),
+      testing::CreatePerChannelQuantizedBiasTensor(
+          reinterpret_cast<BiasT*>(bias_buffer), bias_dims, kInputScale,
+          filter_scale_array, testing::FloatArrayFromFloats(bias_scales),
+          testing::IntArrayFromInts(bias_zero_points), &bias_quant, 0),
+      testing::CreateQuantizedTensor(reinterpret_cast<T*>(output_buffer),
+                                     output_dims, kOutputScale, 0),
+  };
+  tensors[0].quantization = {kTfLiteAffineQuantization, &input_quant};
+  tensors[3].quantization = {kTfLiteAffineQuantization, &output_quant};
+
+  int inputs_array_data[] = {3, 0, 1, 2};
+  int outputs_array_data[] = {1, 3};
+  TfLiteIntArray* inputs_array = testing::IntArrayFromInts(inputs_array_data);
+  TfLiteIntArray* outputs_array =
+      testing::IntArrayFromInts(outputs_array_data);
+
+  TfLiteConvParams conv_params = {};
+  conv_params.padding = shape.padding;
+  conv_params.stride_width = shape.stride;
+  conv_params.stride_height = shape.stride;
+  conv_params.activation = kTfLiteActNone;
+  conv_params.dilation_width_factor = 1;
+  conv_params.dilation_height_factor = 1;
+  TfLiteDepthwiseConvParams depthwise_params = {};
+  depthwise_params.padding = shape.padding;
+  depthwise_params.stride_width = shape.stride;
+  depthwise_params.stride_height = shape.stride;
+  depthwise_params.depth_multiplier = shape.depth_multiplier();
+  depthwise_params.activation = kTfLiteActNone;
+  depthwise_params.dilation_width_factor = 1;
+  depthwise_params.dilation_height_factor = 1;
+
+  const TFLMRegistration registration =
+      shape.kernel == kConv
+          ? (sizeof(T) == 1 ? Register_CONV_2D_INT8()
+                            : Register_CONV_2D_INT16())
+          : (sizeof(T) == 1 ? Register_DEPTHWISE_CONV_2D_INT8()
+                            : Register_DEPTHWISE_CONV_2D_INT16());
+  const void* builtin_data = shape.kernel == kConv
+                                 ? static_cast<const void*>(&conv_params)
+                                 : static_cast<const void*>(&depthwise_params);
+  micro::KernelRunner runner(registration, tensors,
+                             sizeof(tensors) / sizeof(tensors[0]),
+                             inputs_array, outputs_array, builtin_data);
+  if (runner.InitAndPrepare() != kTfLiteOk) {
+    return 0;
+  }
+
+  uint32_t best = 0;
+  for (int r = 0; r < kRepeats; ++r) {
+    const uint32_t start = GetCurrentTimeTicks();
+    const TfLiteStatus status = runner.Invoke();
+    const uint32_t ticks = GetCurrentTimeTicks() - start;
+    if (status != kTfLiteOk) {
+      return 0;
+    }
+    best = (r == 0 || ticks < best) ? ticks : best;
+  }
+  return best;
+}
+
+// CMSIS-NN functions that the wrappers dispatch to. `applies` restates the
+// constraints the wrapper checks before choosing the function, for the ones
+// the function does not check itself.
+struct Problem {
+  cmsis_nn_context ctx;
+  cmsis_nn_conv_params conv_params;
+  cmsis_nn_dw_conv_params dw_conv_params;
+  cmsis_nn_per_channel_quant_params quant_params;
+  cmsis_nn_dims input_dims;
+  cmsis_nn_dims filter_dims;
+  cmsis_nn_dims bias_dims;
+  cmsis_nn_dims output_dims;
+};
+
+struct KernelPath {
+  const char* name;
+  bool (*applies)(const Problem& p);
+  int32_t (*buffer_size)(const Problem& p);
+  arm_cmsis_nn_status (*run)(const Problem& p);
+};
+
+constexpr int kMaxPaths = 4;
+
+bool Always(const Problem&) { return true; }
+int32_t NoBuffer(const Problem&) { return 0; }
+
+bool IsPointwise(const Problem& p) {
+  return p.filter_dims.w == 1 && p.filter_dims.h == 1 &&
+         p.input_dims.c == p.filter_dims.c;
+}
+
+bool IsOneByN(const Problem& p) {
+  return p.input_dims.h == 1 && p.filter_dims.h == 1 &&
+         p.input_dims.c == p.filter_dims.c;
+}
+
+#define CONV_ARGS                                                        \
+  &p.ctx, &p.conv_params, &p.quant_params, &p.input_dims,                \
+      reinterpret_cast<const int8_t*>(input_buffer), &p.filter_dims,     \
+      filter_buffer, &p.bias_dims,                                       \
+      reinterpret_cast<const int32_t*>(bias_buffer)
+#define DW_CONV_ARGS                                                     \
+  &p.ctx, &p.dw_conv_params, &p.quant_params, &p.input_dims,             \
+      reinterpret_cast<const int8_t*>(input_buffer), &p.filter_dims,     \
+      filter_buffer, &p.bias_dims,                                       \
+      reinterpret_cast<const int32_t*>(bias_buffer), &p.output_dims,     \
+      reinterpret_cast<int8_t*>(output_buffer)
+#define DW_CONV_S16_ARGS                                                 \
+  &p.ctx, &p.dw_conv_params, &p.quant_params, &p.input_dims,             \
+      reinterpret_cast<const int16_t*>(input_buffer), &p.filter_dims,    \
+      filter_buffer, &p.bias_dims, bias_buffer, &p.output_dims,          \
+      reinterpret_cast<int16_t*>(output_buffer)
+
+const KernelPath kConvPaths[] = {
+    {"arm_convolve_1x1_s8_fast", IsPointwise,
+     [](const Problem& p) {
+       return arm_convolve_1x1_s8_fast_get_buffer_size(&p.input_dims);
+     },
+     [](const Problem& p) {
+       return arm_convolve_1x1_s8_fast(
+           CONV_ARGS, &p.output_dims, reinterpret_cast<int8_t*>(output_buffer));
+     }},
+    {"arm_convolve_1x1_s8", IsPointwise, NoBuffer,
+     [](const Problem& p) {
+       return arm_convolve_1x1_s8(CONV_ARGS, &p.output_dims,
+                                  reinterpret_cast<int8_t*>(output_buffer));
+     }},
+    {"arm_convolve_1_x_n_s8", IsOneByN,
+     [](const Problem& p) {
+       return arm_convolve_1_x_n_s8_get_buffer_size(
+           &p.conv_params, &p.input_dims, &p.filter_dims, &p.output_dims);
+     },
+     [](const Problem& p) {
+       return arm_convolve_1_x_n_s8(CONV_ARGS, &p.output_dims,
+                                    reinterpret_cast<int8_t*>(output_buffer));
+     }},
+    {"arm_convolve_s8", Always,
+     [](const Problem& p) {
+       return arm_convolve_s8_get_buffer_size(&p.input_dims, &p.filter_dims);
+     },
+     [](const Problem& p) {
+       return arm_convolve_s8(CONV_ARGS, nullptr, &p.output_dims,
+                              reinterpret_cast<int8_t*>(output_buffer));
+     }},
+};
+
+const KernelPath kDepthwiseConvPaths[] = {
+    {"arm_depthwise_conv_3x3_s8", Always, NoBuffer,
+     [](const Problem& p) { return arm_depthwise_conv_3x3_s8(DW_CONV_ARGS); }},
+    {"arm_depthwise_conv_s8_opt", Always,
+     [](const Problem& p) {
+       return arm_depthwise_conv_s8_opt_get_buffer_size(&p.input_dims,
+                                                        &p.filter_dims);
+     },
+     [](const Problem& p) { return arm_depthwise_conv_s8_opt(DW_CONV_ARGS); }},
+    {"arm_depthwise_conv_s8", Always, NoBuffer,
+     [](const Problem& p) { return arm_depthwise_conv_s8(DW_CONV_ARGS); }},
+};
+
+// arm_convolve_wrapper_s16 always calls arm_convolve_s16; it is timed to
+// compare the int16 kernel with the int8 paths on the same shapes.
+const KernelPath kConvS16Paths[] = {
+    {"arm_convolve_s16", Always,
+     [](const Problem& p) {
+       return arm_convolve_wrapper_s16_get_buffer_size(
+           &p.conv_params, &p.input_dims, &p.filter_dims, &p.output_dims);
+     },
+     [](const Problem& p) {
+       const cmsis_nn_bias_data bias = {bias_buffer, false};
+       return arm_convolve_s16(
+           &p.ctx, &p.conv_params, &p.quant_params, &p.input_dims,
+           reinterpret_cast<const int16_t*>(input_buffer), &p.filter_dims,
+           filter_buffer, &p.bias_dims, &bias, &p.output_dims,
+           reinterpret_cast<int16_t*>(output_buffer));
+     }},
+};
+
+// The TFLM int16 DEPTHWISE_CONV_2D kernel calls arm_depthwise_conv_s16
+// directly rather than through the wrapper.
+const KernelPath kDepthwiseConvS16Paths[] = {
+    {"arm_depthwise_conv_fast_s16", Always,
+     [](const Problem& p) {
+       return arm_depthwise_conv_fast_s16_get_buffer_size(&p.input_dims,
+                                                          &p.filter_dims);
+     },
+     [](const Problem& p) {
+       return arm_depthwise_conv_fast_s16(DW_CONV_S16_ARGS);
+     }},
+    {"arm_depthwise_conv_s16", Always, NoBuffer,
+     [](const Problem& p) { return arm_depthwise_conv_s16(DW_CONV_S16_ARGS); }},
+};
+
+#undef CONV_ARGS
+#undef DW_CONV_ARGS
+#undef DW_CONV_S16_ARGS
+
+// Index of the path arm_convolve_wrapper_s8 picks, following its checks for
+// builds without MVE. Keep in sync with arm_convolve_wrapper_s8.c.
+int ConvDispatch(const Problem& p) {
+  const cmsis_nn_conv_params& c = p.conv_params;
+  if (c.padding.w == 0 && c.padding.h == 0 && IsPointwise(p) &&
+      c.dilation.w == 1 && c.dilation.h == 1) {
+    return (c.stride.w == 1 && c.stride.h == 1) ? 0 : 1;
+  }
+  if (IsOneByN(p) && c.dilation.w == 1 &&
+      (c.stride.w * p.input_dims.c) % 4 == 0) {
+    return 2;
+  }
+  return 3;
+}
+
+// As above for arm_depthwise_conv_wrapper_s8.c.
+int DepthwiseConvDispatch(const Problem& p) {
+  const cmsis_nn_dw_conv_params& c = p.dw_conv_params;
+  if (c.ch_mult == 1 && p.input_dims.n == 1 && c.dilation.w == 1 &&
+      c.dilation.h == 1) {
+    if (p.filter_dims.w == 3 && p.filter_dims.h == 3 && c.padding.h <= 1 &&
+        c.padding.w <= 1) {
+      return 0;
+    }
+    return 1;
+  }
+  return 2;
+}
+
+int ConvS16Dispatch(const Problem&) { return 0; }
+
+// As above for arm_depthwise_conv_wrapper_s16.c, which checks
+// USE_FAST_DW_CONV_S16_FUNCTION.
+int DepthwiseConvS16Dispatch(const Problem& p) {
+  const cmsis_nn_dw_conv_params& c = p.dw_conv_params;
+  return (c.ch_mult == 1 && c.dilation.w == 1 && c.dilation.h == 1 &&
+          p.filter_dims.w * p.filter_dims.h < 512)
+             ? 0
+             : 1;
+}
+
+void BuildProblem(const Shape& shape, bool is_int16, Problem& p) {
+  memset(&p, 0, sizeof(p));
+  p.ctx.buf = scratch_buffer;
+  p.ctx.size = kScratchBytes;
+  p.input_dims = {1, shape.input_height, shape.input_width,
+                  shape.input_channels};
+  p.output_dims = {1, shape.output_height(), shape.output_width(),
+                   shape.output_channels};
+  if (shape.kernel == kConv) {
+    p.filter_dims = {shape.output_channels, shape.filter_height,
+                     shape.filter_width, shape.input_channels};
+  } else {
+    p.filter_dims = {1, shape.filter_height, shape.filter_width,
+                     shape.output_channels};
+  }
+  p.bias_dims = {1, 1, 1, shape.output_channels};
+
+  const cmsis_nn_tile stride = {shape.stride, shape.stride};
+  const cmsis_nn_tile padding = {shape.pad_width(), shape.pad_height()};
+  const cmsis_nn_tile unit = {1, 1};
+  const cmsis_nn_activation activation =
+      is_int16 ? cmsis_nn_activation{-32768, 32767}
+               : cmsis_nn_activation{-128, 127};
+  p.conv_params.stride = stride;
+  p.conv_params.padding = padding;
+  p.conv_params.dilation = unit;
+  p.conv_params.activation = activation;
+  p.dw_conv_params.ch_mult = shape.depth_multiplier();
+  p.dw_conv_params.stride = stride;
+  p.dw_conv_params.padding = padding;
+  p.dw_conv_params.dilation = unit;
+  p.dw_conv_params.activation = activation;
+
+  // Any in-range requantization does; timing does not depend on the values.
+  for (int c = 0; c < shape.output_channels; ++c) {
+    output_multipliers[c] = 1 << 30;
+    output_shifts[c] = -6;
+  }
+  p.quant_params.multiplier = output_multipliers;
+  p.quant_params.shift = output_shifts;
+}
+
+struct DispatchStats {
+  int shapes;
+  int fastest[kMaxPaths];
+};
+
+// The functions one wrapper can dispatch to, and how often each was the
+// fastest on the shapes it was dispatched for.
+struct PathSet {
+  const char* wrapper;
+  const char* dtype;
+  int element_bytes;
+  const KernelPath* paths;
+  int num_paths;
+  int (*dispatch)(const Problem& p);
+  DispatchStats stats[kMaxPaths];
+};
+
+#define PATH_SET(wrapper, dtype, element_bytes, paths, dispatch)          \
+  {                                                                        \
+    wrapper, dtype, element_bytes, paths, sizeof(paths) / sizeof(paths[0]), \
+        dispatch, {}                                                       \
+  }
+
+PathSet conv_paths =
+    PATH_SET("arm_convolve_wrapper_s8", "int8", 1, kConvPaths, ConvDispatch);
+PathSet depthwise_conv_paths =
+    PATH_SET("arm_depthwise_conv_wrapper_s8", "int8", 1, kDepthwiseConvPaths,
+             DepthwiseConvDispatch);
+PathSet conv_s16_paths = PATH_SET("arm_convolve_wrapper_s16", "int16", 2,
+                                  kConvS16Paths, ConvS16Dispatch);
+PathSet depthwise_conv_s16_paths =
+    PATH_SET("arm_depthwise_conv_wrapper_s16", "int16", 2,
+             kDepthwiseConvS16Paths, DepthwiseConvS16Dispatch);
+
+#undef PATH_SET
+
+PathSet* const kPathSets[] = {&conv_paths, &depthwise_conv_paths,
+                              &conv_s16_paths, &depthwise_conv_s16_paths};
+
+// Times every applicable path of `set` on the data in the buffers and checks
+// each against the output of the last, generic, path.
+void RunPaths(const Shape& shape, PathSet& set) {
+  Problem p;
+  BuildProblem(shape, set.element_bytes == 2, p);
+  const KernelPath* paths = set.paths;
+  const int num_paths = set.num_paths;
+  const int dispatched = set.dispatch(p);
+  const int output_bytes = shape.output_height() * shape.output_width() *
+                           shape.output_channels * set.element_bytes;
+
+  uint32_t ticks[kMaxPaths] = {};
+  bool ran[kMaxPaths] = {};
+  for (int path = num_paths - 1; path >= 0; --path) {
+    if (!paths[path].applies(p) || paths[path].buffer_size(p) > kScratchBytes) {
+      continue;
+    }
+    memset(output_buffer, 0, output_bytes);
+    for (int r = 0; r < kRepeats; ++r) {
+      const uint32_t start = GetCurrentTimeTicks();
+      const arm_cmsis_nn_status status = paths[path].run(p);
+      const uint32_t elapsed = GetCurrentTimeTicks() - start;
+      if (status != ARM_CMSIS_NN_SUCCESS) {
+        break;
+      }
+      ticks[path] = (r == 0 || elapsed < ticks[path]) ? elapsed : ticks[path];
+      ran[path] = true;
+    }
+    if (!ran[path]) {
+      continue;
+    }
+    if (path == num_paths - 1) {
+      memcpy(reference_output, output_buffer, output_bytes);
+    } else if (memcmp(reference_output, output_buffer, output_bytes) != 0) {
+      MicroPrintf("%s differs from %s for this shape", paths[path].name,
+                  paths[num_paths - 1].name);
+    }
+  }
+
+  int fastest = -1;
+  for (int path = 0; path < num_paths; ++path) {
+    if (ran[path] && (fastest < 0 || ticks[path] < ticks[fastest])) {
+      fastest = path;
+    }
+  }
+  for (int path = 0; path < num_paths; ++path) {
+    if (ran[path]) {
+      PrintRow(shape, set.dtype, paths[path].name, path == dispatched,
+               path == fastest, ticks[path]);
+    }
+  }
+  if (fastest >= 0 && ran[dispatched]) {
+    DispatchStats& stats = set.stats[dispatched];
+    ++stats.shapes;
+    ++stats.fastest[fastest];
+  }
+}
+
+void RunShape(const Shape& shape) {
+  const int input_elements =
+      shape.input_height * shape.input_width * shape.input_channels;
+  const int output_elements =
+      shape.output_height() * shape.output_width() * shape.output_channels;
+  if (shape.output_height() <= 0 || shape.output_width() <= 0 ||
+      shape.output_channels > kMaxChannels ||
+      shape.filter_elements() > kMaxFilterBytes ||
+      input_elements * 2 > kMaxActivationBytes ||
+      output_elements * 2 > kMaxActivationBytes) {
+    return;
+  }
+  FillRandom(reinterpret_cast<int8_t*>(input_buffer), input_elements * 2, 1);
+  FillRandom(filter_buffer, shape.filter_elements(), 2);
+  memset(bias_buffer, 0, sizeof(bias_buffer));
+
+  const uint32_t int8_ticks = RunKernel<int8_t, int32_t>(shape);
+  if (int8_ticks > 0) {
+    PrintRow(shape, "int8", "kernel", false, false, int8_ticks);
+  }
+  const uint32_t int16_ticks = RunKernel<int16_t, int64_t>(shape);
+  if (int16_ticks > 0) {
+    PrintRow(shape, "int16", "kernel", false, false, int16_ticks);
+  }
+
+  // The kernel runs overwrote the input and bias, so both are filled again:
+  // int8 data for the s8 paths, then int16 data for the s16 ones. The
+  // zeroed bias reads as zero in both int32 and int64.
+  const bool is_conv = shape.kernel == kConv;
+  FillRandom(reinterpret_cast<int8_t*>(input_buffer), input_elements, 1);
+  memset(bias_buffer, 0, sizeof(bias_buffer));
+  RunPaths(shape, is_conv ? conv_paths : depthwise_conv_paths);
+  FillRandom(reinterpret_cast<int8_t*>(input_buffer), input_elements * 2, 1);
+  RunPaths(shape, is_conv ? conv_s16_paths : depthwise_conv_s16_paths);
+}
+
+void RunSweep() {
+  const int kSpatialSizes[] = {8, 16};
+  const int kChannels[] = {8, 16, 32, kMaxChannels};
+  const int kStrides[] = {1, 2};
+  const TfLitePadding kPaddings[] = {kTfLitePaddingValid, kTfLitePaddingSame};
+
+  const int kConvFilterSizes[] = {1, 3};
+  for (int filter : kConvFilterSizes) {
+    for (int stride : kStrides) {
+      for (int size : kSpatialSizes) {
+        for (int channels : kChannels) {
+          RunShape(ConvShape(size, channels, channels, filter, stride,
+                             kTfLitePaddingValid));
+        }
+      }
+    }
+  }
+  // SAME padding, as in most 3x3 layers of image models: one row and column
+  // of padding on each side.
+  for (int stride : kStrides) {
+    for (int size : kSpatialSizes) {
+      for (int channels : kChannels) {
+        RunShape(ConvShape(size, channels, channels, 3, stride,
+                           kTfLitePaddingSame));
+      }
+    }
+  }
+  // Expanding and projecting layers, where the channel count changes.
+  const int kChannelPairs[][2] = {{8, 32}, {32, 8}, {16, 64}, {64, 16}};
+  for (int filter : kConvFilterSizes) {
+    for (const auto& pair : kChannelPairs) {
+      for (TfLitePadding padding : kPaddings) {
+        RunShape(ConvShape(16, pair[0], pair[1], filter, 1, padding));
+      }
+    }
+  }
+  // Single-row inputs, as in keyword spotting models, for the 1xN path.
+  const int kRowWidths[] = {32, 64};
+  for (int width : kRowWidths) {
+    for (int channels : kChannels) {
+      RunShape({kConv, 1, width, channels, channels, 1, 3, 1,
+                kTfLitePaddingValid});
+    }
+  }
+
+  const int kDepthwiseFilterSizes[] = {3, 5};
+  for (int filter : kDepthwiseFilterSizes) {
+    for (int stride : kStrides) {
+      for (int size : kSpatialSizes) {
+        for (int channels : kChannels) {
+          for (TfLitePadding padding : kPaddings) {
+            RunShape(
+                DepthwiseConvShape(size, channels, 1, filter, stride, padding));
+          }
+        }
+      }
+    }
+  }
+  // Depth multipliers above 1 only run on arm_depthwise_conv_s8.
+  const int kDepthMultipliers[] = {2, 4};
+  for (int multiplier : kDepthMultipliers) {
+    for (int channels : kChannels) {
+      for (TfLitePadding padding : kPaddings) {
+        RunShape(DepthwiseConvShape(16, channels, multiplier, 3, 1, padding));
+      }
+    }
+  }
+}
+
+void LogDispatchSummary(const PathSet& set) {
+  for (int path = 0; path < set.num_paths; ++path) {
+    const DispatchStats& stats = set.stats[path];
+    if (stats.shapes == 0) {
+      continue;
+    }
+    MicroPrintf("%s chose %s for %d shapes; fastest there:", set.wrapper,
+                set.paths[path].name, stats.shapes);
+    for (int other = 0; other < set.num_paths; ++other) {
+      if (stats.fastest[other] > 0) {
+        MicroPrintf("  %s: %d", set.paths[other].name, stats.fastest[other]);
+      }
+    }
+  }
+}
+
+}  // namespace
+}  // namespace tflite
+
+int main(int argc, char** argv) {
+  tflite::InitializeTarget();
+
+  while (true) {
+    for (tflite::PathSet* set : tflite::kPathSets) {
+      memset(set->stats, 0, sizeof(set->stats));
+    }
+
+    MicroPrintf("Kernel benchmark, %u ticks per second",
+                static_cast<unsigned>(tflite::ticks_per_second()));
+    MicroPrintf(
+        "kernel,dtype,input,output,filter,stride,padding,path,dispatched,"
+        "fastest,ticks,macs,ticks_per_mac");
+    tflite::RunSweep();
+    MicroPrintf("");  // null MicroPrintf serves as a newline.
+
+    for (const tflite::PathSet* set : tflite::kPathSets) {
+      tflite::LogDispatchSummary(*set);
+    }
+    MicroPrintf("");  // null MicroPrintf serves as a newline.
+
+#ifdef TFLM_HOST_PLATFORM
+    // One pass is enough on the host; the board repeats for late consoles.
+    break;
+#endif
+  }
+  return 0;
+}
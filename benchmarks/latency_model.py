@@ -0,0 +1,644 @@
+#!/usr/bin/env python3
+# Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+"""Predicts per-op and total ticks of a model from fitted cost formulas.
+
+Each op is assigned the CMSIS-NN function its kernel dispatches to, following
+the same checks as kernel_benchmark, and its ticks are predicted as
+
+  ticks = fixed + per_mac * MACs + per_element * (input + output elements)
+
+with coefficients fitted per platform and dispatch path. On the boards ticks
+are clk_sys cycles. The coefficients are fitted from the CSV rows of
+kernel_benchmark and from per-op timings of measured model runs: the
+benchmark JSON reports or the CSV that AggregatingMicroProfiler::LogCsv()
+prints. They are kept in latency_coefficients.json.
+
+  # Fit the rp2350 coefficients from serial logs of a board:
+  latency_model.py --platform rp2350 --fit --kernel-log kernel.log \\
+      --log benchmarks.log
+  # Predict a candidate model against a 100 ms budget:
+  latency_model.py --platform rp2350 --predict kws.tflite --budget-ms 100
+  # Compare the predictions with measured runs:
+  latency_model.py --log benchmarks.log
+  latency_model.py --platform rp2350 --csv candidate.tflite=profile.log
+"""
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+import check_benchmarks
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+sys.path.insert(0, os.path.join(ROOT, "tools"))
+from tflite_model import BUILTIN_OPERATORS
+from tflite_model import TENSOR_TYPES
+from tflite_model import Table
+from tflite_model import read_model_bytes
+
+DEFAULT_COEFFICIENTS = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                    "latency_coefficients.json")
+
+# Model sources of the benchmark reports, by report model name.
+MODEL_SOURCES = {
+  "hello_world_float": "examples/hello_world/hello_world_float_model_data.cpp",
+  "hello_world_int8": "examples/hello_world/hello_world_int8_model_data.cpp",
+  "micro_speech_small": "examples/micro_speech_small/kws_model_data.cc",
+  "micro_speech_large": "examples/micro_speech_large/kws_model_data.cc",
+  "person_detection":
+      "examples/person_detection/tensorflow/lite/micro/tools/make/downloads/"
+      "person_model/person_detect_model_data.cpp",
+  "person_detection_no_person":
+      "examples/person_detection/tensorflow/lite/micro/tools/make/downloads/"
+      "person_model/person_detect_model_data.cpp",
+}
+
+# Cost formula features, in coefficient order.
+FEATURES = ["fixed", "per_mac", "per_element"]
+
+# Samples of a path below this count fall back to the op's coefficients.
+MIN_SAMPLES = 2
+
+PROFILER_CSV_HEADER = '"Node","Tag","Count","Min","Mean","P99","Max"'
+
+PADDING_SAME = 0
+
+
+class Tensor(object):
+
+  def __init__(self, shape, dtype, constant):
+    self.shape = shape
+    self.dtype = dtype
+    self.constant = constant
+
+  def elements(self):
+    count = 1
+    for dim in self.shape:
+      count *= dim
+    return count
+
+
+class Op(object):
+  """An operator of the model with the features of its cost formula."""
+
+  def __init__(self, index, tag, dtype, path, macs, elements):
+    self.index = index
+    self.tag = tag
+    self.dtype = dtype
+    self.path = path
+    self.macs = macs
+    self.elements = elements
+
+  def features(self):
+    return [1.0, float(self.macs), float(self.elements)]
+
+
+def same_padding(size, filter_size, stride, dilation):
+  out = (size + stride - 1) // stride
+  effective = (filter_size - 1) * dilation + 1
+  return max(0, ((out - 1) * stride + effective - size) // 2)
+
+
+def conv_path(dtype, input_shape, filter_shape, stride_w, stride_h, dilation_w,
+              dilation_h):
+  """The function arm_convolve_wrapper_s8/s16 picks, as in kernel_benchmark."""
+  if dtype == "int16":
+    return "arm_convolve_s16"
+  if dtype != "int8":
+    return "reference"
+  _, height, _, channels = input_shape
+  filter_h, filter_w = filter_shape[1], filter_shape[2]
+  # A 1x1 filter never needs padding, so SAME and VALID dispatch alike.
+  pointwise = filter_h == 1 and filter_w == 1 and channels == filter_shape[3]
+  if pointwise and dilation_w == 1 and dilation_h == 1:
+    return ("arm_convolve_1x1_s8_fast" if stride_w == 1 and stride_h == 1
+            else "arm_convolve_1x1_s8")
+  if (height == 1 and filter_h == 1 and channels == filter_shape[3] and
+      dilation_w == 1 and (stride_w * channels) % 4 == 0):
+    return "arm_convolve_1_x_n_s8"
+  return "arm_convolve_s8"
+
+
+def depthwise_conv_path(dtype, input_shape, filter_shape, padding, stride_w,
+                        stride_h, dilation_w, dilation_h, depth_multiplier):
+  """The function the DEPTHWISE_CONV_2D kernel picks, as in kernel_benchmark."""
+  filter_h, filter_w = filter_shape[1], filter_shape[2]
+  dilated = dilation_w != 1 or dilation_h != 1
+  if dtype == "int16":
+    if depth_multiplier == 1 and not dilated and filter_h * filter_w < 512:
+      return "arm_depthwise_conv_fast_s16"
+    return "arm_depthwise_conv_s16"
+  if dtype != "int8":
+    return "reference"
+  if depth_multiplier != 1 or input_shape[0] != 1 or dilated:
+    return "arm_depthwise_conv_s8"
+  pad_h = pad_w = 0
+  if padding == PADDING_SAME:
+    pad_h = same_padding(input_shape[1], filter_h, stride_h, dilation_h)
+    pad_w = same_padding(input_shape[2], filter_w, stride_w, dilation_w)
+  if filter_h == 3 and filter_w == 3 and pad_h <= 1 and pad_w <= 1:
+    return "arm_depthwise_conv_3x3_s8"
+  return "arm_depthwise_conv_s8_opt"
+
+
+def load_model(path):
+  """Returns the ops of the first subgraph of the model at `path`."""
+  data = read_model_bytes(path)
+  root = Table(data, struct.unpack_from("<I", data, 0)[0])
+  opcodes = []
+  for code in root.tables(1):
+    builtin = max(code.scalar(0, "b"), code.scalar(3, "i"))
+    name = BUILTIN_OPERATORS.get(builtin, "BUILTIN_%d" % builtin)
+    opcodes.append(code.string(1) if name == "CUSTOM" else name)
+  buffers = root.tables(4)
+
+  def is_constant(buffer_index):
+    if buffer_index <= 0 or buffer_index >= len(buffers):
+      return False
+    buffer = buffers[buffer_index]
+    # Models over 2 GB keep buffers outside the flatbuffer at an offset.
+    return buffer.length(0) > 0 or buffer.scalar(1, "Q") > 1
+
+  subgraph = root.tables(2)[0]
+  tensors = []
+  for tensor in subgraph.tables(0):
+    dtype = TENSOR_TYPES.get(tensor.scalar(1, "b"), "unknown").lower()
+    tensors.append(Tensor(tensor.vector(0, "i"), dtype,
+                          is_constant(tensor.scalar(2, "I"))))
+
+  ops = []
+  for index, op in enumerate(subgraph.tables(3)):
+    tag = opcodes[op.scalar(0, "I")]
+    inputs = [tensors[i] for i in op.vector(1, "i") if i >= 0]
+    outputs = [tensors[i] for i in op.vector(2, "i") if i >= 0]
+    elements = (sum(t.elements() for t in inputs if not t.constant) +
+                sum(t.elements() for t in outputs))
+    dtype = inputs[0].dtype if inputs else "none"
+    options = op.table(4)
+    path = ""
+    macs = 0
+    if tag == "CONV_2D" and options is not None and len(inputs) >= 2:
+      filter_shape = inputs[1].shape
+      macs = outputs[0].elements() * (filter_shape[1] * filter_shape[2] *
+                                      filter_shape[3])
+      path = conv_path(dtype, inputs[0].shape, filter_shape,
+                       options.scalar(1, "i"), options.scalar(2, "i"),
+                       options.scalar(4, "i", 1), options.scalar(5, "i", 1))
+    elif tag == "DEPTHWISE_CONV_2D" and options is not None and len(
+        inputs) >= 2:
+      filter_shape = inputs[1].shape
+      macs = outputs[0].elements() * filter_shape[1] * filter_shape[2]
+      path = depthwise_conv_path(dtype, inputs[0].shape, filter_shape,
+                                 options.scalar(0, "b"), options.scalar(1, "i"),
+                                 options.scalar(2, "i"),
+                                 options.scalar(5, "i", 1),
+                                 options.scalar(6, "i", 1),
+                                 options.scalar(3, "i", 1))
+    elif tag == "FULLY_CONNECTED" and len(inputs) >= 2:
+      macs = outputs[0].elements() * inputs[1].shape[-1]
+    ops.append(Op(index, tag, dtype, path, macs, elements))
+  return ops
+
+
+def keys(tag, dtype, path):
+  """Coefficient keys from the most to the least specific."""
+  result = ["%s/%s" % (tag, dtype), tag]
+  if path:
+    result.insert(0, "%s/%s/%s" % (tag, dtype, path))
+  return result
+
+
+def parse_kernel_log(text):
+  """Returns (key, features, ticks) samples from kernel_benchmark output.
+
+  The "kernel" rows time the TFLM kernels, so the samples include the same
+  per-op overhead as an op of a model. Each is attributed to the function
+  the wrapper dispatches to for that shape.
+  """
+  rows = []
+  for line in text.splitlines():
+    fields = line.strip().split(",")
+    if len(fields) != 13 or fields[0] == "kernel":
+      continue
+    rows.append(fields)
+  dispatched = {}
+  for row in rows:
+    if row[7] != "kernel" and row[8] == "1":
+      dispatched[tuple(row[0:7])] = row[7]
+
+  def elements(dims):
+    count = 1
+    for dim in dims.split("x"):
+      count *= int(dim)
+    return count
+
+  samples = []
+  for row in rows:
+    if row[7] != "kernel":
+      continue
+    path = dispatched.get(tuple(row[0:7]))
+    if path is None:
+      continue
+    op = Op(-1, row[0], row[1], path, int(row[11]),
+            elements(row[2]) + elements(row[3]))
+    samples.append((op, float(row[10])))
+  return samples
+
+
+def parse_kernel_rate(text):
+  match = re.search(r"Kernel benchmark, (\d+) ticks per second", text)
+  return int(match.group(1)) if match else None
+
+
+def parse_profiler_csv(text):
+  """Returns the per-op timings of the last AggregatingMicroProfiler CSV."""
+  start = text.rfind(PROFILER_CSV_HEADER)
+  if start < 0:
+    return []
+  ops = []
+  for line in text[start:].splitlines()[1:]:
+    fields = line.strip().split(",")
+    if len(fields) < 7 or not fields[0].isdigit():
+      break
+    ops.append({"node": int(fields[0]), "tag": fields[1],
+                "min_ticks": int(fields[3]), "mean_ticks": int(fields[4]),
+                "p99_ticks": int(fields[5])})
+  return ops
+
+
+class Run(object):
+  """Measured per-op ticks of one model, with the model's ops."""
+
+  def __init__(self, name, source, ops, measured, invoke_ticks=None):
+    self.name = name
+    self.source = source
+    self.ops = ops
+    self.measured = measured
+    self.invoke_ticks = invoke_ticks
+
+
+def make_run(name, model_path, measured_ops, stat, invoke_ticks=None):
+  ops = load_model(model_path)
+  measured = {}
+  for entry in measured_ops:
+    node = entry["node"]
+    if entry.get("depth", 1) != 1 or node < 0 or node >= len(ops):
+      continue
+    if entry["tag"] != ops[node].tag:
+      print("%s: node %d is %s in the log but %s in %s, skipping the run" %
+            (name, node, entry["tag"], ops[node].tag, model_path))
+      return None
+    measured[node] = entry[stat]
+  return Run(name, model_path, ops, measured, invoke_ticks)
+
+
+def runs_from_reports(reports, stat, platform):
+  runs = []
+  for report in reports:
+    if platform and report["platform"] != platform:
+      continue
+    source = MODEL_SOURCES.get(report["model"])
+    if source is None:
+      print("No model source for %s, skipping its report" % report["model"])
+      continue
+    if report["invoke"] is None:
+      continue
+    run = make_run(report["model"], os.path.join(ROOT, source), report["ops"],
+                   stat, report["invoke"][stat])
+    if run is not None:
+      runs.append(run)
+  return runs
+
+
+def model_path(name):
+  if name in MODEL_SOURCES:
+    return os.path.join(ROOT, MODEL_SOURCES[name])
+  return name
+
+
+def solve(rows, values, weights, columns):
+  """Weighted least squares over `columns` of `rows`, or None if singular."""
+  size = len(columns)
+  matrix = [[0.0] * (size + 1) for _ in range(size)]
+  for row, value, weight in zip(rows, values, weights):
+    picked = [row[c] for c in columns]
+    for i in range(size):
+      for j in range(size):
+        matrix[i][j] += weight * picked[i] * picked[j]
+      matrix[i][size] += weight * picked[i] * value
+  for col in range(size):
+    pivot = max(range(col, size), key=lambda r: abs(matrix[r][col]))
+    if abs(matrix[pivot][col]) < 1e-12 * max(1.0, abs(matrix[col][col])):
+      return None
+    matrix[col], matrix[pivot] = matrix[pivot], matrix[col]
+    for r in range(size):
+      if r != col:
+        factor = matrix[r][col] / matrix[col][col]
+        for c in range(col, size + 1):
+          matrix[r][c] -= factor * matrix[col][c]
+  return [matrix[i][size] / matrix[i][i] for i in range(size)]
+
+
+def fit_group(samples):
+  """Fits the cost formula to (features, ticks) samples.
+
+  Each sample is weighted by 1/ticks^2 so that the fit minimises relative
+  rather than absolute error, and small ops count as much as large ones.
+  Features that are zero in every sample, or whose coefficient would come
+  out negative, are left out.
+  """
+  rows = [features for features, _ in samples]
+  values = [ticks for _, ticks in samples]
+  weights = [1.0 / max(ticks, 1.0) ** 2 for ticks in values]
+  columns = [c for c in range(len(FEATURES)) if any(row[c] for row in rows)]
+  while columns:
+    solution = None
+    if len(columns) <= len(set(tuple(row) for row in rows)):
+      solution = solve(rows, values, weights, columns)
+    if solution is None:
+      columns.pop()
+      continue
+    negative = [c for c, value in zip(columns, solution) if value < 0]
+    if negative:
+      columns.remove(negative[-1])
+      continue
+    coefficients = [0.0] * len(FEATURES)
+    for c, value in zip(columns, solution):
+      coefficients[c] = value
+    return coefficients
+  return None
+
+
+def fit(samples):
+  """Returns {key: {"coefficients": [...], "samples": n}} for all keys."""
+  groups = {}
+  for op, ticks in samples:
+    for key in keys(op.tag, op.dtype, op.path):
+      groups.setdefault(key, []).append((op.features(), ticks))
+  result = {}
+  for key, group in sorted(groups.items()):
+    if len(group) < MIN_SAMPLES:
+      continue
+    coefficients = fit_group(group)
+    if coefficients is not None:
+      result[key] = {"coefficients": [round(c, 6) for c in coefficients],
+                     "samples": len(group)}
+  return result
+
+
+def predict(paths, op):
+  """Returns (ticks, key) for `op`, or (None, None) without coefficients."""
+  for key in keys(op.tag, op.dtype, op.path):
+    entry = paths.get(key)
+    if entry is not None:
+      ticks = sum(c * f for c, f in zip(entry["coefficients"], op.features()))
+      return ticks, key
+  return None, None
+
+
+def run_samples(runs):
+  samples = []
+  for run in runs:
+    for node, ticks in sorted(run.measured.items()):
+      samples.append((run.ops[node], float(ticks)))
+  return samples
+
+
+def invoke_overhead(runs):
+  """Median ticks per op of an invocation that no op accounts for.
+
+  This is the interpreter's own work around each op: dispatch, profiler
+  events and resetting temporary allocations.
+  """
+  overheads = sorted(
+      (run.invoke_ticks - sum(run.measured.values())) / len(run.ops)
+      for run in runs if run.invoke_ticks is not None and run.measured)
+  if not overheads:
+    return 0
+  return max(0, int(overheads[len(overheads) // 2]))
+
+
+def format_ms(ticks, ticks_per_second):
+  return "%.2f ms" % (1000.0 * ticks / ticks_per_second)
+
+
+def print_prediction(ops, platform_entry, budget_ms):
+  paths = platform_entry["paths"]
+  rate = platform_entry["ticks_per_second"]
+  total = platform_entry["invoke_overhead_ticks_per_op"] * len(ops)
+  missing = []
+  print("node,tag,dtype,path,macs,elements,coefficients,ticks")
+  for op in ops:
+    ticks, key = predict(paths, op)
+    if ticks is None:
+      missing.append("%d %s/%s" % (op.index, op.tag, op.dtype))
+      ticks = 0
+    total += ticks
+    print("%d,%s,%s,%s,%d,%d,%s,%d" % (op.index, op.tag, op.dtype, op.path,
+                                       op.macs, op.elements, key or "none",
+                                       ticks))
+  print("Predicted invoke: %d ticks (%s at %d ticks per second)" %
+        (total, format_ms(total, rate), rate))
+  if missing:
+    print("No coefficients for %d ops, counted as 0: %s" %
+          (len(missing), ", ".join(missing)))
+  if budget_ms is not None:
+    fits = 1000.0 * total / rate <= budget_ms
+    print("%s the %g ms budget" % ("Within" if fits else "OVER", budget_ms))
+    return 0 if fits and not missing else 1
+  return 0
+
+
+def relative_error(predicted, measured):
+  return (predicted - measured) / measured if measured else 0.0
+
+
+def check_runs(runs, platform_entry):
+  """Prints the prediction error of each op and run; returns the errors."""
+  paths = platform_entry["paths"]
+  op_errors = []
+  run_errors = []
+  for run in runs:
+    print("%s:" % run.name)
+    predicted_total = (platform_entry["invoke_overhead_ticks_per_op"] *
+                       len(run.ops))
+    for node, measured in sorted(run.measured.items()):
+      op = run.ops[node]
+      predicted, key = predict(paths, op)
+      if predicted is None:
+        print("  %d %s: no coefficients, measured %d" % (node, op.tag,
+                                                         measured))
+        continue
+      predicted_total += predicted
+      error = relative_error(predicted, measured)
+      op_errors.append(abs(error))
+      print("  %d %s (%s): predicted %d, measured %d (%+.1f%%)" %
+            (node, op.tag, key, predicted, measured, 100.0 * error))
+    if run.invoke_ticks:
+      error = relative_error(predicted_total, run.invoke_ticks)
+      run_errors.append(abs(error))
+      print("  invoke: predicted %d, measured %d (%+.1f%%)" %
+            (predicted_total, run.invoke_ticks, 100.0 * error))
+  return op_errors, run_errors
+
+
+def mean(values):
+  return sum(values) / len(values) if values else 0.0
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+  parser.add_argument("--platform",
+                      help="host, rp2040 (pico_w) or rp2350 (pico2). Taken "
+                      "from the reports when not given.")
+  parser.add_argument("--coefficients", default=DEFAULT_COEFFICIENTS)
+  parser.add_argument("--build-dir",
+                      help="Host build directory to run the benchmarks from.")
+  parser.add_argument("--log", action="append", default=[],
+                      help="Captured benchmark output to read reports from.")
+  parser.add_argument("--csv", action="append", default=[],
+                      metavar="MODEL=LOG",
+                      help="Reads the AggregatingMicroProfiler CSV in LOG as "
+                      "a run of MODEL, a report model name or a model file.")
+  parser.add_argument("--kernel-log", action="append", default=[],
+                      help="Captured kernel_benchmark output to fit from.")
+  parser.add_argument("--stat", default="mean_ticks",
+                      choices=check_benchmarks.TIMING_KEYS,
+                      help="Measured statistic to fit and check against.")
+  parser.add_argument("--fit", action="store_true",
+                      help="Refits the coefficients of the platform.")
+  parser.add_argument("--predict", action="append", default=[],
+                      help="Model to predict: .tflite or a C array source.")
+  parser.add_argument("--budget-ms", type=float,
+                      help="Fails if a predicted invocation takes longer.")
+  args = parser.parse_args()
+
+  text = ""
+  if args.build_dir:
+    text += check_benchmarks.run_executables(args.build_dir)
+  for log in args.log:
+    with open(log) as f:
+      text += f.read()
+  # A board prints its reports on every pass, so keep the last of each model.
+  reports = {}
+  for report in check_benchmarks.parse_reports(text):
+    reports[(report["platform"], report["model"])] = report
+  platform = args.platform
+  if platform is None:
+    platforms = sorted(set(p for p, _ in reports))
+    if len(platforms) != 1:
+      print("Pass --platform, the reports are from %s" %
+            (", ".join(platforms) or "no platform"))
+      return 1
+    platform = platforms[0]
+  runs = runs_from_reports(list(reports.values()), args.stat, platform)
+  for pair in args.csv:
+    name, _, log = pair.partition("=")
+    with open(log) as f:
+      measured = parse_profiler_csv(f.read())
+    if not measured:
+      print("No profiler CSV in %s" % log)
+      return 1
+    run = make_run(name, model_path(name), measured, args.stat)
+    if run is not None:
+      runs.append(run)
+
+  with open(args.coefficients) as f:
+    coefficients = json.load(f)
+
+  if args.fit:
+    kernel_samples = []
+    rate = None
+    for log in args.kernel_log:
+      with open(log) as f:
+        kernel_text = f.read()
+      kernel_samples += parse_kernel_log(kernel_text)
+      rate = rate or parse_kernel_rate(kernel_text)
+    samples = kernel_samples + run_samples(runs)
+    if not samples:
+      print("Nothing to fit: pass --kernel-log, --log, --csv or --build-dir.")
+      return 1
+    for (report_platform, _), report in sorted(reports.items()):
+      if report_platform == platform:
+        rate = report["ticks_per_second"]
+    if rate is None:
+      print("No ticks per second for %s in the logs." % platform)
+      return 1
+    entry = {
+      "ticks_per_second": rate,
+      "invoke_overhead_ticks_per_op": invoke_overhead(runs),
+      "paths": fit(samples),
+    }
+    coefficients["platforms"][platform] = entry
+    with open(args.coefficients, "w") as f:
+      json.dump(coefficients, f, indent=2, sort_keys=True)
+      f.write("\n")
+    print("Fitted %d cost formulas for %s from %d samples." %
+          (len(entry["paths"]), platform, len(samples)))
+
+    # Each model's error with the formulas fitted without its own runs shows
+    # how well the fit carries over to a model it has not seen.
+    held_out_errors = []
+    for held_out in runs:
+      others = [run for run in runs if run.source != held_out.source]
+      held_out_entry = {
+        "ticks_per_second": rate,
+        "invoke_overhead_ticks_per_op": invoke_overhead(others),
+        "paths": fit(kernel_samples + run_samples(others)),
+      }
+      held_out_errors += check_runs([held_out], held_out_entry)[1]
+    if held_out_errors:
+      print("[%s] held-out invoke error: mean %.1f%%, max %.1f%% over %d "
+            "models" % (platform, 100.0 * mean(held_out_errors),
+                        100.0 * max(held_out_errors), len(held_out_errors)))
+    return 0
+
+  platform_entry = coefficients["platforms"].get(platform)
+  if platform_entry is None:
+    print("No coefficients for %s; fit them with --fit from its kernel "
+          "benchmark and benchmark logs." % platform)
+    return 1
+
+  status = 0
+  for path in args.predict:
+    print("%s on %s:" % (path, platform))
+    status |= print_prediction(load_model(path), platform_entry,
+                               args.budget_ms)
+  if runs:
+    op_errors, run_errors = check_runs(runs, platform_entry)
+    print("[%s] op error: mean %.1f%%, max %.1f%% over %d ops" %
+          (platform, 100.0 * mean(op_errors), 100.0 * max(op_errors or [0]),
+           len(op_errors)))
+    if run_errors:
+      print("[%s] invoke error: mean %.1f%%, max %.1f%% over %d runs" %
+            (platform, 100.0 * mean(run_errors), 100.0 * max(run_errors),
+             len(run_errors)))
+  elif not args.predict:
+    print("No runs to check and no model to predict.")
+    return 1
+  return status
+
+
+if __name__ == "__main__":
+  sys.exit(main())
@@ -0,0 +1,113 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "hello_world_float_model_data.h"
+#include "hello_world_int8_model_data.h"
+#include "tensorflow/lite/micro/aggregating_micro_profiler.h"
+#include "tensorflow/lite/micro/benchmarks/micro_benchmark.h"
+#include "tensorflow/lite/micro/benchmarks/micro_benchmark_report.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/system_setup.h"
+
+/*
+ * Hello world benchmark. Runs the float and int8 sine models on a fixed input
+ * and prints per-node statistics and a JSON report for each, for
+ * benchmarks/check_benchmarks.py.
+ */
+
+namespace tflite {
+
+using HelloWorldOpResolver = MicroMutableOpResolver<1>;
+using HelloWorldProfiler = StaticAggregatingMicroProfiler<8>;
+
+// The recording allocator of MicroBenchmarkRunner needs more than the 2000
+// bytes the example itself uses.
+constexpr int kTensorArenaSize = 4 * 1024;
+constexpr int kWarmupIterations = 10;
+constexpr int kTimedIterations = 1000;
+constexpr int kRandomSeed = 42;
+alignas(16) uint8_t tensor_arena[kTensorArenaSize];
+
+uint8_t op_resolver_buffer[sizeof(HelloWorldOpResolver)];
+uint8_t benchmark_runner_buffer[sizeof(MicroBenchmarkRunner<float>)];
+
+// Builds a runner for `model` in the shared arena and buffers, so only one
+// may exist at a time.
+template <typename inputT>
+MicroBenchmarkRunner<inputT> *CreateBenchmarkRunner(
+    const uint8_t *model, MicroProfilerInterface *profiler) {
+  static_assert(sizeof(MicroBenchmarkRunner<inputT>) <=
+                    sizeof(benchmark_runner_buffer),
+                "benchmark_runner_buffer is too small");
+  HelloWorldOpResolver *op_resolver =
+      new (op_resolver_buffer) HelloWorldOpResolver();
+  op_resolver->AddFullyConnected();
+  return new (benchmark_runner_buffer) MicroBenchmarkRunner<inputT>(
+      model, op_resolver, tensor_arena, kTensorArenaSize, profiler,
+      /*num_resource_variables=*/0, /*log_arena_timeline=*/true);
+}
+
+template <typename inputT>
+void HelloWorldBenchmark(const char *model_name,
+                         MicroBenchmarkRunner<inputT> &benchmark_runner,
+                         AggregatingMicroProfiler &profiler) {
+  if (benchmark_runner.RunIterations(kWarmupIterations, kTimedIterations,
+                                     profiler) != kTfLiteOk) {
+    MicroPrintf("%s failed", model_name);
+    return;
+  }
+  profiler.Log();
+  MicroPrintf("");  // null MicroPrintf serves as a newline.
+
+  const MicroBenchmarkResult result = {model_name, kWarmupIterations,
+                                       kTimedIterations,
+                                       benchmark_runner.arena_used_bytes(),
+                                       kTensorArenaSize};
+  LogMicroBenchmarkJson(result, profiler);
+  MicroPrintf("");  // null MicroPrintf serves as a newline.
+}
+
+}  // namespace tflite
+
+int main(int argc, char **argv) {
+  tflite::InitializeTarget();
+
+  while (true) {
+    tflite::HelloWorldProfiler profiler;
+
+    tflite::MicroBenchmarkRunner<float> *float_runner =
+        tflite::CreateBenchmarkRunner<float>(g_hello_world_float_model_data,
+                                             &profiler);
+    const float x = 1.0f;
+    float_runner->SetInput(&x);
+    tflite::HelloWorldBenchmark("hello_world_float", *float_runner, profiler);
+    float_runner->~MicroBenchmarkRunner();
+
+    profiler.ResetStats();
+    tflite::MicroBenchmarkRunner<int8_t> *int8_runner =
+        tflite::CreateBenchmarkRunner<int8_t>(g_hello_world_int8_model_data,
+                                              &profiler);
+    int8_runner->SetRandomInput(tflite::kRandomSeed);
+    tflite::HelloWorldBenchmark("hello_world_int8", *int8_runner, profiler);
+    int8_runner->~MicroBenchmarkRunner();
+
+#ifdef TFLM_HOST_PLATFORM
+    // One pass is enough on the host; the board repeats for late consoles.
+    break;
+#endif
+  }
+  return 0;
+}
@@ -0,0 +1,242 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/model_store.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "hello_world_float_model_data.h"
+#include "hello_world_int8_model_data.h"
+#include "tensorflow/lite/micro/flash_partition.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+// Swaps the float and int8 hello_world models through the two slots of a
+// model store. On the board the store is the last 32 KiB of flash; on the
+// host it is a file in the working directory.
+
+namespace {
+
+using HelloWorldOpResolver = tflite::MicroMutableOpResolver<1>;
+
+constexpr uint32_t kPartitionSize = 32 * 1024;
+#ifdef PICO_FLASH_SIZE_BYTES
+constexpr uint32_t kPartitionOffset = PICO_FLASH_SIZE_BYTES - kPartitionSize;
+#else
+constexpr uint32_t kPartitionOffset = 0;
+#endif
+constexpr const char* kHostFlashPath = "hello_world_model_store_test.flash";
+
+constexpr int kArenaSize = 3000;
+alignas(16) uint8_t arena[kArenaSize];
+alignas(16) uint8_t reference_arena[kArenaSize];
+
+void OpenEmptyPartition(tflite::FlashPartition& partition) {
+  TF_LITE_MICRO_EXPECT(
+      partition.Open(kPartitionOffset, kPartitionSize, kHostFlashPath));
+  TF_LITE_MICRO_EXPECT(partition.Erase(0, kPartitionSize));
+}
+
+void ExpectActiveModel(const tflite::ModelStore& store,
+                       const unsigned char* model_data,
+                       unsigned int model_size) {
+  TF_LITE_MICRO_EXPECT_EQ(model_size, store.model_size());
+  TF_LITE_MICRO_EXPECT_EQ(
+      0, memcmp(model_data, store.model_data(), store.model_size()));
+  TF_LITE_MICRO_EXPECT(store.VerifyActiveModel());
+}
+
+// Runs the loaded model and the same model from its compiled-in array on the
+// same input, and expects the same output.
+void ExpectSameOutput(tflite::MicroInterpreter* interpreter,
+                      const unsigned char* model_data) {
+  HelloWorldOpResolver op_resolver;
+  op_resolver.AddFullyConnected();
+  tflite::MicroInterpreter reference(tflite::GetModel(model_data),
+                                     op_resolver, reference_arena,
+                                     kArenaSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, reference.AllocateTensors());
+  TF_LITE_MICRO_EXPECT(interpreter != nullptr);
+  TF_LITE_MICRO_EXPECT_EQ(reference.input(0)->bytes,
+                          interpreter->input(0)->bytes);
+  memset(reference.input(0)->data.raw, 0x21, reference.input(0)->bytes);
+  memset(interpreter->input(0)->data.raw, 0x21, reference.input(0)->bytes);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, reference.Invoke());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter->Invoke());
+  TF_LITE_MICRO_EXPECT_EQ(0, memcmp(reference.output(0)->data.raw,
+                                    interpreter->output(0)->data.raw,
+                                    reference.output(0)->bytes));
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(EmptyStoreHasNoModel) {
+  tflite::FlashPartition partition;
+  OpenEmptyPartition(partition);
+  tflite::ModelStore store(partition);
+  TF_LITE_MICRO_EXPECT(!store.Mount());
+  TF_LITE_MICRO_EXPECT_EQ(-1, store.active_slot());
+  TF_LITE_MICRO_EXPECT(store.model() == nullptr);
+}
+
+TF_LITE_MICRO_TEST(InstalledModelsAlternateSlotsAndSurviveRemount) {
+  tflite::FlashPartition partition;
+  OpenEmptyPartition(partition);
+  tflite::ModelStore store(partition);
+  store.Mount();
+
+  TF_LITE_MICRO_EXPECT(store.Install(g_hello_world_float_model_data,
+                                     g_hello_world_float_model_data_size));
+  TF_LITE_MICRO_EXPECT_EQ(0, store.active_slot());
+  ExpectActiveModel(store, g_hello_world_float_model_data,
+                    g_hello_world_float_model_data_size);
+
+  TF_LITE_MICRO_EXPECT(store.Install(g_hello_world_int8_model_data,
+                                     g_hello_world_int8_model_data_size));
+  TF_LITE_MICRO_EXPECT_EQ(1, store.active_slot());
+  ExpectActiveModel(store, g_hello_world_int8_model_data,
+                    g_hello_world_int8_model_data_size);
+
+  // As after a reset: the newest slot is active again.
+  partition.Close();
+  tflite::FlashPartition reopened;
+  TF_LITE_MICRO_EXPECT(
+      reopened.Open(kPartitionOffset, kPartitionSize, kHostFlashPath));
+  tflite::ModelStore remounted(reopened);
+  TF_LITE_MICRO_EXPECT(remounted.Mount());
+  TF_LITE_MICRO_EXPECT_EQ(1, remounted.active_slot());
+  ExpectActiveModel(remounted, g_hello_world_int8_model_data,
+                    g_hello_world_int8_model_data_size);
+}
+
+TF_LITE_MICRO_TEST(InterruptedInstallKeepsActiveModel) {
+  tflite::FlashPartition partition;
+  OpenEmptyPartition(partition);
+  tflite::ModelStore store(partition);
+  store.Mount();
+  TF_LITE_MICRO_EXPECT(store.Install(g_hello_world_float_model_data,
+                                     g_hello_world_float_model_data_size));
+
+  // Half of the int8 model is written when power is lost.
+  TF_LITE_MICRO_EXPECT(
+      store.BeginInstall(g_hello_world_int8_model_data_size));
+  TF_LITE_MICRO_EXPECT(store.Write(g_hello_world_int8_model_data,
+                                   g_hello_world_int8_model_data_size / 2));
+  tflite::ModelStore remounted(partition);
+  TF_LITE_MICRO_EXPECT(remounted.Mount());
+  TF_LITE_MICRO_EXPECT_EQ(0, remounted.active_slot());
+  ExpectActiveModel(remounted, g_hello_world_float_model_data,
+                    g_hello_world_float_model_data_size);
+}
+
+TF_LITE_MICRO_TEST(InstallInOddSizedPieces) {
+  tflite::FlashPartition partition;
+  OpenEmptyPartition(partition);
+  tflite::ModelStore store(partition);
+  store.Mount();
+
+  constexpr uint32_t kPiece = 100;
+  const uint32_t size = g_hello_world_int8_model_data_size;
+  TF_LITE_MICRO_EXPECT(store.BeginInstall(size));
+  for (uint32_t done = 0; done < size; done += kPiece) {
+    const uint32_t piece = size - done < kPiece ? size - done : kPiece;
+    TF_LITE_MICRO_EXPECT(
+        store.Write(g_hello_world_int8_model_data + done, piece));
+  }
+  TF_LITE_MICRO_EXPECT(store.CommitInstall());
+  ExpectActiveModel(store, g_hello_world_int8_model_data, size);
+}
+
+TF_LITE_MICRO_TEST(InvalidModelsAreRejected) {
+  tflite::FlashPartition partition;
+  OpenEmptyPartition(partition);
+  tflite::ModelStore store(partition);
+  store.Mount();
+  TF_LITE_MICRO_EXPECT(store.Install(g_hello_world_float_model_data,
+                                     g_hello_world_float_model_data_size));
+
+  // Not a flatbuffer, too large for a slot, and written short of its size.
+  const uint8_t not_a_model[64] = {1, 2, 3, 4};
+  TF_LITE_MICRO_EXPECT(!store.Install(not_a_model, sizeof(not_a_model)));
+  TF_LITE_MICRO_EXPECT(!store.BeginInstall(store.model_capacity() + 1));
+  TF_LITE_MICRO_EXPECT(
+      store.BeginInstall(g_hello_world_int8_model_data_size));
+  TF_LITE_MICRO_EXPECT(store.Write(g_hello_world_int8_model_data, 16));
+  TF_LITE_MICRO_EXPECT(!store.CommitInstall());
+
+  TF_LITE_MICRO_EXPECT(store.Mount());
+  TF_LITE_MICRO_EXPECT_EQ(0, store.active_slot());
+  ExpectActiveModel(store, g_hello_world_float_model_data,
+                    g_hello_world_float_model_data_size);
+}
+
+TF_LITE_MICRO_TEST(RollbackReturnsToPreviousModel) {
+  tflite::FlashPartition partition;
+  OpenEmptyPartition(partition);
+  tflite::ModelStore store(partition);
+  store.Mount();
+  TF_LITE_MICRO_EXPECT(store.Install(g_hello_world_float_model_data,
+                                     g_hello_world_float_model_data_size));
+  // With only one model there is nothing to go back to.
+  TF_LITE_MICRO_EXPECT(!store.Rollback());
+  TF_LITE_MICRO_EXPECT_EQ(0, store.active_slot());
+
+  TF_LITE_MICRO_EXPECT(store.Install(g_hello_world_int8_model_data,
+                                     g_hello_world_int8_model_data_size));
+  TF_LITE_MICRO_EXPECT(store.Rollback());
+  TF_LITE_MICRO_EXPECT_EQ(0, store.active_slot());
+  ExpectActiveModel(store, g_hello_world_float_model_data,
+                    g_hello_world_float_model_data_size);
+
+  // The next install replaces the rolled back slot.
+  TF_LITE_MICRO_EXPECT(store.Install(g_hello_world_int8_model_data,
+                                     g_hello_world_int8_model_data_size));
+  TF_LITE_MICRO_EXPECT_EQ(1, store.active_slot());
+}
+
+TF_LITE_MICRO_TEST(HotSwapInterpreterRunsEachInstalledModel) {
+  tflite::FlashPartition partition;
+  OpenEmptyPartition(partition);
+  tflite::ModelStore store(partition);
+  store.Mount();
+  HelloWorldOpResolver op_resolver;
+  op_resolver.AddFullyConnected();
+  tflite::HotSwapInterpreter hot_swap(op_resolver, arena, kArenaSize);
+  TF_LITE_MICRO_EXPECT(hot_swap.interpreter() == nullptr);
+
+  TF_LITE_MICRO_EXPECT(store.Install(g_hello_world_float_model_data,
+                                     g_hello_world_float_model_data_size));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, hot_swap.Load(store.model()));
+  ExpectSameOutput(hot_swap.interpreter(), g_hello_world_float_model_data);
+
+  TF_LITE_MICRO_EXPECT(store.Install(g_hello_world_int8_model_data,
+                                     g_hello_world_int8_model_data_size));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, hot_swap.Load(store.model()));
+  ExpectSameOutput(hot_swap.interpreter(), g_hello_world_int8_model_data);
+
+  TF_LITE_MICRO_EXPECT(store.Rollback());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, hot_swap.Load(store.model()));
+  ExpectSameOutput(hot_swap.interpreter(), g_hello_world_float_model_data);
+
+  hot_swap.Unload();
+  TF_LITE_MICRO_EXPECT(hot_swap.interpreter() == nullptr);
+}
+
+TF_LITE_MICRO_TESTS_END
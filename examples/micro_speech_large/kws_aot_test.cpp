@@ -0,0 +1,111 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <cstdint>
+#include <cstring>
+
+#include "kws_model_aot.h"
+#include "model_config.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+// The ahead-of-time compiled model must produce the same bytes as
+// MicroInterpreter running the flatbuffer it was generated from.
+
+namespace {
+
+using KwsOpResolver =
+    tflite::MicroMutableOpResolver<ModelConfig::kOpResolverSize>;
+
+constexpr int kRandomInputs = 8;
+
+alignas(16) uint8_t aot_arena[KwsModelAot::kArenaSize];
+
+void FillRandom(int8_t* buffer, size_t size, uint32_t seed) {
+  uint32_t state = seed;
+  for (size_t i = 0; i < size; ++i) {
+    state = state * 1664525u + 1013904223u;
+    buffer[i] = static_cast<int8_t>(state >> 24);
+  }
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(AotModelMatchesInterpreterTensors) {
+  KwsOpResolver op_resolver;
+  ModelConfig::InitializeOpResolver(op_resolver);
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(ModelConfig::GetModelData()), op_resolver,
+      tensor_arena, ModelConfig::kTensorArenaSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+
+  KwsModelAot model(aot_arena);
+  TF_LITE_MICRO_EXPECT_EQ(interpreter.inputs_size(), model.inputs_size());
+  TF_LITE_MICRO_EXPECT_EQ(interpreter.outputs_size(), model.outputs_size());
+
+  const TfLiteTensor* input = interpreter.input(0);
+  TF_LITE_MICRO_EXPECT_EQ(input->bytes, KwsModelAot::kInputBytes[0]);
+  TF_LITE_MICRO_EXPECT_EQ(input->params.scale, KwsModelAot::kInputScales[0]);
+  TF_LITE_MICRO_EXPECT_EQ(input->params.zero_point,
+                          KwsModelAot::kInputZeroPoints[0]);
+
+  const TfLiteTensor* output = interpreter.output(0);
+  TF_LITE_MICRO_EXPECT_EQ(output->bytes, KwsModelAot::kOutputBytes[0]);
+  TF_LITE_MICRO_EXPECT_EQ(output->params.scale,
+                          KwsModelAot::kOutputScales[0]);
+  TF_LITE_MICRO_EXPECT_EQ(output->params.zero_point,
+                          KwsModelAot::kOutputZeroPoints[0]);
+
+  // Without tensor metadata, kernel state and the memory planner's own
+  // buffers, the compiled model needs less memory.
+  TF_LITE_MICRO_EXPECT_LE(static_cast<size_t>(KwsModelAot::kArenaSize),
+                          interpreter.arena_used_bytes());
+}
+
+TF_LITE_MICRO_TEST(AotModelMatchesInterpreterOutputs) {
+  KwsOpResolver op_resolver;
+  ModelConfig::InitializeOpResolver(op_resolver);
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(ModelConfig::GetModelData()), op_resolver,
+      tensor_arena, ModelConfig::kTensorArenaSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  KwsModelAot model(aot_arena);
+
+  TfLiteTensor* input = interpreter.input(0);
+  const TfLiteTensor* output = interpreter.output(0);
+  // Constant inputs at both ends of the range, then random ones.
+  for (int run = 0; run < kRandomInputs + 2; ++run) {
+    if (run == 0) {
+      memset(input->data.int8, -128, input->bytes);
+    } else if (run == 1) {
+      memset(input->data.int8, 127, input->bytes);
+    } else {
+      FillRandom(input->data.int8, input->bytes, run);
+    }
+    memcpy(model.input(0), input->data.int8, input->bytes);
+
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, model.Invoke());
+    for (size_t j = 0; j < output->bytes; ++j) {
+      TF_LITE_MICRO_EXPECT_EQ(output->data.int8[j], model.output(0)[j]);
+    }
+  }
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,2469 @@
+// Generated by tools/aot_compile.py from
+//   examples/micro_speech_large/kws_model_data.cc.
+// Do not edit; regenerate with:
+//   python3 tools/aot_compile.py \
+//      examples/micro_speech_large/kws_model_data.cc --class-name KwsModelAot \
+//      --header examples/micro_speech_large/kws_model_aot.h --source \
+//      examples/micro_speech_large/kws_model_aot.cc
+
+#include "kws_model_aot.h"
+
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "third_party/cmsis_nn/Include/arm_nnfunctions.h"
+
+namespace {
+
+// Arena plan: offset, bytes and the operators that use each buffer.
+constexpr int kTensor22Offset = 0;  // 8000 bytes, ops 0..1
+constexpr int kTensor24Offset = 0;  // 8000 bytes, ops 2..3
+constexpr int kTensor26Offset = 0;  // 8000 bytes, ops 4..5
+constexpr int kTensor28Offset = 0;  // 8000 bytes, ops 6..7
+constexpr int kTensor30Offset = 0;  // 8000 bytes, ops 8..9
+constexpr int kTensor33Offset = 0;  // 12 bytes, ops 11..12
+constexpr int kTensor34Offset = 16;  // 12 bytes, ops 12..13
+constexpr int kOp9ScratchOffset = 8000;  // 256 bytes, ops 9..9
+constexpr int kTensor0Offset = 8000;  // 490 bytes, ops -1..0
+constexpr int kTensor23Offset = 8000;  // 8000 bytes, ops 1..2
+constexpr int kTensor25Offset = 8000;  // 8000 bytes, ops 3..4
+constexpr int kTensor27Offset = 8000;  // 8000 bytes, ops 5..6
+constexpr int kTensor29Offset = 8000;  // 8000 bytes, ops 7..8
+constexpr int kTensor31Offset = 8256;  // 64 bytes, ops 9..11
+constexpr int kOp0ScratchOffset = 8496;  // 160 bytes, ops 0..0
+constexpr int kOp2ScratchOffset = 16000;  // 256 bytes, ops 2..2
+constexpr int kOp4ScratchOffset = 16000;  // 256 bytes, ops 4..4
+constexpr int kOp6ScratchOffset = 16000;  // 256 bytes, ops 6..6
+constexpr int kOp8ScratchOffset = 16000;  // 256 bytes, ops 8..8
+
+// Operator 0: CONV_2D
+// functional_1/conv2d/Conv2D
+alignas(16) const int8_t kTensor17Data[2560] = {
+    -6, 19, -11, 18, 83, 21, -47, -25, 127, 59, -50, 44,
+    29, -35, 30, 110, -48, -85, 66, 34, -65, -14, 11, -92,
+    -76, 19, -16, -76, -70, -3, 17, 17, 6, 12, 17, -33,
+    41, 18, 18, -47, 16, 59, 70, -98, -24, 13, 121, -62,
+    -50, -12, 127, -29, -51, -115, 69, 46, -70, -23, -13, 55,
+    -2, -49, -49, 46, 15, -11, -68, 40, 52, 18, -89, -5,
+    87, 34, -101, 0, 16, 21, -66, 65, 18, -127, 31, 75,
+    -68, -39, -26, 23, -41, -34, -67, 83, -92, 8, -13, 39,
+    -12, 27, -25, -68, -7, 94, 50, -96, -3, 73, 70, -106,
+    55, 53, 60, 16, -16, -5, 56, -30, 45, -20, -12, 15,
+    16, 13, 18, 10, 61, 30, 63, 59, 40, 67, -21, -12,
+    3, 37, -72, -70, -59, 10, -7, -112, -127, -79, -22, -56,
+    -25, -68, -21, -7, 20, -40, -29, 28, 59, -18, 12, 124,
+    50, 8, 35, 51, -35, -37, -66, 4, -12, 13, -59, 58,
+    -6, 13, -72, 77, 3, -56, -16, 13, -29, -106, 20, -15,
+    -4, -127, -29, 46, 58, 59, -25, 47, 35, 64, 54, 30,
+    -12, 94, 84, -56, -4, -12, 69, -55, 35, -17, -13, -18,
+    55, 0, -82, 1, -13, 18, -72, 50, -4, -2, -105, 16,
+    -50, 19, -66, 97, -30, -16, -11, 105, -49, -14, 29, 127,
+    -42, -50, -4, 114, -49, 52, 29, 57, -11, 18, 48, 19,
+    35, -21, -1, -7, 30, -1, 20, 10, 49, 29, -10, 35,
+    32, -8, -40, 27, 18, 7, 9, 37, -25, 5, 8, 1,
+    -95, 2, 2, -4, -127, 3, -13, -52, -45, 22, -31, -27,
+    35, -16, 3, -5, 24, 37, -86, 106, 68, -22, -24, -3,
+    95, -127, 79, 19, -29, -78, 56, -83, -98, -18, 12, -54,
+    -112, 60, 32, -24, -55, 80, -56, 91, 10, 33, -40, 33,
+    8, 12, -4, 14, 94, -3, 29, -27, 11, 17, -67, 48,
+    -12, 67, 5, 54, -39, 101, 15, -19, -19, 70, 60, -51,
+    15, -9, 127, -61, 27, -103, 76, -36, -11, -121, -50, 51,
+    34, -2, -39, 16, 43, 14, -72, 11, 3, 2, -25, 13,
+    -127, 124, -117, 5, -76, 57, -54, 49, -6, 101, -26, 106,
+    -31, 12, 3, 110, -5, 24, -43, 104, -5, 7, -14, 120,
+    54, 1, 8, 72, 64, -64, 8, 4, -1, -90, -7, 67,
+    49, -101, -61, 103, 5, -31, -33, 80, 37, -13, -57, 48,
+    19, -10, -103, 101, 34, 9, -61, 61, 25, 47, 0, 58,
+    -23, 55, 40, -49, 0, 24, 37, -127, 24, -15, -13, -60,
+    -17, -27, 55, -14, -26, -21, 34, 27, 4, -49, 60, -14,
+    60, -9, -59, -23, 67, 69, -95, -11, 54, 124, -80, 4,
+    -27, 63, 50, -15, -11, -9, 127, 10, -115, -67, 61, -38,
+    2, -48, 1, 48, 16, -43, 0, 10, -30, -9, 64, -33,
+    41, -27, -28, 45, -30, 37, 41, 127, -58, 64, 70, 44,
+    -71, 0, -3, -68, -2, -8, -64, -53, -1, -6, -43, -42,
+    37, -4, -34, -26, 15, -27, -11, 26, 29, 15, 24, 47,
+    5, 3, 70, 13, -5, -8, -44, -18, 6, -6, 17, 11,
+    -5, -6, 50, -48, -36, -26, 72, -80, -27, -26, 22, -82,
+    5, -55, 12, -87, -10, -2, -36, -29, 12, -2, -56, 56,
+    48, 9, -23, 122, 34, -18, 17, 127, 40, 127, -59, 30,
+    26, 14, -55, 1, 55, -99, 20, 0, -55, -105, -8, -17,
+    -9, -32, 23, 52, -23, -25, 53, 31, -83, 68, 63, -6,
+    -103, -15, 12, -15, -17, 89, 33, -87, 103, 12, -31, -78,
+    18, -25, 62, 18, -31, 16, 34, 14, -39, -63, 97, -28,
+    -74, -30, 46, 63, -55, -25, 11, 39, 41, -20, -12, -12,
+    -15, 52, -86, -75, 65, 26, -51, -99, 38, 63, -25, -109,
+    61, 127, -40, -32, -9, -8, -30, -36, 45, 48, -22, -3,
+    -5, 26, 34, 119, -54, -85, 51, 57, 10, -31, -18, -127,
+    11, 36, -37, -103, 0, 0, 14, 55, 2, -4, 10, 28,
+    -14, -15, -7, 15, 20, 16, -1, 10, -36, -12, 18, 49,
+    4, 14, 112, -10, 13, 28, 64, 11, 40, 79, 21, 7,
+    10, 109, 21, -5, 50, 112, 25, 12, -3, 19, -70, -85,
+    25, -66, -57, -95, 1, -54, -46, -127, 53, -89, -109, -51,
+    15, -49, -47, 110, 25, 12, -47, 43, 3, 43, -11, -71,
+    -5, 74, 40, -118, -50, 86, 127, -113, -111, 48, 71, -87,
+    -34, -16, 71, 2, -47, -29, 63, -1, 33, -28, -3, 14,
+    30, -43, -42, 24, 41, 5, -4, 34, 40, -24, 43, 24,
+    -11, -31, 75, -3, -37, -14, 93, -13, 34, -7, 32, -74,
+    5, 41, -42, -127, 14, 79, -54, -64, -44, 64, -10, -10,
+    14, -3, -40, -7, -41, -4, -49, -19, -4, 93, 57, 42,
+    -35, 40, 73, 12, -84, 46, -7, -3, -62, -25, -19, 18,
+    -48, 32, -6, 5, -46, -10, 47, 7, 41, -13, 10, -25,
+    52, -15, 31, -35, 127, -12, 5, -80, 104, -15, -12, -48,
+    -85, 19, 68, -127, -72, 2, 95, 4, -41, -4, 25, 97,
+    -36, 13, 33, 124, -11, -28, -28, 109, 34, 8, -11, 16,
+    64, -14, -126, 4, 68, 2, -60, -54, 80, -6, -76, -12,
+    33, 2, -106, 63, -47, -29, 14, -32, -12, 12, -34, -94,
+    39, 9, -58, -127, 7, 15, -46, -71, -2, 20, -28, -15,
+    -71, -19, 7, -17, -50, 2, 60, -21, -12, 26, 91, -20,
+    15, 48, 43, -27, 36, 59, -28, -17, -8, 20, -2, -16,
+    -7, 4, -20, 3, 26, 43, -40, 61, 25, -24, 49, 80,
+    12, -66, 68, -26, -6, -45, -27, -127, -41, 34, -74, -55,
+    -58, 17, -5, 53, 17, 26, 53, 53, 22, 4, 2, 1,
+    -43, -4, -92, 71, -59, 1, 2, 27, 27, 47, 81, -33,
+    -8, 91, 115, 1, -28, 109, 113, 9, -39, 21, 91, 16,
+    7, 12, 32, -89, 1, -27, -99, -59, 24, -116, -127, -44,
+    4, -89, -73, 105, 33, 18, -55, 127, -3, 11, -58, 68,
+    -15, 8, -29, 56, -52, -9, 11, -17, -63, -2, 24, -38,
+    -64, -45, 26, -30, -54, -39, 22, -7, -33, -14, 33, 2,
+    -44, -20, 50, 18, 32, -8, 16, 22, 7, 26, 78, 121,
+    0, 58, 54, 45, -11, 52, 15, -5, 47, 64, 6, -4,
+    77, 36, 3, -127, 84, -34, 38, -125, 68, -75, -3, -101,
+    32, -33, 23, -35, 23, -48, -89, -14, -37, 43, -125, 100,
+    20, 17, 50, -10, -23, 9, -11, -3, 17, 27, -70, -16,
+    -41, 51, -113, 41, -92, 44, -73, 92, -11, -90, 58, 25,
+    43, -98, 127, 8, -1, -51, -4, -10, 9, 59, -43, 20,
+    33, 64, 28, -26, -10, -7, -34, 33, -26, -15, -31, 10,
+    -26, 4, -11, 24, -50, 41, -34, 48, -15, 44, -52, 56,
+    -49, 22, -49, 63, 0, -22, 22, -24, 37, -47, 53, -52,
+    77, -11, 57, -127, 52, -2, 63, -63, -30, 27, 38, -127,
+    -46, 28, 80, -101, -61, 5, 26, 2, -46, 1, -12, 19,
+    -17, -6, -10, 11, 13, -19, -5, 45, 0, -3, -30, 51,
+    17, 6, -12, 72, 20, -1, -20, 57, 36, 5, -23, 77,
+    -69, 18, -5, -50, -58, -24, 49, 69, -49, -52, 51, -1,
+    -49, -52, 8, -66, 77, -47, -43, -90, 115, -21, -22, -22,
+    94, -15, -8, 104, 41, 84, 2, 127, -45, 83, -19, 28,
+    -88, 29, -2, 31, 0, 48, 80, 98, -5, -26, 56, 123,
+    -64, -31, 118, 57, -89, -6, 23, 68, -36, -13, 54, -55,
+    3, -9, -19, -79, 48, 14, -69, -127, 14, 34, -99, -121,
+    44, 51, -54, -65, -24, -61, 30, 14, 16, -44, 88, -7,
+    -13, -14, 30, 15, -27, -21, -83, -60, 10, -35, -65, 20,
+    60, 0, -93, 27, 68, 5, -65, 36, 19, 4, 7, 39,
+    -27, -23, -8, 72, -72, 35, -5, 64, -82, 27, -19, 127,
+    -58, 75, -20, 23, -71, -14, 20, 5, -25, 24, -95, 108,
+    0, 27, -57, 127, -3, -32, -18, 81, 43, -44, 30, 65,
+    24, -53, 70, -9, 15, -11, 108, -45, 29, -57, 62, -112,
+    13, -5, 2, -44, 57, 87, -8, 49, 113, 34, -55, -13,
+    49, -17, -38, -11, 49, 1, 15, -28, 31, -50, 24, 21,
+    5, -63, 28, -35, -34, -7, 27, -20, -96, 16, -17, -7,
+    -127, 29, 16, 18, -76, 45, 64, 20, 37, -70, -61, -46,
+    8, -16, -3, -16, -27, 13, -26, 58, -78, 36, 12, 86,
+    -28, 25, 1, 127, -73, -4, 54, 53, -26, -4, 47, 25,
+    -4, 26, 50, 13, -51, 53, 61, -25, -59, 1, 18, 14,
+    -62, 1, -20, -71, -70, 26, -60, -64, -101, 15, 9, -69,
+    -44, -1, 35, -8, 127, -36, 75, -37, 96, -53, -22, 53,
+    42, 7, -70, 64, -20, 18, -23, 21, 20, 33, -17, 2,
+    31, 20, 64, -49, 46, -41, -54, -65, 88, -12, -127, -85,
+    13, -35, -44, -76, 12, -44, -78, -68, -4, -35, -10, 13,
+    12, -36, -40, 62, -37, 0, -2, 77, -16, 30, -33, 81,
+    -19, -4, 55, 37, -13, 44, 71, 32, 45, -34, 127, -73,
+    65, -31, 124, 20, 75, 97, 104, 47, 72, 81, 110, 2,
+    89, 107, 80, -2, 52, 16, 49, 19, -14, 15, 17, 40,
+    -26, -27, -22, 9, -101, -24, -17, 18, -117, -2, -85, -30,
+    32, 59, -59, 14, 3, 67, -62, 34, -38, 27, -43, 53,
+    -40, 64, 3, -3, 28, -6, -15, -61, 3, -13, 47, -61,
+    38, -53, 12, -59, 4, -60, 19, -26, -4, -69, 10, 30,
+    -32, -107, 51, 127, 11, -29, -91, -26, -44, -8, -16, 15,
+    -24, -13, -10, 74, -26, -16, 52, 127, -15, -15, 41, 97,
+    -7, 2, 31, 97, -49, 36, 65, 14, 9, 94, 49, -10,
+    -17, 75, 18, -115, -16, -1, -60, -125, -10, -39, -40, 70,
+    -95, 0, -2, 41, -35, 46, 71, 103, -84, 71, 127, -30,
+    -72, 48, 55, -50, 9, 20, 6, -62, 127, -20, -62, -47,
+    84, -33, -55, -64, 10, 13, -52, -24, 6, -29, 22, -29,
+    27, 114, 80, -1, -35, 56, 42, -68, 5, 77, 20, -121,
+    11, -52, 9, -127, 39, -8, -40, -75, -16, -24, -26, 18,
+    -26, -36, -12, 72, -8, -41, 2, 74, 12, 48, -37, 53,
+    -7, -5, 6, 7, 3, 8, -31, -92, 3, -4, -24, -11,
+    12, -12, 28, 17, -29, 1, 34, 93, -2, 3, 53, 91,
+    -41, -12, 60, 127, 3, 6, 29, 38, 28, 18, -15, -10,
+    -11, -4, -32, -29, -17, -8, -46, -112, -44, 15, -21, -8,
+    -14, -23, -13, 37, -5, -16, 6, 57, -4, -40, -32, -65,
+    -14, -16, -34, -127, -2, 6, -8, -81, 26, 51, 32, -10,
+    21, 25, 27, 47, 70, 6, 20, 33, 58, -9, -13, 41,
+    -35, 34, 63, 19, -10, -21, 35, 35, 10, -27, -34, 44,
+    28, -32, -80, 55, 43, 18, -127, 48, 53, 28, -79, -15,
+    -10, 31, 16, -40, -31, 10, 54, -70, -22, 18, 54, -43,
+    -21, -25, 57, -28, 23, 20, 44, 8, 17, 24, 40, 28,
+    28, 14, 32, 9, 12, 50, 49, 42, -5, 42, -13, 77,
+    -8, -58, 2, 66, -8, -127, -36, -2, -4, 0, -73, -105,
+    -33, -4, -69, -92, -36, 10, -24, -56, 62, -28, -38, -27,
+    -15, 1, 7, -13, 2, 95, -44, -33, 47, 112, -89, -7,
+    5, 18, -117, 47, 52, -80, 20, 94, -39, -90, 59, 72,
+    42, -127, 27, 31, -14, -45, 47, -37, -12, 52, 48, -36,
+    -10, 53, -9, 3, -12, 24, 63, 3, 6, -29, 60, 19,
+    -27, -72, 69, 33, 37, -56, -52, 98, -11, 2, -127, 117,
+    5, 76, -68, 42, 8, 63, -43, -78, 38, -2, -39, -106,
+    -29, -24, -21, -33, -1, 22, -25, 24, 2, -19, -13, 27,
+    -34, -25, 10, -15, 7, -10, 29, -101, 9, 17, 20, -127,
+    31, 11, 15, -38, 1, 35, -4, 20, -4, -3, -17, 80,
+    -23, 4, -16, 69, 9, -4, -10, 59, -72, -28, 35, 77,
+    -54, -11, -43, 29, -13, -5, -33, 5, 41, 0, -127, -27,
+    50, 6, -81, -26, 30, -3, -29, -1, 37, 34, 36, -27,
+    37, 15, 97, -24, 44, 50, 83, -17, 5, 9, 17, 42,
+    -6, 30, 33, 22, 72, 38, 12, 10, 32, -19, -19, -1,
+    -34, -57, -36, 29, -45, -52, -3, 49, -40, -36, 53, 10,
+    14, 12, 53, -84, 46, 31, 22, -47, 23, 40, -48, -20,
+    -28, 30, -127, 24, 28, 13, -52, -57, 20, -10, -71, -25,
+    -40, -37, -21, -28, -13, -14, 6, 12, -56, 9, 107, 43,
+    -23, 26, 127, -3, 2, 49, 59, -8, 9, 43, 18, 12,
+    45, 0, -23, 62, 22, -36, -60, 15, -127, 38, -31, -52,
+    -100, 9, 11, -12, -17, 21, -10, 49, -32, -36, 70, 59,
+    -53, -11, 47, 98, -8, 22, 31, 103, -38, -60, 99, 90,
+    24, -36, 63, 19, -13, -94, 31, 40, 65, 14, -5, -37,
+    15, 33, 24, 35, -26, 34, 81, -8, -8, -3, 35, -86,
+    68, -10, -2, -35, 53, -83, 18, -96, 2, -52, -23, -34,
+    3, 13, -43, 85, -21, 9, -10, 127, -70, 7, -29, 35,
+    -20, -9, 5, 82, 33, 3, 25, -26, 75, -17, -10, -86,
+    42, 2, -27, -113, -5, -12, -56, -43, -39, -3, -27, 21,
+    -57, 0, 19, 127, 9, 1, 64, 113, -17, 3, 40, 42,
+    -23, 7, 9, 5, 31, -4, -21, -49, -12, -52, 20, -22,
+    -2, -17, -8, -27, 1, -37, 90, -49, -3, -68, 127, 5,
+    61, -74, 81, 5, 11, -5, 24, -22, -44, 50, -55, 43,
+    -26, 63, -70, -8, -53, 124, -90, 46, -20, 51, -41, 31,
+    50, -26, -41, -97, 71, 32, 55, -99, 81, 76, 69, -4,
+    93, 84, 89, 78, -77, 53, -16, 127, -82, -68, -81, 19,
+    -54, -118, -112, 51, -17, -17, -49, -53, -36, 37, -1, -41,
+    2, -17, 34, 2, -12, -17, 69, -127, 5, 3, 60, -104,
+    13, -3, 68, -30, -17, -23, 36, 17, 6, 3, -21, 52,
+    -7, 33, -56, 73, 2, 45, -48, 69, 27, 31, -33, 52,
+    -2, -3, 18, 44, -22, -4, 0, 53, -115, 19, 62, 102,
+    -13, -62, -40, 65, -108, -103, -27, 127, -87, -74, -3, 56,
+    -36, -50, 77, 3, 4, -43, 84, -101, 46, 51, 111, -123,
+    94, 45, 21, -73, 118, 80, -50, -29, 115, 35, -49, -65,
+    -13, -16, 8, 23, -40, -21, -16, 73, -56, -10, -22, 82,
+    -45, -36, 22, 84, 4, -18, -19, 34, -10, 14, -44, -21,
+    60, 83, -46, -70, 47, 44, -52, -83, 51, 10, -63, -127,
+    15, 8, -58, -77, 79, -80, -26, 21, 80, -66, 11, 57,
+    68, -34, 7, -17, 34, -20, 40, 31, -69, 44, 13, 68,
+    -83, 29, -33, 38, -127, 23, -39, 17, -93, 27, -65, 69,
+    -94, 0, 33, 20, -43, 16, 20, 60, -20, 39, 19, -13,
+    18, 5, 36, -31, -14, 1, 13, 3, 28, 4, -51, 20,
+    47, -55, -76, 7, 45, -10, -127, 31, 34, 7, -49, 76,
+    2, 15, -13, 62, 12, 8, -56, 90, -19, 11, -18, 75,
+    5, 29, -42, -80, 17, -1, -6, -67, 19, 76, 75, -68,
+    48, 88, 54, 12, 3, 20, 121, 122, -29, -35, 78, 127,
+    -62, -69, 45, 96, -43, -89, 27, 37, -55, -44, 14, 24,
+    9, -21, -7, 38,
+};
+// functional_1/activation/Relu;functional_1/batch_normalization/FusedBatchNormV3;functional_1/conv2d/BiasAdd/ReadVariableOp/resource;functional_1/conv2d/BiasAdd;functional_1/conv2d_4/Conv2D;functional_1/conv2d/Conv2D
+alignas(16) const int32_t kTensor3Data[64] = {
+    -164, -419, 145, -892, -78, 42, 74, -326, -316, 20, 136, 105,
+    -21, -508, -158, -171, -375, 234, -449, 30, 55, 298, 81, 39,
+    315, -464, -100, -71, -382, 145, -50, -167, 69, -765, -89, 509,
+    -1, -318, 1435, -374, -374, 9, 414, 67, -7, 204, -509, -406,
+    -143, 80, 52, -171, 140, -866, -707, -225, 38, 173, -116, -452,
+    232, 264, -94, -339,
+};
+const int32_t kOp0Multiplier[64] = {
+    1359514674, 1510897544, 1926649374, 1084580191, 1833203381, 1598446167,
+    1627679308, 1382312008, 1075542397, 1103690228, 1943762883, 1106996425,
+    1152722049, 1245202516, 1402695826, 1573799777, 1613521674, 1298743846,
+    1621288420, 1098453574, 1836254561, 1961975843, 1733989666, 1923153043,
+    1657760567, 1486396369, 1935422644, 1649163646, 2062717049, 1103484170,
+    1211514054, 1955102371, 1415290081, 1113330866, 1577332471, 1377337383,
+    1312594413, 1821197710, 1295475795, 1674991602, 1563913152, 1204217771,
+    1095865610, 2064778105, 1211410907, 1243172833, 1358168642, 2147314432,
+    1520073423, 1591120175, 1505197082, 2051158788, 2068548467, 1677282482,
+    1584536658, 1837833626, 1684233315, 1285042891, 1639420454, 1724598460,
+    1253095821, 2006205585, 1857196660, 1683081220,
+};
+const int32_t kOp0Shift[64] = {
+    -6, -7, -8, -7, -8, -7, -6, -7, -7, -8, -7, -7,
+    -6, -7, -7, -8, -6, -8, -8, -7, -8, -7, -8, -6,
+    -8, -7, -8, -7, -7, -6, -7, -7, -7, -7, -7, -7,
+    -6, -8, -8, -8, -8, -7, -7, -6, -6, -6, -7, -8,
+    -7, -6, -7, -7, -7, -8, -7, -6, -8, -7, -7, -8,
+    -7, -8, -7, -8,
+};
+const cmsis_nn_conv_params kOp0Params =
+    {-83, -128, {2, 2}, {1, 4}, {1, 1}, {-128, 127}};
+const cmsis_nn_per_channel_quant_params kOp0Quant = {
+    const_cast<int32_t*>(kOp0Multiplier), const_cast<int32_t*>(kOp0Shift)};
+const cmsis_nn_dims kOp0InputDims = {1, 49, 10, 1};
+const cmsis_nn_dims kOp0FilterDims = {1, 10, 4, 1};
+const cmsis_nn_dims kOp0BiasDims = {1, 1, 1, 64};
+const cmsis_nn_dims kOp0OutputDims = {1, 25, 5, 64};
+
+// Operator 1: DEPTHWISE_CONV_2D
+// functional_1/batch_normalization_1/FusedBatchNormV3;functional_1/depthwise_conv2d/depthwise;functional_1/depthwise_conv2d/BiasAdd;functional_1/conv2d_4/Conv2D;functional_1/depthwise_conv2d/BiasAdd/ReadVariableOp/resource
+alignas(16) const int8_t kTensor5Data[576] = {
+    42, 1, -63, -42, 35, -45, -9, -63, 127, -127, -30, -51,
+    -71, 45, -33, 4, -46, 22, 54, -45, 65, -11, 45, -53,
+    -62, 84, 42, -65, -37, -35, -12, 69, -23, -9, -26, -4,
+    -90, -9, -5, -10, -44, 32, 127, 22, -65, -3, -57, -68,
+    -47, 18, 34, 4, -78, 63, 56, 119, 48, 72, -13, -55,
+    -32, -127, -73, -35, -2, -96, 32, 127, -35, 27, -55, -88,
+    -53, 112, -28, 54, 45, -22, 26, -80, 20, 18, -25, -37,
+    22, 8, -13, -33, 25, -25, 47, 4, 92, 10, 59, -127,
+    10, 127, 27, -11, -19, -10, -20, -70, 43, -106, -15, 7,
+    -5, -64, -78, -42, 1, -127, -63, 17, -79, -100, 67, 10,
+    -6, -126, -7, -13, 32, 3, -35, -34, 30, -127, -76, 2,
+    127, 10, 127, -13, -88, 78, 124, -70, -39, -73, -41, 6,
+    77, -115, 125, 30, -8, -21, 19, 15, -24, -48, -76, 96,
+    57, 28, 120, -48, -60, 85, -9, -120, -31, -100, -69, 22,
+    5, 68, -40, -87, 3, 80, 18, -91, -102, -48, -117, -83,
+    37, -127, -70, -127, 127, -83, 3, -7, -74, 61, -27, 127,
+    -68, -58, -47, 3, -55, 127, -73, -118, -71, -118, -65, 60,
+    -127, 49, 32, -40, 74, 51, 37, 127, 13, -52, -15, 127,
+    -29, 117, 19, 75, -72, -50, -66, 52, -32, -7, -127, -22,
+    -118, 42, 5, -23, -42, 25, -50, 35, 127, -27, -127, -106,
+    37, 22, -5, -12, -68, 5, 127, -116, 38, 80, 127, -26,
+    81, -100, -47, -31, -34, -85, 22, -80, -28, -19, -26, -67,
+    -45, 91, 127, -65, 106, -14, -81, 121, -64, -25, -77, -80,
+    -22, 35, -42, -40, 29, -70, -85, 46, -44, -16, 21, -117,
+    23, -23, 46, -14, -18, -81, -2, -36, 75, -59, -42, -35,
+    -64, 127, -78, -55, 4, 118, -44, -45, -18, -3, 116, -38,
+    -10, 75, -34, -2, -5, -52, -37, 77, 15, -40, -114, 54,
+    122, -33, -42, 53, 43, 0, -51, 0, -37, -127, -31, -76,
+    34, -127, 127, 126, -87, -88, -38, -34, -127, 1, -81, 67,
+    -40, 21, 127, -51, -67, -5, -1, -127, 18, 15, -127, 30,
+    7, 127, 31, -127, -23, -108, 50, 8, 127, -109, -122, 127,
+    127, -17, -26, 80, 12, -127, 80, -98, -127, 39, 127, 80,
+    59, -102, -53, -8, -33, -16, -52, -127, -41, -3, -7, 25,
+    61, -13, 127, -99, 74, -34, 2, -24, 29, -54, -3, -26,
+    0, -44, -11, 1, 7, 127, -50, -29, 127, 0, -62, 68,
+    127, 122, 1, -27, 5, -15, -7, 7, 5, -27, -58, -79,
+    1, -20, 20, 2, 1, 30, -101, -101, 16, -99, -60, 4,
+    -4, 45, -3, 14, -127, -19, 30, 52, -31, 36, -8, 37,
+    98, 77, -40, -68, -75, -11, -65, 127, 119, -30, -68, -17,
+    -25, 46, 127, 52, -43, -26, -127, -51, 62, -21, -68, -66,
+    28, -18, 99, -8, -21, -127, 12, 1, -8, 78, -2, -27,
+    12, 17, 3, -48, 40, 40, 127, 11, 7, -14, -110, 35,
+    -49, 5, 3, -11, -20, -74, -18, -13, -56, 97, -127, 124,
+    -9, -40, -18, -11, 53, -60, -107, 127, 45, -13, 61, 34,
+    -127, -103, 36, -39, -127, -127, -32, -7, -72, -127, -56, -127,
+    127, 24, -67, -4, -14, -19, 9, -66, 33, -11, -103, 127,
+    -127, -85, 17, 26, -105, -121, -43, 127, 46, 32, -65, 41,
+    -61, 20, -41, 105, -95, 70, -45, -127, -106, 85, -49, -72,
+};
+// functional_1/activation_1/Relu;functional_1/batch_normalization_1/FusedBatchNormV3;functional_1/depthwise_conv2d/depthwise;functional_1/depthwise_conv2d/BiasAdd;functional_1/conv2d_4/Conv2D;functional_1/depthwise_conv2d/BiasAdd/ReadVariableOp/resource
+alignas(16) const int32_t kTensor4Data[64] = {
+    469, 1727, 643, -38, 357, -174, 282, 1510, -12, 7, 93, 48,
+    63, 181, 245, 143, -148, 443, 7, 32, 198, 876, -126, -439,
+    448, 346, 723, -19, 20, 15, 92, 911, -235, -251, 161, 623,
+    283, 892, 870, 580, -8, -80, -149, 360, 47, 265, 1284, 1494,
+    -155, 162, 302, 2, 363, 170, -70, 68, 174, 346, 8, 695,
+    528, 791, 390, -10,
+};
+const int32_t kOp1Multiplier[64] = {
+    1117272080, 1351620567, 1208841889, 1680313023, 1480831180, 1867036575,
+    1274068427, 1551573551, 1294969724, 1383317958, 1236810790, 1458694841,
+    1431041453, 1527668729, 1972269723, 1085649278, 1145655177, 1883008410,
+    1699922209, 1787116075, 2034358525, 1870523896, 1303360346, 1162227620,
+    1943854503, 1401822542, 1203348201, 1837357352, 1599269182, 1757899597,
+    1081471549, 1540510979, 1264653146, 1386686886, 1200409896, 1368802621,
+    1087238284, 1193358838, 1651991982, 1445986925, 1245546981, 1617319173,
+    2142376177, 1394652726, 2095469635, 1151724771, 2022842212, 1433810868,
+    1078765408, 1334169966, 1343470626, 1463716779, 1467283313, 1962296422,
+    1729111065, 1720207323, 1596415686, 1989330707, 1124519040, 1702538309,
+    1312306067, 1708501555, 1537057119, 1801960675,
+};
+const int32_t kOp1Shift[64] = {
+    -6, -7, -6, -6, -6, -6, -6, -7, -6, -7, -6, -6,
+    -6, -6, -7, -6, -6, -6, -6, -6, -6, -7, -5, -6,
+    -6, -7, -6, -6, -6, -6, -6, -7, -6, -6, -6, -6,
+    -6, -7, -6, -6, -5, -6, -6, -6, -7, -6, -7, -7,
+    -5, -6, -6, -5, -6, -7, -7, -7, -6, -7, -5, -6,
+    -6, -7, -6, -6,
+};
+const cmsis_nn_dw_conv_params kOp1Params =
+    {128, -128, 1, {1, 1}, {1, 1}, {1, 1}, {-128, 127}};
+const cmsis_nn_per_channel_quant_params kOp1Quant = {
+    const_cast<int32_t*>(kOp1Multiplier), const_cast<int32_t*>(kOp1Shift)};
+const cmsis_nn_dims kOp1InputDims = {1, 25, 5, 64};
+const cmsis_nn_dims kOp1FilterDims = {1, 3, 3, 64};
+const cmsis_nn_dims kOp1BiasDims = {1, 1, 1, 64};
+const cmsis_nn_dims kOp1OutputDims = {1, 25, 5, 64};
+
+// Operator 2: CONV_2D
+// functional_1/conv2d_1/Conv2D
+alignas(16) const int8_t kTensor18Data[4096] = {
+    53, -79, 3, 2, -34, 78, -30, 0, -65, -18, -1, 9,
+    -10, 90, 23, -11, -52, -43, 83, -14, 25, 9, -60, -102,
+    24, 49, -11, -46, 28, -50, -96, 18, 39, 13, -66, 83,
+    56, 110, -2, 37, -36, 25, -32, 14, -40, -5, -55, -38,
+    -60, -53, -97, 66, 74, -8, 40, 22, -127, 8, -100, 51,
+    -95, -26, -22, -43, -14, -6, -3, 44, 5, -39, -85, -34,
+    36, -52, -17, 67, -10, -16, -35, 92, 1, 30, -59, 4,
+    -90, 71, 28, 22, 63, -72, 51, -61, 72, 11, 18, 7,
+    34, -30, 78, 67, 18, 69, 13, 127, 34, -37, 77, -2,
+    67, -42, 34, 113, -27, -52, 9, -77, -43, -46, 36, -22,
+    55, 35, 28, -22, 95, -99, 61, 9, 38, 45, 38, -120,
+    13, -40, 29, -93, -62, 29, 53, -36, 67, -39, 41, -87,
+    76, -5, -39, 62, 92, -57, -4, -41, -7, -64, -100, 10,
+    29, -22, 69, 10, -42, -81, 26, 85, 33, -127, 28, -34,
+    -38, -67, -33, 6, 26, 4, 41, -1, -22, 90, 9, 88,
+    -66, -92, 8, 0, -1, -52, 12, -8, 58, 1, 6, 76,
+    -10, -2, 60, 20, 34, -14, 3, 126, 25, 43, 34, -21,
+    -22, -82, -47, -81, -47, -61, -73, -61, 127, -75, 7, -108,
+    -30, 50, -101, -12, 44, -51, 95, 93, -24, -118, 12, -24,
+    67, -66, -76, 4, 10, 56, 3, 7, 19, 5, 50, 97,
+    -9, -75, -30, -44, -27, 67, -33, -8, -117, -107, -87, -38,
+    15, 27, 125, 46, 127, -14, 49, -70, 25, 81, -35, -98,
+    -67, 81, 10, -11, 14, -16, 27, -18, 36, -77, -77, 45,
+    -60, -22, -57, 20, -44, 65, -2, 32, -23, 14, -15, 32,
+    -20, 106, -98, 31, 36, 10, -31, -41, -2, -111, 6, -43,
+    -17, -53, 59, -40, -5, -8, 38, -83, -30, 21, -81, -66,
+    -14, 4, -39, 45, -38, -46, -72, 33, -29, 55, 20, 72,
+    -106, -15, 16, 43, -106, -44, -99, 1, -8, -13, -46, 22,
+    -84, -51, -43, -51, 34, -57, -13, -82, -35, 8, -43, -64,
+    -75, -44, -91, 62, 75, -89, -75, -21, 31, 121, -23, 22,
+    -11, -37, -61, -2, 73, -105, 47, 96, -4, -37, 127, -108,
+    -10, 33, -17, -69, -1, -105, -12, -56, 76, 19, -120, 48,
+    22, -14, 77, -12, 28, 30, 0, -81, 76, 94, 20, -37,
+    89, -3, 91, -10, 80, -33, -5, 75, -3, 5, -22, 98,
+    28, 36, 30, 42, 13, 105, 11, 66, 91, 32, 18, 1,
+    -29, 75, 15, -31, 95, -73, -102, 20, 47, 94, 18, -15,
+    64, 22, 15, -14, 18, 25, 54, 29, -18, -74, -34, -3,
+    127, -71, -44, 7, 19, -81, 3, -86, 14, 30, -1, -80,
+    5, -89, 16, 23, 82, -31, 1, -30, -13, -116, -30, -21,
+    -53, 25, 46, -22, -36, 43, -74, 127, -12, 26, -24, -2,
+    19, -70, 21, 47, 54, 67, -61, -56, -10, -64, -48, 46,
+    -45, 65, -14, -49, -21, -23, -30, 11, 31, 79, -25, 15,
+    -49, -15, -45, -19, -27, -1, 14, 0, -85, 79, 8, -4,
+    48, 71, 6, 55, -42, 1, 6, -121, 64, 56, -40, -1,
+    -44, -78, -62, -3, -58, -127, 55, 0, 25, -95, 1, 15,
+    73, -21, -43, -33, 33, -41, 57, -10, 19, 1, 82, 116,
+    21, -19, -90, -1, -12, 15, 94, 21, 69, 1, 88, 46,
+    12, -12, -74, -17, 33, -51, 23, -48, -8, -26, 4, 18,
+    12, 17, -66, 15, 27, -38, -40, 76, 11, 45, -32, 0,
+    -38, -39, -27, 14, 12, 12, 49, -28, 33, 14, 17, 57,
+    -79, -27, 22, -21, -35, 78, 4, -51, -16, 3, 20, -58,
+    55, -33, 31, -66, -45, -27, 76, -9, -69, 7, -127, 5,
+    9, 32, 2, -5, 48, 12, -40, 3, -104, 35, -6, 64,
+    -16, 31, 54, -33, -49, -81, 78, -114, -5, 18, -8, 14,
+    -6, -39, 46, -11, -4, 15, -64, 51, -84, -43, 21, -10,
+    -17, -24, 68, -50, -31, -72, -56, -26, 50, 66, 11, -127,
+    -6, 34, -4, -9, -70, -20, 21, 40, 47, 31, 44, -12,
+    18, 2, 56, -36, 56, 63, 44, 24, -82, 48, -40, -11,
+    0, -78, 37, -24, -31, -24, 69, -37, 62, -20, -116, 30,
+    94, -3, 51, 127, 19, 58, 8, 11, -14, -61, -5, -38,
+    -47, -20, 90, 58, -53, 61, 10, -1, -55, -20, 24, 38,
+    -9, 53, -32, 71, -11, -67, -110, 53, 7, -11, -72, -74,
+    -42, -69, -28, -60, -73, 50, -11, -18, -75, -45, -3, 34,
+    104, -69, 29, 7, -59, -32, -74, 28, -126, 56, -63, 83,
+    -16, -36, -69, 13, 25, -50, 61, 6, -6, -33, 3, 37,
+    -9, -51, -64, -2, 20, -12, -8, 62, -13, -60, -13, 72,
+    -35, -48, -22, 50, -7, 32, -56, 84, -4, 22, 47, 8,
+    89, -127, 50, -104, -25, -21, -13, 33, -12, 43, -93, 31,
+    58, 3, 25, -48, -29, -17, -18, 42, -36, -49, 12, -114,
+    14, -41, -22, 14, -46, -67, 27, 59, -1, 15, 37, -32,
+    -21, -5, 63, 15, 59, -63, -43, 21, -127, -30, 24, 25,
+    25, 44, 16, -73, 18, -19, 53, -36, -18, 15, 39, 41,
+    15, -97, -30, -36, -11, -48, -59, 30, 30, 39, 67, 13,
+    -60, 0, 84, 29, 8, -33, -6, 57, 60, 0, 12, 68,
+    20, -30, -40, 31, 0, -29, -46, -67, -16, -2, -29, -7,
+    30, -37, -11, 40, -20, -41, -44, 9, 21, -127, -81, -32,
+    -18, -7, 10, -2, 2, 0, 27, -24, 53, -23, -17, 20,
+    -75, -26, 15, 13, -36, -18, 40, -49, -11, -58, 31, -64,
+    -12, -4, -34, -2, -4, -23, -43, 7, 22, 35, 33, 45,
+    -52, -3, -39, 15, -9, -79, -11, -61, 20, 1, -14, 20,
+    -112, 10, 17, -109, 17, 63, 11, -28, 45, -115, 48, -35,
+    -44, -55, 0, 7, -46, 75, 38, -38, 126, 1, -66, -5,
+    -44, 35, -12, 70, -3, -33, -78, -52, -41, -11, 23, 38,
+    64, -84, 41, 14, 30, 46, 127, -15, 35, 70, 28, -19,
+    -102, 26, -76, -64, 15, 64, -10, -23, -60, 56, -11, -1,
+    33, -16, -88, -40, -94, -23, -42, 7, -77, -40, -40, -55,
+    -3, 58, 68, 28, -14, -53, -62, -37, -48, 5, 39, 45,
+    28, 29, -11, -26, 26, -80, 19, -17, 97, 28, -30, 55,
+    -95, -36, 99, 28, 29, 7, 27, 49, -10, 74, 29, -39,
+    35, 20, 34, 68, 26, 31, -33, -20, 4, 71, -127, -47,
+    73, -50, -31, -77, 17, -49, -14, 17, -38, -114, -24, -59,
+    6, 24, 52, 96, 33, -61, 48, -2, -80, -41, -60, -25,
+    -100, 70, 57, -78, 20, 93, -4, -81, -98, 18, 48, -21,
+    -38, 24, -23, -36, 20, -38, 25, -9, -5, -86, 62, 38,
+    -56, -44, 86, 25, 26, 127, -4, 66, 10, -13, 48, -55,
+    31, 54, -58, 15, -92, 10, -17, -17, 71, 9, -44, 8,
+    0, -52, -59, -62, -95, -6, 12, -71, 59, 36, -34, -13,
+    -30, 23, 50, 8, -37, -52, 6, 74, -59, 90, -23, 22,
+    -23, 15, -10, -62, -37, -58, -127, 47, -3, 28, 62, -39,
+    4, -5, -39, -62, -57, -6, -44, -29, -8, -28, -76, -1,
+    -10, -21, -25, 13, 11, 11, 34, -54, 0, -72, -31, -37,
+    -23, 7, 21, -25, 17, -19, 61, -22, -13, -48, 38, -73,
+    93, -68, -30, 6, -29, -36, 17, 57, 21, 48, 26, -77,
+    12, 0, -1, 71, 0, 37, 75, 24, 15, 27, 112, -19,
+    86, -127, 27, -60, 57, 55, -87, -15, 46, -9, -46, -47,
+    -51, -11, -82, -1, 11, -12, 7, 19, -17, -11, 52, -71,
+    -89, 63, -60, 79, -18, -67, 38, 3, 25, -69, -101, -109,
+    0, -70, 35, -113, -48, -35, 30, 66, 27, -30, -33, -98,
+    81, -15, 48, 77, -10, 62, -7, 78, -11, -52, 29, -24,
+    -58, 58, -127, 76, 5, 12, 35, -3, -18, -38, -75, 49,
+    -38, 44, -1, 2, 58, 10, -102, 30, 8, -7, 39, -100,
+    69, 27, -48, -11, 85, 34, 76, -100, 49, -58, -77, 20,
+    -26, 29, -38, 57, -5, -40, 40, -2, -73, -8, -29, 32,
+    15, -68, -46, -62, -7, 56, -90, 8, -33, 2, -82, -45,
+    113, -88, 15, -14, -33, -127, 1, -21, 12, 4, -24, 5,
+    -42, -50, 40, -32, -121, -55, 35, -10, -43, -71, -59, -8,
+    -45, 1, -74, -8, 16, 61, 30, 106, 25, 29, 4, -74,
+    -10, 103, -9, -100, -33, -70, -4, 41, 26, -19, 27, 1,
+    -6, -1, 0, -24, 26, -6, 49, -127, -8, 0, -7, -10,
+    17, -67, -46, -32, 49, -18, 20, -8, 37, 42, 22, 28,
+    0, 13, 0, 27, 43, 3, 17, -34, -25, -14, 45, 22,
+    -38, -19, -37, -24, 12, -10, -93, -15, 16, -39, 10, -29,
+    -71, 1, -24, -12, -59, -62, 25, 50, -21, 8, 40, 8,
+    49, -70, -42, 83, 49, -40, -34, 50, 28, 20, -105, 47,
+    52, 77, 29, 18, -11, -27, -39, -38, -1, 38, 65, 29,
+    100, -5, 17, 30, -15, -15, 57, -44, 8, 118, -72, -24,
+    86, -24, -15, -84, 95, -15, -31, -3, 44, -45, 34, 127,
+    -21, 54, 7, 38, 3, -27, 4, 0, -125, 53, 68, 38,
+    -47, 2, -3, 4, -25, 29, -49, -33, -60, 16, 36, -37,
+    -49, -119, -59, -13, -98, -18, 35, 46, 43, -48, -28, -16,
+    12, 55, 43, -35, 62, 48, -5, 24, -127, 29, -10, -23,
+    -14, -60, 40, -4, 13, 77, -13, 30, -103, -30, 27, 45,
+    -58, -26, -13, -106, -6, 66, -7, 15, 35, -11, 45, -41,
+    13, -69, -3, -74, 46, -7, -24, -49, -13, 31, -37, -88,
+    10, -53, -14, -26, 17, -8, 69, 9, 47, 1, -23, -127,
+    20, 36, 18, 60, 24, 18, -24, 70, -31, -30, -9, -31,
+    -49, -43, 32, -37, -24, -16, 37, 27, -29, -15, 32, 80,
+    -4, -46, -24, -93, -16, 70, 32, 39, -18, 51, -16, 72,
+    -104, 62, -46, -51, -29, 51, 19, -34, 58, 4, 41, -110,
+    -29, 5, 43, 3, -17, -5, -34, -44, 38, -36, 87, 0,
+    -8, -41, -110, 29, -127, 67, -21, 33, -57, 47, -51, 19,
+    64, -5, -17, -28, -74, -57, -61, 80, 36, -26, -20, 48,
+    -53, -113, 0, 33, -25, -7, 6, 62, 6, -32, -12, -19,
+    -4, 9, -26, -34, -43, -77, -96, -9, -68, 32, 68, -54,
+    14, 1, 93, -12, 90, 44, -93, 107, 79, 27, -66, 57,
+    45, -43, 18, 85, 64, 64, 66, -75, -15, -24, -16, -12,
+    51, -84, 53, 33, -13, 41, 92, -23, 24, 27, 96, -56,
+    -20, 37, 61, -13, 95, 91, 7, -12, -69, -17, -32, -127,
+    -52, -45, 15, -4, 42, -22, 32, 52, -105, 66, -41, 17,
+    -8, -31, 10, -32, 74, -50, -40, -51, 56, -20, 58, 28,
+    -127, 9, -85, -8, 60, -31, -76, -99, 69, 0, 75, 52,
+    10, -17, -20, 58, -94, -84, -2, -29, 42, 33, -43, 3,
+    -35, 69, -74, -15, 75, -48, 0, -25, -47, 30, -4, -39,
+    54, 49, 80, 102, 1, -71, 76, 54, -27, -70, -85, 22,
+    60, 52, -13, 4, -12, -51, -28, 73, 23, 39, 5, 59,
+    85, 5, -62, -78, 29, -41, -11, 33, -44, -50, 31, 41,
+    -60, 45, -90, 52, -28, 30, -59, -16, 110, -52, -50, -27,
+    -25, -21, -24, -22, -17, 7, 12, 47, -71, -127, -51, 63,
+    56, 5, 18, 78, -23, -26, 3, 126, 50, -51, 16, -27,
+    9, -30, -57, 75, 93, 49, 93, -14, 52, -59, 12, -48,
+    -17, -27, -51, -16, 50, 38, -112, -68, 9, 53, -65, 127,
+    -13, -74, 10, 82, -54, 24, -4, -30, -22, 97, -41, -1,
+    3, 63, -4, 27, 3, -8, 74, 22, 49, 68, 24, -18,
+    -12, 71, -42, -65, -6, -26, -29, -48, 54, -46, -64, -40,
+    -7, -71, -49, -71, -12, -14, -26, 3, 46, 50, 25, 17,
+    14, -26, 28, 63, 16, -5, -27, 5, 127, -2, -39, -70,
+    8, -43, -12, 49, -29, 95, -53, -46, 16, 64, -10, -43,
+    -1, 42, 30, -20, 24, -38, 71, 39, -8, -36, -71, 62,
+    19, 16, 0, -14, -21, 33, 50, -19, 24, -47, 93, 40,
+    -6, -6, -57, -119, -16, -69, 13, -2, -33, 25, 78, 12,
+    76, 7, 48, 20, -31, 3, -14, -31, 2, 12, 40, -65,
+    -28, -2, -22, 39, -70, 10, -49, 10, -5, 11, -42, 30,
+    -89, 29, -41, -110, -42, -54, -22, -64, -5, -79, 33, -15,
+    -18, -76, 11, -73, -4, 42, -26, -35, -5, 49, 3, 46,
+    27, 0, 34, -6, 18, -71, 52, -19, -47, 49, -43, 17,
+    -8, -65, 24, 10, -127, 29, -24, 27, -6, 44, 44, -24,
+    32, 26, 46, -31, 63, 96, 52, -44, -18, 93, 66, -44,
+    29, -109, -23, 50, -125, 49, 67, 41, 36, 38, 31, -35,
+    -9, -34, -42, 9, 20, 37, -67, -8, -25, -25, -60, -9,
+    -60, -63, 119, 10, -107, -39, 100, 46, 22, 23, 34, -127,
+    77, 30, 103, 8, -69, -30, -90, 43, 77, 51, 86, -100,
+    49, -39, -106, 7, -10, 10, -54, -11, 127, 22, 4, 64,
+    28, -50, -55, 4, 17, -31, -51, -11, -73, 34, 28, -25,
+    37, -48, 50, -23, -55, 28, -5, 15, -10, 42, 62, 43,
+    -68, -27, 37, -33, -96, -65, 0, -45, 0, -48, -18, -11,
+    -95, -50, 22, 38, 15, 74, -43, 35, -69, 65, 69, -4,
+    -19, -24, 2, -22, -36, 30, 25, 27, -30, -64, 7, -6,
+    -7, -62, -50, -84, -127, -2, -54, -115, 6, 33, -65, -54,
+    -22, -14, -45, -4, 65, -46, -10, 0, 4, 57, -66, -119,
+    -35, 30, -69, -31, 32, -32, 32, 51, 51, -29, -17, 85,
+    -19, 0, -43, 12, 13, 0, 34, 119, 18, 8, -72, 40,
+    -11, -54, -81, 36, 9, 41, -20, 42, -27, -52, 31, -27,
+    25, 21, -11, 51, -32, 11, -13, -9, -63, -37, 0, -16,
+    -53, 95, 17, -63, 79, -32, -59, -55, -99, -85, -74, 59,
+    -26, 10, 34, 11, -4, -26, -5, -23, 31, -16, -44, 3,
+    45, 73, -60, -59, -61, 52, -80, -80, -29, -68, 31, -43,
+    -37, -42, -52, 13, 115, -35, 77, -45, 1, 21, -36, 10,
+    -127, -57, 4, -43, 41, 3, 17, 36, -22, 24, -81, -9,
+    70, 25, 20, 30, 70, -14, -13, -27, -8, 8, -7, 82,
+    21, 1, -44, -7, -43, -71, 86, -10, 5, -19, 15, 93,
+    56, 26, 61, -70, 53, 15, -57, -51, 40, 82, 38, -48,
+    44, -22, 10, -31, -31, -35, -43, -27, 23, -101, -24, -57,
+    -38, 0, 64, -42, 15, -34, -127, 2, 90, -22, 47, -19,
+    90, 24, -3, -27, 23, 49, 9, 41, 74, -50, 48, -6,
+    -17, -83, -4, 30, -77, 63, -91, 37, 66, -11, -35, -8,
+    -19, -127, -62, -3, -43, -68, -52, -51, 57, 0, 49, 26,
+    22, -7, -25, -29, 6, 7, -85, -74, 8, -28, 13, 1,
+    -39, 8, -29, -19, 2, -33, -34, 58, -11, 39, -10, 3,
+    48, 42, 44, 31, -5, -20, 8, 21, 26, 42, 68, -52,
+    24, 103, 39, -18, 18, -30, 57, -60, 68, 7, 87, -17,
+    -5, 87, -66, -32, 73, -26, 28, -10, 2, 32, 99, 127,
+    9, 29, -38, -7, 53, 71, 51, 38, -38, 125, -43, 31,
+    -39, -21, 32, -66, -43, 109, 58, -21, 0, 9, -41, 53,
+    -38, -3, -67, -97, -57, 64, -19, -29, 7, -33, -52, 0,
+    5, -5, 27, -6, -79, 16, -15, 37, 29, 57, -37, 27,
+    16, 76, -112, 16, 2, 8, 37, -38, -88, -24, 25, -2,
+    -35, 57, 27, 17, -41, -29, -30, 68, 40, -14, -3, 26,
+    -12, -18, -109, -15, -23, -49, -127, -15, 20, 42, -30, 86,
+    12, 55, -25, 80, -10, -95, 10, -19, -62, -2, 42, -7,
+    8, 17, -45, 32, -38, -82, 4, 25, 26, 10, 14, -47,
+    27, 2, -43, 25, 12, -82, -8, -20, 102, 16, -67, 95,
+    -66, -65, -62, 68, -31, -27, 76, -2, 29, -73, -11, 45,
+    -31, -79, -24, 127, -45, 18, -7, 31, -24, 2, -7, 111,
+    -25, 59, 45, 69, 16, 16, 47, 94, 0, -56, 67, -28,
+    15, -28, 4, 127, -55, 37, 30, -48, 15, 71, -34, -37,
+    -3, -68, 112, -64, -48, -72, 3, 108, 14, -19, -85, 24,
+    10, 5, -82, 61, 6, 4, -12, 63, -29, 72, -104, 8,
+    3, -56, -12, -38, -111, -31, -14, 85, -33, -93, -19, 65,
+    34, -73, -85, 97, 77, 1, -55, 69, -31, 45, -112, -50,
+    -55, -69, 7, -50, -27, 58, 12, 20, -31, 5, 3, -69,
+    51, -15, 20, 48, -2, -57, 25, -38, -33, 1, 69, 20,
+    -24, -48, 22, 18, -58, -82, -20, 39, 44, 30, 35, 13,
+    -22, 1, -24, 82, -15, -20, 3, -16, 9, 104, 69, 21,
+    14, 45, 37, -78, 20, 30, 12, 59, 40, 1, -6, -13,
+    21, -4, 71, -127, -26, -49, -20, 31, -32, -57, -37, -8,
+    -7, -32, -30, -70, 83, 58, 71, 32, -63, -14, 17, -117,
+    -28, -41, -92, -33, 20, 3, -85, 127, 28, -39, 24, -31,
+    3, -17, 48, 30, -95, -7, 7, 38, -39, -20, -65, 42,
+    -88, -7, -22, 45, 7, 38, -63, 20, 56, -47, -1, -84,
+    -45, -42, 7, 34, 70, 110, -5, 111, 21, 48, -1, -27,
+    -56, 16, -36, 37, -102, -17, 44, -15, 28, -12, -69, -10,
+    39, -114, -19, 13, -127, -28, 38, 79, -12, -28, 47, 14,
+    -90, -19, 71, -92, 52, -45, -33, 41, 27, -20, -15, -50,
+    -78, 6, -94, 94, 34, -40, 7, -30, 70, 18, -68, 44,
+    -43, -97, 77, -34, 90, -33, -5, 102, 25, -21, -26, 21,
+    123, -10, 70, -44, 35, 104, 71, -28, -5, 5, 25, -70,
+    -118, 13, -40, 22, -77, -126, -82, 73, -75, 57, 39, -5,
+    33, -24, 97, -91, -70, -48, -24, -48, -64, 30, -7, 21,
+    -79, -22, -56, -51, -26, -51, -46, -57, 59, 70, -19, -22,
+    -14, -10, -18, 62, 60, 47, 68, 55, -27, -42, -127, 21,
+    30, -54, 60, 4, 15, 15, 49, -4, 25, -48, 85, -23,
+    -22, -41, 43, -127, 86, 38, 65, -65, -11, -39, 2, 19,
+    -20, -19, 32, -35, 0, 4, 47, 1, -3, 18, 45, 31,
+    22, 1, 44, -47, -30, -103, -62, -58, 49, -68, 95, 87,
+    75, 68, 51, -22, 23, 64, 89, 43, -37, 38, 39, 19,
+    -5, 47, -7, -9, -71, 40, -49, -28, 27, -62, 25, 23,
+    56, -59, -47, 75, -101, -9, -17, 43, -28, 51, 59, 33,
+    -22, -86, -35, 55, -31, -31, 109, -6, 19, 120, -29, 14,
+    38, -26, -16, -62, -84, 45, 32, -53, -82, 70, -26, -46,
+    127, -88, -107, -17, 33, 43, 38, -112, 59, 71, -42, -61,
+    -17, -101, 77, -43, -35, -98, 20, 91, -56, -105, -23, 75,
+    38, 13, 68, 101, 55, 28, 1, -4, 34, 18, -96, 31,
+    34, -124, -25, -4, -101, -42, -64, 8, 9, 48, 0, 4,
+    53, -103, 88, 39, -18, -98, 79, 35, -40, 102, 63, 37,
+    46, -67, 21, 43, -39, -47, 87, -73, -30, 34, 43, -21,
+    66, -91, -71, -127, 88, 72, -1, 4, -43, -36, -50, -59,
+    -23, 10, 85, 52, -84, -46, 29, -7, -7, -24, 53, -37,
+    -77, 29, -28, -23, -45, 27, 17, 41, -50, 14, 53, 3,
+    0, -113, -74, 12, 3, 43, 28, -72, -25, -21, -30, -31,
+    8, 9, 56, -66, -22, -45, 3, 7, -1, 39, -41, -33,
+    42, 89, 45, -127, -18, -59, 69, 7, 16, 35, -34, -33,
+    -34, -84, -75, -35, -61, 49, 19, 82, -21, 55, 51, -45,
+    -54, 12, -108, -96, -40, 0, 7, -67, -43, 18, -46, -10,
+    80, -4, 5, 40, 42, -103, -82, 48, -30, 10, -11, 127,
+    5, 48, -4, -43, 95, -1, 14, -114, -13, -13, -95, 92,
+    -43, -75, 40, -32, -62, -25, -98, 58, -36, 44, 60, 14,
+    -43, -19, 20, -76, 8, -118, -112, 56, 1, -18, -72, -12,
+    -19, -87, -18, -72, 99, 64, -34, -22, -95, -48, -97, 3,
+    77, 28, 18, -32, 72, -52, -19, -89, -28, -42, -99, 18,
+    -125, -32, 15, -14, 46, -34, 11, -70, -32, -74, 91, -75,
+    -30, -16, 52, -24, -43, -70, -98, 11, 97, 30, 64, 98,
+    -47, -36, 40, 58, -37, -5, -27, -14, 2, 61, -13, 127,
+    -42, 70, 24, 46, 19, -25, -12, 24, 18, 34, 2, -2,
+    -28, 43, -5, 16, -127, 44, -24, -22, -12, 36, 46, 29,
+    -26, 5, 42, -6, -12, 41, 35, -46, 64, 69, -6, -63,
+    -16, -6, -13, 20, 61, 56, -22, 18, 1, 54, -1, 21,
+    3, -18, -22, 32, -46, -80, -1, 29, -77, -21, -43, -46,
+    -4, -10, 23, 40, -9, -31, -18, 33, 23, -10, 68, -7,
+    31, 118, -66, -22, 20, 71, 32, -118, 77, -66, -4, -18,
+    108, -43, 46, -78, -46, 26, -9, 127, -39, -10, 42, 7,
+    -45, 33, 47, 35, 104, -42, -58, -25, 14, -43, 14, 55,
+    -71, -46, 52, 68, -112, -14, -46, -39, -57, 0, -25, 20,
+    -18, 66, 14, 61, -15, -65, -22, -16, 73, -82, 93, -117,
+    11, -107, 13, 34, 23, 6, -125, 116, 48, 100, -3, -33,
+    -90, -56, -50, 63, 17, -25, 2, 0, -44, 40, 24, -40,
+    8, -127, 73, 63, 10, -49, 22, 32, -21, 17, -46, -84,
+    15, -51, 12, 58, 23, -4, 64, 64, -109, -4, 9, 17,
+    22, -13, 34, -75, -36, 7, 89, 25, 60, -95, 25, 38,
+    40, -35, 50, -113, 9, -20, -11, 121, -119, 57, 57, 6,
+    -127, -58, -94, 36, 20, -9, 45, -21, 16, -113, 26, 63,
+    -40, -5, -64, -108, -60, -33, 71, 91, -120, 18, -90, 87,
+    40, 48, 43, -94, -118, -26, 19, -78, 31, 19, 43, 59,
+    63, 71, 50, -16, -37, 64, 32, 76, 51, -15, -13, -119,
+    62, -47, -115, 29, -118, -52, -124, -24, 72, -47, 101, -63,
+    -45, 1, 49, -50, 42, 62, -36, -64, 56, -36, 18, 56,
+    -36, -16, -24, 52, -21, -88, -108, -17, -35, -34, -11, 6,
+    -17, -19, -78, -53, -40, -63, 16, -102, -127, -37, 6, 94,
+    -52, 53, 33, 14, 18, -51, 88, -7, -57, 17, 67, -15,
+    47, -3, 14, -28, -80, -19, 51, 0, 29, 48, 59, 55,
+    -54, -85, 46, -6, -42, 74, -85, 53, -9, -3, 31, -17,
+    127, 52, -5, -75, 49, -49, 14, 72, -23, -48, 3, 26,
+    -46, 58, -40, -22, 11, -106, 27, -109, 9, -19, -57, -14,
+    29, -2, -8, 13, -42, -52, 11, -70, -62, -27, 44, 72,
+    -81, 47, -11, -106, -70, -43, 26, -4, -1, 2, -21, 62,
+    -29, 41, -11, 48, 21, 34, -66, 83, 1, 44, -33, -41,
+    -71, 60, -83, -24, 123, -6, 49, -111, -51, -30, 65, -43,
+    11, 12, -38, 82, 14, -20, -48, 52, -74, -24, 37, 45,
+    -2, -62, -62, 49, -22, -2, -40, 88, 38, 45, -76, 56,
+    2, 45, 52, 42, -37, -54, 62, 0, 93, -96, -70, -19,
+    29, -9, 40, -51, 122, 28, -25, -49, 5, -33, -32, -127,
+    42, -43, -57, 55, -11, 36, -1, -58, 14, 31, -10, -11,
+    -29, -65, 55, -88, 88, -46, -7, 3, 3, 29, -127, 68,
+    33, -12, -24, 30, -28, -61, 36, -34, 1, 25, -65, -24,
+    -2, 9, -5, -26, -20, 22, -39, 0, 63, -20, 10, 26,
+    62, 34, 15, 92, 48, 10, -2, 22, 65, 52, -43, -9,
+    32, 11, 35, -5, 37, 34, -1, -66, 56, 22, 8, -12,
+    9, 97, -89, -110, 126, 87, 27, 17, 35, -44, -34, 38,
+    -92, 38, -13, 5, 26, 46, -127, 24, 48, -124, 2, -76,
+    12, -19, -77, 40, -20, 29, -12, 12, -47, -72, -6, 73,
+    29, 24, 54, -106, 41, -83, 54, 14, 31, 56, 33, 88,
+    125, 41, 88, 56, 59, 19, -28, 57, 100, -110, 56, 62,
+    -36, 74, 57, 39, -63, -30, -31, 22, -30, 62, 47, -30,
+    35, -79, 9, 34, 1, 84, -105, 36, 69, 19, -127, -30,
+    -59, -86, -54, 99, 35, -127, -84, 3, 26, -35, -2, 122,
+    -58, -94, -72, 53, 42, 95, -47, 7, 56, 75, 70, 1,
+    -51, 35, -26, -34, 13, -99, 67, 72, -44, 70, 1, 16,
+    -29, -41, 127, 120, -48, 19, -70, -13, -20, -62, 7, 62,
+    -44, 32, 81, -67, 41, -46, -2, -50, -90, -69, -65, -41,
+    65, -24, -110, -65, -51, -36, -9, 21, 65, -48, -47, 85,
+    -47, 10, 57, 91, 11, -28, -104, 15, -20, 34, 100, 62,
+    -73, -40, 63, -99, -47, 47, 59, 8, 54, 14, 44, 8,
+    50, -42, 61, 17,
+};
+// functional_1/activation_2/Relu;functional_1/batch_normalization_2/FusedBatchNormV3;functional_1/conv2d_1/BiasAdd/ReadVariableOp/resource;functional_1/conv2d_1/BiasAdd;functional_1/conv2d_4/Conv2D;functional_1/conv2d_1/Conv2D
+alignas(16) const int32_t kTensor6Data[64] = {
+    2950, -2130, 1027, 1861, 2719, 2779, -2665, 3118, -175, 1338, 1490, 1725,
+    2797, 360, 3689, 1831, 1594, 160, 4501, 1117, 1891, 3329, 2112, -1767,
+    2176, 1895, 3524, -2024, 525, -121, 1295, -166, 1487, 45, 564, 2513,
+    2661, 1152, 1251, -3308, 1557, -1394, 2867, 430, 1235, 1860, 1961, -866,
+    1891, 1279, 2721, 3924, 1879, -515, 618, 316, 1145, 2838, 2195, 1386,
+    581, -2077, -113, -71,
+};
+const int32_t kOp2Multiplier[64] = {
+    1753010496, 1400798191, 1134457379, 1758672353, 1403607575, 1820785010,
+    1513526197, 1246474055, 1155777242, 1479158775, 1270449839, 1121960977,
+    1578196323, 1171900227, 1238656486, 2129490323, 1859006295, 1150855943,
+    1406136170, 1096281921, 1179667643, 1135417887, 1793992513, 1262616200,
+    2106404761, 1285768604, 1828269871, 1969992531, 2095390798, 1276555571,
+    1406488921, 1388277772, 1109336278, 2041424002, 1524387405, 1247844619,
+    1254068671, 1466156336, 1436942880, 1083956729, 1563114285, 1409961159,
+    1165600769, 1500316611, 1312999944, 1194430041, 1485904580, 1348061566,
+    1742367209, 1178477383, 1161423647, 2135868985, 2020513224, 1409196056,
+    1424482857, 1335577791, 1530524306, 1106321337, 1074189536, 1740004173,
+    1291847582, 1929897381, 1205240477, 1231837482,
+};
+const int32_t kOp2Shift[64] = {
+    -8, -7, -7, -8, -7, -8, -8, -7, -7, -7, -7, -7,
+    -7, -7, -7, -8, -8, -7, -7, -7, -7, -7, -7, -7,
+    -8, -7, -8, -8, -8, -7, -7, -7, -7, -8, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -8, -7,
+    -8, -7, -7, -8, -8, -7, -7, -7, -8, -7, -7, -8,
+    -7, -8, -7, -7,
+};
+const cmsis_nn_conv_params kOp2Params =
+    {128, -128, {1, 1}, {0, 0}, {1, 1}, {-128, 127}};
+const cmsis_nn_per_channel_quant_params kOp2Quant = {
+    const_cast<int32_t*>(kOp2Multiplier), const_cast<int32_t*>(kOp2Shift)};
+const cmsis_nn_dims kOp2InputDims = {1, 25, 5, 64};
+const cmsis_nn_dims kOp2FilterDims = {1, 1, 1, 64};
+const cmsis_nn_dims kOp2BiasDims = {1, 1, 1, 64};
+const cmsis_nn_dims kOp2OutputDims = {1, 25, 5, 64};
+
+// Operator 3: DEPTHWISE_CONV_2D
+// functional_1/batch_normalization_3/FusedBatchNormV3;functional_1/depthwise_conv2d_1/depthwise;functional_1/depthwise_conv2d_1/BiasAdd;functional_1/conv2d_4/Conv2D;functional_1/depthwise_conv2d_1/BiasAdd/ReadVariableOp/resource
+alignas(16) const int8_t kTensor8Data[576] = {
+    88, -73, -67, 63, -52, -33, -3, 118, 8, -103, 78, 55,
+    -26, 80, 127, -94, 18, 96, 127, -52, 102, -11, 79, -16,
+    3, -11, 76, 15, 111, -45, -81, -22, 9, 85, -127, 29,
+    3, 41, 79, 127, -28, -4, -69, 114, -36, 44, 37, 85,
+    -7, 100, 53, 8, -42, 10, -92, -60, 45, 72, -127, -52,
+    11, -28, 22, -50, -1, -59, 11, -69, -91, 14, 29, -66,
+    43, -72, 42, 84, -39, 127, -43, 127, 102, 30, 40, 11,
+    116, -34, -25, 77, 127, -5, -115, -90, -48, -23, -47, 127,
+    52, -104, 113, -4, -36, -57, 127, 2, -69, -127, -47, 64,
+    -33, 97, -86, -11, 66, -44, -16, 83, -123, -19, -27, -32,
+    -4, -28, -19, -11, -22, -39, 14, -127, 38, -42, 127, 71,
+    125, 28, -69, 119, 2, 11, 104, -41, 127, -13, 4, -33,
+    18, 127, -43, -15, -87, -127, 112, -57, 69, -34, -48, 26,
+    -48, -69, -41, -1, -72, 4, -115, 49, 25, -21, -28, 34,
+    -111, -14, -37, -74, -76, -71, 6, -21, -127, -22, -127, -23,
+    -32, -55, -31, 127, -31, -17, 21, -10, 0, 60, -21, -85,
+    127, 20, -72, 52, -111, -60, 32, 108, 28, -60, 15, 58,
+    -109, 74, 80, -50, -56, 89, 117, -72, 84, -4, 91, -23,
+    -93, 24, 106, 51, 127, 127, -119, -34, 37, 57, -73, -1,
+    -72, 127, -12, -7, 50, -5, -31, 64, -101, -42, 83, 127,
+    124, 109, -1, -21, -127, -61, -105, -21, 52, 76, -11, -11,
+    59, -99, -12, -18, 9, -67, 18, 14, 28, -34, 58, 19,
+    11, -58, 58, -24, -9, 121, -119, 44, 127, 44, -47, -38,
+    127, -26, 20, 50, 90, -4, -49, 72, -52, 14, -9, 47,
+    65, -25, 53, -34, -84, -44, 57, 120, 31, 52, -51, -5,
+    -66, 71, -6, -41, 34, -16, -89, 38, -65, 0, 53, 35,
+    56, 3, -36, -30, -48, -72, 127, -79, -12, -51, 45, 8,
+    127, -25, 2, -112, -17, 57, 84, -29, 62, 18, 120, -39,
+    -35, 58, -20, -61, -49, -20, -23, -93, 64, 37, -127, 110,
+    43, 41, 122, -34, 11, -58, -38, 93, -57, -40, -98, -56,
+    -21, -38, -28, -121, -90, 28, 3, 15, -121, -7, -24, 46,
+    50, -127, -83, 43, 40, -105, 55, -102, 68, 15, -79, -102,
+    97, 64, -24, 127, -6, -40, 127, 33, 127, -127, -67, 108,
+    -91, 35, -51, 36, -25, 44, 64, -127, -9, -46, 109, -127,
+    -125, 87, 108, 58, 86, 63, -127, -43, 31, 22, -110, -46,
+    -101, 94, 72, -18, 60, -19, -28, 127, -127, -56, 127, 22,
+    85, 127, -104, -127, -31, -107, -32, -90, 127, 6, 72, -85,
+    77, -15, -21, 71, 47, -127, -43, -15, 64, -12, 22, -36,
+    -28, -21, 43, -127, 23, 66, 24, 18, 83, 36, 55, -108,
+    -7, -9, -31, -12, 95, 23, 87, 82, 11, 51, -20, 15,
+    127, 79, 14, -54, -60, -93, 125, 76, 94, 100, -127, -13,
+    -72, -17, -6, 16, 22, -12, 7, -9, -34, -60, 36, 34,
+    100, 36, -51, -88, 36, -21, 96, 11, 50, -60, -3, 55,
+    1, -127, -41, -127, -2, 88, 127, 29, 31, 82, 126, -45,
+    -47, 81, 22, -87, -102, -17, -127, -49, 78, 127, -98, 127,
+    92, 121, 83, -74, 33, -127, 35, 127, -127, -7, -2, -57,
+    127, 66, -35, -68, -13, 127, -92, -3, -62, -32, 88, 41,
+    -66, -96, -127, 47, 25, -127, 110, -127, 127, -127, -55, -20,
+};
+// functional_1/activation_3/Relu;functional_1/batch_normalization_3/FusedBatchNormV3;functional_1/depthwise_conv2d_1/depthwise;functional_1/depthwise_conv2d_1/BiasAdd;functional_1/conv2d_4/Conv2D;functional_1/depthwise_conv2d_1/BiasAdd/ReadVariableOp/resource
+alignas(16) const int32_t kTensor7Data[64] = {
+    -2035, 2513, 217, -1406, -679, 1521, -728, 13, -1061, 2147, -1582, -878,
+    614, -2680, -1258, 305, -836, -2719, -1724, 3249, -661, 1390, -1287, 1092,
+    -1899, -1060, 955, -1120, -1365, -1494, 2366, -25, -1129, 285, 1159, -954,
+    3192, 30, -1114, -1311, -860, -177, 2280, -1374, 3264, -944, -335, -732,
+    -897, -1152, 1702, -383, 2357, 2805, 2356, -497, -1255, 600, 255, 3030,
+    -1217, 1745, -604, 2423,
+};
+const int32_t kOp3Multiplier[64] = {
+    1714133752, 1698805621, 1693693347, 1216969937, 1735814305, 1879620052,
+    1554176332, 1477316785, 1624124963, 1738267546, 1951688197, 1963805900,
+    1856832425, 1796474680, 1162897160, 1139020700, 2040819946, 2076564242,
+    1735670948, 1418463255, 1231094892, 1214681724, 1867559032, 1754692957,
+    2044652774, 1231630617, 2044833104, 1525740462, 1851553165, 1106654797,
+    1428586437, 1724402251, 1087753987, 1823558753, 1714680984, 1468675047,
+    1284410604, 1423009689, 2053024691, 1324499214, 1147243383, 1361934788,
+    2122974424, 1098402732, 1640228278, 1203990620, 1420131027, 1685960602,
+    1863302374, 1544851228, 1476837620, 1731253058, 1080317016, 1798928655,
+    1508177126, 1882108061, 1282398210, 1240758620, 1290956455, 1958000465,
+    1951353125, 1928126488, 1748347635, 1966609638,
+};
+const int32_t kOp3Shift[64] = {
+    -7, -7, -6, -6, -7, -6, -7, -7, -6, -7, -7, -7,
+    -7, -7, -6, -6, -7, -7, -7, -7, -7, -5, -7, -7,
+    -7, -6, -7, -7, -7, -6, -7, -7, -5, -7, -7, -6,
+    -7, -7, -7, -7, -6, -6, -7, -7, -7, -6, -6, -7,
+    -7, -7, -6, -6, -6, -7, -7, -7, -6, -6, -6, -7,
+    -7, -7, -7, -7,
+};
+const cmsis_nn_dw_conv_params kOp3Params =
+    {128, -128, 1, {1, 1}, {1, 1}, {1, 1}, {-128, 127}};
+const cmsis_nn_per_channel_quant_params kOp3Quant = {
+    const_cast<int32_t*>(kOp3Multiplier), const_cast<int32_t*>(kOp3Shift)};
+const cmsis_nn_dims kOp3InputDims = {1, 25, 5, 64};
+const cmsis_nn_dims kOp3FilterDims = {1, 3, 3, 64};
+const cmsis_nn_dims kOp3BiasDims = {1, 1, 1, 64};
+const cmsis_nn_dims kOp3OutputDims = {1, 25, 5, 64};
+
+// Operator 4: CONV_2D
+// functional_1/conv2d_2/Conv2D
+alignas(16) const int8_t kTensor19Data[4096] = {
+    -60, 12, -4, -59, 41, -74, -31, 1, -62, -5, -37, 37,
+    -26, 38, 45, -8, -80, 1, -21, 15, 84, 26, -28, -13,
+    46, 6, 41, -42, 61, 31, -127, -125, -42, 56, -38, 45,
+    -3, 60, 51, -30, 24, 1, -66, 74, -55, 42, -36, -37,
+    -66, 30, 29, 27, -14, -28, -1, -24, -67, -8, -25, 30,
+    -85, -80, -8, -8, 2, 18, -59, -7, 49, -55, -90, -59,
+    -49, 92, 75, 55, -22, -17, -41, -2, 127, -39, 111, 88,
+    33, 0, -104, 28, 6, 96, 37, -44, 68, -30, 50, -14,
+    127, -127, 65, -68, -27, -17, -10, 44, 60, 23, 13, 5,
+    69, 48, 61, -3, -63, -26, 4, 5, 68, -37, -3, 59,
+    10, 87, 28, 99, -19, 5, 62, 46, -58, 27, 96, -83,
+    -41, 49, 7, -85, -127, 68, 105, -35, -22, -53, 42, 20,
+    93, 26, -7, 21, -7, 79, -22, -6, -7, -26, 19, -65,
+    -1, -80, 42, 10, -55, 43, -8, -31, 126, -78, 50, -93,
+    -6, -29, 79, 21, 4, 1, -15, -8, 32, 125, 78, 83,
+    -18, 1, 16, 50, -39, 42, -45, 26, -12, -7, 58, -32,
+    -72, -10, 35, 28, -3, 76, -24, 61, 12, 72, -97, -119,
+    73, -24, -29, -52, 49, 64, -26, 24, 102, -19, -7, -5,
+    1, 1, 51, 45, 66, 9, 65, -59, -13, -42, -73, -73,
+    127, 3, 8, 6, 47, 60, -17, 78, 89, -9, 100, -35,
+    -91, 22, 15, -25, -33, 59, -31, -16, 43, 14, 50, 65,
+    -31, 76, 64, 22, 64, 27, -44, -22, -67, 25, 26, 30,
+    72, -9, 14, 14, -32, -127, -60, 59, -37, -102, -77, 11,
+    44, -8, 60, -24, 52, 25, -53, -8, -24, 62, -94, 41,
+    -10, -9, 42, -8, 60, -2, 49, -24, 52, -8, 27, 42,
+    -22, 30, 41, -58, -76, -12, -51, 5, -28, 20, -61, -41,
+    -45, 54, -52, 4, -44, -68, -26, 61, -8, -73, -39, -5,
+    38, 94, -28, -1, 20, -44, -8, 44, 68, 61, -20, 0,
+    -14, -61, 38, -93, -69, 41, -33, 86, -26, 35, 24, 14,
+    -92, -59, 9, 7, 5, 2, 19, -43, -127, 30, 37, -15,
+    -26, -2, -32, -83, 31, -43, -22, 68, 74, -39, 52, -66,
+    -19, -29, -12, -32, 22, -2, -37, -78, -65, 19, -73, -24,
+    88, -6, -8, 52, -3, -55, 23, -66, 37, 53, 101, -23,
+    27, 5, 57, -14, 116, 42, 35, -52, -35, -50, 20, -32,
+    -3, 20, 12, 14, 69, 54, -36, -43, 22, 109, 4, 10,
+    38, -56, -59, -2, 77, 20, -32, 25, -24, 24, 127, 1,
+    29, -45, 8, 3, -3, 68, -4, 41, -73, -1, 72, 34,
+    -4, -51, -11, 1, 29, 27, -63, -83, -45, -23, 78, 95,
+    81, 9, 101, -12, -30, 101, -112, -29, 48, -36, 12, 16,
+    -57, -62, -45, 17, 70, 44, 75, -37, 32, 2, 34, 83,
+    -13, 29, -80, -22, 80, -84, -19, -17, -89, 105, -66, -127,
+    42, 26, 18, -10, -75, 55, 4, -33, 40, -27, 13, -6,
+    -96, -5, 4, -41, -64, -25, -124, 32, -61, 54, -21, -6,
+    93, 29, 59, -68, -2, 46, -65, -3, -91, 57, -12, -16,
+    21, -122, 28, 34, -56, -26, -57, 14, 78, 12, 37, -6,
+    40, 41, 10, 113, 63, 34, -92, 53, -56, 10, -30, -61,
+    -84, 55, -6, -78, 5, 22, 29, 37, -38, -55, 127, 67,
+    -1, -44, -107, 52, 107, -69, 19, -68, 21, -74, -66, -35,
+    -44, -3, 115, 8, -57, -97, -28, -73, -51, 11, 58, -8,
+    46, -21, -112, 26, 75, -5, -72, -15, -25, -10, 56, -34,
+    20, 89, -79, 36, -83, -52, 46, -13, 36, 8, -39, -70,
+    74, -70, 107, -19, -105, -56, 34, -41, 54, -21, -53, 84,
+    11, -46, 30, 28, 22, -24, 32, -12, 27, -127, 112, -39,
+    -16, 59, -19, 5, -18, 27, -28, 51, -24, 86, -26, 46,
+    -127, 2, 2, 8, 19, -19, -66, -5, 7, -84, -5, -22,
+    -9, -24, 26, -1, 51, -4, -17, -21, 19, 67, -47, 14,
+    -32, -25, 37, -19, 1, -32, -53, 31, 27, -13, 10, 33,
+    -55, -29, -48, -40, -2, 5, -14, 61, -55, -26, -17, 31,
+    -59, 18, -19, 67, -23, 15, 6, 9, -13, -42, 84, -12,
+    -5, -124, -21, 25, 42, 60, -14, -23, -28, -51, -50, -65,
+    -63, 93, -3, 26, -26, 13, -91, -49, -37, -2, 31, -4,
+    -75, -72, -24, 5, 95, -33, 7, 14, -94, 21, -86, 10,
+    26, -11, 11, -50, -96, -27, 23, -19, -37, -31, -15, -44,
+    2, -109, 1, -43, -127, -78, -20, -66, -55, 26, 40, -14,
+    -38, 10, 4, -17, -87, -41, -6, -83, -127, -1, 39, 111,
+    79, 40, 117, -52, -60, 46, -87, -43, -15, -44, -2, 35,
+    21, -118, -27, 45, -10, 70, -78, -78, -80, 32, 78, -57,
+    -48, 43, 57, -35, -6, 22, -4, 59, 12, -68, 44, -71,
+    34, 15, -70, -45, -52, 28, 13, 5, 12, 6, 9, -87,
+    -74, 16, 64, -48, 35, -34, 44, -78, 18, 5, 30, -1,
+    74, -59, -17, 66, 44, -51, -39, 97, 14, -70, -106, 86,
+    -26, -54, -7, 0, 28, 82, -45, 37, 41, 31, -58, 83,
+    18, 33, 39, 57, 10, -22, 65, -73, -35, 1, 13, 7,
+    11, 29, -41, 34, 37, -82, -55, -80, 81, 33, -127, -6,
+    10, 2, -2, -84, 29, 12, -47, 112, -4, 54, -7, -15,
+    -35, 16, 41, -7, -36, -13, -4, -53, 68, -3, -18, -18,
+    -21, -20, 8, -54, -27, -41, -56, 0, -16, -17, -127, -8,
+    31, -43, 4, -19, 30, 6, -31, 24, 20, 10, -43, 19,
+    -18, -26, -18, -56, 45, -28, -37, -16, 20, 5, 8, -57,
+    58, -11, 13, 32, 13, -18, -22, -33, -14, -33, 10, -12,
+    125, -112, 66, 42, 59, -8, 28, 28, -92, -75, 16, 45,
+    -68, -34, -5, 127, 89, 59, -33, -79, -55, -118, 28, 64,
+    -56, 104, -64, -91, 93, -46, -14, -22, 37, 18, -66, 80,
+    120, 11, -68, -119, -21, -40, -106, 83, -70, 6, -74, -54,
+    5, -51, 13, 34, 12, -23, -39, -79, -81, -47, 5, -79,
+    -5, -46, -18, 54, -36, 55, -58, -22, 82, 95, -7, -60,
+    18, 105, 26, -35, -26, -60, -70, -31, 37, 14, 58, -67,
+    49, 47, -37, 16, 127, -32, 34, -27, 31, 94, -53, 1,
+    -8, -2, 35, 26, -37, -6, 33, 6, -1, -63, 36, -1,
+    -96, -19, -61, 49, -46, 92, -16, 51, -61, 22, -84, -34,
+    35, -38, 81, -5, 6, -79, 32, 82, 115, -68, -9, 92,
+    67, -62, -83, -20, 46, 30, -77, -97, 17, -28, 7, -86,
+    -47, -6, -31, 108, -58, -36, 48, 15, 82, 3, 8, 93,
+    -127, -47, -9, 81, -21, -45, -7, -43, 23, -51, -31, -37,
+    58, 23, -1, -50, 113, -3, -101, -40, -20, 75, 45, -32,
+    -42, -44, 16, 5, -53, 14, -2, 61, -90, 66, -72, -117,
+    -38, 36, -3, -8, -62, -12, 42, -87, -82, 1, 26, -14,
+    2, 38, -10, 7, -12, -96, 48, -56, 34, 21, 2, 19,
+    39, 20, 63, 36, 18, 15, -4, 17, -7, -127, -26, -24,
+    26, 10, 34, -90, -31, 0, 34, -42, -55, -75, -35, 27,
+    55, -11, -55, 19, -6, -14, -92, -4, -111, -87, -87, 72,
+    53, -33, -1, -39, -84, 100, -41, 86, -63, -44, 32, -112,
+    102, 1, 72, 46, 66, 34, 24, 19, 33, 41, 18, -112,
+    78, -127, -8, 17, -61, -122, 3, 41, -34, 35, -82, -58,
+    -112, -40, 79, 9, -25, 48, 88, -24, 23, 5, -64, 116,
+    -92, 1, -30, 124, -16, 23, 40, -9, -13, -34, -35, 0,
+    45, 86, -66, 7, -24, -40, 73, 82, 35, -5, 23, 51,
+    -17, -26, 26, 49, 12, 7, -20, -50, 12, -98, 127, -57,
+    77, 0, 38, -43, -21, -12, -12, -22, 2, 24, 10, 9,
+    38, -34, -44, -62, 39, 15, -23, -30, 27, -86, 45, -23,
+    24, 2, -67, -28, 41, -19, -23, 18, -19, 30, -7, 60,
+    70, 10, 36, 18, 59, 61, 36, 35, 19, -72, 33, 28,
+    -20, -38, 14, 60, -17, 69, 49, -56, -53, 23, -16, -26,
+    86, 89, 29, -37, 127, 80, -111, -84, 6, -43, -35, -43,
+    80, 29, -29, 74, -27, -15, -80, -115, 56, 39, -54, 41,
+    65, -68, -70, -104, 10, 5, 46, 43, 33, 38, -15, 60,
+    -13, -29, 0, 82, 12, -99, -46, -69, -36, 122, 65, -56,
+    -45, -65, -54, -40, -120, -46, 25, 98, 113, 37, -31, 12,
+    30, 75, 26, -40, 72, 22, 125, 3, 25, 103, -38, 19,
+    -86, 50, -11, -23, 7, 23, 13, 18, 36, -50, -32, -38,
+    127, 95, -58, 66, -89, 12, 43, -12, 39, -5, 61, -48,
+    -2, -69, 120, -18, -76, -117, 87, 100, 73, -61, -62, -58,
+    103, -61, -22, -23, 48, -55, -44, 11, 34, 9, -24, 31,
+    -36, 51, 52, -7, 36, -47, 60, 16, -49, 24, 13, 33,
+    -24, -24, -19, 40, 29, 43, 48, 14, -44, 7, -11, -58,
+    -20, 73, -15, -8, -16, -44, 22, -37, 5, -60, -34, 43,
+    -32, 19, 27, -23, -13, -38, -9, -23, -20, 7, -19, -19,
+    15, 22, 36, -127, 59, 11, 6, 28, -13, -18, 22, 9,
+    36, -20, 36, 1, -3, -69, 57, 93, 45, -30, 27, -22,
+    28, 73, 5, 40, -40, 69, 40, -19, 54, -58, -4, 24,
+    -21, 17, 98, 7, 29, -32, 72, -37, 6, 20, -26, 92,
+    35, -33, -1, 77, -34, -22, 30, -26, -65, 1, 30, -68,
+    94, 22, -44, 4, -11, -89, 49, 22, 22, 127, -22, 88,
+    40, 77, 63, -44, 41, 111, -64, 74, 1, 35, 67, 69,
+    -104, -31, -14, -103, 26, 15, 65, -33, 36, -89, -39, 109,
+    43, -2, 3, -23, -22, 16, -54, -79, 87, -95, 59, -2,
+    31, -25, 49, 34, -96, -27, -12, 14, -87, 40, 23, -21,
+    22, -33, -16, 76, 0, -21, -98, 18, -39, 3, 79, 127,
+    -62, 86, -69, -69, 96, -27, 26, 79, 57, -35, 61, 60,
+    47, -42, 29, -62, 107, 71, 31, -11, 91, 109, 109, 88,
+    -67, -25, 1, 20, -21, 107, 11, -66, -19, -84, -27, -55,
+    -108, -117, 98, 82, 6, -65, -7, 64, -22, 27, 74, -127,
+    -10, 20, 62, 78, -16, -71, -7, 50, -24, 38, 3, 28,
+    1, 63, 102, 28, 75, -77, -72, 67, 21, 59, -55, -61,
+    -10, -54, -43, 18, 53, -59, 5, -6, 8, -102, 102, -28,
+    -5, -4, -79, -2, -65, -51, 73, -46, 79, -3, -20, 17,
+    -127, -86, -110, -72, -69, -29, 30, 40, -70, 2, 27, -4,
+    -32, -81, -10, -67, -123, -56, -48, -5, -8, 34, 1, 99,
+    7, -14, -38, -3, 26, -10, 93, 7, 62, 69, 21, -41,
+    -42, -96, -26, -99, -1, 70, 50, 8, 72, 118, 39, 10,
+    82, 60, 42, 46, 0, -110, -44, -43, 6, -36, -71, 25,
+    -127, -69, -68, -36, -31, -39, 29, 23, 41, 47, 86, -12,
+    2, -121, 59, -41, 32, -29, -65, -36, 93, -80, -79, 5,
+    6, -37, -87, 14, -67, 28, 77, 22, -4, 69, 41, -65,
+    82, 17, -33, 87, -6, -41, -63, -20, -14, 83, -93, 21,
+    -48, 66, -95, -95, -35, -85, 29, -14, -14, -42, -28, 119,
+    -50, -14, 31, 24, 113, 99, 112, -94, -56, -37, -18, 29,
+    5, -5, 104, -48, -16, -70, -42, -61, 18, -2, -39, -72,
+    -45, -30, -127, 45, -22, 43, 6, 59, -40, 60, 111, 14,
+    -77, -56, -24, -14, -72, 106, 56, -42, -83, -7, 99, 13,
+    -1, 65, 75, -12, -87, -21, 36, -77, -75, -51, 49, 79,
+    73, 127, -77, -99, 21, 125, 74, 30, -68, -93, 109, -2,
+    76, -29, 75, -33, 47, 76, -95, 50, 64, -66, 32, -15,
+    -24, 48, 17, 98, 3, 25, 9, -30, -48, -23, 33, -44,
+    29, -37, -51, -109, -6, -75, -1, 75, 17, -102, -31, 34,
+    -18, -24, 65, -55, 15, 41, 35, 33, 66, -37, 64, 40,
+    -23, -32, 15, -56, -23, -98, -19, -22, -6, -87, 64, 25,
+    69, 63, 3, 6, -43, 33, -49, -39, 35, 8, 73, -5,
+    -12, 24, -16, 50, 127, -35, -24, -31, -24, -74, -29, 11,
+    5, 61, 101, 53, -44, -2, -120, 66, 0, 26, 45, -35,
+    -4, -23, -18, -20, -6, -36, 65, -67, 18, 10, -58, 21,
+    -7, 84, 12, -2, 69, 52, -58, 4, -57, -4, 38, -62,
+    -15, 23, -64, -14, 25, -33, -27, -100, -20, -10, -11, 21,
+    -69, 29, -30, -54, 9, 0, 49, 30, 6, 65, 20, -53,
+    11, -27, -5, -19, -42, -63, -127, 51, -62, 62, 103, 16,
+    -67, 49, -26, -6, -1, -24, 22, -79, 41, -14, -5, -48,
+    -89, -62, 5, -7, 47, -31, 38, -68, 22, -10, 27, -38,
+    10, 36, 47, 105, -29, 127, -46, -77, 43, 4, -43, 71,
+    -36, -30, 12, 0, -5, 1, -11, 29, -10, -55, 91, 25,
+    -16, 1, -8, 22, -58, -10, -13, 20, -87, -35, 77, -5,
+    -10, 18, -14, 15, 22, -16, -55, 62, 53, -83, 43, -15,
+    3, 8, -16, -69, 26, -10, 14, 6, 35, -49, -68, 18,
+    -69, 23, 82, -2, -4, -78, -61, -58, 22, -60, -5, -35,
+    71, 11, -13, 28, 63, -16, -55, 9, 23, -54, -42, 2,
+    52, -26, 86, 87, -5, -40, 52, -41, 15, -62, -20, 8,
+    7, 73, 56, 35, 14, 13, 42, 39, -82, 1, -62, 16,
+    -29, -23, 36, 40, -67, 48, -127, 22, -27, 42, -31, -25,
+    19, 33, 3, -84, -127, 90, -104, -58, -6, -21, 91, -72,
+    -24, -9, 71, 7, 72, -34, -19, -10, -103, 4, 56, -19,
+    92, -23, -45, 20, 11, -32, -61, 92, 30, -32, -26, 2,
+    -35, 3, -66, -15, 27, 12, 11, -15, 35, -17, -5, -19,
+    83, 23, -11, 26, 63, 7, -9, 26, -38, -108, 98, -54,
+    -33, -5, -35, 9, 67, 36, -113, -79, -54, -48, -106, 33,
+    25, 15, -32, -18, 38, 22, 11, -4, 34, 23, -108, -81,
+    -66, 49, 6, -38, -51, 22, -47, 15, 75, -46, -15, -44,
+    -31, -8, -34, -45, 38, -22, 67, 39, 15, -127, -3, -54,
+    -2, 12, -80, 79, 44, 31, -22, -48, -106, 27, 79, 35,
+    92, -5, -13, 20, -1, 35, -35, -19, 55, 17, 29, 28,
+    34, -17, -76, -72, -79, -65, 11, -20, -25, -11, 11, 22,
+    -15, -33, -114, 55, 17, -17, 46, 38, -20, 72, 1, 71,
+    -44, 32, -18, -22, -44, -27, 65, -25, -3, 10, 29, 7,
+    -95, -36, 11, -108, -33, 41, 44, 54, -36, 87, 21, 10,
+    127, -26, 35, -31, 68, -5, 38, 49, -7, -11, 5, 55,
+    5, -28, -18, -42, -3, 15, 49, -64, -5, -17, 39, -127,
+    14, -61, -66, -29, 70, -40, -113, 23, 33, -51, -16, -25,
+    -28, 91, 14, -42, -47, -47, 45, -99, 0, 46, 43, 10,
+    -31, 8, 25, 11, -5, 4, 86, -17, -13, -95, 37, 26,
+    -60, -5, -83, 42, -23, 100, 17, 20, -74, 11, 28, -84,
+    -28, -22, -15, 50, 20, -21, -4, 53, -42, -11, 27, 34,
+    -96, -44, -71, 46, -12, -37, 74, -7, 42, 7, 3, -26,
+    47, 16, 5, 92, 24, 127, -8, 44, 11, -22, -22, -22,
+    -52, -3, 15, 62, 14, 46, 35, 51, -3, -9, 0, 27,
+    -15, -12, -58, 17, 23, -116, 68, 23, 67, -56, 39, 3,
+    -55, -15, -5, -46, 101, -106, 2, -33, 46, -45, 24, 3,
+    -46, 98, -10, 8, 49, 69, 36, -66, -12, 1, 45, 46,
+    80, 30, 59, 37, -71, 39, 47, -14, -33, 4, 72, -20,
+    -26, 77, 0, 45, -31, -26, -4, 60, -44, 0, -21, -75,
+    86, -42, -67, 67, -60, -38, -13, 79, -45, -1, -64, -37,
+    85, 19, 14, -127, 55, -118, 2, -35, 63, -3, 61, 31,
+    14, 72, 35, 12, -65, 33, -127, -15, 38, -31, -10, -54,
+    45, 88, 26, -78, -78, -56, -70, 54, 47, 14, -2, 33,
+    -32, -15, 67, 41, 29, -59, -44, 3, -39, -40, 42, -35,
+    54, 2, -10, -44, 22, 115, 76, -63, -46, -70, -34, -14,
+    21, -15, 24, -55, 17, -17, -30, -39, -41, -74, 3, 5,
+    -51, -19, 38, 50, 19, -24, -6, -29, -21, 13, -19, -6,
+    -27, 40, 85, 40, -36, 82, -56, 34, 5, 20, 48, -37,
+    22, -75, 12, 26, -96, -39, -50, 0, -47, 7, -46, -37,
+    23, 42, 57, 64, 58, 11, 86, 38, -79, 1, -61, 33,
+    -18, 4, 16, 37, 55, 8, 42, -1, -36, 1, -5, -9,
+    -127, 17, -53, -39, 30, -61, -65, -25, -36, 4, 15, 37,
+    17, 18, -81, -1, 102, 28, -9, -3, 44, 100, 9, -29,
+    -127, 78, 53, 83, -14, 57, 32, 57, -11, 59, 18, -11,
+    67, -29, -68, 18, 59, 66, 11, 38, -9, -13, 37, -63,
+    -66, 4, 33, -44, 65, 72, -8, -55, -4, -48, 29, 29,
+    110, -69, 106, -61, 74, 88, 123, -104, 4, 47, 7, 34,
+    33, 75, -41, 35, -25, 74, -10, -76, 61, -5, -11, -43,
+    -2, 16, -25, -38, -16, 38, -13, -102, 13, 29, -41, 50,
+    -27, 29, -60, -42, -70, -24, -22, 3, -37, 31, -17, 34,
+    56, 31, -10, 73, 13, 40, 71, 34, -46, 127, -24, 13,
+    -2, 42, -79, -79, -24, -55, -43, 40, -36, 12, -39, -27,
+    45, -77, -98, 45, 18, -99, -36, -34, 28, -2, 70, -25,
+    36, -70, -64, 11, -24, 119, -71, -5, -31, 6, -21, 37,
+    40, -32, -12, 94, 18, -29, -18, 31, -1, 28, 76, -7,
+    28, 55, 92, -82, 1, -56, 47, 31, -6, -26, -121, -38,
+    -58, 64, -9, -44, 89, -47, -3, 30, -2, -34, 62, -1,
+    -15, 127, 5, 91, 5, 127, 3, -110, -25, 39, 57, -37,
+    -48, -27, 99, 38, 33, -9, -9, 115, 34, 50, 42, 6,
+    110, -33, 2, -41, -71, -46, 60, -17, -53, 25, -1, 40,
+    -3, 95, -94, 8, -89, -31, 37, 30, 35, 42, -21, 25,
+    -72, 25, 55, -58, 35, -17, 93, -16, -61, 107, -64, -14,
+    -38, -54, 32, 68, 45, 0, -63, 88, -60, 26, -33, 61,
+    56, 58, -26, -14, 73, 105, -28, -52, -29, -32, -6, -57,
+    82, -62, -34, 49, -65, -6, -9, 38, 40, -78, -48, -55,
+    -46, -25, 17, -53, 49, -13, -20, 44, 99, 2, -11, -10,
+    -32, -60, -60, 127, -49, 17, -14, 95, -14, -33, -51, 27,
+    -24, -11, -54, 20, 31, 14, 27, -96, 28, -27, -32, -50,
+    49, -93, -61, 51, 63, -46, 29, -18, 37, 21, -97, 17,
+    57, -6, -123, -124, -3, 24, -59, -2, -26, 8, -31, -41,
+    -6, 78, -78, 30, -42, -75, -41, -28, -17, 127, 83, 106,
+    -26, 10, -62, -22, -3, 25, 30, 104, -26, -56, 18, 11,
+    -124, 63, 7, -9, -67, 40, 54, -73, 1, 63, 43, -101,
+    -8, 15, 29, 9, -71, -55, 13, 93, -77, 50, -93, 66,
+    7, -127, 39, 66, -71, 3, -4, 10, 50, 28, -102, 78,
+    -76, 59, -36, 27, 13, -58, 36, -65, 5, -66, 30, 10,
+    -25, 62, -65, -44, 43, -96, 5, 17, 39, 41, 63, 20,
+    20, -24, -91, -95, 19, 8, 26, 50, 2, 70, -68, 31,
+    -30, 74, 0, 63, 31, -42, 11, -2, -70, -66, -92, 19,
+    53, 9, -84, -27, 101, 76, 23, -51, -96, 31, -79, -8,
+    -1, -66, 22, 60, 22, 41, -10, -3, -5, 64, -3, -26,
+    70, -34, -24, 12, 37, 51, 110, 63, 87, -68, 70, -57,
+    -125, -84, -39, 91, 14, -12, -24, 17, 37, 20, -127, -41,
+    69, 37, -21, 51, 35, 27, 91, -43, -78, -16, 95, 10,
+    26, -30, 67, -54, 66, 17, -57, -7, 52, -110, 62, 91,
+    38, -127, 56, -35, -50, -55, 6, -11, -45, 42, -52, -35,
+    9, 48, -101, 49, 20, 42, -23, -119, -1, -90, -22, -3,
+    25, 48, -15, -28, -100, -37, 32, -78, 41, 7, 40, -95,
+    -8, 35, -67, -34, -30, 26, -78, -54, 80, 20, 4, 4,
+    15, 6, 76, 44, -71, -29, 79, 60, 12, 20, -3, -43,
+    24, 19, 50, 41, -77, 31, 2, -23, 30, 60, -19, 78,
+    47, 4, 24, -39, -45, 9, 53, -57, -10, 41, -33, -22,
+    -98, 54, 8, -84, 71, -14, -17, -45, 63, -38, 63, -19,
+    -29, 7, 127, -10, 8, -48, -2, 70, -4, 116, -3, -28,
+    65, -91, -48, 87, -28, -18, 25, -15, -91, -73, -86, -2,
+    23, -65, -51, -77, -50, 108, 42, 11, -44, 7, 37, 66,
+    -19, -66, 54, -120, -42, 17, 13, -84, -20, 1, -1, 23,
+    -33, 87, 23, 46, -36, 16, 90, 28, -57, -65, 40, 39,
+    -81, -9, -9, 54, -96, 4, 18, -127, -97, 37, 21, -45,
+    36, 64, -51, 50, 2, -4, 39, -37, -49, -4, 10, 18,
+    -123, -16, 60, 59, -45, 14, -33, -8, -54, -11, -78, -44,
+    64, 36, 49, -40, -83, -46, 56, 28, -29, 55, -58, -26,
+    -13, -125, -21, 34, 38, 4, 15, -31, 80, 11, 56, 36,
+    60, 26, 77, -4, -17, -41, 49, -7, -48, -127, 4, -91,
+    -27, 40, 7, 9, 2, 36, 10, 34, 43, 19, -15, -47,
+    -64, 48, 55, -66, -3, 18, 46, 30, -48, -16, -81, -36,
+    9, 66, 39, 43, 9, 17, 102, 38, -30, 72, -21, -3,
+    53, 63, 0, -49, 9, -41, -4, -35, 59, -127, 32, -32,
+    46, -61, -33, -75, 46, 77, 26, 46, -40, -23, 16, 3,
+    42, -76, -48, 12, 94, 90, -101, 9, 1, -54, 51, 20,
+    86, -23, -56, 67, 1, 33, 29, 25, 13, 7, 78, 5,
+    92, -27, 18, -17, 41, 60, -111, 17, 103, 5, 56, -47,
+    51, 59, 4, -17, 105, -55, -79, 30, 50, 44, 53, 61,
+    82, -70, -51, 45, 51, 8, -30, -43, 4, 45, 0, 5,
+    29, -83, -2, 9, -31, -24, 61, 127, 54, -64, -7, -5,
+    -91, -49, -26, 16, -2, 84, 6, -20, 13, 9, -3, -19,
+    -52, -47, -11, 42, -36, 76, -41, 70, -59, 23, -52, 39,
+    -81, 59, 15, 26, 70, 18, 36, -16, -69, -34, -43, -37,
+    -61, 123, 78, -26, 64, 18, 32, -2, -33, 2, 3, 50,
+    33, -67, 32, -106, -38, 52, -73, 77, -34, -2, -4, 127,
+    8, 33, 89, 12, 28, 52, -44, -13, 42, 36, 7, 110,
+    -10, 19, 27, 25, 106, 111, -57, 28, 93, -32, -18, -26,
+    95, -50, 127, 89, -66, -76, -35, 58, 2, 58, 26, 74,
+    -58, 126, 83, 111, 101, -42, 31, 34, -4, 6, -59, 9,
+    -34, 7, -46, 78, -42, -74, 65, 67, -78, 9, -38, 3,
+    -15, 16, -6, -55, -23, -76, 14, -20, 22, -78, -19, 19,
+    41, 93, -52, 20, -79, -39, -93, 112, 71, -23, -3, -95,
+    55, 18, -53, -39, 29, -11, 61, -58, 2, -85, -48, 56,
+    -19, 22, 76, 35, 7, -13, -13, -6, 6, 6, -67, -72,
+    88, 2, -17, 20, 127, 42, 70, 44, 89, 106, 44, -61,
+    68, -10, -28, 2, 115, -43, 4, -19, 104, -51, -2, -23,
+    3, -96, -58, 44, -55, -26, -94, -38, -98, -61, -46, 53,
+    62, 28, 2, 98, 33, 81, -37, -51, -13, -75, 64, 18,
+    -9, 19, 69, -21, 55, 127, -62, -19, -15, 2, -49, -57,
+    -13, -29, 10, 17, 35, 30, -51, -113, 9, -66, 49, 33,
+    -40, -36, -105, -20, 103, 7, -24, -14, -109, -28, -3, -63,
+    63, -47, -20, -6, 5, -64, -38, 20, 84, -16, 35, 62,
+    -5, 60, -68, -13, 50, 27, -2, -46, -20, 20, 10, -10,
+    -19, 7, -127, 53, -54, 7, 44, 108, 7, 43, 23, 0,
+    25, 35, -48, 8, 54, -60, -82, -83, 53, -30, -114, -124,
+    -11, 41, 26, 5, 15, 9, 87, 35, 70, 63, 25, 66,
+    -9, -33, -86, -50, 35, 44, -27, 4, 18, 1, 29, -90,
+    11, -1, -46, 11, 37, 50, -12, -21, -48, -1, -48, -25,
+    69, 31, 27, 5, -24, -121, -90, 1, 6, -120, -58, 110,
+    47, 50, -41, 39, 33, 17, 77, 103, -110, -61, 88, -53,
+    -52, -58, -75, 53, -63, 54, -39, -26, -36, 80, 115, -1,
+    -31, 19, -85, -57, -127, -78, 72, 28, 30, -63, 39, -40,
+    -34, 78, -33, 14, 26, 1, -79, 40, -76, 32, -63, 50,
+    -45, 9, 28, -40, -56, 1, -66, -56, 6, -1, 56, 36,
+    34, -40, -41, 5, 61, -85, -73, 52, -52, 61, -18, -42,
+    53, 101, -71, -46, -46, -97, 69, -8, 45, 80, 33, 47,
+    106, -8, 37, -63, 6, 70, -43, 107, 63, 127, -18, -5,
+    -38, 17, 1, -44, -62, 63, 62, 20, -42, -23, 71, 30,
+    -55, -110, -74, 19,
+};
+// functional_1/activation_4/Relu;functional_1/batch_normalization_4/FusedBatchNormV3;functional_1/conv2d_2/BiasAdd/ReadVariableOp/resource;functional_1/conv2d_2/BiasAdd;functional_1/conv2d_4/Conv2D;functional_1/conv2d_2/Conv2D
+alignas(16) const int32_t kTensor9Data[64] = {
+    3050, -6036, -2792, -4920, 2566, 3719, -4042, 1847, 1495, 1594, 1690, 7181,
+    4171, -399, 3461, 3797, -822, 3324, 4882, 880, -1267, 1062, -2672, -808,
+    -5813, -536, -3983, 5958, -2404, 94, 521, -1073, 2107, 953, 638, 1506,
+    4034, -1731, 2849, -622, 262, 1227, 368, -2933, 442, -1037, -3659, 1779,
+    3769, 301, -270, 2441, -1966, 3602, 1843, -3268, -3412, -2171, -2984, -843,
+    50, -776, 2696, -1538,
+};
+const int32_t kOp4Multiplier[64] = {
+    1352513846, 1489513224, 1379458316, 1477987624, 1639906495, 1084564680,
+    1893259625, 1414921633, 1590248680, 1261327875, 2121746637, 1291550477,
+    1193854958, 1700510853, 1354542153, 1237655415, 1859562043, 2134661778,
+    1759378903, 2015455487, 2043579655, 1092662229, 1222915475, 1160175847,
+    1712718927, 1552760599, 1404169791, 1451816696, 1314090277, 1296517021,
+    1331039802, 1615117376, 1911710593, 1654589195, 1629185796, 1805117887,
+    1298266647, 1400135407, 1504218799, 1616550840, 1442929496, 1696869415,
+    1680909935, 1306538278, 1796114167, 1514469122, 1469406920, 1610711739,
+    1131109424, 1317781222, 1385498455, 1427648409, 1611025645, 1803660582,
+    1284534792, 1560836992, 1385906544, 1243604164, 1528928555, 1754894440,
+    1454913766, 1612589482, 1349712104, 1345755257,
+};
+const int32_t kOp4Shift[64] = {
+    -7, -7, -7, -7, -7, -6, -7, -7, -7, -7, -7, -7,
+    -7, -7, -6, -7, -7, -8, -7, -8, -7, -7, -7, -6,
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7,
+};
+const cmsis_nn_conv_params kOp4Params =
+    {128, -128, {1, 1}, {0, 0}, {1, 1}, {-128, 127}};
+const cmsis_nn_per_channel_quant_params kOp4Quant = {
+    const_cast<int32_t*>(kOp4Multiplier), const_cast<int32_t*>(kOp4Shift)};
+const cmsis_nn_dims kOp4InputDims = {1, 25, 5, 64};
+const cmsis_nn_dims kOp4FilterDims = {1, 1, 1, 64};
+const cmsis_nn_dims kOp4BiasDims = {1, 1, 1, 64};
+const cmsis_nn_dims kOp4OutputDims = {1, 25, 5, 64};
+
+// Operator 5: DEPTHWISE_CONV_2D
+// functional_1/batch_normalization_5/FusedBatchNormV3;functional_1/depthwise_conv2d_2/depthwise;functional_1/depthwise_conv2d_2/BiasAdd;functional_1/conv2d_4/Conv2D;functional_1/depthwise_conv2d_2/BiasAdd/ReadVariableOp/resource
+alignas(16) const int8_t kTensor11Data[576] = {
+    -127, 58, -17, -41, -127, -104, -93, -29, 127, 103, 17, -7,
+    114, 12, -80, -7, -78, -115, -34, -25, 9, 127, 62, -47,
+    60, -82, 97, 27, -16, 67, -86, -16, 127, -123, 127, -123,
+    127, 17, 76, -37, 24, -127, 127, 121, 57, 72, 127, 117,
+    -62, 117, 53, 127, 127, 112, -78, 67, 44, -6, 96, -41,
+    34, 22, -45, -24, 37, 26, 127, 15, 55, -34, -116, -14,
+    48, 73, -56, -98, 40, 87, 62, -23, -16, -43, -54, -13,
+    -27, 26, 127, -42, 25, -105, -39, 127, 127, 55, -109, -19,
+    35, -127, 60, -9, -88, 37, 67, 14, 82, -92, 90, 66,
+    -127, 71, 16, -34, -94, -4, 5, 33, -8, -74, 105, 35,
+    -69, -42, 76, 25, 34, 31, -4, 59, 21, 67, -51, 83,
+    -47, 127, -27, -127, 69, 127, 42, -44, -71, 25, 61, -127,
+    -127, 54, -115, -127, -53, 79, 40, 55, 10, -97, -127, -83,
+    36, 72, 9, 19, -73, -88, 116, -93, 90, 58, -62, 32,
+    -127, 14, 78, 127, 93, 4, 62, 85, 114, -60, -11, 39,
+    57, 34, 11, 53, -91, -9, -127, 127, 127, -127, -21, 54,
+    24, 127, -33, -87, -39, -8, -52, -35, 66, 34, 43, 47,
+    97, -36, -84, -3, -22, -7, -68, -93, 7, 70, 119, -2,
+    -5, -64, -41, 77, -45, 26, -43, 30, 89, -84, 90, -127,
+    55, -10, 106, 125, 24, -57, 74, 64, 47, 75, 70, 32,
+    -36, 59, 60, 29, 74, 87, 12, 74, -13, -50, 20, -19,
+    -44, 58, 13, 60, 26, 17, 31, 45, 57, -20, 5, -47,
+    109, -23, -75, -60, 43, 42, -8, -123, 47, -62, -35, 26,
+    -95, 11, -15, -55, 127, -69, -94, 75, 74, 47, 0, 33,
+    36, -46, 28, 21, -88, -5, 55, 107, 58, -94, 42, 76,
+    -51, 57, 2, -38, -41, -13, 5, 44, 1, 48, 41, -28,
+    49, -14, 95, -16, 70, -52, -17, 42, 77, -10, -19, 37,
+    -119, 40, 82, -92, 76, 74, 87, -127, -60, 69, -76, -80,
+    -23, 19, -127, -88, -43, -18, 94, 44, 87, -19, -75, -21,
+    14, 101, 33, 54, -9, -1, 26, -87, 27, 44, -68, 56,
+    7, -79, 93, 75, -27, -87, 73, 45, 97, 28, 38, 23,
+    26, 48, -32, 69, -21, 3, -70, 82, 104, -91, -12, 53,
+    52, 75, -1, -99, -36, 49, -127, -90, 24, -96, -11, 39,
+    127, -127, -47, -75, -33, -103, -53, -60, -72, -24, 80, 127,
+    21, -127, -55, 39, -42, 59, -127, 127, 23, -47, -41, -125,
+    17, 127, 91, 116, 89, -112, -56, 65, 115, 15, 9, -127,
+    -92, 127, 83, 6, 80, 127, 35, 8, -127, -127, 18, -94,
+    -34, 66, -75, 127, 33, 74, 12, -5, 109, -32, -57, -24,
+    51, -25, -41, -97, 98, 37, -33, -25, 75, -35, -58, 122,
+    -127, -22, -11, -51, 122, -39, 58, 62, 110, -5, -89, 57,
+    -29, -2, 1, 30, -13, 87, -7, 127, 95, 0, 30, -124,
+    15, 105, 10, 31, -127, 27, 3, 14, 93, 39, 53, -127,
+    -46, -64, 62, -87, -6, -88, -67, 41, 7, 55, -83, 127,
+    -123, 49, -96, 3, 7, 71, 127, 2, 53, 15, -127, 69,
+    3, -127, -94, 29, -21, 92, 63, 83, 42, -31, 18, 86,
+    -88, 127, -29, 0, 17, -21, 93, -82, -50, 55, -127, -74,
+    -12, -95, -5, 42, 19, -127, 64, -95, -20, -13, 127, -1,
+    106, 57, -127, 58, -1, -104, -46, -50, 5, -10, -127, 34,
+};
+// functional_1/activation_5/Relu;functional_1/batch_normalization_5/FusedBatchNormV3;functional_1/depthwise_conv2d_2/depthwise;functional_1/depthwise_conv2d_2/BiasAdd;functional_1/conv2d_4/Conv2D;functional_1/depthwise_conv2d_2/BiasAdd/ReadVariableOp/resource
+alignas(16) const int32_t kTensor10Data[64] = {
+    -1333, -3619, -753, -1067, 2554, -120, 6201, 4230, -5422, -1668, -825, 3613,
+    -4071, -617, 3491, 4556, 1795, 4054, 5848, 2363, 5193, -2022, -4199, -371,
+    -4552, 6335, 2468, -3087, -1224, -3442, 5279, -2885, -2138, 5721, -3896, 7110,
+    -174, -1711, -2261, -4003, -2400, 5775, -3994, -4656, -1035, -1577, -3418, -559,
+    2939, -1270, -3062, -2249, -4745, -2934, -949, -2132, 2827, 4074, -1473, 1411,
+    -1383, 2562, 3340, -2837,
+};
+const int32_t kOp5Multiplier[64] = {
+    1175859562, 1325308050, 1807069200, 1420124271, 1188850090, 1182411826,
+    1831798253, 1649441596, 1897229520, 1960284024, 1088449917, 1672116795,
+    1343192385, 1487293887, 1672031270, 1674544455, 2061041943, 1951124498,
+    1660944822, 1092926841, 1362949302, 1686277765, 1889942367, 2094598643,
+    1884567220, 2137666356, 1554431692, 1602323645, 1300969388, 1742212516,
+    2087562224, 1697886333, 1743893709, 1139931211, 1408896915, 2007149259,
+    2008015774, 2115739605, 1364939324, 1669828999, 1224912049, 1117851976,
+    1283481598, 1789833187, 1167721435, 1534981936, 1382726870, 1907838383,
+    1372677674, 1120008250, 1414728578, 1400938390, 2122221780, 1317835141,
+    2026088264, 1627366011, 1688802527, 1657532372, 1082442094, 1658124163,
+    1837593306, 1539460112, 1223606748, 1717328997,
+};
+const int32_t kOp5Shift[64] = {
+    -6, -7, -7, -7, -7, -6, -8, -7, -8, -7, -6, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -8, -7,
+    -8, -8, -7, -7, -6, -7, -8, -7, -7, -7, -7, -8,
+    -7, -7, -7, -8, -7, -7, -7, -8, -7, -7, -7, -7,
+    -7, -6, -7, -6, -8, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -6, -7,
+};
+const cmsis_nn_dw_conv_params kOp5Params =
+    {128, -128, 1, {1, 1}, {1, 1}, {1, 1}, {-128, 127}};
+const cmsis_nn_per_channel_quant_params kOp5Quant = {
+    const_cast<int32_t*>(kOp5Multiplier), const_cast<int32_t*>(kOp5Shift)};
+const cmsis_nn_dims kOp5InputDims = {1, 25, 5, 64};
+const cmsis_nn_dims kOp5FilterDims = {1, 3, 3, 64};
+const cmsis_nn_dims kOp5BiasDims = {1, 1, 1, 64};
+const cmsis_nn_dims kOp5OutputDims = {1, 25, 5, 64};
+
+// Operator 6: CONV_2D
+// functional_1/conv2d_3/Conv2D
+alignas(16) const int8_t kTensor20Data[4096] = {
+    6, 25, 14, 49, -29, 38, -93, 15, -38, -78, 115, -14,
+    50, -127, -3, -74, 15, 2, -4, -5, 23, 19, 10, -76,
+    -11, 9, -29, -13, 76, 42, -9, -64, -43, -96, -48, -49,
+    79, 11, 64, 24, 12, 32, -41, 4, -36, 81, -11, 21,
+    -19, 52, -12, -73, 78, -71, -17, -39, 4, -59, -7, -31,
+    12, -97, 7, 40, 81, 18, -96, -105, -7, -17, 26, -38,
+    22, 26, 17, 25, 33, 82, 43, 71, -44, 15, -22, 12,
+    -127, 75, 58, -8, -20, 22, 10, -44, -36, -39, 46, 30,
+    -17, 39, 97, 56, 35, 102, 17, 15, -27, -47, -80, -43,
+    -19, -51, 36, 60, 75, 71, 18, 127, 122, 44, -59, -69,
+    11, -14, 87, -25, 47, 38, -54, 47, -8, -47, -41, -40,
+    62, -7, -101, -11, -67, -11, -5, -31, -44, -13, 97, 59,
+    4, 66, -17, 66, -26, 66, -61, -52, 42, 34, 127, 84,
+    83, 35, 101, 33, 64, -107, 44, -44, 59, -2, 41, -65,
+    13, 22, -44, -62, -53, 45, -25, 6, -57, 64, 24, -14,
+    0, 61, 29, -4, -71, 8, -83, 52, -21, -37, -67, -18,
+    88, -26, -20, 3, 61, 79, -40, -17, -16, -53, 43, -21,
+    31, -12, -1, -104, -35, -62, -37, 91, 15, -67, 90, 10,
+    25, 19, -41, 6, -60, 67, -51, -69, -31, -2, -48, 34,
+    29, 127, 53, 23, 8, -44, -9, 4, -46, 24, 68, -97,
+    -8, 15, 25, -22, -61, -59, 20, -25, -59, -45, 52, -2,
+    28, 6, -39, 2, 48, 45, 127, -12, -64, -66, 34, 31,
+    -53, 14, -20, 12, -22, 31, -30, -93, -39, 90, 7, 25,
+    -40, 23, 40, -51, -2, 0, -49, -45, -9, 43, -22, 53,
+    -42, 59, 31, 18, 39, 31, 13, -23, -10, -45, -92, -2,
+    60, -36, 10, -26, 14, -16, 61, 21, -66, -30, -37, -74,
+    23, -60, -62, -4, -90, 53, 53, 43, -73, -28, 67, 29,
+    -22, 50, -103, 13, -4, 25, -20, 59, -26, 34, -78, -39,
+    -32, -35, 40, 9, -70, -34, -62, 34, -30, -33, 28, 61,
+    -127, -23, 30, -23, 1, 4, -39, -68, -18, 65, -29, 50,
+    -59, 22, -85, 58, 41, -27, -14, 18, -16, 35, 111, 66,
+    38, -67, 46, 22, -34, -52, 41, 46, -91, 101, -52, 65,
+    51, 30, 76, -43, -25, 8, 12, 2, 48, -91, -14, -20,
+    -73, -6, 42, -29, -8, 48, -87, -19, 127, 43, 37, -81,
+    -6, 81, 28, 26, 20, -25, -40, 30, -49, -84, 0, -30,
+    -20, -4, -65, -17, -28, 44, -86, -61, 27, -41, 69, -9,
+    30, 45, -91, 6, 43, 18, 56, -25, -10, -59, -80, -11,
+    -59, 28, -84, 82, -21, 22, -84, 11, -46, 47, 60, -73,
+    -6, 73, -18, -51, 46, -63, -9, 61, 46, 91, 50, -57,
+    -30, -46, -127, 48, 40, -30, 4, -28, -12, -17, 8, -3,
+    29, 97, -76, -53, -61, 69, -27, -39, 57, -15, 19, -27,
+    -91, -34, -28, 29, 65, -12, -36, 2, 44, -49, -7, 16,
+    38, -61, -75, 79, -2, 26, 41, -66, 7, -75, 17, -10,
+    -51, 1, -7, -69, -35, 55, -5, -66, -47, 33, -4, -42,
+    31, -49, -23, 8, 10, 49, -48, 12, -19, -65, 41, -35,
+    -12, -2, -28, 13, -32, 59, -10, -14, -19, 4, -46, -15,
+    -47, -20, -27, -28, 17, -5, -32, -61, -63, 45, 41, -31,
+    34, -16, -23, 18, 127, 66, 28, 1, 9, 65, -43, 73,
+    -92, -37, -29, 68, -55, 28, -96, -62, 79, 20, 104, -64,
+    -73, 6, 5, -67, 2, 20, -117, -37, -40, 29, 85, 14,
+    -65, -48, -61, -20, -14, 83, 38, 38, 12, 48, -81, 56,
+    9, -45, -12, -52, 63, -79, -51, 60, -62, -19, 62, 6,
+    -7, 4, 55, -2, 103, -98, -37, 70, -107, -23, -79, -51,
+    -51, -7, 28, 127, -14, 5, 1, 108, -17, 85, -46, 91,
+    -27, -4, 2, 120, -31, -62, 127, -2, -75, -99, -53, 46,
+    34, 27, 58, -94, -89, -62, -57, -34, -15, 43, 67, -29,
+    -53, -88, -3, -87, -64, 36, 57, -47, 34, 58, 15, -55,
+    5, 63, 15, -10, -62, -29, -68, 14, 46, -26, -99, 18,
+    -99, 7, -22, -53, -68, -67, 12, -74, -24, 74, -35, -14,
+    42, -12, -4, 5, -7, 37, 35, 53, 72, 14, 25, -39,
+    52, 57, 127, 19, -65, 25, -99, -54, 18, -7, 22, -36,
+    125, 19, -11, -35, -62, 4, 28, -10, 44, 22, 18, -46,
+    69, 11, -1, -67, 44, -53, 24, -13, 47, -79, -125, 31,
+    7, 9, -45, -1, 17, -8, 108, 20, -22, -75, -24, -2,
+    -1, 47, 87, 1, -16, 32, -45, -74, 88, 32, 33, -60,
+    -13, -7, -13, -22, -38, 10, -31, -56, 16, 13, 38, -71,
+    -26, 12, 18, -69, -3, -66, -50, -43, -28, 9, -18, 37,
+    34, 55, 21, -23, 62, 23, -45, -36, 56, 28, -64, 20,
+    -71, 37, 55, -62, 6, 127, 72, 57, 53, 5, -37, -30,
+    43, 28, -34, 24, -66, 74, 18, -3, -38, 81, -77, 127,
+    -43, -80, 70, 57, 97, -66, -38, -57, 104, 7, -38, 49,
+    -82, 0, -32, -16, 17, -44, -43, -53, -19, -41, -22, 53,
+    -55, 107, 12, -90, 1, -1, 12, 39, -17, 8, -19, -37,
+    56, 10, 12, 26, 112, -104, 24, -43, 7, -51, 55, -26,
+    93, 56, -84, 12, 1, -91, 57, 19, 45, 52, 68, -22,
+    -8, 79, -3, 111, -60, -7, 12, 39, 63, -11, 8, -127,
+    -12, 66, 24, -52, 90, -37, 102, 11, 4, 47, -41, 108,
+    -56, -60, 48, 93, -51, 9, -40, -92, -16, -22, -56, 0,
+    13, 71, -90, 57, -77, -29, -76, -60, 39, 6, -4, 42,
+    -64, 2, -4, 32, 0, -43, -32, 59, 35, 20, -37, -37,
+    42, -52, -16, -31, 9, -2, 53, -4, 11, -7, -78, -21,
+    -7, 57, 64, 50, -38, 19, -21, 46, -16, -40, 10, -53,
+    -76, -44, 46, -56, 107, 31, -16, -16, -15, 74, 109, -70,
+    81, -45, -13, -54, 8, -61, -83, 77, -68, 28, -74, 63,
+    79, -6, 119, -108, -127, 70, -91, 83, -79, -51, -68, 55,
+    -72, 36, 15, -23, -26, -60, -77, 30, -22, -60, -62, -1,
+    43, 25, 38, -13, -10, -50, 35, 1, -55, -24, -20, 63,
+    -26, 83, 35, -52, -84, -10, -6, 66, -8, 26, 19, 101,
+    -38, -100, -30, -23, -14, 44, -46, -83, -52, -74, 127, -48,
+    14, 7, 54, 11, 11, 46, 105, -14, 83, 29, -38, 43,
+    -32, -116, -1, 92, 21, 104, -68, 80, 42, -24, -104, -12,
+    -12, -89, -90, 39, -38, 92, 1, 46, -91, -64, 63, 58,
+    10, -17, -70, 86, -111, 64, 8, 14, -56, -29, -78, -75,
+    6, 96, -90, -30, -82, 93, 62, -90, 43, -16, -41, -22,
+    36, 9, -66, -119, -96, 96, -93, -50, 12, 34, 57, 79,
+    -30, 25, 75, -65, 4, -5, -127, 0, 2, -3, 28, 55,
+    6, 28, -20, -56, 48, -21, -5, 19, -51, -26, -30, -37,
+    -20, -17, 22, -11, 35, -106, -36, -59, 102, -1, 27, -40,
+    -5, -67, -73, -110, -71, -60, 127, -32, 14, 66, 52, -36,
+    116, 6, -11, -107, -75, -56, 72, -102, -1, -69, -23, 58,
+    -7, 39, 100, -77, -35, -4, 7, -27, -32, 125, 45, 48,
+    -20, -1, 9, 58, -47, -107, -35, -115, -8, -44, -9, -1,
+    1, 77, -62, -30, -53, 46, 19, 58, 113, -72, -119, 11,
+    17, -79, -28, 19, -1, 44, -15, 78, -1, -86, 16, -111,
+    -46, -12, 1, -55, -35, 56, 1, 84, -1, 15, -23, -127,
+    120, 34, -33, -23, -69, 54, 12, 69, 39, 66, -63, -50,
+    6, 2, 96, 0, -31, 1, 71, 101, 29, -22, -44, 5,
+    13, -44, 53, 34, -51, 61, 58, 60, -69, 54, 24, -35,
+    -1, 22, 101, -51, 7, -51, -10, 75, -13, -17, -80, -94,
+    -36, 42, 35, -26, 13, -8, 4, -8, -54, -34, -57, 5,
+    50, -11, 12, -32, -58, -64, 49, -19, 27, -42, -3, -18,
+    32, -48, -127, -27, -20, 57, 3, -31, -2, 3, -25, 81,
+    -11, 91, -66, 38, 76, -58, -32, -39, -47, 7, 60, 55,
+    -69, 48, -33, 15, -27, -47, -41, -15, -127, 1, -31, -9,
+    -19, 24, -41, 18, -55, 72, -35, 72, -67, -8, -27, 30,
+    -51, 26, -28, 36, -16, 8, 27, 43, -57, 31, -30, -35,
+    28, 37, 62, -17, -97, -33, 34, 49, -27, 11, -29, -23,
+    51, 67, 8, 88, 64, -29, -8, 6, 18, 10, 43, -33,
+    -42, 34, -23, 25, 80, 68, -4, 6, -127, 5, -97, 19,
+    -22, -21, 60, -18, -67, 7, -18, 12, 26, -59, -71, -64,
+    42, 21, -2, -22, -23, 105, 11, -45, 9, 29, 0, -86,
+    -51, 69, -44, 3, 31, 36, 43, 4, 42, -7, 20, 1,
+    -38, -64, -12, 24, 42, 33, -61, -33, -124, -38, -51, 11,
+    38, -9, -37, 6, 45, 51, 17, -88, -75, 42, 21, 6,
+    -5, -10, -36, 0, 41, 120, 20, 79, -14, 79, -43, 4,
+    -3, 57, 3, 47, -12, 32, 66, -3, 1, 40, 25, 15,
+    79, 3, -64, 71, 99, 29, -10, 27, 93, 1, 119, -4,
+    127, -41, -6, -26, 53, 29, -36, 29, 16, 45, -34, 51,
+    7, -34, -15, -57, -1, 59, -44, -17, -37, -16, 51, 17,
+    -2, -86, -49, -5, -16, 40, -16, 52, -28, -50, 6, 38,
+    -43, 9, 14, 18, -57, -48, 58, 10, 23, -9, -22, 29,
+    -24, 42, 44, 69, 127, -9, 78, -82, -9, -17, 61, 55,
+    -2, -90, -87, 42, 68, -28, 66, -84, -15, -33, 23, 7,
+    -37, 54, 94, 60, -52, -23, 51, -81, 26, 6, -95, 86,
+    -6, 115, 7, -86, 125, 127, 22, -2, 34, -42, -24, 67,
+    13, 1, 72, -33, -12, 71, -2, -5, 30, 53, -3, 96,
+    104, -82, 40, 5, -41, 7, 99, 5, 10, 81, -66, -25,
+    35, 11, 120, 64, -25, 69, 67, 46, 108, 32, 62, 44,
+    39, -32, -97, 2, -5, 16, -50, 102, -44, -58, 96, -34,
+    -58, -25, 50, 35, 65, -126, 46, 59, -28, 19, -22, 12,
+    70, 31, 23, -38, -62, 48, 24, -100, 61, -98, -37, -21,
+    -38, -44, -11, 88, -103, -56, -74, 121, 23, -121, -70, 42,
+    -127, -83, 39, 44, 11, -115, -30, -38, 17, 17, -61, 52,
+    -17, -83, -2, -67, -75, 41, 29, 2, -22, -52, -55, 30,
+    85, 45, -46, -110, -21, 38, -55, -91, 54, -24, -92, -51,
+    -27, 119, -71, -69, -51, 123, 48, 11, 16, 61, -77, 57,
+    -127, -57, 118, 50, 28, 93, -70, 13, -44, -60, 24, 39,
+    40, -104, -56, 21, -42, 33, -46, 5, 58, -48, -28, -19,
+    -109, 55, 47, 87, -74, 119, -46, 71, 46, -109, -2, -10,
+    -40, -5, 20, 51, 1, -53, -47, 9, -27, -16, -7, -2,
+    -1, -43, -49, -53, -5, 40, 38, -10, -44, -26, -31, 69,
+    36, -52, 20, 16, -63, -34, 39, 26, 0, 127, 42, 76,
+    -50, -19, -2, -65, 5, 81, -58, 47, 19, -5, -122, 8,
+    -2, 34, 1, 49, 61, 60, -84, 33, -19, -28, -72, -79,
+    -96, -2, -32, 4, 2, 43, -38, 11, -23, -52, 48, -61,
+    4, -35, -60, 58, 31, 58, -103, -39, -7, -37, 51, 53,
+    29, -10, -43, -6, 0, -63, 67, -13, -28, 24, -21, 95,
+    18, -127, -38, -47, 37, 24, -126, -50, 11, -7, -6, -28,
+    52, 83, -13, -36, -26, 66, -64, -22, 5, 90, -31, -6,
+    121, 27, -12, 33, 74, 22, 30, -13, 18, 12, 52, -13,
+    15, -5, -10, -42, 24, -53, 74, 35, 127, -30, -28, 71,
+    -59, 16, -74, 42, 14, 122, -6, -56, -46, -3, 100, -22,
+    -53, 61, 29, -76, -51, 7, -68, -48, -16, -67, -25, -104,
+    38, -59, 111, 15, -43, -51, -42, -77, 98, -116, 67, -95,
+    50, -95, -67, 88, -50, 67, 60, -12, 12, -51, -95, -8,
+    -22, 59, 14, 7, -1, 25, 20, -13, -20, 55, -6, -50,
+    3, -82, 36, 2, 79, 21, 46, -10, -45, -35, -30, 14,
+    -6, -55, 18, -3, -9, 23, -13, 29, 8, 71, 10, 1,
+    20, 19, -48, 23, -9, 79, 26, -38, 6, -26, 127, -24,
+    -4, -16, 35, -16, -11, -57, 49, -6, -1, 108, 36, 17,
+    2, -38, -1, 44, -18, 7, 5, 47, 67, -84, 24, -42,
+    3, -12, 95, -40, 44, 12, 26, -31, 90, -70, -5, -73,
+    -11, -4, -44, 4, 7, -53, 65, 82, -22, -85, 15, 80,
+    34, 46, 99, -73, -32, -42, 32, -24, -89, 82, 2, -32,
+    -127, -10, -110, -95, -81, -58, 81, -29, 16, -4, -17, -58,
+    -85, -95, 64, 81, -66, 38, -64, 78, 18, -48, 54, -116,
+    2, -66, 108, 42, 125, 47, -79, 70, 38, 29, -62, 18,
+    -2, -15, 20, -57, 32, 42, 64, -92, -45, 42, 83, -13,
+    5, 3, 66, -28, -39, -60, -92, -30, 28, -5, -84, 40,
+    52, -81, 101, -70, 75, -13, -61, 18, 104, 46, -100, -77,
+    -1, 40, -75, -64, 32, -13, 36, 82, 63, 18, 105, -127,
+    45, -31, -83, -78, 86, -46, 24, -41, 17, -87, 59, -6,
+    -34, -87, -31, -30, -28, -42, 13, 70, -17, -11, 56, -23,
+    -53, 17, 127, -87, 9, 43, -78, 40, 59, -110, -34, 5,
+    -7, -24, -28, -4, -34, -23, 56, 67, 33, -109, -42, -18,
+    -50, -37, -30, 28, -46, -72, 82, -48, 12, 8, 68, 0,
+    -4, 47, 0, -36, 59, -16, -30, -34, 39, 16, -43, -44,
+    20, 61, 8, -18, -95, 6, 127, 18, -36, 1, 26, -2,
+    -24, 0, 42, 29, 65, -93, -104, 65, 94, -35, -7, -8,
+    44, -87, 62, -40, 14, 43, -20, 71, -43, 17, 23, 10,
+    -92, -23, 14, 80, -33, -49, -37, -67, -109, 12, -16, -90,
+    -64, -58, 51, -11, -27, 67, 54, -36, -46, 2, -81, -31,
+    -99, 9, 66, 36, -33, 103, -52, 38, 33, -8, -96, -5,
+    67, -26, 21, -95, 55, -69, 87, -18, 53, 43, 9, -34,
+    20, 101, 116, -3, -106, 76, -74, -26, 0, -26, -18, 5,
+    -20, 56, 73, -33, 9, 120, 47, -8, -78, -73, -22, 33,
+    -35, 18, -65, 30, -69, 93, -40, 76, 28, 1, -127, -50,
+    4, -79, 95, 42, 28, 78, 24, -45, 0, 67, -1, -93,
+    9, 53, -63, -24, 50, -62, -24, -48, -11, 94, 74, -104,
+    127, 7, -27, 41, -96, 1, -3, 90, 90, -19, -44, -48,
+    38, 9, 23, -86, -11, 9, 0, 22, -23, -8, 11, -107,
+    -30, -33, 34, 27, 62, 40, -70, 20, 52, -25, 63, -43,
+    -20, 1, 85, -75, 53, 48, 52, 53, 41, 32, 11, -16,
+    -97, 71, -44, -9, 29, -81, 1, 3, 80, -74, -1, 81,
+    -31, 43, 127, -43, 97, -19, -6, -88, -54, 9, 22, 66,
+    37, -8, 33, -35, 25, -8, -46, 55, 51, -35, 45, -76,
+    11, 15, -35, 43, 34, -38, 38, 11, 15, 4, -36, -29,
+    -88, -13, 11, -13, 26, 102, 51, 18, 1, -61, -66, -65,
+    -42, 51, -90, 0, 1, -55, -70, 106, -127, 16, -12, -70,
+    -63, -85, -23, 75, 37, 50, 3, 71, 13, -49, 44, 48,
+    9, -37, 35, 12, 21, 45, -39, -44, 32, -28, -79, -30,
+    -85, -71, 20, 36, -6, -37, -32, -71, -43, 8, -35, 11,
+    -22, 39, 37, -100, 8, 38, -31, -25, -4, -23, -62, -29,
+    -35, -22, -56, -47, 45, 4, -65, 127, 41, 49, 19, 26,
+    1, 37, -29, -44, 8, 13, 14, -18, -19, 25, -11, -49,
+    98, -51, -21, 5, 71, 0, 33, -95, -6, -50, 76, -72,
+    23, 53, -61, -94, -17, 49, -66, -44, -3, 4, -7, -29,
+    44, -6, -121, 33, -3, -69, -38, -41, -90, -22, 30, 20,
+    -62, 111, 60, 85, 64, 87, 78, -11, -47, -73, -62, -4,
+    75, 0, -18, 58, 25, 20, -21, 102, -36, -20, -59, -60,
+    58, 12, 62, 4, -71, -46, 2, 30, 13, 31, -33, -56,
+    -11, -10, -10, -8, -21, -44, -97, 37, 21, -25, -66, -66,
+    -11, -97, -41, -29, 78, -64, -56, 48, 37, 3, 1, 77,
+    29, -127, 1, -84, 80, -69, 19, -46, 79, 5, 8, -3,
+    -37, 0, -5, 32, -21, 54, -62, -55, 13, -43, -9, -42,
+    -5, -8, -44, -9, -7, 19, 4, 16, -17, 89, 10, 14,
+    -85, 16, 29, 51, 13, 65, 21, -74, -28, 3, 3, 6,
+    -71, 46, 67, 4, -15, 50, 15, -52, -56, 55, -56, 14,
+    -55, 127, 57, -49, -21, 48, -22, 77, -57, -89, 18, 29,
+    11, 42, 64, 22, -63, 13, 25, -89, 1, -10, 4, 72,
+    11, -20, -25, -50, 39, -92, -48, -19, 85, -1, -2, -68,
+    -66, -25, -43, -14, 2, -113, -18, 21, 81, -50, 2, 39,
+    -105, -49, -28, 42, 90, -8, -29, -40, 33, -15, -53, -3,
+    40, 51, -29, -67, 83, 127, 36, -21, -21, -72, -79, -44,
+    -6, 83, 52, 14, 46, -45, 14, 111, -14, -15, -14, -7,
+    -8, 48, -48, -50, 33, -45, -25, -37, 38, -15, 76, -17,
+    -30, -24, -8, -126, 9, -40, 46, -47, -102, 0, 9, 3,
+    -40, 80, -46, -49, -41, 9, 127, -85, 21, 8, -30, 34,
+    -44, -56, -25, 38, 41, -56, -44, 3, 7, -7, 1, 60,
+    7, -46, 96, 17, 10, 57, 14, -44, -12, 71, -29, 47,
+    41, -90, 23, -15, 83, -100, 80, 6, 82, 7, 67, -29,
+    62, -69, 20, -1, 41, -18, 74, 78, 67, 31, 5, 2,
+    43, -26, -66, 27, 60, -37, -33, 14, 127, -96, -14, -40,
+    11, -13, 14, -21, 15, 19, -4, -75, -26, 15, 21, 24,
+    -46, 53, -37, -4, 27, -35, -6, 8, -32, -17, -61, -6,
+    -3, 25, 85, 15, 0, -49, 39, 38, -112, -36, -23, -55,
+    17, 71, -53, -8, 13, -27, 44, -48, 48, 36, 40, -1,
+    9, 74, 11, -21, -73, 5, 83, -8, -45, -17, -25, 44,
+    -13, -3, -18, -82, -31, -51, -56, -9, -55, -2, -13, 50,
+    22, -50, -18, -55, -106, 59, 33, -21, 29, -28, 47, 14,
+    -35, 8, -32, 58, -127, 80, -66, 19, 13, 46, -68, 70,
+    57, -20, 46, 41, -15, 1, 35, 17, -75, 29, 46, -25,
+    61, -12, -40, -23, 10, -20, -61, 7, 6, -39, -113, 8,
+    31, 34, 59, -19, -73, -70, -19, -58, 31, -31, -42, -44,
+    -98, 2, -60, -58, 101, 56, 15, 7, 49, 15, 42, 3,
+    -127, -15, -89, 43, -18, -1, 31, 5, 68, 16, 33, -27,
+    91, 41, -26, -67, -42, -48, -28, -50, -70, -72, 20, 44,
+    -33, -17, -96, -67, -62, -41, -26, 70, 4, -102, -58, -87,
+    -104, 23, 127, 34, -68, 12, -41, 47, -55, -68, 37, 41,
+    -58, -66, 75, 68, -100, -1, 42, 25, -87, 19, -54, 9,
+    -13, -8, 50, 38, 18, -19, 125, -6, -50, -78, -65, 39,
+    57, 75, -27, -122, 76, -28, 72, -65, -62, 74, 43, 4,
+    41, 37, -127, -72, -74, 3, 35, 33, -101, 2, -46, -27,
+    -18, 28, 10, -69, -77, -17, 2, -14, -38, -53, 42, -60,
+    2, -1, 12, -51, -87, 91, 81, 20, 49, -2, 2, -71,
+    12, 50, -58, -1, -44, -10, 64, 65, 11, 3, -4, 52,
+    -40, -33, 4, -87, -18, -3, -18, 5, 45, -78, 20, -17,
+    -45, -21, -16, -54, -25, -41, -38, -36, 16, 14, 10, 24,
+    39, -32, -13, 26, 53, 53, 44, -52, -25, -4, 12, -17,
+    -65, -16, 2, -4, -16, 0, -46, 19, 73, -3, 31, 2,
+    33, 47, 20, -33, -12, 22, 16, -15, -41, -44, -46, -55,
+    -34, -50, 64, -70, -3, 0, 0, -60, 127, 23, -21, -63,
+    65, -61, -103, -67, -18, 11, -40, -1, -57, 42, 26, 49,
+    -51, -63, -22, 55, 78, 13, -53, 108, 102, -59, -24, 11,
+    -15, 2, -36, 55, -53, 16, -40, -38, -81, -8, -2, -3,
+    -67, 97, -19, 17, 88, -64, 47, -85, -111, 127, 27, -113,
+    9, 2, -50, 2, 82, -90, -17, 45, -33, -79, -15, -20,
+    73, 56, 51, -100, 6, 38, 87, 9, -15, -109, 91, 15,
+    -86, 42, 91, -23, -48, -6, -15, -43, -35, -111, 61, -64,
+    0, -82, 93, -73, 52, -36, 49, -21, -38, 71, 63, 28,
+    -35, 50, 59, -60, -34, -46, 7, -43, -70, -35, -127, 61,
+    59, 94, -32, -75, -21, 12, 105, 17, 71, -6, 118, 58,
+    40, -24, 56, -27, -69, 12, -26, 58, -1, -6, 102, -27,
+    8, 73, 2, 22, -96, 67, -2, -11, 26, -32, 14, 34,
+    -6, -3, -65, 30, 94, 12, 4, -63, -64, 40, 43, 86,
+    -7, -35, 18, 92, -66, 17, 0, 17, 23, 40, 52, -33,
+    -17, 127, -21, -66, -7, -53, -92, -48, 59, 7, 9, 65,
+    13, -74, 14, -18, -34, 36, 90, -22, -78, -63, 19, 29,
+    -12, -70, 74, -64, 13, -54, 87, 38, 53, -39, -40, -1,
+    52, 36, 9, -36, -57, 20, 5, 18, 1, 54, -17, -8,
+    -41, -85, 47, 13, 19, -10, -29, 18, 10, -105, 86, 106,
+    47, -1, 85, -45, -100, 11, 30, 25, 2, 19, -57, -61,
+    -99, -72, -80, -26, -92, 53, 52, 42, -6, -127, 0, 120,
+    28, 57, -22, -60, -49, -35, -61, 22, 15, -24, -18, 60,
+    -8, 97, -54, -50, 2, -2, 15, 0, -91, 50, -77, -4,
+    -39, -54, -121, -53, -10, -1, -73, -84, 83, -117, 64, 93,
+    -32, 73, -27, 54, 53, -4, -64, -16, -17, -64, 21, 18,
+    39, 9, -80, 23, -78, 103, 32, 6, 50, 6, -40, 127,
+    92, -49, -97, 42, 58, 54, 9, 46, 26, -102, -30, -7,
+    51, -80, 12, 51, -104, 56, -26, 62, -25, -25, 107, 7,
+    -60, -89, 40, 44, 38, 16, -8, 33, -23, 67, 91, 38,
+    -18, 66, 32, 28, -63, -96, 73, 20, -28, -58, -46, -11,
+    -13, -21, 69, -120, -18, 7, 43, 21, -59, -55, -15, 10,
+    -71, 24, -62, -72, -70, -28, -65, 97, -7, 12, -67, -127,
+    42, 11, 83, -48, -48, 28, 44, -33, 31, -36, -40, 110,
+    -60, 2, -100, 46, -38, 15, -15, 1, 12, 48, 10, 13,
+    32, -47, -52, 10, -46, -67, 4, 127, 35, -26, 20, -72,
+    -23, -56, -87, 7, -104, -9, -26, 60, -18, 54, -19, 11,
+    -37, 37, -32, -7, 22, -78, 50, -118, 48, -69, -10, -35,
+    -30, 93, -104, 16, -30, -56, -127, -124, 71, -123, 34, 3,
+    69, -38, 3, -3, 25, -31, -29, 75, -20, -73, -4, 61,
+    -2, 71, 33, 43, 33, -27, 76, -21, -16, 38, 1, -21,
+    -58, 3, 52, 10, -3, -37, -14, -34, 34, -12, -77, 71,
+    30, -35, 58, 72, 30, 25, -12, -27, -17, -11, -20, 57,
+    -68, 87, -13, -20, -58, -77, 36, -17, -38, -58, 39, -7,
+    72, 58, -70, -21, 37, -3, 68, -62, 127, -18, 24, 43,
+    -7, 28, -2, 25, -18, 49, 0, 8, -29, 13, 13, 18,
+    7, -37, -7, -70, -1, -9, -74, -43, -80, 2, 30, -18,
+    -3, 89, 29, 9, 24, -10, -39, 6, 7, 60, 28, -57,
+    34, 46, 45, -14, 45, 18, 31, -29, 45, 40, 32, 93,
+    -48, 41, 56, 69, 19, 11, 19, 100, 58, -9, -6, 40,
+    -102, 8, 55, -29, 13, -41, -82, 39, 17, 27, 43, -106,
+    -50, -20, -19, 24, -33, -71, -15, 1, -38, -9, -23, -84,
+    47, -56, 11, -31, -58, 26, -43, -64, 57, 43, 55, -62,
+    18, 4, -54, -19, 29, -40, -36, 17, 2, 17, -75, -33,
+    8, -127, 28, -73, -100, 8, 16, 109, 24, 104, -25, -6,
+    -27, -56, 51, 59, 117, 39, -69, -104, 14, -62, 20, 80,
+    -61, -51, -29, -25, 18, -72, 29, 46, -70, 25, -41, -7,
+    -28, -1, 11, -96, 40, 22, -27, -83, -28, 10, -8, -65,
+    -46, 28, -20, 25, 49, -53, 24, 11, -28, -61, 114, -127,
+    32, 22, -13, -24, 64, -47, -4, 0, -79, 18, -3, -45,
+    51, -23, -65, -66, 14, -39, 41, 5, 39, -34, 70, 54,
+    -78, 34, 25, 37, -70, 28, -72, -39, 8, 127, 18, -105,
+    -43, -51, -9, -79, -14, -62, -24, 63, -65, -91, 82, -34,
+    29, -20, 30, 14, -4, 51, -18, 111, 17, -96, -21, 42,
+    85, 46, 28, -98, -10, -9, -122, -42, -74, 23, -28, -25,
+    -22, -39, 49, 31, 56, 22, -127, 43, 35, 42, -43, -68,
+    -51, -40, 8, 75, -71, 4, -44, 30, -27, -25, 40, -73,
+    -63, 103, 22, 26, -44, -27, 68, -17, 62, -62, -30, -43,
+    -42, 38, -66, -88, -40, -17, -67, 36, -70, -22, -56, 37,
+    16, -99, 22, -65, -4, 27, -68, 89, -90, -30, 4, 59,
+    47, 83, -20, 89,
+};
+// functional_1/activation_6/Relu;functional_1/batch_normalization_6/FusedBatchNormV3;functional_1/conv2d_3/BiasAdd/ReadVariableOp/resource;functional_1/conv2d_3/BiasAdd;functional_1/conv2d_4/Conv2D;functional_1/conv2d_3/Conv2D
+alignas(16) const int32_t kTensor12Data[64] = {
+    3639, -3131, -1337, 2763, 1672, 1445, 1668, 1549, -435, 8597, 5303, -1506,
+    -1637, 1279, -2588, 2357, 542, 6815, 1865, -338, 2617, 2286, 2156, -9234,
+    -2142, -9524, 7769, 2814, 2861, -1713, 1179, -2731, 5008, -673, 1334, 2438,
+    -2285, -3961, -3400, 6974, -2340, 3669, -997, 2847, 3170, -3044, 495, 1406,
+    4721, 4375, 1136, 3746, -1267, -3157, 708, -749, 3354, 4271, 1923, -5101,
+    5839, 2871, 206, 1832,
+};
+const int32_t kOp6Multiplier[64] = {
+    1297315277, 1468492804, 1365389636, 1663912971, 1704283098, 1164680631,
+    1425183295, 1308370971, 1174422468, 1814191572, 1255544155, 1354838867,
+    1430538958, 1276332331, 1133893032, 1279299779, 2043925795, 1886366899,
+    1696393543, 2119679879, 1109649323, 1439202161, 1530326033, 1780452920,
+    1474144276, 1348916801, 2127510807, 2145988373, 1426113936, 1541155860,
+    2080786304, 1606089206, 1100905575, 1121256541, 2035983137, 1855576717,
+    1170383424, 2131232836, 1324947161, 1291685634, 1182123667, 1225577160,
+    1186540670, 1241111246, 1696464823, 1385422073, 1916933799, 1455092911,
+    1708877586, 1446115277, 1186109251, 1075221221, 1187914401, 1355229746,
+    1352046499, 1192666862, 1950388404, 1528773212, 1278521587, 1628880777,
+    1189265768, 1137548772, 1693155501, 1237104188,
+};
+const int32_t kOp6Shift[64] = {
+    -7, -8, -7, -7, -7, -7, -7, -7, -7, -8, -7, -7,
+    -7, -7, -7, -7, -8, -8, -8, -8, -7, -7, -7, -8,
+    -7, -8, -8, -8, -7, -7, -8, -7, -7, -7, -8, -8,
+    -7, -8, -7, -7, -7, -7, -7, -7, -7, -7, -8, -7,
+    -8, -7, -7, -7, -7, -7, -7, -7, -8, -7, -7, -7,
+    -7, -7, -8, -7,
+};
+const cmsis_nn_conv_params kOp6Params =
+    {128, -128, {1, 1}, {0, 0}, {1, 1}, {-128, 127}};
+const cmsis_nn_per_channel_quant_params kOp6Quant = {
+    const_cast<int32_t*>(kOp6Multiplier), const_cast<int32_t*>(kOp6Shift)};
+const cmsis_nn_dims kOp6InputDims = {1, 25, 5, 64};
+const cmsis_nn_dims kOp6FilterDims = {1, 1, 1, 64};
+const cmsis_nn_dims kOp6BiasDims = {1, 1, 1, 64};
+const cmsis_nn_dims kOp6OutputDims = {1, 25, 5, 64};
+
+// Operator 7: DEPTHWISE_CONV_2D
+// functional_1/batch_normalization_7/FusedBatchNormV3;functional_1/depthwise_conv2d_3/depthwise;functional_1/depthwise_conv2d_3/BiasAdd;functional_1/conv2d_4/Conv2D;functional_1/depthwise_conv2d_3/BiasAdd/ReadVariableOp/resource
+alignas(16) const int8_t kTensor14Data[576] = {
+    102, 127, 118, -120, -107, -127, 99, -127, 127, -52, 57, -31,
+    -110, -121, -41, -108, -77, -127, -110, -104, -60, -37, 93, -85,
+    49, -127, -40, -105, 50, 110, 57, -45, -42, -54, 124, 68,
+    103, 94, 104, 63, -77, -127, -102, -103, -112, 53, 127, -1,
+    105, 127, -45, -97, 76, 58, 91, 127, 87, -65, -69, -127,
+    -100, -115, 119, 119, 107, 44, 63, -127, -106, -71, 100, -98,
+    32, -108, 84, -60, -127, -115, -127, -127, -55, -85, -50, 45,
+    -16, -63, 64, -127, 41, -86, -98, -65, -127, -27, 75, -103,
+    -45, -127, 91, 31, 106, 124, 102, 81, -82, 95, -22, -104,
+    -127, 114, 84, -75, 122, 122, 127, -84, 127, -9, 77, 88,
+    77, -106, -69, -124, -97, 85, 116, 127, 127, 24, 123, 10,
+    -127, 61, 69, -68, -61, -68, 95, -82, -68, -110, 41, -93,
+    -127, -113, -80, 86, -91, -13, 49, -76, 31, -127, -127, -74,
+    79, -127, 127, -5, -15, -38, 67, -14, 127, 110, 80, 89,
+    -64, -73, -127, -45, -75, 127, 113, -35, 127, 81, -40, -64,
+    120, -64, 101, -37, 96, -36, -127, -51, -34, 35, 127, 72,
+    10, 95, 29, -75, -47, -5, 3, -77, 25, -50, 8, -59,
+    24, -59, -84, -15, 2, -43, -49, -127, -63, -78, 74, 38,
+    -32, -36, -47, -23, 20, 18, 16, -54, -46, 2, 30, 87,
+    16, 8, 16, 47, -29, -44, -39, 16, -57, 21, 33, 17,
+    22, 33, -9, -38, -8, 31, -47, 25, 16, -35, -18, 14,
+    14, -127, -3, 30, 11, 39, 15, -68, -14, -36, -11, -67,
+    -9, -59, 0, -66, -14, -42, -67, -17, 21, -39, -81, -21,
+    9, -42, 39, 17, -59, 53, -46, -10, -88, -24, -8, -54,
+    -55, 21, 31, -47, -6, -34, 20, 80, -26, 29, -23, 9,
+    -43, 12, 18, -67, 15, 35, 18, -57, -16, -38, -37, 27,
+    -10, -37, -14, 46, -2, 25, 8, 22, -42, 109, 13, 49,
+    -44, 29, -15, -25, -63, -15, 9, -42, -17, -72, 85, 5,
+    -10, -11, -66, 40, -92, -35, 40, -59, -37, 20, -38, -16,
+    53, -116, -19, 37, -17, -4, -127, -74, 23, -4, 47, 79,
+    -103, -45, -31, 39, -25, 10, 22, -52, -15, 21, -24, -45,
+    -26, -34, -47, -54, 3, -28, 2, 12, -34, 55, -18, 23,
+    71, 92, 116, -94, -70, -64, 127, -73, 117, -127, 86, -126,
+    -59, -127, -111, -85, -86, -76, -51, -35, -126, -127, 127, -111,
+    -84, -99, -101, -55, 68, 66, 116, -127, -95, -57, 58, 127,
+    107, 127, 80, 90, -118, -59, -116, -105, -112, 53, 106, 24,
+    104, 60, -11, -103, 74, 48, 127, 8, 98, -127, -121, -97,
+    -52, 13, 108, 96, 47, 103, 81, -125, -79, -118, 96, -98,
+    34, -103, 97, -127, -85, -90, 86, -111, -82, -77, -116, 29,
+    -85, -73, 123, -64, -126, -38, -97, -88, -91, -16, 77, -80,
+    -127, -77, 46, 17, 95, 118, 102, 100, -127, 70, -2, -109,
+    -70, 115, 76, -63, 114, 99, 100, -127, 54, -37, 104, 53,
+    127, -105, -105, -93, -123, 107, 104, 107, 14, 47, 127, -7,
+    -69, 46, 62, -15, -49, -43, 127, -110, -90, -31, 126, -127,
+    -95, -45, -127, 64, -127, -73, 114, 34, -127, -118, -80, -127,
+    72, -115, 106, 2, -122, -23, 23, -113, 111, 52, 127, 127,
+    -119, -46, -76, -127, -45, 83, 102, -127, 125, 103, -69, -70,
+    76, -127, 79, -67, 84, -6, -110, -68, -127, 110, 101, 59,
+};
+// functional_1/activation_7/Relu;functional_1/batch_normalization_7/FusedBatchNormV3;functional_1/depthwise_conv2d_3/depthwise;functional_1/depthwise_conv2d_3/BiasAdd;functional_1/conv2d_4/Conv2D;functional_1/depthwise_conv2d_3/BiasAdd/ReadVariableOp/resource
+alignas(16) const int32_t kTensor13Data[64] = {
+    -2492, -8434, -4092, 6676, 7389, 2053, -3084, 7358, -1247, 8845, -2530, 7362,
+    5024, 9570, -289, 7954, 6420, 6368, 5273, 94, 4397, 5913, -7233, 3552,
+    2937, 4887, 6631, 6875, -748, 2192, -2347, 5024, 6292, 3686, -2350, -890,
+    -3736, -3442, -3349, -6784, 6222, 106, 5129, 6863, 6943, -3998, -1525, 2892,
+    -2389, -4506, -1055, 8403, -3350, 951, -3446, -1376, -4756, 5490, 7559, 6331,
+    5207, -1963, -1266, -2868,
+};
+const int32_t kOp7Multiplier[64] = {
+    1245499324, 2021708468, 1876208089, 1325188464, 1598729909, 1605918323,
+    1305633077, 2141131275, 1171759477, 1746719341, 2003695361, 1574723363,
+    2145427927, 1725225812, 1519686186, 2016259725, 2117951231, 1124575500,
+    2046616471, 1801639759, 1159154122, 1672063802, 1338164997, 1080975729,
+    1410880862, 1767309430, 1301111827, 1584185150, 1663224188, 1218672369,
+    1749809845, 1710495465, 1336342172, 1390854296, 1811826604, 1380530602,
+    1173781765, 2037710910, 1884565532, 2052846670, 1190845216, 1539715364,
+    1885930421, 1141038130, 1777548167, 1752818546, 1174930344, 1578116035,
+    1720287347, 1685584038, 1390238789, 1109472714, 1998071659, 1101556990,
+    1664121682, 1205680881, 1512822462, 1214391303, 1217392797, 1078342080,
+    1466779135, 1254490022, 1179852051, 1515358182,
+};
+const int32_t kOp7Shift[64] = {
+    -7, -9, -8, -8, -8, -7, -7, -8, -6, -8, -7, -8,
+    -8, -8, -7, -8, -8, -7, -8, -7, -7, -8, -8, -7,
+    -7, -8, -7, -8, -7, -7, -7, -8, -7, -7, -7, -7,
+    -7, -8, -7, -8, -7, -7, -8, -7, -8, -8, -6, -7,
+    -7, -8, -6, -7, -8, -6, -7, -6, -7, -7, -7, -7,
+    -7, -7, -6, -7,
+};
+const cmsis_nn_dw_conv_params kOp7Params =
+    {128, -128, 1, {1, 1}, {1, 1}, {1, 1}, {-128, 127}};
+const cmsis_nn_per_channel_quant_params kOp7Quant = {
+    const_cast<int32_t*>(kOp7Multiplier), const_cast<int32_t*>(kOp7Shift)};
+const cmsis_nn_dims kOp7InputDims = {1, 25, 5, 64};
+const cmsis_nn_dims kOp7FilterDims = {1, 3, 3, 64};
+const cmsis_nn_dims kOp7BiasDims = {1, 1, 1, 64};
+const cmsis_nn_dims kOp7OutputDims = {1, 25, 5, 64};
+
+// Operator 8: CONV_2D
+// functional_1/conv2d_4/Conv2D
+alignas(16) const int8_t kTensor21Data[4096] = {
+    80, -27, -1, 36, -87, -21, 101, 57, -37, 94, 36, -1,
+    -18, 20, -16, 10, -41, 5, 26, -38, -1, 82, -21, -6,
+    2, -14, -41, -37, 32, 14, 82, 13, 36, -69, -73, -14,
+    -42, -22, 1, 15, -18, 26, 8, -18, 71, 8, -61, 64,
+    2, 17, 10, 46, 18, 11, 127, -22, -27, -44, -26, 50,
+    -97, 9, -46, -38, 2, -25, -72, -31, -10, 61, -33, 24,
+    20, -23, 127, 7, 26, -1, 16, 34, -103, -19, -32, 32,
+    -2, 19, 48, -53, -44, 10, -53, 68, 55, 39, -37, -90,
+    1, -8, -54, -35, -59, -28, -27, 16, -31, 58, -40, 51,
+    11, -42, -36, 13, -7, 100, -17, -11, 43, 59, -27, -18,
+    61, 40, 27, -28, -14, 20, 43, -6, 52, -67, 83, 112,
+    19, -31, 111, 59, 24, 35, -64, -52, 53, 91, -16, -79,
+    -5, 103, 48, -33, 24, 90, -62, -46, 50, -19, -121, -87,
+    5, -33, 121, 127, -17, 4, -5, 16, -60, -3, 90, -56,
+    50, 13, 79, -70, -87, -30, 21, 107, -17, 11, -15, 72,
+    4, -6, 15, -62, 44, -44, -127, 29, -29, -32, -47, 54,
+    -88, -13, 85, -5, 92, 43, -33, 34, 105, -19, -35, 13,
+    -58, -70, -11, -4, -72, -38, -25, 23, -10, 1, -26, -51,
+    -14, -42, 36, 58, -68, 5, -22, -11, 32, -31, 11, 12,
+    24, -13, 11, 21, 51, -22, 12, -59, -18, -28, 127, 1,
+    -16, -3, -17, -10, 40, 27, -40, -4, -39, 13, 73, -18,
+    2, 37, -9, 41, 82, -10, -26, -53, 6, -11, 7, -17,
+    -35, -5, 1, 29, -127, -4, 1, -23, -33, 47, -76, 22,
+    70, 56, 54, 23, 9, -16, 15, 40, 14, 24, -44, 22,
+    -19, -30, -5, -37, -84, -65, -54, 5, -126, 20, -86, 72,
+    -22, 1, -49, -23, -1, 59, 56, -30, -59, -32, 94, 16,
+    -70, 38, -50, -101, 69, -31, 9, 40, -75, -3, 42, -16,
+    -29, 55, -44, 67, 11, -47, -6, 52, 5, -77, 79, -31,
+    -56, -99, -16, 19, -29, -57, 11, -8, -27, 0, -3, -7,
+    -35, -15, -30, -14, 11, 18, 5, -36, -26, 15, -17, -8,
+    29, -13, -19, 17, -53, -10, 50, -22, 127, -18, 71, -69,
+    -32, 15, 12, 58, -57, 20, 35, 28, 94, 28, 7, -9,
+    -43, -2, -73, 18, -91, 28, 113, 23, 44, 7, -20, 18,
+    -68, -55, 85, -39, -49, -41, -5, -46, 20, -48, -49, -91,
+    -15, -47, 83, 2, -49, -60, 48, -32, 81, 0, -1, 19,
+    -38, 6, -15, 79, -13, 0, 69, 27, 54, 54, 42, 117,
+    127, 29, 12, -8, 28, -4, 121, 11, -117, -71, 41, 108,
+    -28, 74, -53, -69, 22, -38, -61, -8, 127, 33, -13, -18,
+    8, -101, -52, 66, -66, 84, 6, -20, -59, -12, -38, 34,
+    4, 27, 61, -54, -1, 23, 53, 51, -24, 5, -3, 8,
+    -20, 36, 61, 1, -75, -28, -28, -28, 12, 36, 48, -23,
+    -43, 50, 31, -11, -55, 74, -31, -65, 8, -8, -44, -25,
+    13, 120, 10, -119, 59, -31, 18, 59, 127, -64, 96, -6,
+    -42, -48, -2, 46, -19, 113, 74, 24, -40, 10, 2, 42,
+    -1, -9, -44, 14, 33, 46, 21, -43, 34, -9, -10, 56,
+    7, 67, 36, -14, 49, -13, -49, -17, -17, -109, 32, -37,
+    -89, 62, 3, -110, -58, 43, -57, 23, 34, -59, 28, 23,
+    74, 13, -15, -58, -28, -4, -37, -58, -82, 30, -103, 49,
+    -9, -20, -93, 22, 120, -24, 41, -127, -19, -19, -42, -23,
+    -105, 35, -26, 10, -63, 42, 36, -18, 50, 45, 65, 74,
+    -32, -34, 93, -82, 13, -19, -20, 29, -102, -28, 39, -23,
+    18, 35, 50, 2, 9, 6, -91, 11, -47, -56, -8, -32,
+    -62, 73, -33, -64, -85, -47, -17, 22, 17, 4, -17, -83,
+    86, -15, 13, 28, 40, -100, -14, 54, -28, -30, 127, 101,
+    39, -34, 78, 46, 18, 10, -36, -93, 4, 36, -22, -21,
+    -23, 53, -28, -40, 57, -42, -29, -13, 31, -22, 68, 4,
+    106, 9, -21, 35, 75, 5, 16, 10, -3, 45, 61, 13,
+    37, 33, 48, 53, -8, 42, 5, 81, 70, -4, -47, -54,
+    11, 1, -30, 54, -91, 5, -64, 4, -45, -22, -4, 87,
+    85, 26, -39, -1, 30, -78, -32, 44, -84, -21, -30, 14,
+    -44, -1, -20, 55, -26, 58, -11, -31, -6, -33, 82, -7,
+    -35, 49, -54, -19, -49, 1, 24, 17, -46, 40, 1, -9,
+    -1, 9, 33, -20, -60, 48, 99, 35, -83, 127, -37, -74,
+    -11, -16, -27, -23, -25, 41, 74, -111, 33, 12, -56, 32,
+    -50, -8, -2, -34, -14, 34, -59, -46, 8, 67, 73, -30,
+    -74, -104, -23, 42, 24, 46, -3, -32, -19, 6, 31, 64,
+    -63, -60, -18, -27, -6, 13, 4, -23, 16, 4, -66, -11,
+    39, -32, -20, 68, -14, 32, -77, 28, 42, -9, -38, -24,
+    1, -7, 5, 50, 36, 12, 72, 40, -48, -28, 39, -108,
+    -8, 44, 127, -45, -114, 16, -23, 1, 14, 45, -4, 5,
+    18, -48, -3, -8, 19, 51, 83, -78, -127, -27, 49, -10,
+    -19, 23, -10, -51, -68, -38, -4, -68, -43, -51, 102, -70,
+    10, 32, 24, -24, -63, 23, -49, 12, 98, 16, 10, 46,
+    56, 9, -4, 34, 85, -30, 8, -31, 44, 62, 57, -13,
+    106, 32, 85, 108, 6, -17, 41, -56, 95, -82, -40, 56,
+    24, -34, 127, -23, 7, 18, 49, -1, -29, -27, 20, 40,
+    -77, -7, 17, 19, 17, 26, -20, -67, 16, -29, 73, -27,
+    39, 33, 15, 23, -12, -22, -15, -11, 7, 74, 59, -16,
+    -51, -9, 14, -2, -40, 14, -12, 12, 4, 55, -4, -8,
+    -38, 8, -48, -33, -32, -8, 6, 63, 9, 37, -109, -46,
+    10, 43, 127, 24, -27, -30, 7, -28, 20, -14, -19, -18,
+    23, 2, -31, 77, 4, -43, 18, 15, -10, -20, 15, -9,
+    63, -23, 35, -25, -65, 10, 17, 20, -53, -42, 18, -46,
+    -6, -56, -70, -24, -70, 24, 47, -69, 5, 48, 78, -15,
+    -28, -54, -47, -2, -47, -52, -36, -25, -22, 67, -93, -57,
+    35, -4, -67, 94, 38, -38, 96, 15, -35, -3, -72, 101,
+    -33, 39, -100, -1, -14, -24, 7, -127, 26, 47, -56, -37,
+    17, 66, -46, -7, 76, -71, -52, -43, -23, -61, 74, 10,
+    41, -70, 26, 100, 65, -77, -24, 65, -25, 18, -7, 10,
+    25, -24, 65, 61, -14, 65, 14, 55, -46, -72, 127, 0,
+    -110, -51, -61, -63, -35, 27, -33, 24, -15, 9, -8, 29,
+    -7, -22, 81, -37, -2, -24, -52, 30, -46, 49, -16, 19,
+    38, 45, 13, -30, -17, 19, 63, 5, 5, 7, 34, -31,
+    -45, -52, 127, -25, 49, -25, 47, -4, -43, -9, -111, 55,
+    53, 95, -3, 1, 21, -15, -35, -18, -70, -26, -36, 81,
+    -23, -16, 7, -31, 35, 92, -103, -66, -14, -3, 86, 18,
+    -34, 43, -58, -6, 1, 17, 20, -20, -13, -22, 20, -18,
+    -14, 86, -7, -35, -127, -10, 35, -18, 25, 32, 39, -7,
+    -25, 21, -13, -63, 11, -37, 20, -37, -40, 9, 25, -13,
+    -31, 10, -39, 3, 0, -10, -55, 48, 78, -80, -11, -22,
+    -7, 13, -11, -59, -43, -20, 91, -12, 52, 28, -8, 48,
+    22, -24, 15, 20, 48, -127, -39, -26, 10, 47, 35, 56,
+    62, 5, 57, 16, -80, -92, 106, 1, -106, 17, -62, 13,
+    28, -39, -23, -69, -69, -75, 55, 69, -14, 61, 38, -88,
+    42, -19, -42, -49, -39, 112, 6, -14, 3, 16, 27, -31,
+    33, 20, 22, 0, 118, 4, 20, -49, 89, 89, -53, -11,
+    -52, -34, 125, 109, -43, 72, -28, -89, 127, -51, 69, 22,
+    -3, -74, -103, -23, 5, 99, 53, -82, -69, -78, -46, 23,
+    -56, 105, -9, -12, 19, 80, -44, 27, -16, -88, 49, -18,
+    39, 86, 24, 1, -16, -45, -43, 19, 107, -2, 59, 31,
+    -43, 60, 31, -53, -13, 27, -75, 7, -55, 52, -42, 98,
+    -8, -8, -32, 26, -29, 3, -38, -104, -17, 60, 53, -61,
+    -20, 20, 10, -1, -27, -14, -13, -53, -13, 26, -22, -51,
+    8, 14, 21, -38, -20, 16, 57, -19, -18, -5, -6, 72,
+    4, -3, 9, -119, -13, -16, -17, 21, -56, -40, 2, -23,
+    45, 38, -17, 20, 33, -31, -90, 40, 51, -5, 5, -38,
+    55, -54, 18, -44, -44, -38, 127, 29, -17, -39, 45, -6,
+    41, -10, -16, -24, -72, 55, 28, 18, -108, 61, -127, 76,
+    84, 19, 3, 17, -35, 6, 71, -43, -96, 10, -24, 19,
+    -51, 36, -65, 11, -36, -64, -50, 49, -29, -47, 25, -9,
+    -22, 53, -26, 2, 32, -22, 53, 56, 5, 3, 59, -19,
+    -13, -6, 55, 97, 107, 25, -29, 51, 58, 76, 107, -39,
+    -74, -46, 85, -35, 17, 63, 41, -46, -62, -4, -2, -85,
+    0, 66, -51, 33, 46, 5, -23, 24, -101, -52, 57, 5,
+    -28, -15, -58, -2, -14, -9, 7, 33, -16, -46, 16, 24,
+    -58, -49, -4, -50, 50, 13, -8, -6, -33, -53, 3, 34,
+    9, 27, 24, -42, -12, 33, 5, -32, 88, -23, 67, 45,
+    38, 24, 31, -19, -77, 6, 26, -45, 20, 17, 127, -6,
+    16, -25, 100, 4, -47, -2, 89, 82, 1, 31, -83, 36,
+    -1, 32, 8, -90, 18, 59, -31, -38, 63, 108, 7, -8,
+    85, -27, -60, -84, -42, -77, 118, 38, 10, -90, 13, 12,
+    -32, -75, -19, 54, 14, -8, 55, -82, -6, 33, 42, 79,
+    38, -65, 56, 86, -6, -39, 127, -68, -50, -62, -34, -11,
+    -33, 32, -52, 59, -21, -34, 127, 43, 3, 20, -7, 52,
+    63, -13, -42, 79, -28, -19, 22, -39, -10, -30, -20, 10,
+    18, 12, -19, -70, -14, -55, -5, 11, -72, -14, -41, 13,
+    92, -38, 17, 20, 26, -14, -3, 13, 7, -7, 58, -66,
+    0, -21, 123, 49, 25, 35, 6, 8, 58, 2, -11, -18,
+    -56, 42, 41, -56, -35, 36, -34, 24, -23, -40, 47, -10,
+    -3, -25, 127, 96, 15, 4, -36, 33, 16, 26, -6, -65,
+    23, -7, -10, -3, 21, 8, -26, -47, 85, -31, 1, -43,
+    7, -63, 1, -12, 94, -25, 25, 34, 54, -38, 12, 40,
+    53, -11, 30, -58, 11, -22, 50, -1, -18, -48, 14, 10,
+    -9, -39, -15, -71, 16, -5, -63, 16, -48, 0, 17, 101,
+    -47, -2, 127, -4, 79, 4, -1, 38, 100, -11, -33, 44,
+    -48, 19, -17, -70, -27, -67, -6, 12, -10, 15, -6, -48,
+    -2, -78, 24, 1, -46, -11, -74, 34, 107, -18, 43, 121,
+    40, -15, 3, 116, 23, 4, 52, -82, 44, -38, 115, 28,
+    -99, 7, -26, 74, 33, -53, 7, -22, -68, -22, -48, -24,
+    -80, 5, -28, 98, -20, -9, -50, 36, 44, 23, 127, 8,
+    13, 65, -29, -33, -41, 11, -6, -19, 36, 102, 34, -63,
+    19, 38, -14, -24, 12, -10, 17, -52, -10, -39, 60, 46,
+    51, -44, -11, -2, 46, 7, 120, -37, -1, 34, 42, -45,
+    -49, -3, -16, -11, -16, 16, -28, 64, 24, -12, -60, -48,
+    64, -2, -84, -23, -48, -2, 75, -24, -18, 1, 26, -16,
+    33, -10, -6, -35, -32, -45, -30, -15, -26, 54, 27, -21,
+    -37, -96, -1, 56, 33, 21, 33, -4, 32, -34, 50, -78,
+    -8, -7, -33, 42, -67, -5, 55, -24, -41, 34, 5, -65,
+    20, -54, -63, 33, -62, -5, 26, -17, 69, -41, 63, -127,
+    -68, -22, 12, 50, -18, 18, 38, 2, 103, 8, -52, 50,
+    0, -40, -9, 99, -20, -67, -15, -73, -45, -21, -33, -24,
+    -87, -15, -76, 114, -57, -58, 16, 59, -13, 59, -9, 40,
+    -35, -17, 98, -55, 23, 99, 29, 65, -116, -89, -23, -24,
+    -29, 107, -9, -7, -14, 5, -83, 60, -20, 127, 19, 14,
+    -89, 91, -77, -56, -95, -7, 21, 48, -16, -69, 83, -101,
+    20, 48, -118, -66, -46, -22, 94, 27, 19, 9, 40, 64,
+    85, -11, -36, -4, -20, 17, -15, -46, 11, 2, 6, 6,
+    7, 47, -71, -54, 32, -56, -16, -18, -39, -60, -33, 8,
+    64, -18, 34, 43, 3, -52, 14, 34, 77, -13, 62, -70,
+    -2, -37, 127, 15, -34, 17, -13, 23, 26, -7, -3, -49,
+    9, 16, -14, -33, -65, -1, 22, 93, -47, 24, 35, 53,
+    -32, -39, 50, 5, 20, 7, -63, 33, -54, 35, -2, 3,
+    -13, 7, 1, -23, 3, 18, -14, -31, 28, -22, 19, 10,
+    -20, -24, 127, -4, 2, -34, 12, 3, -53, 32, -59, 34,
+    30, 27, 16, -17, -30, 36, 58, 36, -84, 18, -60, 48,
+    -44, -40, 42, -19, -12, 64, -30, -47, -20, 3, -28, 30,
+    86, -42, 14, 4, -93, -12, 49, 43, -10, 90, 127, -12,
+    -41, -106, -50, 77, -29, 18, -45, -30, -1, 42, 2, -14,
+    -50, -35, -29, 53, 29, 43, 94, -5, 77, -63, -99, -32,
+    -38, -21, -77, 66, -67, 72, -30, 22, 46, 16, -87, -12,
+    -12, 2, 28, 61, 23, 35, 91, 2, -68, -15, -8, -22,
+    -60, 10, 43, -62, 25, 38, 62, -47, -2, -45, 11, -55,
+    8, -19, -74, 58, 15, 26, 23, 51, -11, -93, -38, 12,
+    25, -51, -52, -11, 94, -24, 48, 50, -90, -42, 0, 66,
+    39, -65, 94, -26, -100, -57, -50, -4, 17, 71, 6, -108,
+    31, 111, 85, -84, 10, -102, 36, 8, -17, -64, 6, -91,
+    -18, 127, -113, -78, -11, -14, 106, 92, 11, 10, 75, 37,
+    -40, -43, -67, 21, -43, -127, 51, 50, 80, 32, -73, -22,
+    -23, -62, 27, 90, -17, 19, -10, -18, 19, -68, 34, -4,
+    96, 45, -39, 11, -55, 74, 2, 30, -54, -32, -40, -38,
+    -28, 3, -18, 107, -76, -26, 32, 18, -108, 73, -20, -66,
+    -79, -25, 64, -67, 37, 80, -76, -92, -18, 2, -88, 56,
+    -42, 58, 31, -15, 21, 3, -28, -7, 15, 16, -29, -24,
+    -64, -34, -14, 11, 44, 12, -1, -36, 6, 0, -9, 32,
+    2, -56, 34, -8, -35, -25, 11, -7, 13, -11, -7, -1,
+    25, -40, -12, 47, 23, 33, -18, -12, -6, -8, -15, -55,
+    -31, -43, 8, 39, -15, -14, -22, 4, 9, 16, -18, -79,
+    25, 3, 127, 1, 61, -77, -71, 42, 84, 22, 71, 12,
+    33, -27, -6, -2, -56, -21, -7, 79, -82, 8, -32, -13,
+    -47, 24, 28, -36, -41, -14, 79, 24, -69, 32, 127, -32,
+    55, -9, -28, -32, -89, 121, -76, -11, 25, 101, 5, -10,
+    -35, 52, 1, -25, -19, -15, -44, 12, 44, 51, -74, 12,
+    24, 24, 43, -16, -92, 3, 24, -95, -66, -3, -96, -43,
+    3, 36, 0, -39, 15, 0, 117, -42, -50, -10, 10, -31,
+    -39, 19, 12, -24, 79, 41, 89, 39, -54, 10, 46, -44,
+    51, -14, -81, -63, -44, 45, -42, -25, 127, 22, 47, 47,
+    -60, -22, -99, 103, 21, -100, -31, -15, 56, 53, 4, -54,
+    -22, 24, -21, 46, -62, -1, 24, -105, 36, 13, 23, 3,
+    1, 5, -73, 18, 2, -4, 56, -22, -20, -1, 127, 2,
+    56, 21, -36, -18, -86, 44, 31, 8, 27, 33, 30, -54,
+    -47, -15, -14, -51, 86, 25, 14, -42, 14, -12, -36, -14,
+    18, 14, -38, 10, -42, 22, -56, 72, 58, -78, -44, -13,
+    -55, 50, -22, -11, -6, 0, 38, -10, 86, 43, -9, 19,
+    -49, -12, -12, -26, -46, -1, 60, -1, 23, -30, -56, 27,
+    -4, -48, -18, 39, -15, 39, -35, -106, -79, -86, 33, -1,
+    10, -24, -9, -67, 127, -53, -54, 61, 29, -65, -6, -14,
+    -71, 42, 52, 64, 49, -33, -35, 50, 105, -9, 25, 53,
+    -13, -49, 50, -17, -107, 65, 0, -52, -92, -56, 59, -44,
+    67, 77, -56, -32, 55, -42, -31, 111, -33, 24, 37, 15,
+    -22, 37, -13, 23, 25, -79, 98, 64, -12, 33, -22, -37,
+    -23, -11, 18, 39, 35, 90, -11, -18, 1, -60, 34, 24,
+    47, 59, -127, -34, 0, 39, -4, 21, 30, -32, 0, -6,
+    -8, -8, -17, -28, -9, -63, 12, 39, -68, 78, 3, -46,
+    56, 2, -11, -62, -83, 17, -3, -90, -65, 24, -29, 69,
+    -18, -45, 121, 41, -17, -32, 51, 77, 6, 47, -30, -48,
+    37, -6, -5, -6, -14, -1, 40, -23, -8, 61, -72, -35,
+    69, -26, 30, -88, 18, -32, -74, -6, 69, -27, 1, 127,
+    122, 5, 107, -1, -11, -25, -15, -36, -47, -16, 55, 40,
+    -29, 39, -10, 3, -56, -64, -17, -41, -45, -16, -85, -15,
+    -20, 70, -26, 90, -107, 0, -61, 23, -21, 48, 86, 89,
+    46, -20, -10, 127, -87, 29, 28, -122, -44, -39, -58, 13,
+    60, 23, 2, -66, -3, -36, 94, 25, -13, -85, -51, -58,
+    100, 89, 47, 29, 1, -28, 23, 69, 11, -27, -16, -33,
+    2, -17, 83, 48, -10, 44, 20, 7, 36, -29, -52, -72,
+    -61, 47, -29, -73, -37, -44, 14, 118, 86, -36, 42, -24,
+    10, -16, -44, 36, 1, -3, 37, -31, 27, -22, -24, 60,
+    -46, 26, -89, 6, -43, -3, -34, -17, 7, -10, -63, 37,
+    31, 78, -4, 1, -18, -27, -35, -36, -84, -42, -70, -40,
+    -19, 88, 5, 32, -49, 5, -27, -11, -16, -13, -15, -31,
+    39, 20, -23, -4, 88, 38, -8, -35, -18, 6, 127, 2,
+    10, -55, -14, 23, -31, -14, -75, -49, -4, -49, -82, -37,
+    -13, 39, 13, 24, -75, -27, -15, 43, -3, 32, 48, 10,
+    -31, -37, 74, -55, -19, 49, 37, 40, -118, 21, -45, -48,
+    -64, 119, -7, -4, 19, 2, -91, 12, -35, 47, 23, 22,
+    52, 60, -33, -64, -96, 55, 22, 50, -2, -77, 127, -58,
+    62, 63, -33, -69, 51, 16, 74, -27, 2, -39, -71, 20,
+    -2, -40, 30, -50, 77, -40, -4, 40, -81, -33, -22, 38,
+    -55, 5, -18, -3, -15, -18, -39, 34, 9, 72, 2, 34,
+    -10, -24, -25, -59, -127, 54, -59, -79, -12, 53, -29, 23,
+    -48, 61, -3, -26, 37, -59, 4, -79, -24, 35, 2, 30,
+    103, 3, 49, 20, 0, 37, 84, -30, -77, 29, 67, 5,
+    12, 16, 0, 77, 10, -127, -11, -31, 80, 82, -33, -98,
+    15, -35, 23, 69, -22, 32, -46, -58, 10, -46, -40, -17,
+    18, -46, -20, -45, 44, 97, 36, 11, -38, -12, -20, -45,
+    91, -39, 33, 28, -15, -62, 110, 22, -33, -54, 31, -96,
+    -17, 66, 24, -51, 106, 88, -38, 45, -5, 10, 57, 76,
+    2, 40, 119, -26, 78, -2, 19, 78, -23, -45, 100, -17,
+    58, -47, -61, -41, -54, -50, -14, 12, 6, -29, -65, -53,
+    78, -115, -4, -30, 76, 15, -127, 38, 62, 46, 24, 21,
+    62, -85, -40, -92, 66, -24, 67, -28, -24, -55, 7, 4,
+    -35, -81, 89, -43, 8, 25, 20, -82, 94, 70, -67, 57,
+    -79, -70, 20, 127, -9, -9, 9, 58, -1, 9, 41, -31,
+    -21, 13, -11, -28, 4, 64, -28, 1, -53, 22, 68, -28,
+    -37, 42, -18, -27, -38, -16, -5, -51, -24, -9, 127, 4,
+    -4, -29, -11, -12, -19, -10, -70, 2, 56, 38, -19, 28,
+    30, -25, -2, 19, -46, 26, -40, 1, -11, -20, 50, -14,
+    87, 22, -6, 45, -15, -15, -12, -32, 57, 8, 60, 46,
+    93, -42, 72, -14, 24, 44, -125, -22, -78, -61, -4, 6,
+    3, 5, 38, -48, 3, 8, -11, 22, 0, -87, 118, -19,
+    -58, -38, 2, 37, 7, -40, 31, 4, 127, 1, 3, -1,
+    12, 19, 4, -24, -35, 42, -7, -26, -35, -61, -20, 17,
+    -52, -42, -67, -34, 17, 17, -64, -51, 66, 11, 40, -1,
+    -49, 3, -14, -67, 9, 60, -8, 65, 13, -32, 15, -27,
+    20, 34, 97, -66, -109, -67, -5, 36, -38, 12, 6, -61,
+    -35, -52, -21, -64, -15, -10, 15, -35, -14, 53, -6, -26,
+    -47, 29, -4, -28, 69, -20, 61, 64, 33, -26, 30, -15,
+    127, -61, 42, -84, -4, 79, 0, -1, 26, 2, 68, 121,
+    15, -11, 39, -1, 2, -71, 11, 77, 92, 22, -103, 2,
+    7, -22, -110, -35, 29, -47, 27, 64, -111, 5, -15, 54,
+    -11, -19, -20, 3, 5, -10, 65, -70, -70, 55, 19, 59,
+    -121, 41, 35, -23, -98, 115, 110, -58, 71, 16, 19, 1,
+    -127, 31, 121, 46, 34, 63, -44, -91, -33, 54, -53, 24,
+    44, -25, 108, -35, 62, 51, -13, -42, -72, -2, -17, -33,
+    -48, 59, -69, -6, 20, -34, 7, -40, -10, -10, 68, -62,
+    -85, -8, 3, 6, -5, -26, -4, 12, -32, -58, -51, -31,
+    -2, -51, -31, -37, 1, 42, 0, -12, 56, 11, 26, 10,
+    51, -18, 30, 58, 37, -39, 11, 11, 127, 3, 33, -35,
+    29, 36, 77, 2, 39, -11, 48, 17, 35, 20, 39, -21,
+    -5, 25, 66, -6, -14, -14, -22, 51, -30, 82, -29, -73,
+    23, 32, 17, -94, 14, 30, -43, -23, 24, 38, -44, 15,
+    18, -50, -57, -87, 25, -41, -36, 46, -37, -83, -1, 31,
+    63, -32, 49, 0, -12, -33, -18, -51, -36, -39, 21, 4,
+    36, -4, 80, 71, -20, -70, 127, -5, -58, -36, -12, -50,
+    -23, 14, 18, 69, 54, -31, 40, 1, 38, -22, 38, 70,
+    -39, -49, -28, 89, -82, 35, 21, -43, 4, -9, -60, 5,
+    24, 25, 61, 8, 63, -14, 35, -56, 31, -55, 25, -1,
+    34, 20, 37, 49, 7, -97, -19, 41, -73, -6, 48, -35,
+    18, -31, 30, -15, -27, 11, 94, 31, -63, -59, 6, -51,
+    -65, 50, -66, -79, 46, -30, -55, 127, -60, 1, -74, -63,
+    11, 72, -4, -2, 7, 23, 37, -33, 24, 49, 73, -58,
+    -97, 4, -16, 43, 53, 29, 43, 17, 13, -26, 16, -94,
+    25, -55, -58, -27, -39, 27, 19, -29, 42, -8, 127, -41,
+    -5, -50, -28, -5, -16, -78, -10, -17, 104, -29, 60, -47,
+    5, 46, -9, -5, 15, -14, 12, 62, 45, -6, 54, 28,
+    127, 40, 77, -43, 4, -36, -50, 8, 9, -28, 48, -22,
+    22, -38, -31, 44, -45, 31, -99, 26, -17, 12, -29, -25,
+    14, -22, -45, 80, 26, 80, -22, 16, -10, -72, -35, -39,
+    -70, -18, -71, -49, -96, 78, 11, 12, -44, 41, -32, -9,
+    -12, -23, 21, -42, -7, -3, 4, 3, 7, 35, 35, -52,
+    -25, 30, 65, -27, 53, -44, 113, 19, 4, -51, -68, -64,
+    27, -29, 99, 31, 60, -64, -49, 15, 8, 51, -6, 36,
+    -27, 42, -60, -16, 3, -41, 35, -23, 31, 127, -35, -34,
+    -16, -8, -34, -14, 7, 92, -39, -38, -73, 68, -55, -17,
+    -38, 10, 40, 37, -25, 55, -38, -33, -20, -18, 13, -19,
+    -19, 28, 26, 2, -55, 76, -90, -41, 17, 32, 86, -5,
+    4, 6, -70, 41, 21, -42, -59, 11, -36, -51, -22, -46,
+    80, 35, -37, -29, 12, -36, -65, -20, 15, -37, -31, -16,
+    -22, -54, 37, 6, 41, -14, 11, -17, 9, -83, -77, 47,
+    -1, 42, 62, -79, -32, 37, 39, -36, -29, 1, 0, 82,
+    -51, -62, 27, -50, 4, 45, -80, 11, 29, -12, 127, 90,
+    -32, -12, -20, 87, 6, -27, 0, -62, 26, -67, 60, -26,
+    76, -19, -42, 60, -111, -24, 41, 106, -17, 68, 30, -33,
+    -27, -63, 62, -76, 39, 71, 20, -6, -87, -17, -27, -59,
+    -39, 127, 8, -13, 2, 21, -34, 55, -32, 24, 28, 22,
+    -12, 52, -37, -103, -18, 80, -34, 24, 78, 17, 88, 28,
+    3, 35, -82, -54, -30, -15, 5, 9, 14, -23, -57, -58,
+    -11, 11, -29, -52, -20, 62, -7, -24, -79, 48, 44, -43,
+    9, 39, 7, 62, -30, -15, 4, -94, 1, -32, 18, 33,
+    -72, 11, 8, -27, -17, 17, 17, 24, 33, 5, -88, 2,
+    11, -39, -6, 0, -8, 39, -9, -36, -47, -25, 127, 11,
+    25, -6, -30, -49, 66, 3, 1, 12, 81, -13, 105, -11,
+    -66, -69, 86, 115, -19, 5, 15, 73, 20, -80, 23, -19,
+    -31, -26, 8, -2, 19, 36, -62, -10, 15, -65, -26, 63,
+    53, -61, -64, -21, 49, -20, -25, 119, 54, -52, -48, -84,
+    41, 21, 50, -1, 43, 42, 31, -9, 16, 6, 56, 24,
+    -11, -33, -24, -41, -18, 32, -127, 35, -61, 52, -85, 96,
+    17, -21, 49, -4, 8, -34, -61, -55, 37, 37, 9, -59,
+    -47, -112, -26, 49, 0, 29, -43, -15, -1, -28, -39, 16,
+    -54, -49, 2, 18, -27, 68, -9, -41, 4, -29, -39, -37,
+    42, 19, -9, -7, -4, 69, -39, -25, 3, 44, -15, -32,
+    -36, -12, -19, -24, 9, 7, -38, 22, 6, 47, 25, -86,
+    5, 47, 127, -52,
+};
+// functional_1/activation_8/Relu;functional_1/batch_normalization_8/FusedBatchNormV3;functional_1/conv2d_4/BiasAdd/ReadVariableOp/resource;functional_1/conv2d_4/BiasAdd;functional_1/conv2d_4/Conv2D
+alignas(16) const int32_t kTensor15Data[64] = {
+    -1989, 1416, -2778, 1276, 5653, 3672, -528, 1344, 946, 6747, -5993, 2735,
+    2973, -544, 281, 3569, 1429, -351, 2914, 1182, 2554, 3511, -547, 2738,
+    -1590, -1174, -1547, -890, -797, 4840, 5617, -1419, 664, 385, 2873, 4123,
+    2414, 823, 4388, 876, 2897, 1882, -188, 1518, 2101, 5070, 2927, -1573,
+    774, -585, 2195, 447, 1743, 2316, 3304, 388, 2386, 3316, 1540, 1486,
+    1064, 4623, -799, 5472,
+};
+const int32_t kOp8Multiplier[64] = {
+    1288495350, 1272000227, 1133757147, 1325196533, 1544132175, 1576280665,
+    1250884107, 1416885595, 1257225235, 1398192069, 1182829336, 1322080746,
+    1344902500, 2033833852, 1719064480, 1135625170, 1170040216, 1353273889,
+    1554794931, 1202368357, 2132778438, 1528518266, 1492342135, 1710798759,
+    1149753748, 2079748779, 1262964489, 1636841300, 1329932912, 1678328183,
+    2045908555, 1181570288, 1473231915, 1208376190, 1989840828, 1382179700,
+    2082880260, 1915767688, 1245022969, 1320515753, 1168046573, 1200638585,
+    1970504475, 2076313148, 1433054747, 1128270331, 1241833722, 1370425141,
+    1955753547, 1321526997, 1258200908, 1358027456, 1304596498, 1414568521,
+    1282414133, 1231038246, 1459578170, 1460851567, 1551130029, 1218666866,
+    1131962883, 1482434001, 1846193434, 1482706018,
+};
+const int32_t kOp8Shift[64] = {
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -8, -7, -7, -7, -7, -7, -7, -8, -7, -7, -7,
+    -7, -8, -7, -8, -7, -7, -8, -7, -7, -7, -8, -7,
+    -7, -8, -7, -7, -7, -7, -8, -8, -7, -7, -7, -7,
+    -8, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -8, -7,
+};
+const cmsis_nn_conv_params kOp8Params =
+    {128, -128, {1, 1}, {0, 0}, {1, 1}, {-128, 127}};
+const cmsis_nn_per_channel_quant_params kOp8Quant = {
+    const_cast<int32_t*>(kOp8Multiplier), const_cast<int32_t*>(kOp8Shift)};
+const cmsis_nn_dims kOp8InputDims = {1, 25, 5, 64};
+const cmsis_nn_dims kOp8FilterDims = {1, 1, 1, 64};
+const cmsis_nn_dims kOp8BiasDims = {1, 1, 1, 64};
+const cmsis_nn_dims kOp8OutputDims = {1, 25, 5, 64};
+
+// Operator 9: AVERAGE_POOL_2D
+const cmsis_nn_pool_params kOp9Params = {{5, 25}, {0, 0}, {-128, 127}};
+const cmsis_nn_dims kOp9InputDims = {1, 25, 5, 64};
+const cmsis_nn_dims kOp9FilterDims = {1, 25, 5, 1};
+const cmsis_nn_dims kOp9OutputDims = {1, 1, 1, 64};
+
+// Operator 11: FULLY_CONNECTED
+// functional_1/dense/MatMul
+alignas(16) const int8_t kTensor16Data[768] = {
+    -80, -38, -39, 43, 6, 5, -15, 35, -6, 40, -71, 66,
+    -30, -41, 37, 37, -69, -36, -70, 19, 23, -11, -80, -38,
+    -49, 21, -86, 16, -16, 52, 87, -25, 10, -23, 35, -9,
+    -7, 36, -28, -81, -46, -41, 7, -92, -10, 84, 43, -67,
+    -89, -29, 47, -44, 80, -74, -72, -41, -76, 23, 44, -30,
+    60, -20, -33, 32, 12, 65, -30, -38, 36, -18, 16, -42,
+    63, -57, 30, -13, 26, -51, 29, -16, -68, -67, -47, 32,
+    48, -66, 3, -25, -82, -14, -72, -19, -31, -35, 26, -80,
+    -83, 59, -45, 32, -43, 13, 20, 56, -41, 54, -20, -70,
+    46, -5, 43, -46, 10, -35, -64, -37, -40, -21, -53, -17,
+    -36, 56, 69, -38, 29, -79, 26, 25, 54, -35, 25, -52,
+    14, -32, 35, -66, -47, -10, -14, -57, 56, 33, -73, -63,
+    76, 57, 51, -75, 24, 61, 60, 10, 62, -18, -61, -39,
+    9, -70, 9, -33, 42, 44, -50, -9, 13, -10, -57, 29,
+    26, -85, -42, -56, -61, -11, -68, -19, -79, 69, -29, -44,
+    -56, 8, 29, -4, -59, -83, -67, 35, -50, 68, -59, -17,
+    -25, 31, -46, -55, 52, -38, -60, 19, 12, -10, -44, -52,
+    55, 4, -47, -21, -68, 53, -22, 2, 45, -46, -40, 58,
+    -67, -65, -54, -56, 22, -49, -32, -53, -39, 51, 48, -52,
+    61, 39, -33, -9, -38, -65, -87, -50, 70, -30, 57, -19,
+    -12, -3, 16, -36, -31, -34, -46, -12, -28, 54, -30, 42,
+    -53, -10, -28, 61, 12, -32, -62, -19, 67, 67, 59, -32,
+    22, -54, -81, -68, -4, 32, 10, -44, 24, -67, 20, 36,
+    -69, 65, 44, 68, 60, 9, -74, -47, -97, 65, -38, -77,
+    -74, 21, -8, -36, -47, -70, 9, -44, -41, -35, -54, 5,
+    -70, 11, -8, -36, -31, -75, -78, 40, -14, 46, 37, 27,
+    66, -27, -61, -40, -42, 0, 10, -81, -94, 16, -23, 79,
+    -65, 52, 45, 45, -28, -76, 8, 66, -38, 43, 5, -24,
+    -54, -76, -47, 70, -77, -88, 62, 63, -15, 70, -53, 39,
+    -29, 19, -25, 45, 2, -63, -18, -67, -62, 33, 19, -71,
+    -75, 42, -26, 60, -58, 28, -25, 21, -49, -78, -79, 36,
+    69, 32, -81, -71, 40, -63, -3, -36, 26, -91, -28, -39,
+    60, -41, 56, -22, -41, -77, 55, -27, -2, -9, 73, -44,
+    -50, 30, 73, -14, -16, 60, 26, 36, -29, -20, -50, -63,
+    43, -12, 52, -25, 65, -54, -24, 3, 51, 43, -29, -49,
+    -36, 68, -61, 61, -34, -58, -4, 30, -67, -75, -59, -11,
+    -28, 62, 24, -22, -85, -58, -63, 26, -24, -60, -51, -28,
+    1, -54, 27, -58, -53, 50, -23, -59, 78, -11, -45, 72,
+    -47, 87, -95, 41, -31, -10, -29, -9, -45, 7, 85, -117,
+    -56, -21, -57, -80, -37, -100, -55, -25, -54, 57, 24, -65,
+    18, -40, -64, 71, -64, -59, 79, 57, 65, 56, -36, 43,
+    -37, 34, -42, 22, -4, -11, -85, -28, -14, -5, -47, 58,
+    35, -34, -14, -26, 41, 23, -60, -97, -31, -15, -1, -35,
+    -89, 40, 0, -82, -42, -61, -25, -89, -51, 61, -79, -10,
+    -72, -55, 56, -32, -88, 49, 24, -39, -13, -32, -3, -31,
+    -48, 46, -44, -2, -50, -58, -30, 45, -59, -50, -33, 36,
+    49, -31, -11, -65, -2, -6, 52, 67, 52, 24, -56, 60,
+    8, 56, -5, -77, 46, -12, 3, -1, 33, 9, 17, -27,
+    -32, -84, -82, -7, 13, -28, -29, -82, -57, 59, -28, -31,
+    74, -44, -46, -42, 29, -11, -12, -72, 74, 42, 32, 51,
+    -20, -52, 3, 14, 37, -15, -25, -42, -47, -5, -52, -94,
+    70, -84, 81, -13, 8, -39, 61, -8, -69, -31, -109, -56,
+    3, -60, 76, -79, -51, 29, 67, -8, 54, -67, -49, 42,
+    -68, 30, -21, 64, 42, -43, 79, -81, -64, -76, -92, -69,
+    56, 39, -2, -79, -74, -36, 40, -90, -61, -69, -29, 1,
+    52, -52, 19, -44, 44, -58, 4, -26, 66, 1, -90, 35,
+    -62, -85, -104, -70, -114, -25, -70, -31, -61, -35, 66, -50,
+    -14, 14, -53, -39, -49, -45, -65, -16, 60, -23, 65, -25,
+    65, -73, -56, -114, -36, 50, -92, -127, -12, -44, 40, 55,
+    5, 10, 9, 31, 51, -38, 25, 47, -35, -28, -6, 61,
+    40, 5, -51, -15, 15, -45, 3, 6, 44, 61, 69, 69,
+    2, 10, -23, 72, 34, -4, 61, 24, -5, -19, -55, -40,
+    38, 53, 58, 41, -13, -43, -18, 24, 39, -27, 21, -43,
+    -4, -21, 20, 70, -37, 8, 20, 64, -36, -38, 60, 2,
+};
+// functional_1/dense/BiasAdd/ReadVariableOp/resource
+alignas(16) const int32_t kTensor1Data[12] = {
+    -78, -16, -66, -88, -8, -92, -202, 32, -63, -151, -43, 171,
+};
+const int32_t kOp11Multiplier[1] = {
+    1278221461,
+};
+const int32_t kOp11Shift[1] = {
+    -7,
+};
+const cmsis_nn_fc_params kOp11Params = {128, 0, 14, {-128, 127}};
+const cmsis_nn_quant_params kOp11Quant = {
+    const_cast<int32_t*>(kOp11Multiplier), const_cast<int32_t*>(kOp11Shift), 0};
+const cmsis_nn_dims kOp11InputDims = {1, 1, 1, 64};
+const cmsis_nn_dims kOp11FilterDims = {64, 1, 1, 12};
+const cmsis_nn_dims kOp11BiasDims = {1, 1, 1, 12};
+const cmsis_nn_dims kOp11OutputDims = {1, 1, 1, 12};
+
+}  // namespace
+
+KwsModelAot::KwsModelAot(uint8_t* arena) : arena_(arena) {
+  TFLITE_DCHECK(reinterpret_cast<uintptr_t>(arena) % 16 == 0);
+  // Scratch buffers are planned for the DSP build of CMSIS-NN, which asks
+  // for the most on these targets.
+  TFLITE_DCHECK_LE(
+      arm_convolve_wrapper_s8_get_buffer_size(
+          &kOp0Params, &kOp0InputDims, &kOp0FilterDims, &kOp0OutputDims),
+      160);
+  TFLITE_DCHECK_LE(
+      arm_depthwise_conv_wrapper_s8_get_buffer_size(
+          &kOp1Params, &kOp1InputDims, &kOp1FilterDims, &kOp1OutputDims),
+      0);
+  TFLITE_DCHECK_LE(
+      arm_convolve_wrapper_s8_get_buffer_size(
+          &kOp2Params, &kOp2InputDims, &kOp2FilterDims, &kOp2OutputDims),
+      256);
+  TFLITE_DCHECK_LE(
+      arm_depthwise_conv_wrapper_s8_get_buffer_size(
+          &kOp3Params, &kOp3InputDims, &kOp3FilterDims, &kOp3OutputDims),
+      0);
+  TFLITE_DCHECK_LE(
+      arm_convolve_wrapper_s8_get_buffer_size(
+          &kOp4Params, &kOp4InputDims, &kOp4FilterDims, &kOp4OutputDims),
+      256);
+  TFLITE_DCHECK_LE(
+      arm_depthwise_conv_wrapper_s8_get_buffer_size(
+          &kOp5Params, &kOp5InputDims, &kOp5FilterDims, &kOp5OutputDims),
+      0);
+  TFLITE_DCHECK_LE(
+      arm_convolve_wrapper_s8_get_buffer_size(
+          &kOp6Params, &kOp6InputDims, &kOp6FilterDims, &kOp6OutputDims),
+      256);
+  TFLITE_DCHECK_LE(
+      arm_depthwise_conv_wrapper_s8_get_buffer_size(
+          &kOp7Params, &kOp7InputDims, &kOp7FilterDims, &kOp7OutputDims),
+      0);
+  TFLITE_DCHECK_LE(
+      arm_convolve_wrapper_s8_get_buffer_size(
+          &kOp8Params, &kOp8InputDims, &kOp8FilterDims, &kOp8OutputDims),
+      256);
+  TFLITE_DCHECK_LE(
+      arm_avgpool_s8_get_buffer_size(kOp9OutputDims.w, kOp9OutputDims.c),
+      256);
+  TFLITE_DCHECK_LE(arm_fully_connected_s8_get_buffer_size(&kOp11FilterDims), 0);
+}
+
+TfLiteStatus KwsModelAot::Invoke() {
+  int8_t* const tensor0 = reinterpret_cast<int8_t*>(arena_ + kTensor0Offset);
+  int8_t* const tensor22 = reinterpret_cast<int8_t*>(arena_ + kTensor22Offset);
+  int8_t* const tensor23 = reinterpret_cast<int8_t*>(arena_ + kTensor23Offset);
+  int8_t* const tensor24 = reinterpret_cast<int8_t*>(arena_ + kTensor24Offset);
+  int8_t* const tensor25 = reinterpret_cast<int8_t*>(arena_ + kTensor25Offset);
+  int8_t* const tensor26 = reinterpret_cast<int8_t*>(arena_ + kTensor26Offset);
+  int8_t* const tensor27 = reinterpret_cast<int8_t*>(arena_ + kTensor27Offset);
+  int8_t* const tensor28 = reinterpret_cast<int8_t*>(arena_ + kTensor28Offset);
+  int8_t* const tensor29 = reinterpret_cast<int8_t*>(arena_ + kTensor29Offset);
+  int8_t* const tensor30 = reinterpret_cast<int8_t*>(arena_ + kTensor30Offset);
+  int8_t* const tensor31 = reinterpret_cast<int8_t*>(arena_ + kTensor31Offset);
+  int8_t* const tensor33 = reinterpret_cast<int8_t*>(arena_ + kTensor33Offset);
+  int8_t* const tensor34 = reinterpret_cast<int8_t*>(arena_ + kTensor34Offset);
+
+  // Operator 0: CONV_2D
+  {
+    const cmsis_nn_context ctx = {arena_ + kOp0ScratchOffset, 160};
+    if (arm_convolve_wrapper_s8(
+            &ctx, &kOp0Params, &kOp0Quant, &kOp0InputDims, tensor0,
+            &kOp0FilterDims, kTensor17Data, &kOp0BiasDims, kTensor3Data,
+            &kOp0OutputDims, tensor22) != ARM_CMSIS_NN_SUCCESS) {
+      return kTfLiteError;
+    }
+  }
+  // Operator 1: DEPTHWISE_CONV_2D
+  {
+    const cmsis_nn_context ctx = {nullptr, 0};
+    if (arm_depthwise_conv_wrapper_s8(
+            &ctx, &kOp1Params, &kOp1Quant, &kOp1InputDims, tensor22,
+            &kOp1FilterDims, kTensor5Data, &kOp1BiasDims, kTensor4Data,
+            &kOp1OutputDims, tensor23) != ARM_CMSIS_NN_SUCCESS) {
+      return kTfLiteError;
+    }
+  }
+  // Operator 2: CONV_2D
+  {
+    const cmsis_nn_context ctx = {arena_ + kOp2ScratchOffset, 256};
+    if (arm_convolve_wrapper_s8(
+            &ctx, &kOp2Params, &kOp2Quant, &kOp2InputDims, tensor23,
+            &kOp2FilterDims, kTensor18Data, &kOp2BiasDims, kTensor6Data,
+            &kOp2OutputDims, tensor24) != ARM_CMSIS_NN_SUCCESS) {
+      return kTfLiteError;
+    }
+  }
+  // Operator 3: DEPTHWISE_CONV_2D
+  {
+    const cmsis_nn_context ctx = {nullptr, 0};
+    if (arm_depthwise_conv_wrapper_s8(
+            &ctx, &kOp3Params, &kOp3Quant, &kOp3InputDims, tensor24,
+            &kOp3FilterDims, kTensor8Data, &kOp3BiasDims, kTensor7Data,
+            &kOp3OutputDims, tensor25) != ARM_CMSIS_NN_SUCCESS) {
+      return kTfLiteError;
+    }
+  }
+  // Operator 4: CONV_2D
+  {
+    const cmsis_nn_context ctx = {arena_ + kOp4ScratchOffset, 256};
+    if (arm_convolve_wrapper_s8(
+            &ctx, &kOp4Params, &kOp4Quant, &kOp4InputDims, tensor25,
+            &kOp4FilterDims, kTensor19Data, &kOp4BiasDims, kTensor9Data,
+            &kOp4OutputDims, tensor26) != ARM_CMSIS_NN_SUCCESS) {
+      return kTfLiteError;
+    }
+  }
+  // Operator 5: DEPTHWISE_CONV_2D
+  {
+    const cmsis_nn_context ctx = {nullptr, 0};
+    if (arm_depthwise_conv_wrapper_s8(
+            &ctx, &kOp5Params, &kOp5Quant, &kOp5InputDims, tensor26,
+            &kOp5FilterDims, kTensor11Data, &kOp5BiasDims, kTensor10Data,
+            &kOp5OutputDims, tensor27) != ARM_CMSIS_NN_SUCCESS) {
+      return kTfLiteError;
+    }
+  }
+  // Operator 6: CONV_2D
+  {
+    const cmsis_nn_context ctx = {arena_ + kOp6ScratchOffset, 256};
+    if (arm_convolve_wrapper_s8(
+            &ctx, &kOp6Params, &kOp6Quant, &kOp6InputDims, tensor27,
+            &kOp6FilterDims, kTensor20Data, &kOp6BiasDims, kTensor12Data,
+            &kOp6OutputDims, tensor28) != ARM_CMSIS_NN_SUCCESS) {
+      return kTfLiteError;
+    }
+  }
+  // Operator 7: DEPTHWISE_CONV_2D
+  {
+    const cmsis_nn_context ctx = {nullptr, 0};
+    if (arm_depthwise_conv_wrapper_s8(
+            &ctx, &kOp7Params, &kOp7Quant, &kOp7InputDims, tensor28,
+            &kOp7FilterDims, kTensor14Data, &kOp7BiasDims, kTensor13Data,
+            &kOp7OutputDims, tensor29) != ARM_CMSIS_NN_SUCCESS) {
+      return kTfLiteError;
+    }
+  }
+  // Operator 8: CONV_2D
+  {
+    const cmsis_nn_context ctx = {arena_ + kOp8ScratchOffset, 256};
+    if (arm_convolve_wrapper_s8(
+            &ctx, &kOp8Params, &kOp8Quant, &kOp8InputDims, tensor29,
+            &kOp8FilterDims, kTensor21Data, &kOp8BiasDims, kTensor15Data,
+            &kOp8OutputDims, tensor30) != ARM_CMSIS_NN_SUCCESS) {
+      return kTfLiteError;
+    }
+  }
+  // Operator 9: AVERAGE_POOL_2D
+  {
+    const cmsis_nn_context ctx = {arena_ + kOp9ScratchOffset, 256};
+    if (arm_avgpool_s8(
+            &ctx, &kOp9Params, &kOp9InputDims, tensor30, &kOp9FilterDims,
+            &kOp9OutputDims, tensor31) != ARM_CMSIS_NN_SUCCESS) {
+      return kTfLiteError;
+    }
+  }
+  // Operator 10: RESHAPE
+  // Tensor 32 is tensor 31 reshaped; nothing to do.
+  // Operator 11: FULLY_CONNECTED
+  {
+    const cmsis_nn_context ctx = {nullptr, 0};
+    if (arm_fully_connected_wrapper_s8(
+            &ctx, &kOp11Params, &kOp11Quant, &kOp11InputDims, tensor31,
+            &kOp11FilterDims, kTensor16Data, &kOp11BiasDims, kTensor1Data,
+            &kOp11OutputDims, tensor33) != ARM_CMSIS_NN_SUCCESS) {
+      return kTfLiteError;
+    }
+  }
+  // Operator 12: SOFTMAX
+  arm_softmax_s8(tensor33, 1, 12, 1242899200, 24, -124, tensor34);
+  return kTfLiteOk;
+}
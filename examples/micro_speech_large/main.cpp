@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include "pico/stdlib.h"
 
@@ -28,11 +29,13 @@ void FillInputPattern(int8_t *buffer, size_t size)
 
 void Error_Handler(void)
 {
-
+#ifdef TFLM_HOST_PLATFORM
+    exit(1);
+#else
     while (1) {
         sleep_ms(100);
     }
-        
+#endif
 }
 
 int main(void)
@@ -195,11 +198,13 @@ int main(void)
     uint64_t total_avg_time = (total_memcpy_time + total_inference_time + total_postprocess_time) / num_inferences;
     printf("Average total loop time: %llu microseconds\r\n", total_avg_time);
 
+#ifndef TFLM_HOST_PLATFORM
     while (1)
     {
         // Infinite loop - keep LED on to show program is running
         sleep_ms(1000);
     }
+#endif
 
     return 0;
 }
\ No newline at end of file
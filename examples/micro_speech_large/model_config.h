@@ -44,6 +44,12 @@ namespace ModelConfig
         return "KWS Large";
     }
 
+    // Key of the model in benchmark reports and benchmarks/baseline.json
+    constexpr const char *GetBenchmarkName()
+    {
+        return "micro_speech_large";
+    }
+
     // Initialize the op resolver with required operations
     template <unsigned int N>
     inline void InitializeOpResolver(tflite::MicroMutableOpResolver<N> &resolver)
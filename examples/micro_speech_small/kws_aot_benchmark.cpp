@@ -0,0 +1,162 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <cstdint>
+#include <new>
+
+#include "model_config.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_time.h"
+#include "tensorflow/lite/micro/system_setup.h"
+
+#if defined(KWS_BENCHMARK_INTERPRETER)
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#else
+#include "kws_model_aot.h"
+#endif
+
+/*
+ * Start-up and invoke cost of the keyword model, compiled ahead of time
+ * (micro_speech_small_aot_benchmark) or run by MicroInterpreter
+ * (micro_speech_small_interpreter_benchmark, built with
+ * KWS_BENCHMARK_INTERPRETER). The two executables differ only in how the
+ * model runs, so comparing their sizes compares the flash each way needs.
+ *
+ * Start-up counts the ticks from nothing to a model ready to invoke: for the
+ * interpreter that is the op resolver, the interpreter and AllocateTensors(),
+ * for the compiled model its constructor.
+ */
+
+namespace tflite {
+namespace {
+
+constexpr int kWarmupIterations = 2;
+constexpr int kTimedIterations = 20;
+constexpr uint32_t kRandomSeed = 42;
+
+#if defined(KWS_BENCHMARK_INTERPRETER)
+using KwsOpResolver = MicroMutableOpResolver<ModelConfig::kOpResolverSize>;
+
+constexpr const char* kRunner = "interpreter";
+
+uint8_t op_resolver_buffer[sizeof(KwsOpResolver)];
+uint8_t interpreter_buffer[sizeof(MicroInterpreter)];
+
+class KwsRunner {
+ public:
+  ~KwsRunner() {
+    if (interpreter_ != nullptr) {
+      interpreter_->~MicroInterpreter();
+    }
+  }
+
+  TfLiteStatus Start() {
+    KwsOpResolver* op_resolver = new (op_resolver_buffer) KwsOpResolver();
+    ModelConfig::InitializeOpResolver(*op_resolver);
+    interpreter_ = new (interpreter_buffer)
+        MicroInterpreter(GetModel(ModelConfig::GetModelData()), *op_resolver,
+                         tensor_arena, ModelConfig::kTensorArenaSize);
+    return interpreter_->AllocateTensors();
+  }
+  int8_t* input() { return interpreter_->input(0)->data.int8; }
+  size_t input_bytes() { return interpreter_->input(0)->bytes; }
+  TfLiteStatus Invoke() { return interpreter_->Invoke(); }
+  size_t arena_used_bytes() { return interpreter_->arena_used_bytes(); }
+
+ private:
+  MicroInterpreter* interpreter_ = nullptr;
+};
+#else
+constexpr const char* kRunner = "aot";
+
+alignas(16) uint8_t aot_arena[KwsModelAot::kArenaSize];
+uint8_t model_buffer[sizeof(KwsModelAot)];
+
+class KwsRunner {
+ public:
+  TfLiteStatus Start() {
+    model_ = new (model_buffer) KwsModelAot(aot_arena);
+    return kTfLiteOk;
+  }
+  int8_t* input() { return model_->input(0); }
+  size_t input_bytes() { return KwsModelAot::kInputBytes[0]; }
+  TfLiteStatus Invoke() { return model_->Invoke(); }
+  size_t arena_used_bytes() { return KwsModelAot::kArenaSize; }
+
+ private:
+  KwsModelAot* model_ = nullptr;
+};
+#endif
+
+void FillRandom(int8_t* buffer, size_t size, uint32_t seed) {
+  uint32_t state = seed;
+  for (size_t i = 0; i < size; ++i) {
+    state = state * 1664525u + 1013904223u;
+    buffer[i] = static_cast<int8_t>(state >> 24);
+  }
+}
+
+}  // namespace
+}  // namespace tflite
+
+int main(int argc, char** argv) {
+  tflite::InitializeTarget();
+
+  while (true) {
+    tflite::KwsRunner runner;
+    const uint32_t start_ticks = tflite::GetCurrentTimeTicks();
+    const TfLiteStatus start_status = runner.Start();
+    const uint32_t startup_ticks = tflite::GetCurrentTimeTicks() - start_ticks;
+    if (start_status != kTfLiteOk) {
+      MicroPrintf("%s start-up failed", tflite::kRunner);
+      return 1;
+    }
+
+    tflite::FillRandom(runner.input(), runner.input_bytes(),
+                       tflite::kRandomSeed);
+    for (int i = 0; i < tflite::kWarmupIterations; ++i) {
+      runner.Invoke();
+    }
+    uint32_t min_ticks = UINT32_MAX;
+    uint64_t total_ticks = 0;
+    for (int i = 0; i < tflite::kTimedIterations; ++i) {
+      const uint32_t invoke_start = tflite::GetCurrentTimeTicks();
+      if (runner.Invoke() != kTfLiteOk) {
+        MicroPrintf("%s invoke failed", tflite::kRunner);
+        return 1;
+      }
+      const uint32_t ticks = tflite::GetCurrentTimeTicks() - invoke_start;
+      min_ticks = ticks < min_ticks ? ticks : min_ticks;
+      total_ticks += ticks;
+    }
+
+    MicroPrintf(
+        "%s %s: startup %u ticks, invoke min %u mean %u ticks, arena %u "
+        "bytes, %u ticks per second",
+        ModelConfig::GetBenchmarkName(), tflite::kRunner,
+        static_cast<unsigned>(startup_ticks), static_cast<unsigned>(min_ticks),
+        static_cast<unsigned>(total_ticks / tflite::kTimedIterations),
+        static_cast<unsigned>(runner.arena_used_bytes()),
+        static_cast<unsigned>(tflite::ticks_per_second()));
+
+#ifdef TFLM_HOST_PLATFORM
+    // One pass is enough on the host; the board repeats for late consoles.
+    break;
+#endif
+  }
+  return 0;
+}
@@ -0,0 +1,88 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "model_config.h"
+#include "tensorflow/lite/micro/aggregating_micro_profiler.h"
+#include "tensorflow/lite/micro/benchmarks/micro_benchmark.h"
+#include "tensorflow/lite/micro/benchmarks/micro_benchmark_report.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/system_setup.h"
+
+/*
+ * Keyword spotting benchmark. Runs the model of this example on a fixed
+ * pseudo-random input and prints per-node statistics and a JSON report for
+ * benchmarks/check_benchmarks.py.
+ */
+
+namespace tflite {
+
+using KwsOpResolver = MicroMutableOpResolver<ModelConfig::kOpResolverSize>;
+using KwsBenchmarkRunner = MicroBenchmarkRunner<int8_t>;
+using KwsProfiler = StaticAggregatingMicroProfiler<32>;
+
+constexpr int kWarmupIterations = 2;
+constexpr int kTimedIterations = 20;
+constexpr int kRandomSeed = 42;
+
+uint8_t op_resolver_buffer[sizeof(KwsOpResolver)];
+uint8_t benchmark_runner_buffer[sizeof(KwsBenchmarkRunner)];
+
+// Placement new into global buffers, as in the person detection benchmark,
+// avoids the locking that function-local statics bring.
+KwsBenchmarkRunner *CreateBenchmarkRunner(MicroProfilerInterface *profiler) {
+  KwsOpResolver *op_resolver = new (op_resolver_buffer) KwsOpResolver();
+  ModelConfig::InitializeOpResolver(*op_resolver);
+  return new (benchmark_runner_buffer) KwsBenchmarkRunner(
+      ModelConfig::GetModelData(), op_resolver, tensor_arena,
+      ModelConfig::kTensorArenaSize, profiler, /*num_resource_variables=*/0,
+      /*log_arena_timeline=*/true);
+}
+
+}  // namespace tflite
+
+int main(int argc, char **argv) {
+  tflite::InitializeTarget();
+
+  while (true) {
+    tflite::KwsProfiler profiler;
+    tflite::KwsBenchmarkRunner *benchmark_runner =
+        tflite::CreateBenchmarkRunner(&profiler);
+    benchmark_runner->SetRandomInput(tflite::kRandomSeed);
+
+    const char *model_name = ModelConfig::GetBenchmarkName();
+    if (benchmark_runner->RunIterations(tflite::kWarmupIterations,
+                                        tflite::kTimedIterations,
+                                        profiler) == kTfLiteOk) {
+      profiler.Log();
+      MicroPrintf("");  // null MicroPrintf serves as a newline.
+
+      const tflite::MicroBenchmarkResult result = {
+          model_name, tflite::kWarmupIterations, tflite::kTimedIterations,
+          benchmark_runner->arena_used_bytes(), ModelConfig::kTensorArenaSize};
+      tflite::LogMicroBenchmarkJson(result, profiler);
+      MicroPrintf("");  // null MicroPrintf serves as a newline.
+    } else {
+      MicroPrintf("%s failed", model_name);
+    }
+    benchmark_runner->~MicroBenchmarkRunner();
+
+#ifdef TFLM_HOST_PLATFORM
+    // One pass is enough on the host; the board repeats for late consoles.
+    break;
+#endif
+  }
+  return 0;
+}
@@ -0,0 +1,1502 @@
+// Generated by tools/aot_compile.py from
+//   examples/micro_speech_small/kws_model_data.cc.
+// Do not edit; regenerate with:
+//   python3 tools/aot_compile.py \
+//      examples/micro_speech_small/kws_model_data.cc --class-name KwsModelAot \
+//      --header examples/micro_speech_small/kws_model_aot.h --source \
+//      examples/micro_speech_small/kws_model_aot.cc
+
+#include "kws_model_aot.h"
+
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "third_party/cmsis_nn/Include/arm_nnfunctions.h"
+
+namespace {
+
+// Arena plan: offset, bytes and the operators that use each buffer.
+constexpr int kTensor2Offset = 0;  // 4000 bytes, ops 1..2
+constexpr int kTensor9Offset = 0;  // 4 bytes, ops 3..4
+constexpr int kTensor3Offset = 4000;  // 1960 bytes, ops -1..1
+constexpr int kTensor6Offset = 4000;  // 4 bytes, ops 2..3
+
+// Operator 1: DEPTHWISE_CONV_2D
+// first_weights/read
+alignas(16) const int8_t kTensor8Data[640] = {
+    -6, -18, 40, -60, -18, -2, -49, 15, 30, -9, 31, 6,
+    13, -19, -23, -125, 92, -55, 24, -29, -7, 20, 40, 42,
+    9, -14, 24, 52, 98, -22, -17, -42, 54, -73, 30, -9,
+    59, 34, 40, 57, -62, -99, -15, 7, 94, 11, 30, 44,
+    7, -35, -3, -61, -40, 74, -13, 40, -89, 22, -43, -15,
+    -61, 5, -3, 39, -52, -70, 30, -53, -41, 61, -44, 41,
+    0, -3, 40, 68, -5, -14, -13, -74, 79, -49, 9, -16,
+    -6, 69, 65, 73, 5, -59, 23, 93, 100, 0, -8, -18,
+    72, 23, -12, -23, 46, 75, 46, 63, -33, -18, -28, 8,
+    56, -15, 22, 19, 47, 42, -19, -62, -65, 54, -12, 2,
+    -49, -86, -46, -6, -84, 19, -10, -24, -75, 104, 18, -74,
+    -50, 14, -33, 88, -28, 73, 20, 21, 3, -19, -6, -44,
+    64, -89, -10, -54, -5, 0, 77, 94, -28, 85, 29, 48,
+    69, -30, -4, 1, 72, -127, -23, -15, 30, -4, 33, 50,
+    -19, 75, -19, -6, 47, -46, -6, -5, 77, -89, -19, -57,
+    -110, -33, -26, -37, -8, 31, -39, -6, -111, -11, -27, -59,
+    -116, 23, 15, -71, -46, -57, -2, 104, -45, 81, 46, 73,
+    31, -67, 1, -21, 49, 23, -16, -17, -1, -72, 93, 98,
+    2, 15, 31, 120, 106, -80, -7, -2, 79, -52, -45, -1,
+    10, -106, 30, 44, -19, -68, -12, 11, 66, -56, -15, -22,
+    110, 88, -20, -60, -103, -82, -36, -41, 18, -121, -40, 6,
+    -94, -62, -26, -94, -127, 36, -23, -84, -50, -74, 21, 107,
+    -70, 0, 25, 88, 41, -74, -2, 1, 37, -106, -46, -20,
+    14, -100, 96, 95, -23, -12, -11, 105, 107, -75, -31, -10,
+    94, -73, -79, -27, 17, -101, 24, 16, -29, -31, -32, 13,
+    79, -91, -34, -27, 111, -30, -5, -103, -126, -91, -55, -74,
+    31, 70, -13, 4, -58, -54, -42, -105, -112, 29, -64, -107,
+    -16, 25, 48, 119, -62, 60, -6, 36, 2, 77, 6, 7,
+    21, 2, -80, -25, 39, 34, 103, 77, -15, -62, -12, 100,
+    56, 64, -33, -10, 58, 67, -72, -31, 13, 21, 17, -2,
+    -11, -20, -7, -27, 34, 54, -28, -3, 109, -65, 13, -114,
+    -73, 21, -65, -97, 22, -83, 10, 2, -114, 20, -38, -101,
+    -114, -61, -90, -54, -11, 127, 81, 86, -63, -77, -39, 53,
+    -8, 127, 4, 10, 3, 63, -66, -18, 25, 104, 120, 80,
+    -7, -89, -9, 127, 29, 118, -37, -24, 51, -71, -41, -25,
+    -24, 105, 21, -9, -11, -78, -2, -24, -13, 91, -30, 6,
+    110, 9, 54, -73, -52, 56, -65, -118, 40, 20, 46, 24,
+    -89, 38, -53, -78, -107, 55, -84, -51, -41, 81, 103, 68,
+    -51, 49, -34, 4, -23, 106, 0, 19, 10, 12, -35, 22,
+    -32, 36, 126, 73, -15, -75, 4, 82, 1, 80, -35, -11,
+    38, -55, -12, -8, -42, 49, 27, -48, -17, 3, 10, -64,
+    -44, 79, -30, -3, 114, -12, 90, -55, -41, 49, -64, -114,
+    23, 94, 87, 0, -76, 58, -56, -46, -110, 50, -53, -40,
+    -61, -90, 99, 38, -49, -68, -24, 87, -101, -23, -9, 28,
+    -22, 18, -15, -9, -37, -71, 127, 22, -10, -32, 8, 112,
+    -94, -19, -52, -15, 30, 16, 4, -9, -87, -73, 52, -86,
+    10, -37, 42, -90, -74, 16, -22, -8, 94, 6, 114, -35,
+    -48, -71, -42, -96, 16, -97, 90, 23, -79, -25, -64, 1,
+    -99, 1, -32, -32, -81, -100, 70, -40, -81, -24, -50, 2,
+    -118, -69, -28, -10, -13, 54, 7, -54, -53, -121, 110, -52,
+    -42, -98, 10, 42, -127, -41, -49, -64, 4, -21, 36, -52,
+    -55, -107, 51, -127, -9, -83, 28, -100, -92, -42, -7, -26,
+    61, -124, 127, -52, -44, -80, -12, -94, -23, 60, 54, -18,
+    -43, -49, -51, 45,
+};
+// Conv2D_bias
+alignas(16) const int32_t kTensor0Data[8] = {
+    -374, 169, -48, 208, 82, 6, -1201, -694,
+};
+const int32_t kOp1Multiplier[8] = {
+    1653229999, 1516545207, 2000799311, 1159928266, 1498403863, 1285645282,
+    2146175029, 1756589032,
+};
+const int32_t kOp1Shift[8] = {
+    -10, -12, -10, -10, -10, -10, -10, -10,
+};
+const cmsis_nn_dw_conv_params kOp1Params =
+    {128, -128, 8, {2, 2}, {3, 4}, {1, 1}, {-128, 127}};
+const cmsis_nn_per_channel_quant_params kOp1Quant = {
+    const_cast<int32_t*>(kOp1Multiplier), const_cast<int32_t*>(kOp1Shift)};
+const cmsis_nn_dims kOp1InputDims = {1, 49, 40, 1};
+const cmsis_nn_dims kOp1FilterDims = {1, 10, 8, 8};
+const cmsis_nn_dims kOp1BiasDims = {1, 1, 1, 8};
+const cmsis_nn_dims kOp1OutputDims = {1, 25, 20, 8};
+
+// Operator 2: FULLY_CONNECTED
+// final_fc_weights/read/transpose
+alignas(16) const int8_t kTensor7Data[16000] = {
+    -1, -7, -3, 10, 7, 8, 7, 3, 7, -14, -47, 9,
+    -16, -23, 40, 9, -33, 5, -6, -16, -24, -29, 19, 14,
+    8, -17, -45, -18, 15, -24, -21, 20, -9, -19, -3, 31,
+    -24, -43, -21, -4, 14, -12, -9, 7, 5, -22, -10, 31,
+    -8, -37, -36, 11, 3, -35, -40, -13, 15, 25, -31, 9,
+    -4, -28, 2, 4, -15, 4, -21, -13, 30, 6, -3, 17,
+    -4, -6, -10, 31, 15, 2, -11, -9, -1, 36, -33, -9,
+    -8, -13, -10, -23, -17, 3, -35, -14, 40, -31, -14, 34,
+    -12, 9, -9, -7, -16, -44, -7, -18, -1, 20, -38, -13,
+    17, -30, -10, 12, -14, -21, -8, -24, -29, 8, 2, 23,
+    -12, 11, 12, 39, -26, 2, 3, -7, 20, 24, -10, -21,
+    31, 12, -15, -18, -4, 8, -16, -2, -3, -18, 23, -3,
+    28, -17, -3, -34, 4, 5, -16, 49, -6, 11, -36, 13,
+    -19, -11, -6, -12, 8, 12, -41, 30, 21, 3, -11, 2,
+    -12, -5, -19, 1, -2, -42, 31, -3, -3, 14, -6, 6,
+    -15, -7, -30, 22, -23, -15, 3, 13, 13, -33, -7, 26,
+    14, -10, -4, 10, 25, -30, -32, 9, 21, -16, -15, 6,
+    -15, -31, -17, 26, 8, -24, -3, 18, 20, 6, -15, -4,
+    -22, -5, -9, -22, 29, 9, -6, -10, 8, -14, -25, -8,
+    -4, 22, -11, 14, 8, -7, 10, 3, 38, -40, 2, -11,
+    -10, -10, -17, 31, -28, -30, -5, 2, 27, -26, -34, 0,
+    -14, -19, -5, 24, -28, 22, 26, 29, -15, -10, -22, 22,
+    5, -34, -5, 24, -11, -28, -2, -30, 27, 28, 12, -24,
+    2, -18, -5, 7, 36, -14, -23, -6, 13, 5, -15, 3,
+    -2, -10, 25, 6, -1, -7, 4, -5, 21, -17, -15, -8,
+    -23, -31, 16, 4, -4, -26, 31, -19, 11, -17, 0, 30,
+    -26, 22, -13, 9, -3, 8, 8, 6, 6, 35, -33, -4,
+    8, -12, -22, 12, -14, -26, 24, -11, 2, -7, 80, 9,
+    1, -38, 11, 5, 18, 24, -17, 4, 14, -39, -1, -36,
+    -10, 22, -7, -12, -20, -1, -22, -26, -6, 10, -19, -17,
+    2, -16, 37, 33, -15, 38, -11, -19, 9, -22, -22, 36,
+    -6, 17, -4, -33, -13, 10, 40, 12, 25, -1, -11, -42,
+    14, -30, 42, 6, -6, 3, -7, -26, -17, 35, -7, -6,
+    -26, -2, -4, 3, 6, 26, -7, 8, -32, -27, -1, 5,
+    1, -25, 18, 2, 29, 5, 3, 5, 11, -18, -19, -4,
+    15, -13, 2, -32, 21, -33, 2, -19, 16, 38, -17, 13,
+    6, -18, -17, -10, -21, 17, 9, -12, -9, 6, 15, 1,
+    42, 11, 1, -35, -4, -12, -15, 23, 3, 4, 7, -4,
+    34, -4, -34, -2, 11, 3, -13, -5, 12, 37, 4, 25,
+    4, 3, 1, -6, -5, -9, -10, 14, 21, 14, 9, -1,
+    6, -6, -5, 30, -5, 5, 34, -7, -2, -9, 29, -19,
+    -33, 24, 9, -21, -17, 4, 18, -22, -33, -5, -38, -10,
+    -33, 23, -17, -17, -31, 26, -39, -30, -30, -4, 5, 17,
+    -10, -18, -24, -14, -31, 8, 38, 4, -19, 3, -32, -5,
+    -18, 12, -18, -10, 4, 45, -14, -45, -12, -32, -8, 12,
+    -2, 17, 11, -41, -3, 24, 7, 13, 7, 8, -12, -58,
+    10, 10, 31, 12, -12, 29, 2, 11, 9, 14, 33, -1,
+    23, 11, 13, -14, -19, -41, 10, -8, 3, 6, -6, -27,
+    -3, 3, 20, 15, -23, 26, -12, -38, 1, -26, 9, 6,
+    17, 13, -3, -21, 22, 35, -6, 0, 11, 23, -9, -38,
+    -41, 27, -6, 1, 3, 5, -2, -42, 2, -18, -18, 2,
+    -13, 6, -19, 3, -20, 1, -14, 15, 5, 23, 11, -5,
+    15, 5, 3, 19, -1, 6, 2, -11, -12, 24, 43, -16,
+    0, 23, -4, -3, 5, 11, 14, 20, -31, 36, 8, 36,
+    -26, -21, 33, 18, -5, 18, -25, -12, -24, 14, 24, -18,
+    -11, -13, -39, -13, -37, -20, 12, 30, -49, 20, -37, -29,
+    -36, 2, 12, -5, -37, 27, -48, -2, -7, -2, 42, -11,
+    0, 11, -51, -32, -30, 14, 4, -8, -38, 28, -27, 15,
+    -24, -12, -9, 21, 6, -8, 2, -9, 15, -5, 23, -7,
+    -38, 1, -38, -47, -10, 2, -3, 22, -15, -28, -6, 7,
+    -18, 10, -13, -3, -14, 35, -16, -31, 10, 26, 18, 31,
+    -17, 39, 9, -15, 12, 19, 35, -3, -11, 3, -2, 9,
+    -3, 22, -8, 7, 8, 37, 8, -8, -10, 10, -15, -11,
+    7, 9, 5, -52, -8, 8, 19, -7, 29, 17, 15, -36,
+    -18, -13, 39, -7, -7, 34, -6, 13, -30, 19, -5, 17,
+    3, 30, -1, -5, -19, -15, 14, 11, 15, 0, 6, -32,
+    21, -13, 19, -4, 24, -7, -1, 9, -6, 31, 18, -27,
+    -30, 6, -7, -12, 7, 21, 11, 4, -37, 13, -21, -13,
+    -26, 6, -27, -18, -40, 34, -40, 16, -22, -7, 28, -9,
+    -45, 17, -61, -8, -34, 5, 0, -26, 7, -3, -45, 3,
+    -22, -32, 19, 20, -49, -21, -51, -45, -34, -11, -16, 12,
+    12, -6, -21, -45, -5, -3, 8, -7, -12, 16, -6, -45,
+    -12, 17, 17, -8, -17, -8, -8, -15, -4, -31, -9, 18,
+    4, -12, -5, -19, -17, 12, -3, 28, -2, 14, -3, -30,
+    -2, 10, 2, -2, -26, 31, -17, -27, -26, -8, 22, 39,
+    -24, 32, 5, -29, -15, -17, -18, -19, 13, 17, 22, -5,
+    -13, -1, 20, 1, -1, 21, 16, 2, -27, 40, 41, 19,
+    19, 22, -26, 0, -46, 38, -3, 3, 4, 5, 7, 6,
+    -15, 14, 5, 13, -30, 15, 2, -31, 7, -9, 28, -6,
+    20, 48, -9, -18, 0, -6, 61, 6, 28, 4, 6, 7,
+    5, 26, 16, -10, -18, 10, -21, 4, -21, -33, 29, 9,
+    -43, -24, -42, -12, -16, 15, 29, -22, -14, -8, -90, 11,
+    -36, 9, 8, 36, -18, 36, -86, -28, -53, 21, -17, -25,
+    -23, 12, -49, 6, -29, 18, 17, 0, 7, 20, -41, -34,
+    -10, 15, 11, 4, -5, 13, -8, 13, -10, 27, -15, 33,
+    -35, -4, -12, -23, -8, -24, -9, 6, 3, 30, -50, -31,
+    -22, -10, 5, -7, 22, 21, 4, -32, 20, -9, 30, 28,
+    10, 39, -17, -13, 15, -13, -18, 4, -8, -15, 7, -29,
+    5, 11, 0, 28, 21, 39, 7, -9, -6, 11, -6, -6,
+    23, 19, -31, -11, -5, 12, 33, 47, -41, -5, -11, -3,
+    -45, -12, 7, 14, -3, 11, -4, -6, -11, 14, 2, -6,
+    -6, 25, -3, -6, -4, 19, 36, 12, -28, 49, -8, 18,
+    -12, 4, 24, 41, 39, 25, -4, 8, 17, -29, 7, -2,
+    38, 64, 5, 2, 4, 2, 15, -18, -12, 39, -22, -12,
+    -11, 17, 38, 11, -25, 5, -46, -10, -22, -6, 11, -7,
+    -6, 22, -70, 0, -5, 13, 11, -7, -26, -10, -59, -8,
+    -10, 1, 15, -19, -19, 19, -51, 13, -38, 6, 23, -18,
+    7, 29, -72, -6, -30, -22, -14, -18, 4, 0, -36, -48,
+    -5, -11, -20, -2, -15, 13, -16, -37, -7, 13, 3, 3,
+    14, 10, -38, -42, 1, -14, 6, 20, 28, 31, -24, -24,
+    14, -3, 12, -11, -13, 61, -13, 5, 16, -6, 27, 24,
+    8, 54, 9, -15, -21, -7, 34, 1, -13, -9, -1, -16,
+    12, -23, 1, 41, 33, 21, 3, -18, -23, 26, -9, 21,
+    6, 37, -6, -16, -28, -15, 31, 1, -36, 45, -50, -23,
+    -22, 11, 6, 44, 10, 48, -25, 9, -12, -16, 16, 41,
+    -7, 61, -25, -36, -28, -9, 59, 39, 35, 58, 10, 6,
+    14, -3, 44, 7, 43, 28, -6, 0, -7, 17, -22, 20,
+    -21, -4, 24, 3, -15, 22, 18, 4, -49, 18, -35, -28,
+    14, -16, 9, -24, -13, -5, -88, -7, -18, -5, 30, 29,
+    -3, 5, -85, -27, -1, 1, -2, 4, -7, 2, -71, -36,
+    -33, 5, -15, -17, -15, 30, -57, -18, -9, 30, 0, 0,
+    -8, 16, -20, -24, 4, 15, -10, -1, 4, 9, -32, 10,
+    14, -28, -16, -15, 22, 43, -45, -31, 10, -17, -7, -2,
+    11, 34, -11, 1, 10, -8, 2, 0, 23, 25, -13, 5,
+    33, -6, -18, -18, 18, -14, -6, -11, 5, 18, -18, -28,
+    40, -6, -15, 3, 21, 22, 24, -3, 15, 33, 4, -12,
+    -27, 12, 6, 19, -34, 54, -24, -5, -25, -3, -10, 18,
+    14, 29, -22, -8, -44, -24, 25, 7, -27, 28, -9, 12,
+    -17, 5, 15, 9, -35, 26, -22, -41, -7, -7, 18, 23,
+    46, 16, 8, -2, 20, -11, 29, -6, 6, 51, -19, -2,
+    -9, 17, -16, 21, -30, 36, -10, 10, -30, -4, 35, 18,
+    -35, 17, -3, -27, 8, -1, 21, -10, -15, 27, -82, -2,
+    -26, 21, 44, 45, 21, 21, -59, -8, -22, -25, 7, 4,
+    -2, 40, -95, -14, -31, -7, -8, -1, -12, 34, -76, -37,
+    3, 32, -26, -13, 14, 25, -29, 10, -6, -18, -13, -27,
+    -40, -7, -15, -34, 6, 5, -14, -11, -25, 22, -40, -2,
+    7, -22, -18, 14, -6, -1, -37, -25, 3, -19, 1, -3,
+    9, 26, -6, -26, 5, 16, -23, 1, 31, 19, -9, -10,
+    -5, 19, -1, -37, -19, -2, 10, 16, 9, 41, -11, 4,
+    -11, 38, 13, 12, -7, 22, -6, 2, -12, 46, -34, -11,
+    -31, 29, -5, 2, 11, 35, 7, -22, -39, 10, -13, 10,
+    15, 30, -25, -15, -41, 11, -10, -1, 13, 36, -52, 10,
+    -18, -38, 20, 18, 17, 41, -12, 26, -17, 11, -6, -20,
+    12, 27, -12, -1, -11, -17, 15, 16, -44, 4, -7, -8,
+    -20, -7, 33, 5, -45, 39, -13, 23, -1, -10, 21, -7,
+    -19, 10, -84, 2, -3, -5, 4, 41, 6, 3, -72, -26,
+    -43, 23, 9, 27, -10, 27, -85, -36, -33, -3, 6, 9,
+    9, 55, -69, -19, 25, -41, -30, -35, 5, 1, -20, -5,
+    -28, 14, -21, -16, 3, 23, 4, -21, 9, -18, -21, -25,
+    12, 22, -53, 14, 23, -40, -31, -8, 43, 25, -34, -21,
+    16, -14, -1, -8, -18, 14, -25, -16, 21, 8, -8, -33,
+    6, 13, -7, 20, -6, 11, 4, -3, 21, 35, 32, -1,
+    -3, 29, 12, -15, -2, 21, 10, 2, -19, -2, -5, 4,
+    -5, 30, -35, 5, -32, 22, -7, -10, -3, 50, -36, -14,
+    -45, 8, -12, -20, 23, 37, -30, -16, -18, -15, 13, -2,
+    19, 45, 1, 17, -44, -28, 7, -5, 50, 17, 20, 7,
+    -41, 2, 16, -21, 43, 29, 1, -4, -13, -16, 19, 26,
+    -37, 32, 0, -16, -16, 5, 22, 3, -44, -29, -62, -16,
+    6, 2, 30, 10, -20, 31, -85, -22, -6, -29, 32, 34,
+    3, 27, -77, 14, -29, -13, 29, 39, -29, 16, -89, -38,
+    -13, 0, 10, 10, 4, -5, -78, 15, 12, -11, 7, -1,
+    19, 30, -37, -10, -7, -17, -24, -25, -5, 24, -21, -20,
+    9, -38, -15, -16, 11, 4, -31, -6, 28, 37, -18, 1,
+    11, 41, -41, 12, 4, 11, -17, -3, 28, -4, -15, -5,
+    11, 15, -33, -19, 23, 56, 12, -41, -1, -3, 1, -4,
+    -5, -5, 24, 26, 24, -29, -7, -12, -6, 32, 6, 9,
+    17, 8, 29, -8, -6, 29, -11, 28, -11, -2, 3, 7,
+    -28, 51, -56, 12, -31, 19, -1, -27, 16, 44, -45, -16,
+    -19, 4, 7, 1, -15, 22, -32, 19, -6, 17, 7, -6,
+    25, 22, 1, 0, 7, 38, 0, -20, 29, 35, 5, -12,
+    7, 23, 44, 29, -18, -16, 12, 9, -29, 26, 36, 11,
+    -13, 30, -50, -2, -2, 18, 33, 26, -10, 35, -61, 3,
+    -12, 16, 26, 42, -12, 8, -65, -1, 4, -12, 11, 29,
+    26, -8, -52, 0, -9, 19, -12, -3, -12, 25, -67, -17,
+    12, 13, 2, -4, 18, 19, -23, -25, -11, -6, -6, -10,
+    26, 46, -50, -44, 1, 18, -3, -4, 38, 16, -52, -25,
+    -18, 19, -18, -1, -17, -22, 0, 14, 26, 23, 4, 12,
+    4, 12, -26, -13, -10, -37, -35, 4, -12, 34, 17, 22,
+    -13, 7, -20, -8, -14, 7, 3, 2, -11, 10, -10, 2,
+    29, 27, 17, 6, -8, 6, 2, -22, -13, 29, -50, 0,
+    -19, -7, -17, -10, -20, 34, -57, -16, -19, -37, -32, 2,
+    17, 7, -24, -16, -47, -19, -1, -3, 12, 46, -44, -19,
+    -20, 14, -15, 7, 1, 14, 14, -2, -38, 11, 10, 10,
+    31, 46, 19, 7, 0, 7, 20, 33, -23, -4, -16, 30,
+    -41, -22, 52, 7, -58, 12, -44, -20, -3, 6, 36, 10,
+    -13, 21, -81, -1, -23, -15, 13, 62, -23, 24, -70, 19,
+    -19, -41, 11, 49, 5, 14, -81, 19, -42, 14, 16, 2,
+    2, 20, -53, -43, -7, 12, -7, 14, 31, 36, -43, -21,
+    -1, -15, -11, 12, 8, 7, -12, -41, 6, 16, -24, -17,
+    -4, 47, -18, -15, 24, -8, -12, 2, 17, 33, -45, 18,
+    20, -28, -12, 2, 5, 36, -54, -14, -13, -21, -25, -8,
+    22, 26, -21, 13, 5, 22, -15, -20, 17, 28, 9, 30,
+    -32, -26, -6, 14, 13, 42, -22, 46, -19, -7, -9, 22,
+    9, 5, -35, -42, 2, -21, -11, -13, -28, 59, -19, 4,
+    -32, 14, -3, 9, -3, 53, -36, 24, -13, 4, -6, 5,
+    21, 52, -27, -31, -28, -12, -32, -7, 8, 50, 4, 8,
+    -12, 15, -1, 8, 9, 47, 6, 2, -3, 5, 12, 36,
+    -29, 30, -11, 12, -35, -8, 24, 32, -40, 20, -17, -12,
+    23, 8, 37, 20, 4, 6, -80, -11, -11, 9, 15, 62,
+    -1, 40, -77, -11, 25, -40, 20, 33, -39, -9, -73, -27,
+    -2, -25, 7, 30, 4, 21, -59, -7, 20, 32, -21, 1,
+    1, 24, -50, 0, -26, -30, -9, -5, -13, 13, -45, -13,
+    4, -8, -16, 3, -15, 37, -75, -17, 5, -32, 1, -10,
+    4, 22, -47, 1, 10, 33, 1, 5, 14, 1, -16, 10,
+    -13, 0, 3, -8, -6, 3, 11, -34, -2, -1, -5, -22,
+    9, 2, -11, -24, -25, 8, 0, -11, -8, 15, 19, -6,
+    -21, -24, -5, 31, 8, 22, -26, -6, -31, 0, 3, -35,
+    -15, 38, -27, 29, -39, -1, -14, -8, -1, 51, -22, -27,
+    3, 12, 7, -7, -8, 15, -31, 30, -35, 15, 0, -15,
+    6, 33, 9, 5, -13, -20, -26, 4, 7, 50, -15, -7,
+    -14, 1, 24, 31, -46, -30, 10, -12, -54, -4, 40, 22,
+    -62, 16, -14, -4, 8, -23, 42, 15, -6, -11, -87, 7,
+    -20, -23, 25, 67, 11, 28, -90, -23, -12, 22, 13, 43,
+    -4, 17, -102, -31, -15, 28, -11, 15, -28, 24, -64, -39,
+    20, 38, -26, -8, 10, 23, -20, -5, -31, 34, -33, -14,
+    -2, 30, -44, -21, -41, 14, 8, -10, -17, -4, -26, -44,
+    -9, 11, -5, -11, 1, 37, -41, -5, 13, -2, -1, -13,
+    29, 50, -2, -18, 18, -14, 12, -20, 2, 16, -17, 1,
+    -14, 11, -13, -9, -6, 37, -5, 13, 17, 21, 4, -4,
+    12, 33, 18, 41, 0, -6, -10, -11, 6, 34, -22, -30,
+    -18, 0, -3, -16, 11, 29, -45, -28, -28, 10, -4, -24,
+    -22, 44, -19, -19, -17, -24, -14, 5, -3, 21, -40, -38,
+    -54, -18, -6, 0, -2, 14, -14, -16, 14, -11, 4, 3,
+    29, 43, -18, 5, 15, 16, 19, 53, -30, 4, 16, -33,
+    -49, -21, 64, 38, -28, 3, -13, -7, -11, 20, 36, 42,
+    -33, -2, -85, -27, -2, 28, 39, 53, -37, -1, -84, 1,
+    -10, -4, 25, 26, 17, 31, -88, -11, 2, 15, 26, 31,
+    -9, -14, -94, 0, 21, 34, -28, 19, 0, 9, -39, -43,
+    2, 25, -3, -8, -25, -1, -5, -32, -17, -9, -18, -13,
+    -13, 25, -80, -33, 0, 15, 8, -13, 21, 23, -20, 15,
+    17, 20, 2, 8, 16, 23, -26, 8, -9, 0, -19, -9,
+    41, 7, 16, 5, 5, -25, -19, -12, -7, 21, -7, -16,
+    8, 0, 3, 9, 33, 40, -10, 14, -5, -13, 3, -9,
+    15, 12, -16, -11, -29, -40, -8, -14, 9, 28, -25, -5,
+    -28, -10, -6, -8, -15, 66, -10, -38, -35, -41, -6, -1,
+    47, 44, -38, 10, -34, -20, -15, 20, -5, 29, -21, -18,
+    -14, -21, -13, -19, 14, 53, -16, 6, 25, 4, 47, 35,
+    -30, 7, 19, 15, -23, -16, 34, 46, -39, 26, -53, -19,
+    -3, 4, 39, 30, -10, 7, -106, -42, -40, 17, 24, 86,
+    -46, -5, -110, -4, 11, 10, 23, 44, -27, 4, -94, -8,
+    -30, 4, 26, 13, -21, 17, -94, -27, -27, -8, 2, -9,
+    23, 3, -54, -23, 12, 31, -2, -11, 24, 18, -35, 8,
+    21, -1, -4, -10, -31, 29, -30, -31, -2, -4, 3, -1,
+    -14, 35, -46, 1, 19, -35, -13, -12, -14, 7, -17, 3,
+    21, 33, -40, -8, 9, -13, -24, -22, -24, -14, 8, -16,
+    4, 26, -14, 25, -5, 27, 21, -4, 29, 48, -27, 30,
+    9, -24, -23, 9, -9, 42, -31, 14, 0, 33, -13, -1,
+    -5, 1, -33, -14, -2, -12, -4, -16, 11, 11, -35, -28,
+    -46, 20, -9, -2, 11, 57, 1, -26, -28, 39, -6, -28,
+    4, 44, -30, 4, -11, 7, -14, 3, -16, 16, -11, -10,
+    -4, 22, 34, 27, -8, 17, -28, 9, -10, -16, 65, 30,
+    -49, 4, -22, -18, 14, -10, 27, 47, -57, -15, -70, -17,
+    15, 22, 30, 57, 5, 30, -112, -26, 13, -6, 34, 63,
+    -29, 35, -91, -29, -23, 15, 5, 39, 2, 17, -103, 5,
+    -6, 5, 3, 1, -1, 38, -45, -9, -9, -7, 5, -12,
+    -17, 35, -46, -35, 5, 8, -6, -1, 3, 4, -67, -41,
+    20, 6, -17, 6, -27, 5, -22, -22, 2, -3, 13, 0,
+    8, -1, -25, -5, -2, 19, -2, -20, -7, 2, -13, -1,
+    -1, 8, 4, -19, 25, 29, -6, 10, 13, -14, 15, -20,
+    37, 28, -20, 11, 1, -1, 1, -10, 8, 9, -24, -30,
+    -20, 35, -27, -23, -16, 46, -67, -31, -17, 20, -23, -10,
+    -11, 29, -36, -29, -41, -4, -7, -14, -2, 36, -14, 5,
+    -43, -19, -23, -7, -6, 45, -16, -2, -18, -14, -24, -9,
+    6, 20, 1, 16, 6, -13, 14, 14, -62, 29, -14, 28,
+    -19, -29, 83, 33, -72, 12, -34, 3, 21, -21, 70, 57,
+    -33, -10, -93, -18, -10, -32, 51, 80, -35, 39, -97, 7,
+    19, -30, 31, 53, -19, 31, -73, 7, 17, -19, 23, 40,
+    -12, 32, -63, -20, -17, 22, 2, -6, -32, 27, -9, -37,
+    -3, 10, -25, -5, -25, 37, -30, -25, -8, -16, -18, -23,
+    2, 6, -55, -28, 20, -29, -30, -9, -8, -3, -35, -30,
+    8, 10, -28, 5, -11, 22, -25, 1, 0, 28, -25, -16,
+    -10, 25, -2, 12, -14, 6, 3, -24, 11, -2, -29, 25,
+    8, 26, 16, -3, 0, 33, -16, -21, 24, 2, -13, 4,
+    -16, 24, -37, 5, 1, -34, -19, -23, 35, 21, -81, -26,
+    -15, 10, -26, -22, 1, 24, -40, -3, -15, -26, -20, -11,
+    14, 30, -52, -4, -25, 0, -23, 17, 0, 48, -7, 20,
+    -12, 25, -35, -9, -9, 47, -12, -14, -1, 39, 21, 28,
+    -68, 47, -23, 20, -11, -24, 68, 48, -24, 29, -28, 24,
+    17, 0, 12, 43, -13, 41, -106, -32, 6, -18, 62, 85,
+    -36, 19, -104, -33, -16, -2, 23, 51, -24, 9, -93, 7,
+    -17, 14, 29, 55, -35, -2, -75, 0, -9, -32, -22, -3,
+    -3, 25, -68, -3, 21, -2, 1, -13, -43, 32, -65, -29,
+    21, 14, -16, -10, -14, 20, -52, -16, -9, 4, -14, -1,
+    11, 2, -46, -40, -6, -4, -27, 2, 0, -5, -16, -36,
+    30, 16, 2, 1, 0, 24, -23, -37, 30, -10, -4, 3,
+    -17, 10, 0, 22, 0, 15, -12, 22, -6, 11, -30, -6,
+    -32, 7, -5, 2, 33, 14, -35, 11, -22, -16, -21, -5,
+    25, 9, -44, -14, -17, 11, 0, -21, 26, 47, -22, 6,
+    3, -10, -8, -5, -2, 29, -22, -35, -19, -3, -5, -25,
+    -2, 24, -12, -4, 11, -10, -4, 11, -5, 40, 7, -1,
+    7, 30, 3, 33, -49, 34, 5, -26, -22, -25, 67, 46,
+    -25, 20, -5, 10, 30, -2, 44, 36, -43, -3, -98, -47,
+    -14, 28, 50, 81, 1, -13, -84, -31, -12, -27, 28, 55,
+    -15, 15, -89, -37, 0, -10, 15, 24, -31, 16, -55, -59,
+    -24, -21, -14, -3, -10, 2, -62, -1, 0, 25, 3, 15,
+    2, 34, -44, -25, 7, 15, -27, 26, 9, 11, -36, -46,
+    0, 5, -18, -8, -36, 20, -48, 10, 10, -6, -21, 4,
+    -13, 6, -34, 5, -5, -3, -29, -20, -3, 20, -41, 17,
+    14, -26, 6, -20, -34, 34, -41, 0, 3, -11, -11, 13,
+    1, 5, -22, 11, 22, 4, -1, 19, -13, 18, -46, -33,
+    11, -28, 6, -10, 8, 45, -45, -42, -25, 10, -20, -1,
+    -2, 1, -33, -12, -33, 28, -2, -7, -9, 19, -54, -1,
+    3, 6, -23, -9, 6, 8, -41, -13, -19, 8, -29, -3,
+    12, 17, 21, -5, 21, 8, 40, 64, -25, 13, 8, -20,
+    -24, 22, 103, 70, -56, 22, -15, 2, 36, 0, 58, 67,
+    -42, 18, -82, -25, -12, -8, 58, 101, -28, 12, -78, -17,
+    31, -24, 41, 89, -8, 17, -60, -31, -2, -6, 39, 67,
+    -55, 30, -69, -5, -13, 19, 21, 13, -15, 19, -51, -16,
+    7, 25, 7, 0, -40, -21, -65, -16, -4, -10, -17, 22,
+    1, 2, -63, -33, -3, -23, 6, 6, -15, 8, -41, -52,
+    -5, 14, -4, 20, -14, 26, -30, 13, -21, 9, 7, 16,
+    -26, 19, -21, -11, 21, 20, -21, -2, -7, 23, -46, -29,
+    30, -11, 4, 10, -15, 14, -34, -25, 1, 32, 12, -4,
+    -36, -7, -27, -23, -1, 29, 10, -2, -20, 37, -81, -46,
+    1, 22, -4, 23, -24, 30, -51, -39, -30, -15, -21, 8,
+    -1, 51, -27, -5, -21, 4, -2, -9, -3, 31, -18, -1,
+    -19, -8, -32, -1, -3, 43, 10, -11, 21, 29, -13, 63,
+    22, -10, -14, -18, -12, -17, -16, 86, 10, 26, -68, -4,
+    47, -5, -16, 86, 30, 14, -58, -24, 6, 11, 17, 98,
+    62, -7, -72, -55, -19, -21, 2, 99, 44, -3, -59, -23,
+    0, 23, 15, 55, -2, 32, -52, -32, -32, 14, -26, 32,
+    10, -3, -33, -18, 11, 2, -18, 31, -5, 6, -46, -19,
+    -2, -21, -4, 18, -3, 20, 0, -40, 8, -10, -20, 23,
+    -7, 16, 0, -39, 24, -15, -18, 15, -12, 3, -18, -21,
+    -16, -17, -14, 6, 4, 0, -12, 15, 9, 6, -9, 11,
+    -3, 1, 3, 3, -12, -10, -35, 20, 28, -17, -15, -35,
+    -9, 19, -39, 21, -17, 2, -46, -25, 5, 5, -30, 9,
+    -14, 17, -11, -70, -16, 4, -32, 1, 6, 16, -26, -17,
+    -4, 18, -7, -12, 27, 47, -29, 15, -41, -10, 11, 17,
+    -9, 12, 0, 6, 24, -17, 6, 3, 10, 9, -10, 26,
+    13, -19, -2, 44, 67, -12, -27, -34, -11, 2, 37, 90,
+    73, -44, -26, 36, 30, -9, 14, 92, 93, -16, -7, -28,
+    28, -21, 40, 127, 91, -20, -6, -37, 12, -11, 32, 73,
+    81, -31, -19, -26, 14, 38, 40, 51, 53, 5, -31, -28,
+    31, -4, -7, 57, 24, 4, -19, -19, 1, -25, -26, 8,
+    9, 3, -25, -7, 14, 6, -20, 8, 18, 26, -38, -17,
+    -33, -7, -30, 30, 28, 0, 18, -41, 1, -9, 33, 23,
+    19, 25, -34, -32, -20, 22, 1, 27, 6, 12, -16, -24,
+    24, 3, 6, 14, 9, -6, 3, -13, -35, 1, -5, 10,
+    42, -12, -10, -38, -23, -2, -23, 18, 25, -23, 5, -33,
+    0, -21, -14, 16, 12, -31, -51, -53, -14, 31, -39, 12,
+    -6, -5, -24, -34, 0, -4, -27, 0, 17, 2, -26, 23,
+    20, 0, -14, -3, 0, -31, 16, 36, 18, -20, -19, 30,
+    9, 24, 3, 12, 4, -12, 21, 15, 16, 24, -42, 41,
+    16, 4, 28, -17, 15, 12, -57, 4, -2, -21, -1, -11,
+    -29, 21, -2, -53, 16, -1, 18, -5, -28, -21, -7, 0,
+    2, -15, 20, 19, 1, 2, -7, 1, 6, 12, -11, 10,
+    30, 1, 25, 14, 5, -11, 10, -1, -1, -14, -5, -37,
+    -8, 6, 23, -14, -9, 13, 14, -12, -6, -9, 20, -37,
+    -32, -3, 8, 22, -9, 22, -4, 9, 39, 7, 9, -5,
+    10, -4, 12, -28, -37, -18, -1, 16, -13, 9, -6, -12,
+    35, -13, -12, 25, -1, -6, -1, 25, 15, 17, -19, -20,
+    -8, 15, 16, -13, -1, 11, -9, 6, 11, 14, 7, -28,
+    24, 10, 8, 14, 2, 10, 5, 25, 2, -13, -2, -2,
+    11, 15, -4, -6, 5, -7, -30, -7, 27, -9, 15, 7,
+    -4, 18, -2, 1, -3, -16, 4, -12, -3, 7, -14, 4,
+    4, 7, -17, 12, -19, 14, -10, -17, 8, 7, 4, -23,
+    -13, 32, -38, 21, -8, -1, -20, -32, -10, -1, -23, 8,
+    1, 16, -16, -4, -23, 8, -24, -11, -8, -27, 23, -26,
+    3, -4, 9, -11, -35, -14, -1, 5, -10, -8, -11, 7,
+    -4, -15, 4, -13, 19, -31, 15, -14, 10, -7, -3, 28,
+    -32, 17, 27, -26, -17, 5, 5, 12, 35, 16, 9, -2,
+    -9, 26, -15, -4, 17, 29, -1, 3, 3, -26, 7, 17,
+    12, 13, 22, 5, 5, 37, -13, 16, 16, 6, 9, -24,
+    26, -16, -18, 9, -1, 36, -9, -5, -26, 6, -6, 8,
+    3, 0, -14, 4, -16, -21, 20, 28, 3, 33, 20, 29,
+    -2, 3, -10, 2, 9, -1, 0, 19, -17, 16, 30, 11,
+    29, 28, -15, -10, -25, -3, 20, 1, -1, 19, -9, -4,
+    0, 33, -29, -21, 7, 14, 9, -15, -8, -3, 3, -18,
+    25, -3, -1, -5, -1, -22, -5, 7, -16, 10, 4, 4,
+    11, 18, -2, 11, -32, -1, -10, -27, -4, 17, -19, -3,
+    21, 3, -35, -37, 4, -2, -1, 14, -1, -6, -5, -27,
+    -17, -10, -2, 34, 15, -24, -2, -12, -3, -39, 3, 10,
+    -33, -49, -15, 20, 5, -3, -5, -13, -5, -5, 15, -8,
+    5, 9, 3, -9, 5, 5, 19, -5, -21, 35, -25, 24,
+    -5, 0, -2, -35, -23, -22, -45, -24, 26, -17, 1, -15,
+    9, 29, -40, -4, -38, 25, 3, -20, -27, -13, -19, 10,
+    -12, 19, 11, -9, 12, 0, -7, -22, -29, -2, -1, 13,
+    10, 27, -41, 23, -21, -23, 0, 14, -18, 36, -17, 9,
+    7, -16, -11, 7, -11, -11, 16, 23, 6, -9, -4, 2,
+    -5, -7, -25, 10, 38, -13, 1, 1, 9, 11, 2, 39,
+    -8, -18, -3, 28, -8, -14, 15, -4, 13, -32, -22, 2,
+    11, 0, -32, 8, -2, 16, 4, -2, -21, 19, 1, 12,
+    14, -19, 9, 1, 12, -29, 16, -33, -47, 20, -13, -17,
+    9, -16, -18, -27, 17, -12, -10, 0, -24, 32, 10, -4,
+    -22, -9, 2, 22, -25, -13, 13, -28, 4, -26, -17, -8,
+    15, 35, 2, -32, 1, 1, 1, 5, -11, 13, -11, -11,
+    -31, -1, 4, 0, -12, 13, -18, -15, -17, -9, 11, -1,
+    27, -20, 5, -25, -13, 19, 18, -14, -13, -4, -22, 6,
+    -2, 19, 18, -37, 17, -30, -4, 13, 28, -24, 29, -4,
+    -14, -30, 19, 29, -38, -10, 28, 24, 30, -12, -6, 3,
+    -36, 15, -1, -1, 24, 11, -19, -15, -8, 2, -12, 16,
+    -7, -21, 11, 14, 15, 1, 2, 27, 6, 16, 0, -25,
+    35, 13, -10, 17, 8, -11, 15, 5, 19, -9, 1, 1,
+    12, -10, -7, -16, 41, 1, -23, 17, 2, -6, -21, 22,
+    14, 16, 9, 14, 28, 10, -29, -45, 1, -29, 0, 6,
+    -30, -23, 25, -17, 18, -13, -4, 2, 11, 12, 13, -19,
+    -3, -10, -7, -23, -14, 40, -2, 3, -20, 3, 0, -8,
+    -34, 13, 37, 7, 26, -25, -3, 41, -40, -9, -5, -34,
+    12, 8, 6, 34, -18, 29, 5, 7, -16, -5, -2, 7,
+    -15, 4, -23, 1, -4, -15, 0, -21, -29, 8, -20, -2,
+    4, -21, -4, 1, -10, 14, -33, -8, 18, -29, 22, -36,
+    33, 10, -26, 6, -27, 16, 7, -9, 30, -34, -29, 7,
+    22, -19, 35, -14, 18, 13, -23, -7, -24, -2, 14, 2,
+    24, 10, -22, -20, -5, -2, 12, 27, 25, 32, -6, 7,
+    -27, 12, 4, 39, -37, -26, -2, 13, 10, 10, -2, 57,
+    -35, -34, 5, -20, 9, 5, 10, 44, -12, 2, 31, -45,
+    36, -18, 15, 60, -11, -3, -8, -8, 18, -11, -13, 25,
+    -7, -38, -10, 10, 10, -12, 9, 15, -4, 0, 1, 1,
+    -13, -8, 5, -13, 12, 25, 14, -3, -6, -31, -4, 12,
+    3, -5, 27, 6, -52, -28, 8, -7, 16, -23, 6, 0,
+    23, -24, 13, 18, -54, -11, 35, -28, 33, -10, 25, 51,
+    -35, -6, 12, 1, 20, 7, 0, 52, -38, 5, 7, 1,
+    7, -28, 6, 36, 2, -1, -16, 9, -4, -12, 3, 6,
+    -18, 8, -30, 29, -6, 12, -4, 2, 3, -27, -16, -30,
+    10, 24, 18, 12, 30, 32, -19, 32, -28, 1, 42, 9,
+    13, 14, -48, -12, -35, -3, 43, -14, 8, 12, -8, -9,
+    -4, -7, 21, -17, 25, 28, 1, -1, -30, 1, -13, 48,
+    14, -5, 21, -24, 28, 0, -6, 22, -17, -22, -5, 5,
+    -16, 14, 2, 19, -12, 1, 3, -27, 41, 7, 9, 36,
+    -7, -29, -8, -34, 45, -12, -11, 64, -19, -33, 7, -17,
+    15, 10, 11, 50, 13, -24, 0, -26, -10, -4, -3, 25,
+    17, 9, -13, 3, -22, -15, -5, 2, -3, 6, -1, -2,
+    9, -20, 6, 12, 21, -7, 6, -41, -29, -9, -19, 1,
+    3, -3, 20, 1, 14, -32, 55, 13, -46, 24, 47, -22,
+    18, 13, 5, 58, -43, 7, 30, -14, 33, 17, -7, 54,
+    -45, -11, 18, -10, -5, -10, 6, 15, -34, -7, 6, 9,
+    -33, -1, 11, -13, -11, 1, -15, -22, -14, 2, 18, -4,
+    14, -18, -8, -21, 0, -17, 33, 15, 9, -17, -21, 30,
+    -17, -14, 38, -7, 23, -15, -15, -16, 12, 16, 29, -1,
+    29, 6, 3, -10, -5, 20, 27, 3, 34, -3, -20, 3,
+    -6, -8, 1, 43, 30, 27, 9, 9, 7, -1, -16, 32,
+    -18, 20, -5, -10, -8, 17, -39, 41, -12, -6, 7, -17,
+    32, -7, -14, 48, -18, -16, -13, -42, 13, -2, 3, 54,
+    -11, -41, 1, -26, 4, -16, 5, 31, 15, -35, -1, -8,
+    31, -14, 4, 55, -6, 0, -3, -8, 16, -31, -5, 13,
+    -19, -10, -30, -2, 8, -2, 7, 8, 8, 17, 10, -16,
+    -8, -11, 4, -22, 8, 18, 6, 13, 15, 16, 64, 40,
+    -64, -5, 63, 8, 29, 9, 27, 61, -18, -12, 41, 19,
+    32, -4, 17, 76, -37, 2, 21, 5, -20, -21, 10, 34,
+    -25, 0, 2, 1, -44, -22, 10, -13, -29, -8, -11, -6,
+    1, 13, 25, 6, 36, 19, 2, -11, -15, -15, 27, 15,
+    25, 4, -29, -7, -25, 2, 41, -4, 41, -20, -23, 4,
+    -36, 34, 29, -3, 31, 1, -20, -24, -11, 20, 27, 25,
+    6, 14, 2, 13, -7, 6, -4, 21, 7, -6, 12, -31,
+    24, 26, -24, 27, -23, -17, 10, 24, -4, 5, -7, 20,
+    -36, 4, 1, -1, 7, -3, -16, 44, -14, -20, 14, -25,
+    26, 5, -24, 53, 19, 9, -7, 7, -2, -6, 13, 64,
+    12, -22, -12, 4, 1, 17, -4, 35, -21, -12, -23, 4,
+    -21, -25, 7, 9, -5, -15, -10, -3, 2, -6, 2, -1,
+    0, -1, -15, -15, 26, -23, 16, -29, 11, 12, 8, 4,
+    27, 10, 43, 16, -31, 1, 31, 6, 4, -20, 25, 73,
+    -18, -8, 34, 12, 32, 2, 7, 49, -25, -1, 15, -16,
+    -3, -22, 19, 38, -50, -6, -1, -18, -23, -2, 21, 8,
+    4, 5, 13, -6, -35, -8, 7, 11, 51, -17, -20, -7,
+    -39, -26, 29, 16, 65, -10, -33, 17, -29, 20, 29, -5,
+    43, 21, -36, 9, -10, 5, 22, 0, 28, 39, -28, -4,
+    -9, 22, 8, 8, 47, -35, -8, -6, -23, 14, 11, 11,
+    2, 18, 2, -3, 25, 3, -21, 17, -12, 9, 9, 21,
+    18, 13, -17, 28, -28, -2, 23, 12, 9, 4, -22, 47,
+    -14, 30, 2, -5, -2, -29, 0, 46, 4, -7, 12, 5,
+    39, 12, 7, 45, -9, 11, -5, -7, 28, -33, 17, 54,
+    5, -14, 2, -8, 11, 7, 5, -5, -4, 14, 19, -6,
+    -5, 9, -11, -3, 6, 21, -7, 3, 24, -3, 26, 10,
+    3, -30, -5, 0, 30, -2, 79, 39, -31, -9, 49, -16,
+    27, -20, 7, 95, -30, -8, 64, 5, 23, 36, 12, 60,
+    -13, 16, 19, -8, 11, -13, -7, 54, -31, -13, -12, -24,
+    -17, -8, -4, -21, -29, -5, -16, -18, -37, 6, 12, 17,
+    30, 16, -30, -23, -21, 13, 52, 15, 67, -39, -17, 8,
+    -20, 5, 29, 2, 51, -17, -12, -9, -26, -7, 34, 7,
+    4, 6, -23, 2, -16, -4, 36, 32, 36, 23, -26, 15,
+    5, -10, -4, 31, -14, 1, 13, -25, -1, 29, -16, -6,
+    -48, 0, -1, 14, 35, -7, -13, 17, -34, 13, 5, 4,
+    11, 11, -5, 38, 13, 13, -1, -24, 22, -24, 11, 60,
+    24, -28, 4, -1, -6, -13, -1, 64, -18, 6, -4, 13,
+    0, -9, 19, 63, -9, 19, 6, 8, -7, 19, -14, 25,
+    -3, -7, -13, -26, -4, 7, -10, -3, 10, 34, 0, 1,
+    25, -1, -25, -1, 8, -3, 3, -3, 31, -25, 40, 8,
+    -34, -13, 67, -10, 12, -2, 30, 82, -14, 4, 23, -14,
+    8, 13, 4, 56, -34, 12, 16, -17, -33, 15, 1, 36,
+    -34, -31, 13, -3, -44, -10, 18, 14, -19, 1, -16, -13,
+    -3, -1, 24, -13, 54, -38, -10, -17, -24, -17, 55, 39,
+    78, -8, -12, -1, -27, -13, 50, 11, 54, 8, -23, -10,
+    -30, 19, 33, -2, 18, -19, -35, -5, -8, 5, 15, 3,
+    28, 4, -4, -14, 35, 14, 3, -4, -7, 24, -9, 1,
+    27, 3, -11, -3, -34, -13, 25, -4, 17, 2, -25, 19,
+    -34, -40, -14, 5, 40, 2, 2, 39, 7, 8, -1, 7,
+    39, 14, 25, 64, -5, 2, 12, -10, 13, 7, 15, 71,
+    -8, 5, 14, -3, 3, 30, 7, 50, -25, -10, 36, 1,
+    1, 2, 10, -1, -10, 38, 21, -16, 4, 19, 3, -6,
+    -2, -10, -15, 9, 42, -26, -22, -10, 23, 19, -21, -1,
+    21, -21, 35, 6, -56, -10, 51, -21, -12, -25, 18, 42,
+    -29, -26, 50, -6, 22, 21, 23, 64, -15, 8, 26, -13,
+    -10, 12, 12, 17, -48, 34, 2, -18, -22, -12, -8, -7,
+    19, 16, 23, -11, -15, 10, 14, -3, 50, -38, -15, -30,
+    -37, -14, 52, 31, 83, -4, -28, -14, -10, -14, 29, 4,
+    74, -20, -18, 6, -33, 1, 26, 4, 39, -4, -26, -3,
+    -39, -3, 14, 0, 12, 22, -13, 3, -9, -4, 14, 15,
+    9, 6, 6, 4, 8, 2, -19, -11, -28, -26, 7, 6,
+    3, 24, -22, 19, -30, -6, 16, -14, 2, -20, 3, 60,
+    -10, -10, 10, 16, 9, -8, 21, 36, -3, 13, 9, 1,
+    0, -1, 0, 26, -16, -18, 8, 3, 29, 5, 22, 70,
+    -26, -8, 8, 0, 9, 9, -1, 1, -4, 32, -4, -20,
+    5, 27, 3, -15, 18, -28, -6, 36, 28, -11, -14, 5,
+    17, -25, -6, 2, 32, -22, 49, 16, -49, -40, 51, -18,
+    -1, 9, 32, 63, -30, 10, 41, -18, 58, -14, 30, 57,
+    2, 30, -2, -14, -17, -30, 13, 15, -15, 25, 2, -25,
+    -20, -1, -2, -28, -2, -5, 2, -10, -15, -12, 7, 26,
+    42, -7, 6, -7, -38, -12, 34, 2, 79, 10, -13, -4,
+    -13, -10, 37, 10, 40, 1, -9, 9, -26, 5, 40, -9,
+    30, -14, -18, 19, -18, 5, 15, 10, 9, -24, -24, 14,
+    5, 18, 15, 21, 2, -20, -8, 2, -9, 5, -8, -1,
+    -36, 0, 1, 0, 18, 23, -20, 25, -6, 9, -6, -13,
+    29, 11, 7, 37, -22, 12, -11, -6, 4, -9, -2, 51,
+    -2, 20, -17, 4, -16, 0, 0, 58, -22, -6, 16, 1,
+    -28, 0, -1, 35, -23, 38, 21, 16, 4, 20, 13, 8,
+    -8, -3, 16, -5, 0, 33, 6, -6, 15, 8, -15, 9,
+    40, -16, -40, 13, 8, 9, 2, -5, 18, 3, 14, -5,
+    -50, -16, 57, -27, 9, -10, 31, 53, -35, 28, 37, -17,
+    23, 12, -10, 62, -16, 33, 8, -1, -41, -4, -3, 31,
+    -27, 24, 18, -23, -11, -23, 18, -10, 2, 19, -12, 10,
+    -3, 3, 9, 8, 47, 7, -18, -3, -41, 0, 43, 41,
+    59, -37, -34, -15, -31, -9, 71, 18, 53, 12, -28, 9,
+    -17, 23, 43, -22, 45, -8, -24, 24, -17, 3, 17, 10,
+    16, -1, -24, 7, 12, 7, 3, 24, 5, 8, -8, -8,
+    6, 24, -23, -7, -32, 15, 13, 24, 4, 1, -16, 28,
+    -10, 20, -3, 18, 12, 12, 2, 52, -10, -26, -3, -7,
+    -7, -3, 0, 42, -4, -7, -1, 10, -2, 27, -11, 52,
+    -36, -7, 21, 19, -25, 27, -9, 37, -3, 9, 8, 10,
+    -16, 23, 15, 4, -12, -23, 6, 7, -11, 2, -4, -11,
+    9, -18, -15, 7, 56, 3, 5, 15, 22, 15, -19, -1,
+    33, -8, 52, 7, -47, -7, 39, 0, 12, 33, 24, 66,
+    -26, 2, 26, -15, 47, -15, 14, 59, -18, -8, 8, -22,
+    -2, -7, 3, 24, -11, -8, 13, -21, 1, 16, 9, 2,
+    21, -5, -15, 11, -14, 6, 8, 9, 47, 25, 2, -2,
+    -28, 6, 31, 23, 73, -14, -30, 2, -17, 4, 38, 22,
+    63, 8, -15, 10, -3, -7, 40, 1, 21, 11, -7, 16,
+    -36, 2, 32, -9, 22, -26, 9, 3, -15, -11, 18, 28,
+    -5, 42, 8, -6, 10, 22, -10, 21, -16, 6, 17, -3,
+    14, -7, -10, 18, -19, -13, -3, 31, 11, -6, 8, 48,
+    -8, -1, 11, -21, 16, -1, 7, 34, 13, 7, 9, 3,
+    -10, -8, -4, 38, -8, -18, 17, 2, 3, 10, -17, 56,
+    -2, 19, 27, 9, -2, 6, 5, -13, 4, -33, -4, 0,
+    -25, 21, -20, -15, -8, -4, -19, 5, 14, -13, 21, 9,
+    1, 13, -3, 0, 36, -30, 49, 19, -43, 27, 43, -24,
+    3, 8, 29, 51, -36, -3, 36, -28, 32, -6, 7, 51,
+    1, 18, 6, -11, -17, -9, -6, 19, 1, -20, -18, -32,
+    -3, 13, -1, 9, -10, 0, -19, 7, -22, 14, -1, 14,
+    38, -4, -16, -25, -25, -2, 48, -1, 36, 4, 6, -12,
+    -11, -8, 35, 14, 61, -14, -3, 4, -24, -5, 35, -2,
+    51, -31, 1, -3, -36, -5, 14, -6, 34, -5, 17, -6,
+    -1, 8, 33, 48, 19, 3, -14, 3, -8, 15, -20, 13,
+    -17, 15, 16, 16, 15, -10, -7, 30, -9, -27, 8, -6,
+    9, -1, 0, 21, 2, 0, 8, -2, -5, 14, 21, 40,
+    -6, -5, 19, 6, -5, 5, -10, 17, -10, 11, 6, 21,
+    -31, 0, -23, 15, -31, 29, 24, -3, 11, 15, -1, -14,
+    -11, -3, 20, -1, -12, -2, -30, -8, 20, 11, -21, 7,
+    53, -30, -21, 11, 4, 34, -2, 14, 29, -14, 36, 17,
+    -52, -20, 37, -9, -1, -7, 6, 41, -28, 7, 28, -37,
+    -8, 29, -6, 68, -14, 1, 15, -26, 17, 3, -18, 23,
+    6, -32, 12, -40, -23, -3, 17, -2, 7, -35, -22, -1,
+    -34, -35, 10, 9, 48, -14, 1, -28, -32, -21, 45, 18,
+    45, -21, -4, -16, -24, -7, 31, 8, 63, -21, 14, 19,
+    -7, 12, 28, 2, 37, -20, -10, 5, -13, -12, 24, 8,
+    18, -23, -5, -3, -7, 8, 19, 28, 8, -20, -2, 2,
+    -15, 25, -13, 29, -15, 7, 17, 18, -6, -14, -10, 13,
+    -1, 23, 10, -5, 31, -8, 17, 36, -10, -4, -2, 7,
+    -19, 5, 28, 33, -2, -2, 22, 13, 8, 15, 9, 51,
+    -12, 31, 20, 12, -2, -11, -21, 42, -18, -13, 18, 25,
+    -20, 1, 6, -9, 5, 34, 11, -21, -21, 6, -31, -11,
+    13, -18, -5, 10, 49, -1, -29, -22, 24, 9, -29, 7,
+    26, -8, 21, -4, -52, -14, 42, -27, 1, -22, 16, 31,
+    -39, 2, 19, -10, 22, 1, 14, 60, 2, 23, 4, -15,
+    -9, 2, 7, 12, 2, 31, -12, -26, -16, -23, 5, -12,
+    -3, -28, -9, -23, -4, -17, 6, 2, 38, -15, -15, -21,
+    -23, -26, 48, 28, 56, 15, 3, -15, 16, 4, 48, 25,
+    31, -5, -4, 5, -30, -2, 24, -14, 28, -14, -11, 14,
+    -14, 5, 29, 40, 18, -16, -16, 15, 10, 3, 26, 26,
+    -13, 8, 19, -17, -11, 28, 6, 0, -18, 18, 29, 3,
+    24, 6, 10, 14, -16, -21, -6, 13, 8, -1, 6, 36,
+    15, 3, 10, 15, 14, -1, 8, 51, -4, 0, 14, -5,
+    -5, 5, 7, 25, -24, -25, 18, 17, 21, -9, 12, 26,
+    -10, 40, 8, -21, -14, 37, -18, 1, 3, -20, -19, -6,
+    -16, -14, -17, -15, 2, 35, -17, 1, 65, -6, -12, -12,
+    21, -11, -11, -7, 40, -34, 32, -10, -57, -34, 33, -28,
+    -2, -20, 13, 44, -18, 36, 16, -16, 29, 18, 14, 43,
+    6, -8, -3, 1, 8, -17, -3, 15, -21, -19, -31, -33,
+    -15, -27, 22, -29, 8, -4, -10, -10, -40, -16, 35, -4,
+    43, -11, -1, -25, -12, -23, 41, 9, 43, 12, -1, 8,
+    11, -19, 41, 20, 60, -11, -21, 24, -10, 16, 34, -7,
+    23, 35, 2, 12, -10, -6, 47, -2, 30, -21, -3, 3,
+    -16, 7, 28, 9, -6, -31, 13, 15, 24, 3, -2, -16,
+    -20, 11, 16, 2, 20, 6, -17, -9, -22, 11, 5, -2,
+    31, 6, 14, 7, 0, -31, 1, 1, 7, 5, 9, -9,
+    -17, 21, -9, 18, 5, 3, 4, 29, 4, 16, 18, 6,
+    5, 0, 8, 24, -42, -14, -6, 7, -8, 18, 7, -3,
+    -35, 0, 4, -5, -8, 9, -13, 9, -5, -16, -24, 9,
+    39, -11, -8, 6, 1, 2, 14, -10, 31, -6, 41, -8,
+    -42, 1, 34, -8, 29, -29, 26, 57, 10, 13, 25, -11,
+    18, -5, 29, 42, 3, -10, 12, -14, -3, -20, 24, 19,
+    -2, 26, -24, -35, 1, -8, 48, 1, -8, -2, -28, -25,
+    -1, -21, 35, -6, 44, -16, -4, -25, 10, -8, 24, 16,
+    35, 1, -6, -24, -15, -6, 29, 14, 23, -25, -28, -11,
+    -7, 12, 23, 12, 19, -24, -31, 23, 25, 5, 11, 15,
+    35, -19, -1, -2, -32, 20, 22, 0, 13, 28, 11, -11,
+    -5, 24, -18, -1, -1, -13, 24, 12, 5, -6, -10, -2,
+    -2, -8, -8, 9, -17, -8, 14, -16, 0, -8, 12, -8,
+    -10, 7, 22, 17, -8, -22, -1, -1, 1, 32, 7, 8,
+    -3, 28, -4, 6, -19, 13, 8, 21, -16, 37, 1, 27,
+    0, 2, -2, 1, 5, 1, -3, -15, -27, 12, -28, -31,
+    -16, -6, -18, 14, 53, -18, 21, -17, 10, -7, 1, -11,
+    31, 5, 31, 13, -31, -12, -1, -11, 35, 2, 24, 48,
+    -4, -16, 13, 4, 13, 6, 41, 29, -7, 8, 6, -27,
+    19, -3, 13, 38, -17, 9, -36, -14, 5, -33, 12, -10,
+    -13, -39, -8, 8, -17, -21, 15, -7, 58, 3, -1, -32,
+    -9, -16, 21, 18, 65, 11, -15, 4, 4, -30, 14, 11,
+    44, 3, -22, 2, -5, -25, 8, -23, 34, -13, -14, 28,
+    -6, -13, 17, 4, 31, -11, 2, 15, 26, 31, 36, 11,
+    6, 31, -13, 6, 0, 2, -24, -10, -12, -24, 7, 46,
+    -5, -8, 16, 9, -16, 14, -1, -2, 28, 20, 23, 6,
+    -30, -15, -6, 1, 17, 19, 18, 41, -15, 15, 31, -6,
+    -3, -3, 2, 7, 14, -5, 14, 4, 1, 1, -19, -2,
+    -34, -3, 8, -17, -10, 10, -1, 15, -25, -14, 15, 2,
+    -22, 16, -7, -20, -3, 9, -22, 31, 70, -35, -30, -9,
+    8, -11, -9, -23, 51, -5, 47, -10, -75, 29, 21, -21,
+    17, -9, 42, 46, 8, 29, -12, -5, 21, -6, 34, 52,
+    -1, 6, -10, -3, -6, -7, 3, -11, -12, -12, -43, -22,
+    1, 8, 34, -15, -14, 6, -47, -27, 12, -17, 18, 3,
+    8, 2, -9, 5, 27, 7, 57, 52, 33, -30, -29, 11,
+    12, -10, 41, -9, 36, 10, -4, -1, 26, -3, 5, -1,
+    -1, 14, 10, 26, 9, -5, 21, 4, 3, -9, -2, 0,
+    -4, -5, 17, -6, 29, 14, 6, -19, -4, 35, -40, -14,
+    4, -27, 15, 22, 41, -2, -11, -20, -30, 14, -21, 9,
+    29, 17, 5, 17, -28, 41, 18, 2, 18, 25, 14, 26,
+    -18, -7, 5, 9, -11, -3, 5, 4, -28, -15, 23, 1,
+    -14, -2, 11, -12, 13, 4, 6, -2, -1, -20, -23, 0,
+    -1, 3, 3, -3, -15, 21, -4, -13, -1, -2, 9, -18,
+    60, 1, -20, 2, -16, -10, 32, -21, 22, 7, 50, -13,
+    -50, -16, 2, -44, 17, -26, 40, 14, -29, 33, -18, -50,
+    30, -39, 35, 38, 6, -6, -7, -15, 1, -26, 11, 7,
+    -36, 33, -68, -29, -17, -8, 18, -4, -26, -2, -11, -44,
+    21, 10, 0, 19, -4, -20, -13, -42, 26, -29, 33, 54,
+    42, 3, -23, -29, -1, 0, 19, 28, 14, 32, -27, -11,
+    36, 11, 32, 20, 19, -8, 4, 27, 47, 10, 21, 0,
+    -12, 26, 17, 13, 3, 24, 15, 24, 4, 31, -5, -14,
+    31, 21, 3, -5, 11, 23, -5, 11, 27, 31, -12, 7,
+    -7, -7, -8, -12, 20, 15, -10, -2, -35, 11, -1, 1,
+    24, 4, 27, 10, -19, -25, -7, 22, 2, 1, 0, -9,
+    -15, 7, -16, 6, -8, 11, 2, -13, -1, 32, -3, 1,
+    4, -11, -39, -12, -12, -14, -24, -1, 4, 0, -16, -30,
+    -2, -19, 27, -17, 32, -6, -5, -12, 2, 24, 7, -5,
+    -17, -28, 8, 13, -31, 14, 37, -58, -3, 12, 28, 11,
+    -16, 1, 28, -44, 17, -11, 27, 9, -5, -38, 19, -29,
+    -7, 16, 20, -16, -16, -3, 31, -49, -12, -28, -5, 14,
+    10, 17, -19, -36, -4, -26, -9, -4, 19, -31, 11, -28,
+    4, 17, -18, 33, 20, -31, 7, -28, -5, 8, 3, 43,
+    39, -10, 13, 2, 27, 9, 9, -8, 20, 25, 15, 11,
+    1, 16, 9, 18, 3, -11, 24, -13, -5, -11, 2, 14,
+    13, 0, 7, -4, 24, 37, 11, -16, -7, -26, 8, 1,
+    36, 20, -6, -19, -27, 31, 9, -2, 8, -18, 26, 26,
+    5, 0, -1, 12, -2, -7, 17, 17, -22, -2, 8, -7,
+    -16, -28, 1, 13, -15, 0, 11, -22, 25, -22, -13, -8,
+    8, 18, 28, 31, -5, -17, -16, -14, 20, -31, 3, -6,
+    -7, -38, -23, -4, -13, -1, 18, 4, -9, -4, 23, 15,
+    -4, 41, 3, -27, -14, -18, 30, -6, 4, -19, 37, -12,
+    -31, 21, 16, 30, -17, 28, 4, -34, -27, 8, 33, -3,
+    -3, -22, 3, -54, -38, 38, 0, 10, -3, 5, -16, -44,
+    -31, 26, -28, -11, 7, -25, -6, -33, -44, 3, -16, 16,
+    21, 12, -12, -19, -29, -5, 15, 30, 22, 9, 0, -20,
+    -22, 19, 22, 11, 1, -5, -1, 0, -5, 7, 19, 8,
+    -12, -28, 18, 0, -5, -6, -4, 8, -21, 25, 2, 28,
+    -24, 38, -13, 16, 9, 15, 25, 2, -5, -20, -9, -30,
+    -5, -6, 17, -13, 11, 8, -1, -39, -8, 18, 24, 6,
+    7, 34, -1, 25, -11, 11, 10, 19, -14, -6, 2, 33,
+    -21, 17, 23, 23, -20, -31, 14, -9, -24, -40, 14, 1,
+    -15, -19, -19, -16, 9, -9, -25, -3, -16, -7, -37, -18,
+    -36, -5, -8, 10, -11, 11, -44, -41, 8, 6, 24, 6,
+    12, 19, -3, 9, 19, 38, 18, -12, -17, 0, -11, 40,
+    24, -2, 4, 14, 33, 26, 10, 30, 9, -16, 13, 15,
+    -20, -13, 23, 34, 0, -20, 14, 1, -23, 8, 9, -14,
+    -14, 8, -16, 11, -39, 9, 20, -11, -10, 4, 25, -12,
+    17, -23, -14, 13, 32, 23, 10, 5, 12, 4, 1, -3,
+    -12, -5, 27, 12, -14, 11, -1, -2, 1, -40, -6, 14,
+    -11, 20, -7, 1, 4, -8, -6, 2, -24, -7, -7, -22,
+    -15, 7, -1, 30, 1, 11, -9, 10, -9, 12, -3, -20,
+    -13, 5, -8, -38, 11, 21, -10, -18, -7, 16, -6, -2,
+    8, -16, -26, -20, 5, -1, 21, 25, 31, 17, -4, 9,
+    8, 1, 6, -2, 4, 8, -5, -5, 8, -12, -10, 40,
+    16, -7, 40, 11, -8, 13, 1, 0, -1, 2, 5, 8,
+    -22, -23, -12, -10, 1, -22, -33, 31, -2, 10, -7, -9,
+    12, 27, 6, -19, -10, -14, 3, 3, -3, 4, -11, 16,
+    10, 11, -12, -8, -15, -25, 5, -2, -25, 11, -15, -20,
+    -12, -20, 6, -18, -34, 5, 27, -2, 19, -13, -39, -22,
+    4, 16, 5, -19, 21, 2, 11, 16, -6, 2, 5, 11,
+    2, 7, -4, -11, 21, 20, 5, -9, 12, -2, -10, -12,
+    -6, 6, -4, 19, -36, -28, 9, -6, 2, 35, -20, 6,
+    17, 19, -8, -6, 39, 40, 11, 35, -20, -15, 9, 23,
+    15, 19, -1, -14, -4, 10, -11, 13, 3, 38, 1, 15,
+    -2, -15, -5, -26, -16, 2, -14, -1, 2, 17, -1, -3,
+    28, 2, 11, -10, 20, 12, 11, 33, 40, -16, 17, 5,
+    6, -19, -7, 10, -14, -17, -8, -15, -2, 13, -7, -9,
+    -22, 0, 8, -37, 2, 15, -2, 4, -17, 32, 22, 1,
+    -24, -19, -28, 34, -10, 25, 0, 4, 1, 19, -21, 13,
+    -20, 1, 8, 5, 12, 14, -2, 2, 18, -9, 39, -7,
+    -3, 24, -2, 36, -9, 19, -19, 30, 9, -1, -40, -12,
+    18, -8, 4, 12, 28, 17, -3, 23, 29, 1, 19, -18,
+    17, -13, -8, 6, -10, 22, -2, 21, 22, -36, 31, 0,
+    37, -18, -1, -9, -10, 2, -35, 21, -15, 20, 8, -24,
+    -27, 33, -22, -16, 26, 7, -22, 8, -22, -28, 30, 0,
+    19, 23, -20, 17, -42, 17, 24, 23, 4, 21, 3, 58,
+    -42, 2, 7, 4, -26, -27, -2, 14, -1, -19, -4, -5,
+    -1, 28, 6, 10, -5, -7, -22, 26, 33, -11, 4, 6,
+    10, -29, 22, -22, 4, -30, -7, -7, -26, -5, 15, -4,
+    6, -5, 16, 7, 7, 19, 7, -4, 22, -17, 7, -36,
+    18, 31, 8, -12, -23, 20, 6, -9, -15, 12, 1, 12,
+    -26, 4, -13, -14, -27, -13, -17, 29, -10, 32, 7, -2,
+    -12, 5, -18, 16, -3, 14, 11, 2, 13, -40, 7, -5,
+    38, 10, 28, 33, 6, 31, -12, 6, 55, 24, -6, 22,
+    30, 36, -5, -16, 18, -7, 2, 9, 23, 22, -13, -7,
+    23, -14, 2, 10, 45, -25, -29, 37, -16, -7, 15, -35,
+    21, -26, 4, -4, -15, 23, 10, -22, 36, 7, -15, 17,
+    19, 41, -12, -59, -5, 7, -17, 19, 11, -31, -15, -21,
+    -8, 27, 9, 8, 31, 21, -14, 5, 2, -35, 9, 15,
+    22, 16, 1, 48, -14, -32, 39, -2, -15, 14, 14, 7,
+    -26, 7, 11, 24, -2, 15, 1, 7, -12, 7, 16, -25,
+    -5, -13, -9, 11, -7, 21, 24, 37, 12, 20, 2, 8,
+    10, 15, 16, -20, -18, 26, 3, 20, 15, -6, 37, -1,
+    24, 13, 11, -22, 31, 40, 16, 12, -25, -18, -9, -6,
+    3, 21, 12, 29, 1, 0, 18, -18, 1, -15, -8, 11,
+    -13, -3, 4, -8, 2, 30, 14, -13, 2, 16, -3, 7,
+    11, 9, 3, 16, 62, 8, 14, 12, -12, -25, -3, 28,
+    39, 26, -19, -31, 8, -36, -39, -15, 30, 7, 18, -15,
+    16, -5, -56, 8, 15, 3, 29, -36, 35, 4, -7, 10,
+    -1, 8, 14, -55, 57, 10, 1, 7, -20, -32, 5, -24,
+    20, -40, -31, -6, -42, -8, -19, -37, -1, 29, -11, 23,
+    15, 28, -36, -19, -1, -1, 4, 19, -11, -25, -46, 18,
+    -37, -31, 19, 17, 35, 14, -7, 49, -36, -17, 7, 10,
+    32, -14, -7, 19, -1, 28, 42, -33, -37, -25, 17, -14,
+    -3, -5, 40, 0, 21, 3, 2, 32, 7, -9, 25, 19,
+    19, -10, 9, -2, -3, 32, 20, -11, -11, -4, 20, 14,
+    23, -2, 21, 4, -7, -10, 29, -10, 27, -28, -18, -3,
+    0, -23, -18, -50, 15, 32, 5, 2, 13, 6, 5, -8,
+    -17, -33, 22, 23, -26, -15, 16, -13, 6, 4, -37, -5,
+    -25, -8, 2, 17, -1, 13, 10, -6, 39, 10, -4, -24,
+    17, 23, -16, 13, 13, -18, -33, -35, -15, 21, -42, -9,
+    0, -17, 46, -26, 36, -3, -43, 4, -16, 8, 8, -19,
+    34, 7, -31, 9, -48, 11, 24, -26, 63, 10, -27, -30,
+    -7, 8, 2, -42, 19, 21, -67, 0, 14, -8, -30, -54,
+    -20, 14, -26, -17, 21, 17, -53, -33, -7, 3, 34, 16,
+    -5, -7, -27, 8, -31, 17, 16, -4, -6, 0, -8, 48,
+    -27, 8, 20, -24, 18, -30, 4, 25, 11, -6, 51, -13,
+    -20, -2, -8, 37, -8, 33, 40, -17, 0, -34, -1, 43,
+    3, -4, 16, 12, -49, -3, 25, 10, 12, -14, -9, 12,
+    -3, 2, 28, -33, 38, 13, -16, 11, -50, 21, -5, -20,
+    39, -10, -7, -27, -30, -5, -3, -40, 40, -20, -23, -14,
+    -54, 9, 2, 6, 12, -6, 5, 1, -43, 10, 2, -5,
+    4, 23, -35, -2, -21, -15, 9, 16, 18, -1, 0, -32,
+    38, -9, -19, -12, 0, -14, -6, 7, 2, -11, 6, -24,
+    3, -3, -36, -14, -62, -1, 11, -42, 37, 4, -23, -16,
+    -39, 8, 9, -59, 35, 18, -10, 19, 17, -13, 24, -16,
+    52, -2, -2, -19, -22, 2, 23, -36, 27, 27, -22, -2,
+    -22, -2, -14, -60, -3, 4, -23, 13, 13, 9, -54, -44,
+    -31, 4, 30, -1, 15, -17, -42, 15, -43, -8, 38, -42,
+    51, -24, -11, 59, -15, -24, 57, -24, 8, -27, 1, 2,
+    4, -10, 25, 10, -48, -21, 11, 21, -9, 14, 35, -10,
+    -12, -40, -12, 23, 35, 37, 20, 1, -41, -3, -7, 31,
+    27, 17, 10, 24, -11, -11, 15, -32, 46, 1, -27, -37,
+    -30, -14, 20, -6, 42, 0, -30, -22, -3, 14, -4, -63,
+    53, 8, -10, -7, -20, 0, 6, 0, 11, -10, 1, -2,
+    -22, 11, 8, 5, -28, -22, -41, -3, -18, -13, 12, 12,
+    13, 2, -3, -18, 23, 16, 19, -3, 7, 3, -8, 12,
+    -44, -19, -2, 7, -12, -18, -12, 3, -62, 24, 44, -47,
+    51, -40, -37, -6, -19, 16, 28, -29, 55, 10, -22, -2,
+    -10, -17, 32, -19, 50, -9, -11, -13, -54, -3, 10, -49,
+    13, 16, -34, 7, 24, 16, -16, -42, 12, 4, -21, 26,
+    -7, 8, -60, -53, -28, 11, 25, -4, 41, -10, -20, 7,
+    -13, -19, 43, -23, -6, 2, -20, 43, -16, -14, 45, -24,
+    -19, 0, 18, 19, -19, 26, 61, -16, 5, 4, -4, 19,
+    16, 1, 64, -14, 6, 2, -7, 34, 36, -1, 24, 0,
+    -21, -24, 20, -7, 37, -32, -1, 3, -27, -3, 8, -22,
+    46, 11, 5, -25, -34, -28, -11, -22, 58, -12, -12, -25,
+    -19, -20, -8, -18, 48, 10, -37, 5, -9, 22, -1, -9,
+    -6, 31, -17, -28, -50, -8, 19, 4, -7, 1, -31, 3,
+    -7, -7, 8, 4, -6, -28, -25, -9, 40, -3, -3, 0,
+    -4, -5, -17, 10, -20, 12, 10, -46, 5, -5, -51, -5,
+    -99, -22, 28, -27, 37, -24, -22, 11, -16, -13, 13, -85,
+    73, 14, -21, 0, -30, 3, 41, -32, 61, 6, -9, -8,
+    -49, 12, 26, -42, 31, -17, -3, -1, -17, 12, -37, -32,
+    32, 6, -33, 26, -25, -4, -78, -47, -33, 19, 7, 31,
+    12, -9, -34, 10, -37, -33, 26, -11, 41, 13, -21, 44,
+    -49, 14, 38, -2, -17, 4, -11, 20, 9, 19, 52, -1,
+    -2, 14, 6, 14, 16, -7, 42, 11, -26, -2, -15, 26,
+    54, 41, 41, 5, 5, -40, 20, 18, 38, 11, 24, -1,
+    -41, -33, 15, -19, 49, -9, -4, -20, 11, -17, 12, -46,
+    48, -7, 4, -2, -17, -28, -5, -47, 50, -27, -18, -16,
+    12, -26, 19, -19, 30, 11, -28, -32, -6, -12, 20, -12,
+    24, -9, -39, -10, -19, -22, -4, 6, -4, -11, -19, -21,
+    5, 3, 27, 11, -1, 11, -17, 1, -15, 22, 5, 0,
+    -18, 10, -37, 16, -76, 20, 15, -31, 28, -3, -16, -8,
+    -61, 17, 23, -70, 71, 21, -26, 1, -22, -15, 12, 8,
+    74, 21, -16, -9, -22, 0, -11, -44, -15, -1, -32, 12,
+    -12, 23, -40, -22, 3, -1, -43, 24, -5, 7, -57, -55,
+    -35, -13, 21, 13, 34, -22, -37, 10, -42, 9, 29, -27,
+    45, 4, -4, 53, -58, 14, 51, -15, -41, -22, 1, 27,
+    14, 1, 42, -1, -17, -15, -9, 15, -1, 0, 59, -24,
+    10, -1, -12, 13, 31, 4, 23, -9, -33, -20, 18, 38,
+    54, 7, 12, 6, -25, -42, 19, -29, 48, 9, 0, -11,
+    -32, -13, 17, -30, 56, 13, -10, 5, -20, 5, 0, -27,
+    36, -17, -2, -8, 0, -40, 24, -15, 38, 11, -14, -4,
+    -32, -28, 6, 11, 26, 5, -58, -10, -24, -34, -2, 12,
+    3, 9, -2, -30, 24, 27, -5, -9, 6, -15, -2, -10,
+    -17, 27, 7, 13, 1, 10, -19, -16, -83, 26, 23, -42,
+    55, -3, -40, -20, -54, -15, 21, -60, 51, -15, -19, -16,
+    -23, 21, 13, -14, 54, -34, -3, 14, -5, 16, 15, -10,
+    -7, 12, -22, -16, -27, 11, -18, -63, 16, -12, -24, 31,
+    -18, 0, -48, -28, -25, 19, 7, 39, 18, -22, -22, 15,
+    -22, -12, 20, -18, -2, 9, -5, 49, -37, 27, 28, -25,
+    -17, -11, -9, 26, 6, 1, 44, -19, -5, 4, -6, 7,
+    25, -20, 43, 13, -4, -40, -4, 15, 31, -4, 45, -13,
+    -55, -38, 10, -2, 41, 0, -6, 9, -24, -10, 33, -13,
+    74, 26, -8, 0, -25, -16, 33, 1, 34, -13, 0, -23,
+    6, -29, 21, -41, 61, 12, 7, -15, -13, -20, 23, -33,
+    41, 27, -3, -2, -21, -19, 23, -10, 35, 10, -22, -18,
+    -7, -13, 15, 12, -8, -11, -19, -24, 28, 20, 7, 23,
+    11, 13, -19, -9, -19, 16, 7, -43, -14, 9, -42, -9,
+    -75, -10, 25, -55, 37, 21, -24, -11, -60, -7, 42, -80,
+    57, 14, 2, 17, -16, -9, 29, -21, 57, 16, 2, 21,
+    -32, 8, 1, -18, 28, 30, 8, 4, -14, 2, -24, -38,
+    -6, -5, -32, -2, 5, 2, -45, -54, -12, -20, 16, 22,
+    5, 13, -41, 9, -36, -10, 30, -8, 16, -19, -9, 39,
+    -11, 8, 40, -18, -20, -32, -8, 23, -5, 35, 46, -15,
+    -6, -11, -4, 26, 16, -9, 50, -5, -5, -24, -15, 3,
+    36, -21, 37, -7, -54, -15, -2, 1, 46, 7, 24, 3,
+    -27, -22, 16, -6, 59, 7, 15, 17, 4, -9, 29, -15,
+    36, -39, 8, -17, 2, -35, 7, -56, 44, 13, 6, -20,
+    23, -38, 33, -33, 52, -39, -5, -14, -12, -20, 14, 10,
+    15, 15, -37, -16, -5, -26, 15, 0, 4, -7, 1, 5,
+    5, -2, 8, -13, 14, -14, -5, 1, -3, 24, 29, -10,
+    -18, 6, -49, -4, -82, 39, 33, -46, 51, 3, -32, -32,
+    -55, -5, 58, -67, 77, 4, -24, -11, -26, -21, 25, -14,
+    75, 29, -4, -9, -39, -1, -2, -22, 15, 4, 14, 0,
+    -19, 25, -23, -23, -1, 17, -17, 20, 1, 23, -68, -75,
+    -17, 12, 34, 39, 15, 1, -44, 3, -50, 1, 37, -1,
+    -7, -16, 10, 28, -27, 15, 28, -18, -12, -15, -12, 12,
+    0, 8, 28, -12, -43, -15, -4, 31, 17, 0, 24, 3,
+    -9, -28, -1, 7, 9, 26, 24, -1, -22, -20, -3, 19,
+    43, -8, 12, -6, -33, -10, 17, -38, 42, -36, -4, -1,
+    -1, -20, 18, -31, 55, -3, -21, -2, -22, -47, 18, -6,
+    40, 26, 13, -16, -9, -32, 12, -21, 53, 20, -21, 0,
+    -21, -25, 27, -4, 9, 0, -14, 4, -7, -27, 26, 14,
+    8, 18, -8, -2, 9, 15, 13, -22, 3, -31, -2, -14,
+    -20, 13, 2, -37, 4, 29, -44, 1, -54, 19, 41, -54,
+    40, 4, -30, -15, -37, 11, 44, -51, 68, 0, -25, -12,
+    -48, 18, 21, -1, 66, 17, 5, -3, -39, 17, 28, -12,
+    21, -20, -14, 36, -42, 29, -20, -38, -11, -20, -27, 34,
+    -14, 11, -67, -48, -21, 5, 7, 27, 1, -19, -11, 2,
+    -49, 8, 21, -3, 28, -27, 4, 25, -57, 37, 34, -13,
+    -34, -5, -5, 32, -10, -21, 37, -2, -11, 8, -11, 23,
+    14, 4, 28, -7, -18, -20, -31, 6, 18, -1, 42, 19,
+    -19, -2, 5, 24, 37, 32, 9, 19, -22, -41, 5, 6,
+    51, 37, -1, 10, -16, -22, 23, -31, 48, -6, 13, 10,
+    4, 0, 14, -23, 22, 32, 13, 2, -24, -19, 7, -24,
+    60, -15, -39, -6, -31, -19, 24, -4, -16, 9, -29, 5,
+    -2, -47, 11, 14, -11, 37, -3, -5, 48, 30, 8, -4,
+    12, 33, -22, -4, -27, 30, 22, -11, -12, -4, -16, -22,
+    -60, 33, 39, -23, 43, -37, -37, -20, -27, -2, 55, -30,
+    70, 37, -6, -20, -28, -13, 25, -14, 76, 6, 0, -5,
+    -21, 16, 16, -9, 42, -8, -23, 24, -18, 33, -24, -43,
+    -12, 10, -19, 36, -2, -7, -78, -68, -13, 29, 0, 47,
+    7, 8, -31, -15, -19, 39, 39, -2, 34, -3, 2, 32,
+    -40, 5, 37, -20, -15, -1, 10, 15, -26, -2, 70, -3,
+    -31, -54, -9, 34, 3, 8, 33, -11, 15, -9, -5, 12,
+    -5, 20, 45, 3, -27, -28, 9, 11, 26, -26, 1, 40,
+    -23, -42, 11, -9, 44, -5, 17, -18, 11, -19, 23, -16,
+    60, -11, 8, -6, -8, -51, 23, -6, 57, -22, 17, -11,
+    -19, -18, 10, -20, 65, -42, -25, -7, -6, -56, 21, -9,
+    8, 14, -29, 8, -24, -20, -3, -2, -15, 0, -23, -12,
+    9, 38, 2, 22, -16, 1, -17, 1, -1, 3, 34, -37,
+    -4, -11, -34, -27, -60, 1, 40, -44, 56, 8, -48, -20,
+    -43, 4, 47, -50, 78, -21, -7, -25, -33, -16, 27, -11,
+    66, -15, -10, 9, -43, 10, 13, 8, 4, 5, -30, 14,
+    -41, 25, -37, -38, -31, 37, -34, 21, 14, 20, -67, -80,
+    -29, -27, 36, 30, -8, 13, -40, -9, -14, -1, 24, -11,
+    7, -16, 2, 37, -43, 30, 46, -33, -25, 5, -17, 17,
+    -24, -25, 71, -12, -31, -34, 9, 54, 26, 17, 17, -11,
+    18, -27, -25, 24, 1, 23, 42, 3, 5, -22, 9, 11,
+    18, 4, 23, -16, -18, -41, 17, -19, 60, 23, 22, -1,
+    2, -36, 33, -13, 46, -27, 19, -17, -20, -30, 16, -48,
+    46, -18, -1, 1, -32, -27, 11, -38, 31, -8, -10, -5,
+    7, -37, 5, -10, 12, -13, -16, 16, -7, -11, -14, 13,
+    16, -9, -10, -1, 43, 13, 6, 30, -13, 12, -23, 1,
+    -14, 35, -2, -23, -35, 18, -35, -9, -69, 34, 27, -44,
+    56, 41, -44, -49, -11, -7, 39, -35, 71, 0, -14, -27,
+    9, -4, 14, -7, 52, 10, 2, -3, -20, 37, 29, 3,
+    21, 9, -15, 27, -48, 23, -38, -38, -25, 7, -29, 21,
+    -15, 2, -71, -50, -26, 12, 16, 49, -2, -9, -39, -6,
+    -19, -19, 51, -12, 25, -25, -2, 63, -27, 6, 46, -26,
+    -14, -36, -11, 24, -26, 1, 47, -18, -25, -28, -2, 44,
+    3, -9, 32, 5, 7, -30, 6, 30, 5, -19, 47, 3,
+    -22, -8, 14, 12, 31, -1, 32, -12, -24, -31, 28, -20,
+    34, 30, 5, -3, -11, -54, 48, -23, 48, -28, 20, -1,
+    -14, -36, 23, -8, 38, -31, 11, 1, 17, -62, 2, -15,
+    54, 16, 2, 5, -19, -15, 21, -6, 23, -8, -9, -15,
+    -24, -45, -3, 8, -5, 39, -11, -11, 19, 6, 11, -16,
+    1, -7, -41, 14, -20, 18, -2, -3, -18, 37, -40, -15,
+    -78, 9, 28, -65, 52, -22, -56, -22, -37, 14, 36, -34,
+    71, -2, -36, -32, -13, 6, 32, -2, 43, -10, 24, 20,
+    -51, 25, 22, -2, 26, 21, -8, 17, -12, 34, -41, -52,
+    -35, 21, -36, 20, -7, 2, -69, -54, -29, -13, 13, 30,
+    42, 12, -28, 5, -32, 24, 42, 7, 32, -19, -10, 23,
+    -49, -12, 42, -42, -5, -50, 3, 55, -30, -3, 29, -5,
+    -27, -32, 5, 41, -17, 22, 35, -9, 1, -12, 12, 20,
+    -1, -18, 49, -7, 18, -7, 20, -10, 12, -10, 11, 15,
+    -40, -36, -2, 15, 55, -6, 1, 9, 4, -47, 11, 12,
+    41, -13, 10, -7, -19, -62, 24, -12, 37, 24, 15, 8,
+    -9, -19, 31, -9, 79, 14, -16, -28, 0, -21, -6, 26,
+    12, 3, -23, -4, -16, -52, 6, 5, -14, 18, 4, -30,
+    22, 10, 10, -13, 11, -13, -36, -3, 16, -4, 14, -30,
+    -32, -2, -16, -1, -79, 6, 27, -28, 48, 19, -58, -61,
+    -6, 12, 30, -39, 87, 17, -31, -42, -6, -18, 29, -9,
+    55, -22, -16, 5, -17, 36, 30, -15, 16, -24, -21, 25,
+    -47, 24, -11, -56, -8, -20, -11, 31, -14, -1, -77, -46,
+    -26, 14, 6, 46, 7, 23, -32, -11, 2, -7, 32, 7,
+    22, 8, -24, 29, -45, 8, 52, -38, -14, -50, -5, 31,
+    -31, 0, 45, -37, -33, -52, 5, -5, -9, 0, 51, -7,
+    11, 1, 19, 40, -8, 7, 36, -8, 15, 3, 13, -23,
+    6, -2, 24, -7, -19, -11, 12, -32, 44, 14, -7, 6,
+    -5, -50, 39, -24, 41, 25, -7, 1, 14, -56, 37, -19,
+    48, -21, 1, -2, 16, -36, 30, 0, 30, 16, -7, 0,
+    -4, -56, 14, 4, 19, 4, -16, 2, -2, -40, 15, 27,
+    -9, -31, -8, -34, 18, -30, -17, 10, 2, -32, -35, -15,
+    14, 42, 37, 21, -21, 2, -12, -16, -65, -4, 39, -36,
+    66, 15, -23, -65, -24, 32, 51, -55, 63, 16, -20, -13,
+    3, 2, 44, 4, 56, 6, 10, -7, -27, 28, 63, 15,
+    12, 37, -30, 6, -26, 3, -12, -41, -2, -10, -25, 47,
+    -6, 3, -74, -53, -15, 17, 10, 44, -4, 30, -32, -1,
+    -62, -35, 29, -13, 16, -6, 7, 30, -10, 32, 7, -26,
+    -15, 10, -24, 39, -15, -11, 36, -19, -3, -18, 19, 21,
+    -23, -30, 34, -27, -7, -35, 29, 50, 4, -6, 37, 0,
+    -18, -3, 11, 14, 35, -6, 15, 1, -8, -16, 21, -28,
+    33, -9, 16, -7, -25, -61, 25, -31, 52, -1, -19, -12,
+    -17, -41, 33, 1, 49, -18, -9, -14, -13, -27, 10, -18,
+    46, 30, -14, 12, 7, -62, 8, 10, 20, 20, 0, -4,
+    -7, -42, -5, -8, -27, -15, -6, -32, 21, 33, -17, 6,
+    -7, 0, -11, -12, 11, 11, 24, 2, -11, 4, -37, -3,
+    -52, 50, 29, -55, 59, 18, -39, -81, -49, 15, 38, -34,
+    53, -28, -37, -45, 34, 17, 46, -5, 54, -6, -3, 2,
+    -21, 15, 55, 11, 20, 29, -35, 24, -32, 16, -32, -33,
+    20, -7, -16, 25, -9, -5, -60, -27, -25, 17, 1, 49,
+    26, -9, -40, -15, -23, -13, 33, -7, -2, -28, -23, 2,
+    -48, 6, 20, -41, -4, -20, 6, 16, -4, -16, 28, -25,
+    -20, -29, 3, 33, -28, 4, 18, -16, -13, -19, 22, 54,
+    2, -3, 19, 17, -33, -21, 25, 7, 16, 12, -7, 8,
+    -8, -12, 29, -3, 29, 22, -12, 10, 8, -20, 12, 9,
+    61, -32, 11, -18, 16, -47, 30, 21, 67, -21, -6, -13,
+    5, -57, -14, -39, 37, 32, -18, -23, -3, -50, 22, 12,
+    39, 6, 10, 6, -7, -42, 11, 5, -24, 2, -24, -46,
+    16, 1, -14, 21, 9, 4, -45, -30, -2, -16, 50, 27,
+    -39, -11, -22, -52, -53, 16, 28, -15, 59, 2, -44, -65,
+    -54, -2, 18, -37, 59, -8, -43, -25, 19, 16, 26, -12,
+    56, 9, 8, -18, -12, -12, 60, -9, 21, 4, -28, -6,
+    -12, 4, -18, -12, 7, -8, -23, 59, -30, 31, -43, -19,
+    -26, -3, 24, 73, 33, 6, -40, -34, -6, -16, 27, -2,
+    -34, 8, -9, 20, -57, 15, 29, -49, 0, -22, -1, 27,
+    -43, 8, 13, -39, -15, -12, 22, 35, -40, 12, 41, -36,
+    -15, -14, 33, 73, -4, -30, 8, 1, -16, -8, 23, -7,
+    15, -11, -6, 26, -17, -20, 9, -21, 26, 12, 23, 9,
+    17, -23, 26, -9, 41, -7, -3, 7, 1, -35, 10, -20,
+    34, 21, 3, -3, -30, -46, 21, -20, 77, -41, -4, -10,
+    11, -52, 14, 4, 3, -9, -5, -5, 13, -21, 25, 7,
+    -12, -12, -27, -34, 34, 7, -22, -9, -21, 35, -56, -18,
+    3, 4, 15, 25, -61, -8, 6, -48, -9, -2, 14, -25,
+    10, 2, -80, -72, 0, -5, 24, 15, 34, -9, -23, -36,
+    9, 21, 35, 13, 34, 19, -30, -19, -21, 24, 32, 11,
+    18, -4, 2, -15, -37, 14, -31, 4, -37, 15, -13, 26,
+    6, -17, -37, -36, -35, -5, 0, 42, 32, -3, -63, -29,
+    -17, 1, 20, -14, 20, 0, 15, 40, -39, -1, -12, -36,
+    9, -6, 28, 8, -47, 3, 10, -12, -28, -37, 32, 48,
+    -22, 6, 17, -30, 38, -9, 22, 34, -7, 7, 2, -11,
+    -10, -5, 29, 12, 22, 10, 7, -7, 17, -34, 32, 8,
+    25, 4, 10, 11, 12, -9, -12, -4, 65, -15, -8, 22,
+    9, -36, 14, 26, 43, 31, -25, -2, 1, -32, -3, -30,
+    52, -20, -13, -11, 3, -20, 11, -5, 4, -10, -35, -3,
+    6, 20, 13, -6, -4, -15, 10, -54, 1, -20, 14, 14,
+    -20, -41, -18, -44, -14, -2, 22, -6, -67, 13, -17, -53,
+    -60, -18, -19, 19, 16, 25, -8, -79, -15, -29, 0, -13,
+    12, -10, -34, -58, 21, 39, 20, 41, 21, -10, -12, -11,
+    -25, 0, 11, 47, 12, -17, 3, 15, -3, 8, -13, -7,
+    -7, 5, 13, 52, 21, 27, -56, -47, -14, 27, 10, 34,
+    18, 17, -23, -12, -31, 42, 32, 3, -14, -8, 20, 11,
+    -48, -12, 14, -65, -58, -40, 4, 5, -8, -12, 4, -55,
+    -22, -3, -9, -6, -29, 27, 17, -34, 12, 17, 37, 41,
+    -27, 2, -17, -17, 2, -6, 26, 33, 25, 9, 8, 5,
+    4, -27, -6, -19, 45, 38, -6, 23, -10, -24, 18, 18,
+    49, -4, 13, 0, -9, -21, 25, -15, 42, 6, 20, -20,
+    8, -45, 33, 7, 50, -29, 2, 11, -5, -40, 39, 7,
+    5, -26, -11, -11, 10, -9, 44, 42, -40, 27, -38, -9,
+    -22, -10, -7, 14, -8, 12, 5, -57, -42, 6, 18, -29,
+    -31, -31, -40, -37, -58, -8, -26, -6, 12, 7, -8, -25,
+    -31, 15, 0, -13, 3, -16, -34, -52, -11, -4, -17, 30,
+    22, 19, -5, -12, 3, -23, -4, -6, 21, -24, 21, 9,
+    -15, 13, -37, 10, -24, 9, -11, 26, 4, -8, -40, -44,
+    4, -18, 37, 41, 9, -2, -13, -11, -44, 10, 21, 25,
+    -11, 18, -2, 4, -25, 1, -21, -34, -66, -2, 9, 18,
+    -33, 19, -32, -17, -57, -1, 3, 8, -2, -14, 25, -32,
+    -28, 12, 34, 30, 5, -9, 22, -14, -7, 6, 23, -10,
+    12, 30, 35, 8, -2, -36, -3, 23, 17, -33, -11, 15,
+    1, 3, 8, -18, 27, 2, 11, 27, 12, 22, 26, 0,
+    15, 38, 20, -8, -12, -13, 25, 22, 34, 10, -48, -7,
+    -15, 5, 43, 30, 30, -17, -11, 6, 5, -25, 63, 42,
+    6, -16, 21, 20, 19, 32, 27, -34, 16, 5, 51, -8,
+    8, 4, 23, 13, 15, -10, 1, -19, 40, 37, 28, 19,
+    -5, -22, -5, -13, 28, -7, 31, -16, -5, 23, -8, -1,
+    16, -9, 11, 36, 4, 0, 13, 12, -9, 10, 22, 19,
+    -8, 5, 10, -15, -11, -18, -8, 20, 14, -19, -2, 27,
+    -2, 23, 19, 16, 18, 33, 28, -6, -27, 11, 8, 12,
+    16, 27, 3, -17, 13, 5, 10, -16, 4, 17, 21, 0,
+    -3, -17, 2, 24, -12, 9, -6, -10, 2, -9, -3, 19,
+    -17, 19, -9, -7, 23, 15, -6, -8, 21, -1, 4, -17,
+    -16, 21, -6, -2, -16, -12, -19, 6, 28, 2, -5, -9,
+    5, -5, 12, -17, -12, -16, -10, -20, 23, -13, -11, -17,
+    2, -3, -27, 33, 12, -15, 30, 8, -15, 11, -9, 9,
+    29, -14, -7, -14, -5, 14, -19, -8, -6, -35, -16, -3,
+    -37, 26, -12, -17, 12, 6, 15, -33, -30, 6, 6, -18,
+    -6, 13, 23, -4, -7, 21, 26, -28, -5, 12, 26, -4,
+    27, 4, 7, 32, -1, 9, 15, -14, 38, 25, 31, 13,
+    2, 22, 3, 3, -3, 5, 1, 27, 10, 17, -6, 33,
+    19, -5, 12, 5, -13, -35, -28, -36, 34, 27, 21, 20,
+    14, -24, 0, -9, -8, -12, 11, 11, -3, 33, -29, 15,
+    -31, 34, 1, 33, 11, 31, 9, 16, -30, 24, 17, 14,
+    -19, 1, 20, 18, -3, 17, -10, -23, 32, -31, -11, 27,
+    39, 34, -6, -9, -2, 19, -10, -36, 6, 13, -12, 5,
+    32, 13, 11, -28, 21, 40, 12, 0, -11, 7, 12, 10,
+    6, 14, -13, -5, -2, 4, 8, -12, -17, 3, -28, -21,
+    6, -18, -19, -37, -21, 29, -12, -6, 12, -4, -2, 17,
+    -9, -8, -11, -17, -25, -4, 27, -36, 23, -3, -2, 0,
+    -22, -12, -15, -9, 15, 33, 4, -3, 13, 12, 10, 20,
+    -3, 25, 9, 1, -3, -30, 12, 12, -32, 37, -5, -1,
+    13, 24, -10, 11, 25, 18, 16, 9, 11, 6, 18, 28,
+    16, 3, 19, 10, 5, 15, 9, 1, 33, -28, 1, 38,
+    -7, -12, 5, 25, 0, -1, 11, -1, 22, 9, -25, -18,
+    -19, -11, 15, 47, -18, 25, 3, 10, 16, -18, -9, 46,
+    -12, 8, -9, -18, 7, 0, -4, 14, -16, 18, 8, 5,
+    -19, 17, -4, -5, -9, 37, -15, 5, 12, -7, -6, 3,
+    12, 22, 4, 37, -8, -25, -4, 17, 13, 25, -40, -6,
+    11, 6, -3, -17, 19, -10, -1, 14, -7, 4, -15, -36,
+    -5, -31, -10, 11, 21, 7, -9, 2, 14, -15, -3, -29,
+    -21, 7, -15, -17, 3, -2, -8, 7, 16, -9, 0, -7,
+    -14, 14, -7, -14, 29, -11, -40, -1, -26, 24, 42, 27,
+    3, 22, -2, -12, -11, -3, 4, 1, -2, -2, 7, -4,
+    14, -6, 21, -21, 2, 21, -22, -3, 4, -27, -2, -19,
+    -2, 26, 9, 42, 27, -33, -5, -8, -15, 4, 26, 52,
+    7, -7, 13, -11, -17, -20, 16, 26, 11, 15, 19, -2,
+    16, 34, 30, 2, -26, -9, 17, -6, 17, -4, 27, 33,
+    18, -12, 24, 22, 41, -28, 12, 46, 18, 7, 32, -10,
+    29, -12, 18, 51, -12, -18, -2, 5, 6, -5, 19, 12,
+    14, -16, 0, -8, -18, -13, 23, 0, -9, -5, -4, 15,
+    -12, -43, 10, -19, -21, -11, -23, -17, -40, -16, -8, -30,
+    25, -9, -8, 10, 11, 9, -6, -25, 15, -4, -24, 2,
+    0, 26, -2, -3, 27, -26, -17, 15, -29, 16, -15, -30,
+    11, 14, 6, 41, 0, 1, -13, 0, 17, 4, -14, -9,
+    -22, -8, -32, 9, 14, 19, -12, 0, 9, -6, -11, 12,
+    -1, 24, 8, 13, -6, -34, -6, 3, -14, -13, 27, -21,
+    6, -22, -5, -1, 13, -11, 16, 23, -8, -24, -15, -15,
+    -11, 0, 3, 10, 9, 10, -13, -5, 51, 38, -25, 23,
+    -29, -6, 31, 36, -4, 7, 2, -30, -21, 8, 44, -8,
+    2, 31, 4, -21, 11, 4, 23, -9, -1, 28, -19, 0,
+    63, -43, 23, 29, -2, 3, -15, 28, 23, -20, 14, 84,
+    -18, -11, 37, -6, 8, -18, 19, 50, 14, -40, 9, 15,
+    -18, -27, 6, 16, -12, -5, -28, -5, 9, -34, 19, -1,
+    2, -7, -20, 10, 0, -23, -3, -36, 6, 4, -37, 6,
+    1, -8, 9, -30, 12, 20, -38, -2, 32, -29, 9, -38,
+    20, 18, -31, 5, -1, -13, 0, 8, -5, -15, -3, -13,
+    4, -6, 8, -1, 1, 29, 11, -3, 10, -12, -5, -4,
+    -7, 25, -19, -4, -14, 6, -25, 2, -10, 12, -4, -5,
+    1, 12, -21, 27, -1, -1, 8, 29, -9, -24, -4, -12,
+    12, -6, -15, -18, -19, -35, -4, 6, 5, -36, 26, -4,
+    -7, 7, -33, 27, 20, 12, -4, 1, 22, -31, -19, 9,
+    52, -18, -28, 28, 27, -4, 59, 3, 21, -14, -21, 20,
+    0, -35, 36, 4, -15, -19, -3, -26, 50, -7, 36, 4,
+    14, 34, 3, 20, 47, -11, 26, 55, -12, 24, 3, 15,
+    75, -26, 13, 92, -9, 31, 28, -26, 35, 12, 21, 78,
+    -32, 5, 28, -20, -1, 4, 19, 21, -18, 7, -20, 12,
+    -35, -8, 14, 3, 12, 31, -24, 14, -11, -20, -4, -30,
+    -24, -5, -10, 0, -27, -22, -13, -45, -11, -3, -46, -3,
+    27, -19, 9, -47, 35, -6, -44, -9, -23, -16, 10, -42,
+    20, 3, -26, 16, -12, 24, -2, -31, 11, 37, -11, -4,
+    -23, -14, -23, -12, 13, -11, 0, -7, 23, 2, -3, 3,
+    4, -8, -11, 20, -29, -45, -21, -25, 9, -13, 20, 23,
+    -18, -26, -10, -1, 17, 38, -12, -9, 2, -6, 5, 8,
+    22, -1, 13, -9, -15, -9, -26, -5, 4, 4, 7, 2,
+    4, 9, -11, -4, 95, -42, -25, 42, 35, -12, 27, 6,
+    1, -22, -25, 5, 37, -29, 37, 7, -22, -5, -5, 9,
+    37, -34, 55, 4, 7, -27, -1, 20, 47, 10, 48, 35,
+    4, -16, 35, -2, 28, -46, 43, 85, 1, -27, 38, -2,
+    20, -19, 36, 70, -26, -18, 15, -3, -19, -17, 14, 30,
+    5, 10, 18, -1, -28, -11, 12, -19, -3, -22, 13, 19,
+    26, -27, -4, -62, -17, 10, -30, 15, -2, -1, 12, -16,
+    -1, -33, -22, 0, -10, -31, 4, -40, 38, 32, -36, -12,
+    25, 6, -24, -46, 16, 4, -15, 2, 12, 6, -16, -16,
+    4, 31, -12, -11, -19, -15, -6, -15, 4, 2, -8, -5,
+    4, -15, -27, -28, 10, -16, -2, -17, 28, -29, -21, -13,
+    0, 23, 1, 19, 25, -38, -8, 6, -34, 17, -22, -9,
+    -12, -17, 3, 4, 11, -24, 8, 14, -30, -18, -34, 6,
+    14, 41, -5, -6, 0, 2, -20, 27, 82, -1, -34, 58,
+    47, 19, 48, -23, -1, -10, -25, 21, 29, -39, 60, 15,
+    -26, 20, -18, 19, 31, -25, 51, 8, -4, 6, 12, 8,
+    25, -39, 43, 31, 7, 16, 36, 22, 41, -4, 49, 77,
+    -16, -39, 63, -14, 32, -30, 37, 73, -27, -20, 10, -11,
+    -14, -39, 34, 31, -19, 34, 2, 10, 22, 8, -9, -5,
+    14, -5, -5, 29, -13, 28, -10, -31, -49, 25, -12, 15,
+    -18, -7, 4, -47, -7, -30, -38, -15, 36, -11, 7, -33,
+    29, -7, -37, 24, 11, -22, 8, -54, -14, -6, -20, 4,
+    14, 23, -19, -15, 6, 21, -4, -3, 8, -6, -29, -28,
+    10, -4, -18, 8, -11, 9, -17, -18, 6, -17, -31, 25,
+    7, -24, -26, -33, -22, 13, -15, 22, -18, -19, -8, 9,
+    -6, -5, 12, -8, -21, -38, 0, -4, 4, -2, -11, -1,
+    -10, -31, 12, 10, 19, 13, -10, -11, 21, 7, -54, -20,
+    80, 14, -48, 38, 76, -8, 35, -21, -1, 8, -29, 17,
+    44, -7, 42, -15, -23, 11, -23, 15, 21, -20, 51, 17,
+    12, 13, 1, 1, 50, -29, 65, 39, 17, 2, 46, 7,
+    9, -29, 34, 77, -15, 5, 39, 3, 37, -11, 44, 59,
+    -12, 0, 22, 11, -20, -2, 23, 13, -1, -25, -2, 36,
+    6, -18, -16, -23, -6, 28, -14, 25, 8, -6, -1, -46,
+    1, 2, -22, 5, -14, -12, 11, -46, -7, 13, -51, 13,
+    18, -14, 14, -31, 31, 0, -25, 20, 4, -1, 9, -37,
+    -4, -39, 6, -7, -21, 1, -17, -6, -5, -11, -4, -5,
+    20, -30, -7, -11, 2, -3, -4, 1, -9, -13, 0, -20,
+    -25, -14, 0, -15, 17, -20, -16, -23, 17, 10, 7, 4,
+    1, -18, -5, -14, 20, 1, 18, -16, -14, -15, -16, -5,
+    8, 3, -8, 1, -24, -7, 23, 38, 15, -22, -9, -8,
+    30, -2, -14, -8, 63, 0, -44, 28, 83, -2, 30, 15,
+    -17, -35, -19, 16, 25, -25, 52, 14, -34, -33, -6, 14,
+    41, -29, 22, 9, 6, 18, -21, -7, 50, -32, 26, 29,
+    -13, -19, 16, 7, 49, -14, 18, 82, -21, -9, 30, -9,
+    26, -36, 62, 51, -29, -5, 31, 11, 8, -2, 19, 26,
+    -12, -8, -2, 8, -4, -23, -2, -21, -26, -10, 2, 24,
+    2, -24, -5, -13, 1, 8, -41, 19, 4, -26, 2, -26,
+    -41, 1, -44, -16, 14, 5, 24, -27, 8, -27, -46, 22,
+    18, -2, 14, -45, -4, 31, -23, -8, 17, 6, -13, -43,
+    -8, -1, -16, 4, 10, -39, -8, -3, -11, 18, -1, 6,
+    27, -26, -2, -2, -34, -18, -10, 24, -15, -8, 6, -13,
+    2, -22, 4, 20, -4, -18, -26, 9, -7, -18, -29, -25,
+    -4, -39, -17, -4, 10, 12, 3, -10, -30, 17, 15, 25,
+    24, 16, -17, -27, 34, -11, -27, -23, 75, -9, -37, 12,
+    79, -34, 34, 22, 9, 22, -47, -8, 25, -32, 36, -2,
+    -72, -5, -27, 18, 28, -29, 34, 9, 5, 41, -9, 16,
+    49, -31, 51, 63, -3, -19, 4, 3, 46, -19, 48, 54,
+    -18, 22, 47, -11, 27, -36, 58, 86, -27, -17, 38, -1,
+    3, -41, 49, 22, -17, -15, 8, 19, 1, 2, 3, -15,
+    -14, 8, -1, 5, 18, -14, -18, -38, -19, -20, -22, -9,
+    12, -15, 9, -26, -26, 0, -52, 16, 13, 13, 32, -12,
+    24, 35, -20, -7, 0, -28, 7, -44, -5, 22, -46, 1,
+    -26, 1, 6, -16, -2, 3, -13, 9, 1, 13, 5, -9,
+    -44, 2, -5, -5, 8, -16, 31, -13, -2, -21, 2, 14,
+    27, 15, 4, -11, -16, 31, 20, -9, 6, -36, -7, -23,
+    1, -1, 8, -14, 6, -1, -1, -13, 5, 26, -4, -6,
+    -21, -5, -6, 18, 32, -10, -32, -24, 28, -6, -42, 13,
+    44, 4, -31, 9, 59, -45, 42, -18, -9, -19, -15, -9,
+    13, -16, 50, 15, -55, 14, 0, 16, 36, -5, 49, -16,
+    -12, -35, -11, 4, 37, -57, 39, 37, 22, 17, 46, 9,
+    48, -47, 44, 52, -26, -16, 33, -11, 33, -56, 64, 57,
+    -34, -16, 18, -13, 16, -24, 31, 24, -6, -22, 7, 17,
+    -33, -19, -6, -16, 7, -17, -13, 5, 16, -27, -13, -23,
+    -23, -24, -42, 1, -7, 5, 11, -18, -7, 18, -29, 5,
+    -3, -26, 22, -30, 27, 18, -59, 0, -3, 2, 4, -46,
+    -1, -20, -10, -3, 0, -28, -9, -13, -21, -6, -8, 13,
+    3, -6, -2, -28, -37, -29, 6, -1, -12, -14, 27, -15,
+    -9, 2, 1, 4, 19, -27, 12, 5, -9, 10, 3, 3,
+    11, 3, -18, -9, 33, 32, -1, -13, 9, -27, -1, -20,
+    23, 0, 6, 20, -21, -14, 24, 22, 31, -20, -18, -31,
+    30, 3, -6, -2, 40, 3, -55, 12, 63, -40, 48, 22,
+    3, -8, -23, -5, 40, -31, 54, 10, -33, -27, -21, 8,
+    28, -51, 41, -14, -4, 10, -19, 1, 41, -15, 32, 19,
+    4, -20, 23, 10, 53, -61, 26, 70, -32, -41, 60, 9,
+    40, -47, 34, 32, -43, -6, 40, -6, -1, -22, 29, 35,
+    -32, 7, 7, 15, -15, -15, 8, -16, -8, -1, 5, 27,
+    5, -6, -16, -5, -29, -28, -52, 26, -7, 9, 6, -18,
+    -12, 3, -48, 20, -12, -1, 29, -24, 17, -12, -47, -12,
+    4, 11, -5, -36, 10, 12, -21, -19, 6, -13, 4, -35,
+    -33, -7, -22, -4, -11, -14, -5, -22, -29, 3, -18, 14,
+    -1, -37, 30, 4, -9, 26, 4, 12, 13, -38, 4, -23,
+    -1, 4, 0, 12, -7, -28, -5, -10, 20, -34, 27, 0,
+    11, -2, 6, -8, 15, -36, 1, -17, -17, 13, -8, -15,
+    15, -7, -7, -33, 13, -28, -39, -7, 43, -18, -24, 9,
+    64, -7, 47, 10, -6, -24, -23, 1, 14, -25, 35, 10,
+    -48, 25, -45, 14, 4, -38, 43, 15, -25, -26, -13, -5,
+    44, -45, 54, 25, 14, -2, 3, 26, 46, -48, 35, 50,
+    -15, -31, 42, 9, 27, -10, 41, 62, -50, 21, 10, -24,
+    -20, -33, 68, 40, -39, -3, -6, 9, -1, -25, 8, -20,
+    -12, -17, 1, 25, 17, -13, -21, -21, -19, 26, -35, 21,
+    15, 7, -2, -21, -1, -42, -43, 4, -11, 7, 16, -26,
+    12, -28, -38, 12, 8, -18, 6, -40, -8, -15, -32, 1,
+    8, -2, -7, -13, -33, 3, -26, -12, 10, -1, -14, -32,
+    -39, -21, 1, 16, 2, -4, 13, 20, -22, -8, 3, 24,
+    -13, 9, -4, 12, 11, 31, -11, 5, -9, -7, 0, -3,
+    4, -4, 22, 7, 0, -33, -7, -6, 12, -5, -12, -9,
+    -16, -21, 7, 23, 32, -5, -16, -20, 4, 0, -8, -14,
+    45, -7, -39, 11, 85, -20, 51, 38, -8, 10, -14, 11,
+    37, -33, 41, 5, -47, 20, -30, -14, 18, -35, 40, -4,
+    -20, 8, -3, 2, 58, -26, 41, 37, 13, 16, 9, 10,
+    50, -11, 23, 45, -22, -5, 53, -4, 40, -48, 41, 47,
+    -53, 6, 15, 4, -14, -13, 52, 28, -12, 8, 5, -4,
+    -3, -19, 15, -8, -23, -16, 9, 22, -2, 2, -1, -44,
+    -22, 10, -21, 12, -8, -12, 9, -12, -14, 7, -39, 11,
+    -3, -28, 26, -17, 20, 8, -40, -4, -11, -31, 3, -49,
+    -15, 17, -37, 21, 7, 16, -8, -4, -30, -15, -11, -34,
+    -1, -25, 1, -22, -18, -23, 2, 10, 24, -20, -2, -7,
+    9, -13, 14, 2, -15, -4, -7, 22, 5, 7, 9, 13,
+    14, -9, 4, -19, 4, -37, 4, 4, -10, -36, -18, -20,
+    -11, -2, -12, 2, -28, 11, -32, 23, 10, -32, -9, -36,
+    17, -42, -2, -6, 53, -34, -26, 6, 68, -7, 53, 10,
+    -5, -1, -20, -5, 22, -39, 35, 15, -44, -17, -33, 6,
+    11, -39, 37, -1, -8, -21, -12, 10, 32, -27, 34, 28,
+    -21, -12, 13, 12, 25, -31, 30, 49, -23, -5, 32, -16,
+    35, -2, 53, 40, -76, 6, 40, -25, -5, -23, 42, 26,
+    -17, 21, 12, -19, -15, 4, 14, 10, -1, 22, 1, 4,
+    23, -22, -20, -36, -12, -9, 4, 22, 31, 10, 17, -17,
+    18, -33, -39, 12, -11, 16, 2, -13, 16, 3, -45, -11,
+    11, 2, 0, -53, -10, 35, -10, -15, 31, -7, -4, -16,
+    -10, -2, -6, -8, -7, -12, -5, 10, -42, 41, 9, 2,
+    0, -4, -4, -18, -11, 5, -5, 30, -15, -15, -13, 2,
+    -20, 28, 12, 14, 11, 4, -10, -25, 20, 8, 39, 1,
+    -2, -27, -25, 1, 27, -16, -10, -1, -12, -25, -18, 24,
+    13, 8, -8, -42, 7, -12, 8, -1, 29, 19, -25, 11,
+    66, -17, 40, 0, -7, -16, -13, 0, 21, -3, 26, 34,
+    -63, -11, -32, -8, 9, -26, 14, 5, -7, -10, 1, 1,
+    19, -36, 31, 13, -5, 4, 8, 11, 21, -37, 40, 52,
+    -19, 11, 58, -19, 22, -29, 57, 50, -60, 11, 32, -25,
+    -9, 2, 53, 36, -4, -24, 28, -8, -15, -6, 12, 29,
+    -14, 5, -1, 18, 15, 1, -20, -22, -16, 3, -25, 21,
+    -3, 5, 8, -32, 27, -8, -31, 30, -19, -36, 17, -21,
+    -3, 26, -21, 9, -7, -13, 0, -24, -26, 8, -9, -34,
+    30, 0, 0, 0, -28, 9, -14, -8, -25, -14, 13, -6,
+    -30, 15, 4, 8, -14, 19, -8, -7, -15, -1, 3, 17,
+    18, -23, -12, 19, 7, 12, 19, 43, -9, -35, -7, -23,
+    -6, -37, 29, -10, -10, -7, -28, -10, 13, -21, 13, 8,
+    -25, -25, -14, 3, 29, -39, -40, -28, -9, -22, -36, -36,
+    38, 2, -18, -6, 56, -4, 26, -17, -38, -15, -33, 11,
+    26, -32, 22, 22, -36, 4, -6, -9, -18, 2, 37, 2,
+    -11, -5, 8, -10, 17, -11, 18, 8, -12, -29, 27, -11,
+    58, -36, 32, 46, -32, -11, 48, -28, 9, -8, 60, 69,
+    -45, 8, 35, -40, 9, -28, 53, 48, -28, -2, 7, -10,
+    5, 1, 5, -1, -10, 13, 2, -3, 3, 5, 13, 0,
+    -11, -42, -49, 25, 6, -18, 13, -14, 1, 24, -17, 18,
+    4, 2, 33, -39, 2, 13, -21, -23, 19, 8, 21, -16,
+    -18, 3, -20, 6, 23, -19, 0, 26, -18, -14, -4, 9,
+    -20, -8, -8, 24, -12, 19, 4, -10, 2, -16, -4, -2,
+    -29, 1, 10, 28, 27, -20, 14, 1, -5, 8, 17, -11,
+    0, 20, -26, 18, 7, -12, 21, 7, -4, -5, -11, -15,
+    1, 33, 1, -23, -24, -17, -37, -33, 31, 10, -35, -47,
+    22, 4, -3, -31, 36, -16, -20, -12, 56, -31, 22, -3,
+    -32, -20, -25, 12, 42, 4, 12, 23, -36, -24, -14, 3,
+    -20, -3, 25, -2, -13, -16, -13, -5, 24, -33, 28, 0,
+    9, -12, 24, 11, 31, -10, 52, 34, -12, 34, 69, -21,
+    35, -49, 50, 52, -14, -7, 41, -44, -9, 11, 56, 42,
+    9, -26, 5, 1, 11, -2, 23, -5, 0, -21, 8, -3,
+    12, 2, 29, -22, -6, 11, -21, 9, -2, -2, 16, -32,
+    -10, 6, -16, 21, -13, 9, 17, -28, -7, 7, -31, -19,
+    23, 5, 12, -31, -37, -14, -8, -22, 34, -23, 2, 0,
+    -3, -25, -14, -8, -7, -4, -6, -24, -24, -21, -23, 13,
+    4, -8, -8, -9, -8, 13, 3, 12, 19, -14, 15, -7,
+    -26, -3, 15, 25, 8, -9, -6, 1, -13, 18, 30, 5,
+    10, 9, -3, 11, 7, 8, 2, -4, -42, -24, 20, 1,
+    19, 25, -17, -38, 14, 10, 7, -17, 52, -32, 5, 30,
+    78, -23, 25, -1, -31, 4, -5, 14, 17, 5, 31, 21,
+    -44, -20, -7, -25, -7, -4, 37, -1, 6, -14, 1, -10,
+    42, 23, 36, 17, -13, 26, 31, -5, 50, -21, 51, 47,
+    0, 8, 44, -16, 38, -12, 37, 54, -39, -15, 26, -43,
+    -20, -7, 50, 39, -4, -12, -16, -29, -6, 12, 22, 23,
+    -6, -7, -27, 31, 31, -6, -1, -3, 13, 2, -23, 14,
+    -16, 18, 9, -38, 2, -22, -27, 10, -1, 3, 19, -16,
+    10, -7, -23, -1, 16, -4, 26, -13, -9, 15, -12, -6,
+    -12, 5, 16, 10, -35, 9, -9, -16, -27, 7, 7, -6,
+    2, -41, -8, -9, 1, -5, 14, -8, 7, 15, -2, 3,
+    18, 5, 9, 19, -8, -36, -3, 39, 15, -20, -9, 7,
+    0, -4, 18, -8, -5, -22, -28, -23, -23, -32, -1, -36,
+    -42, -21, -14, -9, 13, 27, -23, -60, 6, 0, -3, 4,
+    70, -7, -23, 19, 45, 12, 31, -8, -45, 12, 20, 17,
+    5, -27, 39, 8, -59, -17, -33, -35, 4, -8, 17, 16,
+    -16, -25, -5, 3, 60, -25, 20, 12, -12, -10, 27, 10,
+    35, -14, 45, 26, 8, -1, 50, -25, 26, 5, 43, 52,
+    -15, 10, 0, -24, 2, -33, 44, 42, 3, -26, -4, -17,
+    -4, -28, 3, 1, 3, -18, -23, 21, 5, 3, 19, 17,
+    14, -18, -11, 34, 27, 14, -3, -13, 10, 2, -35, 32,
+    -21, 6, -8, -30, 6, 14, -34, 13, -7, 22, 28, 12,
+    -32, -16, -20, 12, 15, -14, 39, 29, -34, -26, -16, -7,
+    -16, 2, 10, 7, 6, -7, 15, -6, -16, -18, -15, -9,
+    -1, 2, 11, 13, 27, -18, -10, 5, -1, 28, 23, 4,
+    5, 23, 0, -1, 13, -13, 35, 16, -3, 5, -5, -22,
+    3, 16, 7, -41, -9, -1, -13, -15, 23, -19, -45, -53,
+    20, 28, -11, 3, 71, -10, -9, -14, 62, -14, 34, -12,
+    -19, -4, -18, 11, -12, -15, 37, 16, -48, -10, 0, -17,
+    16, -4, 21, -27, -37, -13, -22, 16, 34, -14, 43, 17,
+    -7, 10, -4, -11, 83, 22, 37, 67, -32, 14, 19, -4,
+    45, -30, 85, 101, -12, 8, 1, -33, 10, 0, 73, 28,
+    -2, -33, -17, -14, -7, -10, -3, -1, -13, 2, -10, 20,
+    11, -24, 9, -4, -4, -30, -27, 17, 3, 9, -5, 6,
+    16, 26, -13, 13, -6, 10, -43, -11, 26, 17, -14, -4,
+    31, -2, 14, -28, -17, -41, -18, 6, 30, 4, 18, 40,
+    -9, 14, 6, -8, -18, -16, 26, 1, -9, -3, 3, 17,
+    25, 16, 4, -5, -41, -6, 22, 6, 7, 35, -6, 20,
+    17, -15, 18, 16, 4, -31, -18, -9, 33, 14, 10, 10,
+    -8, 7, 10, -18, 3, 31, -6, -60, -20, 18, 1, 30,
+    -3, -15, -24, -52, -12, 23, -1, -35, 69, 16, -18, -6,
+    61, -25, 39, -35, -41, -7, -12, -10, 6, -8, 30, 19,
+    -25, -30, -15, -29, -13, -9, 24, 18, -28, 10, -37, -1,
+    -1, -2, 32, 9, 0, -9, 35, -10, 45, 20, 38, 40,
+    -27, -1, 15, -29, 29, -24, 86, 67, -25, -5, -7, -26,
+    -23, -30, 25, 25, 8, -6, -13, -27, 35, 7, 15, -8,
+    -8, -13, -4, 17, 42, 5, -12, -15, -6, -5, -15, 30,
+    19, 15, -7, -11, -6, 9, -7, 3, -16, -16, -25, -20,
+    -15, 12, -26, -18, -10, 32, 15, -23, 0, -12, -2, -16,
+    19, 10, 23, 19, -18, 19, -5, -1, -8, -3, -12, -30,
+    -24, 6, -4, 20, 3, 23, 0, 3, -26, -3, -14, 18,
+    18, 32, -21, 16, 2, -9, 19, 13, 17, -3, -34, -11,
+    7, -13, 4, -1, 6, 5, -5, -22, -16, 10, 0, -75,
+    -24, 26, 3, -2, 13, 26, -25, -64, -42, -36, -10, -8,
+    57, -11, -43, -8, 34, -6, 34, 5, -48, -12, 45, -4,
+    0, 10, 27, -4, -26, 9, 20, -6, 0, 29, 26, -3,
+    -13, 24, -4, -21, 21, -11, 14, 10, -13, -15, 27, 5,
+    20, 3, 45, 39, -5, 24, 34, -17, -10, 6, 40, 43,
+    -34, -20, -17, -24, -45, -2, 23, 18, 1, 19, 5, -9,
+    0, -34, -13, -27, 3, -5, 7, 11, -3, -36, -33, 3,
+    12, 0, -6, 6, 14, 2, 5, -6, -3, -19, 9, 12,
+    -3, -5, 12, -16, -28, 4, -42, -13, 9, 10, -7, -8,
+    -30, -17, -33, -16, -8, 3, 15, 32, -12, -29, -8, 2,
+    -30, -27, 37, 15, -21, -8, -23, -3, 4, 12, 12, -2,
+    1, 8, -4, -4, 27, 1, -27, 19, -7, -24, 7, 32,
+    -2, 6, -20, -2, 9, -17, 20, 4, 11, -11, -25, -1,
+    10, 2, 9, -23, -60, 22, 13, -25, 21, 20, -15, -48,
+    -20, -25, -16, -16, 51, 5, -38, -14, 11, 8, 56, 1,
+    7, -3, -40, 6, -39, -16, 22, 31, -1, -9, -32, -40,
+    -13, -9, 18, 8, 14, 5, -10, 3, -17, 27, 18, -12,
+    -24, 15, 2, -3, -14, 22, 38, 34, -32, 7, -9, -26,
+    -21, 22, 34, 26, 11, 1, -11, -22, -46, 34, 15, 19,
+    21, 8, -16, -5, -19, 17, -13, -23, -1, -34, 10, 24,
+    15, 2, -5, -7, -5, -24, 18, 24, 1, -12, -10, -8,
+    -16, 31, 36, 21, -11, 0, 28, -7, 1, 10, 17, -43,
+    1, 18, 2, -20, -3, 7, -14, -22, -7, -1, -9, -5,
+    21, -20, -27, 1, -21, 5, -7, 16, -2, 40, -27, 10,
+    -21, 27, 14, -7, -34, 2, 21, 10, -1, -2, 17, 36,
+    3, -8, 0, 8, -3, 14, -21, -13, -10, -9, 20, 14,
+    -4, -11, -34, -11,
+};
+// MatMul_bias
+alignas(16) const int32_t kTensor1Data[4] = {
+    427, -518, -94, 186,
+};
+const int32_t kOp2Multiplier[1] = {
+    1932201031,
+};
+const int32_t kOp2Shift[1] = {
+    -11,
+};
+const cmsis_nn_fc_params kOp2Params = {128, 0, 14, {-128, 127}};
+const cmsis_nn_quant_params kOp2Quant = {
+    const_cast<int32_t*>(kOp2Multiplier), const_cast<int32_t*>(kOp2Shift), 0};
+const cmsis_nn_dims kOp2InputDims = {1, 1, 1, 4000};
+const cmsis_nn_dims kOp2FilterDims = {4000, 1, 1, 4};
+const cmsis_nn_dims kOp2BiasDims = {1, 1, 1, 4};
+const cmsis_nn_dims kOp2OutputDims = {1, 1, 1, 4};
+
+}  // namespace
+
+KwsModelAot::KwsModelAot(uint8_t* arena) : arena_(arena) {
+  TFLITE_DCHECK(reinterpret_cast<uintptr_t>(arena) % 16 == 0);
+  // Scratch buffers are planned for the DSP build of CMSIS-NN, which asks
+  // for the most on these targets.
+  TFLITE_DCHECK_LE(
+      arm_depthwise_conv_wrapper_s8_get_buffer_size(
+          &kOp1Params, &kOp1InputDims, &kOp1FilterDims, &kOp1OutputDims),
+      0);
+  TFLITE_DCHECK_LE(arm_fully_connected_s8_get_buffer_size(&kOp2FilterDims), 0);
+}
+
+TfLiteStatus KwsModelAot::Invoke() {
+  int8_t* const tensor2 = reinterpret_cast<int8_t*>(arena_ + kTensor2Offset);
+  int8_t* const tensor3 = reinterpret_cast<int8_t*>(arena_ + kTensor3Offset);
+  int8_t* const tensor6 = reinterpret_cast<int8_t*>(arena_ + kTensor6Offset);
+  int8_t* const tensor9 = reinterpret_cast<int8_t*>(arena_ + kTensor9Offset);
+
+  // Operator 0: RESHAPE
+  // Tensor 4 is tensor 3 reshaped; nothing to do.
+  // Operator 1: DEPTHWISE_CONV_2D
+  {
+    const cmsis_nn_context ctx = {nullptr, 0};
+    if (arm_depthwise_conv_wrapper_s8(
+            &ctx, &kOp1Params, &kOp1Quant, &kOp1InputDims, tensor3,
+            &kOp1FilterDims, kTensor8Data, &kOp1BiasDims, kTensor0Data,
+            &kOp1OutputDims, tensor2) != ARM_CMSIS_NN_SUCCESS) {
+      return kTfLiteError;
+    }
+  }
+  // Operator 2: FULLY_CONNECTED
+  {
+    const cmsis_nn_context ctx = {nullptr, 0};
+    if (arm_fully_connected_wrapper_s8(
+            &ctx, &kOp2Params, &kOp2Quant, &kOp2InputDims, tensor2,
+            &kOp2FilterDims, kTensor7Data, &kOp2BiasDims, kTensor1Data,
+            &kOp2OutputDims, tensor6) != ARM_CMSIS_NN_SUCCESS) {
+      return kTfLiteError;
+    }
+  }
+  // Operator 3: SOFTMAX
+  arm_softmax_s8(tensor6, 1, 4, 1575942400, 23, -248, tensor9);
+  return kTfLiteOk;
+}
@@ -0,0 +1,55 @@
+// Generated by tools/aot_compile.py from
+//   examples/micro_speech_small/kws_model_data.cc.
+// Do not edit; regenerate with:
+//   python3 tools/aot_compile.py \
+//      examples/micro_speech_small/kws_model_data.cc --class-name KwsModelAot \
+//      --header examples/micro_speech_small/kws_model_aot.h --source \
+//      examples/micro_speech_small/kws_model_aot.cc
+
+#ifndef EXAMPLES_MICRO_SPEECH_SMALL_KWS_MODEL_AOT_H_
+#define EXAMPLES_MICRO_SPEECH_SMALL_KWS_MODEL_AOT_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+
+// Runs the model as straight-line calls into CMSIS-NN, with the
+// parameters MicroInterpreter would compute in AllocateTensors() folded
+// into constants. Outputs match MicroInterpreter bit for bit.
+class KwsModelAot {
+ public:
+  // Bytes of activation and scratch memory the model needs.
+  static constexpr int kArenaSize = 5968;
+
+  static constexpr size_t kInputBytes[] = {1960};
+  static constexpr float kInputScales[] = {0.101715684f};
+  static constexpr int32_t kInputZeroPoints[] = {-128};
+  static constexpr size_t kOutputBytes[] = {4};
+  static constexpr float kOutputScales[] = {0.00390625f};
+  static constexpr int32_t kOutputZeroPoints[] = {-128};
+
+  // `arena` must be 16-byte aligned, hold kArenaSize bytes and stay
+  // untouched between Invoke() and reading the outputs.
+  explicit KwsModelAot(uint8_t* arena);
+
+  size_t inputs_size() const { return 1; }
+  size_t outputs_size() const { return 1; }
+  int8_t* input(size_t index) {
+    return reinterpret_cast<int8_t*>(arena_ + kInputOffsets[index]);
+  }
+  const int8_t* output(size_t index) const {
+    return reinterpret_cast<const int8_t*>(arena_ +
+                                           kOutputOffsets[index]);
+  }
+
+  TfLiteStatus Invoke();
+
+ private:
+  static constexpr int kInputOffsets[] = {4000};
+  static constexpr int kOutputOffsets[] = {0};
+
+  uint8_t* arena_;
+};
+
+#endif  // EXAMPLES_MICRO_SPEECH_SMALL_KWS_MODEL_AOT_H_
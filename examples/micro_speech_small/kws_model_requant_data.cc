@@ -0,0 +1,1608 @@
+// Generated by tools/precompute_requantization.py from
+//   examples/micro_speech_small/kws_model_data.cc.
+// Do not edit; regenerate with:
+//   python3 tools/precompute_requantization.py \
+//      examples/micro_speech_small/kws_model_data.cc --array-name \
+//      g_kws_model_requant_data --header \
+//      examples/micro_speech_small/kws_model_requant_data.h --source \
+//      examples/micro_speech_small/kws_model_requant_data.cc
+
+#include "kws_model_requant_data.h"
+
+alignas(16) const unsigned char g_kws_model_requant_data[] = {
+    0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x1c, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x30, 0x4a, 0x00, 0x00, 0xd0, 0x43, 0x00, 0x00, 0xb8, 0x43, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0xa0, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0xe0, 0x04, 0x00, 0x00,
+    0xac, 0x04, 0x00, 0x00, 0xa0, 0x04, 0x00, 0x00, 0x8c, 0x04, 0x00, 0x00,
+    0x60, 0x04, 0x00, 0x00, 0x54, 0x04, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00,
+    0xac, 0x01, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00, 0x7c, 0x01, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x14, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+    0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x54, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x4f, 0x46, 0x46, 0x4c,
+    0x49, 0x4e, 0x45, 0x5f, 0x52, 0x45, 0x51, 0x55, 0x41, 0x4e, 0x54, 0x49,
+    0x5a, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44,
+    0x41, 0x54, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0xaf, 0x49, 0x8a, 0x62, 0xb7, 0xa4, 0x64, 0x5a,
+    0x4f, 0xc6, 0x41, 0x77, 0xca, 0x19, 0x23, 0x45, 0x17, 0xd4, 0x4f, 0x59,
+    0xe2, 0x63, 0xa1, 0x4c, 0x35, 0x08, 0xec, 0x7f, 0xe8, 0x6b, 0xb3, 0x68,
+    0xf6, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
+    0xf6, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
+    0xf6, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00,
+    0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+    0x1c, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0xec, 0x48, 0x00, 0x00, 0x8c, 0x42, 0x00, 0x00, 0x74, 0x42, 0x00, 0x00,
+    0x3c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74,
+    0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0xfc, 0x41, 0x00, 0x00,
+    0x68, 0x03, 0x00, 0x00, 0x34, 0x03, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00,
+    0x14, 0x03, 0x00, 0x00, 0xe8, 0x02, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xbe, 0xbc, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x35, 0x2e, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xba, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xba, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xee, 0xbc, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x80, 0x02, 0x00, 0x00, 0xfa, 0xee, 0x28, 0xc4, 0xee, 0xfe, 0xcf, 0x0f,
+    0x1e, 0xf7, 0x1f, 0x06, 0x0d, 0xed, 0xe9, 0x83, 0x5c, 0xc9, 0x18, 0xe3,
+    0xf9, 0x14, 0x28, 0x2a, 0x09, 0xf2, 0x18, 0x34, 0x62, 0xea, 0xef, 0xd6,
+    0x36, 0xb7, 0x1e, 0xf7, 0x3b, 0x22, 0x28, 0x39, 0xc2, 0x9d, 0xf1, 0x07,
+    0x5e, 0x0b, 0x1e, 0x2c, 0x07, 0xdd, 0xfd, 0xc3, 0xd8, 0x4a, 0xf3, 0x28,
+    0xa7, 0x16, 0xd5, 0xf1, 0xc3, 0x05, 0xfd, 0x27, 0xcc, 0xba, 0x1e, 0xcb,
+    0xd7, 0x3d, 0xd4, 0x29, 0x00, 0xfd, 0x28, 0x44, 0xfb, 0xf2, 0xf3, 0xb6,
+    0x4f, 0xcf, 0x09, 0xf0, 0xfa, 0x45, 0x41, 0x49, 0x05, 0xc5, 0x17, 0x5d,
+    0x64, 0x00, 0xf8, 0xee, 0x48, 0x17, 0xf4, 0xe9, 0x2e, 0x4b, 0x2e, 0x3f,
+    0xdf, 0xee, 0xe4, 0x08, 0x38, 0xf1, 0x16, 0x13, 0x2f, 0x2a, 0xed, 0xc2,
+    0xbf, 0x36, 0xf4, 0x02, 0xcf, 0xaa, 0xd2, 0xfa, 0xac, 0x13, 0xf6, 0xe8,
+    0xb5, 0x68, 0x12, 0xb6, 0xce, 0x0e, 0xdf, 0x58, 0xe4, 0x49, 0x14, 0x15,
+    0x03, 0xed, 0xfa, 0xd4, 0x40, 0xa7, 0xf6, 0xca, 0xfb, 0x00, 0x4d, 0x5e,
+    0xe4, 0x55, 0x1d, 0x30, 0x45, 0xe2, 0xfc, 0x01, 0x48, 0x81, 0xe9, 0xf1,
+    0x1e, 0xfc, 0x21, 0x32, 0xed, 0x4b, 0xed, 0xfa, 0x2f, 0xd2, 0xfa, 0xfb,
+    0x4d, 0xa7, 0xed, 0xc7, 0x92, 0xdf, 0xe6, 0xdb, 0xf8, 0x1f, 0xd9, 0xfa,
+    0x91, 0xf5, 0xe5, 0xc5, 0x8c, 0x17, 0x0f, 0xb9, 0xd2, 0xc7, 0xfe, 0x68,
+    0xd3, 0x51, 0x2e, 0x49, 0x1f, 0xbd, 0x01, 0xeb, 0x31, 0x17, 0xf0, 0xef,
+    0xff, 0xb8, 0x5d, 0x62, 0x02, 0x0f, 0x1f, 0x78, 0x6a, 0xb0, 0xf9, 0xfe,
+    0x4f, 0xcc, 0xd3, 0xff, 0x0a, 0x96, 0x1e, 0x2c, 0xed, 0xbc, 0xf4, 0x0b,
+    0x42, 0xc8, 0xf1, 0xea, 0x6e, 0x58, 0xec, 0xc4, 0x99, 0xae, 0xdc, 0xd7,
+    0x12, 0x87, 0xd8, 0x06, 0xa2, 0xc2, 0xe6, 0xa2, 0x81, 0x24, 0xe9, 0xac,
+    0xce, 0xb6, 0x15, 0x6b, 0xba, 0x00, 0x19, 0x58, 0x29, 0xb6, 0xfe, 0x01,
+    0x25, 0x96, 0xd2, 0xec, 0x0e, 0x9c, 0x60, 0x5f, 0xe9, 0xf4, 0xf5, 0x69,
+    0x6b, 0xb5, 0xe1, 0xf6, 0x5e, 0xb7, 0xb1, 0xe5, 0x11, 0x9b, 0x18, 0x10,
+    0xe3, 0xe1, 0xe0, 0x0d, 0x4f, 0xa5, 0xde, 0xe5, 0x6f, 0xe2, 0xfb, 0x99,
+    0x82, 0xa5, 0xc9, 0xb6, 0x1f, 0x46, 0xf3, 0x04, 0xc6, 0xca, 0xd6, 0x97,
+    0x90, 0x1d, 0xc0, 0x95, 0xf0, 0x19, 0x30, 0x77, 0xc2, 0x3c, 0xfa, 0x24,
+    0x02, 0x4d, 0x06, 0x07, 0x15, 0x02, 0xb0, 0xe7, 0x27, 0x22, 0x67, 0x4d,
+    0xf1, 0xc2, 0xf4, 0x64, 0x38, 0x40, 0xdf, 0xf6, 0x3a, 0x43, 0xb8, 0xe1,
+    0x0d, 0x15, 0x11, 0xfe, 0xf5, 0xec, 0xf9, 0xe5, 0x22, 0x36, 0xe4, 0xfd,
+    0x6d, 0xbf, 0x0d, 0x8e, 0xb7, 0x15, 0xbf, 0x9f, 0x16, 0xad, 0x0a, 0x02,
+    0x8e, 0x14, 0xda, 0x9b, 0x8e, 0xc3, 0xa6, 0xca, 0xf5, 0x7f, 0x51, 0x56,
+    0xc1, 0xb3, 0xd9, 0x35, 0xf8, 0x7f, 0x04, 0x0a, 0x03, 0x3f, 0xbe, 0xee,
+    0x19, 0x68, 0x78, 0x50, 0xf9, 0xa7, 0xf7, 0x7f, 0x1d, 0x76, 0xdb, 0xe8,
+    0x33, 0xb9, 0xd7, 0xe7, 0xe8, 0x69, 0x15, 0xf7, 0xf5, 0xb2, 0xfe, 0xe8,
+    0xf3, 0x5b, 0xe2, 0x06, 0x6e, 0x09, 0x36, 0xb7, 0xcc, 0x38, 0xbf, 0x8a,
+    0x28, 0x14, 0x2e, 0x18, 0xa7, 0x26, 0xcb, 0xb2, 0x95, 0x37, 0xac, 0xcd,
+    0xd7, 0x51, 0x67, 0x44, 0xcd, 0x31, 0xde, 0x04, 0xe9, 0x6a, 0x00, 0x13,
+    0x0a, 0x0c, 0xdd, 0x16, 0xe0, 0x24, 0x7e, 0x49, 0xf1, 0xb5, 0x04, 0x52,
+    0x01, 0x50, 0xdd, 0xf5, 0x26, 0xc9, 0xf4, 0xf8, 0xd6, 0x31, 0x1b, 0xd0,
+    0xef, 0x03, 0x0a, 0xc0, 0xd4, 0x4f, 0xe2, 0xfd, 0x72, 0xf4, 0x5a, 0xc9,
+    0xd7, 0x31, 0xc0, 0x8e, 0x17, 0x5e, 0x57, 0x00, 0xb4, 0x3a, 0xc8, 0xd2,
+    0x92, 0x32, 0xcb, 0xd8, 0xc3, 0xa6, 0x63, 0x26, 0xcf, 0xbc, 0xe8, 0x57,
+    0x9b, 0xe9, 0xf7, 0x1c, 0xea, 0x12, 0xf1, 0xf7, 0xdb, 0xb9, 0x7f, 0x16,
+    0xf6, 0xe0, 0x08, 0x70, 0xa2, 0xed, 0xcc, 0xf1, 0x1e, 0x10, 0x04, 0xf7,
+    0xa9, 0xb7, 0x34, 0xaa, 0x0a, 0xdb, 0x2a, 0xa6, 0xb6, 0x10, 0xea, 0xf8,
+    0x5e, 0x06, 0x72, 0xdd, 0xd0, 0xb9, 0xd6, 0xa0, 0x10, 0x9f, 0x5a, 0x17,
+    0xb1, 0xe7, 0xc0, 0x01, 0x9d, 0x01, 0xe0, 0xe0, 0xaf, 0x9c, 0x46, 0xd8,
+    0xaf, 0xe8, 0xce, 0x02, 0x8a, 0xbb, 0xe4, 0xf6, 0xf3, 0x36, 0x07, 0xca,
+    0xcb, 0x87, 0x6e, 0xcc, 0xd6, 0x9e, 0x0a, 0x2a, 0x81, 0xd7, 0xcf, 0xc0,
+    0x04, 0xeb, 0x24, 0xcc, 0xc9, 0x95, 0x33, 0x81, 0xf7, 0xad, 0x1c, 0x9c,
+    0xa4, 0xd6, 0xf9, 0xe6, 0x3d, 0x84, 0x7f, 0xcc, 0xd4, 0xb0, 0xf4, 0xa2,
+    0xe9, 0x3c, 0x36, 0xee, 0xd5, 0xcf, 0xcd, 0x2d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbc, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x8e, 0xbf, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xbd, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xce, 0xbf, 0xff, 0xff,
+    0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x8a, 0xfe, 0xff, 0xff,
+    0xa9, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00,
+    0x52, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x4f, 0xfb, 0xff, 0xff,
+    0x4a, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xbf, 0xff, 0xff,
+    0x04, 0x00, 0x00, 0x00, 0x80, 0x3e, 0x00, 0x00, 0xff, 0xf9, 0xfd, 0x0a,
+    0x07, 0x08, 0x07, 0x03, 0x07, 0xf2, 0xd1, 0x09, 0xf0, 0xe9, 0x28, 0x09,
+    0xdf, 0x05, 0xfa, 0xf0, 0xe8, 0xe3, 0x13, 0x0e, 0x08, 0xef, 0xd3, 0xee,
+    0x0f, 0xe8, 0xeb, 0x14, 0xf7, 0xed, 0xfd, 0x1f, 0xe8, 0xd5, 0xeb, 0xfc,
+    0x0e, 0xf4, 0xf7, 0x07, 0x05, 0xea, 0xf6, 0x1f, 0xf8, 0xdb, 0xdc, 0x0b,
+    0x03, 0xdd, 0xd8, 0xf3, 0x0f, 0x19, 0xe1, 0x09, 0xfc, 0xe4, 0x02, 0x04,
+    0xf1, 0x04, 0xeb, 0xf3, 0x1e, 0x06, 0xfd, 0x11, 0xfc, 0xfa, 0xf6, 0x1f,
+    0x0f, 0x02, 0xf5, 0xf7, 0xff, 0x24, 0xdf, 0xf7, 0xf8, 0xf3, 0xf6, 0xe9,
+    0xef, 0x03, 0xdd, 0xf2, 0x28, 0xe1, 0xf2, 0x22, 0xf4, 0x09, 0xf7, 0xf9,
+    0xf0, 0xd4, 0xf9, 0xee, 0xff, 0x14, 0xda, 0xf3, 0x11, 0xe2, 0xf6, 0x0c,
+    0xf2, 0xeb, 0xf8, 0xe8, 0xe3, 0x08, 0x02, 0x17, 0xf4, 0x0b, 0x0c, 0x27,
+    0xe6, 0x02, 0x03, 0xf9, 0x14, 0x18, 0xf6, 0xeb, 0x1f, 0x0c, 0xf1, 0xee,
+    0xfc, 0x08, 0xf0, 0xfe, 0xfd, 0xee, 0x17, 0xfd, 0x1c, 0xef, 0xfd, 0xde,
+    0x04, 0x05, 0xf0, 0x31, 0xfa, 0x0b, 0xdc, 0x0d, 0xed, 0xf5, 0xfa, 0xf4,
+    0x08, 0x0c, 0xd7, 0x1e, 0x15, 0x03, 0xf5, 0x02, 0xf4, 0xfb, 0xed, 0x01,
+    0xfe, 0xd6, 0x1f, 0xfd, 0xfd, 0x0e, 0xfa, 0x06, 0xf1, 0xf9, 0xe2, 0x16,
+    0xe9, 0xf1, 0x03, 0x0d, 0x0d, 0xdf, 0xf9, 0x1a, 0x0e, 0xf6, 0xfc, 0x0a,
+    0x19, 0xe2, 0xe0, 0x09, 0x15, 0xf0, 0xf1, 0x06, 0xf1, 0xe1, 0xef, 0x1a,
+    0x08, 0xe8, 0xfd, 0x12, 0x14, 0x06, 0xf1, 0xfc, 0xea, 0xfb, 0xf7, 0xea,
+    0x1d, 0x09, 0xfa, 0xf6, 0x08, 0xf2, 0xe7, 0xf8, 0xfc, 0x16, 0xf5, 0x0e,
+    0x08, 0xf9, 0x0a, 0x03, 0x26, 0xd8, 0x02, 0xf5, 0xf6, 0xf6, 0xef, 0x1f,
+    0xe4, 0xe2, 0xfb, 0x02, 0x1b, 0xe6, 0xde, 0x00, 0xf2, 0xed, 0xfb, 0x18,
+    0xe4, 0x16, 0x1a, 0x1d, 0xf1, 0xf6, 0xea, 0x16, 0x05, 0xde, 0xfb, 0x18,
+    0xf5, 0xe4, 0xfe, 0xe2, 0x1b, 0x1c, 0x0c, 0xe8, 0x02, 0xee, 0xfb, 0x07,
+    0x24, 0xf2, 0xe9, 0xfa, 0x0d, 0x05, 0xf1, 0x03, 0xfe, 0xf6, 0x19, 0x06,
+    0xff, 0xf9, 0x04, 0xfb, 0x15, 0xef, 0xf1, 0xf8, 0xe9, 0xe1, 0x10, 0x04,
+    0xfc, 0xe6, 0x1f, 0xed, 0x0b, 0xef, 0x00, 0x1e, 0xe6, 0x16, 0xf3, 0x09,
+    0xfd, 0x08, 0x08, 0x06, 0x06, 0x23, 0xdf, 0xfc, 0x08, 0xf4, 0xea, 0x0c,
+    0xf2, 0xe6, 0x18, 0xf5, 0x02, 0xf9, 0x50, 0x09, 0x01, 0xda, 0x0b, 0x05,
+    0x12, 0x18, 0xef, 0x04, 0x0e, 0xd9, 0xff, 0xdc, 0xf6, 0x16, 0xf9, 0xf4,
+    0xec, 0xff, 0xea, 0xe6, 0xfa, 0x0a, 0xed, 0xef, 0x02, 0xf0, 0x25, 0x21,
+    0xf1, 0x26, 0xf5, 0xed, 0x09, 0xea, 0xea, 0x24, 0xfa, 0x11, 0xfc, 0xdf,
+    0xf3, 0x0a, 0x28, 0x0c, 0x19, 0xff, 0xf5, 0xd6, 0x0e, 0xe2, 0x2a, 0x06,
+    0xfa, 0x03, 0xf9, 0xe6, 0xef, 0x23, 0xf9, 0xfa, 0xe6, 0xfe, 0xfc, 0x03,
+    0x06, 0x1a, 0xf9, 0x08, 0xe0, 0xe5, 0xff, 0x05, 0x01, 0xe7, 0x12, 0x02,
+    0x1d, 0x05, 0x03, 0x05, 0x0b, 0xee, 0xed, 0xfc, 0x0f, 0xf3, 0x02, 0xe0,
+    0x15, 0xdf, 0x02, 0xed, 0x10, 0x26, 0xef, 0x0d, 0x06, 0xee, 0xef, 0xf6,
+    0xeb, 0x11, 0x09, 0xf4, 0xf7, 0x06, 0x0f, 0x01, 0x2a, 0x0b, 0x01, 0xdd,
+    0xfc, 0xf4, 0xf1, 0x17, 0x03, 0x04, 0x07, 0xfc, 0x22, 0xfc, 0xde, 0xfe,
+    0x0b, 0x03, 0xf3, 0xfb, 0x0c, 0x25, 0x04, 0x19, 0x04, 0x03, 0x01, 0xfa,
+    0xfb, 0xf7, 0xf6, 0x0e, 0x15, 0x0e, 0x09, 0xff, 0x06, 0xfa, 0xfb, 0x1e,
+    0xfb, 0x05, 0x22, 0xf9, 0xfe, 0xf7, 0x1d, 0xed, 0xdf, 0x18, 0x09, 0xeb,
+    0xef, 0x04, 0x12, 0xea, 0xdf, 0xfb, 0xda, 0xf6, 0xdf, 0x17, 0xef, 0xef,
+    0xe1, 0x1a, 0xd9, 0xe2, 0xe2, 0xfc, 0x05, 0x11, 0xf6, 0xee, 0xe8, 0xf2,
+    0xe1, 0x08, 0x26, 0x04, 0xed, 0x03, 0xe0, 0xfb, 0xee, 0x0c, 0xee, 0xf6,
+    0x04, 0x2d, 0xf2, 0xd3, 0xf4, 0xe0, 0xf8, 0x0c, 0xfe, 0x11, 0x0b, 0xd7,
+    0xfd, 0x18, 0x07, 0x0d, 0x07, 0x08, 0xf4, 0xc6, 0x0a, 0x0a, 0x1f, 0x0c,
+    0xf4, 0x1d, 0x02, 0x0b, 0x09, 0x0e, 0x21, 0xff, 0x17, 0x0b, 0x0d, 0xf2,
+    0xed, 0xd7, 0x0a, 0xf8, 0x03, 0x06, 0xfa, 0xe5, 0xfd, 0x03, 0x14, 0x0f,
+    0xe9, 0x1a, 0xf4, 0xda, 0x01, 0xe6, 0x09, 0x06, 0x11, 0x0d, 0xfd, 0xeb,
+    0x16, 0x23, 0xfa, 0x00, 0x0b, 0x17, 0xf7, 0xda, 0xd7, 0x1b, 0xfa, 0x01,
+    0x03, 0x05, 0xfe, 0xd6, 0x02, 0xee, 0xee, 0x02, 0xf3, 0x06, 0xed, 0x03,
+    0xec, 0x01, 0xf2, 0x0f, 0x05, 0x17, 0x0b, 0xfb, 0x0f, 0x05, 0x03, 0x13,
+    0xff, 0x06, 0x02, 0xf5, 0xf4, 0x18, 0x2b, 0xf0, 0x00, 0x17, 0xfc, 0xfd,
+    0x05, 0x0b, 0x0e, 0x14, 0xe1, 0x24, 0x08, 0x24, 0xe6, 0xeb, 0x21, 0x12,
+    0xfb, 0x12, 0xe7, 0xf4, 0xe8, 0x0e, 0x18, 0xee, 0xf5, 0xf3, 0xd9, 0xf3,
+    0xdb, 0xec, 0x0c, 0x1e, 0xcf, 0x14, 0xdb, 0xe3, 0xdc, 0x02, 0x0c, 0xfb,
+    0xdb, 0x1b, 0xd0, 0xfe, 0xf9, 0xfe, 0x2a, 0xf5, 0x00, 0x0b, 0xcd, 0xe0,
+    0xe2, 0x0e, 0x04, 0xf8, 0xda, 0x1c, 0xe5, 0x0f, 0xe8, 0xf4, 0xf7, 0x15,
+    0x06, 0xf8, 0x02, 0xf7, 0x0f, 0xfb, 0x17, 0xf9, 0xda, 0x01, 0xda, 0xd1,
+    0xf6, 0x02, 0xfd, 0x16, 0xf1, 0xe4, 0xfa, 0x07, 0xee, 0x0a, 0xf3, 0xfd,
+    0xf2, 0x23, 0xf0, 0xe1, 0x0a, 0x1a, 0x12, 0x1f, 0xef, 0x27, 0x09, 0xf1,
+    0x0c, 0x13, 0x23, 0xfd, 0xf5, 0x03, 0xfe, 0x09, 0xfd, 0x16, 0xf8, 0x07,
+    0x08, 0x25, 0x08, 0xf8, 0xf6, 0x0a, 0xf1, 0xf5, 0x07, 0x09, 0x05, 0xcc,
+    0xf8, 0x08, 0x13, 0xf9, 0x1d, 0x11, 0x0f, 0xdc, 0xee, 0xf3, 0x27, 0xf9,
+    0xf9, 0x22, 0xfa, 0x0d, 0xe2, 0x13, 0xfb, 0x11, 0x03, 0x1e, 0xff, 0xfb,
+    0xed, 0xf1, 0x0e, 0x0b, 0x0f, 0x00, 0x06, 0xe0, 0x15, 0xf3, 0x13, 0xfc,
+    0x18, 0xf9, 0xff, 0x09, 0xfa, 0x1f, 0x12, 0xe5, 0xe2, 0x06, 0xf9, 0xf4,
+    0x07, 0x15, 0x0b, 0x04, 0xdb, 0x0d, 0xeb, 0xf3, 0xe6, 0x06, 0xe5, 0xee,
+    0xd8, 0x22, 0xd8, 0x10, 0xea, 0xf9, 0x1c, 0xf7, 0xd3, 0x11, 0xc3, 0xf8,
+    0xde, 0x05, 0x00, 0xe6, 0x07, 0xfd, 0xd3, 0x03, 0xea, 0xe0, 0x13, 0x14,
+    0xcf, 0xeb, 0xcd, 0xd3, 0xde, 0xf5, 0xf0, 0x0c, 0x0c, 0xfa, 0xeb, 0xd3,
+    0xfb, 0xfd, 0x08, 0xf9, 0xf4, 0x10, 0xfa, 0xd3, 0xf4, 0x11, 0x11, 0xf8,
+    0xef, 0xf8, 0xf8, 0xf1, 0xfc, 0xe1, 0xf7, 0x12, 0x04, 0xf4, 0xfb, 0xed,
+    0xef, 0x0c, 0xfd, 0x1c, 0xfe, 0x0e, 0xfd, 0xe2, 0xfe, 0x0a, 0x02, 0xfe,
+    0xe6, 0x1f, 0xef, 0xe5, 0xe6, 0xf8, 0x16, 0x27, 0xe8, 0x20, 0x05, 0xe3,
+    0xf1, 0xef, 0xee, 0xed, 0x0d, 0x11, 0x16, 0xfb, 0xf3, 0xff, 0x14, 0x01,
+    0xff, 0x15, 0x10, 0x02, 0xe5, 0x28, 0x29, 0x13, 0x13, 0x16, 0xe6, 0x00,
+    0xd2, 0x26, 0xfd, 0x03, 0x04, 0x05, 0x07, 0x06, 0xf1, 0x0e, 0x05, 0x0d,
+    0xe2, 0x0f, 0x02, 0xe1, 0x07, 0xf7, 0x1c, 0xfa, 0x14, 0x30, 0xf7, 0xee,
+    0x00, 0xfa, 0x3d, 0x06, 0x1c, 0x04, 0x06, 0x07, 0x05, 0x1a, 0x10, 0xf6,
+    0xee, 0x0a, 0xeb, 0x04, 0xeb, 0xdf, 0x1d, 0x09, 0xd5, 0xe8, 0xd6, 0xf4,
+    0xf0, 0x0f, 0x1d, 0xea, 0xf2, 0xf8, 0xa6, 0x0b, 0xdc, 0x09, 0x08, 0x24,
+    0xee, 0x24, 0xaa, 0xe4, 0xcb, 0x15, 0xef, 0xe7, 0xe9, 0x0c, 0xcf, 0x06,
+    0xe3, 0x12, 0x11, 0x00, 0x07, 0x14, 0xd7, 0xde, 0xf6, 0x0f, 0x0b, 0x04,
+    0xfb, 0x0d, 0xf8, 0x0d, 0xf6, 0x1b, 0xf1, 0x21, 0xdd, 0xfc, 0xf4, 0xe9,
+    0xf8, 0xe8, 0xf7, 0x06, 0x03, 0x1e, 0xce, 0xe1, 0xea, 0xf6, 0x05, 0xf9,
+    0x16, 0x15, 0x04, 0xe0, 0x14, 0xf7, 0x1e, 0x1c, 0x0a, 0x27, 0xef, 0xf3,
+    0x0f, 0xf3, 0xee, 0x04, 0xf8, 0xf1, 0x07, 0xe3, 0x05, 0x0b, 0x00, 0x1c,
+    0x15, 0x27, 0x07, 0xf7, 0xfa, 0x0b, 0xfa, 0xfa, 0x17, 0x13, 0xe1, 0xf5,
+    0xfb, 0x0c, 0x21, 0x2f, 0xd7, 0xfb, 0xf5, 0xfd, 0xd3, 0xf4, 0x07, 0x0e,
+    0xfd, 0x0b, 0xfc, 0xfa, 0xf5, 0x0e, 0x02, 0xfa, 0xfa, 0x19, 0xfd, 0xfa,
+    0xfc, 0x13, 0x24, 0x0c, 0xe4, 0x31, 0xf8, 0x12, 0xf4, 0x04, 0x18, 0x29,
+    0x27, 0x19, 0xfc, 0x08, 0x11, 0xe3, 0x07, 0xfe, 0x26, 0x40, 0x05, 0x02,
+    0x04, 0x02, 0x0f, 0xee, 0xf4, 0x27, 0xea, 0xf4, 0xf5, 0x11, 0x26, 0x0b,
+    0xe7, 0x05, 0xd2, 0xf6, 0xea, 0xfa, 0x0b, 0xf9, 0xfa, 0x16, 0xba, 0x00,
+    0xfb, 0x0d, 0x0b, 0xf9, 0xe6, 0xf6, 0xc5, 0xf8, 0xf6, 0x01, 0x0f, 0xed,
+    0xed, 0x13, 0xcd, 0x0d, 0xda, 0x06, 0x17, 0xee, 0x07, 0x1d, 0xb8, 0xfa,
+    0xe2, 0xea, 0xf2, 0xee, 0x04, 0x00, 0xdc, 0xd0, 0xfb, 0xf5, 0xec, 0xfe,
+    0xf1, 0x0d, 0xf0, 0xdb, 0xf9, 0x0d, 0x03, 0x03, 0x0e, 0x0a, 0xda, 0xd6,
+    0x01, 0xf2, 0x06, 0x14, 0x1c, 0x1f, 0xe8, 0xe8, 0x0e, 0xfd, 0x0c, 0xf5,
+    0xf3, 0x3d, 0xf3, 0x05, 0x10, 0xfa, 0x1b, 0x18, 0x08, 0x36, 0x09, 0xf1,
+    0xeb, 0xf9, 0x22, 0x01, 0xf3, 0xf7, 0xff, 0xf0, 0x0c, 0xe9, 0x01, 0x29,
+    0x21, 0x15, 0x03, 0xee, 0xe9, 0x1a, 0xf7, 0x15, 0x06, 0x25, 0xfa, 0xf0,
+    0xe4, 0xf1, 0x1f, 0x01, 0xdc, 0x2d, 0xce, 0xe9, 0xea, 0x0b, 0x06, 0x2c,
+    0x0a, 0x30, 0xe7, 0x09, 0xf4, 0xf0, 0x10, 0x29, 0xf9, 0x3d, 0xe7, 0xdc,
+    0xe4, 0xf7, 0x3b, 0x27, 0x23, 0x3a, 0x0a, 0x06, 0x0e, 0xfd, 0x2c, 0x07,
+    0x2b, 0x1c, 0xfa, 0x00, 0xf9, 0x11, 0xea, 0x14, 0xeb, 0xfc, 0x18, 0x03,
+    0xf1, 0x16, 0x12, 0x04, 0xcf, 0x12, 0xdd, 0xe4, 0x0e, 0xf0, 0x09, 0xe8,
+    0xf3, 0xfb, 0xa8, 0xf9, 0xee, 0xfb, 0x1e, 0x1d, 0xfd, 0x05, 0xab, 0xe5,
+    0xff, 0x01, 0xfe, 0x04, 0xf9, 0x02, 0xb9, 0xdc, 0xdf, 0x05, 0xf1, 0xef,
+    0xf1, 0x1e, 0xc7, 0xee, 0xf7, 0x1e, 0x00, 0x00, 0xf8, 0x10, 0xec, 0xe8,
+    0x04, 0x0f, 0xf6, 0xff, 0x04, 0x09, 0xe0, 0x0a, 0x0e, 0xe4, 0xf0, 0xf1,
+    0x16, 0x2b, 0xd3, 0xe1, 0x0a, 0xef, 0xf9, 0xfe, 0x0b, 0x22, 0xf5, 0x01,
+    0x0a, 0xf8, 0x02, 0x00, 0x17, 0x19, 0xf3, 0x05, 0x21, 0xfa, 0xee, 0xee,
+    0x12, 0xf2, 0xfa, 0xf5, 0x05, 0x12, 0xee, 0xe4, 0x28, 0xfa, 0xf1, 0x03,
+    0x15, 0x16, 0x18, 0xfd, 0x0f, 0x21, 0x04, 0xf4, 0xe5, 0x0c, 0x06, 0x13,
+    0xde, 0x36, 0xe8, 0xfb, 0xe7, 0xfd, 0xf6, 0x12, 0x0e, 0x1d, 0xea, 0xf8,
+    0xd4, 0xe8, 0x19, 0x07, 0xe5, 0x1c, 0xf7, 0x0c, 0xef, 0x05, 0x0f, 0x09,
+    0xdd, 0x1a, 0xea, 0xd7, 0xf9, 0xf9, 0x12, 0x17, 0x2e, 0x10, 0x08, 0xfe,
+    0x14, 0xf5, 0x1d, 0xfa, 0x06, 0x33, 0xed, 0xfe, 0xf7, 0x11, 0xf0, 0x15,
+    0xe2, 0x24, 0xf6, 0x0a, 0xe2, 0xfc, 0x23, 0x12, 0xdd, 0x11, 0xfd, 0xe5,
+    0x08, 0xff, 0x15, 0xf6, 0xf1, 0x1b, 0xae, 0xfe, 0xe6, 0x15, 0x2c, 0x2d,
+    0x15, 0x15, 0xc5, 0xf8, 0xea, 0xe7, 0x07, 0x04, 0xfe, 0x28, 0xa1, 0xf2,
+    0xe1, 0xf9, 0xf8, 0xff, 0xf4, 0x22, 0xb4, 0xdb, 0x03, 0x20, 0xe6, 0xf3,
+    0x0e, 0x19, 0xe3, 0x0a, 0xfa, 0xee, 0xf3, 0xe5, 0xd8, 0xf9, 0xf1, 0xde,
+    0x06, 0x05, 0xf2, 0xf5, 0xe7, 0x16, 0xd8, 0xfe, 0x07, 0xea, 0xee, 0x0e,
+    0xfa, 0xff, 0xdb, 0xe7, 0x03, 0xed, 0x01, 0xfd, 0x09, 0x1a, 0xfa, 0xe6,
+    0x05, 0x10, 0xe9, 0x01, 0x1f, 0x13, 0xf7, 0xf6, 0xfb, 0x13, 0xff, 0xdb,
+    0xed, 0xfe, 0x0a, 0x10, 0x09, 0x29, 0xf5, 0x04, 0xf5, 0x26, 0x0d, 0x0c,
+    0xf9, 0x16, 0xfa, 0x02, 0xf4, 0x2e, 0xde, 0xf5, 0xe1, 0x1d, 0xfb, 0x02,
+    0x0b, 0x23, 0x07, 0xea, 0xd9, 0x0a, 0xf3, 0x0a, 0x0f, 0x1e, 0xe7, 0xf1,
+    0xd7, 0x0b, 0xf6, 0xff, 0x0d, 0x24, 0xcc, 0x0a, 0xee, 0xda, 0x14, 0x12,
+    0x11, 0x29, 0xf4, 0x1a, 0xef, 0x0b, 0xfa, 0xec, 0x0c, 0x1b, 0xf4, 0xff,
+    0xf5, 0xef, 0x0f, 0x10, 0xd4, 0x04, 0xf9, 0xf8, 0xec, 0xf9, 0x21, 0x05,
+    0xd3, 0x27, 0xf3, 0x17, 0xff, 0xf6, 0x15, 0xf9, 0xed, 0x0a, 0xac, 0x02,
+    0xfd, 0xfb, 0x04, 0x29, 0x06, 0x03, 0xb8, 0xe6, 0xd5, 0x17, 0x09, 0x1b,
+    0xf6, 0x1b, 0xab, 0xdc, 0xdf, 0xfd, 0x06, 0x09, 0x09, 0x37, 0xbb, 0xed,
+    0x19, 0xd7, 0xe2, 0xdd, 0x05, 0x01, 0xec, 0xfb, 0xe4, 0x0e, 0xeb, 0xf0,
+    0x03, 0x17, 0x04, 0xeb, 0x09, 0xee, 0xeb, 0xe7, 0x0c, 0x16, 0xcb, 0x0e,
+    0x17, 0xd8, 0xe1, 0xf8, 0x2b, 0x19, 0xde, 0xeb, 0x10, 0xf2, 0xff, 0xf8,
+    0xee, 0x0e, 0xe7, 0xf0, 0x15, 0x08, 0xf8, 0xdf, 0x06, 0x0d, 0xf9, 0x14,
+    0xfa, 0x0b, 0x04, 0xfd, 0x15, 0x23, 0x20, 0xff, 0xfd, 0x1d, 0x0c, 0xf1,
+    0xfe, 0x15, 0x0a, 0x02, 0xed, 0xfe, 0xfb, 0x04, 0xfb, 0x1e, 0xdd, 0x05,
+    0xe0, 0x16, 0xf9, 0xf6, 0xfd, 0x32, 0xdc, 0xf2, 0xd3, 0x08, 0xf4, 0xec,
+    0x17, 0x25, 0xe2, 0xf0, 0xee, 0xf1, 0x0d, 0xfe, 0x13, 0x2d, 0x01, 0x11,
+    0xd4, 0xe4, 0x07, 0xfb, 0x32, 0x11, 0x14, 0x07, 0xd7, 0x02, 0x10, 0xeb,
+    0x2b, 0x1d, 0x01, 0xfc, 0xf3, 0xf0, 0x13, 0x1a, 0xdb, 0x20, 0x00, 0xf0,
+    0xf0, 0x05, 0x16, 0x03, 0xd4, 0xe3, 0xc2, 0xf0, 0x06, 0x02, 0x1e, 0x0a,
+    0xec, 0x1f, 0xab, 0xea, 0xfa, 0xe3, 0x20, 0x22, 0x03, 0x1b, 0xb3, 0x0e,
+    0xe3, 0xf3, 0x1d, 0x27, 0xe3, 0x10, 0xa7, 0xda, 0xf3, 0x00, 0x0a, 0x0a,
+    0x04, 0xfb, 0xb2, 0x0f, 0x0c, 0xf5, 0x07, 0xff, 0x13, 0x1e, 0xdb, 0xf6,
+    0xf9, 0xef, 0xe8, 0xe7, 0xfb, 0x18, 0xeb, 0xec, 0x09, 0xda, 0xf1, 0xf0,
+    0x0b, 0x04, 0xe1, 0xfa, 0x1c, 0x25, 0xee, 0x01, 0x0b, 0x29, 0xd7, 0x0c,
+    0x04, 0x0b, 0xef, 0xfd, 0x1c, 0xfc, 0xf1, 0xfb, 0x0b, 0x0f, 0xdf, 0xed,
+    0x17, 0x38, 0x0c, 0xd7, 0xff, 0xfd, 0x01, 0xfc, 0xfb, 0xfb, 0x18, 0x1a,
+    0x18, 0xe3, 0xf9, 0xf4, 0xfa, 0x20, 0x06, 0x09, 0x11, 0x08, 0x1d, 0xf8,
+    0xfa, 0x1d, 0xf5, 0x1c, 0xf5, 0xfe, 0x03, 0x07, 0xe4, 0x33, 0xc8, 0x0c,
+    0xe1, 0x13, 0xff, 0xe5, 0x10, 0x2c, 0xd3, 0xf0, 0xed, 0x04, 0x07, 0x01,
+    0xf1, 0x16, 0xe0, 0x13, 0xfa, 0x11, 0x07, 0xfa, 0x19, 0x16, 0x01, 0x00,
+    0x07, 0x26, 0x00, 0xec, 0x1d, 0x23, 0x05, 0xf4, 0x07, 0x17, 0x2c, 0x1d,
+    0xee, 0xf0, 0x0c, 0x09, 0xe3, 0x1a, 0x24, 0x0b, 0xf3, 0x1e, 0xce, 0xfe,
+    0xfe, 0x12, 0x21, 0x1a, 0xf6, 0x23, 0xc3, 0x03, 0xf4, 0x10, 0x1a, 0x2a,
+    0xf4, 0x08, 0xbf, 0xff, 0x04, 0xf4, 0x0b, 0x1d, 0x1a, 0xf8, 0xcc, 0x00,
+    0xf7, 0x13, 0xf4, 0xfd, 0xf4, 0x19, 0xbd, 0xef, 0x0c, 0x0d, 0x02, 0xfc,
+    0x12, 0x13, 0xe9, 0xe7, 0xf5, 0xfa, 0xfa, 0xf6, 0x1a, 0x2e, 0xce, 0xd4,
+    0x01, 0x12, 0xfd, 0xfc, 0x26, 0x10, 0xcc, 0xe7, 0xee, 0x13, 0xee, 0xff,
+    0xef, 0xea, 0x00, 0x0e, 0x1a, 0x17, 0x04, 0x0c, 0x04, 0x0c, 0xe6, 0xf3,
+    0xf6, 0xdb, 0xdd, 0x04, 0xf4, 0x22, 0x11, 0x16, 0xf3, 0x07, 0xec, 0xf8,
+    0xf2, 0x07, 0x03, 0x02, 0xf5, 0x0a, 0xf6, 0x02, 0x1d, 0x1b, 0x11, 0x06,
+    0xf8, 0x06, 0x02, 0xea, 0xf3, 0x1d, 0xce, 0x00, 0xed, 0xf9, 0xef, 0xf6,
+    0xec, 0x22, 0xc7, 0xf0, 0xed, 0xdb, 0xe0, 0x02, 0x11, 0x07, 0xe8, 0xf0,
+    0xd1, 0xed, 0xff, 0xfd, 0x0c, 0x2e, 0xd4, 0xed, 0xec, 0x0e, 0xf1, 0x07,
+    0x01, 0x0e, 0x0e, 0xfe, 0xda, 0x0b, 0x0a, 0x0a, 0x1f, 0x2e, 0x13, 0x07,
+    0x00, 0x07, 0x14, 0x21, 0xe9, 0xfc, 0xf0, 0x1e, 0xd7, 0xea, 0x34, 0x07,
+    0xc6, 0x0c, 0xd4, 0xec, 0xfd, 0x06, 0x24, 0x0a, 0xf3, 0x15, 0xaf, 0xff,
+    0xe9, 0xf1, 0x0d, 0x3e, 0xe9, 0x18, 0xba, 0x13, 0xed, 0xd7, 0x0b, 0x31,
+    0x05, 0x0e, 0xaf, 0x13, 0xd6, 0x0e, 0x10, 0x02, 0x02, 0x14, 0xcb, 0xd5,
+    0xf9, 0x0c, 0xf9, 0x0e, 0x1f, 0x24, 0xd5, 0xeb, 0xff, 0xf1, 0xf5, 0x0c,
+    0x08, 0x07, 0xf4, 0xd7, 0x06, 0x10, 0xe8, 0xef, 0xfc, 0x2f, 0xee, 0xf1,
+    0x18, 0xf8, 0xf4, 0x02, 0x11, 0x21, 0xd3, 0x12, 0x14, 0xe4, 0xf4, 0x02,
+    0x05, 0x24, 0xca, 0xf2, 0xf3, 0xeb, 0xe7, 0xf8, 0x16, 0x1a, 0xeb, 0x0d,
+    0x05, 0x16, 0xf1, 0xec, 0x11, 0x1c, 0x09, 0x1e, 0xe0, 0xe6, 0xfa, 0x0e,
+    0x0d, 0x2a, 0xea, 0x2e, 0xed, 0xf9, 0xf7, 0x16, 0x09, 0x05, 0xdd, 0xd6,
+    0x02, 0xeb, 0xf5, 0xf3, 0xe4, 0x3b, 0xed, 0x04, 0xe0, 0x0e, 0xfd, 0x09,
+    0xfd, 0x35, 0xdc, 0x18, 0xf3, 0x04, 0xfa, 0x05, 0x15, 0x34, 0xe5, 0xe1,
+    0xe4, 0xf4, 0xe0, 0xf9, 0x08, 0x32, 0x04, 0x08, 0xf4, 0x0f, 0xff, 0x08,
+    0x09, 0x2f, 0x06, 0x02, 0xfd, 0x05, 0x0c, 0x24, 0xe3, 0x1e, 0xf5, 0x0c,
+    0xdd, 0xf8, 0x18, 0x20, 0xd8, 0x14, 0xef, 0xf4, 0x17, 0x08, 0x25, 0x14,
+    0x04, 0x06, 0xb0, 0xf5, 0xf5, 0x09, 0x0f, 0x3e, 0xff, 0x28, 0xb3, 0xf5,
+    0x19, 0xd8, 0x14, 0x21, 0xd9, 0xf7, 0xb7, 0xe5, 0xfe, 0xe7, 0x07, 0x1e,
+    0x04, 0x15, 0xc5, 0xf9, 0x14, 0x20, 0xeb, 0x01, 0x01, 0x18, 0xce, 0x00,
+    0xe6, 0xe2, 0xf7, 0xfb, 0xf3, 0x0d, 0xd3, 0xf3, 0x04, 0xf8, 0xf0, 0x03,
+    0xf1, 0x25, 0xb5, 0xef, 0x05, 0xe0, 0x01, 0xf6, 0x04, 0x16, 0xd1, 0x01,
+    0x0a, 0x21, 0x01, 0x05, 0x0e, 0x01, 0xf0, 0x0a, 0xf3, 0x00, 0x03, 0xf8,
+    0xfa, 0x03, 0x0b, 0xde, 0xfe, 0xff, 0xfb, 0xea, 0x09, 0x02, 0xf5, 0xe8,
+    0xe7, 0x08, 0x00, 0xf5, 0xf8, 0x0f, 0x13, 0xfa, 0xeb, 0xe8, 0xfb, 0x1f,
+    0x08, 0x16, 0xe6, 0xfa, 0xe1, 0x00, 0x03, 0xdd, 0xf1, 0x26, 0xe5, 0x1d,
+    0xd9, 0xff, 0xf2, 0xf8, 0xff, 0x33, 0xea, 0xe5, 0x03, 0x0c, 0x07, 0xf9,
+    0xf8, 0x0f, 0xe1, 0x1e, 0xdd, 0x0f, 0x00, 0xf1, 0x06, 0x21, 0x09, 0x05,
+    0xf3, 0xec, 0xe6, 0x04, 0x07, 0x32, 0xf1, 0xf9, 0xf2, 0x01, 0x18, 0x1f,
+    0xd2, 0xe2, 0x0a, 0xf4, 0xca, 0xfc, 0x28, 0x16, 0xc2, 0x10, 0xf2, 0xfc,
+    0x08, 0xe9, 0x2a, 0x0f, 0xfa, 0xf5, 0xa9, 0x07, 0xec, 0xe9, 0x19, 0x43,
+    0x0b, 0x1c, 0xa6, 0xe9, 0xf4, 0x16, 0x0d, 0x2b, 0xfc, 0x11, 0x9a, 0xe1,
+    0xf1, 0x1c, 0xf5, 0x0f, 0xe4, 0x18, 0xc0, 0xd9, 0x14, 0x26, 0xe6, 0xf8,
+    0x0a, 0x17, 0xec, 0xfb, 0xe1, 0x22, 0xdf, 0xf2, 0xfe, 0x1e, 0xd4, 0xeb,
+    0xd7, 0x0e, 0x08, 0xf6, 0xef, 0xfc, 0xe6, 0xd4, 0xf7, 0x0b, 0xfb, 0xf5,
+    0x01, 0x25, 0xd7, 0xfb, 0x0d, 0xfe, 0xff, 0xf3, 0x1d, 0x32, 0xfe, 0xee,
+    0x12, 0xf2, 0x0c, 0xec, 0x02, 0x10, 0xef, 0x01, 0xf2, 0x0b, 0xf3, 0xf7,
+    0xfa, 0x25, 0xfb, 0x0d, 0x11, 0x15, 0x04, 0xfc, 0x0c, 0x21, 0x12, 0x29,
+    0x00, 0xfa, 0xf6, 0xf5, 0x06, 0x22, 0xea, 0xe2, 0xee, 0x00, 0xfd, 0xf0,
+    0x0b, 0x1d, 0xd3, 0xe4, 0xe4, 0x0a, 0xfc, 0xe8, 0xea, 0x2c, 0xed, 0xed,
+    0xef, 0xe8, 0xf2, 0x05, 0xfd, 0x15, 0xd8, 0xda, 0xca, 0xee, 0xfa, 0x00,
+    0xfe, 0x0e, 0xf2, 0xf0, 0x0e, 0xf5, 0x04, 0x03, 0x1d, 0x2b, 0xee, 0x05,
+    0x0f, 0x10, 0x13, 0x35, 0xe2, 0x04, 0x10, 0xdf, 0xcf, 0xeb, 0x40, 0x26,
+    0xe4, 0x03, 0xf3, 0xf9, 0xf5, 0x14, 0x24, 0x2a, 0xdf, 0xfe, 0xab, 0xe5,
+    0xfe, 0x1c, 0x27, 0x35, 0xdb, 0xff, 0xac, 0x01, 0xf6, 0xfc, 0x19, 0x1a,
+    0x11, 0x1f, 0xa8, 0xf5, 0x02, 0x0f, 0x1a, 0x1f, 0xf7, 0xf2, 0xa2, 0x00,
+    0x15, 0x22, 0xe4, 0x13, 0x00, 0x09, 0xd9, 0xd5, 0x02, 0x19, 0xfd, 0xf8,
+    0xe7, 0xff, 0xfb, 0xe0, 0xef, 0xf7, 0xee, 0xf3, 0xf3, 0x19, 0xb0, 0xdf,
+    0x00, 0x0f, 0x08, 0xf3, 0x15, 0x17, 0xec, 0x0f, 0x11, 0x14, 0x02, 0x08,
+    0x10, 0x17, 0xe6, 0x08, 0xf7, 0x00, 0xed, 0xf7, 0x29, 0x07, 0x10, 0x05,
+    0x05, 0xe7, 0xed, 0xf4, 0xf9, 0x15, 0xf9, 0xf0, 0x08, 0x00, 0x03, 0x09,
+    0x21, 0x28, 0xf6, 0x0e, 0xfb, 0xf3, 0x03, 0xf7, 0x0f, 0x0c, 0xf0, 0xf5,
+    0xe3, 0xd8, 0xf8, 0xf2, 0x09, 0x1c, 0xe7, 0xfb, 0xe4, 0xf6, 0xfa, 0xf8,
+    0xf1, 0x42, 0xf6, 0xda, 0xdd, 0xd7, 0xfa, 0xff, 0x2f, 0x2c, 0xda, 0x0a,
+    0xde, 0xec, 0xf1, 0x14, 0xfb, 0x1d, 0xeb, 0xee, 0xf2, 0xeb, 0xf3, 0xed,
+    0x0e, 0x35, 0xf0, 0x06, 0x19, 0x04, 0x2f, 0x23, 0xe2, 0x07, 0x13, 0x0f,
+    0xe9, 0xf0, 0x22, 0x2e, 0xd9, 0x1a, 0xcb, 0xed, 0xfd, 0x04, 0x27, 0x1e,
+    0xf6, 0x07, 0x96, 0xd6, 0xd8, 0x11, 0x18, 0x56, 0xd2, 0xfb, 0x92, 0xfc,
+    0x0b, 0x0a, 0x17, 0x2c, 0xe5, 0x04, 0xa2, 0xf8, 0xe2, 0x04, 0x1a, 0x0d,
+    0xeb, 0x11, 0xa2, 0xe5, 0xe5, 0xf8, 0x02, 0xf7, 0x17, 0x03, 0xca, 0xe9,
+    0x0c, 0x1f, 0xfe, 0xf5, 0x18, 0x12, 0xdd, 0x08, 0x15, 0xff, 0xfc, 0xf6,
+    0xe1, 0x1d, 0xe2, 0xe1, 0xfe, 0xfc, 0x03, 0xff, 0xf2, 0x23, 0xd2, 0x01,
+    0x13, 0xdd, 0xf3, 0xf4, 0xf2, 0x07, 0xef, 0x03, 0x15, 0x21, 0xd8, 0xf8,
+    0x09, 0xf3, 0xe8, 0xea, 0xe8, 0xf2, 0x08, 0xf0, 0x04, 0x1a, 0xf2, 0x19,
+    0xfb, 0x1b, 0x15, 0xfc, 0x1d, 0x30, 0xe5, 0x1e, 0x09, 0xe8, 0xe9, 0x09,
+    0xf7, 0x2a, 0xe1, 0x0e, 0x00, 0x21, 0xf3, 0xff, 0xfb, 0x01, 0xdf, 0xf2,
+    0xfe, 0xf4, 0xfc, 0xf0, 0x0b, 0x0b, 0xdd, 0xe4, 0xd2, 0x14, 0xf7, 0xfe,
+    0x0b, 0x39, 0x01, 0xe6, 0xe4, 0x27, 0xfa, 0xe4, 0x04, 0x2c, 0xe2, 0x04,
+    0xf5, 0x07, 0xf2, 0x03, 0xf0, 0x10, 0xf5, 0xf6, 0xfc, 0x16, 0x22, 0x1b,
+    0xf8, 0x11, 0xe4, 0x09, 0xf6, 0xf0, 0x41, 0x1e, 0xcf, 0x04, 0xea, 0xee,
+    0x0e, 0xf6, 0x1b, 0x2f, 0xc7, 0xf1, 0xba, 0xef, 0x0f, 0x16, 0x1e, 0x39,
+    0x05, 0x1e, 0x90, 0xe6, 0x0d, 0xfa, 0x22, 0x3f, 0xe3, 0x23, 0xa5, 0xe3,
+    0xe9, 0x0f, 0x05, 0x27, 0x02, 0x11, 0x99, 0x05, 0xfa, 0x05, 0x03, 0x01,
+    0xff, 0x26, 0xd3, 0xf7, 0xf7, 0xf9, 0x05, 0xf4, 0xef, 0x23, 0xd2, 0xdd,
+    0x05, 0x08, 0xfa, 0xff, 0x03, 0x04, 0xbd, 0xd7, 0x14, 0x06, 0xef, 0x06,
+    0xe5, 0x05, 0xea, 0xea, 0x02, 0xfd, 0x0d, 0x00, 0x08, 0xff, 0xe7, 0xfb,
+    0xfe, 0x13, 0xfe, 0xec, 0xf9, 0x02, 0xf3, 0xff, 0xff, 0x08, 0x04, 0xed,
+    0x19, 0x1d, 0xfa, 0x0a, 0x0d, 0xf2, 0x0f, 0xec, 0x25, 0x1c, 0xec, 0x0b,
+    0x01, 0xff, 0x01, 0xf6, 0x08, 0x09, 0xe8, 0xe2, 0xec, 0x23, 0xe5, 0xe9,
+    0xf0, 0x2e, 0xbd, 0xe1, 0xef, 0x14, 0xe9, 0xf6, 0xf5, 0x1d, 0xdc, 0xe3,
+    0xd7, 0xfc, 0xf9, 0xf2, 0xfe, 0x24, 0xf2, 0x05, 0xd5, 0xed, 0xe9, 0xf9,
+    0xfa, 0x2d, 0xf0, 0xfe, 0xee, 0xf2, 0xe8, 0xf7, 0x06, 0x14, 0x01, 0x10,
+    0x06, 0xf3, 0x0e, 0x0e, 0xc2, 0x1d, 0xf2, 0x1c, 0xed, 0xe3, 0x53, 0x21,
+    0xb8, 0x0c, 0xde, 0x03, 0x15, 0xeb, 0x46, 0x39, 0xdf, 0xf6, 0xa3, 0xee,
+    0xf6, 0xe0, 0x33, 0x50, 0xdd, 0x27, 0x9f, 0x07, 0x13, 0xe2, 0x1f, 0x35,
+    0xed, 0x1f, 0xb7, 0x07, 0x11, 0xed, 0x17, 0x28, 0xf4, 0x20, 0xc1, 0xec,
+    0xef, 0x16, 0x02, 0xfa, 0xe0, 0x1b, 0xf7, 0xdb, 0xfd, 0x0a, 0xe7, 0xfb,
+    0xe7, 0x25, 0xe2, 0xe7, 0xf8, 0xf0, 0xee, 0xe9, 0x02, 0x06, 0xc9, 0xe4,
+    0x14, 0xe3, 0xe2, 0xf7, 0xf8, 0xfd, 0xdd, 0xe2, 0x08, 0x0a, 0xe4, 0x05,
+    0xf5, 0x16, 0xe7, 0x01, 0x00, 0x1c, 0xe7, 0xf0, 0xf6, 0x19, 0xfe, 0x0c,
+    0xf2, 0x06, 0x03, 0xe8, 0x0b, 0xfe, 0xe3, 0x19, 0x08, 0x1a, 0x10, 0xfd,
+    0x00, 0x21, 0xf0, 0xeb, 0x18, 0x02, 0xf3, 0x04, 0xf0, 0x18, 0xdb, 0x05,
+    0x01, 0xde, 0xed, 0xe9, 0x23, 0x15, 0xaf, 0xe6, 0xf1, 0x0a, 0xe6, 0xea,
+    0x01, 0x18, 0xd8, 0xfd, 0xf1, 0xe6, 0xec, 0xf5, 0x0e, 0x1e, 0xcc, 0xfc,
+    0xe7, 0x00, 0xe9, 0x11, 0x00, 0x30, 0xf9, 0x14, 0xf4, 0x19, 0xdd, 0xf7,
+    0xf7, 0x2f, 0xf4, 0xf2, 0xff, 0x27, 0x15, 0x1c, 0xbc, 0x2f, 0xe9, 0x14,
+    0xf5, 0xe8, 0x44, 0x30, 0xe8, 0x1d, 0xe4, 0x18, 0x11, 0x00, 0x0c, 0x2b,
+    0xf3, 0x29, 0x96, 0xe0, 0x06, 0xee, 0x3e, 0x55, 0xdc, 0x13, 0x98, 0xdf,
+    0xf0, 0xfe, 0x17, 0x33, 0xe8, 0x09, 0xa3, 0x07, 0xef, 0x0e, 0x1d, 0x37,
+    0xdd, 0xfe, 0xb5, 0x00, 0xf7, 0xe0, 0xea, 0xfd, 0xfd, 0x19, 0xbc, 0xfd,
+    0x15, 0xfe, 0x01, 0xf3, 0xd5, 0x20, 0xbf, 0xe3, 0x15, 0x0e, 0xf0, 0xf6,
+    0xf2, 0x14, 0xcc, 0xf0, 0xf7, 0x04, 0xf2, 0xff, 0x0b, 0x02, 0xd2, 0xd8,
+    0xfa, 0xfc, 0xe5, 0x02, 0x00, 0xfb, 0xf0, 0xdc, 0x1e, 0x10, 0x02, 0x01,
+    0x00, 0x18, 0xe9, 0xdb, 0x1e, 0xf6, 0xfc, 0x03, 0xef, 0x0a, 0x00, 0x16,
+    0x00, 0x0f, 0xf4, 0x16, 0xfa, 0x0b, 0xe2, 0xfa, 0xe0, 0x07, 0xfb, 0x02,
+    0x21, 0x0e, 0xdd, 0x0b, 0xea, 0xf0, 0xeb, 0xfb, 0x19, 0x09, 0xd4, 0xf2,
+    0xef, 0x0b, 0x00, 0xeb, 0x1a, 0x2f, 0xea, 0x06, 0x03, 0xf6, 0xf8, 0xfb,
+    0xfe, 0x1d, 0xea, 0xdd, 0xed, 0xfd, 0xfb, 0xe7, 0xfe, 0x18, 0xf4, 0xfc,
+    0x0b, 0xf6, 0xfc, 0x0b, 0xfb, 0x28, 0x07, 0xff, 0x07, 0x1e, 0x03, 0x21,
+    0xcf, 0x22, 0x05, 0xe6, 0xea, 0xe7, 0x43, 0x2e, 0xe7, 0x14, 0xfb, 0x0a,
+    0x1e, 0xfe, 0x2c, 0x24, 0xd5, 0xfd, 0x9e, 0xd1, 0xf2, 0x1c, 0x32, 0x51,
+    0x01, 0xf3, 0xac, 0xe1, 0xf4, 0xe5, 0x1c, 0x37, 0xf1, 0x0f, 0xa7, 0xdb,
+    0x00, 0xf6, 0x0f, 0x18, 0xe1, 0x10, 0xc9, 0xc5, 0xe8, 0xeb, 0xf2, 0xfd,
+    0xf6, 0x02, 0xc2, 0xff, 0x00, 0x19, 0x03, 0x0f, 0x02, 0x22, 0xd4, 0xe7,
+    0x07, 0x0f, 0xe5, 0x1a, 0x09, 0x0b, 0xdc, 0xd2, 0x00, 0x05, 0xee, 0xf8,
+    0xdc, 0x14, 0xd0, 0x0a, 0x0a, 0xfa, 0xeb, 0x04, 0xf3, 0x06, 0xde, 0x05,
+    0xfb, 0xfd, 0xe3, 0xec, 0xfd, 0x14, 0xd7, 0x11, 0x0e, 0xe6, 0x06, 0xec,
+    0xde, 0x22, 0xd7, 0x00, 0x03, 0xf5, 0xf5, 0x0d, 0x01, 0x05, 0xea, 0x0b,
+    0x16, 0x04, 0xff, 0x13, 0xf3, 0x12, 0xd2, 0xdf, 0x0b, 0xe4, 0x06, 0xf6,
+    0x08, 0x2d, 0xd3, 0xd6, 0xe7, 0x0a, 0xec, 0xff, 0xfe, 0x01, 0xdf, 0xf4,
+    0xdf, 0x1c, 0xfe, 0xf9, 0xf7, 0x13, 0xca, 0xff, 0x03, 0x06, 0xe9, 0xf7,
+    0x06, 0x08, 0xd7, 0xf3, 0xed, 0x08, 0xe3, 0xfd, 0x0c, 0x11, 0x15, 0xfb,
+    0x15, 0x08, 0x28, 0x40, 0xe7, 0x0d, 0x08, 0xec, 0xe8, 0x16, 0x67, 0x46,
+    0xc8, 0x16, 0xf1, 0x02, 0x24, 0x00, 0x3a, 0x43, 0xd6, 0x12, 0xae, 0xe7,
+    0xf4, 0xf8, 0x3a, 0x65, 0xe4, 0x0c, 0xb2, 0xef, 0x1f, 0xe8, 0x29, 0x59,
+    0xf8, 0x11, 0xc4, 0xe1, 0xfe, 0xfa, 0x27, 0x43, 0xc9, 0x1e, 0xbb, 0xfb,
+    0xf3, 0x13, 0x15, 0x0d, 0xf1, 0x13, 0xcd, 0xf0, 0x07, 0x19, 0x07, 0x00,
+    0xd8, 0xeb, 0xbf, 0xf0, 0xfc, 0xf6, 0xef, 0x16, 0x01, 0x02, 0xc1, 0xdf,
+    0xfd, 0xe9, 0x06, 0x06, 0xf1, 0x08, 0xd7, 0xcc, 0xfb, 0x0e, 0xfc, 0x14,
+    0xf2, 0x1a, 0xe2, 0x0d, 0xeb, 0x09, 0x07, 0x10, 0xe6, 0x13, 0xeb, 0xf5,
+    0x15, 0x14, 0xeb, 0xfe, 0xf9, 0x17, 0xd2, 0xe3, 0x1e, 0xf5, 0x04, 0x0a,
+    0xf1, 0x0e, 0xde, 0xe7, 0x01, 0x20, 0x0c, 0xfc, 0xdc, 0xf9, 0xe5, 0xe9,
+    0xff, 0x1d, 0x0a, 0xfe, 0xec, 0x25, 0xaf, 0xd2, 0x01, 0x16, 0xfc, 0x17,
+    0xe8, 0x1e, 0xcd, 0xd9, 0xe2, 0xf1, 0xeb, 0x08, 0xff, 0x33, 0xe5, 0xfb,
+    0xeb, 0x04, 0xfe, 0xf7, 0xfd, 0x1f, 0xee, 0xff, 0xed, 0xf8, 0xe0, 0xff,
+    0xfd, 0x2b, 0x0a, 0xf5, 0x15, 0x1d, 0xf3, 0x3f, 0x16, 0xf6, 0xf2, 0xee,
+    0xf4, 0xef, 0xf0, 0x56, 0x0a, 0x1a, 0xbc, 0xfc, 0x2f, 0xfb, 0xf0, 0x56,
+    0x1e, 0x0e, 0xc6, 0xe8, 0x06, 0x0b, 0x11, 0x62, 0x3e, 0xf9, 0xb8, 0xc9,
+    0xed, 0xeb, 0x02, 0x63, 0x2c, 0xfd, 0xc5, 0xe9, 0x00, 0x17, 0x0f, 0x37,
+    0xfe, 0x20, 0xcc, 0xe0, 0xe0, 0x0e, 0xe6, 0x20, 0x0a, 0xfd, 0xdf, 0xee,
+    0x0b, 0x02, 0xee, 0x1f, 0xfb, 0x06, 0xd2, 0xed, 0xfe, 0xeb, 0xfc, 0x12,
+    0xfd, 0x14, 0x00, 0xd8, 0x08, 0xf6, 0xec, 0x17, 0xf9, 0x10, 0x00, 0xd9,
+    0x18, 0xf1, 0xee, 0x0f, 0xf4, 0x03, 0xee, 0xeb, 0xf0, 0xef, 0xf2, 0x06,
+    0x04, 0x00, 0xf4, 0x0f, 0x09, 0x06, 0xf7, 0x0b, 0xfd, 0x01, 0x03, 0x03,
+    0xf4, 0xf6, 0xdd, 0x14, 0x1c, 0xef, 0xf1, 0xdd, 0xf7, 0x13, 0xd9, 0x15,
+    0xef, 0x02, 0xd2, 0xe7, 0x05, 0x05, 0xe2, 0x09, 0xf2, 0x11, 0xf5, 0xba,
+    0xf0, 0x04, 0xe0, 0x01, 0x06, 0x10, 0xe6, 0xef, 0xfc, 0x12, 0xf9, 0xf4,
+    0x1b, 0x2f, 0xe3, 0x0f, 0xd7, 0xf6, 0x0b, 0x11, 0xf7, 0x0c, 0x00, 0x06,
+    0x18, 0xef, 0x06, 0x03, 0x0a, 0x09, 0xf6, 0x1a, 0x0d, 0xed, 0xfe, 0x2c,
+    0x43, 0xf4, 0xe5, 0xde, 0xf5, 0x02, 0x25, 0x5a, 0x49, 0xd4, 0xe6, 0x24,
+    0x1e, 0xf7, 0x0e, 0x5c, 0x5d, 0xf0, 0xf9, 0xe4, 0x1c, 0xeb, 0x28, 0x7f,
+    0x5b, 0xec, 0xfa, 0xdb, 0x0c, 0xf5, 0x20, 0x49, 0x51, 0xe1, 0xed, 0xe6,
+    0x0e, 0x26, 0x28, 0x33, 0x35, 0x05, 0xe1, 0xe4, 0x1f, 0xfc, 0xf9, 0x39,
+    0x18, 0x04, 0xed, 0xed, 0x01, 0xe7, 0xe6, 0x08, 0x09, 0x03, 0xe7, 0xf9,
+    0x0e, 0x06, 0xec, 0x08, 0x12, 0x1a, 0xda, 0xef, 0xdf, 0xf9, 0xe2, 0x1e,
+    0x1c, 0x00, 0x12, 0xd7, 0x01, 0xf7, 0x21, 0x17, 0x13, 0x19, 0xde, 0xe0,
+    0xec, 0x16, 0x01, 0x1b, 0x06, 0x0c, 0xf0, 0xe8, 0x18, 0x03, 0x06, 0x0e,
+    0x09, 0xfa, 0x03, 0xf3, 0xdd, 0x01, 0xfb, 0x0a, 0x2a, 0xf4, 0xf6, 0xda,
+    0xe9, 0xfe, 0xe9, 0x12, 0x19, 0xe9, 0x05, 0xdf, 0x00, 0xeb, 0xf2, 0x10,
+    0x0c, 0xe1, 0xcd, 0xcb, 0xf2, 0x1f, 0xd9, 0x0c, 0xfa, 0xfb, 0xe8, 0xde,
+    0x00, 0xfc, 0xe5, 0x00, 0x11, 0x02, 0xe6, 0x17, 0x14, 0x00, 0xf2, 0xfd,
+    0x00, 0xe1, 0x10, 0x24, 0x12, 0xec, 0xed, 0x1e, 0x09, 0x18, 0x03, 0x0c,
+    0x04, 0xf4, 0x15, 0x0f, 0x10, 0x18, 0xd6, 0x29, 0x10, 0x04, 0x1c, 0xef,
+    0x0f, 0x0c, 0xc7, 0x04, 0xfe, 0xeb, 0xff, 0xf5, 0xe3, 0x15, 0xfe, 0xcb,
+    0x10, 0xff, 0x12, 0xfb, 0xe4, 0xeb, 0xf9, 0x00, 0x02, 0xf1, 0x14, 0x13,
+    0x01, 0x02, 0xf9, 0x01, 0x06, 0x0c, 0xf5, 0x0a, 0x1e, 0x01, 0x19, 0x0e,
+    0x05, 0xf5, 0x0a, 0xff, 0xff, 0xf2, 0xfb, 0xdb, 0xf8, 0x06, 0x17, 0xf2,
+    0xf7, 0x0d, 0x0e, 0xf4, 0xfa, 0xf7, 0x14, 0xdb, 0xe0, 0xfd, 0x08, 0x16,
+    0xf7, 0x16, 0xfc, 0x09, 0x27, 0x07, 0x09, 0xfb, 0x0a, 0xfc, 0x0c, 0xe4,
+    0xdb, 0xee, 0xff, 0x10, 0xf3, 0x09, 0xfa, 0xf4, 0x23, 0xf3, 0xf4, 0x19,
+    0xff, 0xfa, 0xff, 0x19, 0x0f, 0x11, 0xed, 0xec, 0xf8, 0x0f, 0x10, 0xf3,
+    0xff, 0x0b, 0xf7, 0x06, 0x0b, 0x0e, 0x07, 0xe4, 0x18, 0x0a, 0x08, 0x0e,
+    0x02, 0x0a, 0x05, 0x19, 0x02, 0xf3, 0xfe, 0xfe, 0x0b, 0x0f, 0xfc, 0xfa,
+    0x05, 0xf9, 0xe2, 0xf9, 0x1b, 0xf7, 0x0f, 0x07, 0xfc, 0x12, 0xfe, 0x01,
+    0xfd, 0xf0, 0x04, 0xf4, 0xfd, 0x07, 0xf2, 0x04, 0x04, 0x07, 0xef, 0x0c,
+    0xed, 0x0e, 0xf6, 0xef, 0x08, 0x07, 0x04, 0xe9, 0xf3, 0x20, 0xda, 0x15,
+    0xf8, 0xff, 0xec, 0xe0, 0xf6, 0xff, 0xe9, 0x08, 0x01, 0x10, 0xf0, 0xfc,
+    0xe9, 0x08, 0xe8, 0xf5, 0xf8, 0xe5, 0x17, 0xe6, 0x03, 0xfc, 0x09, 0xf5,
+    0xdd, 0xf2, 0xff, 0x05, 0xf6, 0xf8, 0xf5, 0x07, 0xfc, 0xf1, 0x04, 0xf3,
+    0x13, 0xe1, 0x0f, 0xf2, 0x0a, 0xf9, 0xfd, 0x1c, 0xe0, 0x11, 0x1b, 0xe6,
+    0xef, 0x05, 0x05, 0x0c, 0x23, 0x10, 0x09, 0xfe, 0xf7, 0x1a, 0xf1, 0xfc,
+    0x11, 0x1d, 0xff, 0x03, 0x03, 0xe6, 0x07, 0x11, 0x0c, 0x0d, 0x16, 0x05,
+    0x05, 0x25, 0xf3, 0x10, 0x10, 0x06, 0x09, 0xe8, 0x1a, 0xf0, 0xee, 0x09,
+    0xff, 0x24, 0xf7, 0xfb, 0xe6, 0x06, 0xfa, 0x08, 0x03, 0x00, 0xf2, 0x04,
+    0xf0, 0xeb, 0x14, 0x1c, 0x03, 0x21, 0x14, 0x1d, 0xfe, 0x03, 0xf6, 0x02,
+    0x09, 0xff, 0x00, 0x13, 0xef, 0x10, 0x1e, 0x0b, 0x1d, 0x1c, 0xf1, 0xf6,
+    0xe7, 0xfd, 0x14, 0x01, 0xff, 0x13, 0xf7, 0xfc, 0x00, 0x21, 0xe3, 0xeb,
+    0x07, 0x0e, 0x09, 0xf1, 0xf8, 0xfd, 0x03, 0xee, 0x19, 0xfd, 0xff, 0xfb,
+    0xff, 0xea, 0xfb, 0x07, 0xf0, 0x0a, 0x04, 0x04, 0x0b, 0x12, 0xfe, 0x0b,
+    0xe0, 0xff, 0xf6, 0xe5, 0xfc, 0x11, 0xed, 0xfd, 0x15, 0x03, 0xdd, 0xdb,
+    0x04, 0xfe, 0xff, 0x0e, 0xff, 0xfa, 0xfb, 0xe5, 0xef, 0xf6, 0xfe, 0x22,
+    0x0f, 0xe8, 0xfe, 0xf4, 0xfd, 0xd9, 0x03, 0x0a, 0xdf, 0xcf, 0xf1, 0x14,
+    0x05, 0xfd, 0xfb, 0xf3, 0xfb, 0xfb, 0x0f, 0xf8, 0x05, 0x09, 0x03, 0xf7,
+    0x05, 0x05, 0x13, 0xfb, 0xeb, 0x23, 0xe7, 0x18, 0xfb, 0x00, 0xfe, 0xdd,
+    0xe9, 0xea, 0xd3, 0xe8, 0x1a, 0xef, 0x01, 0xf1, 0x09, 0x1d, 0xd8, 0xfc,
+    0xda, 0x19, 0x03, 0xec, 0xe5, 0xf3, 0xed, 0x0a, 0xf4, 0x13, 0x0b, 0xf7,
+    0x0c, 0x00, 0xf9, 0xea, 0xe3, 0xfe, 0xff, 0x0d, 0x0a, 0x1b, 0xd7, 0x17,
+    0xeb, 0xe9, 0x00, 0x0e, 0xee, 0x24, 0xef, 0x09, 0x07, 0xf0, 0xf5, 0x07,
+    0xf5, 0xf5, 0x10, 0x17, 0x06, 0xf7, 0xfc, 0x02, 0xfb, 0xf9, 0xe7, 0x0a,
+    0x26, 0xf3, 0x01, 0x01, 0x09, 0x0b, 0x02, 0x27, 0xf8, 0xee, 0xfd, 0x1c,
+    0xf8, 0xf2, 0x0f, 0xfc, 0x0d, 0xe0, 0xea, 0x02, 0x0b, 0x00, 0xe0, 0x08,
+    0xfe, 0x10, 0x04, 0xfe, 0xeb, 0x13, 0x01, 0x0c, 0x0e, 0xed, 0x09, 0x01,
+    0x0c, 0xe3, 0x10, 0xdf, 0xd1, 0x14, 0xf3, 0xef, 0x09, 0xf0, 0xee, 0xe5,
+    0x11, 0xf4, 0xf6, 0x00, 0xe8, 0x20, 0x0a, 0xfc, 0xea, 0xf7, 0x02, 0x16,
+    0xe7, 0xf3, 0x0d, 0xe4, 0x04, 0xe6, 0xef, 0xf8, 0x0f, 0x23, 0x02, 0xe0,
+    0x01, 0x01, 0x01, 0x05, 0xf5, 0x0d, 0xf5, 0xf5, 0xe1, 0xff, 0x04, 0x00,
+    0xf4, 0x0d, 0xee, 0xf1, 0xef, 0xf7, 0x0b, 0xff, 0x1b, 0xec, 0x05, 0xe7,
+    0xf3, 0x13, 0x12, 0xf2, 0xf3, 0xfc, 0xea, 0x06, 0xfe, 0x13, 0x12, 0xdb,
+    0x11, 0xe2, 0xfc, 0x0d, 0x1c, 0xe8, 0x1d, 0xfc, 0xf2, 0xe2, 0x13, 0x1d,
+    0xda, 0xf6, 0x1c, 0x18, 0x1e, 0xf4, 0xfa, 0x03, 0xdc, 0x0f, 0xff, 0xff,
+    0x18, 0x0b, 0xed, 0xf1, 0xf8, 0x02, 0xf4, 0x10, 0xf9, 0xeb, 0x0b, 0x0e,
+    0x0f, 0x01, 0x02, 0x1b, 0x06, 0x10, 0x00, 0xe7, 0x23, 0x0d, 0xf6, 0x11,
+    0x08, 0xf5, 0x0f, 0x05, 0x13, 0xf7, 0x01, 0x01, 0x0c, 0xf6, 0xf9, 0xf0,
+    0x29, 0x01, 0xe9, 0x11, 0x02, 0xfa, 0xeb, 0x16, 0x0e, 0x10, 0x09, 0x0e,
+    0x1c, 0x0a, 0xe3, 0xd3, 0x01, 0xe3, 0x00, 0x06, 0xe2, 0xe9, 0x19, 0xef,
+    0x12, 0xf3, 0xfc, 0x02, 0x0b, 0x0c, 0x0d, 0xed, 0xfd, 0xf6, 0xf9, 0xe9,
+    0xf2, 0x28, 0xfe, 0x03, 0xec, 0x03, 0x00, 0xf8, 0xde, 0x0d, 0x25, 0x07,
+    0x1a, 0xe7, 0xfd, 0x29, 0xd8, 0xf7, 0xfb, 0xde, 0x0c, 0x08, 0x06, 0x22,
+    0xee, 0x1d, 0x05, 0x07, 0xf0, 0xfb, 0xfe, 0x07, 0xf1, 0x04, 0xe9, 0x01,
+    0xfc, 0xf1, 0x00, 0xeb, 0xe3, 0x08, 0xec, 0xfe, 0x04, 0xeb, 0xfc, 0x01,
+    0xf6, 0x0e, 0xdf, 0xf8, 0x12, 0xe3, 0x16, 0xdc, 0x21, 0x0a, 0xe6, 0x06,
+    0xe5, 0x10, 0x07, 0xf7, 0x1e, 0xde, 0xe3, 0x07, 0x16, 0xed, 0x23, 0xf2,
+    0x12, 0x0d, 0xe9, 0xf9, 0xe8, 0xfe, 0x0e, 0x02, 0x18, 0x0a, 0xea, 0xec,
+    0xfb, 0xfe, 0x0c, 0x1b, 0x19, 0x20, 0xfa, 0x07, 0xe5, 0x0c, 0x04, 0x27,
+    0xdb, 0xe6, 0xfe, 0x0d, 0x0a, 0x0a, 0xfe, 0x39, 0xdd, 0xde, 0x05, 0xec,
+    0x09, 0x05, 0x0a, 0x2c, 0xf4, 0x02, 0x1f, 0xd3, 0x24, 0xee, 0x0f, 0x3c,
+    0xf5, 0xfd, 0xf8, 0xf8, 0x12, 0xf5, 0xf3, 0x19, 0xf9, 0xda, 0xf6, 0x0a,
+    0x0a, 0xf4, 0x09, 0x0f, 0xfc, 0x00, 0x01, 0x01, 0xf3, 0xf8, 0x05, 0xf3,
+    0x0c, 0x19, 0x0e, 0xfd, 0xfa, 0xe1, 0xfc, 0x0c, 0x03, 0xfb, 0x1b, 0x06,
+    0xcc, 0xe4, 0x08, 0xf9, 0x10, 0xe9, 0x06, 0x00, 0x17, 0xe8, 0x0d, 0x12,
+    0xca, 0xf5, 0x23, 0xe4, 0x21, 0xf6, 0x19, 0x33, 0xdd, 0xfa, 0x0c, 0x01,
+    0x14, 0x07, 0x00, 0x34, 0xda, 0x05, 0x07, 0x01, 0x07, 0xe4, 0x06, 0x24,
+    0x02, 0xff, 0xf0, 0x09, 0xfc, 0xf4, 0x03, 0x06, 0xee, 0x08, 0xe2, 0x1d,
+    0xfa, 0x0c, 0xfc, 0x02, 0x03, 0xe5, 0xf0, 0xe2, 0x0a, 0x18, 0x12, 0x0c,
+    0x1e, 0x20, 0xed, 0x20, 0xe4, 0x01, 0x2a, 0x09, 0x0d, 0x0e, 0xd0, 0xf4,
+    0xdd, 0xfd, 0x2b, 0xf2, 0x08, 0x0c, 0xf8, 0xf7, 0xfc, 0xf9, 0x15, 0xef,
+    0x19, 0x1c, 0x01, 0xff, 0xe2, 0x01, 0xf3, 0x30, 0x0e, 0xfb, 0x15, 0xe8,
+    0x1c, 0x00, 0xfa, 0x16, 0xef, 0xea, 0xfb, 0x05, 0xf0, 0x0e, 0x02, 0x13,
+    0xf4, 0x01, 0x03, 0xe5, 0x29, 0x07, 0x09, 0x24, 0xf9, 0xe3, 0xf8, 0xde,
+    0x2d, 0xf4, 0xf5, 0x40, 0xed, 0xdf, 0x07, 0xef, 0x0f, 0x0a, 0x0b, 0x32,
+    0x0d, 0xe8, 0x00, 0xe6, 0xf6, 0xfc, 0xfd, 0x19, 0x11, 0x09, 0xf3, 0x03,
+    0xea, 0xf1, 0xfb, 0x02, 0xfd, 0x06, 0xff, 0xfe, 0x09, 0xec, 0x06, 0x0c,
+    0x15, 0xf9, 0x06, 0xd7, 0xe3, 0xf7, 0xed, 0x01, 0x03, 0xfd, 0x14, 0x01,
+    0x0e, 0xe0, 0x37, 0x0d, 0xd2, 0x18, 0x2f, 0xea, 0x12, 0x0d, 0x05, 0x3a,
+    0xd5, 0x07, 0x1e, 0xf2, 0x21, 0x11, 0xf9, 0x36, 0xd3, 0xf5, 0x12, 0xf6,
+    0xfb, 0xf6, 0x06, 0x0f, 0xde, 0xf9, 0x06, 0x09, 0xdf, 0xff, 0x0b, 0xf3,
+    0xf5, 0x01, 0xf1, 0xea, 0xf2, 0x02, 0x12, 0xfc, 0x0e, 0xee, 0xf8, 0xeb,
+    0x00, 0xef, 0x21, 0x0f, 0x09, 0xef, 0xeb, 0x1e, 0xef, 0xf2, 0x26, 0xf9,
+    0x17, 0xf1, 0xf1, 0xf0, 0x0c, 0x10, 0x1d, 0xff, 0x1d, 0x06, 0x03, 0xf6,
+    0xfb, 0x14, 0x1b, 0x03, 0x22, 0xfd, 0xec, 0x03, 0xfa, 0xf8, 0x01, 0x2b,
+    0x1e, 0x1b, 0x09, 0x09, 0x07, 0xff, 0xf0, 0x20, 0xee, 0x14, 0xfb, 0xf6,
+    0xf8, 0x11, 0xd9, 0x29, 0xf4, 0xfa, 0x07, 0xef, 0x20, 0xf9, 0xf2, 0x30,
+    0xee, 0xf0, 0xf3, 0xd6, 0x0d, 0xfe, 0x03, 0x36, 0xf5, 0xd7, 0x01, 0xe6,
+    0x04, 0xf0, 0x05, 0x1f, 0x0f, 0xdd, 0xff, 0xf8, 0x1f, 0xf2, 0x04, 0x37,
+    0xfa, 0x00, 0xfd, 0xf8, 0x10, 0xe1, 0xfb, 0x0d, 0xed, 0xf6, 0xe2, 0xfe,
+    0x08, 0xfe, 0x07, 0x08, 0x08, 0x11, 0x0a, 0xf0, 0xf8, 0xf5, 0x04, 0xea,
+    0x08, 0x12, 0x06, 0x0d, 0x0f, 0x10, 0x40, 0x28, 0xc0, 0xfb, 0x3f, 0x08,
+    0x1d, 0x09, 0x1b, 0x3d, 0xee, 0xf4, 0x29, 0x13, 0x20, 0xfc, 0x11, 0x4c,
+    0xdb, 0x02, 0x15, 0x05, 0xec, 0xeb, 0x0a, 0x22, 0xe7, 0x00, 0x02, 0x01,
+    0xd4, 0xea, 0x0a, 0xf3, 0xe3, 0xf8, 0xf5, 0xfa, 0x01, 0x0d, 0x19, 0x06,
+    0x24, 0x13, 0x02, 0xf5, 0xf1, 0xf1, 0x1b, 0x0f, 0x19, 0x04, 0xe3, 0xf9,
+    0xe7, 0x02, 0x29, 0xfc, 0x29, 0xec, 0xe9, 0x04, 0xdc, 0x22, 0x1d, 0xfd,
+    0x1f, 0x01, 0xec, 0xe8, 0xf5, 0x14, 0x1b, 0x19, 0x06, 0x0e, 0x02, 0x0d,
+    0xf9, 0x06, 0xfc, 0x15, 0x07, 0xfa, 0x0c, 0xe1, 0x18, 0x1a, 0xe8, 0x1b,
+    0xe9, 0xef, 0x0a, 0x18, 0xfc, 0x05, 0xf9, 0x14, 0xdc, 0x04, 0x01, 0xff,
+    0x07, 0xfd, 0xf0, 0x2c, 0xf2, 0xec, 0x0e, 0xe7, 0x1a, 0x05, 0xe8, 0x35,
+    0x13, 0x09, 0xf9, 0x07, 0xfe, 0xfa, 0x0d, 0x40, 0x0c, 0xea, 0xf4, 0x04,
+    0x01, 0x11, 0xfc, 0x23, 0xeb, 0xf4, 0xe9, 0x04, 0xeb, 0xe7, 0x07, 0x09,
+    0xfb, 0xf1, 0xf6, 0xfd, 0x02, 0xfa, 0x02, 0xff, 0x00, 0xff, 0xf1, 0xf1,
+    0x1a, 0xe9, 0x10, 0xe3, 0x0b, 0x0c, 0x08, 0x04, 0x1b, 0x0a, 0x2b, 0x10,
+    0xe1, 0x01, 0x1f, 0x06, 0x04, 0xec, 0x19, 0x49, 0xee, 0xf8, 0x22, 0x0c,
+    0x20, 0x02, 0x07, 0x31, 0xe7, 0xff, 0x0f, 0xf0, 0xfd, 0xea, 0x13, 0x26,
+    0xce, 0xfa, 0xff, 0xee, 0xe9, 0xfe, 0x15, 0x08, 0x04, 0x05, 0x0d, 0xfa,
+    0xdd, 0xf8, 0x07, 0x0b, 0x33, 0xef, 0xec, 0xf9, 0xd9, 0xe6, 0x1d, 0x10,
+    0x41, 0xf6, 0xdf, 0x11, 0xe3, 0x14, 0x1d, 0xfb, 0x2b, 0x15, 0xdc, 0x09,
+    0xf6, 0x05, 0x16, 0x00, 0x1c, 0x27, 0xe4, 0xfc, 0xf7, 0x16, 0x08, 0x08,
+    0x2f, 0xdd, 0xf8, 0xfa, 0xe9, 0x0e, 0x0b, 0x0b, 0x02, 0x12, 0x02, 0xfd,
+    0x19, 0x03, 0xeb, 0x11, 0xf4, 0x09, 0x09, 0x15, 0x12, 0x0d, 0xef, 0x1c,
+    0xe4, 0xfe, 0x17, 0x0c, 0x09, 0x04, 0xea, 0x2f, 0xf2, 0x1e, 0x02, 0xfb,
+    0xfe, 0xe3, 0x00, 0x2e, 0x04, 0xf9, 0x0c, 0x05, 0x27, 0x0c, 0x07, 0x2d,
+    0xf7, 0x0b, 0xfb, 0xf9, 0x1c, 0xdf, 0x11, 0x36, 0x05, 0xf2, 0x02, 0xf8,
+    0x0b, 0x07, 0x05, 0xfb, 0xfc, 0x0e, 0x13, 0xfa, 0xfb, 0x09, 0xf5, 0xfd,
+    0x06, 0x15, 0xf9, 0x03, 0x18, 0xfd, 0x1a, 0x0a, 0x03, 0xe2, 0xfb, 0x00,
+    0x1e, 0xfe, 0x4f, 0x27, 0xe1, 0xf7, 0x31, 0xf0, 0x1b, 0xec, 0x07, 0x5f,
+    0xe2, 0xf8, 0x40, 0x05, 0x17, 0x24, 0x0c, 0x3c, 0xf3, 0x10, 0x13, 0xf8,
+    0x0b, 0xf3, 0xf9, 0x36, 0xe1, 0xf3, 0xf4, 0xe8, 0xef, 0xf8, 0xfc, 0xeb,
+    0xe3, 0xfb, 0xf0, 0xee, 0xdb, 0x06, 0x0c, 0x11, 0x1e, 0x10, 0xe2, 0xe9,
+    0xeb, 0x0d, 0x34, 0x0f, 0x43, 0xd9, 0xef, 0x08, 0xec, 0x05, 0x1d, 0x02,
+    0x33, 0xef, 0xf4, 0xf7, 0xe6, 0xf9, 0x22, 0x07, 0x04, 0x06, 0xe9, 0x02,
+    0xf0, 0xfc, 0x24, 0x20, 0x24, 0x17, 0xe6, 0x0f, 0x05, 0xf6, 0xfc, 0x1f,
+    0xf2, 0x01, 0x0d, 0xe7, 0xff, 0x1d, 0xf0, 0xfa, 0xd0, 0x00, 0xff, 0x0e,
+    0x23, 0xf9, 0xf3, 0x11, 0xde, 0x0d, 0x05, 0x04, 0x0b, 0x0b, 0xfb, 0x26,
+    0x0d, 0x0d, 0xff, 0xe8, 0x16, 0xe8, 0x0b, 0x3c, 0x18, 0xe4, 0x04, 0xff,
+    0xfa, 0xf3, 0xff, 0x40, 0xee, 0x06, 0xfc, 0x0d, 0x00, 0xf7, 0x13, 0x3f,
+    0xf7, 0x13, 0x06, 0x08, 0xf9, 0x13, 0xf2, 0x19, 0xfd, 0xf9, 0xf3, 0xe6,
+    0xfc, 0x07, 0xf6, 0xfd, 0x0a, 0x22, 0x00, 0x01, 0x19, 0xff, 0xe7, 0xff,
+    0x08, 0xfd, 0x03, 0xfd, 0x1f, 0xe7, 0x28, 0x08, 0xde, 0xf3, 0x43, 0xf6,
+    0x0c, 0xfe, 0x1e, 0x52, 0xf2, 0x04, 0x17, 0xf2, 0x08, 0x0d, 0x04, 0x38,
+    0xde, 0x0c, 0x10, 0xef, 0xdf, 0x0f, 0x01, 0x24, 0xde, 0xe1, 0x0d, 0xfd,
+    0xd4, 0xf6, 0x12, 0x0e, 0xed, 0x01, 0xf0, 0xf3, 0xfd, 0xff, 0x18, 0xf3,
+    0x36, 0xda, 0xf6, 0xef, 0xe8, 0xef, 0x37, 0x27, 0x4e, 0xf8, 0xf4, 0xff,
+    0xe5, 0xf3, 0x32, 0x0b, 0x36, 0x08, 0xe9, 0xf6, 0xe2, 0x13, 0x21, 0xfe,
+    0x12, 0xed, 0xdd, 0xfb, 0xf8, 0x05, 0x0f, 0x03, 0x1c, 0x04, 0xfc, 0xf2,
+    0x23, 0x0e, 0x03, 0xfc, 0xf9, 0x18, 0xf7, 0x01, 0x1b, 0x03, 0xf5, 0xfd,
+    0xde, 0xf3, 0x19, 0xfc, 0x11, 0x02, 0xe7, 0x13, 0xde, 0xd8, 0xf2, 0x05,
+    0x28, 0x02, 0x02, 0x27, 0x07, 0x08, 0xff, 0x07, 0x27, 0x0e, 0x19, 0x40,
+    0xfb, 0x02, 0x0c, 0xf6, 0x0d, 0x07, 0x0f, 0x47, 0xf8, 0x05, 0x0e, 0xfd,
+    0x03, 0x1e, 0x07, 0x32, 0xe7, 0xf6, 0x24, 0x01, 0x01, 0x02, 0x0a, 0xff,
+    0xf6, 0x26, 0x15, 0xf0, 0x04, 0x13, 0x03, 0xfa, 0xfe, 0xf6, 0xf1, 0x09,
+    0x2a, 0xe6, 0xea, 0xf6, 0x17, 0x13, 0xeb, 0xff, 0x15, 0xeb, 0x23, 0x06,
+    0xc8, 0xf6, 0x33, 0xeb, 0xf4, 0xe7, 0x12, 0x2a, 0xe3, 0xe6, 0x32, 0xfa,
+    0x16, 0x15, 0x17, 0x40, 0xf1, 0x08, 0x1a, 0xf3, 0xf6, 0x0c, 0x0c, 0x11,
+    0xd0, 0x22, 0x02, 0xee, 0xea, 0xf4, 0xf8, 0xf9, 0x13, 0x10, 0x17, 0xf5,
+    0xf1, 0x0a, 0x0e, 0xfd, 0x32, 0xda, 0xf1, 0xe2, 0xdb, 0xf2, 0x34, 0x1f,
+    0x53, 0xfc, 0xe4, 0xf2, 0xf6, 0xf2, 0x1d, 0x04, 0x4a, 0xec, 0xee, 0x06,
+    0xdf, 0x01, 0x1a, 0x04, 0x27, 0xfc, 0xe6, 0xfd, 0xd9, 0xfd, 0x0e, 0x00,
+    0x0c, 0x16, 0xf3, 0x03, 0xf7, 0xfc, 0x0e, 0x0f, 0x09, 0x06, 0x06, 0x04,
+    0x08, 0x02, 0xed, 0xf5, 0xe4, 0xe6, 0x07, 0x06, 0x03, 0x18, 0xea, 0x13,
+    0xe2, 0xfa, 0x10, 0xf2, 0x02, 0xec, 0x03, 0x3c, 0xf6, 0xf6, 0x0a, 0x10,
+    0x09, 0xf8, 0x15, 0x24, 0xfd, 0x0d, 0x09, 0x01, 0x00, 0xff, 0x00, 0x1a,
+    0xf0, 0xee, 0x08, 0x03, 0x1d, 0x05, 0x16, 0x46, 0xe6, 0xf8, 0x08, 0x00,
+    0x09, 0x09, 0xff, 0x01, 0xfc, 0x20, 0xfc, 0xec, 0x05, 0x1b, 0x03, 0xf1,
+    0x12, 0xe4, 0xfa, 0x24, 0x1c, 0xf5, 0xf2, 0x05, 0x11, 0xe7, 0xfa, 0x02,
+    0x20, 0xea, 0x31, 0x10, 0xcf, 0xd8, 0x33, 0xee, 0xff, 0x09, 0x20, 0x3f,
+    0xe2, 0x0a, 0x29, 0xee, 0x3a, 0xf2, 0x1e, 0x39, 0x02, 0x1e, 0xfe, 0xf2,
+    0xef, 0xe2, 0x0d, 0x0f, 0xf1, 0x19, 0x02, 0xe7, 0xec, 0xff, 0xfe, 0xe4,
+    0xfe, 0xfb, 0x02, 0xf6, 0xf1, 0xf4, 0x07, 0x1a, 0x2a, 0xf9, 0x06, 0xf9,
+    0xda, 0xf4, 0x22, 0x02, 0x4f, 0x0a, 0xf3, 0xfc, 0xf3, 0xf6, 0x25, 0x0a,
+    0x28, 0x01, 0xf7, 0x09, 0xe6, 0x05, 0x28, 0xf7, 0x1e, 0xf2, 0xee, 0x13,
+    0xee, 0x05, 0x0f, 0x0a, 0x09, 0xe8, 0xe8, 0x0e, 0x05, 0x12, 0x0f, 0x15,
+    0x02, 0xec, 0xf8, 0x02, 0xf7, 0x05, 0xf8, 0xff, 0xdc, 0x00, 0x01, 0x00,
+    0x12, 0x17, 0xec, 0x19, 0xfa, 0x09, 0xfa, 0xf3, 0x1d, 0x0b, 0x07, 0x25,
+    0xea, 0x0c, 0xf5, 0xfa, 0x04, 0xf7, 0xfe, 0x33, 0xfe, 0x14, 0xef, 0x04,
+    0xf0, 0x00, 0x00, 0x3a, 0xea, 0xfa, 0x10, 0x01, 0xe4, 0x00, 0xff, 0x23,
+    0xe9, 0x26, 0x15, 0x10, 0x04, 0x14, 0x0d, 0x08, 0xf8, 0xfd, 0x10, 0xfb,
+    0x00, 0x21, 0x06, 0xfa, 0x0f, 0x08, 0xf1, 0x09, 0x28, 0xf0, 0xd8, 0x0d,
+    0x08, 0x09, 0x02, 0xfb, 0x12, 0x03, 0x0e, 0xfb, 0xce, 0xf0, 0x39, 0xe5,
+    0x09, 0xf6, 0x1f, 0x35, 0xdd, 0x1c, 0x25, 0xef, 0x17, 0x0c, 0xf6, 0x3e,
+    0xf0, 0x21, 0x08, 0xff, 0xd7, 0xfc, 0xfd, 0x1f, 0xe5, 0x18, 0x12, 0xe9,
+    0xf5, 0xe9, 0x12, 0xf6, 0x02, 0x13, 0xf4, 0x0a, 0xfd, 0x03, 0x09, 0x08,
+    0x2f, 0x07, 0xee, 0xfd, 0xd7, 0x00, 0x2b, 0x29, 0x3b, 0xdb, 0xde, 0xf1,
+    0xe1, 0xf7, 0x47, 0x12, 0x35, 0x0c, 0xe4, 0x09, 0xef, 0x17, 0x2b, 0xea,
+    0x2d, 0xf8, 0xe8, 0x18, 0xef, 0x03, 0x11, 0x0a, 0x10, 0xff, 0xe8, 0x07,
+    0x0c, 0x07, 0x03, 0x18, 0x05, 0x08, 0xf8, 0xf8, 0x06, 0x18, 0xe9, 0xf9,
+    0xe0, 0x0f, 0x0d, 0x18, 0x04, 0x01, 0xf0, 0x1c, 0xf6, 0x14, 0xfd, 0x12,
+    0x0c, 0x0c, 0x02, 0x34, 0xf6, 0xe6, 0xfd, 0xf9, 0xf9, 0xfd, 0x00, 0x2a,
+    0xfc, 0xf9, 0xff, 0x0a, 0xfe, 0x1b, 0xf5, 0x34, 0xdc, 0xf9, 0x15, 0x13,
+    0xe7, 0x1b, 0xf7, 0x25, 0xfd, 0x09, 0x08, 0x0a, 0xf0, 0x17, 0x0f, 0x04,
+    0xf4, 0xe9, 0x06, 0x07, 0xf5, 0x02, 0xfc, 0xf5, 0x09, 0xee, 0xf1, 0x07,
+    0x38, 0x03, 0x05, 0x0f, 0x16, 0x0f, 0xed, 0xff, 0x21, 0xf8, 0x34, 0x07,
+    0xd1, 0xf9, 0x27, 0x00, 0x0c, 0x21, 0x18, 0x42, 0xe6, 0x02, 0x1a, 0xf1,
+    0x2f, 0xf1, 0x0e, 0x3b, 0xee, 0xf8, 0x08, 0xea, 0xfe, 0xf9, 0x03, 0x18,
+    0xf5, 0xf8, 0x0d, 0xeb, 0x01, 0x10, 0x09, 0x02, 0x15, 0xfb, 0xf1, 0x0b,
+    0xf2, 0x06, 0x08, 0x09, 0x2f, 0x19, 0x02, 0xfe, 0xe4, 0x06, 0x1f, 0x17,
+    0x49, 0xf2, 0xe2, 0x02, 0xef, 0x04, 0x26, 0x16, 0x3f, 0x08, 0xf1, 0x0a,
+    0xfd, 0xf9, 0x28, 0x01, 0x15, 0x0b, 0xf9, 0x10, 0xdc, 0x02, 0x20, 0xf7,
+    0x16, 0xe6, 0x09, 0x03, 0xf1, 0xf5, 0x12, 0x1c, 0xfb, 0x2a, 0x08, 0xfa,
+    0x0a, 0x16, 0xf6, 0x15, 0xf0, 0x06, 0x11, 0xfd, 0x0e, 0xf9, 0xf6, 0x12,
+    0xed, 0xf3, 0xfd, 0x1f, 0x0b, 0xfa, 0x08, 0x30, 0xf8, 0xff, 0x0b, 0xeb,
+    0x10, 0xff, 0x07, 0x22, 0x0d, 0x07, 0x09, 0x03, 0xf6, 0xf8, 0xfc, 0x26,
+    0xf8, 0xee, 0x11, 0x02, 0x03, 0x0a, 0xef, 0x38, 0xfe, 0x13, 0x1b, 0x09,
+    0xfe, 0x06, 0x05, 0xf3, 0x04, 0xdf, 0xfc, 0x00, 0xe7, 0x15, 0xec, 0xf1,
+    0xf8, 0xfc, 0xed, 0x05, 0x0e, 0xf3, 0x15, 0x09, 0x01, 0x0d, 0xfd, 0x00,
+    0x24, 0xe2, 0x31, 0x13, 0xd5, 0x1b, 0x2b, 0xe8, 0x03, 0x08, 0x1d, 0x33,
+    0xdc, 0xfd, 0x24, 0xe4, 0x20, 0xfa, 0x07, 0x33, 0x01, 0x12, 0x06, 0xf5,
+    0xef, 0xf7, 0xfa, 0x13, 0x01, 0xec, 0xee, 0xe0, 0xfd, 0x0d, 0xff, 0x09,
+    0xf6, 0x00, 0xed, 0x07, 0xea, 0x0e, 0xff, 0x0e, 0x26, 0xfc, 0xf0, 0xe7,
+    0xe7, 0xfe, 0x30, 0xff, 0x24, 0x04, 0x06, 0xf4, 0xf5, 0xf8, 0x23, 0x0e,
+    0x3d, 0xf2, 0xfd, 0x04, 0xe8, 0xfb, 0x23, 0xfe, 0x33, 0xe1, 0x01, 0xfd,
+    0xdc, 0xfb, 0x0e, 0xfa, 0x22, 0xfb, 0x11, 0xfa, 0xff, 0x08, 0x21, 0x30,
+    0x13, 0x03, 0xf2, 0x03, 0xf8, 0x0f, 0xec, 0x0d, 0xef, 0x0f, 0x10, 0x10,
+    0x0f, 0xf6, 0xf9, 0x1e, 0xf7, 0xe5, 0x08, 0xfa, 0x09, 0xff, 0x00, 0x15,
+    0x02, 0x00, 0x08, 0xfe, 0xfb, 0x0e, 0x15, 0x28, 0xfa, 0xfb, 0x13, 0x06,
+    0xfb, 0x05, 0xf6, 0x11, 0xf6, 0x0b, 0x06, 0x15, 0xe1, 0x00, 0xe9, 0x0f,
+    0xe1, 0x1d, 0x18, 0xfd, 0x0b, 0x0f, 0xff, 0xf2, 0xf5, 0xfd, 0x14, 0xff,
+    0xf4, 0xfe, 0xe2, 0xf8, 0x14, 0x0b, 0xeb, 0x07, 0x35, 0xe2, 0xeb, 0x0b,
+    0x04, 0x22, 0xfe, 0x0e, 0x1d, 0xf2, 0x24, 0x11, 0xcc, 0xec, 0x25, 0xf7,
+    0xff, 0xf9, 0x06, 0x29, 0xe4, 0x07, 0x1c, 0xdb, 0xf8, 0x1d, 0xfa, 0x44,
+    0xf2, 0x01, 0x0f, 0xe6, 0x11, 0x03, 0xee, 0x17, 0x06, 0xe0, 0x0c, 0xd8,
+    0xe9, 0xfd, 0x11, 0xfe, 0x07, 0xdd, 0xea, 0xff, 0xde, 0xdd, 0x0a, 0x09,
+    0x30, 0xf2, 0x01, 0xe4, 0xe0, 0xeb, 0x2d, 0x12, 0x2d, 0xeb, 0xfc, 0xf0,
+    0xe8, 0xf9, 0x1f, 0x08, 0x3f, 0xeb, 0x0e, 0x13, 0xf9, 0x0c, 0x1c, 0x02,
+    0x25, 0xec, 0xf6, 0x05, 0xf3, 0xf4, 0x18, 0x08, 0x12, 0xe9, 0xfb, 0xfd,
+    0xf9, 0x08, 0x13, 0x1c, 0x08, 0xec, 0xfe, 0x02, 0xf1, 0x19, 0xf3, 0x1d,
+    0xf1, 0x07, 0x11, 0x12, 0xfa, 0xf2, 0xf6, 0x0d, 0xff, 0x17, 0x0a, 0xfb,
+    0x1f, 0xf8, 0x11, 0x24, 0xf6, 0xfc, 0xfe, 0x07, 0xed, 0x05, 0x1c, 0x21,
+    0xfe, 0xfe, 0x16, 0x0d, 0x08, 0x0f, 0x09, 0x33, 0xf4, 0x1f, 0x14, 0x0c,
+    0xfe, 0xf5, 0xeb, 0x2a, 0xee, 0xf3, 0x12, 0x19, 0xec, 0x01, 0x06, 0xf7,
+    0x05, 0x22, 0x0b, 0xeb, 0xeb, 0x06, 0xe1, 0xf5, 0x0d, 0xee, 0xfb, 0x0a,
+    0x31, 0xff, 0xe3, 0xea, 0x18, 0x09, 0xe3, 0x07, 0x1a, 0xf8, 0x15, 0xfc,
+    0xcc, 0xf2, 0x2a, 0xe5, 0x01, 0xea, 0x10, 0x1f, 0xd9, 0x02, 0x13, 0xf6,
+    0x16, 0x01, 0x0e, 0x3c, 0x02, 0x17, 0x04, 0xf1, 0xf7, 0x02, 0x07, 0x0c,
+    0x02, 0x1f, 0xf4, 0xe6, 0xf0, 0xe9, 0x05, 0xf4, 0xfd, 0xe4, 0xf7, 0xe9,
+    0xfc, 0xef, 0x06, 0x02, 0x26, 0xf1, 0xf1, 0xeb, 0xe9, 0xe6, 0x30, 0x1c,
+    0x38, 0x0f, 0x03, 0xf1, 0x10, 0x04, 0x30, 0x19, 0x1f, 0xfb, 0xfc, 0x05,
+    0xe2, 0xfe, 0x18, 0xf2, 0x1c, 0xf2, 0xf5, 0x0e, 0xf2, 0x05, 0x1d, 0x28,
+    0x12, 0xf0, 0xf0, 0x0f, 0x0a, 0x03, 0x1a, 0x1a, 0xf3, 0x08, 0x13, 0xef,
+    0xf5, 0x1c, 0x06, 0x00, 0xee, 0x12, 0x1d, 0x03, 0x18, 0x06, 0x0a, 0x0e,
+    0xf0, 0xeb, 0xfa, 0x0d, 0x08, 0xff, 0x06, 0x24, 0x0f, 0x03, 0x0a, 0x0f,
+    0x0e, 0xff, 0x08, 0x33, 0xfc, 0x00, 0x0e, 0xfb, 0xfb, 0x05, 0x07, 0x19,
+    0xe8, 0xe7, 0x12, 0x11, 0x15, 0xf7, 0x0c, 0x1a, 0xf6, 0x28, 0x08, 0xeb,
+    0xf2, 0x25, 0xee, 0x01, 0x03, 0xec, 0xed, 0xfa, 0xf0, 0xf2, 0xef, 0xf1,
+    0x02, 0x23, 0xef, 0x01, 0x41, 0xfa, 0xf4, 0xf4, 0x15, 0xf5, 0xf5, 0xf9,
+    0x28, 0xde, 0x20, 0xf6, 0xc7, 0xde, 0x21, 0xe4, 0xfe, 0xec, 0x0d, 0x2c,
+    0xee, 0x24, 0x10, 0xf0, 0x1d, 0x12, 0x0e, 0x2b, 0x06, 0xf8, 0xfd, 0x01,
+    0x08, 0xef, 0xfd, 0x0f, 0xeb, 0xed, 0xe1, 0xdf, 0xf1, 0xe5, 0x16, 0xe3,
+    0x08, 0xfc, 0xf6, 0xf6, 0xd8, 0xf0, 0x23, 0xfc, 0x2b, 0xf5, 0xff, 0xe7,
+    0xf4, 0xe9, 0x29, 0x09, 0x2b, 0x0c, 0xff, 0x08, 0x0b, 0xed, 0x29, 0x14,
+    0x3c, 0xf5, 0xeb, 0x18, 0xf6, 0x10, 0x22, 0xf9, 0x17, 0x23, 0x02, 0x0c,
+    0xf6, 0xfa, 0x2f, 0xfe, 0x1e, 0xeb, 0xfd, 0x03, 0xf0, 0x07, 0x1c, 0x09,
+    0xfa, 0xe1, 0x0d, 0x0f, 0x18, 0x03, 0xfe, 0xf0, 0xec, 0x0b, 0x10, 0x02,
+    0x14, 0x06, 0xef, 0xf7, 0xea, 0x0b, 0x05, 0xfe, 0x1f, 0x06, 0x0e, 0x07,
+    0x00, 0xe1, 0x01, 0x01, 0x07, 0x05, 0x09, 0xf7, 0xef, 0x15, 0xf7, 0x12,
+    0x05, 0x03, 0x04, 0x1d, 0x04, 0x10, 0x12, 0x06, 0x05, 0x00, 0x08, 0x18,
+    0xd6, 0xf2, 0xfa, 0x07, 0xf8, 0x12, 0x07, 0xfd, 0xdd, 0x00, 0x04, 0xfb,
+    0xf8, 0x09, 0xf3, 0x09, 0xfb, 0xf0, 0xe8, 0x09, 0x27, 0xf5, 0xf8, 0x06,
+    0x01, 0x02, 0x0e, 0xf6, 0x1f, 0xfa, 0x29, 0xf8, 0xd6, 0x01, 0x22, 0xf8,
+    0x1d, 0xe3, 0x1a, 0x39, 0x0a, 0x0d, 0x19, 0xf5, 0x12, 0xfb, 0x1d, 0x2a,
+    0x03, 0xf6, 0x0c, 0xf2, 0xfd, 0xec, 0x18, 0x13, 0xfe, 0x1a, 0xe8, 0xdd,
+    0x01, 0xf8, 0x30, 0x01, 0xf8, 0xfe, 0xe4, 0xe7, 0xff, 0xeb, 0x23, 0xfa,
+    0x2c, 0xf0, 0xfc, 0xe7, 0x0a, 0xf8, 0x18, 0x10, 0x23, 0x01, 0xfa, 0xe8,
+    0xf1, 0xfa, 0x1d, 0x0e, 0x17, 0xe7, 0xe4, 0xf5, 0xf9, 0x0c, 0x17, 0x0c,
+    0x13, 0xe8, 0xe1, 0x17, 0x19, 0x05, 0x0b, 0x0f, 0x23, 0xed, 0xff, 0xfe,
+    0xe0, 0x14, 0x16, 0x00, 0x0d, 0x1c, 0x0b, 0xf5, 0xfb, 0x18, 0xee, 0xff,
+    0xff, 0xf3, 0x18, 0x0c, 0x05, 0xfa, 0xf6, 0xfe, 0xfe, 0xf8, 0xf8, 0x09,
+    0xef, 0xf8, 0x0e, 0xf0, 0x00, 0xf8, 0x0c, 0xf8, 0xf6, 0x07, 0x16, 0x11,
+    0xf8, 0xea, 0xff, 0xff, 0x01, 0x20, 0x07, 0x08, 0xfd, 0x1c, 0xfc, 0x06,
+    0xed, 0x0d, 0x08, 0x15, 0xf0, 0x25, 0x01, 0x1b, 0x00, 0x02, 0xfe, 0x01,
+    0x05, 0x01, 0xfd, 0xf1, 0xe5, 0x0c, 0xe4, 0xe1, 0xf0, 0xfa, 0xee, 0x0e,
+    0x35, 0xee, 0x15, 0xef, 0x0a, 0xf9, 0x01, 0xf5, 0x1f, 0x05, 0x1f, 0x0d,
+    0xe1, 0xf4, 0xff, 0xf5, 0x23, 0x02, 0x18, 0x30, 0xfc, 0xf0, 0x0d, 0x04,
+    0x0d, 0x06, 0x29, 0x1d, 0xf9, 0x08, 0x06, 0xe5, 0x13, 0xfd, 0x0d, 0x26,
+    0xef, 0x09, 0xdc, 0xf2, 0x05, 0xdf, 0x0c, 0xf6, 0xf3, 0xd9, 0xf8, 0x08,
+    0xef, 0xeb, 0x0f, 0xf9, 0x3a, 0x03, 0xff, 0xe0, 0xf7, 0xf0, 0x15, 0x12,
+    0x41, 0x0b, 0xf1, 0x04, 0x04, 0xe2, 0x0e, 0x0b, 0x2c, 0x03, 0xea, 0x02,
+    0xfb, 0xe7, 0x08, 0xe9, 0x22, 0xf3, 0xf2, 0x1c, 0xfa, 0xf3, 0x11, 0x04,
+    0x1f, 0xf5, 0x02, 0x0f, 0x1a, 0x1f, 0x24, 0x0b, 0x06, 0x1f, 0xf3, 0x06,
+    0x00, 0x02, 0xe8, 0xf6, 0xf4, 0xe8, 0x07, 0x2e, 0xfb, 0xf8, 0x10, 0x09,
+    0xf0, 0x0e, 0xff, 0xfe, 0x1c, 0x14, 0x17, 0x06, 0xe2, 0xf1, 0xfa, 0x01,
+    0x11, 0x13, 0x12, 0x29, 0xf1, 0x0f, 0x1f, 0xfa, 0xfd, 0xfd, 0x02, 0x07,
+    0x0e, 0xfb, 0x0e, 0x04, 0x01, 0x01, 0xed, 0xfe, 0xde, 0xfd, 0x08, 0xef,
+    0xf6, 0x0a, 0xff, 0x0f, 0xe7, 0xf2, 0x0f, 0x02, 0xea, 0x10, 0xf9, 0xec,
+    0xfd, 0x09, 0xea, 0x1f, 0x46, 0xdd, 0xe2, 0xf7, 0x08, 0xf5, 0xf7, 0xe9,
+    0x33, 0xfb, 0x2f, 0xf6, 0xb5, 0x1d, 0x15, 0xeb, 0x11, 0xf7, 0x2a, 0x2e,
+    0x08, 0x1d, 0xf4, 0xfb, 0x15, 0xfa, 0x22, 0x34, 0xff, 0x06, 0xf6, 0xfd,
+    0xfa, 0xf9, 0x03, 0xf5, 0xf4, 0xf4, 0xd5, 0xea, 0x01, 0x08, 0x22, 0xf1,
+    0xf2, 0x06, 0xd1, 0xe5, 0x0c, 0xef, 0x12, 0x03, 0x08, 0x02, 0xf7, 0x05,
+    0x1b, 0x07, 0x39, 0x34, 0x21, 0xe2, 0xe3, 0x0b, 0x0c, 0xf6, 0x29, 0xf7,
+    0x24, 0x0a, 0xfc, 0xff, 0x1a, 0xfd, 0x05, 0xff, 0xff, 0x0e, 0x0a, 0x1a,
+    0x09, 0xfb, 0x15, 0x04, 0x03, 0xf7, 0xfe, 0x00, 0xfc, 0xfb, 0x11, 0xfa,
+    0x1d, 0x0e, 0x06, 0xed, 0xfc, 0x23, 0xd8, 0xf2, 0x04, 0xe5, 0x0f, 0x16,
+    0x29, 0xfe, 0xf5, 0xec, 0xe2, 0x0e, 0xeb, 0x09, 0x1d, 0x11, 0x05, 0x11,
+    0xe4, 0x29, 0x12, 0x02, 0x12, 0x19, 0x0e, 0x1a, 0xee, 0xf9, 0x05, 0x09,
+    0xf5, 0xfd, 0x05, 0x04, 0xe4, 0xf1, 0x17, 0x01, 0xf2, 0xfe, 0x0b, 0xf4,
+    0x0d, 0x04, 0x06, 0xfe, 0xff, 0xec, 0xe9, 0x00, 0xff, 0x03, 0x03, 0xfd,
+    0xf1, 0x15, 0xfc, 0xf3, 0xff, 0xfe, 0x09, 0xee, 0x3c, 0x01, 0xec, 0x02,
+    0xf0, 0xf6, 0x20, 0xeb, 0x16, 0x07, 0x32, 0xf3, 0xce, 0xf0, 0x02, 0xd4,
+    0x11, 0xe6, 0x28, 0x0e, 0xe3, 0x21, 0xee, 0xce, 0x1e, 0xd9, 0x23, 0x26,
+    0x06, 0xfa, 0xf9, 0xf1, 0x01, 0xe6, 0x0b, 0x07, 0xdc, 0x21, 0xbc, 0xe3,
+    0xef, 0xf8, 0x12, 0xfc, 0xe6, 0xfe, 0xf5, 0xd4, 0x15, 0x0a, 0x00, 0x13,
+    0xfc, 0xec, 0xf3, 0xd6, 0x1a, 0xe3, 0x21, 0x36, 0x2a, 0x03, 0xe9, 0xe3,
+    0xff, 0x00, 0x13, 0x1c, 0x0e, 0x20, 0xe5, 0xf5, 0x24, 0x0b, 0x20, 0x14,
+    0x13, 0xf8, 0x04, 0x1b, 0x2f, 0x0a, 0x15, 0x00, 0xf4, 0x1a, 0x11, 0x0d,
+    0x03, 0x18, 0x0f, 0x18, 0x04, 0x1f, 0xfb, 0xf2, 0x1f, 0x15, 0x03, 0xfb,
+    0x0b, 0x17, 0xfb, 0x0b, 0x1b, 0x1f, 0xf4, 0x07, 0xf9, 0xf9, 0xf8, 0xf4,
+    0x14, 0x0f, 0xf6, 0xfe, 0xdd, 0x0b, 0xff, 0x01, 0x18, 0x04, 0x1b, 0x0a,
+    0xed, 0xe7, 0xf9, 0x16, 0x02, 0x01, 0x00, 0xf7, 0xf1, 0x07, 0xf0, 0x06,
+    0xf8, 0x0b, 0x02, 0xf3, 0xff, 0x20, 0xfd, 0x01, 0x04, 0xf5, 0xd9, 0xf4,
+    0xf4, 0xf2, 0xe8, 0xff, 0x04, 0x00, 0xf0, 0xe2, 0xfe, 0xed, 0x1b, 0xef,
+    0x20, 0xfa, 0xfb, 0xf4, 0x02, 0x18, 0x07, 0xfb, 0xef, 0xe4, 0x08, 0x0d,
+    0xe1, 0x0e, 0x25, 0xc6, 0xfd, 0x0c, 0x1c, 0x0b, 0xf0, 0x01, 0x1c, 0xd4,
+    0x11, 0xf5, 0x1b, 0x09, 0xfb, 0xda, 0x13, 0xe3, 0xf9, 0x10, 0x14, 0xf0,
+    0xf0, 0xfd, 0x1f, 0xcf, 0xf4, 0xe4, 0xfb, 0x0e, 0x0a, 0x11, 0xed, 0xdc,
+    0xfc, 0xe6, 0xf7, 0xfc, 0x13, 0xe1, 0x0b, 0xe4, 0x04, 0x11, 0xee, 0x21,
+    0x14, 0xe1, 0x07, 0xe4, 0xfb, 0x08, 0x03, 0x2b, 0x27, 0xf6, 0x0d, 0x02,
+    0x1b, 0x09, 0x09, 0xf8, 0x14, 0x19, 0x0f, 0x0b, 0x01, 0x10, 0x09, 0x12,
+    0x03, 0xf5, 0x18, 0xf3, 0xfb, 0xf5, 0x02, 0x0e, 0x0d, 0x00, 0x07, 0xfc,
+    0x18, 0x25, 0x0b, 0xf0, 0xf9, 0xe6, 0x08, 0x01, 0x24, 0x14, 0xfa, 0xed,
+    0xe5, 0x1f, 0x09, 0xfe, 0x08, 0xee, 0x1a, 0x1a, 0x05, 0x00, 0xff, 0x0c,
+    0xfe, 0xf9, 0x11, 0x11, 0xea, 0xfe, 0x08, 0xf9, 0xf0, 0xe4, 0x01, 0x0d,
+    0xf1, 0x00, 0x0b, 0xea, 0x19, 0xea, 0xf3, 0xf8, 0x08, 0x12, 0x1c, 0x1f,
+    0xfb, 0xef, 0xf0, 0xf2, 0x14, 0xe1, 0x03, 0xfa, 0xf9, 0xda, 0xe9, 0xfc,
+    0xf3, 0xff, 0x12, 0x04, 0xf7, 0xfc, 0x17, 0x0f, 0xfc, 0x29, 0x03, 0xe5,
+    0xf2, 0xee, 0x1e, 0xfa, 0x04, 0xed, 0x25, 0xf4, 0xe1, 0x15, 0x10, 0x1e,
+    0xef, 0x1c, 0x04, 0xde, 0xe5, 0x08, 0x21, 0xfd, 0xfd, 0xea, 0x03, 0xca,
+    0xda, 0x26, 0x00, 0x0a, 0xfd, 0x05, 0xf0, 0xd4, 0xe1, 0x1a, 0xe4, 0xf5,
+    0x07, 0xe7, 0xfa, 0xdf, 0xd4, 0x03, 0xf0, 0x10, 0x15, 0x0c, 0xf4, 0xed,
+    0xe3, 0xfb, 0x0f, 0x1e, 0x16, 0x09, 0x00, 0xec, 0xea, 0x13, 0x16, 0x0b,
+    0x01, 0xfb, 0xff, 0x00, 0xfb, 0x07, 0x13, 0x08, 0xf4, 0xe4, 0x12, 0x00,
+    0xfb, 0xfa, 0xfc, 0x08, 0xeb, 0x19, 0x02, 0x1c, 0xe8, 0x26, 0xf3, 0x10,
+    0x09, 0x0f, 0x19, 0x02, 0xfb, 0xec, 0xf7, 0xe2, 0xfb, 0xfa, 0x11, 0xf3,
+    0x0b, 0x08, 0xff, 0xd9, 0xf8, 0x12, 0x18, 0x06, 0x07, 0x22, 0xff, 0x19,
+    0xf5, 0x0b, 0x0a, 0x13, 0xf2, 0xfa, 0x02, 0x21, 0xeb, 0x11, 0x17, 0x17,
+    0xec, 0xe1, 0x0e, 0xf7, 0xe8, 0xd8, 0x0e, 0x01, 0xf1, 0xed, 0xed, 0xf0,
+    0x09, 0xf7, 0xe7, 0xfd, 0xf0, 0xf9, 0xdb, 0xee, 0xdc, 0xfb, 0xf8, 0x0a,
+    0xf5, 0x0b, 0xd4, 0xd7, 0x08, 0x06, 0x18, 0x06, 0x0c, 0x13, 0xfd, 0x09,
+    0x13, 0x26, 0x12, 0xf4, 0xef, 0x00, 0xf5, 0x28, 0x18, 0xfe, 0x04, 0x0e,
+    0x21, 0x1a, 0x0a, 0x1e, 0x09, 0xf0, 0x0d, 0x0f, 0xec, 0xf3, 0x17, 0x22,
+    0x00, 0xec, 0x0e, 0x01, 0xe9, 0x08, 0x09, 0xf2, 0xf2, 0x08, 0xf0, 0x0b,
+    0xd9, 0x09, 0x14, 0xf5, 0xf6, 0x04, 0x19, 0xf4, 0x11, 0xe9, 0xf2, 0x0d,
+    0x20, 0x17, 0x0a, 0x05, 0x0c, 0x04, 0x01, 0xfd, 0xf4, 0xfb, 0x1b, 0x0c,
+    0xf2, 0x0b, 0xff, 0xfe, 0x01, 0xd8, 0xfa, 0x0e, 0xf5, 0x14, 0xf9, 0x01,
+    0x04, 0xf8, 0xfa, 0x02, 0xe8, 0xf9, 0xf9, 0xea, 0xf1, 0x07, 0xff, 0x1e,
+    0x01, 0x0b, 0xf7, 0x0a, 0xf7, 0x0c, 0xfd, 0xec, 0xf3, 0x05, 0xf8, 0xda,
+    0x0b, 0x15, 0xf6, 0xee, 0xf9, 0x10, 0xfa, 0xfe, 0x08, 0xf0, 0xe6, 0xec,
+    0x05, 0xff, 0x15, 0x19, 0x1f, 0x11, 0xfc, 0x09, 0x08, 0x01, 0x06, 0xfe,
+    0x04, 0x08, 0xfb, 0xfb, 0x08, 0xf4, 0xf6, 0x28, 0x10, 0xf9, 0x28, 0x0b,
+    0xf8, 0x0d, 0x01, 0x00, 0xff, 0x02, 0x05, 0x08, 0xea, 0xe9, 0xf4, 0xf6,
+    0x01, 0xea, 0xdf, 0x1f, 0xfe, 0x0a, 0xf9, 0xf7, 0x0c, 0x1b, 0x06, 0xed,
+    0xf6, 0xf2, 0x03, 0x03, 0xfd, 0x04, 0xf5, 0x10, 0x0a, 0x0b, 0xf4, 0xf8,
+    0xf1, 0xe7, 0x05, 0xfe, 0xe7, 0x0b, 0xf1, 0xec, 0xf4, 0xec, 0x06, 0xee,
+    0xde, 0x05, 0x1b, 0xfe, 0x13, 0xf3, 0xd9, 0xea, 0x04, 0x10, 0x05, 0xed,
+    0x15, 0x02, 0x0b, 0x10, 0xfa, 0x02, 0x05, 0x0b, 0x02, 0x07, 0xfc, 0xf5,
+    0x15, 0x14, 0x05, 0xf7, 0x0c, 0xfe, 0xf6, 0xf4, 0xfa, 0x06, 0xfc, 0x13,
+    0xdc, 0xe4, 0x09, 0xfa, 0x02, 0x23, 0xec, 0x06, 0x11, 0x13, 0xf8, 0xfa,
+    0x27, 0x28, 0x0b, 0x23, 0xec, 0xf1, 0x09, 0x17, 0x0f, 0x13, 0xff, 0xf2,
+    0xfc, 0x0a, 0xf5, 0x0d, 0x03, 0x26, 0x01, 0x0f, 0xfe, 0xf1, 0xfb, 0xe6,
+    0xf0, 0x02, 0xf2, 0xff, 0x02, 0x11, 0xff, 0xfd, 0x1c, 0x02, 0x0b, 0xf6,
+    0x14, 0x0c, 0x0b, 0x21, 0x28, 0xf0, 0x11, 0x05, 0x06, 0xed, 0xf9, 0x0a,
+    0xf2, 0xef, 0xf8, 0xf1, 0xfe, 0x0d, 0xf9, 0xf7, 0xea, 0x00, 0x08, 0xdb,
+    0x02, 0x0f, 0xfe, 0x04, 0xef, 0x20, 0x16, 0x01, 0xe8, 0xed, 0xe4, 0x22,
+    0xf6, 0x19, 0x00, 0x04, 0x01, 0x13, 0xeb, 0x0d, 0xec, 0x01, 0x08, 0x05,
+    0x0c, 0x0e, 0xfe, 0x02, 0x12, 0xf7, 0x27, 0xf9, 0xfd, 0x18, 0xfe, 0x24,
+    0xf7, 0x13, 0xed, 0x1e, 0x09, 0xff, 0xd8, 0xf4, 0x12, 0xf8, 0x04, 0x0c,
+    0x1c, 0x11, 0xfd, 0x17, 0x1d, 0x01, 0x13, 0xee, 0x11, 0xf3, 0xf8, 0x06,
+    0xf6, 0x16, 0xfe, 0x15, 0x16, 0xdc, 0x1f, 0x00, 0x25, 0xee, 0xff, 0xf7,
+    0xf6, 0x02, 0xdd, 0x15, 0xf1, 0x14, 0x08, 0xe8, 0xe5, 0x21, 0xea, 0xf0,
+    0x1a, 0x07, 0xea, 0x08, 0xea, 0xe4, 0x1e, 0x00, 0x13, 0x17, 0xec, 0x11,
+    0xd6, 0x11, 0x18, 0x17, 0x04, 0x15, 0x03, 0x3a, 0xd6, 0x02, 0x07, 0x04,
+    0xe6, 0xe5, 0xfe, 0x0e, 0xff, 0xed, 0xfc, 0xfb, 0xff, 0x1c, 0x06, 0x0a,
+    0xfb, 0xf9, 0xea, 0x1a, 0x21, 0xf5, 0x04, 0x06, 0x0a, 0xe3, 0x16, 0xea,
+    0x04, 0xe2, 0xf9, 0xf9, 0xe6, 0xfb, 0x0f, 0xfc, 0x06, 0xfb, 0x10, 0x07,
+    0x07, 0x13, 0x07, 0xfc, 0x16, 0xef, 0x07, 0xdc, 0x12, 0x1f, 0x08, 0xf4,
+    0xe9, 0x14, 0x06, 0xf7, 0xf1, 0x0c, 0x01, 0x0c, 0xe6, 0x04, 0xf3, 0xf2,
+    0xe5, 0xf3, 0xef, 0x1d, 0xf6, 0x20, 0x07, 0xfe, 0xf4, 0x05, 0xee, 0x10,
+    0xfd, 0x0e, 0x0b, 0x02, 0x0d, 0xd8, 0x07, 0xfb, 0x26, 0x0a, 0x1c, 0x21,
+    0x06, 0x1f, 0xf4, 0x06, 0x37, 0x18, 0xfa, 0x16, 0x1e, 0x24, 0xfb, 0xf0,
+    0x12, 0xf9, 0x02, 0x09, 0x17, 0x16, 0xf3, 0xf9, 0x17, 0xf2, 0x02, 0x0a,
+    0x2d, 0xe7, 0xe3, 0x25, 0xf0, 0xf9, 0x0f, 0xdd, 0x15, 0xe6, 0x04, 0xfc,
+    0xf1, 0x17, 0x0a, 0xea, 0x24, 0x07, 0xf1, 0x11, 0x13, 0x29, 0xf4, 0xc5,
+    0xfb, 0x07, 0xef, 0x13, 0x0b, 0xe1, 0xf1, 0xeb, 0xf8, 0x1b, 0x09, 0x08,
+    0x1f, 0x15, 0xf2, 0x05, 0x02, 0xdd, 0x09, 0x0f, 0x16, 0x10, 0x01, 0x30,
+    0xf2, 0xe0, 0x27, 0xfe, 0xf1, 0x0e, 0x0e, 0x07, 0xe6, 0x07, 0x0b, 0x18,
+    0xfe, 0x0f, 0x01, 0x07, 0xf4, 0x07, 0x10, 0xe7, 0xfb, 0xf3, 0xf7, 0x0b,
+    0xf9, 0x15, 0x18, 0x25, 0x0c, 0x14, 0x02, 0x08, 0x0a, 0x0f, 0x10, 0xec,
+    0xee, 0x1a, 0x03, 0x14, 0x0f, 0xfa, 0x25, 0xff, 0x18, 0x0d, 0x0b, 0xea,
+    0x1f, 0x28, 0x10, 0x0c, 0xe7, 0xee, 0xf7, 0xfa, 0x03, 0x15, 0x0c, 0x1d,
+    0x01, 0x00, 0x12, 0xee, 0x01, 0xf1, 0xf8, 0x0b, 0xf3, 0xfd, 0x04, 0xf8,
+    0x02, 0x1e, 0x0e, 0xf3, 0x02, 0x10, 0xfd, 0x07, 0x0b, 0x09, 0x03, 0x10,
+    0x3e, 0x08, 0x0e, 0x0c, 0xf4, 0xe7, 0xfd, 0x1c, 0x27, 0x1a, 0xed, 0xe1,
+    0x08, 0xdc, 0xd9, 0xf1, 0x1e, 0x07, 0x12, 0xf1, 0x10, 0xfb, 0xc8, 0x08,
+    0x0f, 0x03, 0x1d, 0xdc, 0x23, 0x04, 0xf9, 0x0a, 0xff, 0x08, 0x0e, 0xc9,
+    0x39, 0x0a, 0x01, 0x07, 0xec, 0xe0, 0x05, 0xe8, 0x14, 0xd8, 0xe1, 0xfa,
+    0xd6, 0xf8, 0xed, 0xdb, 0xff, 0x1d, 0xf5, 0x17, 0x0f, 0x1c, 0xdc, 0xed,
+    0xff, 0xff, 0x04, 0x13, 0xf5, 0xe7, 0xd2, 0x12, 0xdb, 0xe1, 0x13, 0x11,
+    0x23, 0x0e, 0xf9, 0x31, 0xdc, 0xef, 0x07, 0x0a, 0x20, 0xf2, 0xf9, 0x13,
+    0xff, 0x1c, 0x2a, 0xdf, 0xdb, 0xe7, 0x11, 0xf2, 0xfd, 0xfb, 0x28, 0x00,
+    0x15, 0x03, 0x02, 0x20, 0x07, 0xf7, 0x19, 0x13, 0x13, 0xf6, 0x09, 0xfe,
+    0xfd, 0x20, 0x14, 0xf5, 0xf5, 0xfc, 0x14, 0x0e, 0x17, 0xfe, 0x15, 0x04,
+    0xf9, 0xf6, 0x1d, 0xf6, 0x1b, 0xe4, 0xee, 0xfd, 0x00, 0xe9, 0xee, 0xce,
+    0x0f, 0x20, 0x05, 0x02, 0x0d, 0x06, 0x05, 0xf8, 0xef, 0xdf, 0x16, 0x17,
+    0xe6, 0xf1, 0x10, 0xf3, 0x06, 0x04, 0xdb, 0xfb, 0xe7, 0xf8, 0x02, 0x11,
+    0xff, 0x0d, 0x0a, 0xfa, 0x27, 0x0a, 0xfc, 0xe8, 0x11, 0x17, 0xf0, 0x0d,
+    0x0d, 0xee, 0xdf, 0xdd, 0xf1, 0x15, 0xd6, 0xf7, 0x00, 0xef, 0x2e, 0xe6,
+    0x24, 0xfd, 0xd5, 0x04, 0xf0, 0x08, 0x08, 0xed, 0x22, 0x07, 0xe1, 0x09,
+    0xd0, 0x0b, 0x18, 0xe6, 0x3f, 0x0a, 0xe5, 0xe2, 0xf9, 0x08, 0x02, 0xd6,
+    0x13, 0x15, 0xbd, 0x00, 0x0e, 0xf8, 0xe2, 0xca, 0xec, 0x0e, 0xe6, 0xef,
+    0x15, 0x11, 0xcb, 0xdf, 0xf9, 0x03, 0x22, 0x10, 0xfb, 0xf9, 0xe5, 0x08,
+    0xe1, 0x11, 0x10, 0xfc, 0xfa, 0x00, 0xf8, 0x30, 0xe5, 0x08, 0x14, 0xe8,
+    0x12, 0xe2, 0x04, 0x19, 0x0b, 0xfa, 0x33, 0xf3, 0xec, 0xfe, 0xf8, 0x25,
+    0xf8, 0x21, 0x28, 0xef, 0x00, 0xde, 0xff, 0x2b, 0x03, 0xfc, 0x10, 0x0c,
+    0xcf, 0xfd, 0x19, 0x0a, 0x0c, 0xf2, 0xf7, 0x0c, 0xfd, 0x02, 0x1c, 0xdf,
+    0x26, 0x0d, 0xf0, 0x0b, 0xce, 0x15, 0xfb, 0xec, 0x27, 0xf6, 0xf9, 0xe5,
+    0xe2, 0xfb, 0xfd, 0xd8, 0x28, 0xec, 0xe9, 0xf2, 0xca, 0x09, 0x02, 0x06,
+    0x0c, 0xfa, 0x05, 0x01, 0xd5, 0x0a, 0x02, 0xfb, 0x04, 0x17, 0xdd, 0xfe,
+    0xeb, 0xf1, 0x09, 0x10, 0x12, 0xff, 0x00, 0xe0, 0x26, 0xf7, 0xed, 0xf4,
+    0x00, 0xf2, 0xfa, 0x07, 0x02, 0xf5, 0x06, 0xe8, 0x03, 0xfd, 0xdc, 0xf2,
+    0xc2, 0xff, 0x0b, 0xd6, 0x25, 0x04, 0xe9, 0xf0, 0xd9, 0x08, 0x09, 0xc5,
+    0x23, 0x12, 0xf6, 0x13, 0x11, 0xf3, 0x18, 0xf0, 0x34, 0xfe, 0xfe, 0xed,
+    0xea, 0x02, 0x17, 0xdc, 0x1b, 0x1b, 0xea, 0xfe, 0xea, 0xfe, 0xf2, 0xc4,
+    0xfd, 0x04, 0xe9, 0x0d, 0x0d, 0x09, 0xca, 0xd4, 0xe1, 0x04, 0x1e, 0xff,
+    0x0f, 0xef, 0xd6, 0x0f, 0xd5, 0xf8, 0x26, 0xd6, 0x33, 0xe8, 0xf5, 0x3b,
+    0xf1, 0xe8, 0x39, 0xe8, 0x08, 0xe5, 0x01, 0x02, 0x04, 0xf6, 0x19, 0x0a,
+    0xd0, 0xeb, 0x0b, 0x15, 0xf7, 0x0e, 0x23, 0xf6, 0xf4, 0xd8, 0xf4, 0x17,
+    0x23, 0x25, 0x14, 0x01, 0xd7, 0xfd, 0xf9, 0x1f, 0x1b, 0x11, 0x0a, 0x18,
+    0xf5, 0xf5, 0x0f, 0xe0, 0x2e, 0x01, 0xe5, 0xdb, 0xe2, 0xf2, 0x14, 0xfa,
+    0x2a, 0x00, 0xe2, 0xea, 0xfd, 0x0e, 0xfc, 0xc1, 0x35, 0x08, 0xf6, 0xf9,
+    0xec, 0x00, 0x06, 0x00, 0x0b, 0xf6, 0x01, 0xfe, 0xea, 0x0b, 0x08, 0x05,
+    0xe4, 0xea, 0xd7, 0xfd, 0xee, 0xf3, 0x0c, 0x0c, 0x0d, 0x02, 0xfd, 0xee,
+    0x17, 0x10, 0x13, 0xfd, 0x07, 0x03, 0xf8, 0x0c, 0xd4, 0xed, 0xfe, 0x07,
+    0xf4, 0xee, 0xf4, 0x03, 0xc2, 0x18, 0x2c, 0xd1, 0x33, 0xd8, 0xdb, 0xfa,
+    0xed, 0x10, 0x1c, 0xe3, 0x37, 0x0a, 0xea, 0xfe, 0xf6, 0xef, 0x20, 0xed,
+    0x32, 0xf7, 0xf5, 0xf3, 0xca, 0xfd, 0x0a, 0xcf, 0x0d, 0x10, 0xde, 0x07,
+    0x18, 0x10, 0xf0, 0xd6, 0x0c, 0x04, 0xeb, 0x1a, 0xf9, 0x08, 0xc4, 0xcb,
+    0xe4, 0x0b, 0x19, 0xfc, 0x29, 0xf6, 0xec, 0x07, 0xf3, 0xed, 0x2b, 0xe9,
+    0xfa, 0x02, 0xec, 0x2b, 0xf0, 0xf2, 0x2d, 0xe8, 0xed, 0x00, 0x12, 0x13,
+    0xed, 0x1a, 0x3d, 0xf0, 0x05, 0x04, 0xfc, 0x13, 0x10, 0x01, 0x40, 0xf2,
+    0x06, 0x02, 0xf9, 0x22, 0x24, 0xff, 0x18, 0x00, 0xeb, 0xe8, 0x14, 0xf9,
+    0x25, 0xe0, 0xff, 0x03, 0xe5, 0xfd, 0x08, 0xea, 0x2e, 0x0b, 0x05, 0xe7,
+    0xde, 0xe4, 0xf5, 0xea, 0x3a, 0xf4, 0xf4, 0xe7, 0xed, 0xec, 0xf8, 0xee,
+    0x30, 0x0a, 0xdb, 0x05, 0xf7, 0x16, 0xff, 0xf7, 0xfa, 0x1f, 0xef, 0xe4,
+    0xce, 0xf8, 0x13, 0x04, 0xf9, 0x01, 0xe1, 0x03, 0xf9, 0xf9, 0x08, 0x04,
+    0xfa, 0xe4, 0xe7, 0xf7, 0x28, 0xfd, 0xfd, 0x00, 0xfc, 0xfb, 0xef, 0x0a,
+    0xec, 0x0c, 0x0a, 0xd2, 0x05, 0xfb, 0xcd, 0xfb, 0x9d, 0xea, 0x1c, 0xe5,
+    0x25, 0xe8, 0xea, 0x0b, 0xf0, 0xf3, 0x0d, 0xab, 0x49, 0x0e, 0xeb, 0x00,
+    0xe2, 0x03, 0x29, 0xe0, 0x3d, 0x06, 0xf7, 0xf8, 0xcf, 0x0c, 0x1a, 0xd6,
+    0x1f, 0xef, 0xfd, 0xff, 0xef, 0x0c, 0xdb, 0xe0, 0x20, 0x06, 0xdf, 0x1a,
+    0xe7, 0xfc, 0xb2, 0xd1, 0xdf, 0x13, 0x07, 0x1f, 0x0c, 0xf7, 0xde, 0x0a,
+    0xdb, 0xdf, 0x1a, 0xf5, 0x29, 0x0d, 0xeb, 0x2c, 0xcf, 0x0e, 0x26, 0xfe,
+    0xef, 0x04, 0xf5, 0x14, 0x09, 0x13, 0x34, 0xff, 0xfe, 0x0e, 0x06, 0x0e,
+    0x10, 0xf9, 0x2a, 0x0b, 0xe6, 0xfe, 0xf1, 0x1a, 0x36, 0x29, 0x29, 0x05,
+    0x05, 0xd8, 0x14, 0x12, 0x26, 0x0b, 0x18, 0xff, 0xd7, 0xdf, 0x0f, 0xed,
+    0x31, 0xf7, 0xfc, 0xec, 0x0b, 0xef, 0x0c, 0xd2, 0x30, 0xf9, 0x04, 0xfe,
+    0xef, 0xe4, 0xfb, 0xd1, 0x32, 0xe5, 0xee, 0xf0, 0x0c, 0xe6, 0x13, 0xed,
+    0x1e, 0x0b, 0xe4, 0xe0, 0xfa, 0xf4, 0x14, 0xf4, 0x18, 0xf7, 0xd9, 0xf6,
+    0xed, 0xea, 0xfc, 0x06, 0xfc, 0xf5, 0xed, 0xeb, 0x05, 0x03, 0x1b, 0x0b,
+    0xff, 0x0b, 0xef, 0x01, 0xf1, 0x16, 0x05, 0x00, 0xee, 0x0a, 0xdb, 0x10,
+    0xb4, 0x14, 0x0f, 0xe1, 0x1c, 0xfd, 0xf0, 0xf8, 0xc3, 0x11, 0x17, 0xba,
+    0x47, 0x15, 0xe6, 0x01, 0xea, 0xf1, 0x0c, 0x08, 0x4a, 0x15, 0xf0, 0xf7,
+    0xea, 0x00, 0xf5, 0xd4, 0xf1, 0xff, 0xe0, 0x0c, 0xf4, 0x17, 0xd8, 0xea,
+    0x03, 0xff, 0xd5, 0x18, 0xfb, 0x07, 0xc7, 0xc9, 0xdd, 0xf3, 0x15, 0x0d,
+    0x22, 0xea, 0xdb, 0x0a, 0xd6, 0x09, 0x1d, 0xe5, 0x2d, 0x04, 0xfc, 0x35,
+    0xc6, 0x0e, 0x33, 0xf1, 0xd7, 0xea, 0x01, 0x1b, 0x0e, 0x01, 0x2a, 0xff,
+    0xef, 0xf1, 0xf7, 0x0f, 0xff, 0x00, 0x3b, 0xe8, 0x0a, 0xff, 0xf4, 0x0d,
+    0x1f, 0x04, 0x17, 0xf7, 0xdf, 0xec, 0x12, 0x26, 0x36, 0x07, 0x0c, 0x06,
+    0xe7, 0xd6, 0x13, 0xe3, 0x30, 0x09, 0x00, 0xf5, 0xe0, 0xf3, 0x11, 0xe2,
+    0x38, 0x0d, 0xf6, 0x05, 0xec, 0x05, 0x00, 0xe5, 0x24, 0xef, 0xfe, 0xf8,
+    0x00, 0xd8, 0x18, 0xf1, 0x26, 0x0b, 0xf2, 0xfc, 0xe0, 0xe4, 0x06, 0x0b,
+    0x1a, 0x05, 0xc6, 0xf6, 0xe8, 0xde, 0xfe, 0x0c, 0x03, 0x09, 0xfe, 0xe2,
+    0x18, 0x1b, 0xfb, 0xf7, 0x06, 0xf1, 0xfe, 0xf6, 0xef, 0x1b, 0x07, 0x0d,
+    0x01, 0x0a, 0xed, 0xf0, 0xad, 0x1a, 0x17, 0xd6, 0x37, 0xfd, 0xd8, 0xec,
+    0xca, 0xf1, 0x15, 0xc4, 0x33, 0xf1, 0xed, 0xf0, 0xe9, 0x15, 0x0d, 0xf2,
+    0x36, 0xde, 0xfd, 0x0e, 0xfb, 0x10, 0x0f, 0xf6, 0xf9, 0x0c, 0xea, 0xf0,
+    0xe5, 0x0b, 0xee, 0xc1, 0x10, 0xf4, 0xe8, 0x1f, 0xee, 0x00, 0xd0, 0xe4,
+    0xe7, 0x13, 0x07, 0x27, 0x12, 0xea, 0xea, 0x0f, 0xea, 0xf4, 0x14, 0xee,
+    0xfe, 0x09, 0xfb, 0x31, 0xdb, 0x1b, 0x1c, 0xe7, 0xef, 0xf5, 0xf7, 0x1a,
+    0x06, 0x01, 0x2c, 0xed, 0xfb, 0x04, 0xfa, 0x07, 0x19, 0xec, 0x2b, 0x0d,
+    0xfc, 0xd8, 0xfc, 0x0f, 0x1f, 0xfc, 0x2d, 0xf3, 0xc9, 0xda, 0x0a, 0xfe,
+    0x29, 0x00, 0xfa, 0x09, 0xe8, 0xf6, 0x21, 0xf3, 0x4a, 0x1a, 0xf8, 0x00,
+    0xe7, 0xf0, 0x21, 0x01, 0x22, 0xf3, 0x00, 0xe9, 0x06, 0xe3, 0x15, 0xd7,
+    0x3d, 0x0c, 0x07, 0xf1, 0xf3, 0xec, 0x17, 0xdf, 0x29, 0x1b, 0xfd, 0xfe,
+    0xeb, 0xed, 0x17, 0xf6, 0x23, 0x0a, 0xea, 0xee, 0xf9, 0xf3, 0x0f, 0x0c,
+    0xf8, 0xf5, 0xed, 0xe8, 0x1c, 0x14, 0x07, 0x17, 0x0b, 0x0d, 0xed, 0xf7,
+    0xed, 0x10, 0x07, 0xd5, 0xf2, 0x09, 0xd6, 0xf7, 0xb5, 0xf6, 0x19, 0xc9,
+    0x25, 0x15, 0xe8, 0xf5, 0xc4, 0xf9, 0x2a, 0xb0, 0x39, 0x0e, 0x02, 0x11,
+    0xf0, 0xf7, 0x1d, 0xeb, 0x39, 0x10, 0x02, 0x15, 0xe0, 0x08, 0x01, 0xee,
+    0x1c, 0x1e, 0x08, 0x04, 0xf2, 0x02, 0xe8, 0xda, 0xfa, 0xfb, 0xe0, 0xfe,
+    0x05, 0x02, 0xd3, 0xca, 0xf4, 0xec, 0x10, 0x16, 0x05, 0x0d, 0xd7, 0x09,
+    0xdc, 0xf6, 0x1e, 0xf8, 0x10, 0xed, 0xf7, 0x27, 0xf5, 0x08, 0x28, 0xee,
+    0xec, 0xe0, 0xf8, 0x17, 0xfb, 0x23, 0x2e, 0xf1, 0xfa, 0xf5, 0xfc, 0x1a,
+    0x10, 0xf7, 0x32, 0xfb, 0xfb, 0xe8, 0xf1, 0x03, 0x24, 0xeb, 0x25, 0xf9,
+    0xca, 0xf1, 0xfe, 0x01, 0x2e, 0x07, 0x18, 0x03, 0xe5, 0xea, 0x10, 0xfa,
+    0x3b, 0x07, 0x0f, 0x11, 0x04, 0xf7, 0x1d, 0xf1, 0x24, 0xd9, 0x08, 0xef,
+    0x02, 0xdd, 0x07, 0xc8, 0x2c, 0x0d, 0x06, 0xec, 0x17, 0xda, 0x21, 0xdf,
+    0x34, 0xd9, 0xfb, 0xf2, 0xf4, 0xec, 0x0e, 0x0a, 0x0f, 0x0f, 0xdb, 0xf0,
+    0xfb, 0xe6, 0x0f, 0x00, 0x04, 0xf9, 0x01, 0x05, 0x05, 0xfe, 0x08, 0xf3,
+    0x0e, 0xf2, 0xfb, 0x01, 0xfd, 0x18, 0x1d, 0xf6, 0xee, 0x06, 0xcf, 0xfc,
+    0xae, 0x27, 0x21, 0xd2, 0x33, 0x03, 0xe0, 0xe0, 0xc9, 0xfb, 0x3a, 0xbd,
+    0x4d, 0x04, 0xe8, 0xf5, 0xe6, 0xeb, 0x19, 0xf2, 0x4b, 0x1d, 0xfc, 0xf7,
+    0xd9, 0xff, 0xfe, 0xea, 0x0f, 0x04, 0x0e, 0x00, 0xed, 0x19, 0xe9, 0xe9,
+    0xff, 0x11, 0xef, 0x14, 0x01, 0x17, 0xbc, 0xb5, 0xef, 0x0c, 0x22, 0x27,
+    0x0f, 0x01, 0xd4, 0x03, 0xce, 0x01, 0x25, 0xff, 0xf9, 0xf0, 0x0a, 0x1c,
+    0xe5, 0x0f, 0x1c, 0xee, 0xf4, 0xf1, 0xf4, 0x0c, 0x00, 0x08, 0x1c, 0xf4,
+    0xd5, 0xf1, 0xfc, 0x1f, 0x11, 0x00, 0x18, 0x03, 0xf7, 0xe4, 0xff, 0x07,
+    0x09, 0x1a, 0x18, 0xff, 0xea, 0xec, 0xfd, 0x13, 0x2b, 0xf8, 0x0c, 0xfa,
+    0xdf, 0xf6, 0x11, 0xda, 0x2a, 0xdc, 0xfc, 0xff, 0xff, 0xec, 0x12, 0xe1,
+    0x37, 0xfd, 0xeb, 0xfe, 0xea, 0xd1, 0x12, 0xfa, 0x28, 0x1a, 0x0d, 0xf0,
+    0xf7, 0xe0, 0x0c, 0xeb, 0x35, 0x14, 0xeb, 0x00, 0xeb, 0xe7, 0x1b, 0xfc,
+    0x09, 0x00, 0xf2, 0x04, 0xf9, 0xe5, 0x1a, 0x0e, 0x08, 0x12, 0xf8, 0xfe,
+    0x09, 0x0f, 0x0d, 0xea, 0x03, 0xe1, 0xfe, 0xf2, 0xec, 0x0d, 0x02, 0xdb,
+    0x04, 0x1d, 0xd4, 0x01, 0xca, 0x13, 0x29, 0xca, 0x28, 0x04, 0xe2, 0xf1,
+    0xdb, 0x0b, 0x2c, 0xcd, 0x44, 0x00, 0xe7, 0xf4, 0xd0, 0x12, 0x15, 0xff,
+    0x42, 0x11, 0x05, 0xfd, 0xd9, 0x11, 0x1c, 0xf4, 0x15, 0xec, 0xf2, 0x24,
+    0xd6, 0x1d, 0xec, 0xda, 0xf5, 0xec, 0xe5, 0x22, 0xf2, 0x0b, 0xbd, 0xd0,
+    0xeb, 0x05, 0x07, 0x1b, 0x01, 0xed, 0xf5, 0x02, 0xcf, 0x08, 0x15, 0xfd,
+    0x1c, 0xe5, 0x04, 0x19, 0xc7, 0x25, 0x22, 0xf3, 0xde, 0xfb, 0xfb, 0x20,
+    0xf6, 0xeb, 0x25, 0xfe, 0xf5, 0x08, 0xf5, 0x17, 0x0e, 0x04, 0x1c, 0xf9,
+    0xee, 0xec, 0xe1, 0x06, 0x12, 0xff, 0x2a, 0x13, 0xed, 0xfe, 0x05, 0x18,
+    0x25, 0x20, 0x09, 0x13, 0xea, 0xd7, 0x05, 0x06, 0x33, 0x25, 0xff, 0x0a,
+    0xf0, 0xea, 0x17, 0xe1, 0x30, 0xfa, 0x0d, 0x0a, 0x04, 0x00, 0x0e, 0xe9,
+    0x16, 0x20, 0x0d, 0x02, 0xe8, 0xed, 0x07, 0xe8, 0x3c, 0xf1, 0xd9, 0xfa,
+    0xe1, 0xed, 0x18, 0xfc, 0xf0, 0x09, 0xe3, 0x05, 0xfe, 0xd1, 0x0b, 0x0e,
+    0xf5, 0x25, 0xfd, 0xfb, 0x30, 0x1e, 0x08, 0xfc, 0x0c, 0x21, 0xea, 0xfc,
+    0xe5, 0x1e, 0x16, 0xf5, 0xf4, 0xfc, 0xf0, 0xea, 0xc4, 0x21, 0x27, 0xe9,
+    0x2b, 0xdb, 0xdb, 0xec, 0xe5, 0xfe, 0x37, 0xe2, 0x46, 0x25, 0xfa, 0xec,
+    0xe4, 0xf3, 0x19, 0xf2, 0x4c, 0x06, 0x00, 0xfb, 0xeb, 0x10, 0x10, 0xf7,
+    0x2a, 0xf8, 0xe9, 0x18, 0xee, 0x21, 0xe8, 0xd5, 0xf4, 0x0a, 0xed, 0x24,
+    0xfe, 0xf9, 0xb2, 0xbc, 0xf3, 0x1d, 0x00, 0x2f, 0x07, 0x08, 0xe1, 0xf1,
+    0xed, 0x27, 0x27, 0xfe, 0x22, 0xfd, 0x02, 0x20, 0xd8, 0x05, 0x25, 0xec,
+    0xf1, 0xff, 0x0a, 0x0f, 0xe6, 0xfe, 0x46, 0xfd, 0xe1, 0xca, 0xf7, 0x22,
+    0x03, 0x08, 0x21, 0xf5, 0x0f, 0xf7, 0xfb, 0x0c, 0xfb, 0x14, 0x2d, 0x03,
+    0xe5, 0xe4, 0x09, 0x0b, 0x1a, 0xe6, 0x01, 0x28, 0xe9, 0xd6, 0x0b, 0xf7,
+    0x2c, 0xfb, 0x11, 0xee, 0x0b, 0xed, 0x17, 0xf0, 0x3c, 0xf5, 0x08, 0xfa,
+    0xf8, 0xcd, 0x17, 0xfa, 0x39, 0xea, 0x11, 0xf5, 0xed, 0xee, 0x0a, 0xec,
+    0x41, 0xd6, 0xe7, 0xf9, 0xfa, 0xc8, 0x15, 0xf7, 0x08, 0x0e, 0xe3, 0x08,
+    0xe8, 0xec, 0xfd, 0xfe, 0xf1, 0x00, 0xe9, 0xf4, 0x09, 0x26, 0x02, 0x16,
+    0xf0, 0x01, 0xef, 0x01, 0xff, 0x03, 0x22, 0xdb, 0xfc, 0xf5, 0xde, 0xe5,
+    0xc4, 0x01, 0x28, 0xd4, 0x38, 0x08, 0xd0, 0xec, 0xd5, 0x04, 0x2f, 0xce,
+    0x4e, 0xeb, 0xf9, 0xe7, 0xdf, 0xf0, 0x1b, 0xf5, 0x42, 0xf1, 0xf6, 0x09,
+    0xd5, 0x0a, 0x0d, 0x08, 0x04, 0x05, 0xe2, 0x0e, 0xd7, 0x19, 0xdb, 0xda,
+    0xe1, 0x25, 0xde, 0x15, 0x0e, 0x14, 0xbd, 0xb0, 0xe3, 0xe5, 0x24, 0x1e,
+    0xf8, 0x0d, 0xd8, 0xf7, 0xf2, 0xff, 0x18, 0xf5, 0x07, 0xf0, 0x02, 0x25,
+    0xd5, 0x1e, 0x2e, 0xdf, 0xe7, 0x05, 0xef, 0x11, 0xe8, 0xe7, 0x47, 0xf4,
+    0xe1, 0xde, 0x09, 0x36, 0x1a, 0x11, 0x11, 0xf5, 0x12, 0xe5, 0xe7, 0x18,
+    0x01, 0x17, 0x2a, 0x03, 0x05, 0xea, 0x09, 0x0b, 0x12, 0x04, 0x17, 0xf0,
+    0xee, 0xd7, 0x11, 0xed, 0x3c, 0x17, 0x16, 0xff, 0x02, 0xdc, 0x21, 0xf3,
+    0x2e, 0xe5, 0x13, 0xef, 0xec, 0xe2, 0x10, 0xd0, 0x2e, 0xee, 0xff, 0x01,
+    0xe0, 0xe5, 0x0b, 0xda, 0x1f, 0xf8, 0xf6, 0xfb, 0x07, 0xdb, 0x05, 0xf6,
+    0x0c, 0xf3, 0xf0, 0x10, 0xf9, 0xf5, 0xf2, 0x0d, 0x10, 0xf7, 0xf6, 0xff,
+    0x2b, 0x0d, 0x06, 0x1e, 0xf3, 0x0c, 0xe9, 0x01, 0xf2, 0x23, 0xfe, 0xe9,
+    0xdd, 0x12, 0xdd, 0xf7, 0xbb, 0x22, 0x1b, 0xd4, 0x38, 0x29, 0xd4, 0xcf,
+    0xf5, 0xf9, 0x27, 0xdd, 0x47, 0x00, 0xf2, 0xe5, 0x09, 0xfc, 0x0e, 0xf9,
+    0x34, 0x0a, 0x02, 0xfd, 0xec, 0x25, 0x1d, 0x03, 0x15, 0x09, 0xf1, 0x1b,
+    0xd0, 0x17, 0xda, 0xda, 0xe7, 0x07, 0xe3, 0x15, 0xf1, 0x02, 0xb9, 0xce,
+    0xe6, 0x0c, 0x10, 0x31, 0xfe, 0xf7, 0xd9, 0xfa, 0xed, 0xed, 0x33, 0xf4,
+    0x19, 0xe7, 0xfe, 0x3f, 0xe5, 0x06, 0x2e, 0xe6, 0xf2, 0xdc, 0xf5, 0x18,
+    0xe6, 0x01, 0x2f, 0xee, 0xe7, 0xe4, 0xfe, 0x2c, 0x03, 0xf7, 0x20, 0x05,
+    0x07, 0xe2, 0x06, 0x1e, 0x05, 0xed, 0x2f, 0x03, 0xea, 0xf8, 0x0e, 0x0c,
+    0x1f, 0xff, 0x20, 0xf4, 0xe8, 0xe1, 0x1c, 0xec, 0x22, 0x1e, 0x05, 0xfd,
+    0xf5, 0xca, 0x30, 0xe9, 0x30, 0xe4, 0x14, 0xff, 0xf2, 0xdc, 0x17, 0xf8,
+    0x26, 0xe1, 0x0b, 0x01, 0x11, 0xc2, 0x02, 0xf1, 0x36, 0x10, 0x02, 0x05,
+    0xed, 0xf1, 0x15, 0xfa, 0x17, 0xf8, 0xf7, 0xf1, 0xe8, 0xd3, 0xfd, 0x08,
+    0xfb, 0x27, 0xf5, 0xf5, 0x13, 0x06, 0x0b, 0xf0, 0x01, 0xf9, 0xd7, 0x0e,
+    0xec, 0x12, 0xfe, 0xfd, 0xee, 0x25, 0xd8, 0xf1, 0xb2, 0x09, 0x1c, 0xbf,
+    0x34, 0xea, 0xc8, 0xea, 0xdb, 0x0e, 0x24, 0xde, 0x47, 0xfe, 0xdc, 0xe0,
+    0xf3, 0x06, 0x20, 0xfe, 0x2b, 0xf6, 0x18, 0x14, 0xcd, 0x19, 0x16, 0xfe,
+    0x1a, 0x15, 0xf8, 0x11, 0xf4, 0x22, 0xd7, 0xcc, 0xdd, 0x15, 0xdc, 0x14,
+    0xf9, 0x02, 0xbb, 0xca, 0xe3, 0xf3, 0x0d, 0x1e, 0x2a, 0x0c, 0xe4, 0x05,
+    0xe0, 0x18, 0x2a, 0x07, 0x20, 0xed, 0xf6, 0x17, 0xcf, 0xf4, 0x2a, 0xd6,
+    0xfb, 0xce, 0x03, 0x37, 0xe2, 0xfd, 0x1d, 0xfb, 0xe5, 0xe0, 0x05, 0x29,
+    0xef, 0x16, 0x23, 0xf7, 0x01, 0xf4, 0x0c, 0x14, 0xff, 0xee, 0x31, 0xf9,
+    0x12, 0xf9, 0x14, 0xf6, 0x0c, 0xf6, 0x0b, 0x0f, 0xd8, 0xdc, 0xfe, 0x0f,
+    0x37, 0xfa, 0x01, 0x09, 0x04, 0xd1, 0x0b, 0x0c, 0x29, 0xf3, 0x0a, 0xf9,
+    0xed, 0xc2, 0x18, 0xf4, 0x25, 0x18, 0x0f, 0x08, 0xf7, 0xed, 0x1f, 0xf7,
+    0x4f, 0x0e, 0xf0, 0xe4, 0x00, 0xeb, 0xfa, 0x1a, 0x0c, 0x03, 0xe9, 0xfc,
+    0xf0, 0xcc, 0x06, 0x05, 0xf2, 0x12, 0x04, 0xe2, 0x16, 0x0a, 0x0a, 0xf3,
+    0x0b, 0xf3, 0xdc, 0xfd, 0x10, 0xfc, 0x0e, 0xe2, 0xe0, 0xfe, 0xf0, 0xff,
+    0xb1, 0x06, 0x1b, 0xe4, 0x30, 0x13, 0xc6, 0xc3, 0xfa, 0x0c, 0x1e, 0xd9,
+    0x57, 0x11, 0xe1, 0xd6, 0xfa, 0xee, 0x1d, 0xf7, 0x37, 0xea, 0xf0, 0x05,
+    0xef, 0x24, 0x1e, 0xf1, 0x10, 0xe8, 0xeb, 0x19, 0xd1, 0x18, 0xf5, 0xc8,
+    0xf8, 0xec, 0xf5, 0x1f, 0xf2, 0xff, 0xb3, 0xd2, 0xe6, 0x0e, 0x06, 0x2e,
+    0x07, 0x17, 0xe0, 0xf5, 0x02, 0xf9, 0x20, 0x07, 0x16, 0x08, 0xe8, 0x1d,
+    0xd3, 0x08, 0x34, 0xda, 0xf2, 0xce, 0xfb, 0x1f, 0xe1, 0x00, 0x2d, 0xdb,
+    0xdf, 0xcc, 0x05, 0xfb, 0xf7, 0x00, 0x33, 0xf9, 0x0b, 0x01, 0x13, 0x28,
+    0xf8, 0x07, 0x24, 0xf8, 0x0f, 0x03, 0x0d, 0xe9, 0x06, 0xfe, 0x18, 0xf9,
+    0xed, 0xf5, 0x0c, 0xe0, 0x2c, 0x0e, 0xf9, 0x06, 0xfb, 0xce, 0x27, 0xe8,
+    0x29, 0x19, 0xf9, 0x01, 0x0e, 0xc8, 0x25, 0xed, 0x30, 0xeb, 0x01, 0xfe,
+    0x10, 0xdc, 0x1e, 0x00, 0x1e, 0x10, 0xf9, 0x00, 0xfc, 0xc8, 0x0e, 0x04,
+    0x13, 0x04, 0xf0, 0x02, 0xfe, 0xd8, 0x0f, 0x1b, 0xf7, 0xe1, 0xf8, 0xde,
+    0x12, 0xe2, 0xef, 0x0a, 0x02, 0xe0, 0xdd, 0xf1, 0x0e, 0x2a, 0x25, 0x15,
+    0xeb, 0x02, 0xf4, 0xf0, 0xbf, 0xfc, 0x27, 0xdc, 0x42, 0x0f, 0xe9, 0xbf,
+    0xe8, 0x20, 0x33, 0xc9, 0x3f, 0x10, 0xec, 0xf3, 0x03, 0x02, 0x2c, 0x04,
+    0x38, 0x06, 0x0a, 0xf9, 0xe5, 0x1c, 0x3f, 0x0f, 0x0c, 0x25, 0xe2, 0x06,
+    0xe6, 0x03, 0xf4, 0xd7, 0xfe, 0xf6, 0xe7, 0x2f, 0xfa, 0x03, 0xb6, 0xcb,
+    0xf1, 0x11, 0x0a, 0x2c, 0xfc, 0x1e, 0xe0, 0xff, 0xc2, 0xdd, 0x1d, 0xf3,
+    0x10, 0xfa, 0x07, 0x1e, 0xf6, 0x20, 0x07, 0xe6, 0xf1, 0x0a, 0xe8, 0x27,
+    0xf1, 0xf5, 0x24, 0xed, 0xfd, 0xee, 0x13, 0x15, 0xe9, 0xe2, 0x22, 0xe5,
+    0xf9, 0xdd, 0x1d, 0x32, 0x04, 0xfa, 0x25, 0x00, 0xee, 0xfd, 0x0b, 0x0e,
+    0x23, 0xfa, 0x0f, 0x01, 0xf8, 0xf0, 0x15, 0xe4, 0x21, 0xf7, 0x10, 0xf9,
+    0xe7, 0xc3, 0x19, 0xe1, 0x34, 0xff, 0xed, 0xf4, 0xef, 0xd7, 0x21, 0x01,
+    0x31, 0xee, 0xf7, 0xf2, 0xf3, 0xe5, 0x0a, 0xee, 0x2e, 0x1e, 0xf2, 0x0c,
+    0x07, 0xc2, 0x08, 0x0a, 0x14, 0x14, 0x00, 0xfc, 0xf9, 0xd6, 0xfb, 0xf8,
+    0xe5, 0xf1, 0xfa, 0xe0, 0x15, 0x21, 0xef, 0x06, 0xf9, 0x00, 0xf5, 0xf4,
+    0x0b, 0x0b, 0x18, 0x02, 0xf5, 0x04, 0xdb, 0xfd, 0xcc, 0x32, 0x1d, 0xc9,
+    0x3b, 0x12, 0xd9, 0xaf, 0xcf, 0x0f, 0x26, 0xde, 0x35, 0xe4, 0xdb, 0xd3,
+    0x22, 0x11, 0x2e, 0xfb, 0x36, 0xfa, 0xfd, 0x02, 0xeb, 0x0f, 0x37, 0x0b,
+    0x14, 0x1d, 0xdd, 0x18, 0xe0, 0x10, 0xe0, 0xdf, 0x14, 0xf9, 0xf0, 0x19,
+    0xf7, 0xfb, 0xc4, 0xe5, 0xe7, 0x11, 0x01, 0x31, 0x1a, 0xf7, 0xd8, 0xf1,
+    0xe9, 0xf3, 0x21, 0xf9, 0xfe, 0xe4, 0xe9, 0x02, 0xd0, 0x06, 0x14, 0xd7,
+    0xfc, 0xec, 0x06, 0x10, 0xfc, 0xf0, 0x1c, 0xe7, 0xec, 0xe3, 0x03, 0x21,
+    0xe4, 0x04, 0x12, 0xf0, 0xf3, 0xed, 0x16, 0x36, 0x02, 0xfd, 0x13, 0x11,
+    0xdf, 0xeb, 0x19, 0x07, 0x10, 0x0c, 0xf9, 0x08, 0xf8, 0xf4, 0x1d, 0xfd,
+    0x1d, 0x16, 0xf4, 0x0a, 0x08, 0xec, 0x0c, 0x09, 0x3d, 0xe0, 0x0b, 0xee,
+    0x10, 0xd1, 0x1e, 0x15, 0x43, 0xeb, 0xfa, 0xf3, 0x05, 0xc7, 0xf2, 0xd9,
+    0x25, 0x20, 0xee, 0xe9, 0xfd, 0xce, 0x16, 0x0c, 0x27, 0x06, 0x0a, 0x06,
+    0xf9, 0xd6, 0x0b, 0x05, 0xe8, 0x02, 0xe8, 0xd2, 0x10, 0x01, 0xf2, 0x15,
+    0x09, 0x04, 0xd3, 0xe2, 0xfe, 0xf0, 0x32, 0x1b, 0xd9, 0xf5, 0xea, 0xcc,
+    0xcb, 0x10, 0x1c, 0xf1, 0x3b, 0x02, 0xd4, 0xbf, 0xca, 0xfe, 0x12, 0xdb,
+    0x3b, 0xf8, 0xd5, 0xe7, 0x13, 0x10, 0x1a, 0xf4, 0x38, 0x09, 0x08, 0xee,
+    0xf4, 0xf4, 0x3c, 0xf7, 0x15, 0x04, 0xe4, 0xfa, 0xf4, 0x04, 0xee, 0xf4,
+    0x07, 0xf8, 0xe9, 0x3b, 0xe2, 0x1f, 0xd5, 0xed, 0xe6, 0xfd, 0x18, 0x49,
+    0x21, 0x06, 0xd8, 0xde, 0xfa, 0xf0, 0x1b, 0xfe, 0xde, 0x08, 0xf7, 0x14,
+    0xc7, 0x0f, 0x1d, 0xcf, 0x00, 0xea, 0xff, 0x1b, 0xd5, 0x08, 0x0d, 0xd9,
+    0xf1, 0xf4, 0x16, 0x23, 0xd8, 0x0c, 0x29, 0xdc, 0xf1, 0xf2, 0x21, 0x49,
+    0xfc, 0xe2, 0x08, 0x01, 0xf0, 0xf8, 0x17, 0xf9, 0x0f, 0xf5, 0xfa, 0x1a,
+    0xef, 0xec, 0x09, 0xeb, 0x1a, 0x0c, 0x17, 0x09, 0x11, 0xe9, 0x1a, 0xf7,
+    0x29, 0xf9, 0xfd, 0x07, 0x01, 0xdd, 0x0a, 0xec, 0x22, 0x15, 0x03, 0xfd,
+    0xe2, 0xd2, 0x15, 0xec, 0x4d, 0xd7, 0xfc, 0xf6, 0x0b, 0xcc, 0x0e, 0x04,
+    0x03, 0xf7, 0xfb, 0xfb, 0x0d, 0xeb, 0x19, 0x07, 0xf4, 0xf4, 0xe5, 0xde,
+    0x22, 0x07, 0xea, 0xf7, 0xeb, 0x23, 0xc8, 0xee, 0x03, 0x04, 0x0f, 0x19,
+    0xc3, 0xf8, 0x06, 0xd0, 0xf7, 0xfe, 0x0e, 0xe7, 0x0a, 0x02, 0xb0, 0xb8,
+    0x00, 0xfb, 0x18, 0x0f, 0x22, 0xf7, 0xe9, 0xdc, 0x09, 0x15, 0x23, 0x0d,
+    0x22, 0x13, 0xe2, 0xed, 0xeb, 0x18, 0x20, 0x0b, 0x12, 0xfc, 0x02, 0xf1,
+    0xdb, 0x0e, 0xe1, 0x04, 0xdb, 0x0f, 0xf3, 0x1a, 0x06, 0xef, 0xdb, 0xdc,
+    0xdd, 0xfb, 0x00, 0x2a, 0x20, 0xfd, 0xc1, 0xe3, 0xef, 0x01, 0x14, 0xf2,
+    0x14, 0x00, 0x0f, 0x28, 0xd9, 0xff, 0xf4, 0xdc, 0x09, 0xfa, 0x1c, 0x08,
+    0xd1, 0x03, 0x0a, 0xf4, 0xe4, 0xdb, 0x20, 0x30, 0xea, 0x06, 0x11, 0xe2,
+    0x26, 0xf7, 0x16, 0x22, 0xf9, 0x07, 0x02, 0xf5, 0xf6, 0xfb, 0x1d, 0x0c,
+    0x16, 0x0a, 0x07, 0xf9, 0x11, 0xde, 0x20, 0x08, 0x19, 0x04, 0x0a, 0x0b,
+    0x0c, 0xf7, 0xf4, 0xfc, 0x41, 0xf1, 0xf8, 0x16, 0x09, 0xdc, 0x0e, 0x1a,
+    0x2b, 0x1f, 0xe7, 0xfe, 0x01, 0xe0, 0xfd, 0xe2, 0x34, 0xec, 0xf3, 0xf5,
+    0x03, 0xec, 0x0b, 0xfb, 0x04, 0xf6, 0xdd, 0xfd, 0x06, 0x14, 0x0d, 0xfa,
+    0xfc, 0xf1, 0x0a, 0xca, 0x01, 0xec, 0x0e, 0x0e, 0xec, 0xd7, 0xee, 0xd4,
+    0xf2, 0xfe, 0x16, 0xfa, 0xbd, 0x0d, 0xef, 0xcb, 0xc4, 0xee, 0xed, 0x13,
+    0x10, 0x19, 0xf8, 0xb1, 0xf1, 0xe3, 0x00, 0xf3, 0x0c, 0xf6, 0xde, 0xc6,
+    0x15, 0x27, 0x14, 0x29, 0x15, 0xf6, 0xf4, 0xf5, 0xe7, 0x00, 0x0b, 0x2f,
+    0x0c, 0xef, 0x03, 0x0f, 0xfd, 0x08, 0xf3, 0xf9, 0xf9, 0x05, 0x0d, 0x34,
+    0x15, 0x1b, 0xc8, 0xd1, 0xf2, 0x1b, 0x0a, 0x22, 0x12, 0x11, 0xe9, 0xf4,
+    0xe1, 0x2a, 0x20, 0x03, 0xf2, 0xf8, 0x14, 0x0b, 0xd0, 0xf4, 0x0e, 0xbf,
+    0xc6, 0xd8, 0x04, 0x05, 0xf8, 0xf4, 0x04, 0xc9, 0xea, 0xfd, 0xf7, 0xfa,
+    0xe3, 0x1b, 0x11, 0xde, 0x0c, 0x11, 0x25, 0x29, 0xe5, 0x02, 0xef, 0xef,
+    0x02, 0xfa, 0x1a, 0x21, 0x19, 0x09, 0x08, 0x05, 0x04, 0xe5, 0xfa, 0xed,
+    0x2d, 0x26, 0xfa, 0x17, 0xf6, 0xe8, 0x12, 0x12, 0x31, 0xfc, 0x0d, 0x00,
+    0xf7, 0xeb, 0x19, 0xf1, 0x2a, 0x06, 0x14, 0xec, 0x08, 0xd3, 0x21, 0x07,
+    0x32, 0xe3, 0x02, 0x0b, 0xfb, 0xd8, 0x27, 0x07, 0x05, 0xe6, 0xf5, 0xf5,
+    0x0a, 0xf7, 0x2c, 0x2a, 0xd8, 0x1b, 0xda, 0xf7, 0xea, 0xf6, 0xf9, 0x0e,
+    0xf8, 0x0c, 0x05, 0xc7, 0xd6, 0x06, 0x12, 0xe3, 0xe1, 0xe1, 0xd8, 0xdb,
+    0xc6, 0xf8, 0xe6, 0xfa, 0x0c, 0x07, 0xf8, 0xe7, 0xe1, 0x0f, 0x00, 0xf3,
+    0x03, 0xf0, 0xde, 0xcc, 0xf5, 0xfc, 0xef, 0x1e, 0x16, 0x13, 0xfb, 0xf4,
+    0x03, 0xe9, 0xfc, 0xfa, 0x15, 0xe8, 0x15, 0x09, 0xf1, 0x0d, 0xdb, 0x0a,
+    0xe8, 0x09, 0xf5, 0x1a, 0x04, 0xf8, 0xd8, 0xd4, 0x04, 0xee, 0x25, 0x29,
+    0x09, 0xfe, 0xf3, 0xf5, 0xd4, 0x0a, 0x15, 0x19, 0xf5, 0x12, 0xfe, 0x04,
+    0xe7, 0x01, 0xeb, 0xde, 0xbe, 0xfe, 0x09, 0x12, 0xdf, 0x13, 0xe0, 0xef,
+    0xc7, 0xff, 0x03, 0x08, 0xfe, 0xf2, 0x19, 0xe0, 0xe4, 0x0c, 0x22, 0x1e,
+    0x05, 0xf7, 0x16, 0xf2, 0xf9, 0x06, 0x17, 0xf6, 0x0c, 0x1e, 0x23, 0x08,
+    0xfe, 0xdc, 0xfd, 0x17, 0x11, 0xdf, 0xf5, 0x0f, 0x01, 0x03, 0x08, 0xee,
+    0x1b, 0x02, 0x0b, 0x1b, 0x0c, 0x16, 0x1a, 0x00, 0x0f, 0x26, 0x14, 0xf8,
+    0xf4, 0xf3, 0x19, 0x16, 0x22, 0x0a, 0xd0, 0xf9, 0xf1, 0x05, 0x2b, 0x1e,
+    0x1e, 0xef, 0xf5, 0x06, 0x05, 0xe7, 0x3f, 0x2a, 0x06, 0xf0, 0x15, 0x14,
+    0x13, 0x20, 0x1b, 0xde, 0x10, 0x05, 0x33, 0xf8, 0x08, 0x04, 0x17, 0x0d,
+    0x0f, 0xf6, 0x01, 0xed, 0x28, 0x25, 0x1c, 0x13, 0xfb, 0xea, 0xfb, 0xf3,
+    0x1c, 0xf9, 0x1f, 0xf0, 0xfb, 0x17, 0xf8, 0xff, 0x10, 0xf7, 0x0b, 0x24,
+    0x04, 0x00, 0x0d, 0x0c, 0xf7, 0x0a, 0x16, 0x13, 0xf8, 0x05, 0x0a, 0xf1,
+    0xf5, 0xee, 0xf8, 0x14, 0x0e, 0xed, 0xfe, 0x1b, 0xfe, 0x17, 0x13, 0x10,
+    0x12, 0x21, 0x1c, 0xfa, 0xe5, 0x0b, 0x08, 0x0c, 0x10, 0x1b, 0x03, 0xef,
+    0x0d, 0x05, 0x0a, 0xf0, 0x04, 0x11, 0x15, 0x00, 0xfd, 0xef, 0x02, 0x18,
+    0xf4, 0x09, 0xfa, 0xf6, 0x02, 0xf7, 0xfd, 0x13, 0xef, 0x13, 0xf7, 0xf9,
+    0x17, 0x0f, 0xfa, 0xf8, 0x15, 0xff, 0x04, 0xef, 0xf0, 0x15, 0xfa, 0xfe,
+    0xf0, 0xf4, 0xed, 0x06, 0x1c, 0x02, 0xfb, 0xf7, 0x05, 0xfb, 0x0c, 0xef,
+    0xf4, 0xf0, 0xf6, 0xec, 0x17, 0xf3, 0xf5, 0xef, 0x02, 0xfd, 0xe5, 0x21,
+    0x0c, 0xf1, 0x1e, 0x08, 0xf1, 0x0b, 0xf7, 0x09, 0x1d, 0xf2, 0xf9, 0xf2,
+    0xfb, 0x0e, 0xed, 0xf8, 0xfa, 0xdd, 0xf0, 0xfd, 0xdb, 0x1a, 0xf4, 0xef,
+    0x0c, 0x06, 0x0f, 0xdf, 0xe2, 0x06, 0x06, 0xee, 0xfa, 0x0d, 0x17, 0xfc,
+    0xf9, 0x15, 0x1a, 0xe4, 0xfb, 0x0c, 0x1a, 0xfc, 0x1b, 0x04, 0x07, 0x20,
+    0xff, 0x09, 0x0f, 0xf2, 0x26, 0x19, 0x1f, 0x0d, 0x02, 0x16, 0x03, 0x03,
+    0xfd, 0x05, 0x01, 0x1b, 0x0a, 0x11, 0xfa, 0x21, 0x13, 0xfb, 0x0c, 0x05,
+    0xf3, 0xdd, 0xe4, 0xdc, 0x22, 0x1b, 0x15, 0x14, 0x0e, 0xe8, 0x00, 0xf7,
+    0xf8, 0xf4, 0x0b, 0x0b, 0xfd, 0x21, 0xe3, 0x0f, 0xe1, 0x22, 0x01, 0x21,
+    0x0b, 0x1f, 0x09, 0x10, 0xe2, 0x18, 0x11, 0x0e, 0xed, 0x01, 0x14, 0x12,
+    0xfd, 0x11, 0xf6, 0xe9, 0x20, 0xe1, 0xf5, 0x1b, 0x27, 0x22, 0xfa, 0xf7,
+    0xfe, 0x13, 0xf6, 0xdc, 0x06, 0x0d, 0xf4, 0x05, 0x20, 0x0d, 0x0b, 0xe4,
+    0x15, 0x28, 0x0c, 0x00, 0xf5, 0x07, 0x0c, 0x0a, 0x06, 0x0e, 0xf3, 0xfb,
+    0xfe, 0x04, 0x08, 0xf4, 0xef, 0x03, 0xe4, 0xeb, 0x06, 0xee, 0xed, 0xdb,
+    0xeb, 0x1d, 0xf4, 0xfa, 0x0c, 0xfc, 0xfe, 0x11, 0xf7, 0xf8, 0xf5, 0xef,
+    0xe7, 0xfc, 0x1b, 0xdc, 0x17, 0xfd, 0xfe, 0x00, 0xea, 0xf4, 0xf1, 0xf7,
+    0x0f, 0x21, 0x04, 0xfd, 0x0d, 0x0c, 0x0a, 0x14, 0xfd, 0x19, 0x09, 0x01,
+    0xfd, 0xe2, 0x0c, 0x0c, 0xe0, 0x25, 0xfb, 0xff, 0x0d, 0x18, 0xf6, 0x0b,
+    0x19, 0x12, 0x10, 0x09, 0x0b, 0x06, 0x12, 0x1c, 0x10, 0x03, 0x13, 0x0a,
+    0x05, 0x0f, 0x09, 0x01, 0x21, 0xe4, 0x01, 0x26, 0xf9, 0xf4, 0x05, 0x19,
+    0x00, 0xff, 0x0b, 0xff, 0x16, 0x09, 0xe7, 0xee, 0xed, 0xf5, 0x0f, 0x2f,
+    0xee, 0x19, 0x03, 0x0a, 0x10, 0xee, 0xf7, 0x2e, 0xf4, 0x08, 0xf7, 0xee,
+    0x07, 0x00, 0xfc, 0x0e, 0xf0, 0x12, 0x08, 0x05, 0xed, 0x11, 0xfc, 0xfb,
+    0xf7, 0x25, 0xf1, 0x05, 0x0c, 0xf9, 0xfa, 0x03, 0x0c, 0x16, 0x04, 0x25,
+    0xf8, 0xe7, 0xfc, 0x11, 0x0d, 0x19, 0xd8, 0xfa, 0x0b, 0x06, 0xfd, 0xef,
+    0x13, 0xf6, 0xff, 0x0e, 0xf9, 0x04, 0xf1, 0xdc, 0xfb, 0xe1, 0xf6, 0x0b,
+    0x15, 0x07, 0xf7, 0x02, 0x0e, 0xf1, 0xfd, 0xe3, 0xeb, 0x07, 0xf1, 0xef,
+    0x03, 0xfe, 0xf8, 0x07, 0x10, 0xf7, 0x00, 0xf9, 0xf2, 0x0e, 0xf9, 0xf2,
+    0x1d, 0xf5, 0xd8, 0xff, 0xe6, 0x18, 0x2a, 0x1b, 0x03, 0x16, 0xfe, 0xf4,
+    0xf5, 0xfd, 0x04, 0x01, 0xfe, 0xfe, 0x07, 0xfc, 0x0e, 0xfa, 0x15, 0xeb,
+    0x02, 0x15, 0xea, 0xfd, 0x04, 0xe5, 0xfe, 0xed, 0xfe, 0x1a, 0x09, 0x2a,
+    0x1b, 0xdf, 0xfb, 0xf8, 0xf1, 0x04, 0x1a, 0x34, 0x07, 0xf9, 0x0d, 0xf5,
+    0xef, 0xec, 0x10, 0x1a, 0x0b, 0x0f, 0x13, 0xfe, 0x10, 0x22, 0x1e, 0x02,
+    0xe6, 0xf7, 0x11, 0xfa, 0x11, 0xfc, 0x1b, 0x21, 0x12, 0xf4, 0x18, 0x16,
+    0x29, 0xe4, 0x0c, 0x2e, 0x12, 0x07, 0x20, 0xf6, 0x1d, 0xf4, 0x12, 0x33,
+    0xf4, 0xee, 0xfe, 0x05, 0x06, 0xfb, 0x13, 0x0c, 0x0e, 0xf0, 0x00, 0xf8,
+    0xee, 0xf3, 0x17, 0x00, 0xf7, 0xfb, 0xfc, 0x0f, 0xf4, 0xd5, 0x0a, 0xed,
+    0xeb, 0xf5, 0xe9, 0xef, 0xd8, 0xf0, 0xf8, 0xe2, 0x19, 0xf7, 0xf8, 0x0a,
+    0x0b, 0x09, 0xfa, 0xe7, 0x0f, 0xfc, 0xe8, 0x02, 0x00, 0x1a, 0xfe, 0xfd,
+    0x1b, 0xe6, 0xef, 0x0f, 0xe3, 0x10, 0xf1, 0xe2, 0x0b, 0x0e, 0x06, 0x29,
+    0x00, 0x01, 0xf3, 0x00, 0x11, 0x04, 0xf2, 0xf7, 0xea, 0xf8, 0xe0, 0x09,
+    0x0e, 0x13, 0xf4, 0x00, 0x09, 0xfa, 0xf5, 0x0c, 0xff, 0x18, 0x08, 0x0d,
+    0xfa, 0xde, 0xfa, 0x03, 0xf2, 0xf3, 0x1b, 0xeb, 0x06, 0xea, 0xfb, 0xff,
+    0x0d, 0xf5, 0x10, 0x17, 0xf8, 0xe8, 0xf1, 0xf1, 0xf5, 0x00, 0x03, 0x0a,
+    0x09, 0x0a, 0xf3, 0xfb, 0x33, 0x26, 0xe7, 0x17, 0xe3, 0xfa, 0x1f, 0x24,
+    0xfc, 0x07, 0x02, 0xe2, 0xeb, 0x08, 0x2c, 0xf8, 0x02, 0x1f, 0x04, 0xeb,
+    0x0b, 0x04, 0x17, 0xf7, 0xff, 0x1c, 0xed, 0x00, 0x3f, 0xd5, 0x17, 0x1d,
+    0xfe, 0x03, 0xf1, 0x1c, 0x17, 0xec, 0x0e, 0x54, 0xee, 0xf5, 0x25, 0xfa,
+    0x08, 0xee, 0x13, 0x32, 0x0e, 0xd8, 0x09, 0x0f, 0xee, 0xe5, 0x06, 0x10,
+    0xf4, 0xfb, 0xe4, 0xfb, 0x09, 0xde, 0x13, 0xff, 0x02, 0xf9, 0xec, 0x0a,
+    0x00, 0xe9, 0xfd, 0xdc, 0x06, 0x04, 0xdb, 0x06, 0x01, 0xf8, 0x09, 0xe2,
+    0x0c, 0x14, 0xda, 0xfe, 0x20, 0xe3, 0x09, 0xda, 0x14, 0x12, 0xe1, 0x05,
+    0xff, 0xf3, 0x00, 0x08, 0xfb, 0xf1, 0xfd, 0xf3, 0x04, 0xfa, 0x08, 0xff,
+    0x01, 0x1d, 0x0b, 0xfd, 0x0a, 0xf4, 0xfb, 0xfc, 0xf9, 0x19, 0xed, 0xfc,
+    0xf2, 0x06, 0xe7, 0x02, 0xf6, 0x0c, 0xfc, 0xfb, 0x01, 0x0c, 0xeb, 0x1b,
+    0xff, 0xff, 0x08, 0x1d, 0xf7, 0xe8, 0xfc, 0xf4, 0x0c, 0xfa, 0xf1, 0xee,
+    0xed, 0xdd, 0xfc, 0x06, 0x05, 0xdc, 0x1a, 0xfc, 0xf9, 0x07, 0xdf, 0x1b,
+    0x14, 0x0c, 0xfc, 0x01, 0x16, 0xe1, 0xed, 0x09, 0x34, 0xee, 0xe4, 0x1c,
+    0x1b, 0xfc, 0x3b, 0x03, 0x15, 0xf2, 0xeb, 0x14, 0x00, 0xdd, 0x24, 0x04,
+    0xf1, 0xed, 0xfd, 0xe6, 0x32, 0xf9, 0x24, 0x04, 0x0e, 0x22, 0x03, 0x14,
+    0x2f, 0xf5, 0x1a, 0x37, 0xf4, 0x18, 0x03, 0x0f, 0x4b, 0xe6, 0x0d, 0x5c,
+    0xf7, 0x1f, 0x1c, 0xe6, 0x23, 0x0c, 0x15, 0x4e, 0xe0, 0x05, 0x1c, 0xec,
+    0xff, 0x04, 0x13, 0x15, 0xee, 0x07, 0xec, 0x0c, 0xdd, 0xf8, 0x0e, 0x03,
+    0x0c, 0x1f, 0xe8, 0x0e, 0xf5, 0xec, 0xfc, 0xe2, 0xe8, 0xfb, 0xf6, 0x00,
+    0xe5, 0xea, 0xf3, 0xd3, 0xf5, 0xfd, 0xd2, 0xfd, 0x1b, 0xed, 0x09, 0xd1,
+    0x23, 0xfa, 0xd4, 0xf7, 0xe9, 0xf0, 0x0a, 0xd6, 0x14, 0x03, 0xe6, 0x10,
+    0xf4, 0x18, 0xfe, 0xe1, 0x0b, 0x25, 0xf5, 0xfc, 0xe9, 0xf2, 0xe9, 0xf4,
+    0x0d, 0xf5, 0x00, 0xf9, 0x17, 0x02, 0xfd, 0x03, 0x04, 0xf8, 0xf5, 0x14,
+    0xe3, 0xd3, 0xeb, 0xe7, 0x09, 0xf3, 0x14, 0x17, 0xee, 0xe6, 0xf6, 0xff,
+    0x11, 0x26, 0xf4, 0xf7, 0x02, 0xfa, 0x05, 0x08, 0x16, 0xff, 0x0d, 0xf7,
+    0xf1, 0xf7, 0xe6, 0xfb, 0x04, 0x04, 0x07, 0x02, 0x04, 0x09, 0xf5, 0xfc,
+    0x5f, 0xd6, 0xe7, 0x2a, 0x23, 0xf4, 0x1b, 0x06, 0x01, 0xea, 0xe7, 0x05,
+    0x25, 0xe3, 0x25, 0x07, 0xea, 0xfb, 0xfb, 0x09, 0x25, 0xde, 0x37, 0x04,
+    0x07, 0xe5, 0xff, 0x14, 0x2f, 0x0a, 0x30, 0x23, 0x04, 0xf0, 0x23, 0xfe,
+    0x1c, 0xd2, 0x2b, 0x55, 0x01, 0xe5, 0x26, 0xfe, 0x14, 0xed, 0x24, 0x46,
+    0xe6, 0xee, 0x0f, 0xfd, 0xed, 0xef, 0x0e, 0x1e, 0x05, 0x0a, 0x12, 0xff,
+    0xe4, 0xf5, 0x0c, 0xed, 0xfd, 0xea, 0x0d, 0x13, 0x1a, 0xe5, 0xfc, 0xc2,
+    0xef, 0x0a, 0xe2, 0x0f, 0xfe, 0xff, 0x0c, 0xf0, 0xff, 0xdf, 0xea, 0x00,
+    0xf6, 0xe1, 0x04, 0xd8, 0x26, 0x20, 0xdc, 0xf4, 0x19, 0x06, 0xe8, 0xd2,
+    0x10, 0x04, 0xf1, 0x02, 0x0c, 0x06, 0xf0, 0xf0, 0x04, 0x1f, 0xf4, 0xf5,
+    0xed, 0xf1, 0xfa, 0xf1, 0x04, 0x02, 0xf8, 0xfb, 0x04, 0xf1, 0xe5, 0xe4,
+    0x0a, 0xf0, 0xfe, 0xef, 0x1c, 0xe3, 0xeb, 0xf3, 0x00, 0x17, 0x01, 0x13,
+    0x19, 0xda, 0xf8, 0x06, 0xde, 0x11, 0xea, 0xf7, 0xf4, 0xef, 0x03, 0x04,
+    0x0b, 0xe8, 0x08, 0x0e, 0xe2, 0xee, 0xde, 0x06, 0x0e, 0x29, 0xfb, 0xfa,
+    0x00, 0x02, 0xec, 0x1b, 0x52, 0xff, 0xde, 0x3a, 0x2f, 0x13, 0x30, 0xe9,
+    0xff, 0xf6, 0xe7, 0x15, 0x1d, 0xd9, 0x3c, 0x0f, 0xe6, 0x14, 0xee, 0x13,
+    0x1f, 0xe7, 0x33, 0x08, 0xfc, 0x06, 0x0c, 0x08, 0x19, 0xd9, 0x2b, 0x1f,
+    0x07, 0x10, 0x24, 0x16, 0x29, 0xfc, 0x31, 0x4d, 0xf0, 0xd9, 0x3f, 0xf2,
+    0x20, 0xe2, 0x25, 0x49, 0xe5, 0xec, 0x0a, 0xf5, 0xf2, 0xd9, 0x22, 0x1f,
+    0xed, 0x22, 0x02, 0x0a, 0x16, 0x08, 0xf7, 0xfb, 0x0e, 0xfb, 0xfb, 0x1d,
+    0xf3, 0x1c, 0xf6, 0xe1, 0xcf, 0x19, 0xf4, 0x0f, 0xee, 0xf9, 0x04, 0xd1,
+    0xf9, 0xe2, 0xda, 0xf1, 0x24, 0xf5, 0x07, 0xdf, 0x1d, 0xf9, 0xdb, 0x18,
+    0x0b, 0xea, 0x08, 0xca, 0xf2, 0xfa, 0xec, 0x04, 0x0e, 0x17, 0xed, 0xf1,
+    0x06, 0x15, 0xfc, 0xfd, 0x08, 0xfa, 0xe3, 0xe4, 0x0a, 0xfc, 0xee, 0x08,
+    0xf5, 0x09, 0xef, 0xee, 0x06, 0xef, 0xe1, 0x19, 0x07, 0xe8, 0xe6, 0xdf,
+    0xea, 0x0d, 0xf1, 0x16, 0xee, 0xed, 0xf8, 0x09, 0xfa, 0xfb, 0x0c, 0xf8,
+    0xeb, 0xda, 0x00, 0xfc, 0x04, 0xfe, 0xf5, 0xff, 0xf6, 0xe1, 0x0c, 0x0a,
+    0x13, 0x0d, 0xf6, 0xf5, 0x15, 0x07, 0xca, 0xec, 0x50, 0x0e, 0xd0, 0x26,
+    0x4c, 0xf8, 0x23, 0xeb, 0xff, 0x08, 0xe3, 0x11, 0x2c, 0xf9, 0x2a, 0xf1,
+    0xe9, 0x0b, 0xe9, 0x0f, 0x15, 0xec, 0x33, 0x11, 0x0c, 0x0d, 0x01, 0x01,
+    0x32, 0xe3, 0x41, 0x27, 0x11, 0x02, 0x2e, 0x07, 0x09, 0xe3, 0x22, 0x4d,
+    0xf1, 0x05, 0x27, 0x03, 0x25, 0xf5, 0x2c, 0x3b, 0xf4, 0x00, 0x16, 0x0b,
+    0xec, 0xfe, 0x17, 0x0d, 0xff, 0xe7, 0xfe, 0x24, 0x06, 0xee, 0xf0, 0xe9,
+    0xfa, 0x1c, 0xf2, 0x19, 0x08, 0xfa, 0xff, 0xd2, 0x01, 0x02, 0xea, 0x05,
+    0xf2, 0xf4, 0x0b, 0xd2, 0xf9, 0x0d, 0xcd, 0x0d, 0x12, 0xf2, 0x0e, 0xe1,
+    0x1f, 0x00, 0xe7, 0x14, 0x04, 0xff, 0x09, 0xdb, 0xfc, 0xd9, 0x06, 0xf9,
+    0xeb, 0x01, 0xef, 0xfa, 0xfb, 0xf5, 0xfc, 0xfb, 0x14, 0xe2, 0xf9, 0xf5,
+    0x02, 0xfd, 0xfc, 0x01, 0xf7, 0xf3, 0x00, 0xec, 0xe7, 0xf2, 0x00, 0xf1,
+    0x11, 0xec, 0xf0, 0xe9, 0x11, 0x0a, 0x07, 0x04, 0x01, 0xee, 0xfb, 0xf2,
+    0x14, 0x01, 0x12, 0xf0, 0xf2, 0xf1, 0xf0, 0xfb, 0x08, 0x03, 0xf8, 0x01,
+    0xe8, 0xf9, 0x17, 0x26, 0x0f, 0xea, 0xf7, 0xf8, 0x1e, 0xfe, 0xf2, 0xf8,
+    0x3f, 0x00, 0xd4, 0x1c, 0x53, 0xfe, 0x1e, 0x0f, 0xef, 0xdd, 0xed, 0x10,
+    0x19, 0xe7, 0x34, 0x0e, 0xde, 0xdf, 0xfa, 0x0e, 0x29, 0xe3, 0x16, 0x09,
+    0x06, 0x12, 0xeb, 0xf9, 0x32, 0xe0, 0x1a, 0x1d, 0xf3, 0xed, 0x10, 0x07,
+    0x31, 0xf2, 0x12, 0x52, 0xeb, 0xf7, 0x1e, 0xf7, 0x1a, 0xdc, 0x3e, 0x33,
+    0xe3, 0xfb, 0x1f, 0x0b, 0x08, 0xfe, 0x13, 0x1a, 0xf4, 0xf8, 0xfe, 0x08,
+    0xfc, 0xe9, 0xfe, 0xeb, 0xe6, 0xf6, 0x02, 0x18, 0x02, 0xe8, 0xfb, 0xf3,
+    0x01, 0x08, 0xd7, 0x13, 0x04, 0xe6, 0x02, 0xe6, 0xd7, 0x01, 0xd4, 0xf0,
+    0x0e, 0x05, 0x18, 0xe5, 0x08, 0xe5, 0xd2, 0x16, 0x12, 0xfe, 0x0e, 0xd3,
+    0xfc, 0x1f, 0xe9, 0xf8, 0x11, 0x06, 0xf3, 0xd5, 0xf8, 0xff, 0xf0, 0x04,
+    0x0a, 0xd9, 0xf8, 0xfd, 0xf5, 0x12, 0xff, 0x06, 0x1b, 0xe6, 0xfe, 0xfe,
+    0xde, 0xee, 0xf6, 0x18, 0xf1, 0xf8, 0x06, 0xf3, 0x02, 0xea, 0x04, 0x14,
+    0xfc, 0xee, 0xe6, 0x09, 0xf9, 0xee, 0xe3, 0xe7, 0xfc, 0xd9, 0xef, 0xfc,
+    0x0a, 0x0c, 0x03, 0xf6, 0xe2, 0x11, 0x0f, 0x19, 0x18, 0x10, 0xef, 0xe5,
+    0x22, 0xf5, 0xe5, 0xe9, 0x4b, 0xf7, 0xdb, 0x0c, 0x4f, 0xde, 0x22, 0x16,
+    0x09, 0x16, 0xd1, 0xf8, 0x19, 0xe0, 0x24, 0xfe, 0xb8, 0xfb, 0xe5, 0x12,
+    0x1c, 0xe3, 0x22, 0x09, 0x05, 0x29, 0xf7, 0x10, 0x31, 0xe1, 0x33, 0x3f,
+    0xfd, 0xed, 0x04, 0x03, 0x2e, 0xed, 0x30, 0x36, 0xee, 0x16, 0x2f, 0xf5,
+    0x1b, 0xdc, 0x3a, 0x56, 0xe5, 0xef, 0x26, 0xff, 0x03, 0xd7, 0x31, 0x16,
+    0xef, 0xf1, 0x08, 0x13, 0x01, 0x02, 0x03, 0xf1, 0xf2, 0x08, 0xff, 0x05,
+    0x12, 0xf2, 0xee, 0xda, 0xed, 0xec, 0xea, 0xf7, 0x0c, 0xf1, 0x09, 0xe6,
+    0xe6, 0x00, 0xcc, 0x10, 0x0d, 0x0d, 0x20, 0xf4, 0x18, 0x23, 0xec, 0xf9,
+    0x00, 0xe4, 0x07, 0xd4, 0xfb, 0x16, 0xd2, 0x01, 0xe6, 0x01, 0x06, 0xf0,
+    0xfe, 0x03, 0xf3, 0x09, 0x01, 0x0d, 0x05, 0xf7, 0xd4, 0x02, 0xfb, 0xfb,
+    0x08, 0xf0, 0x1f, 0xf3, 0xfe, 0xeb, 0x02, 0x0e, 0x1b, 0x0f, 0x04, 0xf5,
+    0xf0, 0x1f, 0x14, 0xf7, 0x06, 0xdc, 0xf9, 0xe9, 0x01, 0xff, 0x08, 0xf2,
+    0x06, 0xff, 0xff, 0xf3, 0x05, 0x1a, 0xfc, 0xfa, 0xeb, 0xfb, 0xfa, 0x12,
+    0x20, 0xf6, 0xe0, 0xe8, 0x1c, 0xfa, 0xd6, 0x0d, 0x2c, 0x04, 0xe1, 0x09,
+    0x3b, 0xd3, 0x2a, 0xee, 0xf7, 0xed, 0xf1, 0xf7, 0x0d, 0xf0, 0x32, 0x0f,
+    0xc9, 0x0e, 0x00, 0x10, 0x24, 0xfb, 0x31, 0xf0, 0xf4, 0xdd, 0xf5, 0x04,
+    0x25, 0xc7, 0x27, 0x25, 0x16, 0x11, 0x2e, 0x09, 0x30, 0xd1, 0x2c, 0x34,
+    0xe6, 0xf0, 0x21, 0xf5, 0x21, 0xc8, 0x40, 0x39, 0xde, 0xf0, 0x12, 0xf3,
+    0x10, 0xe8, 0x1f, 0x18, 0xfa, 0xea, 0x07, 0x11, 0xdf, 0xed, 0xfa, 0xf0,
+    0x07, 0xef, 0xf3, 0x05, 0x10, 0xe5, 0xf3, 0xe9, 0xe9, 0xe8, 0xd6, 0x01,
+    0xf9, 0x05, 0x0b, 0xee, 0xf9, 0x12, 0xe3, 0x05, 0xfd, 0xe6, 0x16, 0xe2,
+    0x1b, 0x12, 0xc5, 0x00, 0xfd, 0x02, 0x04, 0xd2, 0xff, 0xec, 0xf6, 0xfd,
+    0x00, 0xe4, 0xf7, 0xf3, 0xeb, 0xfa, 0xf8, 0x0d, 0x03, 0xfa, 0xfe, 0xe4,
+    0xdb, 0xe3, 0x06, 0xff, 0xf4, 0xf2, 0x1b, 0xf1, 0xf7, 0x02, 0x01, 0x04,
+    0x13, 0xe5, 0x0c, 0x05, 0xf7, 0x0a, 0x03, 0x03, 0x0b, 0x03, 0xee, 0xf7,
+    0x21, 0x20, 0xff, 0xf3, 0x09, 0xe5, 0xff, 0xec, 0x17, 0x00, 0x06, 0x14,
+    0xeb, 0xf2, 0x18, 0x16, 0x1f, 0xec, 0xee, 0xe1, 0x1e, 0x03, 0xfa, 0xfe,
+    0x28, 0x03, 0xc9, 0x0c, 0x3f, 0xd8, 0x30, 0x16, 0x03, 0xf8, 0xe9, 0xfb,
+    0x28, 0xe1, 0x36, 0x0a, 0xdf, 0xe5, 0xeb, 0x08, 0x1c, 0xcd, 0x29, 0xf2,
+    0xfc, 0x0a, 0xed, 0x01, 0x29, 0xf1, 0x20, 0x13, 0x04, 0xec, 0x17, 0x0a,
+    0x35, 0xc3, 0x1a, 0x46, 0xe0, 0xd7, 0x3c, 0x09, 0x28, 0xd1, 0x22, 0x20,
+    0xd5, 0xfa, 0x28, 0xfa, 0xff, 0xea, 0x1d, 0x23, 0xe0, 0x07, 0x07, 0x0f,
+    0xf1, 0xf1, 0x08, 0xf0, 0xf8, 0xff, 0x05, 0x1b, 0x05, 0xfa, 0xf0, 0xfb,
+    0xe3, 0xe4, 0xcc, 0x1a, 0xf9, 0x09, 0x06, 0xee, 0xf4, 0x03, 0xd0, 0x14,
+    0xf4, 0xff, 0x1d, 0xe8, 0x11, 0xf4, 0xd1, 0xf4, 0x04, 0x0b, 0xfb, 0xdc,
+    0x0a, 0x0c, 0xeb, 0xed, 0x06, 0xf3, 0x04, 0xdd, 0xdf, 0xf9, 0xea, 0xfc,
+    0xf5, 0xf2, 0xfb, 0xea, 0xe3, 0x03, 0xee, 0x0e, 0xff, 0xdb, 0x1e, 0x04,
+    0xf7, 0x1a, 0x04, 0x0c, 0x0d, 0xda, 0x04, 0xe9, 0xff, 0x04, 0x00, 0x0c,
+    0xf9, 0xe4, 0xfb, 0xf6, 0x14, 0xde, 0x1b, 0x00, 0x0b, 0xfe, 0x06, 0xf8,
+    0x0f, 0xdc, 0x01, 0xef, 0xef, 0x0d, 0xf8, 0xf1, 0x0f, 0xf9, 0xf9, 0xdf,
+    0x0d, 0xe4, 0xd9, 0xf9, 0x2b, 0xee, 0xe8, 0x09, 0x40, 0xf9, 0x2f, 0x0a,
+    0xfa, 0xe8, 0xe9, 0x01, 0x0e, 0xe7, 0x23, 0x0a, 0xd0, 0x19, 0xd3, 0x0e,
+    0x04, 0xda, 0x2b, 0x0f, 0xe7, 0xe6, 0xf3, 0xfb, 0x2c, 0xd3, 0x36, 0x19,
+    0x0e, 0xfe, 0x03, 0x1a, 0x2e, 0xd0, 0x23, 0x32, 0xf1, 0xe1, 0x2a, 0x09,
+    0x1b, 0xf6, 0x29, 0x3e, 0xce, 0x15, 0x0a, 0xe8, 0xec, 0xdf, 0x44, 0x28,
+    0xd9, 0xfd, 0xfa, 0x09, 0xff, 0xe7, 0x08, 0xec, 0xf4, 0xef, 0x01, 0x19,
+    0x11, 0xf3, 0xeb, 0xeb, 0xed, 0x1a, 0xdd, 0x15, 0x0f, 0x07, 0xfe, 0xeb,
+    0xff, 0xd6, 0xd5, 0x04, 0xf5, 0x07, 0x10, 0xe6, 0x0c, 0xe4, 0xda, 0x0c,
+    0x08, 0xee, 0x06, 0xd8, 0xf8, 0xf1, 0xe0, 0x01, 0x08, 0xfe, 0xf9, 0xf3,
+    0xdf, 0x03, 0xe6, 0xf4, 0x0a, 0xff, 0xf2, 0xe0, 0xd9, 0xeb, 0x01, 0x10,
+    0x02, 0xfc, 0x0d, 0x14, 0xea, 0xf8, 0x03, 0x18, 0xf3, 0x09, 0xfc, 0x0c,
+    0x0b, 0x1f, 0xf5, 0x05, 0xf7, 0xf9, 0x00, 0xfd, 0x04, 0xfc, 0x16, 0x07,
+    0x00, 0xdf, 0xf9, 0xfa, 0x0c, 0xfb, 0xf4, 0xf7, 0xf0, 0xeb, 0x07, 0x17,
+    0x20, 0xfb, 0xf0, 0xec, 0x04, 0x00, 0xf8, 0xf2, 0x2d, 0xf9, 0xd9, 0x0b,
+    0x55, 0xec, 0x33, 0x26, 0xf8, 0x0a, 0xf2, 0x0b, 0x25, 0xdf, 0x29, 0x05,
+    0xd1, 0x14, 0xe2, 0xf2, 0x12, 0xdd, 0x28, 0xfc, 0xec, 0x08, 0xfd, 0x02,
+    0x3a, 0xe6, 0x29, 0x25, 0x0d, 0x10, 0x09, 0x0a, 0x32, 0xf5, 0x17, 0x2d,
+    0xea, 0xfb, 0x35, 0xfc, 0x28, 0xd0, 0x29, 0x2f, 0xcb, 0x06, 0x0f, 0x04,
+    0xf2, 0xf3, 0x34, 0x1c, 0xf4, 0x08, 0x05, 0xfc, 0xfd, 0xed, 0x0f, 0xf8,
+    0xe9, 0xf0, 0x09, 0x16, 0xfe, 0x02, 0xff, 0xd4, 0xea, 0x0a, 0xeb, 0x0c,
+    0xf8, 0xf4, 0x09, 0xf4, 0xf2, 0x07, 0xd9, 0x0b, 0xfd, 0xe4, 0x1a, 0xef,
+    0x14, 0x08, 0xd8, 0xfc, 0xf5, 0xe1, 0x03, 0xcf, 0xf1, 0x11, 0xdb, 0x15,
+    0x07, 0x10, 0xf8, 0xfc, 0xe2, 0xf1, 0xf5, 0xde, 0xff, 0xe7, 0x01, 0xea,
+    0xee, 0xe9, 0x02, 0x0a, 0x18, 0xec, 0xfe, 0xf9, 0x09, 0xf3, 0x0e, 0x02,
+    0xf1, 0xfc, 0xf9, 0x16, 0x05, 0x07, 0x09, 0x0d, 0x0e, 0xf7, 0x04, 0xed,
+    0x04, 0xdb, 0x04, 0x04, 0xf6, 0xdc, 0xee, 0xec, 0xf5, 0xfe, 0xf4, 0x02,
+    0xe4, 0x0b, 0xe0, 0x17, 0x0a, 0xe0, 0xf7, 0xdc, 0x11, 0xd6, 0xfe, 0xfa,
+    0x35, 0xde, 0xe6, 0x06, 0x44, 0xf9, 0x35, 0x0a, 0xfb, 0xff, 0xec, 0xfb,
+    0x16, 0xd9, 0x23, 0x0f, 0xd4, 0xef, 0xdf, 0x06, 0x0b, 0xd9, 0x25, 0xff,
+    0xf8, 0xeb, 0xf4, 0x0a, 0x20, 0xe5, 0x22, 0x1c, 0xeb, 0xf4, 0x0d, 0x0c,
+    0x19, 0xe1, 0x1e, 0x31, 0xe9, 0xfb, 0x20, 0xf0, 0x23, 0xfe, 0x35, 0x28,
+    0xb4, 0x06, 0x28, 0xe7, 0xfb, 0xe9, 0x2a, 0x1a, 0xef, 0x15, 0x0c, 0xed,
+    0xf1, 0x04, 0x0e, 0x0a, 0xff, 0x16, 0x01, 0x04, 0x17, 0xea, 0xec, 0xdc,
+    0xf4, 0xf7, 0x04, 0x16, 0x1f, 0x0a, 0x11, 0xef, 0x12, 0xdf, 0xd9, 0x0c,
+    0xf5, 0x10, 0x02, 0xf3, 0x10, 0x03, 0xd3, 0xf5, 0x0b, 0x02, 0x00, 0xcb,
+    0xf6, 0x23, 0xf6, 0xf1, 0x1f, 0xf9, 0xfc, 0xf0, 0xf6, 0xfe, 0xfa, 0xf8,
+    0xf9, 0xf4, 0xfb, 0x0a, 0xd6, 0x29, 0x09, 0x02, 0x00, 0xfc, 0xfc, 0xee,
+    0xf5, 0x05, 0xfb, 0x1e, 0xf1, 0xf1, 0xf3, 0x02, 0xec, 0x1c, 0x0c, 0x0e,
+    0x0b, 0x04, 0xf6, 0xe7, 0x14, 0x08, 0x27, 0x01, 0xfe, 0xe5, 0xe7, 0x01,
+    0x1b, 0xf0, 0xf6, 0xff, 0xf4, 0xe7, 0xee, 0x18, 0x0d, 0x08, 0xf8, 0xd6,
+    0x07, 0xf4, 0x08, 0xff, 0x1d, 0x13, 0xe7, 0x0b, 0x42, 0xef, 0x28, 0x00,
+    0xf9, 0xf0, 0xf3, 0x00, 0x15, 0xfd, 0x1a, 0x22, 0xc1, 0xf5, 0xe0, 0xf8,
+    0x09, 0xe6, 0x0e, 0x05, 0xf9, 0xf6, 0x01, 0x01, 0x13, 0xdc, 0x1f, 0x0d,
+    0xfb, 0x04, 0x08, 0x0b, 0x15, 0xdb, 0x28, 0x34, 0xed, 0x0b, 0x3a, 0xed,
+    0x16, 0xe3, 0x39, 0x32, 0xc4, 0x0b, 0x20, 0xe7, 0xf7, 0x02, 0x35, 0x24,
+    0xfc, 0xe8, 0x1c, 0xf8, 0xf1, 0xfa, 0x0c, 0x1d, 0xf2, 0x05, 0xff, 0x12,
+    0x0f, 0x01, 0xec, 0xea, 0xf0, 0x03, 0xe7, 0x15, 0xfd, 0x05, 0x08, 0xe0,
+    0x1b, 0xf8, 0xe1, 0x1e, 0xed, 0xdc, 0x11, 0xeb, 0xfd, 0x1a, 0xeb, 0x09,
+    0xf9, 0xf3, 0x00, 0xe8, 0xe6, 0x08, 0xf7, 0xde, 0x1e, 0x00, 0x00, 0x00,
+    0xe4, 0x09, 0xf2, 0xf8, 0xe7, 0xf2, 0x0d, 0xfa, 0xe2, 0x0f, 0x04, 0x08,
+    0xf2, 0x13, 0xf8, 0xf9, 0xf1, 0xff, 0x03, 0x11, 0x12, 0xe9, 0xf4, 0x13,
+    0x07, 0x0c, 0x13, 0x2b, 0xf7, 0xdd, 0xf9, 0xe9, 0xfa, 0xdb, 0x1d, 0xf6,
+    0xf6, 0xf9, 0xe4, 0xf6, 0x0d, 0xeb, 0x0d, 0x08, 0xe7, 0xe7, 0xf2, 0x03,
+    0x1d, 0xd9, 0xd8, 0xe4, 0xf7, 0xea, 0xdc, 0xdc, 0x26, 0x02, 0xee, 0xfa,
+    0x38, 0xfc, 0x1a, 0xef, 0xda, 0xf1, 0xdf, 0x0b, 0x1a, 0xe0, 0x16, 0x16,
+    0xdc, 0x04, 0xfa, 0xf7, 0xee, 0x02, 0x25, 0x02, 0xf5, 0xfb, 0x08, 0xf6,
+    0x11, 0xf5, 0x12, 0x08, 0xf4, 0xe3, 0x1b, 0xf5, 0x3a, 0xdc, 0x20, 0x2e,
+    0xe0, 0xf5, 0x30, 0xe4, 0x09, 0xf8, 0x3c, 0x45, 0xd3, 0x08, 0x23, 0xd8,
+    0x09, 0xe4, 0x35, 0x30, 0xe4, 0xfe, 0x07, 0xf6, 0x05, 0x01, 0x05, 0xff,
+    0xf6, 0x0d, 0x02, 0xfd, 0x03, 0x05, 0x0d, 0x00, 0xf5, 0xd6, 0xcf, 0x19,
+    0x06, 0xee, 0x0d, 0xf2, 0x01, 0x18, 0xef, 0x12, 0x04, 0x02, 0x21, 0xd9,
+    0x02, 0x0d, 0xeb, 0xe9, 0x13, 0x08, 0x15, 0xf0, 0xee, 0x03, 0xec, 0x06,
+    0x17, 0xed, 0x00, 0x1a, 0xee, 0xf2, 0xfc, 0x09, 0xec, 0xf8, 0xf8, 0x18,
+    0xf4, 0x13, 0x04, 0xf6, 0x02, 0xf0, 0xfc, 0xfe, 0xe3, 0x01, 0x0a, 0x1c,
+    0x1b, 0xec, 0x0e, 0x01, 0xfb, 0x08, 0x11, 0xf5, 0x00, 0x14, 0xe6, 0x12,
+    0x07, 0xf4, 0x15, 0x07, 0xfc, 0xfb, 0xf5, 0xf1, 0x01, 0x21, 0x01, 0xe9,
+    0xe8, 0xef, 0xdb, 0xdf, 0x1f, 0x0a, 0xdd, 0xd1, 0x16, 0x04, 0xfd, 0xe1,
+    0x24, 0xf0, 0xec, 0xf4, 0x38, 0xe1, 0x16, 0xfd, 0xe0, 0xec, 0xe7, 0x0c,
+    0x2a, 0x04, 0x0c, 0x17, 0xdc, 0xe8, 0xf2, 0x03, 0xec, 0xfd, 0x19, 0xfe,
+    0xf3, 0xf0, 0xf3, 0xfb, 0x18, 0xdf, 0x1c, 0x00, 0x09, 0xf4, 0x18, 0x0b,
+    0x1f, 0xf6, 0x34, 0x22, 0xf4, 0x22, 0x45, 0xeb, 0x23, 0xcf, 0x32, 0x34,
+    0xf2, 0xf9, 0x29, 0xd4, 0xf7, 0x0b, 0x38, 0x2a, 0x09, 0xe6, 0x05, 0x01,
+    0x0b, 0xfe, 0x17, 0xfb, 0x00, 0xeb, 0x08, 0xfd, 0x0c, 0x02, 0x1d, 0xea,
+    0xfa, 0x0b, 0xeb, 0x09, 0xfe, 0xfe, 0x10, 0xe0, 0xf6, 0x06, 0xf0, 0x15,
+    0xf3, 0x09, 0x11, 0xe4, 0xf9, 0x07, 0xe1, 0xed, 0x17, 0x05, 0x0c, 0xe1,
+    0xdb, 0xf2, 0xf8, 0xea, 0x22, 0xe9, 0x02, 0x00, 0xfd, 0xe7, 0xf2, 0xf8,
+    0xf9, 0xfc, 0xfa, 0xe8, 0xe8, 0xeb, 0xe9, 0x0d, 0x04, 0xf8, 0xf8, 0xf7,
+    0xf8, 0x0d, 0x03, 0x0c, 0x13, 0xf2, 0x0f, 0xf9, 0xe6, 0xfd, 0x0f, 0x19,
+    0x08, 0xf7, 0xfa, 0x01, 0xf3, 0x12, 0x1e, 0x05, 0x0a, 0x09, 0xfd, 0x0b,
+    0x07, 0x08, 0x02, 0xfc, 0xd6, 0xe8, 0x14, 0x01, 0x13, 0x19, 0xef, 0xda,
+    0x0e, 0x0a, 0x07, 0xef, 0x34, 0xe0, 0x05, 0x1e, 0x4e, 0xe9, 0x19, 0xff,
+    0xe1, 0x04, 0xfb, 0x0e, 0x11, 0x05, 0x1f, 0x15, 0xd4, 0xec, 0xf9, 0xe7,
+    0xf9, 0xfc, 0x25, 0xff, 0x06, 0xf2, 0x01, 0xf6, 0x2a, 0x17, 0x24, 0x11,
+    0xf3, 0x1a, 0x1f, 0xfb, 0x32, 0xeb, 0x33, 0x2f, 0x00, 0x08, 0x2c, 0xf0,
+    0x26, 0xf4, 0x25, 0x36, 0xd9, 0xf1, 0x1a, 0xd5, 0xec, 0xf9, 0x32, 0x27,
+    0xfc, 0xf4, 0xf0, 0xe3, 0xfa, 0x0c, 0x16, 0x17, 0xfa, 0xf9, 0xe5, 0x1f,
+    0x1f, 0xfa, 0xff, 0xfd, 0x0d, 0x02, 0xe9, 0x0e, 0xf0, 0x12, 0x09, 0xda,
+    0x02, 0xea, 0xe5, 0x0a, 0xff, 0x03, 0x13, 0xf0, 0x0a, 0xf9, 0xe9, 0xff,
+    0x10, 0xfc, 0x1a, 0xf3, 0xf7, 0x0f, 0xf4, 0xfa, 0xf4, 0x05, 0x10, 0x0a,
+    0xdd, 0x09, 0xf7, 0xf0, 0xe5, 0x07, 0x07, 0xfa, 0x02, 0xd7, 0xf8, 0xf7,
+    0x01, 0xfb, 0x0e, 0xf8, 0x07, 0x0f, 0xfe, 0x03, 0x12, 0x05, 0x09, 0x13,
+    0xf8, 0xdc, 0xfd, 0x27, 0x0f, 0xec, 0xf7, 0x07, 0x00, 0xfc, 0x12, 0xf8,
+    0xfb, 0xea, 0xe4, 0xe9, 0xe9, 0xe0, 0xff, 0xdc, 0xd6, 0xeb, 0xf2, 0xf7,
+    0x0d, 0x1b, 0xe9, 0xc4, 0x06, 0x00, 0xfd, 0x04, 0x46, 0xf9, 0xe9, 0x13,
+    0x2d, 0x0c, 0x1f, 0xf8, 0xd3, 0x0c, 0x14, 0x11, 0x05, 0xe5, 0x27, 0x08,
+    0xc5, 0xef, 0xdf, 0xdd, 0x04, 0xf8, 0x11, 0x10, 0xf0, 0xe7, 0xfb, 0x03,
+    0x3c, 0xe7, 0x14, 0x0c, 0xf4, 0xf6, 0x1b, 0x0a, 0x23, 0xf2, 0x2d, 0x1a,
+    0x08, 0xff, 0x32, 0xe7, 0x1a, 0x05, 0x2b, 0x34, 0xf1, 0x0a, 0x00, 0xe8,
+    0x02, 0xdf, 0x2c, 0x2a, 0x03, 0xe6, 0xfc, 0xef, 0xfc, 0xe4, 0x03, 0x01,
+    0x03, 0xee, 0xe9, 0x15, 0x05, 0x03, 0x13, 0x11, 0x0e, 0xee, 0xf5, 0x22,
+    0x1b, 0x0e, 0xfd, 0xf3, 0x0a, 0x02, 0xdd, 0x20, 0xeb, 0x06, 0xf8, 0xe2,
+    0x06, 0x0e, 0xde, 0x0d, 0xf9, 0x16, 0x1c, 0x0c, 0xe0, 0xf0, 0xec, 0x0c,
+    0x0f, 0xf2, 0x27, 0x1d, 0xde, 0xe6, 0xf0, 0xf9, 0xf0, 0x02, 0x0a, 0x07,
+    0x06, 0xf9, 0x0f, 0xfa, 0xf0, 0xee, 0xf1, 0xf7, 0xff, 0x02, 0x0b, 0x0d,
+    0x1b, 0xee, 0xf6, 0x05, 0xff, 0x1c, 0x17, 0x04, 0x05, 0x17, 0x00, 0xff,
+    0x0d, 0xf3, 0x23, 0x10, 0xfd, 0x05, 0xfb, 0xea, 0x03, 0x10, 0x07, 0xd7,
+    0xf7, 0xff, 0xf3, 0xf1, 0x17, 0xed, 0xd3, 0xcb, 0x14, 0x1c, 0xf5, 0x03,
+    0x47, 0xf6, 0xf7, 0xf2, 0x3e, 0xf2, 0x22, 0xf4, 0xed, 0xfc, 0xee, 0x0b,
+    0xf4, 0xf1, 0x25, 0x10, 0xd0, 0xf6, 0x00, 0xef, 0x10, 0xfc, 0x15, 0xe5,
+    0xdb, 0xf3, 0xea, 0x10, 0x22, 0xf2, 0x2b, 0x11, 0xf9, 0x0a, 0xfc, 0xf5,
+    0x53, 0x16, 0x25, 0x43, 0xe0, 0x0e, 0x13, 0xfc, 0x2d, 0xe2, 0x55, 0x65,
+    0xf4, 0x08, 0x01, 0xdf, 0x0a, 0x00, 0x49, 0x1c, 0xfe, 0xdf, 0xef, 0xf2,
+    0xf9, 0xf6, 0xfd, 0xff, 0xf3, 0x02, 0xf6, 0x14, 0x0b, 0xe8, 0x09, 0xfc,
+    0xfc, 0xe2, 0xe5, 0x11, 0x03, 0x09, 0xfb, 0x06, 0x10, 0x1a, 0xf3, 0x0d,
+    0xfa, 0x0a, 0xd5, 0xf5, 0x1a, 0x11, 0xf2, 0xfc, 0x1f, 0xfe, 0x0e, 0xe4,
+    0xef, 0xd7, 0xee, 0x06, 0x1e, 0x04, 0x12, 0x28, 0xf7, 0x0e, 0x06, 0xf8,
+    0xee, 0xf0, 0x1a, 0x01, 0xf7, 0xfd, 0x03, 0x11, 0x19, 0x10, 0x04, 0xfb,
+    0xd7, 0xfa, 0x16, 0x06, 0x07, 0x23, 0xfa, 0x14, 0x11, 0xf1, 0x12, 0x10,
+    0x04, 0xe1, 0xee, 0xf7, 0x21, 0x0e, 0x0a, 0x0a, 0xf8, 0x07, 0x0a, 0xee,
+    0x03, 0x1f, 0xfa, 0xc4, 0xec, 0x12, 0x01, 0x1e, 0xfd, 0xf1, 0xe8, 0xcc,
+    0xf4, 0x17, 0xff, 0xdd, 0x45, 0x10, 0xee, 0xfa, 0x3d, 0xe7, 0x27, 0xdd,
+    0xd7, 0xf9, 0xf4, 0xf6, 0x06, 0xf8, 0x1e, 0x13, 0xe7, 0xe2, 0xf1, 0xe3,
+    0xf3, 0xf7, 0x18, 0x12, 0xe4, 0x0a, 0xdb, 0xff, 0xff, 0xfe, 0x20, 0x09,
+    0x00, 0xf7, 0x23, 0xf6, 0x2d, 0x14, 0x26, 0x28, 0xe5, 0xff, 0x0f, 0xe3,
+    0x1d, 0xe8, 0x56, 0x43, 0xe7, 0xfb, 0xf9, 0xe6, 0xe9, 0xe2, 0x19, 0x19,
+    0x08, 0xfa, 0xf3, 0xe5, 0x23, 0x07, 0x0f, 0xf8, 0xf8, 0xf3, 0xfc, 0x11,
+    0x2a, 0x05, 0xf4, 0xf1, 0xfa, 0xfb, 0xf1, 0x1e, 0x13, 0x0f, 0xf9, 0xf5,
+    0xfa, 0x09, 0xf9, 0x03, 0xf0, 0xf0, 0xe7, 0xec, 0xf1, 0x0c, 0xe6, 0xee,
+    0xf6, 0x20, 0x0f, 0xe9, 0x00, 0xf4, 0xfe, 0xf0, 0x13, 0x0a, 0x17, 0x13,
+    0xee, 0x13, 0xfb, 0xff, 0xf8, 0xfd, 0xf4, 0xe2, 0xe8, 0x06, 0xfc, 0x14,
+    0x03, 0x17, 0x00, 0x03, 0xe6, 0xfd, 0xf2, 0x12, 0x12, 0x20, 0xeb, 0x10,
+    0x02, 0xf7, 0x13, 0x0d, 0x11, 0xfd, 0xde, 0xf5, 0x07, 0xf3, 0x04, 0xff,
+    0x06, 0x05, 0xfb, 0xea, 0xf0, 0x0a, 0x00, 0xb5, 0xe8, 0x1a, 0x03, 0xfe,
+    0x0d, 0x1a, 0xe7, 0xc0, 0xd6, 0xdc, 0xf6, 0xf8, 0x39, 0xf5, 0xd5, 0xf8,
+    0x22, 0xfa, 0x22, 0x05, 0xd0, 0xf4, 0x2d, 0xfc, 0x00, 0x0a, 0x1b, 0xfc,
+    0xe6, 0x09, 0x14, 0xfa, 0x00, 0x1d, 0x1a, 0xfd, 0xf3, 0x18, 0xfc, 0xeb,
+    0x15, 0xf5, 0x0e, 0x0a, 0xf3, 0xf1, 0x1b, 0x05, 0x14, 0x03, 0x2d, 0x27,
+    0xfb, 0x18, 0x22, 0xef, 0xf6, 0x06, 0x28, 0x2b, 0xde, 0xec, 0xef, 0xe8,
+    0xd3, 0xfe, 0x17, 0x12, 0x01, 0x13, 0x05, 0xf7, 0x00, 0xde, 0xf3, 0xe5,
+    0x03, 0xfb, 0x07, 0x0b, 0xfd, 0xdc, 0xdf, 0x03, 0x0c, 0x00, 0xfa, 0x06,
+    0x0e, 0x02, 0x05, 0xfa, 0xfd, 0xed, 0x09, 0x0c, 0xfd, 0xfb, 0x0c, 0xf0,
+    0xe4, 0x04, 0xd6, 0xf3, 0x09, 0x0a, 0xf9, 0xf8, 0xe2, 0xef, 0xdf, 0xf0,
+    0xf8, 0x03, 0x0f, 0x20, 0xf4, 0xe3, 0xf8, 0x02, 0xe2, 0xe5, 0x25, 0x0f,
+    0xeb, 0xf8, 0xe9, 0xfd, 0x04, 0x0c, 0x0c, 0xfe, 0x01, 0x08, 0xfc, 0xfc,
+    0x1b, 0x01, 0xe5, 0x13, 0xf9, 0xe8, 0x07, 0x20, 0xfe, 0x06, 0xec, 0xfe,
+    0x09, 0xef, 0x14, 0x04, 0x0b, 0xf5, 0xe7, 0xff, 0x0a, 0x02, 0x09, 0xe9,
+    0xc4, 0x16, 0x0d, 0xe7, 0x15, 0x14, 0xf1, 0xd0, 0xec, 0xe7, 0xf0, 0xf0,
+    0x33, 0x05, 0xda, 0xf2, 0x0b, 0x08, 0x38, 0x01, 0x07, 0xfd, 0xd8, 0x06,
+    0xd9, 0xf0, 0x16, 0x1f, 0xff, 0xf7, 0xe0, 0xd8, 0xf3, 0xf7, 0x12, 0x08,
+    0x0e, 0x05, 0xf6, 0x03, 0xef, 0x1b, 0x12, 0xf4, 0xe8, 0x0f, 0x02, 0xfd,
+    0xf2, 0x16, 0x26, 0x22, 0xe0, 0x07, 0xf7, 0xe6, 0xeb, 0x16, 0x22, 0x1a,
+    0x0b, 0x01, 0xf5, 0xea, 0xd2, 0x22, 0x0f, 0x13, 0x15, 0x08, 0xf0, 0xfb,
+    0xed, 0x11, 0xf3, 0xe9, 0xff, 0xde, 0x0a, 0x18, 0x0f, 0x02, 0xfb, 0xf9,
+    0xfb, 0xe8, 0x12, 0x18, 0x01, 0xf4, 0xf6, 0xf8, 0xf0, 0x1f, 0x24, 0x15,
+    0xf5, 0x00, 0x1c, 0xf9, 0x01, 0x0a, 0x11, 0xd5, 0x01, 0x12, 0x02, 0xec,
+    0xfd, 0x07, 0xf2, 0xea, 0xf9, 0xff, 0xf7, 0xfb, 0x15, 0xec, 0xe5, 0x01,
+    0xeb, 0x05, 0xf9, 0x10, 0xfe, 0x28, 0xe5, 0x0a, 0xeb, 0x1b, 0x0e, 0xf9,
+    0xde, 0x02, 0x15, 0x0a, 0xff, 0xfe, 0x11, 0x24, 0x03, 0xf8, 0x00, 0x08,
+    0xfd, 0x0e, 0xeb, 0xf3, 0xf6, 0xf7, 0x14, 0x0e, 0xfc, 0xf5, 0xde, 0xf5,
+    0x00, 0x00, 0x00, 0x00, 0x8e, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00, 0xfa, 0xfd, 0xff, 0xff,
+    0xa2, 0xff, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xfc, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x54, 0x4f, 0x43, 0x4f,
+    0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x24, 0xfb, 0xff, 0xff,
+    0x68, 0x01, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00,
+    0x90, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xce, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x03, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x1a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00,
+    0x07, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xc4, 0xfc, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+    0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x10, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x38, 0x00, 0x00, 0x00,
+    0x2c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x07, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+    0x1a, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x07, 0x00, 0x14, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x31, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x34, 0x04, 0x00, 0x00, 0xcc, 0x03, 0x00, 0x00,
+    0x4c, 0x03, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00,
+    0x20, 0x02, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00,
+    0x70, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x09, 0x44, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf4, 0xfb, 0xff, 0xff,
+    0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3b, 0x0e, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x62, 0x65,
+    0x6c, 0x73, 0x5f, 0x73, 0x6f, 0x66, 0x74, 0x6d, 0x61, 0x78, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00,
+    0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xb4, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x11, 0x1e, 0x23, 0x3a, 0x9e, 0xa1, 0x15, 0x39,
+    0x23, 0x69, 0x45, 0x3a, 0x09, 0xe4, 0xe4, 0x39, 0x65, 0xd7, 0x13, 0x3a,
+    0xe0, 0xb2, 0xfd, 0x39, 0x1b, 0xc1, 0x53, 0x3a, 0xc2, 0x50, 0x2d, 0x3a,
+    0x12, 0x00, 0x00, 0x00, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5f, 0x77, 0x65,
+    0x69, 0x67, 0x68, 0x74, 0x73, 0x2f, 0x72, 0x65, 0x61, 0x64, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3a, 0xfd, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x09, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2c, 0xfd, 0xff, 0xff,
+    0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xb5, 0xfa, 0xfa, 0x39, 0x1f, 0x00, 0x00, 0x00, 0x66, 0x69, 0x6e, 0x61,
+    0x6c, 0x5f, 0x66, 0x63, 0x5f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x73,
+    0x2f, 0x72, 0x65, 0x61, 0x64, 0x2f, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70,
+    0x6f, 0x73, 0x65, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xa0, 0x0f, 0x00, 0x00, 0xa2, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+    0x58, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x74, 0xfe, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xdd, 0xbb, 0x3d,
+    0x01, 0x00, 0x00, 0x00, 0x32, 0xa3, 0x25, 0x41, 0x01, 0x00, 0x00, 0x00,
+    0xf6, 0xa0, 0x50, 0xc1, 0x05, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x5f,
+    0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x0e, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
+    0x2c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x5f,
+    0x32, 0x2f, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x4a, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+    0x5c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x50, 0xd0, 0x3d,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xcf, 0x41, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x52, 0x65, 0x73, 0x68,
+    0x61, 0x70, 0x65, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xc2, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+    0x58, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x01, 0x00, 0x00, 0x00, 0x50, 0x50, 0xd0, 0x3d, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xcf, 0x41, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x5f,
+    0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xa8, 0x07, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+    0x60, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x01, 0x00, 0x00, 0x00, 0x3a, 0x6a, 0xac, 0x3d, 0x01, 0x00, 0x00, 0x00,
+    0xd0, 0xbd, 0xab, 0x41, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x52, 0x65, 0x6c, 0x75, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x02, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff,
+    0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x96, 0x08, 0x29, 0x38, 0x0b, 0x00, 0x00, 0x00,
+    0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x69, 0x61, 0x73, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+    0x18, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa0, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x9a, 0xbb, 0x84, 0x38, 0x83, 0x84, 0x73, 0x37, 0x5b, 0xa3, 0xa0, 0x38,
+    0x16, 0x41, 0x3a, 0x38, 0xc7, 0x9a, 0x70, 0x38, 0xed, 0x70, 0x4e, 0x38,
+    0x54, 0x4f, 0xac, 0x38, 0xfd, 0x07, 0x8d, 0x38, 0x0b, 0x00, 0x00, 0x00,
+    0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x5f, 0x62, 0x69, 0x61, 0x73, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x4c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xe6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x19,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x05, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0a, 0x00, 0x0e, 0x00, 0x07, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x07, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x03, 0x00, 0x00, 0x00};
+
+const unsigned int g_kws_model_requant_data_len = 19120;
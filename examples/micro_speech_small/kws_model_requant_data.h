@@ -0,0 +1,16 @@
+// Generated by tools/precompute_requantization.py from
+//   examples/micro_speech_small/kws_model_data.cc.
+// Do not edit; regenerate with:
+//   python3 tools/precompute_requantization.py \
+//      examples/micro_speech_small/kws_model_data.cc --array-name \
+//      g_kws_model_requant_data --header \
+//      examples/micro_speech_small/kws_model_requant_data.h --source \
+//      examples/micro_speech_small/kws_model_requant_data.cc
+
+#ifndef EXAMPLES_MICRO_SPEECH_SMALL_KWS_MODEL_REQUANT_DATA_H_
+#define EXAMPLES_MICRO_SPEECH_SMALL_KWS_MODEL_REQUANT_DATA_H_
+
+extern const unsigned char g_kws_model_requant_data[];
+extern const unsigned int g_kws_model_requant_data_len;
+
+#endif  // EXAMPLES_MICRO_SPEECH_SMALL_KWS_MODEL_REQUANT_DATA_H_
@@ -0,0 +1,108 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <cstdint>
+#include <cstring>
+
+#include "kws_model_requant_data.h"
+#include "model_config.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+// The model with requantization tables precomputed by
+// tools/precompute_requantization.py must produce the same bytes as the
+// model it was generated from, with less arena.
+
+namespace {
+
+using KwsOpResolver =
+    tflite::MicroMutableOpResolver<ModelConfig::kOpResolverSize>;
+
+constexpr int kRandomInputs = 8;
+
+alignas(16) uint8_t requant_arena[ModelConfig::kTensorArenaSize];
+
+void FillRandom(int8_t* buffer, size_t size, uint32_t seed) {
+  uint32_t state = seed;
+  for (size_t i = 0; i < size; ++i) {
+    state = state * 1664525u + 1013904223u;
+    buffer[i] = static_cast<int8_t>(state >> 24);
+  }
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(RequantizedModelNeedsLessArena) {
+  KwsOpResolver op_resolver;
+  ModelConfig::InitializeOpResolver(op_resolver);
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(ModelConfig::GetModelData()), op_resolver,
+      tensor_arena, ModelConfig::kTensorArenaSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+
+  tflite::MicroInterpreter requant_interpreter(
+      tflite::GetModel(g_kws_model_requant_data), op_resolver, requant_arena,
+      ModelConfig::kTensorArenaSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, requant_interpreter.AllocateTensors());
+
+  // The multipliers and shifts of the 8 depthwise channels are read from the
+  // model instead of the arena.
+  TF_LITE_MICRO_EXPECT_EQ(interpreter.arena_used_bytes() - 2 * 8 * 4,
+                          requant_interpreter.arena_used_bytes());
+}
+
+TF_LITE_MICRO_TEST(RequantizedModelMatchesOriginalOutputs) {
+  KwsOpResolver op_resolver;
+  ModelConfig::InitializeOpResolver(op_resolver);
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(ModelConfig::GetModelData()), op_resolver,
+      tensor_arena, ModelConfig::kTensorArenaSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  tflite::MicroInterpreter requant_interpreter(
+      tflite::GetModel(g_kws_model_requant_data), op_resolver, requant_arena,
+      ModelConfig::kTensorArenaSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, requant_interpreter.AllocateTensors());
+
+  TfLiteTensor* input = interpreter.input(0);
+  TfLiteTensor* requant_input = requant_interpreter.input(0);
+  const TfLiteTensor* output = interpreter.output(0);
+  const TfLiteTensor* requant_output = requant_interpreter.output(0);
+  TF_LITE_MICRO_EXPECT_EQ(input->bytes, requant_input->bytes);
+  TF_LITE_MICRO_EXPECT_EQ(output->bytes, requant_output->bytes);
+  // Constant inputs at both ends of the range, then random ones.
+  for (int run = 0; run < kRandomInputs + 2; ++run) {
+    if (run == 0) {
+      memset(input->data.int8, -128, input->bytes);
+    } else if (run == 1) {
+      memset(input->data.int8, 127, input->bytes);
+    } else {
+      FillRandom(input->data.int8, input->bytes, run);
+    }
+    memcpy(requant_input->data.int8, input->data.int8, input->bytes);
+
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, requant_interpreter.Invoke());
+    for (size_t j = 0; j < output->bytes; ++j) {
+      TF_LITE_MICRO_EXPECT_EQ(output->data.int8[j],
+                              requant_output->data.int8[j]);
+    }
+  }
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -35,6 +35,11 @@ namespace ModelConfig
         return "KWS Small";
     }
 
+    constexpr const char *GetBenchmarkName()
+    {
+        return "micro_speech_small";
+    }
+
     template <unsigned int N>
     inline void InitializeOpResolver(tflite::MicroMutableOpResolver<N> &resolver)
     {
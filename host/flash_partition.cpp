@@ -0,0 +1,141 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host implementation of FlashPartition. Flash is a file, mapped read-only
+// and shared, so that writes through pwrite() show up in the mapping as
+// they would in the XIP window. Erased bytes are 0xFF and programming ANDs
+// the new bytes into the old ones, as NOR flash does, so code that forgets
+// to erase fails here too.
+
+#include "tensorflow/lite/micro/flash_partition.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace tflite {
+namespace {
+
+bool WriteAll(int fd, const uint8_t* data, size_t size, off_t at) {
+  while (size > 0) {
+    const ssize_t written = pwrite(fd, data, size, at);
+    if (written <= 0) {
+      return false;
+    }
+    data += written;
+    size -= written;
+    at += written;
+  }
+  return true;
+}
+
+// Writes erased flash over [at, at + size) of the file.
+bool WriteErased(int fd, off_t at, size_t size) {
+  uint8_t erased[FlashPartition::kSectorSize];
+  std::memset(erased, 0xFF, sizeof(erased));
+  while (size > 0) {
+    const size_t chunk = size < sizeof(erased) ? size : sizeof(erased);
+    if (!WriteAll(fd, erased, chunk, at)) {
+      return false;
+    }
+    at += chunk;
+    size -= chunk;
+  }
+  return true;
+}
+
+}  // namespace
+
+FlashPartition::~FlashPartition() { Close(); }
+
+bool FlashPartition::Open(uint32_t offset, uint32_t size,
+                          const char* host_path) {
+  Close();
+  if (host_path == nullptr || offset % kSectorSize != 0 ||
+      size % kSectorSize != 0 || size == 0) {
+    MicroPrintf("FlashPartition: invalid partition");
+    return false;
+  }
+  const int fd = open(host_path, O_RDWR | O_CREAT, 0644);
+  if (fd < 0) {
+    MicroPrintf("FlashPartition: cannot open %s", host_path);
+    return false;
+  }
+  struct stat st;
+  const off_t end = static_cast<off_t>(offset) + size;
+  if (fstat(fd, &st) != 0 ||
+      (st.st_size < end && !WriteErased(fd, st.st_size, end - st.st_size))) {
+    MicroPrintf("FlashPartition: cannot grow %s", host_path);
+    close(fd);
+    return false;
+  }
+  // The whole file up to the partition end is mapped, so that the mapping
+  // offset need not be a multiple of the host's page size.
+  void* mapping = mmap(nullptr, end, PROT_READ, MAP_SHARED, fd, 0);
+  if (mapping == MAP_FAILED) {
+    MicroPrintf("FlashPartition: cannot map %s", host_path);
+    close(fd);
+    return false;
+  }
+  data_ = static_cast<const uint8_t*>(mapping) + offset;
+  offset_ = offset;
+  size_ = size;
+  host_fd_ = fd;
+  return true;
+}
+
+void FlashPartition::Close() {
+  if (data_ != nullptr) {
+    munmap(const_cast<uint8_t*>(data_ - offset_), offset_ + size_);
+    close(host_fd_);
+  }
+  data_ = nullptr;
+  offset_ = 0;
+  size_ = 0;
+  host_fd_ = -1;
+}
+
+bool FlashPartition::Erase(uint32_t offset, uint32_t size) {
+  if (data_ == nullptr || offset % kSectorSize != 0 ||
+      size % kSectorSize != 0 || offset > size_ || size > size_ - offset) {
+    return false;
+  }
+  return WriteErased(host_fd_, offset_ + offset, size);
+}
+
+bool FlashPartition::Program(uint32_t offset, const uint8_t* data,
+                             uint32_t size) {
+  if (data_ == nullptr || offset % kPageSize != 0 || size % kPageSize != 0 ||
+      offset > size_ || size > size_ - offset) {
+    return false;
+  }
+  uint8_t page[kPageSize];
+  for (uint32_t done = 0; done < size; done += kPageSize) {
+    for (uint32_t i = 0; i < kPageSize; ++i) {
+      page[i] = data_[offset + done + i] & data[done + i];
+    }
+    if (!WriteAll(host_fd_, page, kPageSize, offset_ + offset + done)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace tflite
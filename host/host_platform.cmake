@@ -0,0 +1,85 @@
+# Native host build of pico-tflmicro.
+#
+# Provides stand-ins for the Pico SDK targets and functions that the library,
+# examples and tests use, so that the same CMake tree builds x86/arm64 Linux
+# executables. Timing comes from clock_gettime(), log output goes to stdout and
+# the second core is a std::thread. Included from the top-level CMakeLists.txt
+# when PICO_TFLMICRO_HOST is ON.
+
+set(PICO_TFLMICRO_HOST_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+find_package(Threads REQUIRED)
+
+# The SDK builds C++ without exceptions or RTTI, and TFLM depends on it: its
+# classes make operator delete private, which placement new would otherwise
+# need for exception cleanup.
+add_compile_options(
+  $<$<COMPILE_LANGUAGE:CXX>:-fno-exceptions>
+  $<$<COMPILE_LANGUAGE:CXX>:-fno-rtti>
+)
+
+# Like the SDK, the pico_* libraries are INTERFACE targets that compile their
+# sources into whatever links them.
+add_library(pico_stdlib INTERFACE)
+target_include_directories(pico_stdlib INTERFACE
+  ${PICO_TFLMICRO_HOST_DIR}/include
+)
+target_compile_definitions(pico_stdlib INTERFACE
+  TFLM_HOST_PLATFORM=1
+)
+target_sources(pico_stdlib INTERFACE
+  ${PICO_TFLMICRO_HOST_DIR}/pico_stdlib.cpp
+)
+
+add_library(pico_multicore INTERFACE)
+target_sources(pico_multicore INTERFACE
+  ${PICO_TFLMICRO_HOST_DIR}/pico_multicore.cpp
+)
+target_link_libraries(pico_multicore INTERFACE
+  pico_stdlib
+  Threads::Threads
+)
+
+# Only the board-side examples drive the PWM; on the host this is empty.
+add_library(hardware_pwm INTERFACE)
+target_link_libraries(hardware_pwm INTERFACE pico_stdlib)
+
+# FlashPartition has its own host implementation, backed by a file, and
+# WeightCopyEngine one that copies with memcpy().
+add_library(hardware_dma INTERFACE)
+add_library(hardware_flash INTERFACE)
+add_library(pico_flash INTERFACE)
+
+# USB/UART stdio selection has no meaning on the host.
+function(pico_enable_stdio_usb target enable)
+endfunction()
+
+function(pico_enable_stdio_uart target enable)
+endfunction()
+
+# There are no .uf2/.bin images to produce. Test executables are registered
+# with CTest instead so that `ctest` runs the whole suite.
+function(pico_add_extra_outputs target)
+  if (target MATCHES "_test$")
+    add_test(NAME ${target} COMMAND ${target})
+  endif()
+endfunction()
+
+# Swaps the RP2 implementations of the TFLM platform hooks in `target` for the
+# host ones in this directory.
+function(pico_tflmicro_use_host_platform target)
+  get_target_property(sources ${target} SOURCES)
+  list(REMOVE_ITEM sources
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tensorflow/lite/micro/flash_partition.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tensorflow/lite/micro/micro_time.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tensorflow/lite/micro/system_setup.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tensorflow/lite/micro/weight_copy_engine.cpp
+  )
+  list(APPEND sources
+    ${PICO_TFLMICRO_HOST_DIR}/flash_partition.cpp
+    ${PICO_TFLMICRO_HOST_DIR}/micro_time.cpp
+    ${PICO_TFLMICRO_HOST_DIR}/system_setup.cpp
+    ${PICO_TFLMICRO_HOST_DIR}/weight_copy_engine.cpp
+  )
+  set_target_properties(${target} PROPERTIES SOURCES "${sources}")
+endfunction()
@@ -0,0 +1,35 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host stand-in for the subset of the Pico SDK's hardware/timer.h used by this
+// repository. Times are microseconds of CLOCK_MONOTONIC.
+
+#ifndef PICO_TFLMICRO_HOST_HARDWARE_TIMER_H_
+#define PICO_TFLMICRO_HOST_HARDWARE_TIMER_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+uint32_t time_us_32(void);
+uint64_t time_us_64(void);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // PICO_TFLMICRO_HOST_HARDWARE_TIMER_H_
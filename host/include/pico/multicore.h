@@ -0,0 +1,48 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host stand-in for the subset of the Pico SDK's pico/multicore.h used by this
+// repository. Core 1 is a std::thread and the two inter-core FIFOs are
+// bounded blocking queues with the RP2040's depth of eight words.
+//
+// Unlike the hardware, multicore_reset_core1() cannot stop a running core 1;
+// it waits for the previous entry function to return. Entry functions used on
+// the host must therefore return once their work is done.
+
+#ifndef PICO_TFLMICRO_HOST_PICO_MULTICORE_H_
+#define PICO_TFLMICRO_HOST_PICO_MULTICORE_H_
+
+#include <stdint.h>
+
+#include "pico/platform.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+void multicore_reset_core1(void);
+void multicore_launch_core1(void (*entry)(void));
+
+// Pushes to the FIFO read by the other core, blocking while it is full.
+void multicore_fifo_push_blocking(uint32_t data);
+
+// Pops from the FIFO written by the other core, blocking while it is empty.
+uint32_t multicore_fifo_pop_blocking(void);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // PICO_TFLMICRO_HOST_PICO_MULTICORE_H_
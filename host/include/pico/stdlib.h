@@ -0,0 +1,41 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host stand-in for the subset of the Pico SDK's pico/stdlib.h used by this
+// repository.
+
+#ifndef PICO_TFLMICRO_HOST_PICO_STDLIB_H_
+#define PICO_TFLMICRO_HOST_PICO_STDLIB_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "hardware/timer.h"
+#include "pico/platform.h"
+#include "pico/time.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// stdout is always available on the host, so this only makes it line
+// buffered for readable interleaving with stderr.
+bool stdio_init_all(void);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // PICO_TFLMICRO_HOST_PICO_STDLIB_H_
@@ -0,0 +1,107 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host implementation of the TFLM timer hooks. On x86 a tick is 2^shift time
+// stamp counter increments, calibrated once against CLOCK_MONOTONIC, which
+// resolves events of a few nanoseconds. The shift is the smallest one that
+// keeps ticks_per_second() within 32 bits. Elsewhere ticks are nanoseconds from
+// CLOCK_MONOTONIC. Define TFLM_TICK_SOURCE_US for the microsecond ticks the
+// board used before it had a cycle counter.
+
+#include "tensorflow/lite/micro/micro_time.h"
+
+#include <time.h>
+
+#if !defined(TFLM_TICK_SOURCE_US) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define TFLM_TICK_SOURCE_TSC
+#include <x86intrin.h>
+#endif
+
+namespace tflite {
+namespace {
+
+uint64_t MonotonicNanoseconds() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000u +
+         static_cast<uint64_t>(ts.tv_nsec);
+}
+
+#if defined(TFLM_TICK_SOURCE_TSC)
+// Long enough for the calibration error to stay well below 0.1%.
+constexpr uint64_t kCalibrationNanoseconds = 10000000;
+
+uint32_t tsc_per_second = 0;
+int tsc_shift = 0;
+
+// Returns the time stamp counter rate in Hz.
+uint64_t CalibrateTsc() {
+  const uint64_t start_ns = MonotonicNanoseconds();
+  const uint64_t start_tsc = __rdtsc();
+  uint64_t now_ns = start_ns;
+  while (now_ns - start_ns < kCalibrationNanoseconds) {
+    now_ns = MonotonicNanoseconds();
+  }
+  const uint64_t elapsed_tsc = __rdtsc() - start_tsc;
+  return elapsed_tsc * 1000000000u / (now_ns - start_ns);
+}
+
+uint64_t ReadTsc() { return __rdtsc() >> tsc_shift; }
+#endif
+
+}  // namespace
+
+#if defined(TFLM_TICK_SOURCE_TSC)
+
+uint32_t ticks_per_second() {
+  if (tsc_per_second == 0) {
+    uint64_t rate = CalibrateTsc();
+    int shift = 0;
+    while (rate > UINT32_MAX) {
+      rate >>= 1;
+      ++shift;
+    }
+    tsc_shift = shift;
+    tsc_per_second = static_cast<uint32_t>(rate);
+  }
+  return tsc_per_second;
+}
+
+uint32_t GetCurrentTimeTicks() {
+  // Calibrates the shift if nothing asked for the rate yet.
+  ticks_per_second();
+  return static_cast<uint32_t>(ReadTsc());
+}
+
+#elif defined(TFLM_TICK_SOURCE_US)
+
+uint32_t ticks_per_second() { return 1000000; }
+
+uint32_t GetCurrentTimeTicks() {
+  return static_cast<uint32_t>(MonotonicNanoseconds() / 1000u);
+}
+
+#else
+
+uint32_t ticks_per_second() { return 1000000000; }
+
+uint32_t GetCurrentTimeTicks() {
+  return static_cast<uint32_t>(MonotonicNanoseconds());
+}
+
+#endif
+
+}  // namespace tflite
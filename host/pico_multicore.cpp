@@ -0,0 +1,162 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host implementation of the Pico SDK multicore functions declared in
+// host/include. Core 1 is one persistent std::thread that, like the core 1
+// bootrom, waits for entry points to be handed over through a FIFO and runs
+// them, so launching per kernel invocation costs no thread creation. The two
+// inter-core FIFOs are bounded queues with the same depth as on the RP2040,
+// so code that relies on push blocking when the other core falls behind
+// behaves the same way.
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "pico/multicore.h"
+#include "pico/platform.h"
+
+namespace {
+
+// Depth of each inter-core FIFO on the RP2040.
+constexpr int kFifoDepth = 8;
+
+template <typename T>
+class Fifo {
+ public:
+  void Push(T value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] { return count_ < kFifoDepth; });
+    data_[(head_ + count_) % kFifoDepth] = value;
+    ++count_;
+    not_empty_.notify_one();
+  }
+
+  T Pop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return count_ > 0; });
+    const T value = data_[head_];
+    head_ = (head_ + 1) % kFifoDepth;
+    --count_;
+    not_full_.notify_one();
+    return value;
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    head_ = 0;
+    count_ = 0;
+    not_full_.notify_all();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  T data_[kFifoDepth];
+  int head_ = 0;
+  int count_ = 0;
+};
+
+typedef void (*Core1Entry)(void);
+
+thread_local unsigned int core_num = 0;
+
+// The core 1 thread. It is started by the first launch and stopped at exit,
+// after the entry it is running has returned.
+class Core1 {
+ public:
+  ~Core1() {
+    if (thread_.joinable()) {
+      Launch(nullptr);
+      thread_.join();
+    }
+  }
+
+  void Launch(Core1Entry entry) {
+    if (!thread_.joinable()) {
+      thread_ = std::thread([this] { Run(); });
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++pending_;
+    }
+    launches_.Push(entry);
+  }
+
+  // A host thread cannot be stopped in the middle of an entry function, so
+  // resetting core 1 waits until it is idle again.
+  void WaitIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] { return pending_ == 0; });
+  }
+
+ private:
+  void Run() {
+    core_num = 1;
+    while (true) {
+      const Core1Entry entry = launches_.Pop();
+      if (entry != nullptr) {
+        entry();
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --pending_;
+      }
+      idle_.notify_all();
+      if (entry == nullptr) {
+        return;
+      }
+    }
+  }
+
+  Fifo<Core1Entry> launches_;
+  std::mutex mutex_;
+  std::condition_variable idle_;
+  int pending_ = 0;
+  std::thread thread_;
+};
+
+// fifos[n] is read by core n.
+Fifo<uint32_t> fifos[2];
+Core1 core1;
+
+}  // namespace
+
+extern "C" {
+
+unsigned int get_core_num(void) { return core_num; }
+
+void multicore_reset_core1(void) {
+  core1.WaitIdle();
+  fifos[0].Clear();
+  fifos[1].Clear();
+}
+
+void multicore_launch_core1(void (*entry)(void)) {
+  multicore_reset_core1();
+  core1.Launch(entry);
+}
+
+void multicore_fifo_push_blocking(uint32_t data) {
+  fifos[1 - get_core_num()].Push(data);
+}
+
+uint32_t multicore_fifo_pop_blocking(void) {
+  return fifos[get_core_num()].Pop();
+}
+
+}  // extern "C"
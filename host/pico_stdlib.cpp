@@ -0,0 +1,52 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host implementation of the Pico SDK time and stdio functions declared in
+// host/include.
+
+#include <stdio.h>
+#include <time.h>
+
+#include "hardware/timer.h"
+#include "pico/stdlib.h"
+#include "pico/time.h"
+
+extern "C" {
+
+uint64_t time_us_64(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000u +
+         static_cast<uint64_t>(ts.tv_nsec) / 1000u;
+}
+
+uint32_t time_us_32(void) { return static_cast<uint32_t>(time_us_64()); }
+
+void sleep_us(uint64_t us) {
+  struct timespec ts;
+  ts.tv_sec = static_cast<time_t>(us / 1000000u);
+  ts.tv_nsec = static_cast<long>((us % 1000000u) * 1000u);
+  while (nanosleep(&ts, &ts) != 0) {
+  }
+}
+
+void sleep_ms(uint32_t ms) { sleep_us(static_cast<uint64_t>(ms) * 1000u); }
+
+bool stdio_init_all(void) {
+  setvbuf(stdout, nullptr, _IOLBF, 0);
+  return true;
+}
+
+}  // extern "C"
@@ -0,0 +1,43 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host implementation of the TFLM target hooks. Log output goes to stdout so
+// that benchmark and test results can be piped or captured alongside the
+// program's own printf output.
+
+#include <stdio.h>
+
+#include "tensorflow/lite/micro/debug_log.h"
+#include "tensorflow/lite/micro/system_setup.h"
+
+namespace tflite {
+
+void InitializeTarget() { setvbuf(stdout, nullptr, _IOLBF, 0); }
+
+}  // namespace tflite
+
+extern "C" void DebugLog(const char* format, va_list args) {
+#ifndef TF_LITE_STRIP_ERROR_STRINGS
+  vfprintf(stdout, format, args);
+#endif
+}
+
+#ifndef TF_LITE_STRIP_ERROR_STRINGS
+// Only called from MicroVsnprintf (micro_log.h)
+int DebugVsnprintf(char* buffer, size_t buf_size, const char* format,
+                   va_list vlist) {
+  return vsnprintf(buffer, buf_size, format, vlist);
+}
+#endif
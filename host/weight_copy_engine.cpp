@@ -0,0 +1,40 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host implementation of WeightCopyEngine. There is no DMA and no flash
+// behind a cache, so each batch is copied with memcpy() when it starts and
+// Wait() has nothing to wait for. This keeps the staging path of the
+// interpreter, and what kernels read, the same as on the board.
+
+#include "tensorflow/lite/micro/weight_copy_engine.h"
+
+#include <cstring>
+
+namespace tflite {
+
+WeightCopyEngine::~WeightCopyEngine() {}
+
+void WeightCopyEngine::Start(const Copy* copies, int count) {
+  if (count > kMaxCopies) {
+    count = kMaxCopies;
+  }
+  for (int i = 0; i < count; ++i) {
+    std::memcpy(copies[i].destination, copies[i].source, copies[i].size);
+  }
+}
+
+void WeightCopyEngine::Wait() {}
+
+}  // namespace tflite
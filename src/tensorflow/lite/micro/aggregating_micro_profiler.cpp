@@ -0,0 +1,303 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/aggregating_micro_profiler.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_time.h"
+
+namespace tflite {
+namespace {
+
+constexpr float kQuantile = 0.99f;
+
+// Desired P-square marker positions after the first five samples, and how
+// far each one moves per additional sample.
+constexpr float kInitialPositions[5] = {0.0f, 2.0f * kQuantile,
+                                        4.0f * kQuantile,
+                                        2.0f + 2.0f * kQuantile, 4.0f};
+constexpr float kPositionIncrements[5] = {0.0f, kQuantile / 2.0f, kQuantile,
+                                          (1.0f + kQuantile) / 2.0f, 1.0f};
+
+// Piecewise-parabolic prediction of marker i moved by d (+1 or -1).
+float Parabolic(const float* q, const int32_t* n, int i, int d) {
+  const float df = static_cast<float>(d);
+  const float left = static_cast<float>(n[i] - n[i - 1]);
+  const float right = static_cast<float>(n[i + 1] - n[i]);
+  return q[i] + df / (left + right) *
+                    ((left + df) * (q[i + 1] - q[i]) / right +
+                     (right - df) * (q[i] - q[i - 1]) / left);
+}
+
+float Linear(const float* q, const int32_t* n, int i, int d) {
+  return q[i] + static_cast<float>(d) * (q[i + d] - q[i]) /
+                    static_cast<float>(n[i + d] - n[i]);
+}
+
+}  // namespace
+
+AggregatingMicroProfiler::AggregatingMicroProfiler(NodeStats* nodes,
+                                                   int max_nodes)
+    : nodes_(nodes), max_nodes_(max_nodes) {}
+
+uint32_t AggregatingMicroProfiler::BeginEvent(const char* tag) {
+  if (next_node_ >= max_nodes_) {
+    ++dropped_events_;
+    return kDroppedEvent;
+  }
+
+  NodeStats& node = nodes_[next_node_];
+  if (next_node_ == num_nodes_) {
+    StartNode(node, tag);
+    ++num_nodes_;
+  } else if (node.tag != tag && strcmp(node.tag, tag) != 0) {
+    // The event sequence no longer matches what was recorded, so the
+    // statistics from here on describe different nodes.
+    StartNode(node, tag);
+    num_nodes_ = next_node_ + 1;
+  }
+
+  node.depth = depth_++;
+  node.start_ticks = GetCurrentTimeTicks();
+  return next_node_++;
+}
+
+void AggregatingMicroProfiler::EndEvent(uint32_t event_handle) {
+  const uint32_t end_ticks = GetCurrentTimeTicks();
+  if (event_handle == kDroppedEvent) {
+    return;
+  }
+  TFLITE_DCHECK(event_handle < static_cast<uint32_t>(num_nodes_));
+
+  NodeStats& node = nodes_[event_handle];
+  const uint32_t ticks = end_ticks - node.start_ticks;
+  if (depth_ > 0) {
+    --depth_;
+  }
+  if (node.depth == 0) {
+    invocation_ticks_ += ticks;
+  }
+  AddSample(node, ticks);
+
+  if (sink_ != nullptr) {
+    const uint8_t record[kRecordSize] = {
+        kRecordSync,
+        static_cast<uint8_t>(invocation_),
+        static_cast<uint8_t>(event_handle),
+        static_cast<uint8_t>(event_handle >> 8),
+        static_cast<uint8_t>(ticks),
+        static_cast<uint8_t>(ticks >> 8),
+        static_cast<uint8_t>(ticks >> 16),
+        static_cast<uint8_t>(ticks >> 24),
+    };
+    sink_(record, kRecordSize, sink_context_);
+  }
+}
+
+void AggregatingMicroProfiler::SetEventCost(uint32_t event_handle,
+                                            const MicroOpCost& cost) {
+  if (event_handle == kDroppedEvent) {
+    return;
+  }
+  TFLITE_DCHECK(event_handle < static_cast<uint32_t>(num_nodes_));
+  nodes_[event_handle].cost = cost;
+}
+
+void AggregatingMicroProfiler::ClearEvents() {
+  next_node_ = 0;
+  depth_ = 0;
+  invocation_ticks_ = 0;
+  ++invocation_;
+}
+
+void AggregatingMicroProfiler::ResetStats() {
+  num_nodes_ = 0;
+  dropped_events_ = 0;
+  invocation_ = 0;
+  ClearEvents();
+}
+
+void AggregatingMicroProfiler::SetRecordSink(RecordSink sink, void* context) {
+  sink_ = sink;
+  sink_context_ = context;
+}
+
+void AggregatingMicroProfiler::StartNode(NodeStats& node, const char* tag) {
+  memset(&node, 0, sizeof(node));
+  node.tag = tag;
+}
+
+void AggregatingMicroProfiler::AddSample(NodeStats& node, uint32_t ticks) {
+  float* q = node.heights;
+  int32_t* n = node.positions;
+  const float x = static_cast<float>(ticks);
+
+  if (node.count == 0 || ticks < node.min_ticks) {
+    node.min_ticks = ticks;
+  }
+  if (ticks > node.max_ticks) {
+    node.max_ticks = ticks;
+  }
+  node.total_ticks += ticks;
+
+  if (node.count < 5) {
+    // Insertion sort of the first five samples.
+    int i = static_cast<int>(node.count);
+    for (; i > 0 && q[i - 1] > x; --i) {
+      q[i] = q[i - 1];
+    }
+    q[i] = x;
+    if (++node.count == 5) {
+      for (int j = 0; j < 5; ++j) {
+        n[j] = j;
+      }
+    }
+    return;
+  }
+
+  // Find the cell containing x and widen the outer markers if needed.
+  int k;
+  if (x < q[0]) {
+    q[0] = x;
+    k = 0;
+  } else if (x >= q[4]) {
+    q[4] = x;
+    k = 3;
+  } else {
+    k = 0;
+    while (x >= q[k + 1]) {
+      ++k;
+    }
+  }
+  for (int i = k + 1; i < 5; ++i) {
+    ++n[i];
+  }
+  ++node.count;
+
+  // Move the three middle markers towards their desired positions.
+  const float samples_after_init = static_cast<float>(node.count - 5);
+  for (int i = 1; i < 4; ++i) {
+    const float desired =
+        kInitialPositions[i] + samples_after_init * kPositionIncrements[i];
+    const float delta = desired - static_cast<float>(n[i]);
+    if ((delta >= 1.0f && n[i + 1] - n[i] > 1) ||
+        (delta <= -1.0f && n[i - 1] - n[i] < -1)) {
+      const int d = delta > 0.0f ? 1 : -1;
+      float candidate = Parabolic(q, n, i, d);
+      if (!(q[i - 1] < candidate && candidate < q[i + 1])) {
+        candidate = Linear(q, n, i, d);
+      }
+      q[i] = candidate;
+      n[i] += d;
+    }
+  }
+}
+
+uint32_t AggregatingMicroProfiler::MeanTicks(const NodeStats& node) {
+  if (node.count == 0) {
+    return 0;
+  }
+  return static_cast<uint32_t>(node.total_ticks / node.count);
+}
+
+uint32_t AggregatingMicroProfiler::P99Ticks(const NodeStats& node) {
+  if (node.count == 0) {
+    return 0;
+  }
+  // With fewer than 100 samples the 99th percentile is the maximum.
+  if (node.count < 100) {
+    return node.max_ticks;
+  }
+  return static_cast<uint32_t>(node.heights[2] + 0.5f);
+}
+
+uint32_t AggregatingMicroProfiler::PerTickX100(const NodeStats& node,
+                                               uint32_t amount) {
+  const uint32_t mean = MeanTicks(node);
+  if (mean == 0) {
+    return 0;
+  }
+  const uint64_t per_tick = static_cast<uint64_t>(amount) * 100 / mean;
+  // More than 2^32 / 100 per tick only happens for ops faster than a tick,
+  // so saturate rather than print a wrapped value.
+  return per_tick > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(per_tick);
+}
+
+void AggregatingMicroProfiler::Log() const {
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+  uint32_t peak_live_bytes = 0;
+  for (int i = 0; i < num_nodes_; ++i) {
+    if (nodes_[i].cost.live_bytes > peak_live_bytes) {
+      peak_live_bytes = nodes_[i].cost.live_bytes;
+    }
+  }
+  for (int i = 0; i < num_nodes_; ++i) {
+    const NodeStats& node = nodes_[i];
+    MicroPrintf(
+        "%d %s: count %u, min %u, mean %u, p99 %u, max %u ticks (mean %u us)",
+        i, node.tag, node.count, node.min_ticks, MeanTicks(node),
+        P99Ticks(node), node.max_ticks, TicksToUs(MeanTicks(node)));
+    const uint32_t bytes = MicroOpCostBytes(node.cost);
+    if (bytes > 0) {
+      const uint32_t macs_per_tick = PerTickX100(node, node.cost.macs);
+      const uint32_t bytes_per_tick = PerTickX100(node, bytes);
+      MicroPrintf(
+          "  %u MACs, %u bytes (%u weights): %u.%02u MACs/tick, "
+          "%u.%02u bytes/tick, %u MACs/byte",
+          node.cost.macs, bytes, node.cost.weight_bytes, macs_per_tick / 100,
+          macs_per_tick % 100, bytes_per_tick / 100, bytes_per_tick % 100,
+          node.cost.macs / bytes);
+    }
+    if (node.cost.live_bytes > 0) {
+      MicroPrintf("  %u arena bytes live, %u scratch%s", node.cost.live_bytes,
+                  node.cost.scratch_bytes,
+                  node.cost.live_bytes == peak_live_bytes ? " (arena peak)"
+                                                          : "");
+    }
+  }
+  if (dropped_events_ > 0) {
+    MicroPrintf("%u events dropped, more than %d nodes.", dropped_events_,
+                max_nodes_);
+  }
+#endif
+}
+
+void AggregatingMicroProfiler::LogCsv() const {
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+  MicroPrintf(
+      "\"Node\",\"Tag\",\"Count\",\"Min\",\"Mean\",\"P99\",\"Max\","
+      "\"Mean Microseconds\",\"MACs\",\"Weight Bytes\",\"Bytes\","
+      "\"MACs/Tick\",\"Bytes/Tick\",\"Live Bytes\",\"Scratch Bytes\"");
+  for (int i = 0; i < num_nodes_; ++i) {
+    const NodeStats& node = nodes_[i];
+    const uint32_t bytes = MicroOpCostBytes(node.cost);
+    const uint32_t macs_per_tick = PerTickX100(node, node.cost.macs);
+    const uint32_t bytes_per_tick = PerTickX100(node, bytes);
+    MicroPrintf("%d,%s,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u.%02u,%u.%02u,%u,%u", i,
+                node.tag, node.count, node.min_ticks, MeanTicks(node),
+                P99Ticks(node), node.max_ticks, TicksToUs(MeanTicks(node)),
+                node.cost.macs, node.cost.weight_bytes, bytes,
+                macs_per_tick / 100, macs_per_tick % 100,
+                bytes_per_tick / 100, bytes_per_tick % 100,
+                node.cost.live_bytes, node.cost.scratch_bytes);
+  }
+#endif
+}
+
+}  // namespace tflite
@@ -0,0 +1,150 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_AGGREGATING_MICRO_PROFILER_H_
+#define TENSORFLOW_LITE_MICRO_AGGREGATING_MICRO_PROFILER_H_
+
+#include <cstdint>
+
+#include "tensorflow/lite/micro/compatibility.h"
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+
+namespace tflite {
+
+// A profiler that keeps running statistics per node instead of a log of
+// events, so its memory use is fixed by the number of nodes in the model and
+// it can stay attached for any number of invocations.
+//
+// Events are matched to nodes by their position within an invocation: the
+// n-th event after ClearEvents() belongs to node n. Call ClearEvents() before
+// each Invoke(), as with MicroProfiler. If the tag at a position changes (a
+// different model, or a differently nested sequence), the statistics from
+// that position on are restarted.
+//
+// For each node it tracks count, min, max, mean and an estimate of the 99th
+// percentile (the P-square algorithm, which needs five markers rather than
+// the samples). Optionally, every completed event is also passed to a
+// RecordSink as an 8-byte binary record, for streaming over a UART:
+//
+//   byte 0     kRecordSync
+//   byte 1     invocation number, modulo 256
+//   bytes 2-3  node index (little endian)
+//   bytes 4-7  duration in ticks (little endian)
+//
+// When the interpreter collected operator costs at Prepare (see
+// MicroOpCost), Log() and LogCsv() also print MACs and bytes moved per tick,
+// and MACs per byte, so that compute- and memory-bound nodes stand apart.
+// They also print the arena bytes live during each node and its scratch
+// bytes, and Log() marks the node at the arena peak.
+//
+// Use StaticAggregatingMicroProfiler<N> to provide storage for N nodes.
+class AggregatingMicroProfiler : public MicroProfilerInterface {
+ public:
+  static constexpr int kRecordSize = 8;
+  static constexpr uint8_t kRecordSync = 0xA5;
+
+  // Returned by BeginEvent when every node slot is in use.
+  static constexpr uint32_t kDroppedEvent = 0xFFFFFFFF;
+
+  struct NodeStats {
+    const char* tag;
+    uint32_t start_ticks;
+    uint32_t count;
+    uint32_t min_ticks;
+    uint32_t max_ticks;
+    uint64_t total_ticks;
+    // Nesting depth of the event when it was last begun.
+    uint32_t depth;
+    // P-square marker heights and positions. Until five samples have been
+    // seen, heights holds the samples in ascending order.
+    float heights[5];
+    int32_t positions[5];
+    // Static cost of one invocation, all zero if none was reported.
+    MicroOpCost cost;
+  };
+
+  typedef void (*RecordSink)(const uint8_t* record, int size, void* context);
+
+  // `nodes` must outlive the profiler.
+  AggregatingMicroProfiler(NodeStats* nodes, int max_nodes);
+  virtual ~AggregatingMicroProfiler() = default;
+
+  virtual uint32_t BeginEvent(const char* tag) override;
+  virtual void EndEvent(uint32_t event_handle) override;
+  virtual void SetEventCost(uint32_t event_handle,
+                            const MicroOpCost& cost) override;
+
+  // Starts the next invocation. Statistics are kept.
+  void ClearEvents();
+
+  // Forgets all statistics.
+  void ResetStats();
+
+  // Streams every completed event to `sink`, or stops streaming if null.
+  void SetRecordSink(RecordSink sink, void* context);
+
+  // Sum of the ticks of the outermost events since ClearEvents().
+  uint32_t GetTotalTicks() const { return invocation_ticks_; }
+
+  int num_nodes() const { return num_nodes_; }
+  const NodeStats& node(int index) const { return nodes_[index]; }
+  uint32_t dropped_events() const { return dropped_events_; }
+
+  static uint32_t MeanTicks(const NodeStats& node);
+  static uint32_t P99Ticks(const NodeStats& node);
+
+  // `amount` per mean tick of `node`, in hundredths, saturated at
+  // UINT32_MAX.
+  static uint32_t PerTickX100(const NodeStats& node, uint32_t amount);
+
+  // Prints one line of statistics per node in human readable form.
+  void Log() const;
+
+  // Prints the same statistics in CSV (Comma Separated Value) form.
+  void LogCsv() const;
+
+ private:
+  void StartNode(NodeStats& node, const char* tag);
+  void AddSample(NodeStats& node, uint32_t ticks);
+
+  NodeStats* nodes_;
+  int max_nodes_;
+  int num_nodes_ = 0;
+  int next_node_ = 0;
+  uint32_t depth_ = 0;
+  uint32_t invocation_ticks_ = 0;
+  uint32_t invocation_ = 0;
+  uint32_t dropped_events_ = 0;
+  RecordSink sink_ = nullptr;
+  void* sink_context_ = nullptr;
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+template <int tMaxNodes>
+class StaticAggregatingMicroProfiler : public AggregatingMicroProfiler {
+ public:
+  StaticAggregatingMicroProfiler()
+      : AggregatingMicroProfiler(storage_, tMaxNodes) {}
+
+ private:
+  NodeStats storage_[tMaxNodes];
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_AGGREGATING_MICRO_PROFILER_H_
@@ -17,7 +17,11 @@ limitations under the License.
 #define TENSORFLOW_LITE_MICRO_BENCHMARKS_MICRO_BENCHMARK_H_
 
 #include <climits>
+#include <cstddef>
 
+#include "tensorflow/lite/micro/aggregating_micro_profiler.h"
+#include "tensorflow/lite/micro/benchmarks/micro_benchmark_report.h"
+#include "tensorflow/lite/micro/micro_arena_timeline.h"
 #include "tensorflow/lite/micro/micro_log.h"
 #include "tensorflow/lite/micro/micro_op_resolver.h"
 #include "tensorflow/lite/micro/micro_profiler_interface.h"
@@ -30,28 +34,67 @@ namespace tflite {
 template <typename inputT>
 class MicroBenchmarkRunner {
  public:
-  // The lifetimes of model, op_resolver, tensor_arena, profiler must exceed
-  // that of the created MicroBenchmarkRunner object.
+  // The lifetimes of model, op_resolver, tensor_arena, profiler and
+  // weight_staging_buffer must exceed that of the created
+  // MicroBenchmarkRunner object. With `log_arena_timeline`, the memory plan
+  // is logged for benchmarks/arena_timeline.py. With a
+  // `weight_staging_buffer`, weights are staged through it, see
+  // MicroInterpreter::SetWeightStagingBuffer().
   MicroBenchmarkRunner(const uint8_t* model,
                        const tflite::MicroOpResolver* op_resolver,
                        uint8_t* tensor_arena, int tensor_arena_size,
                        MicroProfilerInterface* profiler,
-                       int num_resource_variables = 0)
+                       int num_resource_variables = 0,
+                       bool log_arena_timeline = false,
+                       uint8_t* weight_staging_buffer = nullptr,
+                       size_t weight_staging_buffer_size = 0)
       : allocator_(
             RecordingMicroAllocator::Create(tensor_arena, tensor_arena_size)),
         interpreter_(
             GetModel(model), *op_resolver, allocator_,
             MicroResourceVariables::Create(allocator_, num_resource_variables),
             profiler) {
+    if (log_arena_timeline) {
+      allocator_->SetArenaTimelineWriter(LogArenaTimelineLine, nullptr);
+    }
+    if (weight_staging_buffer != nullptr) {
+      interpreter_.SetWeightStagingBuffer(weight_staging_buffer,
+                                          weight_staging_buffer_size);
+    }
     interpreter_.AllocateTensors();
+    allocator_->SetArenaTimelineWriter(nullptr, nullptr);
   }
 
-  void RunSingleIteration() {
+  TfLiteStatus RunSingleIteration() {
     // Run the model on this input and make sure it succeeds.
     TfLiteStatus invoke_status = interpreter_.Invoke();
     if (invoke_status == kTfLiteError) {
       MicroPrintf("Invoke failed.");
     }
+    return invoke_status;
+  }
+
+  // Runs `warmup_iterations` invocations, then forgets the statistics of
+  // `profiler` and runs `timed_iterations` more, each wrapped in a
+  // kMicroBenchmarkInvokeTag event. `profiler` must be the profiler this
+  // runner was created with. Afterwards node 0 of `profiler` holds end-to-end
+  // statistics and the nodes after it those of each operator, as
+  // WriteMicroBenchmarkJson expects.
+  TfLiteStatus RunIterations(int warmup_iterations, int timed_iterations,
+                             AggregatingMicroProfiler& profiler) {
+    for (int i = 0; i < warmup_iterations; i++) {
+      profiler.ClearEvents();
+      TF_LITE_ENSURE_STATUS(RunSingleIteration());
+    }
+    profiler.ResetStats();
+    for (int i = 0; i < timed_iterations; i++) {
+      profiler.ClearEvents();
+      uint32_t event_handle = profiler.BeginEvent(kMicroBenchmarkInvokeTag);
+      TfLiteStatus invoke_status = RunSingleIteration();
+      profiler.EndEvent(event_handle);
+      TF_LITE_ENSURE_STATUS(invoke_status);
+    }
+    return kTfLiteOk;
   }
 
   int NumInputs() { return interpreter_.inputs().size(); }
@@ -81,6 +124,12 @@ class MicroBenchmarkRunner {
     }
   }
 
+  size_t arena_used_bytes() const { return interpreter_.arena_used_bytes(); }
+
+  size_t staged_weight_bytes() const {
+    return interpreter_.staged_weight_bytes();
+  }
+
   void PrintAllocations() const {
     interpreter_.GetMicroAllocator().PrintAllocations();
   }
@@ -0,0 +1,127 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/benchmarks/micro_benchmark_report.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_time.h"
+
+namespace tflite {
+namespace {
+
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+constexpr int kMaxLineLength = 192;
+
+#if defined(TFLM_HOST_PLATFORM)
+constexpr char kPlatform[] = "host";
+#elif defined(PICO_RP2350)
+constexpr char kPlatform[] = "rp2350";
+#else
+constexpr char kPlatform[] = "rp2040";
+#endif
+
+using NodeStats = AggregatingMicroProfiler::NodeStats;
+
+// Prints the timing fields shared by "invoke" and each entry of "ops".
+int FormatTicks(char* line, const NodeStats& node) {
+  const uint32_t mean = AggregatingMicroProfiler::MeanTicks(node);
+  return MicroSnprintf(
+      line, kMaxLineLength,
+      "\"count\":%u,\"min_ticks\":%u,\"mean_ticks\":%u,\"p99_ticks\":%u,"
+      "\"max_ticks\":%u,\"mean_us\":%u",
+      static_cast<unsigned>(node.count), static_cast<unsigned>(node.min_ticks),
+      static_cast<unsigned>(mean),
+      static_cast<unsigned>(AggregatingMicroProfiler::P99Ticks(node)),
+      static_cast<unsigned>(node.max_ticks),
+      static_cast<unsigned>(TicksToUs(mean)));
+}
+
+bool HasInvokeNode(const AggregatingMicroProfiler& profiler) {
+  return profiler.num_nodes() > 0 &&
+         strcmp(profiler.node(0).tag, kMicroBenchmarkInvokeTag) == 0;
+}
+
+void PrintLine(const char* line, void* context) { MicroPrintf("%s", line); }
+#endif
+
+}  // namespace
+
+void WriteMicroBenchmarkJson(const MicroBenchmarkResult& result,
+                             const AggregatingMicroProfiler& profiler,
+                             MicroBenchmarkLineWriter writer, void* context) {
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+  char line[kMaxLineLength];
+  MicroSnprintf(line, kMaxLineLength,
+                "{\"model\":\"%s\",\"platform\":\"%s\","
+                "\"ticks_per_second\":%u,",
+                result.model_name, kPlatform,
+                static_cast<unsigned>(ticks_per_second()));
+  writer(line, context);
+  MicroSnprintf(line, kMaxLineLength,
+                "\"warmup_iterations\":%d,\"timed_iterations\":%d,"
+                "\"arena\":{\"used_bytes\":%u,\"size_bytes\":%u},",
+                result.warmup_iterations, result.timed_iterations,
+                static_cast<unsigned>(result.arena_used_bytes),
+                static_cast<unsigned>(result.arena_size_bytes));
+  writer(line, context);
+
+  int first_op = 0;
+  if (HasInvokeNode(profiler)) {
+    int length = MicroSnprintf(line, kMaxLineLength, "\"invoke\":{");
+    length += FormatTicks(line + length, profiler.node(0));
+    MicroSnprintf(line + length, kMaxLineLength - length, "},");
+    first_op = 1;
+  } else {
+    MicroSnprintf(line, kMaxLineLength, "\"invoke\":null,");
+  }
+  writer(line, context);
+
+  writer("\"ops\":[", context);
+  for (int i = first_op; i < profiler.num_nodes(); ++i) {
+    const NodeStats& node = profiler.node(i);
+    MicroSnprintf(line, kMaxLineLength,
+                  "%s{\"node\":%d,\"tag\":\"%s\",\"depth\":%u,",
+                  i == first_op ? "" : ",", i - first_op, node.tag,
+                  static_cast<unsigned>(node.depth));
+    writer(line, context);
+    FormatTicks(line, node);
+    writer(line, context);
+    MicroSnprintf(line, kMaxLineLength,
+                  ",\"macs\":%u,\"weight_bytes\":%u,\"bytes\":%u,"
+                  "\"live_bytes\":%u,\"scratch_bytes\":%u}",
+                  static_cast<unsigned>(node.cost.macs),
+                  static_cast<unsigned>(node.cost.weight_bytes),
+                  static_cast<unsigned>(MicroOpCostBytes(node.cost)),
+                  static_cast<unsigned>(node.cost.live_bytes),
+                  static_cast<unsigned>(node.cost.scratch_bytes));
+    writer(line, context);
+  }
+  MicroSnprintf(line, kMaxLineLength, "],\"dropped_events\":%u}",
+                static_cast<unsigned>(profiler.dropped_events()));
+  writer(line, context);
+#endif
+}
+
+void LogMicroBenchmarkJson(const MicroBenchmarkResult& result,
+                           const AggregatingMicroProfiler& profiler) {
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+  WriteMicroBenchmarkJson(result, profiler, PrintLine, nullptr);
+#endif
+}
+
+}  // namespace tflite
@@ -0,0 +1,67 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_BENCHMARKS_MICRO_BENCHMARK_REPORT_H_
+#define TENSORFLOW_LITE_MICRO_BENCHMARKS_MICRO_BENCHMARK_REPORT_H_
+
+#include <cstddef>
+
+#include "tensorflow/lite/micro/aggregating_micro_profiler.h"
+
+namespace tflite {
+
+// Tag of the event that MicroBenchmarkRunner::RunIterations wraps around each
+// timed invocation, so that node 0 of the profiler holds end-to-end
+// statistics.
+constexpr char kMicroBenchmarkInvokeTag[] = "Invoke";
+
+struct MicroBenchmarkResult {
+  // Key of the model in benchmarks/baseline.json. Printed without escaping.
+  const char* model_name;
+  int warmup_iterations;
+  int timed_iterations;
+  size_t arena_used_bytes;
+  size_t arena_size_bytes;
+};
+
+typedef void (*MicroBenchmarkLineWriter)(const char* line, void* context);
+
+// Writes `result` and the statistics `profiler` collected during
+// MicroBenchmarkRunner::RunIterations as one JSON object, a few fields per
+// line so that no line outgrows MicroPrintf on the board:
+//
+//   {"model":"person_detection","platform":"rp2040",
+//    "ticks_per_second":125000000,"warmup_iterations":2,
+//    "timed_iterations":10,"arena":{"used_bytes":...,"size_bytes":...},
+//    "invoke":{"count":10,"min_ticks":...,"mean_ticks":...,
+//              "p99_ticks":...,"max_ticks":...,"mean_us":...},
+//    "ops":[{"node":0,"tag":"CONV_2D","depth":1,"count":10,...,
+//            "macs":...,"bytes":...,"live_bytes":...,"scratch_bytes":...},
+//           ...],
+//    "dropped_events":0}
+//
+// "invoke" is null when node 0 is not a kMicroBenchmarkInvokeTag event.
+// benchmarks/check_benchmarks.py compares these objects with a baseline.
+void WriteMicroBenchmarkJson(const MicroBenchmarkResult& result,
+                             const AggregatingMicroProfiler& profiler,
+                             MicroBenchmarkLineWriter writer, void* context);
+
+// Prints the same JSON object through MicroPrintf.
+void LogMicroBenchmarkJson(const MicroBenchmarkResult& result,
+                           const AggregatingMicroProfiler& profiler);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_BENCHMARKS_MICRO_BENCHMARK_REPORT_H_
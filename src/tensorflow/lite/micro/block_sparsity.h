@@ -0,0 +1,82 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_BLOCK_SPARSITY_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_BLOCK_SPARSITY_H_
+
+#include <cstdint>
+
+namespace tflite {
+
+//
+// Block-sparse weight tensors
+//
+// A block-sparse tensor keeps its dense shape in the model, but its buffer
+// only holds the nonzero blocks. Dimension 0 is the row (output channel)
+// dimension; the remaining dimensions are flattened into a row of
+// `row_depth` elements which is split into blocks of `block_size` contiguous
+// elements. The nonzero blocks are stored back to back, row by row, and a
+// bitmap with one bit per block (LSB first, rows in order) marks which
+// blocks are present.
+//
+
+static constexpr const char* kBlockSparsityMetadataString =
+    "BLOCK_SPARSITY_METADATA";
+
+// Version of the serialized metadata understood by this runtime.
+static constexpr uint32_t kBlockSparsityMetadataVersion = 1;
+
+// Serialized layout of the metadata buffer. All fields are little-endian
+// uint32_t:
+//
+//   version
+//   entry_count
+//   entry_count x { subgraph, tensor, block_size, mask_buffer }
+//
+// `mask_buffer` is the index of a model buffer holding the block bitmap.
+struct BlockSparsityMetadataHeader {
+  uint32_t version;
+  uint32_t entry_count;
+};
+
+struct BlockSparsityMetadataEntry {
+  uint32_t subgraph;
+  uint32_t tensor;
+  uint32_t block_size;
+  uint32_t mask_buffer;
+};
+
+struct BlockSparseTensorData {
+  const uint8_t* block_mask;  // Pointer into FlatBuffer buffers.
+  int32_t rows;
+  int32_t row_depth;
+  int32_t block_size;
+  int32_t blocks_per_row;
+  int32_t nonzero_blocks;
+};
+
+struct BlockSparseTensorList {
+  // Sparsely populated array with the same number of elements as there are
+  // tensors in the Subgraph, indexed by tensor index.
+  const BlockSparseTensorData** tensors;
+};
+
+inline bool IsBlockPresent(const BlockSparseTensorData& data, int32_t block) {
+  return (data.block_mask[block >> 3] >> (block & 7)) & 1;
+}
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_BLOCK_SPARSITY_H_
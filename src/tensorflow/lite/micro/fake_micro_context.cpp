@@ -125,6 +125,41 @@ void* FakeMicroContext::external_context() { return nullptr; }
 
 MicroGraph& FakeMicroContext::graph() { return graph_; }
 
+void FakeMicroContext::SetBlockSparseTensors(
+    const BlockSparseTensorList* block_sparse_tensors) {
+  block_sparse_tensors_ = block_sparse_tensors;
+}
+
+const BlockSparseTensorData* FakeMicroContext::GetTensorBlockSparsityData(
+    const TfLiteNode* node, int tensor_idx) {
+  if (block_sparse_tensors_ == nullptr || tensor_idx >= node->inputs->size) {
+    return nullptr;
+  }
+
+  int index = node->inputs->data[tensor_idx];
+  if (index < 0) {
+    return nullptr;
+  }
+
+  return block_sparse_tensors_->tensors[index];
+}
+
+void FakeMicroContext::SetOfflineRequantization(
+    const OfflineRequantizationData* data, int channels) {
+  offline_requantization_ = data;
+  offline_requantization_channels_ = channels;
+}
+
+bool FakeMicroContext::GetOfflineRequantization(
+    int channels, OfflineRequantizationData* data) {
+  if (offline_requantization_ == nullptr ||
+      channels != offline_requantization_channels_) {
+    return false;
+  }
+  *data = *offline_requantization_;
+  return true;
+}
+
 #ifdef USE_TFLM_COMPRESSION
 
 // Available during Prepare & Eval. Returns false if tensor is not
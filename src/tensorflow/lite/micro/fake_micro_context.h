@@ -55,6 +55,24 @@ class FakeMicroContext : public MicroContext {
   void* external_context() override;
   MicroGraph& graph() override;
 
+  // Registers the block-sparse layout of the test tensors. The list is not
+  // owned and must outlive this context.
+  void SetBlockSparseTensors(const BlockSparseTensorList* block_sparse_tensors);
+
+  // Available during Prepare & Eval. Returns nullptr if the tensor is not
+  // stored in the block-sparse format.
+  const BlockSparseTensorData* GetTensorBlockSparsityData(
+      const TfLiteNode* node, int tensor_idx) override;
+
+  // Registers requantization tables that GetOfflineRequantization() returns
+  // for any operator with `channels` output channels. The tables are not
+  // owned and must outlive this context.
+  void SetOfflineRequantization(const OfflineRequantizationData* data,
+                                int channels);
+
+  bool GetOfflineRequantization(int channels,
+                                OfflineRequantizationData* data) override;
+
 #ifdef USE_TFLM_COMPRESSION
 
   // Available during Prepare & Eval. Returns false if tensor is not
@@ -85,6 +103,11 @@ class FakeMicroContext : public MicroContext {
 
   SingleArenaBufferAllocator* allocator_;
 
+  const BlockSparseTensorList* block_sparse_tensors_ = nullptr;
+
+  const OfflineRequantizationData* offline_requantization_ = nullptr;
+  int offline_requantization_channels_ = 0;
+
 #ifdef USE_TFLM_COMPRESSION
 
   //
@@ -0,0 +1,112 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/flash_partition.h"
+
+#include <cstring>
+
+#include "tensorflow/lite/micro/micro_log.h"
+
+// These are headers from the RP2's SDK.
+#include "hardware/flash.h"  // NOLINT
+#include "pico/flash.h"      // NOLINT
+#include "pico/stdlib.h"     // NOLINT
+
+// The partition is read through the cached XIP window. flash_range_erase()
+// and flash_range_program() run with XIP disabled, so they go through
+// flash_safe_execute(), which masks interrupts and parks the other core in
+// RAM if it set up multicore lockout. They also flush the XIP cache, so
+// reads after a write see the new contents.
+
+namespace tflite {
+namespace {
+
+struct EraseRequest {
+  uint32_t flash_offset;
+  uint32_t size;
+};
+
+struct ProgramRequest {
+  uint32_t flash_offset;
+  const uint8_t* data;
+};
+
+void EraseInRam(void* param) {
+  const EraseRequest* request = static_cast<const EraseRequest*>(param);
+  flash_range_erase(request->flash_offset, request->size);
+}
+
+void ProgramInRam(void* param) {
+  const ProgramRequest* request = static_cast<const ProgramRequest*>(param);
+  flash_range_program(request->flash_offset, request->data,
+                      FlashPartition::kPageSize);
+}
+
+}  // namespace
+
+FlashPartition::~FlashPartition() { Close(); }
+
+bool FlashPartition::Open(uint32_t offset, uint32_t size,
+                          const char* host_path) {
+  (void)host_path;
+  Close();
+  if (offset % kSectorSize != 0 || size % kSectorSize != 0 || size == 0 ||
+      offset > PICO_FLASH_SIZE_BYTES ||
+      size > PICO_FLASH_SIZE_BYTES - offset) {
+    MicroPrintf("FlashPartition: %u bytes at %u do not fit in flash",
+                static_cast<unsigned>(size), static_cast<unsigned>(offset));
+    return false;
+  }
+  data_ = reinterpret_cast<const uint8_t*>(XIP_BASE + offset);
+  offset_ = offset;
+  size_ = size;
+  return true;
+}
+
+void FlashPartition::Close() {
+  data_ = nullptr;
+  offset_ = 0;
+  size_ = 0;
+}
+
+bool FlashPartition::Erase(uint32_t offset, uint32_t size) {
+  if (data_ == nullptr || offset % kSectorSize != 0 ||
+      size % kSectorSize != 0 || offset > size_ || size > size_ - offset) {
+    return false;
+  }
+  EraseRequest request = {offset_ + offset, size};
+  return flash_safe_execute(EraseInRam, &request, UINT32_MAX) == PICO_OK;
+}
+
+bool FlashPartition::Program(uint32_t offset, const uint8_t* data,
+                             uint32_t size) {
+  if (data_ == nullptr || offset % kPageSize != 0 || size % kPageSize != 0 ||
+      offset > size_ || size > size_ - offset) {
+    return false;
+  }
+  // The source may be in flash, which cannot be read while it is being
+  // programmed, so each page goes through RAM.
+  uint8_t page[kPageSize];
+  for (uint32_t done = 0; done < size; done += kPageSize) {
+    std::memcpy(page, data + done, kPageSize);
+    ProgramRequest request = {offset_ + offset + done, page};
+    if (flash_safe_execute(ProgramInRam, &request, UINT32_MAX) != PICO_OK) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace tflite
@@ -0,0 +1,71 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_FLASH_PARTITION_H_
+#define TENSORFLOW_LITE_MICRO_FLASH_PARTITION_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tflite {
+
+// A range of the board's flash, mapped so that its contents can be read in
+// place. On the RP2040/RP2350 reads go through the XIP window, and writes
+// stop the other core while flash is busy. On the host, flash is a file
+// mapped with mmap(). The platform implementations are flash_partition.cpp
+// and host/flash_partition.cpp.
+class FlashPartition {
+ public:
+  // Flash erases whole sectors and programs whole pages.
+  static constexpr uint32_t kSectorSize = 4096;
+  static constexpr uint32_t kPageSize = 256;
+
+  FlashPartition() = default;
+  ~FlashPartition();
+
+  FlashPartition(const FlashPartition&) = delete;
+  FlashPartition& operator=(const FlashPartition&) = delete;
+
+  // Maps `size` bytes of flash starting `offset` bytes into it. Both must be
+  // multiples of kSectorSize. On the host, `host_path` names the file that
+  // stands in for flash, which is created and grown as needed; the board
+  // ignores it.
+  bool Open(uint32_t offset, uint32_t size, const char* host_path = nullptr);
+  void Close();
+
+  const uint8_t* data() const { return data_; }
+  uint32_t size() const { return size_; }
+
+  // Sets the sectors in [offset, offset + size) of the partition to 0xFF.
+  // `offset` and `size` must be multiples of kSectorSize.
+  bool Erase(uint32_t offset, uint32_t size);
+
+  // Programs `size` bytes at `offset` of the partition, both multiples of
+  // kPageSize. As on NOR flash, programming only clears bits, so the pages
+  // must have been erased unless the caller only wants to clear bits.
+  // `data` may point into flash.
+  bool Program(uint32_t offset, const uint8_t* data, uint32_t size);
+
+ private:
+  const uint8_t* data_ = nullptr;
+  uint32_t offset_ = 0;
+  uint32_t size_ = 0;
+  // The file standing in for flash, on the host.
+  int host_fd_ = -1;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_FLASH_PARTITION_H_
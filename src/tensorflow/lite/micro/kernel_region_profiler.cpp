@@ -0,0 +1,49 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernel_region_profiler.h"
+
+namespace tflite {
+namespace {
+
+// Written by the application between inferences, read by kernels on both
+// cores.
+MicroProfilerInterface* volatile region_profiler = nullptr;
+
+}  // namespace
+
+void SetKernelRegionProfiler(MicroProfilerInterface* profiler) {
+  region_profiler = profiler;
+}
+
+MicroProfilerInterface* GetKernelRegionProfiler() { return region_profiler; }
+
+}  // namespace tflite
+
+extern "C" uint32_t TfLiteMicroRegionBegin(const char* tag) {
+  tflite::MicroProfilerInterface* profiler = tflite::GetKernelRegionProfiler();
+  if (profiler == nullptr) {
+    return TF_LITE_MICRO_NO_REGION;
+  }
+  return profiler->BeginEvent(tag);
+}
+
+extern "C" void TfLiteMicroRegionEnd(uint32_t handle) {
+  tflite::MicroProfilerInterface* profiler = tflite::GetKernelRegionProfiler();
+  if (profiler == nullptr || handle == TF_LITE_MICRO_NO_REGION) {
+    return;
+  }
+  profiler->EndEvent(handle);
+}
@@ -0,0 +1,80 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_KERNEL_REGION_PROFILER_H_
+#define TENSORFLOW_LITE_MICRO_KERNEL_REGION_PROFILER_H_
+
+// Sub-regions of kernels (matmul, decompression, ...) reported to a
+// profiler, so that a trace shows what an operator spends its time on and,
+// for the multicore matmul, what each core is doing. Only stretches long
+// enough to be worth a trace event are regions: im2col and requantization
+// are interleaved with the matmul per output pixel and per output value, so
+// they have no region of their own.
+//
+// Region tracing is opt in: nothing is recorded until the application calls
+// tflite::SetKernelRegionProfiler(). Until then a region costs one load and a
+// branch. Regions may begin and end on either core, so the profiler passed in
+// must accept events from both (TraceMicroProfiler does).
+//
+// The C entry points are for kernels written in C, such as CMSIS-NN.
+
+#include <stdint.h>
+
+// Returned by TfLiteMicroRegionBegin when no profiler is installed.
+#define TF_LITE_MICRO_NO_REGION 0xFFFFFFFFu
+
+// Common region tags.
+#define TF_LITE_MICRO_REGION_MATMUL "matmul"
+// Core 0 waiting for core 1 to finish its half of a multicore matmul.
+#define TF_LITE_MICRO_REGION_MATMUL_WAIT "matmul_wait_core1"
+#define TF_LITE_MICRO_REGION_DECOMPRESS "decompress"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Starts a region named `tag`, which must outlive the profiler. Returns a
+// handle for TfLiteMicroRegionEnd, which must be called on the same core.
+uint32_t TfLiteMicroRegionBegin(const char* tag);
+
+void TfLiteMicroRegionEnd(uint32_t handle);
+
+#ifdef __cplusplus
+}  // extern "C"
+
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+
+namespace tflite {
+
+// Sends kernel regions to `profiler`, or stops recording them if null.
+void SetKernelRegionProfiler(MicroProfilerInterface* profiler);
+
+MicroProfilerInterface* GetKernelRegionProfiler();
+
+// Records a region for the lifetime of the object.
+class ScopedKernelRegion {
+ public:
+  explicit ScopedKernelRegion(const char* tag)
+      : handle_(TfLiteMicroRegionBegin(tag)) {}
+  ~ScopedKernelRegion() { TfLiteMicroRegionEnd(handle_); }
+
+ private:
+  uint32_t handle_;
+};
+
+}  // namespace tflite
+#endif  // __cplusplus
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNEL_REGION_PROFILER_H_
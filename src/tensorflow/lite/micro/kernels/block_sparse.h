@@ -0,0 +1,74 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_BLOCK_SPARSE_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_BLOCK_SPARSE_H_
+
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/block_sparsity.h"
+
+namespace tflite {
+
+// Shared state for int8 kernels whose weights are stored block-sparse (see
+// block_sparsity.h). Only the nonzero blocks are multiplied.
+struct OpDataBlockSparse {
+  // nullptr when the weights are dense.
+  const BlockSparseTensorData* sparsity;
+
+  // Per-row bias with the input offset folded in:
+  //   bias[row] + input_offset * sum(weights[row]).
+  int32_t* row_bias;
+};
+
+// Number of weights that are multiplied per input vector: only the nonzero
+// blocks if the weights are block-sparse, otherwise `dense_weights`.
+inline int32_t BlockSparseMultipliedWeights(const OpDataBlockSparse& data,
+                                            int32_t dense_weights) {
+  return data.sparsity != nullptr
+             ? data.sparsity->nonzero_blocks * data.sparsity->block_size
+             : dense_weights;
+}
+
+// Looks up the block-sparse layout of input `filter_index` of `node`. If it
+// exists, checks that the weights are int8 with a zero filter offset and
+// computes the folded row bias in persistent memory. Leaves
+// `data->sparsity` null for dense weights.
+TfLiteStatus PrepareBlockSparseInt8(TfLiteContext* context, TfLiteNode* node,
+                                    int filter_index,
+                                    const TfLiteTensor* filter,
+                                    const TfLiteTensor* bias,
+                                    int32_t input_offset,
+                                    OpDataBlockSparse* data);
+
+// Fails unless every input of `node` is stored dense. Kernels, and paths of
+// kernels, that do not understand block-sparse weights call this in Prepare
+// so that they never read a packed buffer as a full tensor.
+TfLiteStatus EnsureNoBlockSparseInputs(TfLiteContext* context,
+                                       TfLiteNode* node);
+
+// Multiplies `input` (one row_depth vector) by the packed block-sparse
+// weights and requantizes one int8 value per row into `output`. When
+// `per_channel` is false, multipliers[0] and shifts[0] apply to every row.
+void BlockSparseMatVecInt8(const OpDataBlockSparse& data,
+                           const int8_t* packed_weights, const int8_t* input,
+                           const int32_t* multipliers, const int32_t* shifts,
+                           bool per_channel, int32_t output_offset,
+                           int32_t activation_min, int32_t activation_max,
+                           int8_t* output);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_BLOCK_SPARSE_H_
@@ -0,0 +1,149 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <algorithm>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/block_sparse.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace tflite {
+namespace {
+
+int32_t DotProductInt8(const int8_t* input, const int8_t* weights,
+                       int32_t size) {
+  int32_t acc = 0;
+  int32_t i = 0;
+  for (; i <= size - 4; i += 4) {
+    acc += input[i] * weights[i] + input[i + 1] * weights[i + 1] +
+           input[i + 2] * weights[i + 2] + input[i + 3] * weights[i + 3];
+  }
+  for (; i < size; ++i) {
+    acc += input[i] * weights[i];
+  }
+  return acc;
+}
+
+}  // namespace
+
+TfLiteStatus PrepareBlockSparseInt8(TfLiteContext* context, TfLiteNode* node,
+                                    int filter_index,
+                                    const TfLiteTensor* filter,
+                                    const TfLiteTensor* bias,
+                                    int32_t input_offset,
+                                    OpDataBlockSparse* data) {
+  MicroContext* micro_context = GetMicroContext(context);
+  data->sparsity =
+      micro_context->GetTensorBlockSparsityData(node, filter_index);
+  data->row_bias = nullptr;
+  if (data->sparsity == nullptr) {
+    return kTfLiteOk;
+  }
+
+  const BlockSparseTensorData& sparsity = *data->sparsity;
+  TF_LITE_ENSURE_TYPES_EQ(context, filter->type, kTfLiteInt8);
+  TF_LITE_ENSURE_MSG(context, filter->params.zero_point == 0,
+                     "Block-sparse weights require a zero filter offset");
+  TF_LITE_ENSURE_EQ(context, sparsity.rows, SizeOfDimension(filter, 0));
+  TF_LITE_ENSURE_EQ(context, sparsity.rows * sparsity.row_depth,
+                    NumElements(filter));
+  TF_LITE_ENSURE(context, filter->data.int8 != nullptr);
+
+  data->row_bias = static_cast<int32_t*>(context->AllocatePersistentBuffer(
+      context, sparsity.rows * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, data->row_bias != nullptr);
+
+  const int32_t* bias_data =
+      bias != nullptr ? GetTensorData<int32_t>(bias) : nullptr;
+  const int8_t* weights = GetTensorData<int8_t>(filter);
+  int32_t block = 0;
+  for (int32_t row = 0; row < sparsity.rows; ++row) {
+    int32_t sum = 0;
+    for (int32_t i = 0; i < sparsity.blocks_per_row; ++i, ++block) {
+      if (!IsBlockPresent(sparsity, block)) {
+        continue;
+      }
+      for (int32_t j = 0; j < sparsity.block_size; ++j) {
+        sum += *weights++;
+      }
+    }
+    data->row_bias[row] =
+        (bias_data != nullptr ? bias_data[row] : 0) + input_offset * sum;
+  }
+
+  // The packed blocks are counted from the model buffer; add the mask.
+  MicroOpCost* cost = micro_context->GetCurrentOpCost();
+  if (cost != nullptr) {
+    cost->weight_bytes += (sparsity.rows * sparsity.blocks_per_row + 7) / 8;
+  }
+
+  return kTfLiteOk;
+}
+
+TfLiteStatus EnsureNoBlockSparseInputs(TfLiteContext* context,
+                                       TfLiteNode* node) {
+  MicroContext* micro_context = GetMicroContext(context);
+  for (int i = 0; i < node->inputs->size; ++i) {
+    TF_LITE_ENSURE_MSG(
+        context, micro_context->GetTensorBlockSparsityData(node, i) == nullptr,
+        "Block-sparse weights are not supported by this kernel or type");
+  }
+  return kTfLiteOk;
+}
+
+void BlockSparseMatVecInt8(const OpDataBlockSparse& data,
+                           const int8_t* packed_weights, const int8_t* input,
+                           const int32_t* multipliers, const int32_t* shifts,
+                           bool per_channel, int32_t output_offset,
+                           int32_t activation_min, int32_t activation_max,
+                           int8_t* output) {
+  const BlockSparseTensorData& sparsity = *data.sparsity;
+  const int32_t block_size = sparsity.block_size;
+  const uint8_t* mask = sparsity.block_mask;
+  int32_t block = 0;
+  for (int32_t row = 0; row < sparsity.rows; ++row) {
+    int32_t acc = data.row_bias[row];
+    const int8_t* block_input = input;
+    for (int32_t i = 0; i < sparsity.blocks_per_row; ++i, ++block) {
+      // Skip whole bytes of empty blocks at once.
+      if ((block & 7) == 0 && mask[block >> 3] == 0 &&
+          i + 8 <= sparsity.blocks_per_row) {
+        block += 7;
+        i += 7;
+        block_input += 8 * block_size;
+        continue;
+      }
+      if (IsBlockPresent(sparsity, block)) {
+        acc += DotProductInt8(block_input, packed_weights, block_size);
+        packed_weights += block_size;
+      }
+      block_input += block_size;
+    }
+
+    const int channel = per_channel ? row : 0;
+    acc = MultiplyByQuantizedMultiplier(acc, multipliers[channel],
+                                        shifts[channel]);
+    acc += output_offset;
+    acc = std::max(acc, activation_min);
+    acc = std::min(acc, activation_max);
+    output[row] = static_cast<int8_t>(acc);
+  }
+}
+
+}  // namespace tflite
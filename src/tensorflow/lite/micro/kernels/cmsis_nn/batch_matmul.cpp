@@ -25,6 +25,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/reference/transpose.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/block_sparse.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/micro_arena_constants.h"
 #include "tensorflow/lite/micro/micro_log.h"
@@ -184,6 +185,7 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   const auto params =
       static_cast<const TfLiteBatchMatMulParams*>(node->builtin_data);
   MicroContext* micro_context = GetMicroContext(context);
+  TF_LITE_ENSURE_STATUS(EnsureNoBlockSparseInputs(context, node));
   TfLiteTensor* lhs_input =
       micro_context->AllocateTempInputTensor(node, kBatchMatmulInputLhsTensor);
   TF_LITE_ENSURE(context, lhs_input != nullptr);
@@ -317,6 +319,11 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
         context, buf_size, &data->buffer_idx));
   }
 
+  MicroOpCost* cost = micro_context->GetCurrentOpCost();
+  if (cost != nullptr) {
+    cost->macs = static_cast<uint32_t>(NumElements(output)) * accum_dim_lhs;
+  }
+
   micro_context->DeallocateTempTfLiteTensor(output);
   micro_context->DeallocateTempTfLiteTensor(lhs_input);
   micro_context->DeallocateTempTfLiteTensor(rhs_input);
@@ -15,6 +15,8 @@ limitations under the License.
 
 #include "tensorflow/lite/micro/kernels/conv.h"
 
+#include <cstring>
+
 #include "third_party/cmsis_nn/Include/arm_nnfunctions.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
@@ -24,6 +26,8 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/padding.h"
+#include "tensorflow/lite/micro/kernels/block_sparse.h"
+#include "tensorflow/lite/micro/kernels/float_fast_ops.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/micro_log.h"
 
@@ -35,6 +39,9 @@ struct OpData {
 
   // Index to buffer for optimizations if applicable.
   int buffer_idx;
+
+  // Set when the weights are stored block-sparse.
+  OpDataBlockSparse block_sparse;
 };
 
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
@@ -42,6 +49,12 @@ void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   return context->AllocatePersistentBuffer(context, sizeof(OpData));
 }
 
+bool IsPointwiseWithoutPadding(const OpDataConv& op_data,
+                               const cmsis_nn_dims& filter_dims) {
+  return filter_dims.h == 1 && filter_dims.w == 1 &&
+         op_data.padding.height == 0 && op_data.padding.width == 0;
+}
+
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TFLITE_DCHECK(node->user_data != nullptr);
   TFLITE_DCHECK(node->builtin_data != nullptr);
@@ -79,6 +92,10 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
           (input->type == kTfLiteInt8 &&
            (filter->type == kTfLiteInt4 || filter->type == kTfLiteInt8)),
       "Hybrid models are not supported on TFLite Micro.");
+  // Only the int8 x int8 path understands block-sparse filters.
+  if (input->type != kTfLiteInt8 || filter->type != kTfLiteInt8) {
+    TF_LITE_ENSURE_STATUS(EnsureNoBlockSparseInputs(context, node));
+  }
 
   // Consistency check tensor dims
   // Dimensionality
@@ -119,23 +136,57 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   output_dims.w = output->dims->data[2];
   output_dims.c = output->dims->data[3];
 
+  bool per_channel_precomputed = false;
   if (input->type == kTfLiteInt8 || input->type == kTfLiteInt16) {
     const int num_channels = filter->dims->data[kConvQuantizedDimension];
-    data->reference_op_data.per_channel_output_multiplier =
-        static_cast<int32_t*>(context->AllocatePersistentBuffer(
-            context, num_channels * sizeof(int32_t)));
-    data->reference_op_data.per_channel_output_shift =
-        static_cast<int32_t*>(context->AllocatePersistentBuffer(
-            context, num_channels * sizeof(int32_t)));
+    // Tables precomputed into the model are read in place, from flash.
+    OfflineRequantizationData requantization;
+    per_channel_precomputed =
+        micro_context->GetOfflineRequantization(num_channels, &requantization);
+    if (per_channel_precomputed) {
+      data->reference_op_data.per_channel_output_multiplier =
+          const_cast<int32_t*>(requantization.multipliers);
+      data->reference_op_data.per_channel_output_shift =
+          const_cast<int32_t*>(requantization.shifts);
+    } else {
+      data->reference_op_data.per_channel_output_multiplier =
+          static_cast<int32_t*>(context->AllocatePersistentBuffer(
+              context, num_channels * sizeof(int32_t)));
+      data->reference_op_data.per_channel_output_shift =
+          static_cast<int32_t*>(context->AllocatePersistentBuffer(
+              context, num_channels * sizeof(int32_t)));
+    }
   }
 
   TF_LITE_ENSURE_STATUS(CalculateOpDataConv(
       context, node, params, input_dims.w, input_dims.h, filter_dims.w,
       filter_dims.h, output_dims.w, output_dims.h, input->type,
-      &data->reference_op_data));
+      &data->reference_op_data, per_channel_precomputed));
+
+  data->block_sparse.sparsity = nullptr;
+  if (input->type == kTfLiteInt8 && filter->type == kTfLiteInt8) {
+    TfLiteTensor* input_bias =
+        micro_context->AllocateTempInputTensor(node, kConvBiasTensor);
+    TfLiteStatus status = PrepareBlockSparseInt8(
+        context, node, kConvWeightsTensor, filter, input_bias,
+        -input->params.zero_point, &data->block_sparse);
+    if (input_bias != nullptr) {
+      micro_context->DeallocateTempTfLiteTensor(input_bias);
+    }
+    TF_LITE_ENSURE_STATUS(status);
+  }
 
-  // CMSIS_NN allows INT64 or nullptr bias data pointer
-  if (input->type == kTfLiteInt8 ||
+  if (data->block_sparse.sparsity != nullptr) {
+    TF_LITE_ENSURE_EQ(context, groups, 1);
+    // Patches are gathered into a scratch row unless the filter is a plain
+    // pointwise kernel that can read the input in place.
+    data->buffer_idx = -1;
+    if (!IsPointwiseWithoutPadding(data->reference_op_data, filter_dims)) {
+      TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+          context, data->block_sparse.sparsity->row_depth,
+          &data->buffer_idx));
+    }
+  } else if (input->type == kTfLiteInt8 ||
       (input->type == kTfLiteInt16 &&
        (bias_type == kTfLiteInt64 || bias_type == kTfLiteNoType))) {
     // Initialize cmsis_nn convolution parameters
@@ -169,6 +220,15 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     }
   }
 
+  // Every output pixel is one pass over the (group's) filter weights.
+  MicroOpCost* cost = micro_context->GetCurrentOpCost();
+  if (cost != nullptr) {
+    cost->macs = static_cast<uint32_t>(output_dims.n) * output_dims.h *
+                 output_dims.w *
+                 BlockSparseMultipliedWeights(data->block_sparse,
+                                              NumElements(filter));
+  }
+
   micro_context->DeallocateTempTfLiteTensor(output);
   micro_context->DeallocateTempTfLiteTensor(input);
   micro_context->DeallocateTempTfLiteTensor(filter);
@@ -322,6 +382,82 @@ TfLiteStatus EvalQuantizedPerChannel(TfLiteContext* context, TfLiteNode* node,
   return kTfLiteOk;
 }
 
+// Computes each output pixel as a block-sparse matrix-vector product over its
+// input patch, skipping the zero weight blocks.
+TfLiteStatus EvalBlockSparseInt8(TfLiteContext* context,
+                                 const TfLiteConvParams& params,
+                                 const OpData& data,
+                                 const TfLiteEvalTensor* input,
+                                 const TfLiteEvalTensor* filter,
+                                 TfLiteEvalTensor* output) {
+  const OpDataConv& op_data = data.reference_op_data;
+  const int batches = input->dims->data[0];
+  const int input_height = input->dims->data[1];
+  const int input_width = input->dims->data[2];
+  const int input_depth = input->dims->data[3];
+  const int filter_height = filter->dims->data[1];
+  const int filter_width = filter->dims->data[2];
+  const int output_height = output->dims->data[1];
+  const int output_width = output->dims->data[2];
+  const int output_depth = output->dims->data[3];
+  const int8_t pad_value = static_cast<int8_t>(op_data.input_zero_point);
+
+  const int8_t* input_data = tflite::micro::GetTensorData<int8_t>(input);
+  const int8_t* filter_data = tflite::micro::GetTensorData<int8_t>(filter);
+  int8_t* output_data = tflite::micro::GetTensorData<int8_t>(output);
+  int8_t* patch = data.buffer_idx > -1
+                      ? static_cast<int8_t*>(
+                            context->GetScratchBuffer(context, data.buffer_idx))
+                      : nullptr;
+
+  for (int b = 0; b < batches; ++b) {
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      const int in_y_origin =
+          out_y * params.stride_height - op_data.padding.height;
+      for (int out_x = 0; out_x < output_width; ++out_x) {
+        const int in_x_origin =
+            out_x * params.stride_width - op_data.padding.width;
+        const int8_t* row;
+        if (patch == nullptr) {
+          row = input_data +
+                ((b * input_height + in_y_origin) * input_width + in_x_origin) *
+                    input_depth;
+        } else {
+          int8_t* dst = patch;
+          for (int fy = 0; fy < filter_height; ++fy) {
+            const int in_y = in_y_origin + fy * params.dilation_height_factor;
+            for (int fx = 0; fx < filter_width; ++fx) {
+              const int in_x = in_x_origin + fx * params.dilation_width_factor;
+              if (in_y < 0 || in_y >= input_height || in_x < 0 ||
+                  in_x >= input_width) {
+                std::memset(dst, pad_value, input_depth);
+              } else {
+                const int8_t* src =
+                    input_data +
+                    ((b * input_height + in_y) * input_width + in_x) *
+                        input_depth;
+                std::memcpy(dst, src, input_depth);
+              }
+              dst += input_depth;
+            }
+          }
+          row = patch;
+        }
+        BlockSparseMatVecInt8(
+            data.block_sparse, filter_data, row,
+            op_data.per_channel_output_multiplier,
+            op_data.per_channel_output_shift, /*per_channel=*/true,
+            op_data.output_zero_point, op_data.output_activation_min,
+            op_data.output_activation_max,
+            output_data +
+                ((b * output_height + out_y) * output_width + out_x) *
+                    output_depth);
+      }
+    }
+  }
+  return kTfLiteOk;
+}
+
 TfLiteStatus EvalInt4(TfLiteContext* context, TfLiteNode* node) {
   const TfLiteEvalTensor* input =
       tflite::micro::GetEvalInput(context, node, kConvInputTensor);
@@ -362,6 +498,9 @@ TfLiteStatus EvalInt8(TfLiteContext* context, TfLiteNode* node) {
   TFLITE_DCHECK(node->user_data != nullptr);
   const OpData& data = *(static_cast<const OpData*>(node->user_data));
 
+  if (data.block_sparse.sparsity != nullptr) {
+    return EvalBlockSparseInt8(context, params, data, input, filter, output);
+  }
   return EvalQuantizedPerChannel<int8_t, int32_t, kTfLiteInt8>(
       context, node, params, data, input, filter, bias, output);
 }
@@ -425,17 +564,15 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 
   switch (input->type) {  // Already know in/out types are same.
     case kTfLiteFloat32: {
-      tflite::reference_ops::Conv(
-          ConvParamsFloat(params, data.reference_op_data),
-          tflite::micro::GetTensorShape(input),
-          tflite::micro::GetTensorData<float>(input),
-          tflite::micro::GetTensorShape(filter),
-          tflite::micro::GetTensorData<float>(filter),
-          tflite::micro::GetTensorShape(bias),
-          tflite::micro::GetOptionalTensorData<float>(bias),
-          tflite::micro::GetTensorShape(output),
-          tflite::micro::GetTensorData<float>(output),
-          tflite::micro::GetTensorShape(nullptr), nullptr);
+      float_ops::Conv(ConvParamsFloat(params, data.reference_op_data),
+                      tflite::micro::GetTensorShape(input),
+                      tflite::micro::GetTensorData<float>(input),
+                      tflite::micro::GetTensorShape(filter),
+                      tflite::micro::GetTensorData<float>(filter),
+                      tflite::micro::GetTensorShape(bias),
+                      tflite::micro::GetOptionalTensorData<float>(bias),
+                      tflite::micro::GetTensorShape(output),
+                      tflite::micro::GetTensorData<float>(output));
       break;
     }
     case kTfLiteInt8: {
@@ -445,6 +582,10 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
               context, node, params, data, input, filter, bias, output);
         }
         case kTfLiteInt8: {
+          if (data.block_sparse.sparsity != nullptr) {
+            return EvalBlockSparseInt8(context, params, data, input, filter,
+                                       output);
+          }
           return EvalQuantizedPerChannel<int8_t, int32_t, kTfLiteInt8>(
               context, node, params, data, input, filter, bias, output);
         }
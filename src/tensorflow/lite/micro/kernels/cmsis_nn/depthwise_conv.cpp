@@ -25,7 +25,9 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/padding.h"
+#include "tensorflow/lite/micro/kernels/block_sparse.h"
 #include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/float_fast_ops.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/micro_log.h"
 
@@ -64,6 +66,7 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
       *(reinterpret_cast<TfLiteDepthwiseConvParams*>(node->builtin_data));
 
   MicroContext* micro_context = GetMicroContext(context);
+  TF_LITE_ENSURE_STATUS(EnsureNoBlockSparseInputs(context, node));
 
   TfLiteTensor* input =
       micro_context->AllocateTempInputTensor(node, kDepthwiseConvInputTensor);
@@ -90,6 +93,7 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
       "Hybrid models are not supported on TFLite Micro.");
 
   const TfLiteType data_type = input->type;
+  bool per_channel_precomputed = false;
   int input_width = SizeOfDimension(input, 2);
   int input_height = SizeOfDimension(input, 1);
   int filter_width = SizeOfDimension(filter, 2);
@@ -124,18 +128,29 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     const int num_channels =
         filter->dims->data[kDepthwiseConvQuantizedDimension];
 
-    data->reference_op_data.per_channel_output_multiplier =
-        reinterpret_cast<int32_t*>(context->AllocatePersistentBuffer(
-            context, num_channels * sizeof(int32_t)));
-    data->reference_op_data.per_channel_output_shift =
-        reinterpret_cast<int32_t*>(context->AllocatePersistentBuffer(
-            context, num_channels * sizeof(int32_t)));
+    // Tables precomputed into the model are read in place, from flash.
+    OfflineRequantizationData requantization;
+    per_channel_precomputed =
+        micro_context->GetOfflineRequantization(num_channels, &requantization);
+    if (per_channel_precomputed) {
+      data->reference_op_data.per_channel_output_multiplier =
+          const_cast<int32_t*>(requantization.multipliers);
+      data->reference_op_data.per_channel_output_shift =
+          const_cast<int32_t*>(requantization.shifts);
+    } else {
+      data->reference_op_data.per_channel_output_multiplier =
+          reinterpret_cast<int32_t*>(context->AllocatePersistentBuffer(
+              context, num_channels * sizeof(int32_t)));
+      data->reference_op_data.per_channel_output_shift =
+          reinterpret_cast<int32_t*>(context->AllocatePersistentBuffer(
+              context, num_channels * sizeof(int32_t)));
+    }
   }
 
   TF_LITE_ENSURE_STATUS(CalculateOpDataDepthwiseConv(
       context, node, params, input_width, input_height, filter_width,
       filter_height, output_width, output_height, data_type,
-      &data->reference_op_data));
+      &data->reference_op_data, per_channel_precomputed));
 
   if (input->type == kTfLiteInt8) {
     RuntimeShape input_shape = GetTensorShape(input);
@@ -194,6 +209,15 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     }
   }
 
+  // The filter is [1, h, w, output channels]: one pass over it per output
+  // pixel.
+  MicroOpCost* cost = micro_context->GetCurrentOpCost();
+  if (cost != nullptr) {
+    cost->macs = static_cast<uint32_t>(NumElements(output) /
+                                       SizeOfDimension(output, 3)) *
+                 NumElements(filter);
+  }
+
   micro_context->DeallocateTempTfLiteTensor(output);
   micro_context->DeallocateTempTfLiteTensor(input);
   micro_context->DeallocateTempTfLiteTensor(filter);
@@ -391,7 +415,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 
   switch (input->type) {  // Already know in/out types are same.
     case kTfLiteFloat32: {
-      tflite::reference_ops::DepthwiseConv(
+      float_ops::DepthwiseConv(
           DepthwiseConvParamsFloat(params, data.reference_op_data),
           tflite::micro::GetTensorShape(input),
           tflite::micro::GetTensorData<float>(input),
@@ -24,6 +24,8 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/block_sparse.h"
+#include "tensorflow/lite/micro/kernels/float_fast_ops.h"
 #include "tensorflow/lite/micro/kernels/fully_connected.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/micro_arena_constants.h"
@@ -41,6 +43,9 @@ struct OpData {
 
   int32_t* kernel_sums;
 
+  // Set when the weights are stored block-sparse.
+  OpDataBlockSparse block_sparse;
+
   int32_t batches;
   int32_t accum_depth;
   int32_t output_depth;
@@ -85,6 +90,10 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
           (input->type == kTfLiteInt8 &&
            (filter->type == kTfLiteInt4 || filter->type == kTfLiteInt8)),
       "Hybrid models are not supported on TFLite Micro.");
+  // Only the int8 x int8 path understands block-sparse weights.
+  if (input->type != kTfLiteInt8 || filter->type != kTfLiteInt8) {
+    TF_LITE_ENSURE_STATUS(EnsureNoBlockSparseInputs(context, node));
+  }
 
   const RuntimeShape filter_shape = GetTensorShape(filter);
   const RuntimeShape output_shape = GetTensorShape(output);
@@ -119,8 +128,20 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
                     input->type == kTfLiteInt8 && filter->type != kTfLiteInt4));
 
   int32_t buf_size = 0;
+  data->block_sparse.sparsity = nullptr;
+
+  if (input->type == kTfLiteInt8 && filter->type == kTfLiteInt8) {
+    TF_LITE_ENSURE_STATUS(PrepareBlockSparseInt8(
+        context, node, kFullyConnectedWeightsTensor, filter, bias,
+        -data->reference_op_data.input_zero_point, &data->block_sparse));
+  }
 
-  if (input->type == kTfLiteInt16) {
+  if (data->block_sparse.sparsity != nullptr) {
+    // The sparse kernel needs no scratch memory and folds the kernel sums
+    // into its own row bias.
+    TF_LITE_ENSURE_EQ(context, data->block_sparse.sparsity->row_depth,
+                      data->accum_depth);
+  } else if (input->type == kTfLiteInt16) {
     TF_LITE_ENSURE_EQ(context, input->params.zero_point, 0);
     TF_LITE_ENSURE_EQ(context, output->params.zero_point, 0);
     buf_size = arm_fully_connected_s16_get_buffer_size(&filter_dims);
@@ -177,6 +198,15 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
         context, buf_size, &data->buffer_idx));
   }
 
+  // Every batch row is one pass over the weights.
+  MicroOpCost* cost = micro_context->GetCurrentOpCost();
+  if (cost != nullptr) {
+    const int32_t batches = NumElements(output) / SizeOfDimension(filter, 0);
+    cost->macs = static_cast<uint32_t>(batches) *
+                 BlockSparseMultipliedWeights(data->block_sparse,
+                                              NumElements(filter));
+  }
+
   micro_context->DeallocateTempTfLiteTensor(output);
   micro_context->DeallocateTempTfLiteTensor(input);
   micro_context->DeallocateTempTfLiteTensor(filter);
@@ -264,12 +294,44 @@ TfLiteStatus EvalQuantizedInt4(TfLiteContext* context, TfLiteNode* node,
   return kTfLiteOk;
 }
 
+TfLiteStatus EvalBlockSparseInt8(const OpData& data,
+                                 const TfLiteEvalTensor* input,
+                                 const TfLiteEvalTensor* filter,
+                                 TfLiteEvalTensor* output) {
+  const OpDataFullyConnected& op_data = data.reference_op_data;
+  const int32_t* multipliers = op_data.is_per_channel
+                                   ? op_data.per_channel_output_multiplier
+                                   : &op_data.output_multiplier;
+  const int32_t output_shift = op_data.output_shift;
+  const int32_t* shifts = op_data.is_per_channel
+                              ? op_data.per_channel_output_shift
+                              : &output_shift;
+
+  const int8_t* input_data = tflite::micro::GetTensorData<int8_t>(input);
+  const int8_t* filter_data = tflite::micro::GetTensorData<int8_t>(filter);
+  int8_t* output_data = tflite::micro::GetTensorData<int8_t>(output);
+  for (int b = 0; b < data.batches; ++b) {
+    BlockSparseMatVecInt8(data.block_sparse, filter_data,
+                          input_data + b * data.accum_depth, multipliers,
+                          shifts, op_data.is_per_channel,
+                          op_data.output_zero_point,
+                          op_data.output_activation_min,
+                          op_data.output_activation_max,
+                          output_data + b * data.output_depth);
+  }
+  return kTfLiteOk;
+}
+
 TfLiteStatus EvalQuantizedInt8(TfLiteContext* context, TfLiteNode* node,
                                const OpData& data,
                                const TfLiteEvalTensor* input,
                                const TfLiteEvalTensor* filter,
                                const TfLiteEvalTensor* bias,
                                TfLiteEvalTensor* output) {
+  if (data.block_sparse.sparsity != nullptr) {
+    return EvalBlockSparseInt8(data, input, filter, output);
+  }
+
   const RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
   const int output_dim_count = output_shape.DimensionsCount();
 
@@ -429,7 +491,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
     case kTfLiteFloat32: {
       const float* bias_data =
           tflite::micro::GetOptionalTensorData<float>(bias);
-      tflite::reference_ops::FullyConnected(
+      float_ops::FullyConnected(
           FullyConnectedParamsFloat(params->activation),
           tflite::micro::GetTensorShape(input),
           tflite::micro::GetTensorData<float>(input),
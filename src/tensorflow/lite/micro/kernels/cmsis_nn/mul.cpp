@@ -21,6 +21,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/reference/process_broadcast_shapes.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/float_fast_ops.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/mul.h"
 #include "tensorflow/lite/micro/memory_helpers.h"
@@ -29,6 +30,30 @@ limitations under the License.
 namespace tflite {
 namespace {
 
+void EvalFloat(TfLiteContext* context, TfLiteNode* node,
+               TfLiteMulParams* params, const OpDataMul* data,
+               const TfLiteEvalTensor* input1, const TfLiteEvalTensor* input2,
+               TfLiteEvalTensor* output) {
+  tflite::ArithmeticParams op_params = {};
+  op_params.float_activation_min = data->output_activation_min_f32;
+  op_params.float_activation_max = data->output_activation_max_f32;
+
+  bool need_broadcast = reference_ops::ProcessBroadcastShapes(
+      tflite::micro::GetTensorShape(input1),
+      tflite::micro::GetTensorShape(input2), &op_params);
+
+  if (need_broadcast) {
+    EvalMulFloatReference(context, node, params, data, input1, input2, output);
+  } else {
+    float_ops::Mul(op_params, tflite::micro::GetTensorShape(input1),
+                   tflite::micro::GetTensorData<float>(input1),
+                   tflite::micro::GetTensorShape(input2),
+                   tflite::micro::GetTensorData<float>(input2),
+                   tflite::micro::GetTensorShape(output),
+                   tflite::micro::GetTensorData<float>(output));
+  }
+}
+
 void EvalQuantized(TfLiteContext* context, TfLiteNode* node,
                    const OpDataMul* data, const TfLiteEvalTensor* input1,
                    const TfLiteEvalTensor* input2, TfLiteEvalTensor* output) {
@@ -121,8 +146,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       EvalMulQuantizedReference(context, node, data, input1, input2, output);
       break;
     case kTfLiteFloat32:
-      EvalMulFloatReference(context, node, params, data, input1, input2,
-                            output);
+      EvalFloat(context, node, params, data, input1, input2, output);
       break;
     default:
       MicroPrintf("Type %s (%d) not supported.",
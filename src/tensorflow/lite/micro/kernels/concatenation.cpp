@@ -12,8 +12,6 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
-#include "tensorflow/lite/kernels/internal/reference/concatenation.h"
-
 #include <cstdint>
 
 #include "tensorflow/lite/c/builtin_op_data.h"
@@ -22,6 +20,8 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/types.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/strided_copy.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
 #include "tensorflow/lite/micro/micro_log.h"
 
 namespace tflite {
@@ -34,6 +34,9 @@ constexpr int kOutputTensor = 0;
 struct OpData {
   ConcatenationParams params;
 
+  // One plan per input, copying it into its slot along the concat axis.
+  StridedCopyPlan* copy_plans;
+
 #ifdef USE_TFLM_COMPRESSION
 
   // scratch buffers for compressed tensors
@@ -51,30 +54,8 @@ inline int CalculatePositiveAxis(int axis, const TfLiteTensor* output_tensor) {
   }
 }
 
-// The following functions are helpers to get tensor data in the format that the
-// reference op implementation expects. They provide the same functionality as
-// class VectorOfTensors and class VectorOfQuantizedTensors in TFLite.
-
-// Gets shapes from a list of tensors.
-inline void GetAllInputTensorShapes(const TfLiteContext* context,
-                                    const TfLiteNode* node,
-                                    RuntimeShape all_shapes[kMaxInputNum]) {
-  for (int i = 0; i < node->inputs->size; ++i) {
-    const TfLiteEvalTensor* t = tflite::micro::GetEvalInput(context, node, i);
-    RuntimeShape shape = tflite::micro::GetTensorShape(t);
-    all_shapes[i].ReplaceWith(shape.DimensionsCount(), shape.DimsData());
-  }
-}
-
-// Get shape pointers from a list of shapes.
-inline void GetShapesPointers(const RuntimeShape* shapes, size_t num,
-                              const RuntimeShape* pointers[]) {
-  for (size_t i = 0; i < num; ++i) {
-    pointers[i] = &shapes[i];
-  }
-}
-
-// Gets data pointers from a list of tensors.
+// Gets data pointers from a list of tensors. This provides the same
+// functionality as class VectorOfTensors in TFLite.
 template <typename T>
 inline void GetAllInputTensorData(const TfLiteContext* context,
                                   const TfLiteNode* node,
@@ -99,24 +80,20 @@ inline void GetAllInputTensorData(const TfLiteContext* context,
 
 template <typename data_type>
 void EvalUnquantized(TfLiteContext* context, TfLiteNode* node) {
-  // Collect the shapes and data pointer of input tensors
-  RuntimeShape inputs_shape[kMaxInputNum];
-  const RuntimeShape* inputs_shape_ptr[kMaxInputNum];
   const data_type* inputs_data[kMaxInputNum];
   TFLITE_DCHECK(context != nullptr);
   TFLITE_DCHECK(node != nullptr);
   TFLITE_DCHECK(node->user_data != nullptr);
   const OpData* data = static_cast<const OpData*>(node->user_data);
-  GetAllInputTensorShapes(context, node, inputs_shape);
-  GetShapesPointers(inputs_shape, node->inputs->size, inputs_shape_ptr);
   GetAllInputTensorData(context, node, inputs_data);
 
   TfLiteEvalTensor* output =
       tflite::micro::GetEvalOutput(context, node, kOutputTensor);
+  data_type* output_data = tflite::micro::GetTensorData<data_type>(output);
 
-  reference_ops::Concatenation(data->params, inputs_shape_ptr, inputs_data,
-                               tflite::micro::GetTensorShape(output),
-                               tflite::micro::GetTensorData<data_type>(output));
+  for (int i = 0; i < data->params.inputs_count; ++i) {
+    RunStridedCopyPlan(data->copy_plans[i], inputs_data[i], output_data);
+  }
 }
 
 void* ConcatenationInit(TfLiteContext* context, const char* buffer,
@@ -126,8 +103,8 @@ void* ConcatenationInit(TfLiteContext* context, const char* buffer,
 }
 
 TfLiteStatus ConcatenationPrepare(TfLiteContext* context, TfLiteNode* node) {
-  // This function only checks the types. Additional shape validations are
-  // performed in the reference implementation called during Eval().
+  // Besides checking types and shapes, this compiles each input into a
+  // strided copy into the output so that Eval() only moves memory.
   const TfLiteConcatenationParams* params =
       reinterpret_cast<TfLiteConcatenationParams*>(node->builtin_data);
 
@@ -222,6 +199,52 @@ TfLiteStatus ConcatenationPrepare(TfLiteContext* context, TfLiteNode* node) {
       return kTfLiteError;
   }
 
+  // The output is viewed as [outer, output_axis_size * inner] and input i as
+  // [outer, input_axis_size * inner], written at a running offset.
+  const int axis = data->params.axis;
+  const int output_dims = NumDimensions(output_tensor);
+  TF_LITE_ENSURE(context, axis >= 0 && axis < output_dims);
+  int32_t outer_size = 1;
+  for (int d = 0; d < axis; ++d) {
+    outer_size *= SizeOfDimension(output_tensor, d);
+  }
+  int32_t inner_size = 1;
+  for (int d = axis + 1; d < output_dims; ++d) {
+    inner_size *= SizeOfDimension(output_tensor, d);
+  }
+  const int32_t output_row_size =
+      SizeOfDimension(output_tensor, axis) * inner_size;
+
+  size_t element_bytes;
+  TF_LITE_ENSURE_OK(context, TfLiteTypeSizeOf(output_type, &element_bytes));
+  data->copy_plans =
+      static_cast<StridedCopyPlan*>(context->AllocatePersistentBuffer(
+          context, num_inputs * sizeof(StridedCopyPlan)));
+  TF_LITE_ENSURE(context, data->copy_plans != nullptr);
+
+  int32_t output_offset = 0;
+  for (int i = 0; i < num_inputs; ++i) {
+    TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, i);
+    TF_LITE_ENSURE(context, input != nullptr);
+    TF_LITE_ENSURE_EQ(context, NumDimensions(input), output_dims);
+    for (int d = 0; d < output_dims; ++d) {
+      if (d != axis) {
+        TF_LITE_ENSURE_EQ(context, SizeOfDimension(input, d),
+                          SizeOfDimension(output_tensor, d));
+      }
+    }
+    const int32_t input_row_size = SizeOfDimension(input, axis) * inner_size;
+    const int32_t extents[] = {outer_size, input_row_size};
+    const int32_t src_strides[] = {input_row_size, 1};
+    const int32_t dst_strides[] = {output_row_size, 1};
+    BuildStridedCopyPlan(2, extents, src_strides, dst_strides,
+                         /*src_offset=*/0, output_offset, element_bytes,
+                         &data->copy_plans[i]);
+    output_offset += input_row_size;
+    micro_context->DeallocateTempTfLiteTensor(input);
+  }
+  TF_LITE_ENSURE_EQ(context, output_offset, output_row_size);
+
   micro_context->DeallocateTempTfLiteTensor(output_tensor);
 
   return kTfLiteOk;
@@ -75,12 +75,16 @@ ConvParams ConvParamsFloat(const TfLiteConvParams& params,
 ConvParams ConvParamsQuantized(const TfLiteConvParams& params,
                                const OpDataConv& data);
 
+// Fills in `data`, including the per-channel multipliers and shifts unless
+// `per_channel_precomputed` says the arrays already hold them, as they do
+// when they point at the model's offline requantization tables.
 TfLiteStatus CalculateOpDataConv(TfLiteContext* context, TfLiteNode* node,
                                  const TfLiteConvParams& params, int width,
                                  int height, int filter_width,
                                  int filter_height, int out_width,
                                  int out_height, const TfLiteType data_type,
-                                 OpDataConv* data);
+                                 OpDataConv* data,
+                                 bool per_channel_precomputed = false);
 
 void* ConvInit(TfLiteContext* context, const char* buffer, size_t length);
 
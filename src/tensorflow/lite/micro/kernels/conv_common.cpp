@@ -82,7 +82,8 @@ TfLiteStatus CalculateOpDataConv(TfLiteContext* context, TfLiteNode* node,
                                  int height, int filter_width,
                                  int filter_height, int out_width,
                                  int out_height, const TfLiteType data_type,
-                                 OpDataConv* data) {
+                                 OpDataConv* data,
+                                 bool per_channel_precomputed) {
   bool has_bias = node->inputs->size == 3;
   // Check number of inputs/outputs
   TF_LITE_ENSURE(context, has_bias || node->inputs->size == 2);
@@ -111,7 +112,11 @@ TfLiteStatus CalculateOpDataConv(TfLiteContext* context, TfLiteNode* node,
 
   // Note that quantized inference requires that all tensors have their
   // parameters set. This is usually done during quantized training.
-  if (data_type != kTfLiteFloat32) {
+  if (data_type != kTfLiteFloat32 && per_channel_precomputed) {
+    TF_LITE_ENSURE_STATUS(CalculateActivationRangeQuantized(
+        context, params.activation, output, &data->output_activation_min,
+        &data->output_activation_max));
+  } else if (data_type != kTfLiteFloat32) {
     int output_channels = filter->dims->data[kConvQuantizedDimension];
 
     TF_LITE_ENSURE_STATUS(tflite::PopulateConvolutionQuantizationParams(
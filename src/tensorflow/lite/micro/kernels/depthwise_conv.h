@@ -41,11 +41,15 @@ DepthwiseParams DepthwiseConvParamsFloat(
 DepthwiseParams DepthwiseConvParamsQuantized(
     const TfLiteDepthwiseConvParams& params, const OpDataConv& data);
 
+// Fills in `data`, including the per-channel multipliers and shifts unless
+// `per_channel_precomputed` says the arrays already hold them, as they do
+// when they point at the model's offline requantization tables.
 TfLiteStatus CalculateOpDataDepthwiseConv(
     TfLiteContext* context, TfLiteNode* node,
     const TfLiteDepthwiseConvParams& params, int width, int height,
     int filter_width, int filter_height, int out_width, int out_height,
-    const TfLiteType data_type, OpDataConv* data);
+    const TfLiteType data_type, OpDataConv* data,
+    bool per_channel_precomputed = false);
 
 TfLiteStatus DepthwiseConvPrepare(TfLiteContext* context, TfLiteNode* node);
 
@@ -99,7 +99,7 @@ struct OpData {
   CenterSizeEncoding scale_values;
 
   // Scratch buffers indexes
-  int active_candidate_idx;
+  int candidate_anchors_idx;
   int decoded_boxes_idx;
   int scores_idx;
   int score_buffer_idx;
@@ -185,7 +185,7 @@ TfLiteStatus DetectionPostProcessPrepare(TfLiteContext* context,
 
   // Scratch tensors
   context->RequestScratchBufferInArena(context, num_boxes,
-                                       &op_data->active_candidate_idx);
+                                       &op_data->candidate_anchors_idx);
   context->RequestScratchBufferInArena(context,
                                        num_boxes * kNumCoordBox * sizeof(float),
                                        &op_data->decoded_boxes_idx);
@@ -211,9 +211,12 @@ TfLiteStatus DetectionPostProcessPrepare(TfLiteContext* context,
   context->RequestScratchBufferInArena(
       context, op_data->max_detections * num_boxes * sizeof(int),
       &op_data->sorted_indices_idx);
+  // Fast NMS sorts the class indices of one anchor at a time and regular NMS
+  // keeps at most max_detections box indices, so this needs no num_boxes
+  // factor.
   int buffer_size = std::max(num_classes, op_data->max_detections);
-  context->RequestScratchBufferInArena(
-      context, buffer_size * num_boxes * sizeof(int), &op_data->buffer_idx);
+  context->RequestScratchBufferInArena(context, buffer_size * sizeof(int),
+                                       &op_data->buffer_idx);
   buffer_size = std::min(num_boxes, op_data->max_detections);
   context->RequestScratchBufferInArena(
       context, buffer_size * num_boxes * sizeof(int), &op_data->selected_idx);
@@ -254,6 +257,52 @@ T ReInterpretTensor(TfLiteEvalTensor* tensor) {
   return reinterpret_cast<T>(tensor_base);
 }
 
+// Marks the anchors that have at least one class score at or above the
+// non-max suppression score threshold. No other anchor can be selected, so
+// only these need their boxes decoded.
+TfLiteStatus SelectCandidateAnchors(TfLiteContext* context, TfLiteNode* node,
+                                    OpData* op_data) {
+  const TfLiteEvalTensor* input_box_encodings =
+      tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
+  const TfLiteEvalTensor* input_class_predictions =
+      tflite::micro::GetEvalInput(context, node, kInputTensorClassPredictions);
+  const int num_boxes = input_box_encodings->dims->data[1];
+  const int num_classes = op_data->num_classes;
+
+  TF_LITE_ENSURE_EQ(context, input_class_predictions->dims->data[0],
+                    kBatchSize);
+  TF_LITE_ENSURE_EQ(context, input_class_predictions->dims->data[1], num_boxes);
+  const int num_classes_with_background =
+      input_class_predictions->dims->data[2];
+
+  TF_LITE_ENSURE(context, (num_classes_with_background - num_classes <= 1));
+  TF_LITE_ENSURE(context, (num_classes_with_background >= num_classes));
+  // Unsupported type.
+  TF_LITE_ENSURE(context, input_class_predictions->type == kTfLiteFloat32);
+
+  const int label_offset = num_classes_with_background - num_classes;
+  const float threshold = op_data->non_max_suppression_score_threshold;
+  const float* scores =
+      tflite::micro::GetTensorData<float>(input_class_predictions);
+  uint8_t* candidate_anchors = reinterpret_cast<uint8_t*>(
+      context->GetScratchBuffer(context, op_data->candidate_anchors_idx));
+  for (int row = 0; row < num_boxes; ++row) {
+    const float* box_scores =
+        scores + row * num_classes_with_background + label_offset;
+    uint8_t is_candidate = 0;
+    for (int col = 0; col < num_classes; ++col) {
+      if (box_scores[col] >= threshold) {
+        is_candidate = 1;
+        break;
+      }
+    }
+    candidate_anchors[row] = is_candidate;
+  }
+  return kTfLiteOk;
+}
+
+// Fills in decoded_boxes for the candidate anchors. Boxes of the other
+// anchors are left undefined.
 TfLiteStatus DecodeCenterSizeBoxes(TfLiteContext* context, TfLiteNode* node,
                                    OpData* op_data) {
   // Parse input tensor boxencodings
@@ -264,12 +313,19 @@ TfLiteStatus DecodeCenterSizeBoxes(TfLiteContext* context, TfLiteNode* node,
   TF_LITE_ENSURE(context, input_box_encodings->dims->data[2] >= kNumCoordBox);
   const TfLiteEvalTensor* input_anchors =
       tflite::micro::GetEvalInput(context, node, kInputTensorAnchors);
+  const uint8_t* candidate_anchors = reinterpret_cast<const uint8_t*>(
+      context->GetScratchBuffer(context, op_data->candidate_anchors_idx));
+  BoxCornerEncoding* decoded_boxes = reinterpret_cast<BoxCornerEncoding*>(
+      context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
 
   // Decode the boxes to get (ymin, xmin, ymax, xmax) based on the anchors
   CenterSizeEncoding box_centersize;
   CenterSizeEncoding scale_values = op_data->scale_values;
   CenterSizeEncoding anchor;
   for (int idx = 0; idx < num_boxes; ++idx) {
+    if (!candidate_anchors[idx]) {
+      continue;
+    }
     switch (input_box_encodings->type) {
         // Float
       case kTfLiteFloat32: {
@@ -308,13 +364,13 @@ TfLiteStatus DecodeCenterSizeBoxes(TfLiteContext* context, TfLiteNode* node,
                                      static_cast<double>(scale_values.w))) *
                            static_cast<double>(anchor.w));
 
-    float* decoded_boxes = reinterpret_cast<float*>(
-        context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
-    auto& box = reinterpret_cast<BoxCornerEncoding*>(decoded_boxes)[idx];
+    auto& box = decoded_boxes[idx];
     box.ymin = ycenter - half_h;
     box.xmin = xcenter - half_w;
     box.ymax = ycenter + half_h;
     box.xmax = xcenter + half_w;
+    // ymax>=ymin, xmax>=xmin
+    TF_LITE_ENSURE(context, box.ymin < box.ymax && box.xmin < box.xmax);
   }
   return kTfLiteOk;
 }
@@ -328,57 +384,6 @@ void DecreasingPartialArgSort(const float* values, int num_values,
                     });
 }
 
-template <typename Compare>
-void InsertionSort(int* start, int* end, Compare compare) {
-  for (int* i = start; i != end; ++i) {
-    std::rotate(std::upper_bound(start, i, *i, compare), i, i + 1);
-  }
-}
-
-template <typename Compare>
-void TopDownMerge(int* values, int* scratch, const int half_num_values,
-                  int num_values, Compare compare) {
-  int left = 0;
-  int right = half_num_values;
-
-  for (int i = 0; i < num_values; i++) {
-    if (left >= half_num_values ||
-        (right < num_values && compare(values[right], values[left]))) {
-      scratch[i] = values[right++];
-    } else {
-      scratch[i] = values[left++];
-    }
-  }
-  memcpy(values, scratch, num_values * sizeof(int));
-}
-
-template <typename Compare>
-void MergeSort(int* values, int* scratch, const int num_values,
-               Compare compare) {
-  constexpr int threshold = 20;
-
-  if (num_values < threshold) {
-    InsertionSort(values, values + num_values, compare);
-    return;
-  }
-
-  const int half_num_values = num_values / 2;
-
-  MergeSort(values, scratch, half_num_values, compare);
-  MergeSort(values + half_num_values, scratch, num_values - half_num_values,
-            compare);
-  TopDownMerge(values, scratch, half_num_values, num_values, compare);
-}
-
-void DecreasingArgSort(const float* values, int num_values, int* indices,
-                       int* scratch) {
-  std::iota(indices, indices + num_values, 0);
-
-  MergeSort(indices, scratch, num_values, [&values](const int i, const int j) {
-    return values[i] > values[j];
-  });
-}
-
 int SelectDetectionsAboveScoreThreshold(const float* values, int size,
                                         const float threshold,
                                         float* keep_values, int* keep_indices) {
@@ -393,40 +398,39 @@ int SelectDetectionsAboveScoreThreshold(const float* values, int size,
   return counter;
 }
 
-bool ValidateBoxes(const float* decoded_boxes, const int num_boxes) {
-  for (int i = 0; i < num_boxes; ++i) {
-    // ymax>=ymin, xmax>=xmin
-    auto& box = reinterpret_cast<const BoxCornerEncoding*>(decoded_boxes)[i];
-    if (box.ymin >= box.ymax || box.xmin >= box.xmax) {
-      return false;
-    }
-  }
-  return true;
-}
-
-float ComputeIntersectionOverUnion(const float* decoded_boxes, const int i,
-                                   const int j) {
-  auto& box_i = reinterpret_cast<const BoxCornerEncoding*>(decoded_boxes)[i];
-  auto& box_j = reinterpret_cast<const BoxCornerEncoding*>(decoded_boxes)[j];
+// Returns true when the intersection over union of the two boxes exceeds
+// the threshold. Pairs that do not overlap along y or x, which is most of
+// them, exit before any multiplication. Decoded boxes always have
+// ymin < ymax and xmin < xmax.
+inline bool IsOverlapAboveThreshold(const BoxCornerEncoding& box_i,
+                                    const BoxCornerEncoding& box_j,
+                                    float iou_threshold) {
+  const float intersection_h =
+      std::min(box_i.ymax, box_j.ymax) - std::max(box_i.ymin, box_j.ymin);
+  if (intersection_h <= 0.0f) return false;
+  const float intersection_w =
+      std::min(box_i.xmax, box_j.xmax) - std::max(box_i.xmin, box_j.xmin);
+  if (intersection_w <= 0.0f) return false;
   const float area_i = (box_i.ymax - box_i.ymin) * (box_i.xmax - box_i.xmin);
   const float area_j = (box_j.ymax - box_j.ymin) * (box_j.xmax - box_j.xmin);
-  if (area_i <= 0 || area_j <= 0) return 0.0;
-  const float intersection_ymin = std::max<float>(box_i.ymin, box_j.ymin);
-  const float intersection_xmin = std::max<float>(box_i.xmin, box_j.xmin);
-  const float intersection_ymax = std::min<float>(box_i.ymax, box_j.ymax);
-  const float intersection_xmax = std::min<float>(box_i.xmax, box_j.xmax);
-  const float intersection_area =
-      std::max<float>(intersection_ymax - intersection_ymin, 0.0) *
-      std::max<float>(intersection_xmax - intersection_xmin, 0.0);
-  return intersection_area / (area_i + area_j - intersection_area);
+  if (area_i <= 0.0f || area_j <= 0.0f) return false;
+  // intersection / (area_i + area_j - intersection) > threshold, rearranged
+  // to avoid the division.
+  const float intersection_area = intersection_h * intersection_w;
+  return intersection_area >
+         iou_threshold * (area_i + area_j - intersection_area);
 }
 
 // NonMaxSuppressionSingleClass() prunes out the box locations with high overlap
-// before selecting the highest scoring boxes (max_detections in number)
-// It assumes all boxes are good in beginning and sorts based on the scores.
-// If lower-scoring box has too much overlap with a higher-scoring box,
-// we get rid of the lower-scoring box.
-// Complexity is O(N^2) pairwise comparison between boxes
+// before selecting the highest scoring boxes (max_detections in number).
+// All N boxes at or above the score threshold are put in one max-heap, built
+// in O(N). The heap is not limited to max_detections entries because
+// suppressed boxes have to be replaced by lower scoring ones. Boxes are popped
+// in decreasing score order (ties go to the lower box index), and a popped
+// box is selected unless it overlaps a box selected before it too much.
+// Popping stops as soon as max_detections boxes are selected, so the cost is
+// O(N + P * (log N + max_detections)) for P popped boxes instead of a full
+// sort plus O(N^2) pairwise comparisons.
 TfLiteStatus NonMaxSuppressionSingleClassHelper(
     TfLiteContext* context, TfLiteNode* node, OpData* op_data,
     const float* scores, int* selected, int* selected_size,
@@ -444,66 +448,47 @@ TfLiteStatus NonMaxSuppressionSingleClassHelper(
   // and should be less than 1.
   TF_LITE_ENSURE(context, (intersection_over_union_threshold > 0.0f) &&
                               (intersection_over_union_threshold <= 1.0f));
-  // Validate boxes
-  float* decoded_boxes = reinterpret_cast<float*>(
-      context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
-
-  TF_LITE_ENSURE(context, ValidateBoxes(decoded_boxes, num_boxes));
+  const BoxCornerEncoding* decoded_boxes =
+      reinterpret_cast<const BoxCornerEncoding*>(
+          context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
 
   // threshold scores
   int* keep_indices = reinterpret_cast<int*>(
       context->GetScratchBuffer(context, op_data->keep_indices_idx));
   float* keep_scores = reinterpret_cast<float*>(
       context->GetScratchBuffer(context, op_data->keep_scores_idx));
-  int num_scores_kept = SelectDetectionsAboveScoreThreshold(
+  const int num_scores_kept = SelectDetectionsAboveScoreThreshold(
       scores, num_boxes, non_max_suppression_score_threshold, keep_scores,
       keep_indices);
-  int* sorted_indices = reinterpret_cast<int*>(
-      context->GetScratchBuffer(context, op_data->sorted_indices_idx));
-
-  // Reusing keep_indices for scratch buffer and write back its values
-  // after the sorting is done.
-  DecreasingArgSort(keep_scores, num_scores_kept, sorted_indices, keep_indices);
-  int counter = 0;
-  for (int i = 0; i < num_boxes; i++) {
-    if (scores[i] >= non_max_suppression_score_threshold) {
-      keep_indices[counter] = i;
-      counter++;
-    }
-  }
 
-  const int num_boxes_kept = num_scores_kept;
-  const int output_size = std::min(num_boxes_kept, max_detections);
+  // Heap of positions in keep_scores/keep_indices.
+  int* heap = reinterpret_cast<int*>(
+      context->GetScratchBuffer(context, op_data->sorted_indices_idx));
+  auto lower_priority = [keep_scores](const int i, const int j) {
+    return keep_scores[i] < keep_scores[j] ||
+           (keep_scores[i] == keep_scores[j] && i > j);
+  };
+  std::iota(heap, heap + num_scores_kept, 0);
+  std::make_heap(heap, heap + num_scores_kept, lower_priority);
+
+  const int output_size = std::min(num_scores_kept, max_detections);
   *selected_size = 0;
-
-  int num_active_candidate = num_boxes_kept;
-  uint8_t* active_box_candidate = reinterpret_cast<uint8_t*>(
-      context->GetScratchBuffer(context, op_data->active_candidate_idx));
-
-  for (int row = 0; row < num_boxes_kept; row++) {
-    active_box_candidate[row] = 1;
-  }
-  for (int i = 0; i < num_boxes_kept; ++i) {
-    if (num_active_candidate == 0 || *selected_size >= output_size) break;
-    if (active_box_candidate[i] == 1) {
-      selected[(*selected_size)++] = keep_indices[sorted_indices[i]];
-      active_box_candidate[i] = 0;
-      num_active_candidate--;
-    } else {
-      continue;
-    }
-    for (int j = i + 1; j < num_boxes_kept; ++j) {
-      if (active_box_candidate[j] == 1) {
-        float intersection_over_union = ComputeIntersectionOverUnion(
-            decoded_boxes, keep_indices[sorted_indices[i]],
-            keep_indices[sorted_indices[j]]);
-
-        if (intersection_over_union > intersection_over_union_threshold) {
-          active_box_candidate[j] = 0;
-          num_active_candidate--;
-        }
+  int heap_size = num_scores_kept;
+  while (heap_size > 0 && *selected_size < output_size) {
+    std::pop_heap(heap, heap + heap_size, lower_priority);
+    const int candidate = keep_indices[heap[--heap_size]];
+    const BoxCornerEncoding& candidate_box = decoded_boxes[candidate];
+    bool suppressed = false;
+    for (int i = 0; i < *selected_size; ++i) {
+      if (IsOverlapAboveThreshold(decoded_boxes[selected[i]], candidate_box,
+                                  intersection_over_union_threshold)) {
+        suppressed = true;
+        break;
       }
     }
+    if (!suppressed) {
+      selected[(*selected_size)++] = candidate;
+    }
   }
 
   return kTfLiteOk;
@@ -571,35 +556,36 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
     TF_LITE_ENSURE_STATUS(NonMaxSuppressionSingleClassHelper(
         context, node, op_data, class_scores, selected, &selected_size,
         num_detections_per_class));
-    // Add selected indices from non-max suppression of boxes in this class
-    int output_index = size_of_sorted_indices;
-    for (int i = 0; i < selected_size; i++) {
-      int selected_index = selected[i];
-
-      box_indices_after_regular_non_max_suppression[output_index] =
-          (selected_index * num_classes_with_background + col + label_offset);
-      scores_after_regular_non_max_suppression[output_index] =
-          class_scores[selected_index];
-      output_index++;
-    }
-    // Sort the max scores among the selected indices
-    // Get the indices for top scores
-    int num_indices_to_sort = std::min(output_index, max_detections);
-    DecreasingPartialArgSort(scores_after_regular_non_max_suppression,
-                             output_index, num_indices_to_sort, sorted_indices);
-
-    // Copy values to temporary vectors
-    for (int row = 0; row < num_indices_to_sort; row++) {
-      int temp = sorted_indices[row];
-      sorted_indices[row] = box_indices_after_regular_non_max_suppression[temp];
-      sorted_values[row] = scores_after_regular_non_max_suppression[temp];
+    // Both the running top list and the boxes selected for this class are
+    // in decreasing score order, so merge them and keep the first
+    // max_detections. On equal scores the earlier class wins.
+    const int num_merged =
+        std::min(size_of_sorted_indices + selected_size, max_detections);
+    int previous = 0;
+    int current = 0;
+    for (int row = 0; row < num_merged; row++) {
+      if (current >= selected_size ||
+          (previous < size_of_sorted_indices &&
+           scores_after_regular_non_max_suppression[previous] >=
+               class_scores[selected[current]])) {
+        sorted_indices[row] =
+            box_indices_after_regular_non_max_suppression[previous];
+        sorted_values[row] = scores_after_regular_non_max_suppression[previous];
+        previous++;
+      } else {
+        const int selected_index = selected[current];
+        sorted_indices[row] =
+            selected_index * num_classes_with_background + col + label_offset;
+        sorted_values[row] = class_scores[selected_index];
+        current++;
+      }
     }
     // Copy scores and indices from temporary vectors
-    for (int row = 0; row < num_indices_to_sort; row++) {
+    for (int row = 0; row < num_merged; row++) {
       box_indices_after_regular_non_max_suppression[row] = sorted_indices[row];
       scores_after_regular_non_max_suppression[row] = sorted_values[row];
     }
-    size_of_sorted_indices = num_indices_to_sort;
+    size_of_sorted_indices = num_merged;
   }
 
   // Allocate output tensors
@@ -683,13 +669,16 @@ TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
   int* sorted_class_indices = reinterpret_cast<int*>(
       context->GetScratchBuffer(context, op_data->buffer_idx));
 
+  // Only the maximum class score is needed to rank the anchors; the top
+  // classes are sorted for the selected anchors only.
   for (int row = 0; row < num_boxes; row++) {
     const float* box_scores =
         scores + row * num_classes_with_background + label_offset;
-    int* class_indices = sorted_class_indices + row * num_classes;
-    DecreasingPartialArgSort(box_scores, num_classes, num_categories_per_anchor,
-                             class_indices);
-    max_scores[row] = box_scores[class_indices[0]];
+    float max_score = box_scores[0];
+    for (int col = 1; col < num_classes; ++col) {
+      max_score = std::max(max_score, box_scores[col]);
+    }
+    max_scores[row] = max_score;
   }
 
   // Perform non-maximal suppression on max scores
@@ -708,8 +697,9 @@ TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
 
     const float* box_scores =
         scores + selected_index * num_classes_with_background + label_offset;
-    const int* class_indices =
-        sorted_class_indices + selected_index * num_classes;
+    int* class_indices = sorted_class_indices;
+    DecreasingPartialArgSort(box_scores, num_classes, num_categories_per_anchor,
+                             class_indices);
 
     for (int col = 0; col < num_categories_per_anchor; ++col) {
       int box_offset = num_categories_per_anchor * output_box_index + col;
@@ -738,22 +728,10 @@ TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
 
 TfLiteStatus NonMaxSuppressionMultiClass(TfLiteContext* context,
                                          TfLiteNode* node, OpData* op_data) {
-  // Get the input tensors
-  const TfLiteEvalTensor* input_box_encodings =
-      tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
+  // Get the input tensors. Their shapes were checked in
+  // SelectCandidateAnchors().
   const TfLiteEvalTensor* input_class_predictions =
       tflite::micro::GetEvalInput(context, node, kInputTensorClassPredictions);
-  const int num_boxes = input_box_encodings->dims->data[1];
-  const int num_classes = op_data->num_classes;
-
-  TF_LITE_ENSURE_EQ(context, input_class_predictions->dims->data[0],
-                    kBatchSize);
-  TF_LITE_ENSURE_EQ(context, input_class_predictions->dims->data[1], num_boxes);
-  const int num_classes_with_background =
-      input_class_predictions->dims->data[2];
-
-  TF_LITE_ENSURE(context, (num_classes_with_background - num_classes <= 1));
-  TF_LITE_ENSURE(context, (num_classes_with_background >= num_classes));
 
   const float* scores;
   switch (input_class_predictions->type) {
@@ -787,6 +765,10 @@ TfLiteStatus DetectionPostProcessEval(TfLiteContext* context,
   // and do all calculations in float. Mixed quantized/float calculations are
   // currently not supported in TFLite.
 
+  // Anchors without any class score above the threshold can never be
+  // selected, so their boxes are not decoded.
+  TF_LITE_ENSURE_STATUS(SelectCandidateAnchors(context, node, op_data));
+
   // This fills in temporary decoded_boxes
   // by transforming input_box_encodings and input_anchors from
   // CenterSizeEncodings to BoxCornerEncoding
@@ -0,0 +1,418 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/float_fast_ops.h"
+
+#include <cmath>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/reference/add.h"
+#include "tensorflow/lite/kernels/internal/reference/conv.h"
+#include "tensorflow/lite/kernels/internal/reference/depthwiseconv_float.h"
+#include "tensorflow/lite/kernels/internal/reference/fully_connected.h"
+#include "tensorflow/lite/kernels/internal/reference/mul.h"
+
+namespace tflite {
+namespace float_ops {
+
+#if defined(TFLM_FLOAT_FAST_OPS)
+
+namespace {
+
+// Number of output channels computed together. Four accumulators plus the
+// shared input value and four weights fit comfortably in the 32 single
+// precision registers of the Cortex-M33 FPU.
+constexpr int kOutputBlock = 4;
+
+// fmaf() is a single instruction when the target has fused multiply-add
+// (VFMA.F32 on the M33). Elsewhere it is a slow library call, so use a
+// plain multiply and add.
+inline float MultiplyAdd(float a, float b, float acc) {
+#if defined(__ARM_FEATURE_FMA) || defined(__FMA__)
+  return fmaf(a, b, acc);
+#else
+  return a * b + acc;
+#endif
+}
+
+inline float Clamp(float value, float min, float max) {
+  return value < min ? min : (value > max ? max : value);
+}
+
+// acc[k] += dot(input, weights[k]) for kOutputBlock weight rows.
+inline void DotProductBlock(const float* input, const float* const* weights,
+                            int depth, float* acc) {
+  float acc0 = acc[0];
+  float acc1 = acc[1];
+  float acc2 = acc[2];
+  float acc3 = acc[3];
+  const float* w0 = weights[0];
+  const float* w1 = weights[1];
+  const float* w2 = weights[2];
+  const float* w3 = weights[3];
+  for (int d = 0; d < depth; ++d) {
+    const float x = input[d];
+    acc0 = MultiplyAdd(x, w0[d], acc0);
+    acc1 = MultiplyAdd(x, w1[d], acc1);
+    acc2 = MultiplyAdd(x, w2[d], acc2);
+    acc3 = MultiplyAdd(x, w3[d], acc3);
+  }
+  acc[0] = acc0;
+  acc[1] = acc1;
+  acc[2] = acc2;
+  acc[3] = acc3;
+}
+
+inline float DotProduct(const float* input, const float* weights, int depth) {
+  float acc0 = 0.0f;
+  float acc1 = 0.0f;
+  int d = 0;
+  for (; d <= depth - 2; d += 2) {
+    acc0 = MultiplyAdd(input[d], weights[d], acc0);
+    acc1 = MultiplyAdd(input[d + 1], weights[d + 1], acc1);
+  }
+  if (d < depth) {
+    acc0 = MultiplyAdd(input[d], weights[d], acc0);
+  }
+  return acc0 + acc1;
+}
+
+}  // namespace
+
+void FullyConnected(const FullyConnectedParams& params,
+                    const RuntimeShape& input_shape, const float* input_data,
+                    const RuntimeShape& weights_shape,
+                    const float* weights_data, const RuntimeShape& bias_shape,
+                    const float* bias_data, const RuntimeShape& output_shape,
+                    float* output_data) {
+  const float activation_min = params.float_activation_min;
+  const float activation_max = params.float_activation_max;
+  const int output_dims_count = output_shape.DimensionsCount();
+  const int weights_dims_count = weights_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dims_count - 1);
+  const int output_depth = MatchingDim(weights_shape, weights_dims_count - 2,
+                                       output_shape, output_dims_count - 1);
+  const int accum_depth = weights_shape.Dims(weights_dims_count - 1);
+
+  for (int b = 0; b < batches; ++b) {
+    const float* input = input_data + b * accum_depth;
+    float* output = output_data + b * output_depth;
+    int out_c = 0;
+    for (; out_c <= output_depth - kOutputBlock; out_c += kOutputBlock) {
+      float acc[kOutputBlock] = {};
+      const float* weights[kOutputBlock];
+      for (int k = 0; k < kOutputBlock; ++k) {
+        weights[k] = weights_data + (out_c + k) * accum_depth;
+        if (bias_data != nullptr) {
+          acc[k] = bias_data[out_c + k];
+        }
+      }
+      DotProductBlock(input, weights, accum_depth, acc);
+      for (int k = 0; k < kOutputBlock; ++k) {
+        output[out_c + k] = Clamp(acc[k], activation_min, activation_max);
+      }
+    }
+    for (; out_c < output_depth; ++out_c) {
+      float total =
+          DotProduct(input, weights_data + out_c * accum_depth, accum_depth);
+      if (bias_data != nullptr) {
+        total += bias_data[out_c];
+      }
+      output[out_c] = Clamp(total, activation_min, activation_max);
+    }
+  }
+}
+
+void Conv(const ConvParams& params, const RuntimeShape& input_shape,
+          const float* input_data, const RuntimeShape& filter_shape,
+          const float* filter_data, const RuntimeShape& bias_shape,
+          const float* bias_data, const RuntimeShape& output_shape,
+          float* output_data) {
+  const int input_depth = input_shape.Dims(3);
+  const int filter_input_depth = filter_shape.Dims(3);
+  if (input_depth != filter_input_depth) {
+    // Grouped convolutions are rare enough to leave on the reference path.
+    reference_ops::Conv(params, input_shape, input_data, filter_shape,
+                        filter_data, bias_shape, bias_data, output_shape,
+                        output_data, RuntimeShape(), nullptr);
+    return;
+  }
+
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const float activation_min = params.float_activation_min;
+  const float activation_max = params.float_activation_max;
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int filter_channel_stride = filter_height * filter_width * input_depth;
+
+  for (int batch = 0; batch < batches; ++batch) {
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      const int in_y_origin = (out_y * stride_height) - pad_height;
+      for (int out_x = 0; out_x < output_width; ++out_x) {
+        const int in_x_origin = (out_x * stride_width) - pad_width;
+        float* output =
+            output_data + Offset(output_shape, batch, out_y, out_x, 0);
+        int out_c = 0;
+        for (; out_c <= output_depth - kOutputBlock; out_c += kOutputBlock) {
+          float acc[kOutputBlock] = {};
+          for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+            const int in_y = in_y_origin + dilation_height_factor * filter_y;
+            if (in_y < 0 || in_y >= input_height) {
+              continue;
+            }
+            for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
+              const int in_x = in_x_origin + dilation_width_factor * filter_x;
+              if (in_x < 0 || in_x >= input_width) {
+                continue;
+              }
+              const float* input =
+                  input_data + Offset(input_shape, batch, in_y, in_x, 0);
+              const float* tap_filter =
+                  filter_data + Offset(filter_shape, out_c, filter_y,
+                                       filter_x, 0);
+              const float* weights[kOutputBlock];
+              for (int k = 0; k < kOutputBlock; ++k) {
+                weights[k] = tap_filter + k * filter_channel_stride;
+              }
+              DotProductBlock(input, weights, input_depth, acc);
+            }
+          }
+          for (int k = 0; k < kOutputBlock; ++k) {
+            const float bias = bias_data != nullptr ? bias_data[out_c + k] : 0;
+            output[out_c + k] =
+                Clamp(acc[k] + bias, activation_min, activation_max);
+          }
+        }
+        for (; out_c < output_depth; ++out_c) {
+          float total = 0.0f;
+          for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+            const int in_y = in_y_origin + dilation_height_factor * filter_y;
+            if (in_y < 0 || in_y >= input_height) {
+              continue;
+            }
+            for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
+              const int in_x = in_x_origin + dilation_width_factor * filter_x;
+              if (in_x < 0 || in_x >= input_width) {
+                continue;
+              }
+              total += DotProduct(
+                  input_data + Offset(input_shape, batch, in_y, in_x, 0),
+                  filter_data +
+                      Offset(filter_shape, out_c, filter_y, filter_x, 0),
+                  input_depth);
+            }
+          }
+          const float bias = bias_data != nullptr ? bias_data[out_c] : 0;
+          output[out_c] = Clamp(total + bias, activation_min, activation_max);
+        }
+      }
+    }
+  }
+}
+
+void DepthwiseConv(const DepthwiseParams& params,
+                   const RuntimeShape& input_shape, const float* input_data,
+                   const RuntimeShape& filter_shape, const float* filter_data,
+                   const RuntimeShape& bias_shape, const float* bias_data,
+                   const RuntimeShape& output_shape, float* output_data) {
+  if (params.depth_multiplier != 1) {
+    reference_ops::DepthwiseConv(params, input_shape, input_data, filter_shape,
+                                 filter_data, bias_shape, bias_data,
+                                 output_shape, output_data);
+    return;
+  }
+
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const float activation_min = params.float_activation_min;
+  const float activation_max = params.float_activation_max;
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+
+  // With a depth multiplier of one every channel is independent, so each
+  // tap becomes a channel-contiguous multiply-accumulate into the output
+  // row, which stays in place for the whole filter window.
+  for (int batch = 0; batch < batches; ++batch) {
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      const int in_y_origin = (out_y * stride_height) - pad_height;
+      for (int out_x = 0; out_x < output_width; ++out_x) {
+        const int in_x_origin = (out_x * stride_width) - pad_width;
+        float* output =
+            output_data + Offset(output_shape, batch, out_y, out_x, 0);
+        for (int c = 0; c < depth; ++c) {
+          output[c] = bias_data != nullptr ? bias_data[c] : 0.0f;
+        }
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+          const int in_y = in_y_origin + dilation_height_factor * filter_y;
+          if (in_y < 0 || in_y >= input_height) {
+            continue;
+          }
+          for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
+            const int in_x = in_x_origin + dilation_width_factor * filter_x;
+            if (in_x < 0 || in_x >= input_width) {
+              continue;
+            }
+            const float* input =
+                input_data + Offset(input_shape, batch, in_y, in_x, 0);
+            const float* filter =
+                filter_data + Offset(filter_shape, 0, filter_y, filter_x, 0);
+            int c = 0;
+            for (; c <= depth - 4; c += 4) {
+              const float acc0 = output[c];
+              const float acc1 = output[c + 1];
+              const float acc2 = output[c + 2];
+              const float acc3 = output[c + 3];
+              output[c] = MultiplyAdd(input[c], filter[c], acc0);
+              output[c + 1] = MultiplyAdd(input[c + 1], filter[c + 1], acc1);
+              output[c + 2] = MultiplyAdd(input[c + 2], filter[c + 2], acc2);
+              output[c + 3] = MultiplyAdd(input[c + 3], filter[c + 3], acc3);
+            }
+            for (; c < depth; ++c) {
+              output[c] = MultiplyAdd(input[c], filter[c], output[c]);
+            }
+          }
+        }
+        for (int c = 0; c < depth; ++c) {
+          output[c] = Clamp(output[c], activation_min, activation_max);
+        }
+      }
+    }
+  }
+}
+
+void Add(const ArithmeticParams& params, const RuntimeShape& input1_shape,
+         const float* input1_data, const RuntimeShape& input2_shape,
+         const float* input2_data, const RuntimeShape& output_shape,
+         float* output_data) {
+  const float activation_min = params.float_activation_min;
+  const float activation_max = params.float_activation_max;
+  const int flat_size =
+      MatchingElementsSize(input1_shape, input2_shape, output_shape);
+  int i = 0;
+  for (; i <= flat_size - 4; i += 4) {
+    const float v0 = input1_data[i] + input2_data[i];
+    const float v1 = input1_data[i + 1] + input2_data[i + 1];
+    const float v2 = input1_data[i + 2] + input2_data[i + 2];
+    const float v3 = input1_data[i + 3] + input2_data[i + 3];
+    output_data[i] = Clamp(v0, activation_min, activation_max);
+    output_data[i + 1] = Clamp(v1, activation_min, activation_max);
+    output_data[i + 2] = Clamp(v2, activation_min, activation_max);
+    output_data[i + 3] = Clamp(v3, activation_min, activation_max);
+  }
+  for (; i < flat_size; ++i) {
+    output_data[i] =
+        Clamp(input1_data[i] + input2_data[i], activation_min, activation_max);
+  }
+}
+
+void Mul(const ArithmeticParams& params, const RuntimeShape& input1_shape,
+         const float* input1_data, const RuntimeShape& input2_shape,
+         const float* input2_data, const RuntimeShape& output_shape,
+         float* output_data) {
+  const float activation_min = params.float_activation_min;
+  const float activation_max = params.float_activation_max;
+  const int flat_size =
+      MatchingExtendedShapeFlatSize(input1_shape, input2_shape, output_shape);
+  int i = 0;
+  for (; i <= flat_size - 4; i += 4) {
+    const float v0 = input1_data[i] * input2_data[i];
+    const float v1 = input1_data[i + 1] * input2_data[i + 1];
+    const float v2 = input1_data[i + 2] * input2_data[i + 2];
+    const float v3 = input1_data[i + 3] * input2_data[i + 3];
+    output_data[i] = Clamp(v0, activation_min, activation_max);
+    output_data[i + 1] = Clamp(v1, activation_min, activation_max);
+    output_data[i + 2] = Clamp(v2, activation_min, activation_max);
+    output_data[i + 3] = Clamp(v3, activation_min, activation_max);
+  }
+  for (; i < flat_size; ++i) {
+    output_data[i] =
+        Clamp(input1_data[i] * input2_data[i], activation_min, activation_max);
+  }
+}
+
+#else  // defined(TFLM_FLOAT_FAST_OPS)
+
+void FullyConnected(const FullyConnectedParams& params,
+                    const RuntimeShape& input_shape, const float* input_data,
+                    const RuntimeShape& weights_shape,
+                    const float* weights_data, const RuntimeShape& bias_shape,
+                    const float* bias_data, const RuntimeShape& output_shape,
+                    float* output_data) {
+  reference_ops::FullyConnected(params, input_shape, input_data, weights_shape,
+                                weights_data, bias_shape, bias_data,
+                                output_shape, output_data);
+}
+
+void Conv(const ConvParams& params, const RuntimeShape& input_shape,
+          const float* input_data, const RuntimeShape& filter_shape,
+          const float* filter_data, const RuntimeShape& bias_shape,
+          const float* bias_data, const RuntimeShape& output_shape,
+          float* output_data) {
+  reference_ops::Conv(params, input_shape, input_data, filter_shape,
+                      filter_data, bias_shape, bias_data, output_shape,
+                      output_data, RuntimeShape(), nullptr);
+}
+
+void DepthwiseConv(const DepthwiseParams& params,
+                   const RuntimeShape& input_shape, const float* input_data,
+                   const RuntimeShape& filter_shape, const float* filter_data,
+                   const RuntimeShape& bias_shape, const float* bias_data,
+                   const RuntimeShape& output_shape, float* output_data) {
+  reference_ops::DepthwiseConv(params, input_shape, input_data, filter_shape,
+                               filter_data, bias_shape, bias_data,
+                               output_shape, output_data);
+}
+
+void Add(const ArithmeticParams& params, const RuntimeShape& input1_shape,
+         const float* input1_data, const RuntimeShape& input2_shape,
+         const float* input2_data, const RuntimeShape& output_shape,
+         float* output_data) {
+  reference_ops::Add(params, input1_shape, input1_data, input2_shape,
+                     input2_data, output_shape, output_data);
+}
+
+void Mul(const ArithmeticParams& params, const RuntimeShape& input1_shape,
+         const float* input1_data, const RuntimeShape& input2_shape,
+         const float* input2_data, const RuntimeShape& output_shape,
+         float* output_data) {
+  reference_ops::Mul(params, input1_shape, input1_data, input2_shape,
+                     input2_data, output_shape, output_data);
+}
+
+#endif  // defined(TFLM_FLOAT_FAST_OPS)
+
+}  // namespace float_ops
+}  // namespace tflite
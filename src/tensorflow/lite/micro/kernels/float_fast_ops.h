@@ -0,0 +1,72 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_FLOAT_FAST_OPS_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_FLOAT_FAST_OPS_H_
+
+#include "tensorflow/lite/kernels/internal/types.h"
+
+// Float32 kernels for cores with a single-precision FPU (Cortex-M33 on
+// RP2350, and host builds). They keep several accumulators in FPU registers
+// and use fused multiply-add. Without an FPU (Cortex-M0+ on RP2040) every
+// float op is a soft-float library call, so these entry points forward to
+// reference_ops instead. Define TFLM_DISABLE_FLOAT_FAST_OPS to force the
+// reference kernels.
+#if !defined(TFLM_DISABLE_FLOAT_FAST_OPS) &&                     \
+    (defined(__ARM_FP) || defined(__x86_64__) || defined(__i386__) || \
+     defined(__aarch64__))
+#define TFLM_FLOAT_FAST_OPS 1
+#endif
+
+namespace tflite {
+namespace float_ops {
+
+// The functions below take the same arguments as their reference_ops
+// counterparts and fall back to them for cases they do not specialize.
+
+void FullyConnected(const FullyConnectedParams& params,
+                    const RuntimeShape& input_shape, const float* input_data,
+                    const RuntimeShape& weights_shape,
+                    const float* weights_data, const RuntimeShape& bias_shape,
+                    const float* bias_data, const RuntimeShape& output_shape,
+                    float* output_data);
+
+void Conv(const ConvParams& params, const RuntimeShape& input_shape,
+          const float* input_data, const RuntimeShape& filter_shape,
+          const float* filter_data, const RuntimeShape& bias_shape,
+          const float* bias_data, const RuntimeShape& output_shape,
+          float* output_data);
+
+void DepthwiseConv(const DepthwiseParams& params,
+                   const RuntimeShape& input_shape, const float* input_data,
+                   const RuntimeShape& filter_shape, const float* filter_data,
+                   const RuntimeShape& bias_shape, const float* bias_data,
+                   const RuntimeShape& output_shape, float* output_data);
+
+// Elementwise ops on same-shaped inputs. Broadcasting stays with the
+// reference BroadcastAdd4DSlow/BroadcastMul4DSlow.
+void Add(const ArithmeticParams& params, const RuntimeShape& input1_shape,
+         const float* input1_data, const RuntimeShape& input2_shape,
+         const float* input2_data, const RuntimeShape& output_shape,
+         float* output_data);
+
+void Mul(const ArithmeticParams& params, const RuntimeShape& input1_shape,
+         const float* input1_data, const RuntimeShape& input2_shape,
+         const float* input2_data, const RuntimeShape& output_shape,
+         float* output_data);
+
+}  // namespace float_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_FLOAT_FAST_OPS_H_
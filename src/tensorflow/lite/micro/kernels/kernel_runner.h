@@ -67,6 +67,20 @@ class KernelRunner {
   // to stub out MicroGraph methods and track invocations on each subgraph.
   MockMicroGraph* GetMockGraph() { return &mock_micro_graph_; }
 
+  // Marks tensors as block-sparse for kernels under test. Must be called
+  // before InitAndPrepare().
+  void SetBlockSparseTensors(
+      const BlockSparseTensorList* block_sparse_tensors) {
+    fake_micro_context_.SetBlockSparseTensors(block_sparse_tensors);
+  }
+
+  // Gives kernels under test precomputed requantization tables for
+  // `channels` output channels. Must be called before InitAndPrepare().
+  void SetOfflineRequantization(const OfflineRequantizationData* data,
+                                int channels) {
+    fake_micro_context_.SetOfflineRequantization(data, channels);
+  }
+
   // Returns true if all temp buffer in tests are deallocated.
   // TODO(b/209453859): move this function to private after deallocation checks
   // are enabled for all kernel tests.
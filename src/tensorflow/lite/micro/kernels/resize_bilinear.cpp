@@ -30,6 +30,106 @@ constexpr int kInputTensor = 0;
 constexpr int kSizeTensor = 1;
 constexpr int kOutputTensor = 0;
 
+// Source coordinate for one output row or column, in the 10 bit fixed point
+// representation used by reference_ops::ResizeBilinearInteger. `weight` is the
+// distance from `lower` in 1/1024 units and can be negative at the borders
+// when half_pixel_centers is set, exactly as in the reference kernel.
+struct InterpolationEntry {
+  int32_t lower;
+  int32_t upper;
+  int32_t weight;
+};
+
+struct OpData {
+  // Precomputed per-output-row and per-output-column tables for the int8
+  // path. Column entries are pre-multiplied by depth so they can be used as
+  // element offsets into an input row.
+  InterpolationEntry* row_table;
+  InterpolationEntry* col_table;
+  int32_t output_height;
+  int32_t output_width;
+};
+
+void* ResizeBilinearInit(TfLiteContext* context, const char* buffer,
+                         size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
+}
+
+int32_t ComputeScale10(int32_t input_size, int32_t output_size,
+                       bool align_corners) {
+  if (align_corners && output_size > 1) {
+    return ((1 << 10) * (input_size - 1) + (output_size - 1) / 2) /
+           (output_size - 1);
+  }
+  return ((1 << 10) * input_size + output_size / 2) / output_size;
+}
+
+void FillInterpolationTable(int32_t input_size, int32_t output_size,
+                            int32_t stride, bool align_corners,
+                            bool half_pixel_centers,
+                            InterpolationEntry* table) {
+  const int32_t scale_10 =
+      ComputeScale10(input_size, output_size, align_corners);
+  for (int32_t i = 0; i < output_size; ++i) {
+    int32_t scaled_value, lower, upper;
+    reference_ops::ComputeInterpolationValuesInteger(
+        i, scale_10, half_pixel_centers, input_size, &scaled_value, &lower,
+        &upper);
+    table[i].lower = lower * stride;
+    table[i].upper = upper * stride;
+    table[i].weight = scaled_value - (1 << 10) * lower;
+  }
+}
+
+// Bit exact with reference_ops::ResizeBilinearInteger<int8_t>. The four
+// bilinear weights are formed once per output pixel and the channel loop only
+// touches contiguous memory. All intermediate values fit in 32 bits: each
+// per-axis weight is bounded by 1536 in magnitude, so the sum of the four
+// products stays below 2^29 for int8 inputs.
+void ResizeBilinearInt8(const OpData& data, const RuntimeShape& input_shape,
+                        const int8_t* input_data, int8_t* output_data) {
+  const int32_t batches = input_shape.Dims(0);
+  const int32_t input_height = input_shape.Dims(1);
+  const int32_t input_width = input_shape.Dims(2);
+  const int32_t depth = input_shape.Dims(3);
+  const int32_t input_row_size = input_width * depth;
+
+  for (int32_t b = 0; b < batches; ++b) {
+    const int8_t* input_batch = input_data + b * input_height * input_row_size;
+    for (int32_t y = 0; y < data.output_height; ++y) {
+      const InterpolationEntry& row = data.row_table[y];
+      const int8_t* input_row0 = input_batch + row.lower * input_row_size;
+      const int8_t* input_row1 = input_batch + row.upper * input_row_size;
+      const int32_t wy1 = row.weight;
+      const int32_t wy0 = (1 << 10) - wy1;
+      for (int32_t x = 0; x < data.output_width; ++x) {
+        const InterpolationEntry& col = data.col_table[x];
+        const int32_t wx1 = col.weight;
+        const int32_t wx0 = (1 << 10) - wx1;
+        const int32_t w00 = wy0 * wx0;
+        const int32_t w10 = wy1 * wx0;
+        const int32_t w01 = wy0 * wx1;
+        const int32_t w11 = wy1 * wx1;
+        const int8_t* p00 = input_row0 + col.lower;
+        const int8_t* p10 = input_row1 + col.lower;
+        const int8_t* p01 = input_row0 + col.upper;
+        const int8_t* p11 = input_row1 + col.upper;
+        for (int32_t c = 0; c < depth; ++c) {
+          const int32_t output_20 = p00[c] * w00 + p10[c] * w10 +
+                                    p01[c] * w01 + p11[c] * w11;
+#if TFLITE_SINGLE_ROUNDING
+          *output_data++ = static_cast<int8_t>((output_20 + (1 << 19)) >> 20);
+#else
+          const int32_t round = (output_20 > 0) ? (1 << 19) : -(1 << 19);
+          *output_data++ = static_cast<int8_t>((output_20 + round) / (1 << 20));
+#endif  // TFLITE_SINGLE_ROUNDING
+        }
+      }
+    }
+  }
+}
+
 TfLiteStatus ResizeBilinearPrepare(TfLiteContext* context, TfLiteNode* node) {
   MicroContext* micro_context = GetMicroContext(context);
 
@@ -60,6 +160,32 @@ TfLiteStatus ResizeBilinearPrepare(TfLiteContext* context, TfLiteNode* node) {
     return kTfLiteError;
   }
 
+  if (input->type == kTfLiteInt8) {
+    TFLITE_DCHECK(node->user_data != nullptr);
+    OpData* data = static_cast<OpData*>(node->user_data);
+    const int32_t* size_data = GetTensorData<int32_t>(size);
+    data->output_height = size_data[0];
+    data->output_width = size_data[1];
+    TF_LITE_ENSURE(context, data->output_height > 0 && data->output_width > 0);
+
+    data->row_table =
+        static_cast<InterpolationEntry*>(context->AllocatePersistentBuffer(
+            context, data->output_height * sizeof(InterpolationEntry)));
+    data->col_table =
+        static_cast<InterpolationEntry*>(context->AllocatePersistentBuffer(
+            context, data->output_width * sizeof(InterpolationEntry)));
+    TF_LITE_ENSURE(context,
+                   data->row_table != nullptr && data->col_table != nullptr);
+
+    FillInterpolationTable(SizeOfDimension(input, 1), data->output_height,
+                           /*stride=*/1, params->align_corners,
+                           params->half_pixel_centers, data->row_table);
+    FillInterpolationTable(SizeOfDimension(input, 2), data->output_width,
+                           /*stride=*/SizeOfDimension(input, 3),
+                           params->align_corners, params->half_pixel_centers,
+                           data->col_table);
+  }
+
   micro_context->DeallocateTempTfLiteTensor(input);
   micro_context->DeallocateTempTfLiteTensor(size);
   micro_context->DeallocateTempTfLiteTensor(output);
@@ -89,16 +215,11 @@ TfLiteStatus ResizeBilinearEval(TfLiteContext* context, TfLiteNode* node) {
                                   tflite::micro::GetTensorShape(output),
                                   tflite::micro::GetTensorData<float>(output));
   } else if (output->type == kTfLiteInt8) {
-    tflite::ResizeBilinearParams op_params;
-    op_params.align_corners = params->align_corners;
-    op_params.half_pixel_centers = params->half_pixel_centers;
-    reference_ops::ResizeBilinearInteger(
-        op_params, tflite::micro::GetTensorShape(input),
-        tflite::micro::GetTensorData<int8_t>(input),
-        tflite::micro::GetTensorShape(size),
-        tflite::micro::GetTensorData<int32_t>(size),
-        tflite::micro::GetTensorShape(output),
-        tflite::micro::GetTensorData<int8_t>(output));
+    TFLITE_DCHECK(node->user_data != nullptr);
+    ResizeBilinearInt8(*static_cast<const OpData*>(node->user_data),
+                       tflite::micro::GetTensorShape(input),
+                       tflite::micro::GetTensorData<int8_t>(input),
+                       tflite::micro::GetTensorData<int8_t>(output));
   } else {
     MicroPrintf("Output type is %d, requires float or int8.", output->type);
     return kTfLiteError;
@@ -110,7 +231,7 @@ TfLiteStatus ResizeBilinearEval(TfLiteContext* context, TfLiteNode* node) {
 }  // namespace
 
 TFLMRegistration Register_RESIZE_BILINEAR() {
-  return tflite::micro::RegisterOp(nullptr, ResizeBilinearPrepare,
+  return tflite::micro::RegisterOp(ResizeBilinearInit, ResizeBilinearPrepare,
                                    ResizeBilinearEval);
 }
 
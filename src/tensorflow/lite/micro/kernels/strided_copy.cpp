@@ -0,0 +1,250 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/strided_copy.h"
+
+#include <cstring>
+
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+
+namespace tflite {
+namespace {
+
+// Tile edge for blocked transposes. A 16x16 tile of int8 is 256 bytes, which
+// keeps both the source column and destination row resident in the XIP cache
+// on RP2040/RP2350 and in L1 on host.
+constexpr int kTransposeTile = 16;
+
+template <typename T>
+void CopyElements(int32_t count, const char* src, int32_t src_stride,
+                  char* dst, int32_t dst_stride) {
+  for (int32_t i = 0; i < count; ++i) {
+    *reinterpret_cast<T*>(dst) = *reinterpret_cast<const T*>(src);
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+void CopyElementRun(int32_t count, int32_t element_bytes, const char* src,
+                    int32_t src_stride, char* dst, int32_t dst_stride) {
+  switch (element_bytes) {
+    case 1:
+      CopyElements<uint8_t>(count, src, src_stride, dst, dst_stride);
+      break;
+    case 2:
+      CopyElements<uint16_t>(count, src, src_stride, dst, dst_stride);
+      break;
+    case 4:
+      CopyElements<uint32_t>(count, src, src_stride, dst, dst_stride);
+      break;
+    case 8:
+      CopyElements<uint64_t>(count, src, src_stride, dst, dst_stride);
+      break;
+    default:
+      for (int32_t i = 0; i < count; ++i) {
+        std::memcpy(dst, src, element_bytes);
+        src += src_stride;
+        dst += dst_stride;
+      }
+      break;
+  }
+}
+
+// Copies rows x cols elements where the source is read column-wise and the
+// destination is written row-wise (or vice versa), visiting both in tiles.
+template <typename T>
+void BlockedTranspose(int32_t rows, int32_t cols, const char* src,
+                      int32_t src_row_stride, int32_t src_col_stride,
+                      char* dst, int32_t dst_row_stride,
+                      int32_t dst_col_stride) {
+  for (int32_t r0 = 0; r0 < rows; r0 += kTransposeTile) {
+    const int32_t r1 = r0 + kTransposeTile < rows ? r0 + kTransposeTile : rows;
+    for (int32_t c0 = 0; c0 < cols; c0 += kTransposeTile) {
+      const int32_t c1 =
+          c0 + kTransposeTile < cols ? c0 + kTransposeTile : cols;
+      for (int32_t r = r0; r < r1; ++r) {
+        const char* s = src + r * src_row_stride + c0 * src_col_stride;
+        char* d = dst + r * dst_row_stride + c0 * dst_col_stride;
+        for (int32_t c = c0; c < c1; ++c) {
+          *reinterpret_cast<T*>(d) = *reinterpret_cast<const T*>(s);
+          s += src_col_stride;
+          d += dst_col_stride;
+        }
+      }
+    }
+  }
+}
+
+void RunBlockedTranspose(const StridedCopyPlan& plan, int dim,
+                         const char* src, char* dst) {
+  const int32_t rows = plan.extents[dim];
+  const int32_t cols = plan.extents[dim + 1];
+  switch (plan.element_bytes) {
+    case 1:
+      BlockedTranspose<uint8_t>(rows, cols, src, plan.src_strides[dim],
+                                plan.src_strides[dim + 1], dst,
+                                plan.dst_strides[dim],
+                                plan.dst_strides[dim + 1]);
+      break;
+    case 2:
+      BlockedTranspose<uint16_t>(rows, cols, src, plan.src_strides[dim],
+                                 plan.src_strides[dim + 1], dst,
+                                 plan.dst_strides[dim],
+                                 plan.dst_strides[dim + 1]);
+      break;
+    case 4:
+      BlockedTranspose<uint32_t>(rows, cols, src, plan.src_strides[dim],
+                                 plan.src_strides[dim + 1], dst,
+                                 plan.dst_strides[dim],
+                                 plan.dst_strides[dim + 1]);
+      break;
+    default:
+      for (int32_t r = 0; r < rows; ++r) {
+        CopyElementRun(cols, plan.element_bytes,
+                       src + r * plan.src_strides[dim],
+                       plan.src_strides[dim + 1],
+                       dst + r * plan.dst_strides[dim],
+                       plan.dst_strides[dim + 1]);
+      }
+      break;
+  }
+}
+
+// Runs the innermost loop (or the innermost two for blocked transposes).
+void RunInnerLoops(const StridedCopyPlan& plan, const char* src, char* dst) {
+  const int inner = plan.num_dims - 1;
+  if (plan.blocked_transpose) {
+    RunBlockedTranspose(plan, inner - 1, src, dst);
+  } else if (plan.run_bytes == plan.element_bytes) {
+    CopyElementRun(plan.extents[inner], plan.element_bytes, src,
+                   plan.src_strides[inner], dst, plan.dst_strides[inner]);
+  } else {
+    for (int32_t i = 0; i < plan.extents[inner]; ++i) {
+      std::memcpy(dst, src, plan.run_bytes);
+      src += plan.src_strides[inner];
+      dst += plan.dst_strides[inner];
+    }
+  }
+}
+
+}  // namespace
+
+void BuildStridedCopyPlan(int num_dims, const int32_t* extents,
+                          const int32_t* src_strides,
+                          const int32_t* dst_strides, int32_t src_offset,
+                          int32_t dst_offset, int element_bytes,
+                          StridedCopyPlan* plan) {
+  TFLITE_DCHECK_LE(num_dims, kStridedCopyMaxDims);
+  plan->num_dims = 0;
+  plan->src_offset = src_offset * element_bytes;
+  plan->dst_offset = dst_offset * element_bytes;
+  plan->run_bytes = element_bytes;
+  plan->element_bytes = element_bytes;
+  plan->blocked_transpose = false;
+
+  // Drop unit dimensions and merge each dimension into the one outside it
+  // when both source and destination are contiguous across the boundary.
+  // Strides stay in elements until the end.
+  for (int i = 0; i < num_dims; ++i) {
+    if (extents[i] == 0) {
+      plan->num_dims = 0;
+      plan->run_bytes = 0;
+      return;
+    }
+    if (extents[i] == 1) {
+      continue;
+    }
+    const int last = plan->num_dims - 1;
+    if (last >= 0 &&
+        plan->src_strides[last] == extents[i] * src_strides[i] &&
+        plan->dst_strides[last] == extents[i] * dst_strides[i]) {
+      plan->extents[last] *= extents[i];
+      plan->src_strides[last] = src_strides[i];
+      plan->dst_strides[last] = dst_strides[i];
+      continue;
+    }
+    plan->extents[plan->num_dims] = extents[i];
+    plan->src_strides[plan->num_dims] = src_strides[i];
+    plan->dst_strides[plan->num_dims] = dst_strides[i];
+    ++plan->num_dims;
+  }
+
+  // A dense innermost dimension turns into a single memcpy per step.
+  int inner = plan->num_dims - 1;
+  if (inner >= 0 && plan->src_strides[inner] == 1 &&
+      plan->dst_strides[inner] == 1) {
+    plan->run_bytes = plan->extents[inner] * element_bytes;
+    --plan->num_dims;
+    --inner;
+  } else if (inner >= 1 && plan->dst_strides[inner] == 1 &&
+             plan->src_strides[inner - 1] == 1) {
+    plan->blocked_transpose = true;
+  }
+
+  for (int i = 0; i < plan->num_dims; ++i) {
+    plan->src_strides[i] *= element_bytes;
+    plan->dst_strides[i] *= element_bytes;
+  }
+}
+
+void BuildStridedCopyPlanDenseOutput(int num_dims, const int32_t* extents,
+                                     const int32_t* src_strides,
+                                     int32_t src_offset, int element_bytes,
+                                     StridedCopyPlan* plan) {
+  int32_t dst_strides[kStridedCopyMaxDims];
+  int32_t stride = 1;
+  for (int i = num_dims - 1; i >= 0; --i) {
+    dst_strides[i] = stride;
+    stride *= extents[i];
+  }
+  BuildStridedCopyPlan(num_dims, extents, src_strides, dst_strides,
+                       src_offset, /*dst_offset=*/0, element_bytes, plan);
+}
+
+void RunStridedCopyPlan(const StridedCopyPlan& plan, const void* src,
+                        void* dst) {
+  const char* src_base = static_cast<const char*>(src) + plan.src_offset;
+  char* dst_base = static_cast<char*>(dst) + plan.dst_offset;
+  if (plan.run_bytes == 0) {
+    return;
+  }
+  if (plan.num_dims == 0) {
+    std::memcpy(dst_base, src_base, plan.run_bytes);
+    return;
+  }
+
+  // Odometer over the loops that are not handled by RunInnerLoops.
+  const int outer_dims = plan.num_dims - (plan.blocked_transpose ? 2 : 1);
+  int32_t index[kStridedCopyMaxDims] = {};
+  while (true) {
+    RunInnerLoops(plan, src_base, dst_base);
+    int dim = outer_dims - 1;
+    for (; dim >= 0; --dim) {
+      src_base += plan.src_strides[dim];
+      dst_base += plan.dst_strides[dim];
+      if (++index[dim] < plan.extents[dim]) {
+        break;
+      }
+      src_base -= plan.src_strides[dim] * plan.extents[dim];
+      dst_base -= plan.dst_strides[dim] * plan.extents[dim];
+      index[dim] = 0;
+    }
+    if (dim < 0) {
+      return;
+    }
+  }
+}
+
+}  // namespace tflite
@@ -0,0 +1,68 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_STRIDED_COPY_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_STRIDED_COPY_H_
+
+#include <cstdint>
+
+namespace tflite {
+
+constexpr int kStridedCopyMaxDims = 6;
+
+// A pure data movement op (TRANSPOSE, STRIDED_SLICE, CONCATENATION, ...)
+// compiled at Prepare time into a loop nest of strided copies. Unit
+// dimensions are dropped and adjacent dimensions that are contiguous in both
+// source and destination are merged, so the innermost step is usually a
+// single memcpy of `run_bytes`. All strides and offsets are in bytes and may
+// be negative (reversed slices).
+struct StridedCopyPlan {
+  // Number of loops around the innermost run, outermost first.
+  int num_dims;
+  int32_t extents[kStridedCopyMaxDims];
+  int32_t src_strides[kStridedCopyMaxDims];
+  int32_t dst_strides[kStridedCopyMaxDims];
+  int32_t src_offset;
+  int32_t dst_offset;
+  // Bytes copied contiguously by each innermost step. Zero for empty copies.
+  int32_t run_bytes;
+  int32_t element_bytes;
+  // True when the two innermost loops form a 2D transpose of single elements,
+  // which is then executed in cache-sized tiles.
+  bool blocked_transpose;
+};
+
+// Builds a plan from a loop nest expressed in elements, outermost first.
+// `num_dims` must not exceed kStridedCopyMaxDims.
+void BuildStridedCopyPlan(int num_dims, const int32_t* extents,
+                          const int32_t* src_strides,
+                          const int32_t* dst_strides, int32_t src_offset,
+                          int32_t dst_offset, int element_bytes,
+                          StridedCopyPlan* plan);
+
+// Convenience wrapper for the common case where the destination is written
+// densely in loop order.
+void BuildStridedCopyPlanDenseOutput(int num_dims, const int32_t* extents,
+                                     const int32_t* src_strides,
+                                     int32_t src_offset, int element_bytes,
+                                     StridedCopyPlan* plan);
+
+// Executes `plan`, reading from `src` and writing to `dst`.
+void RunStridedCopyPlan(const StridedCopyPlan& plan, const void* src,
+                        void* dst);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_STRIDED_COPY_H_
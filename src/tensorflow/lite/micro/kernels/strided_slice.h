@@ -20,6 +20,8 @@ limitations under the License.
 
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+#include "tensorflow/lite/micro/kernels/strided_copy.h"
 #include "tensorflow/lite/micro/micro_common.h"
 
 namespace tflite {
@@ -30,6 +32,12 @@ constexpr int kStridedSliceEndTensor = 2;
 constexpr int kStridedSliceStridesTensor = 3;
 constexpr int kStridedSliceOutputTensor = 0;
 
+struct OpDataStridedSlice {
+  StridedSliceParams params;
+  // The slice resolved against the input shape at Prepare time.
+  StridedCopyPlan copy_plan;
+};
+
 void* StridedSliceInit(TfLiteContext* context, const char* buffer,
                        size_t length);
 
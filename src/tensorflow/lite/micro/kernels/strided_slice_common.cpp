@@ -23,6 +23,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/op_macros.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/strided_slice.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
 #include "tensorflow/lite/micro/micro_log.h"
 
 namespace tflite {
@@ -124,26 +125,89 @@ TfLiteStatus CheckOutputSize(TfLiteContext* context,
   return kTfLiteOk;
 }
 
+// Resolves begin/end/strides against the input shape the same way
+// reference_ops::StridedSlice does (padded to 5D) and compiles the result into
+// a strided copy plan.
+TfLiteStatus BuildCopyPlan(TfLiteContext* context,
+                           StridedSliceContext* op_context,
+                           const StridedSliceParams& op_params,
+                           StridedCopyPlan* plan) {
+  constexpr int kPaddedDims = 5;
+  StridedSliceParams params_copy = op_params;
+  strided_slice::StridedSlicePadIndices(&params_copy, kPaddedDims);
+  const RuntimeShape input_shape = RuntimeShape::ExtendedShape(
+      kPaddedDims, GetTensorShape(op_context->input));
+
+  int32_t input_strides[kPaddedDims];
+  int32_t axis_stride = 1;
+  for (int i = kPaddedDims - 1; i >= 0; --i) {
+    input_strides[i] = axis_stride;
+    axis_stride *= input_shape.Dims(i);
+  }
+
+  int32_t extents[kPaddedDims];
+  int32_t src_strides[kPaddedDims];
+  int32_t src_offset = 0;
+  for (int i = 0; i < kPaddedDims; ++i) {
+    const int32_t start =
+        strided_slice::StridedSliceStartForAxis(params_copy, input_shape, i);
+    const int32_t stop = strided_slice::StridedSliceEndForAxis(
+        params_copy, input_shape, i, start);
+    const int32_t stride = params_copy.strides[i];
+    int32_t count = 0;
+    if (stride > 0 && stop > start) {
+      count = (stop - start + stride - 1) / stride;
+    } else if (stride < 0 && start > stop) {
+      count = (start - stop - stride - 1) / -stride;
+    }
+    extents[i] = count;
+    src_strides[i] = stride * input_strides[i];
+    if (count > 0) {
+      src_offset += start * input_strides[i];
+    }
+  }
+
+  size_t element_bytes;
+  TF_LITE_ENSURE_OK(context, TfLiteTypeSizeOf(op_context->input->type,
+                                              &element_bytes));
+  BuildStridedCopyPlanDenseOutput(kPaddedDims, extents, src_strides,
+                                  src_offset, element_bytes, plan);
+  return kTfLiteOk;
+}
+
 }  // namespace
 
 void* StridedSliceInit(TfLiteContext* context, const char* buffer,
                        size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
-  return context->AllocatePersistentBuffer(context, sizeof(StridedSliceParams));
+  return context->AllocatePersistentBuffer(context, sizeof(OpDataStridedSlice));
 }
 
 TfLiteStatus StridedSlicePrepare(TfLiteContext* context, TfLiteNode* node) {
   TFLITE_DCHECK(node->user_data != nullptr);
-  StridedSliceParams* op_params =
-      static_cast<StridedSliceParams*>(node->user_data);
+  OpDataStridedSlice* data = static_cast<OpDataStridedSlice*>(node->user_data);
   TF_LITE_ENSURE_EQ(context, NumInputs(node), 4);
   TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
   StridedSliceContext op_context(context, node);
   TF_LITE_ENSURE_MSG(context, op_context.dims <= kMaxDim,
                      "input dim should not exceed 4");
+  switch (op_context.input->type) {
+    case kTfLiteFloat32:
+    case kTfLiteInt8:
+    case kTfLiteInt16:
+    case kTfLiteInt32:
+    case kTfLiteBool:
+      break;
+    default:
+      MicroPrintf("Type %s (%d) not supported.",
+                  TfLiteTypeGetName(op_context.input->type),
+                  op_context.input->type);
+      return kTfLiteError;
+  }
   auto params = BuildStridedSliceParams(&op_context);
-  memcpy(op_params, &params, sizeof(StridedSliceParams));
-  return CheckOutputSize(context, &op_context);
+  memcpy(&data->params, &params, sizeof(StridedSliceParams));
+  TF_LITE_ENSURE_OK(context, CheckOutputSize(context, &op_context));
+  return BuildCopyPlan(context, &op_context, data->params, &data->copy_plan);
 }
 
 }  // namespace tflite
@@ -12,13 +12,13 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
-#include "tensorflow/lite/kernels/internal/reference/transpose.h"
-
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/internal/types.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/strided_copy.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
 #include "tensorflow/lite/micro/micro_log.h"
 
 namespace tflite {
@@ -28,6 +28,35 @@ constexpr int kInputTensor = 0;
 constexpr int kPermTensor = 1;
 constexpr int kOutputTensor = 0;
 
+struct OpData {
+  StridedCopyPlan copy_plan;
+  // A non-constant perm can change between invocations, so its plan is
+  // rebuilt in Eval.
+  bool perm_is_constant;
+};
+
+// Output axis i walks input axis perm[i], so the whole op reduces to a
+// strided copy over the output.
+void BuildTransposePlan(const TfLiteIntArray* input_dims,
+                        const int32_t* perm_data, size_t element_bytes,
+                        StridedCopyPlan* plan) {
+  const int dims = input_dims->size;
+  int32_t input_strides[kStridedCopyMaxDims];
+  int32_t stride = 1;
+  for (int i = dims - 1; i >= 0; --i) {
+    input_strides[i] = stride;
+    stride *= input_dims->data[i];
+  }
+  int32_t extents[kStridedCopyMaxDims];
+  int32_t src_strides[kStridedCopyMaxDims];
+  for (int i = 0; i < dims; ++i) {
+    extents[i] = input_dims->data[perm_data[i]];
+    src_strides[i] = input_strides[perm_data[i]];
+  }
+  BuildStridedCopyPlanDenseOutput(dims, extents, src_strides,
+                                  /*src_offset=*/0, element_bytes, plan);
+}
+
 struct TransposeContext {
   TransposeContext(TfLiteContext* context, TfLiteNode* node) {
     micro_context = GetMicroContext(context);
@@ -46,6 +75,12 @@ struct TransposeContext {
   TfLiteTensor* output;
 };
 
+void* TransposeInit(TfLiteContext* context, const char* buffer,
+                    size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
+}
+
 TfLiteStatus TransposePrepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_EQ(context, NumInputs(node), 2);
   TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
@@ -69,47 +104,55 @@ TfLiteStatus TransposePrepare(TfLiteContext* context, TfLiteNode* node) {
                        "Transpose op permutations array is out of bounds.");
   }
 
+  // Transpose kernel only does rearranging values not numeric evaluations
+  // on each cell, so it only needs the element size.
+  if (op_context.input->type != kTfLiteFloat32 &&
+      op_context.input->type != kTfLiteInt8) {
+    MicroPrintf(
+        "Type %s is currently not supported by Transpose. "
+        "Only float32 and int8 is supported",
+        TfLiteTypeGetName(op_context.input->type));
+    return kTfLiteError;
+  }
+
+  TFLITE_DCHECK(node->user_data != nullptr);
+  OpData* data = static_cast<OpData*>(node->user_data);
+  data->perm_is_constant = IsConstantTensor(op_context.perm);
+  size_t element_bytes;
+  TF_LITE_ENSURE_OK(context, TfLiteTypeSizeOf(op_context.input->type,
+                                              &element_bytes));
+  BuildTransposePlan(op_context.input->dims, perm_data, element_bytes,
+                     &data->copy_plan);
+
   return kTfLiteOk;
 }
 
 TfLiteStatus TransposeEval(TfLiteContext* context, TfLiteNode* node) {
-  const TfLiteEvalTensor* perm_tensor =
-      tflite::micro::GetEvalInput(context, node, kPermTensor);
-  const int32_t* perm_data = perm_tensor->data.i32;
-  const int size = perm_tensor->dims->data[0];
-  TransposeParams params;
-  params.perm_count = size;
-  for (int i = 0; i < size; ++i) {
-    params.perm[i] = perm_data[i];
-  }
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpData* data = static_cast<const OpData*>(node->user_data);
 
-  // Transpose kernel only does rearranging values not numeric evaluations
-  // on each cell. It's safe to implement per size of scalar type and this
-  // trick keeps the total code size in a reasonable range.
   const TfLiteEvalTensor* input =
       tflite::micro::GetEvalInput(context, node, kInputTensor);
   TfLiteEvalTensor* output =
       tflite::micro::GetEvalOutput(context, node, kOutputTensor);
-  switch (input->type) {
-    case kTfLiteFloat32:
-      reference_ops::Transpose(params, tflite::micro::GetTensorShape(input),
-                               tflite::micro::GetTensorData<float>(input),
-                               tflite::micro::GetTensorShape(output),
-                               tflite::micro::GetTensorData<float>(output));
-      break;
-    case kTfLiteInt8:
-      reference_ops::Transpose(params, tflite::micro::GetTensorShape(input),
-                               tflite::micro::GetTensorData<int8_t>(input),
-                               tflite::micro::GetTensorShape(output),
-                               tflite::micro::GetTensorData<int8_t>(output));
-      break;
-    default:
-      MicroPrintf(
-          "Type %s is currently not supported by Transpose. "
-          "Only float32 and int8 is supported",
-          TfLiteTypeGetName(input->type));
-      return kTfLiteError;
+  if (data->perm_is_constant) {
+    RunStridedCopyPlan(data->copy_plan, input->data.raw, output->data.raw);
+    return kTfLiteOk;
+  }
+
+  const TfLiteEvalTensor* perm =
+      tflite::micro::GetEvalInput(context, node, kPermTensor);
+  const int32_t* perm_data = tflite::micro::GetTensorData<int32_t>(perm);
+  const int dims = input->dims->size;
+  for (int idx = 0; idx < dims; ++idx) {
+    TF_LITE_ENSURE_MSG(context, (perm_data[idx] >= 0 && perm_data[idx] < dims),
+                       "Transpose op permutations array is out of bounds.");
   }
+  size_t element_bytes;
+  TF_LITE_ENSURE_OK(context, TfLiteTypeSizeOf(input->type, &element_bytes));
+  StridedCopyPlan copy_plan;
+  BuildTransposePlan(input->dims, perm_data, element_bytes, &copy_plan);
+  RunStridedCopyPlan(copy_plan, input->data.raw, output->data.raw);
 
   return kTfLiteOk;
 }
@@ -117,6 +160,7 @@ TfLiteStatus TransposeEval(TfLiteContext* context, TfLiteNode* node) {
 }  // namespace
 
 TFLMRegistration Register_TRANSPOSE() {
-  return tflite::micro::RegisterOp(nullptr, TransposePrepare, TransposeEval);
+  return tflite::micro::RegisterOp(TransposeInit, TransposePrepare,
+                                   TransposeEval);
 }
 }  // namespace tflite
@@ -15,8 +15,10 @@ limitations under the License.
 
 #include "tensorflow/lite/micro/micro_allocator.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 #include "third_party/flatbuffers/include/flatbuffers/flatbuffers.h"
 #include "tensorflow/lite/c/common.h"
@@ -35,12 +37,10 @@ limitations under the License.
 #include "tensorflow/lite/micro/micro_log.h"
 #include "tensorflow/lite/micro/tflite_bridge/flatbuffer_conversions_bridge.h"
 #include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
 
 #ifdef USE_TFLM_COMPRESSION
 
-#include <algorithm>
-#include <cstring>
-
 #include "tensorflow/lite/micro/compression/metadata_saved.h"
 
 #endif  // USE_TFLM_COMPRESSION
@@ -186,6 +186,21 @@ INonPersistentBufferAllocator* CreateNonPersistentArenaAllocator(
   return non_persistent_buffer_allocator;
 }
 
+// Block-sparse and compressed tensors store fewer bytes than their shape.
+bool IsPackedTensor(const SubgraphAllocations& allocations, size_t tensor_idx) {
+  if (allocations.block_sparse.tensors != nullptr &&
+      allocations.block_sparse.tensors[tensor_idx] != nullptr) {
+    return true;
+  }
+#ifdef USE_TFLM_COMPRESSION
+  if (allocations.compressed.tensors != nullptr &&
+      allocations.compressed.tensors[tensor_idx] != nullptr) {
+    return true;
+  }
+#endif  // USE_TFLM_COMPRESSION
+  return false;
+}
+
 }  // namespace
 
 namespace internal {
@@ -508,6 +523,168 @@ TfLiteStatus InitializeCompressionTensorDataFromFlatbuffer(
 
 #endif  // USE_TFLM_COMPRESSION
 
+// Returns the raw BLOCK_SPARSITY_METADATA buffer, or nullptr if the model
+// carries none.
+const flatbuffers::Vector<uint8_t>* GetBlockSparsityMetadata(
+    const Model& model) {
+  const auto metadata_vector = model.metadata();
+  const auto buffers = model.buffers();
+  if (metadata_vector == nullptr || buffers == nullptr) {
+    return nullptr;
+  }
+  for (size_t i = 0; i < metadata_vector->size(); ++i) {
+    const auto metadata = metadata_vector->Get(i);
+    if (metadata->name() == nullptr ||
+        std::strcmp(metadata->name()->c_str(), kBlockSparsityMetadataString) !=
+            0) {
+      continue;
+    }
+    const size_t buffer_index = metadata->buffer();
+    if (buffer_index >= buffers->size() ||
+        buffers->Get(buffer_index)->data() == nullptr) {
+      MicroPrintf("BlockSparsity: invalid metadata buffer %u",
+                  static_cast<unsigned>(buffer_index));
+      return nullptr;
+    }
+    return buffers->Get(buffer_index)->data();
+  }
+  return nullptr;
+}
+
+uint32_t ReadLittleEndianUint32(const uint8_t* bytes) {
+  return static_cast<uint32_t>(bytes[0]) |
+         (static_cast<uint32_t>(bytes[1]) << 8) |
+         (static_cast<uint32_t>(bytes[2]) << 16) |
+         (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+TfLiteStatus InitializeBlockSparseTensorDataFromFlatbuffer(
+    const Model& model, const BlockSparsityMetadataEntry& entry,
+    BlockSparseTensorData* bsd) {
+  auto tensors = model.subgraphs()->Get(entry.subgraph)->tensors();
+  if (entry.tensor >= tensors->size()) {
+    MicroPrintf("BlockSparsity: invalid tensor index %u", entry.tensor);
+    return kTfLiteError;
+  }
+  const Tensor* tensor = tensors->Get(entry.tensor);
+  if (tensor->type() != TensorType_INT8) {
+    MicroPrintf("BlockSparsity: tensor %u is not int8", entry.tensor);
+    return kTfLiteError;
+  }
+  if (tensor->shape() == nullptr || tensor->shape()->size() < 2) {
+    MicroPrintf("BlockSparsity: tensor %u must have at least 2 dimensions",
+                entry.tensor);
+    return kTfLiteError;
+  }
+
+  // Every dimension is positive and the products are taken in 64 bits, so a
+  // corrupt shape cannot wrap row_depth or the block count below.
+  int64_t row_depth = 1;
+  for (size_t i = 0; i < tensor->shape()->size(); ++i) {
+    const int32_t dim = tensor->shape()->Get(i);
+    if (dim <= 0) {
+      MicroPrintf("BlockSparsity: tensor %u has a non-positive dimension",
+                  entry.tensor);
+      return kTfLiteError;
+    }
+    if (i > 0) {
+      row_depth *= dim;
+      if (row_depth > INT32_MAX) {
+        MicroPrintf("BlockSparsity: tensor %u is too large", entry.tensor);
+        return kTfLiteError;
+      }
+    }
+  }
+  bsd->rows = tensor->shape()->Get(0);
+  bsd->row_depth = static_cast<int32_t>(row_depth);
+  if (entry.block_size == 0 || entry.block_size > INT32_MAX ||
+      bsd->row_depth % static_cast<int32_t>(entry.block_size) != 0) {
+    MicroPrintf("BlockSparsity: block size %u does not divide row depth %d",
+                entry.block_size, bsd->row_depth);
+    return kTfLiteError;
+  }
+  bsd->block_size = static_cast<int32_t>(entry.block_size);
+  bsd->blocks_per_row = bsd->row_depth / bsd->block_size;
+  const int64_t total_blocks_64 =
+      static_cast<int64_t>(bsd->rows) * bsd->blocks_per_row;
+  if (total_blocks_64 > INT32_MAX) {
+    MicroPrintf("BlockSparsity: tensor %u has too many blocks", entry.tensor);
+    return kTfLiteError;
+  }
+
+  if (entry.mask_buffer >= model.buffers()->size()) {
+    MicroPrintf("BlockSparsity: invalid mask buffer %u", entry.mask_buffer);
+    return kTfLiteError;
+  }
+  auto mask = model.buffers()->Get(entry.mask_buffer)->data();
+  const int32_t total_blocks = static_cast<int32_t>(total_blocks_64);
+  if (mask == nullptr ||
+      mask->size() < static_cast<size_t>((total_blocks + 7) / 8)) {
+    MicroPrintf("BlockSparsity: mask buffer %u too small", entry.mask_buffer);
+    return kTfLiteError;
+  }
+  bsd->block_mask = mask->data();
+
+  bsd->nonzero_blocks = 0;
+  for (int32_t block = 0; block < total_blocks; ++block) {
+    bsd->nonzero_blocks += IsBlockPresent(*bsd, block);
+  }
+
+  // The packed weights must hold exactly the blocks marked in the mask.
+  auto values = model.buffers()->Get(tensor->buffer())->data();
+  const size_t values_size = values == nullptr ? 0 : values->size();
+  const size_t expected_size = static_cast<size_t>(bsd->nonzero_blocks) *
+                               static_cast<size_t>(bsd->block_size);
+  if (values_size != expected_size) {
+    MicroPrintf("BlockSparsity: tensor %u holds %u bytes, mask expects %u",
+                entry.tensor, static_cast<unsigned>(values_size),
+                static_cast<unsigned>(expected_size));
+    return kTfLiteError;
+  }
+
+  return kTfLiteOk;
+}
+
+// Only the filter of CONV_2D and FULLY_CONNECTED can be block-sparse. Any
+// other op reading a packed tensor would treat it as a dense one, so such
+// models are rejected before any kernel is prepared.
+TfLiteStatus CheckBlockSparseConsumers(
+    const Model& model, const SubgraphAllocations* subgraph_allocations) {
+  for (size_t subgraph_idx = 0; subgraph_idx < model.subgraphs()->size();
+       subgraph_idx++) {
+    const BlockSparseTensorData** tensors =
+        subgraph_allocations[subgraph_idx].block_sparse.tensors;
+    const auto operators = model.subgraphs()->Get(subgraph_idx)->operators();
+    if (tensors == nullptr || operators == nullptr) {
+      continue;
+    }
+    for (size_t op_idx = 0; op_idx < operators->size(); op_idx++) {
+      const Operator* op = operators->Get(op_idx);
+      if (op->inputs() == nullptr) {
+        continue;
+      }
+      const BuiltinOperator code =
+          GetBuiltinCode(model.operator_codes()->Get(op->opcode_index()));
+      for (size_t input = 0; input < op->inputs()->size(); input++) {
+        const int32_t tensor_idx = op->inputs()->Get(input);
+        if (tensor_idx < 0 || tensors[tensor_idx] == nullptr) {
+          continue;
+        }
+        if (input != 1 || (code != BuiltinOperator_CONV_2D &&
+                           code != BuiltinOperator_FULLY_CONNECTED)) {
+          MicroPrintf(
+              "BlockSparsity: tensor %d is input %u of op %u, which does not "
+              "support block-sparse weights",
+              static_cast<int>(tensor_idx), static_cast<unsigned>(input),
+              static_cast<unsigned>(op_idx));
+          return kTfLiteError;
+        }
+      }
+    }
+  }
+  return kTfLiteOk;
+}
+
 }  // namespace internal
 
 size_t MicroAllocator::GetDefaultTailUsage(bool is_memory_planner_given) {
@@ -632,6 +809,11 @@ SubgraphAllocations* MicroAllocator::StartModelAllocation(const Model* model) {
     return nullptr;
   }
 
+  if (model_verifier_ != nullptr &&
+      model_verifier_->VerifyModel() != kTfLiteOk) {
+    return nullptr;
+  }
+
   model_is_allocating_ = true;
 
   uint8_t* data_allocator_buffer =
@@ -659,8 +841,11 @@ SubgraphAllocations* MicroAllocator::StartModelAllocation(const Model* model) {
 #ifdef USE_TFLM_COMPRESSION
       AllocateCompressedTensorsList(model, output) != kTfLiteOk ||
 #endif  // USE_TFLM_COMPRESSION
+      AllocateBlockSparseTensorsList(model, output) != kTfLiteOk ||
       AllocateTfLiteEvalTensors(model, output) != kTfLiteOk ||
-      AllocateNodeAndRegistrations(model, output) != kTfLiteOk) {
+      AllocateNodeAndRegistrations(model, output) != kTfLiteOk ||
+      // Reads the operators, so runs after they have been walked.
+      internal::CheckBlockSparseConsumers(*model, output) != kTfLiteOk) {
     return nullptr;
   }
   return output;
@@ -789,6 +974,12 @@ TfLiteStatus MicroAllocator::AllocateNodeAndRegistrations(
       return kTfLiteError;
     }
     subgraph_allocations[subgraph_idx].node_and_registrations = output;
+
+    if (model_verifier_ != nullptr) {
+      for (uint32_t i = 0; i < operators_size; ++i) {
+        TF_LITE_ENSURE_STATUS(model_verifier_->VerifyOperator(subgraph_idx, i));
+      }
+    }
   }
   return kTfLiteOk;
 }
@@ -864,6 +1055,7 @@ TfLiteTensor* MicroAllocator::AllocateTempTfLiteTensor(
     int tensor_index, int subgraph_index) {
   const SubGraph* subgraph = model->subgraphs()->Get(subgraph_index);
   TFLITE_DCHECK(subgraph != nullptr);
+  has_temp_allocations_ = true;
 
   // This value is allocated from temporary arena space. It is guaranteed to be
   // around for at least the scope of the calling function. Since this struct
@@ -899,6 +1091,7 @@ TfLiteTensor* MicroAllocator::AllocateTempTfLiteTensor(
 }
 
 uint8_t* MicroAllocator::AllocateTempBuffer(size_t size, size_t alignment) {
+  has_temp_allocations_ = true;
   return non_persistent_buffer_allocator_->AllocateTemp(size, alignment);
 }
 
@@ -907,7 +1100,10 @@ void MicroAllocator::DeallocateTempBuffer(uint8_t* buffer) {
 }
 
 TfLiteStatus MicroAllocator::ResetTempAllocations() {
-  return non_persistent_buffer_allocator_->ResetTempAllocations();
+  TF_LITE_ENSURE_STATUS(
+      non_persistent_buffer_allocator_->ResetTempAllocations());
+  has_temp_allocations_ = false;
+  return kTfLiteOk;
 }
 
 bool MicroAllocator::IsAllTempDeallocated() {
@@ -982,6 +1178,10 @@ TfLiteStatus MicroAllocator::AllocateCompressedTensorsList(
       }
       ctd->data.lut_data = lut_table;
 
+      if (model_verifier_ != nullptr) {
+        TF_LITE_ENSURE_STATUS(model_verifier_->VerifyTensor(
+            subgraph_index, lut_tensor->tensor(), /*packed=*/true));
+      }
       TfLiteStatus status =
           internal::InitializeCompressionTensorDataFromFlatbuffer(
               *model, subgraph_index, *lut_tensor, ctd);
@@ -1029,6 +1229,102 @@ TfLiteStatus MicroAllocator::AllocateCompressedTensorsList(
 
 #endif  // USE_TFLM_COMPRESSION
 
+TfLiteStatus MicroAllocator::AllocateBlockSparseTensorsList(
+    const Model* model, SubgraphAllocations* subgraph_allocations) {
+  TFLITE_DCHECK(subgraph_allocations != nullptr);
+
+  for (size_t subgraph_idx = 0; subgraph_idx < model->subgraphs()->size();
+       subgraph_idx++) {
+    subgraph_allocations[subgraph_idx].block_sparse.tensors = nullptr;
+  }
+
+  const flatbuffers::Vector<uint8_t>* metadata =
+      internal::GetBlockSparsityMetadata(*model);
+  if (metadata == nullptr) {
+    // no block sparsity metadata is available
+    return kTfLiteOk;
+  }
+
+  const uint8_t* bytes = metadata->data();
+  const size_t header_size = sizeof(BlockSparsityMetadataHeader);
+  const size_t entry_size = sizeof(BlockSparsityMetadataEntry);
+  if (metadata->size() < header_size) {
+    MicroPrintf("BlockSparsity: truncated metadata");
+    return kTfLiteError;
+  }
+  const uint32_t version = internal::ReadLittleEndianUint32(bytes);
+  const uint32_t entry_count = internal::ReadLittleEndianUint32(bytes + 4);
+  if (version > kBlockSparsityMetadataVersion) {
+    MicroPrintf("BlockSparsity: metadata version mismatch (using %u got %u)",
+                static_cast<unsigned>(kBlockSparsityMetadataVersion),
+                static_cast<unsigned>(version));
+    return kTfLiteError;
+  }
+  if (entry_count > (metadata->size() - header_size) / entry_size) {
+    MicroPrintf("BlockSparsity: truncated metadata");
+    return kTfLiteError;
+  }
+
+  for (uint32_t entry_index = 0; entry_index < entry_count; entry_index++) {
+    const uint8_t* p = bytes + header_size + entry_index * entry_size;
+    BlockSparsityMetadataEntry entry;
+    entry.subgraph = internal::ReadLittleEndianUint32(p);
+    entry.tensor = internal::ReadLittleEndianUint32(p + 4);
+    entry.block_size = internal::ReadLittleEndianUint32(p + 8);
+    entry.mask_buffer = internal::ReadLittleEndianUint32(p + 12);
+    if (entry.subgraph >= model->subgraphs()->size()) {
+      MicroPrintf("BlockSparsity: invalid subgraph index %u", entry.subgraph);
+      return kTfLiteError;
+    }
+
+    BlockSparseTensorData* bsd = reinterpret_cast<BlockSparseTensorData*>(
+        persistent_buffer_allocator_->AllocatePersistentBuffer(
+            sizeof(BlockSparseTensorData), alignof(BlockSparseTensorData)));
+    if (bsd == nullptr) {
+      MicroPrintf(
+          "BlockSparsity: failed to allocate memory for "
+          "BlockSparseTensorData, %u bytes required",
+          static_cast<unsigned>(sizeof(BlockSparseTensorData)));
+      return kTfLiteError;
+    }
+    if (model_verifier_ != nullptr) {
+      TF_LITE_ENSURE_STATUS(model_verifier_->VerifyTensor(
+          entry.subgraph, entry.tensor, /*packed=*/true));
+    }
+    TF_LITE_ENSURE_STATUS(
+        internal::InitializeBlockSparseTensorDataFromFlatbuffer(*model, entry,
+                                                                bsd));
+
+    BlockSparseTensorList& list =
+        subgraph_allocations[entry.subgraph].block_sparse;
+    if (list.tensors == nullptr) {
+      size_t alloc_count =
+          model->subgraphs()->Get(entry.subgraph)->tensors()->size();
+      list.tensors = reinterpret_cast<const BlockSparseTensorData**>(
+          persistent_buffer_allocator_->AllocatePersistentBuffer(
+              sizeof(BlockSparseTensorData*) * alloc_count,
+              alignof(BlockSparseTensorData*)));
+      if (list.tensors == nullptr) {
+        MicroPrintf(
+            "BlockSparsity: failed to allocate memory for tensor list, "
+            "%u bytes required",
+            static_cast<unsigned>(sizeof(BlockSparseTensorData*) *
+                                  alloc_count));
+        return kTfLiteError;
+      }
+      std::fill(list.tensors, list.tensors + alloc_count, nullptr);
+    }
+    if (list.tensors[entry.tensor] != nullptr) {
+      MicroPrintf("BlockSparsity: duplicate entry subgraph %u tensor %u",
+                  entry.subgraph, entry.tensor);
+      return kTfLiteError;
+    }
+    list.tensors[entry.tensor] = bsd;
+  }
+
+  return kTfLiteOk;
+}
+
 TfLiteStatus MicroAllocator::AllocateTfLiteEvalTensors(
     const Model* model, SubgraphAllocations* subgraph_allocations) {
   TFLITE_DCHECK(subgraph_allocations != nullptr);
@@ -1051,6 +1347,13 @@ TfLiteStatus MicroAllocator::AllocateTfLiteEvalTensors(
     }
 
     for (size_t i = 0; i < alloc_count; ++i) {
+      if (model_verifier_ != nullptr &&
+          model_verifier_->VerifyTensor(
+              subgraph_idx, i,
+              IsPackedTensor(subgraph_allocations[subgraph_idx], i)) !=
+              kTfLiteOk) {
+        return kTfLiteError;
+      }
       TfLiteStatus status = internal::InitializeTfLiteEvalTensorFromFlatbuffer(
           *subgraph->tensors()->Get(i), model->buffers(), &tensors[i]);
       if (status != kTfLiteOk) {
@@ -1174,6 +1477,17 @@ TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
                  non_persistent_buffer_allocator_->GetOverlayMemoryAddress(),
                  allocation_info, allocation_info_count));
 
+  if (arena_timeline_writer_ != nullptr) {
+    TF_LITE_ENSURE_STATUS(WriteArenaTimelineJson(
+        model, allocation_info, allocation_info_count, scratch_buffer_requests,
+        memory_planner_, arena_timeline_writer_, arena_timeline_context_));
+  }
+  if (op_costs_ != nullptr) {
+    RecordOpArenaUsage(model, allocation_info, allocation_info_count,
+                       scratch_buffer_requests, op_costs_);
+    op_costs_ = nullptr;
+  }
+
   // Reset all temp allocations used above:
   builder.FreeAllocationInfo();
   non_persistent_buffer_allocator_->DeallocateTemp(planner_arena);
@@ -19,10 +19,14 @@ limitations under the License.
 #include <cstdint>
 
 #include "tensorflow/lite/micro/arena_allocator/single_arena_buffer_allocator.h"
+#include "tensorflow/lite/micro/block_sparsity.h"
 #include "tensorflow/lite/micro/compatibility.h"
 #include "tensorflow/lite/micro/flatbuffer_utils.h"
 #include "tensorflow/lite/micro/memory_planner/micro_memory_planner.h"
+#include "tensorflow/lite/micro/micro_arena_timeline.h"
 #include "tensorflow/lite/micro/micro_common.h"
+#include "tensorflow/lite/micro/micro_model_verifier.h"
+#include "tensorflow/lite/micro/micro_op_cost.h"
 #include "tensorflow/lite/micro/tflite_bridge/flatbuffer_conversions_bridge.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
@@ -97,6 +101,7 @@ struct ScratchBufferHandle {
 struct SubgraphAllocations {
   NodeAndRegistration* node_and_registrations;
   TfLiteEvalTensor* tensors;
+  BlockSparseTensorList block_sparse;
 #ifdef USE_TFLM_COMPRESSION
   CompressedTensorList compressed;
 #endif  // USE_TFLM_COMPRESSION
@@ -235,6 +240,11 @@ class MicroAllocator {
   // already deallocated.
   virtual bool IsAllTempDeallocated();
 
+  // Returns true if a temporary buffer or TfLiteTensor was allocated since the
+  // last call to ResetTempAllocations(). Lets the invoke loop skip the reset
+  // after kernels that allocate nothing, which is almost all of them.
+  bool HasTempAllocations() const { return has_temp_allocations_; }
+
   // Allocates persistent buffer which has the same life time as the allocator.
   // The memory is immediately available and is allocated from the tail of the
   // arena.
@@ -259,6 +269,28 @@ class MicroAllocator {
 
   TfLiteBridgeBuiltinDataAllocator* GetBuiltinDataAllocator();
 
+  // Makes every following memory plan write its buffers to `writer` as a JSON
+  // timeline (see micro_arena_timeline.h) before the planning data is freed.
+  // Must be set before the model is allocated. A null writer turns it off.
+  void SetArenaTimelineWriter(ArenaTimelineLineWriter writer, void* context) {
+    arena_timeline_writer_ = writer;
+    arena_timeline_context_ = context;
+  }
+
+  // Makes the next memory plan fill in the arena usage of `op_costs`,
+  // indexed by subgraph and then operator (see RecordOpArenaUsage). Must be
+  // set before FinishModelAllocation(), and only applies to that plan, as
+  // the records belong to one model.
+  void SetOpCosts(MicroOpCost** op_costs) { op_costs_ = op_costs; }
+
+  // Makes StartModelAllocation() check each part of the model with
+  // `verifier` before reading it. Must be set before StartModelAllocation()
+  // and may be cleared once it returns: after it, everything the interpreter
+  // reads from the model has been checked. A null verifier turns it off.
+  void SetModelVerifier(MicroModelVerifier* verifier) {
+    model_verifier_ = verifier;
+  }
+
  protected:
   MicroAllocator(SingleArenaBufferAllocator* memory_allocator,
                  MicroMemoryPlanner* memory_planner);
@@ -276,6 +308,12 @@ class MicroAllocator {
 
 #endif  // USE_TFLM_COMPRESSION
 
+  // Allocates an array in the arena of pointers to the block-sparse layout of
+  // each pruned weight tensor described by the model's
+  // BLOCK_SPARSITY_METADATA.
+  virtual TfLiteStatus AllocateBlockSparseTensorsList(
+      const Model* model, SubgraphAllocations* subgraph_allocations);
+
   // Allocates an array in the arena to hold pointers to the node and
   // registration pointers required to represent the inference graph of the
   // model.
@@ -349,6 +387,10 @@ class MicroAllocator {
 
   bool model_is_allocating_;
 
+  // Set by AllocateTempTfLiteTensor() and AllocateTempBuffer(), cleared by
+  // ResetTempAllocations().
+  bool has_temp_allocations_ = false;
+
   // Holds the number of ScratchBufferRequest instances stored in the head
   // section when a model is allocating.
   size_t scratch_buffer_request_count_ = 0;
@@ -360,6 +402,11 @@ class MicroAllocator {
   // to ensure that multi-tenant allocations can share the head for buffers.
   size_t max_head_buffer_usage_ = 0;
 
+  ArenaTimelineLineWriter arena_timeline_writer_ = nullptr;
+  void* arena_timeline_context_ = nullptr;
+  MicroOpCost** op_costs_ = nullptr;
+  MicroModelVerifier* model_verifier_ = nullptr;
+
   TF_LITE_REMOVE_VIRTUAL_DELETE
 };
 
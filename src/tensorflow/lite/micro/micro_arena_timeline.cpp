@@ -0,0 +1,265 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_arena_timeline.h"
+
+#include "tensorflow/lite/micro/flatbuffer_utils.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/memory_planner/greedy_memory_planner.h"
+#include "tensorflow/lite/micro/micro_allocation_info.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/micro_arena_constants.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_op_cost.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+namespace tflite {
+namespace {
+
+typedef void (*OpScopeVisitor)(const Model* model, int scope, int subgraph_idx,
+                               uint32_t op_idx, const Operator* op,
+                               void* context);
+
+// Returns the subgraphs a control flow operator enters, in the order
+// AllocationInfoBuilder::MarkSubgraphLifetimesIfNecessary enters them, or -1.
+void CalledSubgraphs(const Model* model, const Operator* op, int* first,
+                     int* second) {
+  *first = -1;
+  *second = -1;
+  const OperatorCode* opcode = model->operator_codes()->Get(op->opcode_index());
+  switch (opcode->builtin_code()) {
+    case BuiltinOperator_IF:
+      *first = op->builtin_options_as_IfOptions()->then_subgraph_index();
+      *second = op->builtin_options_as_IfOptions()->else_subgraph_index();
+      break;
+    case BuiltinOperator_CALL_ONCE:
+      *first = op->builtin_options_as_CallOnceOptions()->init_subgraph_index();
+      break;
+    case BuiltinOperator_WHILE:
+      *first = op->builtin_options_as_WhileOptions()->cond_subgraph_index();
+      *second = op->builtin_options_as_WhileOptions()->body_subgraph_index();
+      break;
+    default:
+      break;
+  }
+}
+
+// Replays the scope numbering of AllocationInfoBuilder::MarkAllocationLifetimes
+// for `subgraph_idx`, whose inputs are at `*scope`. Calls `visit` with the
+// scope of each operator unless it is null, and leaves `*scope` at the last
+// scope.
+void VisitOpScopes(const Model* model, int subgraph_idx, int* scope,
+                   OpScopeVisitor visit, void* context) {
+  const SubGraph* subgraph = model->subgraphs()->Get(subgraph_idx);
+  const uint32_t operators_size = NumSubgraphOperators(subgraph);
+  for (uint32_t i = 0; i < operators_size; ++i) {
+    ++*scope;
+    const Operator* op = subgraph->operators()->Get(i);
+    if (visit != nullptr) {
+      visit(model, *scope, subgraph_idx, i, op, context);
+    }
+    int called[2];
+    CalledSubgraphs(model, op, &called[0], &called[1]);
+    for (int called_idx : called) {
+      if (called_idx != -1) {
+        ++*scope;
+        VisitOpScopes(model, called_idx, scope, visit, context);
+      }
+    }
+  }
+}
+
+struct OpArenaUsage {
+  const AllocationInfo* allocation_info;
+  size_t allocation_info_count;
+  MicroOpCost** op_costs;
+};
+
+// Sets the live bytes of an operator to those of the buffers live at its
+// scope, keeping the largest if its subgraph is entered more than once.
+void RecordLiveBytes(const Model* model, int scope, int subgraph_idx,
+                     uint32_t op_idx, const Operator* op, void* context) {
+  const OpArenaUsage* usage = static_cast<const OpArenaUsage*>(context);
+  uint32_t live_bytes = 0;
+  for (size_t i = 0; i < usage->allocation_info_count; ++i) {
+    const AllocationInfo& current = usage->allocation_info[i];
+    if (current.needs_allocating && current.first_created <= scope &&
+        scope <= current.last_used) {
+      live_bytes += AlignSizeUp(current.bytes, MicroArenaBufferAlignment());
+    }
+  }
+  MicroOpCost& cost = usage->op_costs[subgraph_idx][op_idx];
+  if (live_bytes > cost.live_bytes) {
+    cost.live_bytes = live_bytes;
+  }
+}
+
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+constexpr int kMaxLineLength = 192;
+
+struct LineWriter {
+  ArenaTimelineLineWriter writer;
+  void* context;
+};
+
+const char* OpName(const Model* model, const Operator* op) {
+  const OperatorCode* opcode = model->operator_codes()->Get(op->opcode_index());
+  const BuiltinOperator builtin_code = GetBuiltinCode(opcode);
+  if (builtin_code == BuiltinOperator_CUSTOM && opcode->custom_code()) {
+    return opcode->custom_code()->c_str();
+  }
+  return EnumNameBuiltinOperator(builtin_code);
+}
+
+// Writes the "ops" entry of an operator.
+void WriteOpScope(const Model* model, int scope, int subgraph_idx,
+                  uint32_t op_idx, const Operator* op, void* context) {
+  const LineWriter* line_writer = static_cast<const LineWriter*>(context);
+  char line[kMaxLineLength];
+  MicroSnprintf(line, kMaxLineLength,
+                "%s{\"scope\":%d,\"subgraph\":%d,\"node\":%u,\"op\":\"%s\"}",
+                scope == 1 ? "" : ",", scope, subgraph_idx,
+                static_cast<unsigned>(op_idx), OpName(model, op));
+  line_writer->writer(line, line_writer->context);
+}
+
+// Node of `subgraph` that writes `tensor_index`, or -1 if none does.
+int ProducerNode(const SubGraph* subgraph, int tensor_index) {
+  const uint32_t operators_size = NumSubgraphOperators(subgraph);
+  for (uint32_t i = 0; i < operators_size; ++i) {
+    const Operator* op = subgraph->operators()->Get(i);
+    for (size_t n = 0; op->outputs() != nullptr && n < op->outputs()->size();
+         ++n) {
+      if (op->outputs()->Get(n) == tensor_index) {
+        return static_cast<int>(i);
+      }
+    }
+  }
+  return -1;
+}
+#endif
+
+}  // namespace
+
+TfLiteStatus WriteArenaTimelineJson(
+    const Model* model, const AllocationInfo* allocation_info,
+    size_t allocation_info_count,
+    const internal::ScratchBufferRequest* scratch_buffer_requests,
+    MicroMemoryPlanner* planner, ArenaTimelineLineWriter writer,
+    void* context) {
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+  const int subgraphs_size = model->subgraphs()->size();
+  int last_scope = 0;
+  VisitOpScopes(model, 0, &last_scope, nullptr, nullptr);
+
+  char line[kMaxLineLength];
+  MicroSnprintf(line, kMaxLineLength,
+                "{\"arena_timeline\":1,\"arena_bytes\":%u,\"subgraphs\":%d,"
+                "\"scopes\":%d,",
+                static_cast<unsigned>(planner->GetMaximumMemorySize()),
+                subgraphs_size, last_scope + 1);
+  writer(line, context);
+
+  writer("\"ops\":[", context);
+  int scope = 0;
+  LineWriter line_writer = {writer, context};
+  VisitOpScopes(model, 0, &scope, WriteOpScope, &line_writer);
+  writer("],\"buffers\":[", context);
+
+  // Allocation info holds the tensors of each subgraph in turn, then the
+  // scratch buffers; see GraphAllocationInfo.
+  int subgraph_idx = 0;
+  size_t subgraph_offset = 0;
+  size_t subgraph_end = model->subgraphs()->Get(0)->tensors()->size();
+  int planner_index = 0;
+  for (size_t i = 0; i < allocation_info_count; ++i) {
+    while (subgraph_idx < subgraphs_size && i >= subgraph_end) {
+      ++subgraph_idx;
+      subgraph_offset = subgraph_end;
+      if (subgraph_idx < subgraphs_size) {
+        subgraph_end +=
+            model->subgraphs()->Get(subgraph_idx)->tensors()->size();
+      }
+    }
+    const AllocationInfo& current = allocation_info[i];
+    if (!current.needs_allocating) {
+      continue;
+    }
+    int offset = -1;
+    TF_LITE_ENSURE_STATUS(planner->GetOffsetForBuffer(planner_index, &offset));
+
+    const bool is_scratch = subgraph_idx == subgraphs_size;
+    const int index = static_cast<int>(i - subgraph_offset);
+    int owner_subgraph = subgraph_idx;
+    int owner_node;
+    if (is_scratch) {
+      owner_subgraph = scratch_buffer_requests[index].subgraph_idx;
+      owner_node = scratch_buffer_requests[index].node_idx;
+    } else {
+      owner_node = ProducerNode(model->subgraphs()->Get(subgraph_idx), index);
+    }
+
+    MicroSnprintf(line, kMaxLineLength,
+                  "%s{\"id\":%d,\"kind\":\"%s\",\"subgraph\":%d,"
+                  "\"index\":%d,\"op\":%d,",
+                  planner_index == 0 ? "" : ",", planner_index,
+                  is_scratch ? "scratch" : "tensor", owner_subgraph, index,
+                  owner_node);
+    writer(line, context);
+    MicroSnprintf(line, kMaxLineLength,
+                  "\"offset\":%d,\"size\":%u,\"first\":%d,\"last\":%d,"
+                  "\"offline\":%s}",
+                  offset,
+                  static_cast<unsigned>(AlignSizeUp(
+                      current.bytes, MicroArenaBufferAlignment())),
+                  current.first_created, current.last_used,
+                  current.offline_offset == kOnlinePlannedBuffer ? "false"
+                                                                 : "true");
+    writer(line, context);
+    ++planner_index;
+  }
+  writer("]}", context);
+#endif
+  return kTfLiteOk;
+}
+
+void RecordOpArenaUsage(
+    const Model* model, const AllocationInfo* allocation_info,
+    size_t allocation_info_count,
+    const internal::ScratchBufferRequest* scratch_buffer_requests,
+    MicroOpCost** op_costs) {
+  OpArenaUsage usage = {allocation_info, allocation_info_count, op_costs};
+  int scope = 0;
+  VisitOpScopes(model, 0, &scope, RecordLiveBytes, &usage);
+
+  // Scratch buffers follow the tensors of all subgraphs; see
+  // GraphAllocationInfo.
+  size_t tensors_count = 0;
+  for (size_t i = 0; i < model->subgraphs()->size(); ++i) {
+    tensors_count += model->subgraphs()->Get(i)->tensors()->size();
+  }
+  for (size_t i = tensors_count; i < allocation_info_count; ++i) {
+    const internal::ScratchBufferRequest& request =
+        scratch_buffer_requests[i - tensors_count];
+    op_costs[request.subgraph_idx][request.node_idx].scratch_bytes +=
+        AlignSizeUp(allocation_info[i].bytes, MicroArenaBufferAlignment());
+  }
+}
+
+void LogArenaTimelineLine(const char* line, void* context) {
+  MicroPrintf("%s", line);
+}
+
+}  // namespace tflite
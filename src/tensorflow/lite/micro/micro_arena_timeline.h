@@ -0,0 +1,81 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_ARENA_TIMELINE_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_ARENA_TIMELINE_H_
+
+#include <cstddef>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/memory_planner/micro_memory_planner.h"
+#include "tensorflow/lite/micro/micro_op_cost.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+
+struct AllocationInfo;
+
+namespace internal {
+struct ScratchBufferRequest;
+}  // namespace internal
+
+typedef void (*ArenaTimelineLineWriter)(const char* line, void* context);
+
+// Writes every buffer `planner` placed for `model` as one JSON object, a few
+// fields per line so that no line outgrows MicroPrintf on the board:
+//
+//   {"arena_timeline":1,"arena_bytes":84080,"subgraphs":1,"scopes":31,
+//    "ops":[{"scope":1,"subgraph":0,"node":0,"op":"CONV_2D"}, ...],
+//    "buffers":[{"id":0,"kind":"tensor","subgraph":0,"index":1,"op":-1,
+//                "offset":0,"size":9216,"first":0,"last":1,
+//                "offline":false}, ...]}
+//
+// Lifetimes are in allocation scopes, as the planner sees them: scope 0
+// holds the inputs of subgraph 0, and each operator and each subgraph that a
+// control flow operator enters opens the next scope. "ops" names the
+// operator of each operator scope. For a buffer, "index" is the tensor index
+// in its subgraph, or the scratch buffer index for "kind":"scratch", and "op"
+// the node that produces the tensor or requested the scratch buffer, -1 for
+// subgraph inputs. "id" is the index of the buffer in the planner.
+//
+// `allocation_info` and `scratch_buffer_requests` are the arrays
+// MicroAllocator planned from, so this must run before they are released.
+// benchmarks/arena_timeline.py reports peak scopes and fragmentation from
+// these objects.
+TfLiteStatus WriteArenaTimelineJson(
+    const Model* model, const AllocationInfo* allocation_info,
+    size_t allocation_info_count,
+    const internal::ScratchBufferRequest* scratch_buffer_requests,
+    MicroMemoryPlanner* planner, ArenaTimelineLineWriter writer,
+    void* context);
+
+// Fills in the live_bytes and scratch_bytes of `op_costs`, indexed by
+// subgraph and then operator, from the lifetimes the planner was given:
+// live_bytes adds up every buffer live at the scope of the operator, and
+// scratch_bytes the scratch buffers it requested. Sizes are aligned as the
+// planner sees them. Like WriteArenaTimelineJson, this must run before the
+// planning arrays are released.
+void RecordOpArenaUsage(
+    const Model* model, const AllocationInfo* allocation_info,
+    size_t allocation_info_count,
+    const internal::ScratchBufferRequest* scratch_buffer_requests,
+    MicroOpCost** op_costs);
+
+// Line writer that prints each line through MicroPrintf.
+void LogArenaTimelineLine(const char* line, void* context);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_ARENA_TIMELINE_H_
@@ -19,6 +19,7 @@ limitations under the License.
 #include <cstddef>
 
 #include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "tensorflow/lite/micro/kernel_region_profiler.h"
 #include "tensorflow/lite/micro/kernels/decompress.h"
 #include "tensorflow/lite/micro/micro_common.h"
 #include "tensorflow/lite/micro/micro_log.h"
@@ -95,6 +96,7 @@ void* MicroContext::DecompressTensorToBuffer(
     num_channels = tensor.dims->data[channel_axis];
   }
 
+  ScopedKernelRegion region(TF_LITE_MICRO_REGION_DECOMPRESS);
   DecompressionState ds(static_cast<uint8_t*>(tensor.data.data), count,
                         compression_data, num_channels, GetAlternateProfiler());
 
@@ -17,7 +17,10 @@ limitations under the License.
 #define TENSORFLOW_LITE_MICRO_MICRO_CONTEXT_H_
 
 #include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/block_sparsity.h"
 #include "tensorflow/lite/micro/micro_graph.h"
+#include "tensorflow/lite/micro/micro_op_cost.h"
+#include "tensorflow/lite/micro/offline_requantization.h"
 #include "tensorflow/lite/micro/micro_profiler_interface.h"
 
 #ifdef USE_TFLM_COMPRESSION
@@ -104,6 +107,21 @@ class MicroContext {
 
   virtual MicroGraph& graph() = 0;
 
+  // Available during Prepare & Eval. Returns nullptr if the tensor is not
+  // stored in the block-sparse format.
+  virtual const BlockSparseTensorData* GetTensorBlockSparsityData(
+      const TfLiteNode* node, int tensor_idx) {
+    return nullptr;
+  }
+
+  // Only available during Prepare. Returns false unless the model carries
+  // requantization tables with `channels` entries for the operator being
+  // prepared, in which case `data` points at them.
+  virtual bool GetOfflineRequantization(int channels,
+                                        OfflineRequantizationData* data) {
+    return false;
+  }
+
 #ifdef USE_TFLM_COMPRESSION
 
   // Available during Prepare & Eval. Returns false if tensor is not
@@ -167,6 +185,12 @@ class MicroContext {
     return nullptr;
   }
 
+  // Returns the cost record of the operator being prepared, for the kernel to
+  // fill in its MAC count (and byte counts, if the defaults taken from its
+  // tensors are wrong). Only valid during Prepare. Returns nullptr when no
+  // profiler is attached, in which case costs are not collected.
+  virtual MicroOpCost* GetCurrentOpCost() { return nullptr; }
+
  private:
   TF_LITE_REMOVE_VIRTUAL_DELETE
 };
@@ -26,6 +26,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/micro_allocator.h"
 #include "tensorflow/lite/micro/micro_interpreter_context.h"
 #include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_model_verifier.h"
 #include "tensorflow/lite/micro/micro_op_resolver.h"
 #include "tensorflow/lite/micro/micro_profiler_interface.h"
 #include "tensorflow/lite/micro/tflite_bridge/flatbuffer_conversions_bridge.h"
@@ -198,7 +199,18 @@ TfLiteStatus MicroInterpreter::PrepareNodeAndRegistrationDataFromFlatbuffer() {
 }
 
 TfLiteStatus MicroInterpreter::AllocateTensors() {
-  SubgraphAllocations* allocations = allocator_.StartModelAllocation(model_);
+  SubgraphAllocations* allocations = nullptr;
+  if (verified_model_data_ != nullptr) {
+    // Everything read from the model after StartModelAllocation() has been
+    // checked by then.
+    MicroModelVerifier verifier(model_, verified_model_data_,
+                                verified_model_size_);
+    allocator_.SetModelVerifier(&verifier);
+    allocations = allocator_.StartModelAllocation(model_);
+    allocator_.SetModelVerifier(nullptr);
+  } else {
+    allocations = allocator_.StartModelAllocation(model_);
+  }
 
   if (allocations == nullptr) {
     MicroPrintf("Failed starting model allocation.\n");
@@ -218,6 +230,18 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
       MicroInterpreterContext::InterpreterState::kPrepare);
 
   TF_LITE_ENSURE_STATUS(graph_.PrepareSubgraphs());
+  allocator_.SetOpCosts(graph_.GetOpCosts());
+
+  // Operators whose inputs never change are run once here, into persistent
+  // memory, before the memory planner sees their outputs.
+  TF_LITE_ENSURE_STATUS(graph_.BuildInvokePlans());
+  micro_context_.SetInterpreterState(
+      MicroInterpreterContext::InterpreterState::kInvoke);
+  TF_LITE_ENSURE_STATUS(graph_.FoldConstants());
+  if (weight_staging_buffer_ != nullptr) {
+    TF_LITE_ENSURE_STATUS(graph_.BuildWeightStagingPlan(
+        weight_staging_buffer_, weight_staging_buffer_size_));
+  }
 
   micro_context_.SetInterpreterState(
       MicroInterpreterContext::InterpreterState::kMemoryPlanning);
@@ -329,11 +353,48 @@ TfLiteEvalTensor* MicroInterpreter::GetTensor(int tensor_index,
   return &graph_.GetAllocations()[subgraph_index].tensors[tensor_index];
 }
 
+const MicroOpCost* MicroInterpreter::GetOpCost(int op_index,
+                                              int subgraph_index) {
+  MicroOpCost** op_costs = graph_.GetOpCosts();
+  if (op_costs == nullptr || subgraph_index < 0 ||
+      static_cast<size_t>(subgraph_index) >= model_->subgraphs()->size()) {
+    return nullptr;
+  }
+  const SubGraph* subgraph = model_->subgraphs()->Get(subgraph_index);
+  if (op_index < 0 ||
+      static_cast<uint32_t>(op_index) >= NumSubgraphOperators(subgraph)) {
+    return nullptr;
+  }
+  return &op_costs[subgraph_index][op_index];
+}
+
 TfLiteStatus MicroInterpreter::SetMicroExternalContext(
     void* external_context_payload) {
   return micro_context_.set_external_context(external_context_payload);
 }
 
+TfLiteStatus MicroInterpreter::SetWeightStagingBuffer(uint8_t* buffer,
+                                                      size_t buffer_size) {
+  if (tensors_allocated_) {
+    MicroPrintf("SetWeightStagingBuffer must be called before AllocateTensors");
+    return kTfLiteError;
+  }
+  weight_staging_buffer_ = buffer;
+  weight_staging_buffer_size_ = buffer_size;
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::SetModelVerification(const uint8_t* model_data,
+                                                    size_t model_size) {
+  if (tensors_allocated_) {
+    MicroPrintf("SetModelVerification must be called before AllocateTensors");
+    return kTfLiteError;
+  }
+  verified_model_data_ = model_data;
+  verified_model_size_ = model_size;
+  return kTfLiteOk;
+}
+
 TfLiteStatus MicroInterpreter::SetAlternateProfiler(
     MicroProfilerInterface* alt_profiler) {
   return micro_context_.SetAlternateProfiler(alt_profiler);
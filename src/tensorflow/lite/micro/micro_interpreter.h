@@ -125,6 +125,40 @@ class MicroInterpreter {
   // Returns a pointer to the tensor for the corresponding tensor_index
   TfLiteEvalTensor* GetTensor(int tensor_index, int subgraph_index = 0);
 
+  // Returns the static cost of operator `op_index`, including the arena bytes
+  // live while it runs and its scratch bytes (see MicroOpCost). Costs are
+  // only collected when a profiler is given to the constructor, otherwise
+  // this returns nullptr, as it does for an index out of range. The arena
+  // usage is available after AllocateTensors().
+  const MicroOpCost* GetOpCost(int op_index, int subgraph_index = 0);
+
+  // Returns the number of operators AllocateTensors() ran ahead of time
+  // because all of their inputs are constant. They do not run in Invoke().
+  size_t folded_operators_size() const {
+    return graph_.folded_operators_size();
+  }
+
+  // Stages weights in SRAM: while an operator runs, the weights the next
+  // operator reads from the model are copied into `buffer`, by DMA on the
+  // RP2, and kernels read the copy instead of XIP flash. Each half of the
+  // buffer holds the weights of one operator; weights that do not fit in a
+  // half stay in the model. Only the first subgraph is staged. `buffer` must
+  // outlive the interpreter. Must be called before AllocateTensors().
+  TfLiteStatus SetWeightStagingBuffer(uint8_t* buffer, size_t buffer_size);
+
+  // Weight bytes copied into the staging buffer in each Invoke(), after
+  // AllocateTensors().
+  size_t staged_weight_bytes() const { return graph_.staged_weight_bytes(); }
+
+  // Makes AllocateTensors() check the model as it reads it, with a
+  // MicroModelVerifier, and fail on a malformed model instead of reading
+  // past it. Use it for models that arrive at runtime, e.g. over the air, in
+  // place of VerifyModelBuffer(). `model_data` is the buffer of
+  // `model_size` bytes the model given to the constructor was read from.
+  // Must be called before AllocateTensors().
+  TfLiteStatus SetModelVerification(const uint8_t* model_data,
+                                    size_t model_size);
+
   // Reset the state to be what you would expect when the interpreter is first
   // created. i.e. after Init and Prepare is called for the very first time.
   TfLiteStatus Reset();
@@ -160,6 +194,14 @@ class MicroInterpreter {
   // decompression subsystem.
   TfLiteStatus SetAlternateProfiler(MicroProfilerInterface* alt_profiler);
 
+  // For debugging only.
+  // Writes the buffers of the memory plan made by AllocateTensors() to
+  // `writer` as a JSON timeline, see micro_arena_timeline.h. Must be called
+  // before AllocateTensors().
+  void SetArenaTimelineWriter(ArenaTimelineLineWriter writer, void* context) {
+    allocator_.SetArenaTimelineWriter(writer, context);
+  }
+
 #ifdef USE_TFLM_COMPRESSION
 
   // Set the alternate decompression memory regions.
@@ -194,6 +236,11 @@ class MicroInterpreter {
 
   ScratchBufferHandle* scratch_buffer_handles_ = nullptr;
 
+  uint8_t* weight_staging_buffer_ = nullptr;
+  size_t weight_staging_buffer_size_ = 0;
+  const uint8_t* verified_model_data_ = nullptr;
+  size_t verified_model_size_ = 0;
+
   // TODO(b/162311891): Clean these pointers up when this class supports buffers
   // from TfLiteEvalTensor.
   TfLiteTensor** input_tensors_;
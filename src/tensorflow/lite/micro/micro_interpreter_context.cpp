@@ -16,6 +16,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/micro_interpreter_context.h"
 
 #include <cstdint>
+#include <cstring>
 
 #ifdef USE_TFLM_COMPRESSION
 
@@ -28,13 +29,12 @@ limitations under the License.
 
 #include "tensorflow/lite/kernels/internal/compatibility.h"
 #include "tensorflow/lite/micro/micro_utils.h"
+#include "tensorflow/lite/schema/schema_generated.h"
 
 namespace tflite {
 
 namespace {
 
-#ifdef USE_TFLM_COMPRESSION
-
 int GetInputTensorIndex(const TfLiteNode* node, const int index) {
   if (index >= 0 && index < node->inputs->size) {
     const int tensor_index = node->inputs->data[index];
@@ -45,7 +45,40 @@ int GetInputTensorIndex(const TfLiteNode* node, const int index) {
   return -1;
 }
 
-#endif  // USE_TFLM_COMPRESSION
+uint32_t ReadLittleEndianUint32(const uint8_t* bytes) {
+  return static_cast<uint32_t>(bytes[0]) |
+         (static_cast<uint32_t>(bytes[1]) << 8) |
+         (static_cast<uint32_t>(bytes[2]) << 16) |
+         (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+// Returns the raw OFFLINE_REQUANTIZATION_METADATA buffer, or nullptr if the
+// model carries none.
+const flatbuffers::Vector<uint8_t>* GetOfflineRequantizationMetadata(
+    const Model& model) {
+  const auto metadata_vector = model.metadata();
+  const auto buffers = model.buffers();
+  if (metadata_vector == nullptr || buffers == nullptr) {
+    return nullptr;
+  }
+  for (size_t i = 0; i < metadata_vector->size(); ++i) {
+    const auto metadata = metadata_vector->Get(i);
+    if (metadata->name() == nullptr ||
+        std::strcmp(metadata->name()->c_str(),
+                    kOfflineRequantizationMetadataString) != 0) {
+      continue;
+    }
+    const size_t buffer_index = metadata->buffer();
+    if (buffer_index >= buffers->size() ||
+        buffers->Get(buffer_index)->data() == nullptr) {
+      MicroPrintf("OfflineRequantization: invalid metadata buffer %u",
+                  static_cast<unsigned>(buffer_index));
+      return nullptr;
+    }
+    return buffers->Get(buffer_index)->data();
+  }
+  return nullptr;
+}
 
 }  // namespace
 
@@ -135,6 +168,103 @@ MicroInterpreterContext::GetInterpreterState() const {
   return state_;
 }
 
+// Available during Prepare & Eval. Returns nullptr if the tensor is not
+// stored in the block-sparse format.
+const BlockSparseTensorData*
+MicroInterpreterContext::GetTensorBlockSparsityData(const TfLiteNode* node,
+                                                    int tensor_idx) {
+  TFLITE_DCHECK(state_ == InterpreterState::kPrepare ||
+                state_ == InterpreterState::kInvoke);
+
+  const SubgraphAllocations* allocations =
+      &graph_.GetAllocations()[graph_.GetCurrentSubgraphIndex()];
+  if (allocations->block_sparse.tensors == nullptr) {
+    return nullptr;
+  }
+  int index = GetInputTensorIndex(node, tensor_idx);
+  if (index == -1) {
+    return nullptr;
+  }
+  return allocations->block_sparse.tensors[index];
+}
+
+// Only available during Prepare. Malformed metadata is reported and ignored,
+// so the kernel falls back to computing the tables itself.
+bool MicroInterpreterContext::GetOfflineRequantization(
+    int channels, OfflineRequantizationData* data) {
+  TFLITE_DCHECK(state_ == InterpreterState::kPrepare);
+
+  const flatbuffers::Vector<uint8_t>* metadata =
+      GetOfflineRequantizationMetadata(*model_);
+  if (metadata == nullptr) {
+    return false;
+  }
+
+  const uint8_t* bytes = metadata->data();
+  const size_t header_size = sizeof(OfflineRequantizationMetadataHeader);
+  const size_t entry_size = sizeof(OfflineRequantizationMetadataEntry);
+  if (metadata->size() < header_size) {
+    MicroPrintf("OfflineRequantization: truncated metadata");
+    return false;
+  }
+  const uint32_t version = ReadLittleEndianUint32(bytes);
+  const uint32_t entry_count = ReadLittleEndianUint32(bytes + 4);
+  if (version > kOfflineRequantizationMetadataVersion) {
+    MicroPrintf(
+        "OfflineRequantization: metadata version mismatch (using %u got %u)",
+        static_cast<unsigned>(kOfflineRequantizationMetadataVersion),
+        static_cast<unsigned>(version));
+    return false;
+  }
+  if (entry_count > (metadata->size() - header_size) / entry_size) {
+    MicroPrintf("OfflineRequantization: truncated metadata");
+    return false;
+  }
+
+  const uint32_t subgraph_idx =
+      static_cast<uint32_t>(graph_.GetCurrentSubgraphIndex());
+  const uint32_t op_idx =
+      static_cast<uint32_t>(graph_.GetCurrentOperatorIndex());
+  for (uint32_t entry_index = 0; entry_index < entry_count; entry_index++) {
+    const uint8_t* p = bytes + header_size + entry_index * entry_size;
+    OfflineRequantizationMetadataEntry entry;
+    entry.subgraph = ReadLittleEndianUint32(p);
+    entry.op = ReadLittleEndianUint32(p + 4);
+    entry.channels = ReadLittleEndianUint32(p + 8);
+    entry.table_buffer = ReadLittleEndianUint32(p + 12);
+    if (entry.subgraph != subgraph_idx || entry.op != op_idx) {
+      continue;
+    }
+
+    if (channels <= 0 || entry.channels != static_cast<uint32_t>(channels)) {
+      MicroPrintf("OfflineRequantization: op %u has %u channels, expected %d",
+                  static_cast<unsigned>(op_idx),
+                  static_cast<unsigned>(entry.channels), channels);
+      return false;
+    }
+    const auto buffers = model_->buffers();
+    const size_t table_bytes = 2 * sizeof(int32_t) * entry.channels;
+    if (entry.table_buffer >= buffers->size() ||
+        buffers->Get(entry.table_buffer)->data() == nullptr ||
+        buffers->Get(entry.table_buffer)->data()->size() < table_bytes) {
+      MicroPrintf("OfflineRequantization: invalid table buffer %u for op %u",
+                  static_cast<unsigned>(entry.table_buffer),
+                  static_cast<unsigned>(op_idx));
+      return false;
+    }
+    const uint8_t* table = buffers->Get(entry.table_buffer)->data()->data();
+    if (reinterpret_cast<uintptr_t>(table) % alignof(int32_t) != 0) {
+      MicroPrintf("OfflineRequantization: table buffer %u is misaligned",
+                  static_cast<unsigned>(entry.table_buffer));
+      return false;
+    }
+    data->multipliers = reinterpret_cast<const int32_t*>(table);
+    data->shifts = data->multipliers + entry.channels;
+    return true;
+  }
+  return false;
+}
+
 #ifdef USE_TFLM_COMPRESSION
 
 // Available during Prepare & Eval. Returns false if tensor is not
@@ -277,4 +407,8 @@ MicroProfilerInterface* MicroInterpreterContext::GetAlternateProfiler() const {
   return alt_profiler_;
 }
 
+MicroOpCost* MicroInterpreterContext::GetCurrentOpCost() {
+  return graph_.GetCurrentOpCost();
+}
+
 }  // namespace tflite
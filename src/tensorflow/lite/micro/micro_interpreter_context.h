@@ -106,6 +106,17 @@ class MicroInterpreterContext : public MicroContext {
   // housekeeping in MicroInterpreterContext.
   void SetScratchBufferHandles(ScratchBufferHandle* scratch_buffer_handles);
 
+  // Available during Prepare & Eval. Returns nullptr if the tensor is not
+  // stored in the block-sparse format.
+  const BlockSparseTensorData* GetTensorBlockSparsityData(
+      const TfLiteNode* node, int tensor_idx) override;
+
+  // Only available during Prepare. Returns false unless the model carries
+  // requantization tables with `channels` entries for the operator being
+  // prepared, in which case `data` points at them.
+  bool GetOfflineRequantization(int channels,
+                                OfflineRequantizationData* data) override;
+
 #ifdef USE_TFLM_COMPRESSION
 
   // Available during Prepare & Eval. Returns false if tensor is not
@@ -159,6 +170,10 @@ class MicroInterpreterContext : public MicroContext {
   // decompression subsystem.
   MicroProfilerInterface* GetAlternateProfiler() const override;
 
+  // Returns the cost record that MicroInterpreterGraph keeps for the operator
+  // being prepared, or nullptr if costs are not being collected.
+  MicroOpCost* GetCurrentOpCost() override;
+
  private:
   MicroAllocator& allocator_;
   MicroInterpreterGraph& graph_;
@@ -15,11 +15,14 @@ limitations under the License.
 
 #include "tensorflow/lite/micro/micro_interpreter_graph.h"
 
+#include <new>
+
 #include "third_party/flatbuffers/include/flatbuffers/flatbuffers.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/compatibility.h"
 #include "tensorflow/lite/micro/flatbuffer_utils.h"
 #include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/micro_arena_constants.h"
 #include "tensorflow/lite/micro/micro_log.h"
 #include "tensorflow/lite/micro/micro_profiler.h"
 #include "tensorflow/lite/schema/schema_generated.h"
@@ -41,6 +44,27 @@ const char* OpNameFromRegistration(const TFLMRegistration* registration) {
   }
 }
 
+uint32_t EvalTensorBytes(const TfLiteEvalTensor* tensor) {
+  size_t bytes = 0;
+  if (TfLiteEvalTensorByteLength(tensor, &bytes) != kTfLiteOk) {
+    return 0;
+  }
+  return static_cast<uint32_t>(bytes);
+}
+
+// Size of the tensor's data in the model, or 0 if it lives in the arena. The
+// serialized size is used rather than the shape so that packed (int4,
+// block-sparse, compressed) weights are counted as stored.
+uint32_t ModelBufferBytes(const Model* model, const SubGraph* subgraph,
+                          int tensor_idx) {
+  const Tensor* tensor = subgraph->tensors()->Get(tensor_idx);
+  const Buffer* buffer = model->buffers()->Get(tensor->buffer());
+  if (buffer == nullptr || buffer->data() == nullptr) {
+    return 0;
+  }
+  return buffer->data()->size();
+}
+
 }  // namespace
 
 MicroInterpreterGraph::MicroInterpreterGraph(
@@ -57,7 +81,13 @@ MicroInterpreterGraph::MicroInterpreterGraph(
   }
 }
 
-MicroInterpreterGraph::~MicroInterpreterGraph() {}
+MicroInterpreterGraph::~MicroInterpreterGraph() {
+  // Waits for a copy in flight and frees the DMA channels; the engine lives
+  // in the arena.
+  if (weight_copy_engine_ != nullptr) {
+    weight_copy_engine_->~WeightCopyEngine();
+  }
+}
 
 TfLiteStatus MicroInterpreterGraph::InitSubgraphs() {
   int previous_subgraph_idx = current_subgraph_index_;
@@ -97,7 +127,56 @@ TfLiteStatus MicroInterpreterGraph::InitSubgraphs() {
   return kTfLiteOk;
 }
 
+TfLiteStatus MicroInterpreterGraph::AllocateOpCosts() {
+  op_costs_ = static_cast<MicroOpCost**>(allocator_->AllocatePersistentBuffer(
+      sizeof(MicroOpCost*) * subgraphs_->size()));
+  TF_LITE_ENSURE(context_, op_costs_ != nullptr);
+
+  for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
+       subgraph_idx++) {
+    const SubGraph* subgraph = subgraphs_->Get(subgraph_idx);
+    const uint32_t operators_size = NumSubgraphOperators(subgraph);
+    op_costs_[subgraph_idx] =
+        static_cast<MicroOpCost*>(allocator_->AllocatePersistentBuffer(
+            sizeof(MicroOpCost) * operators_size));
+    TF_LITE_ENSURE(context_, op_costs_[subgraph_idx] != nullptr);
+
+    const SubgraphAllocations& allocations =
+        subgraph_allocations_[subgraph_idx];
+    for (uint32_t op_idx = 0; op_idx < operators_size; ++op_idx) {
+      const TfLiteNode& node = allocations.node_and_registrations[op_idx].node;
+      MicroOpCost& cost = op_costs_[subgraph_idx][op_idx];
+      cost = {};
+      for (int i = 0; i < node.inputs->size; ++i) {
+        const int tensor_idx = node.inputs->data[i];
+        if (tensor_idx < 0) {
+          continue;
+        }
+        const uint32_t weight_bytes =
+            ModelBufferBytes(model_, subgraph, tensor_idx);
+        if (weight_bytes > 0) {
+          cost.weight_bytes += weight_bytes;
+        } else {
+          cost.input_bytes += EvalTensorBytes(&allocations.tensors[tensor_idx]);
+        }
+      }
+      for (int i = 0; i < node.outputs->size; ++i) {
+        const int tensor_idx = node.outputs->data[i];
+        if (tensor_idx < 0) {
+          continue;
+        }
+        cost.output_bytes += EvalTensorBytes(&allocations.tensors[tensor_idx]);
+      }
+    }
+  }
+  return kTfLiteOk;
+}
+
 TfLiteStatus MicroInterpreterGraph::PrepareSubgraphs() {
+  if (context_->profiler != nullptr && op_costs_ == nullptr) {
+    TF_LITE_ENSURE_STATUS(AllocateOpCosts());
+  }
+
   int previous_subgraph_idx = current_subgraph_index_;
   uint32_t previous_operator_idx = current_operator_index_;
   for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
@@ -194,6 +273,287 @@ TfLiteStatus MicroInterpreterGraph::FreeSubgraphs() {
   return kTfLiteOk;
 }
 
+TfLiteStatus MicroInterpreterGraph::BuildInvokePlans() {
+  invoke_plans_ = static_cast<InvokePlan*>(allocator_->AllocatePersistentBuffer(
+      sizeof(InvokePlan) * subgraphs_->size()));
+  TF_LITE_ENSURE(context_, invoke_plans_ != nullptr);
+
+  for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
+       subgraph_idx++) {
+    const uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
+    InvokeStep* steps =
+        static_cast<InvokeStep*>(allocator_->AllocatePersistentBuffer(
+            sizeof(InvokeStep) * operators_size));
+    TF_LITE_ENSURE(context_, steps != nullptr);
+
+    NodeAndRegistration* node_and_registrations =
+        subgraph_allocations_[subgraph_idx].node_and_registrations;
+    for (uint32_t op_idx = 0; op_idx < operators_size; ++op_idx) {
+      NodeAndRegistration& node_and_registration =
+          node_and_registrations[op_idx];
+      TFLITE_DCHECK(node_and_registration.registration->invoke);
+      steps[op_idx].invoke = node_and_registration.registration->invoke;
+      steps[op_idx].node = &node_and_registration.node;
+      steps[op_idx].operator_idx = op_idx;
+    }
+    invoke_plans_[subgraph_idx].steps = steps;
+    invoke_plans_[subgraph_idx].size = operators_size;
+  }
+  return kTfLiteOk;
+}
+
+bool MicroInterpreterGraph::IsFoldable(int subgraph_idx,
+                                       const NodeAndRegistration& op) const {
+  // Kernels that only copy or convert their inputs and never ask for scratch
+  // buffers, which do not exist before memory planning.
+  switch (op.registration->builtin_code) {
+    case BuiltinOperator_CAST:
+    case BuiltinOperator_CONCATENATION:
+    case BuiltinOperator_DEQUANTIZE:
+    case BuiltinOperator_EXPAND_DIMS:
+    case BuiltinOperator_FILL:
+    case BuiltinOperator_GATHER:
+    case BuiltinOperator_PACK:
+    case BuiltinOperator_QUANTIZE:
+    case BuiltinOperator_RESHAPE:
+    case BuiltinOperator_SHAPE:
+    case BuiltinOperator_SQUEEZE:
+    case BuiltinOperator_STRIDED_SLICE:
+    case BuiltinOperator_UNPACK:
+      break;
+    default:
+      return false;
+  }
+
+  const SubGraph* subgraph = model_->subgraphs()->Get(subgraph_idx);
+  const TfLiteEvalTensor* tensors = subgraph_allocations_[subgraph_idx].tensors;
+  // Until memory planning, only constant tensors and the outputs of folded
+  // operators have data.
+  if (op.registration->builtin_code != BuiltinOperator_SHAPE) {
+    for (int i = 0; i < op.node.inputs->size; ++i) {
+      const int tensor_idx = op.node.inputs->data[i];
+      if (tensor_idx < 0) {
+        continue;
+      }
+      if (tensors[tensor_idx].data.data == nullptr ||
+          subgraph->tensors()->Get(tensor_idx)->is_variable()) {
+        return false;
+      }
+    }
+  }
+
+  // Subgraph outputs stay in the arena, where the interpreter and the control
+  // flow kernels expect them.
+  for (int i = 0; i < op.node.outputs->size; ++i) {
+    const int tensor_idx = op.node.outputs->data[i];
+    if (tensor_idx < 0 || tensors[tensor_idx].data.data != nullptr ||
+        subgraph->tensors()->Get(tensor_idx)->is_variable() ||
+        EvalTensorBytes(&tensors[tensor_idx]) == 0) {
+      return false;
+    }
+    if (subgraph->outputs() != nullptr) {
+      for (size_t j = 0; j < subgraph->outputs()->size(); ++j) {
+        if (subgraph->outputs()->Get(j) == tensor_idx) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+TfLiteStatus MicroInterpreterGraph::FoldConstants() {
+  TF_LITE_ENSURE(context_, invoke_plans_ != nullptr);
+
+  int previous_subgraph_idx = current_subgraph_index_;
+  uint32_t previous_operator_idx = current_operator_index_;
+  for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
+       subgraph_idx++) {
+    current_subgraph_index_ = subgraph_idx;
+    InvokePlan& plan = invoke_plans_[subgraph_idx];
+    const SubgraphAllocations& allocations =
+        subgraph_allocations_[subgraph_idx];
+
+    // Operators are in execution order, so one pass sees the producers of a
+    // chain before its consumers.
+    uint32_t kept_size = 0;
+    for (uint32_t step_idx = 0; step_idx < plan.size; ++step_idx) {
+      const InvokeStep step = plan.steps[step_idx];
+      const NodeAndRegistration& op =
+          allocations.node_and_registrations[step.operator_idx];
+      if (!IsFoldable(subgraph_idx, op)) {
+        plan.steps[kept_size++] = step;
+        continue;
+      }
+
+      for (int i = 0; i < op.node.outputs->size; ++i) {
+        TfLiteEvalTensor* output =
+            &allocations.tensors[op.node.outputs->data[i]];
+        output->data.data =
+            allocator_->AllocatePersistentBuffer(EvalTensorBytes(output));
+        TF_LITE_ENSURE(context_, output->data.data != nullptr);
+      }
+
+      current_operator_index_ = step.operator_idx;
+      TfLiteStatus invoke_status = step.invoke(context_, step.node);
+#ifdef USE_TFLM_COMPRESSION
+      GetMicroContext(context_)->ResetDecompressionMemoryAllocations();
+#endif  // USE_TFLM_COMPRESSION
+      if (allocator_->HasTempAllocations()) {
+        TF_LITE_ENSURE_STATUS(allocator_->ResetTempAllocations());
+      }
+      if (invoke_status != kTfLiteOk) {
+        return InvokeFailed(subgraph_idx, step.operator_idx, invoke_status);
+      }
+      folded_operators_size_++;
+    }
+    plan.size = kept_size;
+  }
+  current_subgraph_index_ = previous_subgraph_idx;
+  current_operator_index_ = previous_operator_idx;
+  return kTfLiteOk;
+}
+
+uint32_t MicroInterpreterGraph::SelectStagedTensors(
+    const InvokeStep& step, uint32_t half_size,
+    StagedTensor* tensors) const {
+  const SubGraph* subgraph = subgraphs_->Get(0);
+  TfLiteEvalTensor* eval_tensors = subgraph_allocations_[0].tensors;
+  const TfLiteNode* node = step.node;
+  TfLiteEvalTensor* picked[WeightCopyEngine::kMaxCopies];
+  uint32_t picked_size = 0;
+  uint32_t offset = 0;
+  for (int i = 0; i < node->inputs->size &&
+                  picked_size < WeightCopyEngine::kMaxCopies;
+       ++i) {
+    const int tensor_idx = node->inputs->data[i];
+    if (tensor_idx < 0) {
+      continue;
+    }
+    // Only data that is still in the model: not variables, and not the
+    // outputs of folded operators.
+    TfLiteEvalTensor* tensor = &eval_tensors[tensor_idx];
+    const Buffer* buffer =
+        model_->buffers()->Get(subgraph->tensors()->Get(tensor_idx)->buffer());
+    if (buffer == nullptr || buffer->data() == nullptr ||
+        tensor->data.data != buffer->data()->data()) {
+      continue;
+    }
+    bool already_picked = false;
+    for (uint32_t j = 0; j < picked_size; ++j) {
+      already_picked = already_picked || picked[j] == tensor;
+    }
+    const uint32_t size = buffer->data()->size();
+    const uint32_t aligned_size =
+        AlignSizeUp(size, MicroArenaBufferAlignment());
+    if (already_picked || aligned_size > half_size - offset) {
+      continue;
+    }
+    if (tensors != nullptr) {
+      tensors[picked_size] = {tensor, tensor->data.data, offset, size};
+    }
+    picked[picked_size++] = tensor;
+    offset += aligned_size;
+  }
+  return picked_size;
+}
+
+TfLiteStatus MicroInterpreterGraph::BuildWeightStagingPlan(
+    uint8_t* buffer, size_t buffer_size) {
+  TF_LITE_ENSURE(context_, invoke_plans_ != nullptr);
+  uint8_t* aligned_buffer =
+      AlignPointerUp(buffer, MicroArenaBufferAlignment());
+  if (buffer == nullptr ||
+      static_cast<size_t>(aligned_buffer - buffer) >= buffer_size) {
+    MicroPrintf("Weight staging buffer is too small");
+    return kTfLiteError;
+  }
+  const uint32_t half_size = static_cast<uint32_t>(
+      (buffer_size - (aligned_buffer - buffer)) / 2 /
+      MicroArenaBufferAlignment() * MicroArenaBufferAlignment());
+
+  const InvokePlan& plan = invoke_plans_[0];
+  if (plan.size == 0) {
+    return kTfLiteOk;
+  }
+  StagedStep* steps = static_cast<StagedStep*>(
+      allocator_->AllocatePersistentBuffer(sizeof(StagedStep) * plan.size));
+  TF_LITE_ENSURE(context_, steps != nullptr);
+  uint32_t staged_tensors_size = 0;
+  for (uint32_t step_idx = 0; step_idx < plan.size; ++step_idx) {
+    steps[step_idx].size =
+        SelectStagedTensors(plan.steps[step_idx], half_size, nullptr);
+    staged_tensors_size += steps[step_idx].size;
+  }
+
+  StagedTensor* tensors = nullptr;
+  if (staged_tensors_size > 0) {
+    tensors = static_cast<StagedTensor*>(allocator_->AllocatePersistentBuffer(
+        sizeof(StagedTensor) * staged_tensors_size));
+    TF_LITE_ENSURE(context_, tensors != nullptr);
+  }
+  staged_weight_bytes_ = 0;
+  for (uint32_t step_idx = 0; step_idx < plan.size; ++step_idx) {
+    steps[step_idx].tensors = tensors;
+    SelectStagedTensors(plan.steps[step_idx], half_size, tensors);
+    for (uint32_t i = 0; i < steps[step_idx].size; ++i) {
+      staged_weight_bytes_ += tensors[i].size;
+    }
+    tensors += steps[step_idx].size;
+  }
+
+  void* engine_memory =
+      allocator_->AllocatePersistentBuffer(sizeof(WeightCopyEngine));
+  TF_LITE_ENSURE(context_, engine_memory != nullptr);
+  weight_copy_engine_ = new (engine_memory) WeightCopyEngine();
+  staged_steps_ = steps;
+  staging_buffer_ = aligned_buffer;
+  staging_half_size_ = half_size;
+  staging_half_ = 0;
+  staging_primed_ = false;
+  return kTfLiteOk;
+}
+
+void MicroInterpreterGraph::StartStagingCopy(uint32_t step_idx) {
+  const StagedStep& step = staged_steps_[step_idx];
+  if (step.size == 0) {
+    return;
+  }
+  uint8_t* half = staging_buffer_ + staging_half_ * staging_half_size_;
+  WeightCopyEngine::Copy copies[WeightCopyEngine::kMaxCopies];
+  for (uint32_t i = 0; i < step.size; ++i) {
+    copies[i] = {half + step.tensors[i].offset, step.tensors[i].model_data,
+                 step.tensors[i].size};
+  }
+  weight_copy_engine_->Start(copies, step.size);
+}
+
+void MicroInterpreterGraph::BeginStagedStep(uint32_t step_idx) {
+  if (!staging_primed_) {
+    StartStagingCopy(step_idx);
+    staging_primed_ = true;
+  }
+  weight_copy_engine_->Wait();
+  const StagedStep& step = staged_steps_[step_idx];
+  uint8_t* half = staging_buffer_ + staging_half_ * staging_half_size_;
+  for (uint32_t i = 0; i < step.size; ++i) {
+    step.tensors[i].tensor->data.data = half + step.tensors[i].offset;
+  }
+  // The copy for the step after the last one is for the first step of the
+  // next invocation.
+  staging_half_ ^= 1;
+  const uint32_t next_step_idx =
+      step_idx + 1 < invoke_plans_[0].size ? step_idx + 1 : 0;
+  StartStagingCopy(next_step_idx);
+}
+
+void MicroInterpreterGraph::EndStagedStep(uint32_t step_idx) {
+  const StagedStep& step = staged_steps_[step_idx];
+  for (uint32_t i = 0; i < step.size; ++i) {
+    step.tensors[i].tensor->data.data = step.tensors[i].model_data;
+  }
+}
+
 TfLiteStatus MicroInterpreterGraph::InvokeSubgraph(int subgraph_idx) {
   int previous_subgraph_idx = current_subgraph_index_;
   uint32_t previous_operator_idx = current_operator_index_;
@@ -204,9 +564,31 @@ TfLiteStatus MicroInterpreterGraph::InvokeSubgraph(int subgraph_idx) {
                 subgraph_idx, subgraphs_->size());
     return kTfLiteError;
   }
-  uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
-  for (current_operator_index_ = 0; current_operator_index_ < operators_size;
-       ++current_operator_index_) {
+  if (invoke_plans_ != nullptr && context_->profiler == nullptr) {
+    TF_LITE_ENSURE_STATUS(InvokeSubgraphPlan(subgraph_idx));
+    current_subgraph_index_ = previous_subgraph_idx;
+    current_operator_index_ = previous_operator_idx;
+    return kTfLiteOk;
+  }
+
+  // Once the plans are built, follow them so that folded operators are
+  // skipped with a profiler attached too.
+  const InvokePlan* plan =
+      invoke_plans_ != nullptr ? &invoke_plans_[subgraph_idx] : nullptr;
+  uint32_t steps_size =
+      plan != nullptr ? plan->size : NumSubgraphOperators(model_, subgraph_idx);
+  // Staging needs the plan, which exists whenever staged_steps_ does.
+  const bool staged = subgraph_idx == 0 && staged_steps_ != nullptr;
+  for (uint32_t step_idx = 0; step_idx < steps_size; ++step_idx) {
+    current_operator_index_ =
+        plan != nullptr ? plan->steps[step_idx].operator_idx : step_idx;
+    if (staged) {
+      // Time spent waiting for the copy, and starting the next one.
+      ScopedMicroProfiler scoped_staging(
+          "STAGE_WEIGHTS",
+          reinterpret_cast<MicroProfilerInterface*>(context_->profiler));
+      BeginStagedStep(step_idx);
+    }
     TfLiteNode* node = &(subgraph_allocations_[subgraph_idx]
                              .node_and_registrations[current_operator_index_]
                              .node);
@@ -222,6 +604,10 @@ TfLiteStatus MicroInterpreterGraph::InvokeSubgraph(int subgraph_idx) {
     ScopedMicroProfiler scoped_profiler(
         OpNameFromRegistration(registration),
         reinterpret_cast<MicroProfilerInterface*>(context_->profiler));
+    if (op_costs_ != nullptr) {
+      scoped_profiler.SetCost(
+          op_costs_[subgraph_idx][current_operator_index_]);
+    }
 #endif
 
     TFLITE_DCHECK(registration->invoke);
@@ -236,13 +622,14 @@ TfLiteStatus MicroInterpreterGraph::InvokeSubgraph(int subgraph_idx) {
     // prepare for the next call.
     allocator_->ResetTempAllocations();
 
-    if (invoke_status == kTfLiteError) {
-      MicroPrintf("Node %s (number %d) failed to invoke with status %d",
-                  OpNameFromRegistration(registration), current_operator_index_,
-                  invoke_status);
-      return kTfLiteError;
-    } else if (invoke_status != kTfLiteOk) {
-      return invoke_status;
+    if (staged) {
+      EndStagedStep(step_idx);
+      // The next invocation starts over with the first step's weights.
+      staging_primed_ = staging_primed_ && invoke_status == kTfLiteOk;
+    }
+    if (invoke_status != kTfLiteOk) {
+      return InvokeFailed(subgraph_idx, current_operator_index_,
+                          invoke_status);
     }
   }
   current_subgraph_index_ = previous_subgraph_idx;
@@ -250,6 +637,52 @@ TfLiteStatus MicroInterpreterGraph::InvokeSubgraph(int subgraph_idx) {
   return kTfLiteOk;
 }
 
+TfLiteStatus MicroInterpreterGraph::InvokeSubgraphPlan(int subgraph_idx) {
+  const InvokePlan& plan = invoke_plans_[subgraph_idx];
+  const bool staged = subgraph_idx == 0 && staged_steps_ != nullptr;
+  for (uint32_t step_idx = 0; step_idx < plan.size; ++step_idx) {
+    const InvokeStep& step = plan.steps[step_idx];
+    current_operator_index_ = step.operator_idx;
+    if (staged) {
+      BeginStagedStep(step_idx);
+    }
+    TfLiteStatus invoke_status = step.invoke(context_, step.node);
+    if (staged) {
+      EndStagedStep(step_idx);
+      staging_primed_ = staging_primed_ && invoke_status == kTfLiteOk;
+    }
+#ifdef USE_TFLM_COMPRESSION
+    GetMicroContext(context_)->ResetDecompressionMemoryAllocations();
+#endif  // USE_TFLM_COMPRESSION
+
+    // Only kernels that built TfLiteTensor structs in Eval leave a chain of
+    // temp allocations to reset.
+    if (allocator_->HasTempAllocations()) {
+      allocator_->ResetTempAllocations();
+    }
+
+    if (invoke_status != kTfLiteOk) {
+      return InvokeFailed(subgraph_idx, step.operator_idx, invoke_status);
+    }
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreterGraph::InvokeFailed(int subgraph_idx,
+                                                 uint32_t operator_idx,
+                                                 TfLiteStatus invoke_status) {
+  if (invoke_status == kTfLiteError) {
+    const TFLMRegistration* registration =
+        subgraph_allocations_[subgraph_idx]
+            .node_and_registrations[operator_idx]
+            .registration;
+    MicroPrintf("Node %s (number %d) failed to invoke with status %d",
+                OpNameFromRegistration(registration), operator_idx,
+                invoke_status);
+  }
+  return invoke_status;
+}
+
 TfLiteStatus MicroInterpreterGraph::ResetVariableTensors() {
   for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
        subgraph_idx++) {
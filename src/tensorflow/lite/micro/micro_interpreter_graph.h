@@ -19,7 +19,9 @@ limitations under the License.
 #include "tensorflow/lite/micro/micro_allocator.h"
 #include "tensorflow/lite/micro/micro_common.h"
 #include "tensorflow/lite/micro/micro_graph.h"
+#include "tensorflow/lite/micro/micro_op_cost.h"
 #include "tensorflow/lite/micro/micro_resource_variable.h"
+#include "tensorflow/lite/micro/weight_copy_engine.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
 namespace tflite {
@@ -59,6 +61,36 @@ class MicroInterpreterGraph : public MicroGraph {
   // in the model.
   virtual TfLiteStatus InvokeSubgraph(int subgraph_idx);
 
+  // Copies the invoke function and node of every operator into one flat
+  // array per subgraph, in persistent memory. Once built, InvokeSubgraph()
+  // runs from these arrays without touching the flatbuffer or the
+  // registrations, and without the profiler scope when no profiler is
+  // attached. Called by AllocateTensors() once every operator is prepared.
+  TfLiteStatus BuildInvokePlans();
+
+  // Invokes, once, every operator whose inputs are all constant (SHAPE only
+  // needs the static shape of its input) and whose kernel is known to need
+  // no scratch buffers, stores its outputs in persistent memory and drops it
+  // from the invoke plan. Outputs of folded operators are constant in turn,
+  // so chains such as SHAPE -> STRIDED_SLICE -> PACK fold entirely. Must run
+  // after BuildInvokePlans() and before memory planning, which then skips the
+  // folded outputs.
+  TfLiteStatus FoldConstants();
+
+  // Returns the number of operators FoldConstants() removed from the plans.
+  size_t folded_operators_size() const { return folded_operators_size_; }
+
+  // Makes InvokeSubgraph(0) copy the weights that each operator reads from
+  // the model into `buffer` while the operator before it runs, and point the
+  // operator's eval tensors at the copies while it runs. One half of the
+  // buffer holds the weights of the running operator, the other those being
+  // copied for the next one. Weights that do not fit in a half are read from
+  // the model as before. Must run after FoldConstants().
+  TfLiteStatus BuildWeightStagingPlan(uint8_t* buffer, size_t buffer_size);
+
+  // Weight bytes copied in each invocation of subgraph 0.
+  size_t staged_weight_bytes() const { return staged_weight_bytes_; }
+
   // Zeros out all variable tensors in all subgraphs in the model.
   virtual TfLiteStatus ResetVariableTensors();
 
@@ -98,7 +130,78 @@ class MicroInterpreterGraph : public MicroGraph {
   // Get the resource variables for this TFLM graph.
   MicroResourceVariables* GetResourceVariables() { return resource_variables_; }
 
+  // Cost record of the current operator. Costs are only collected when a
+  // profiler is attached at PrepareSubgraphs(); otherwise this is nullptr.
+  MicroOpCost* GetCurrentOpCost() {
+    if (op_costs_ == nullptr) {
+      return nullptr;
+    }
+    return &op_costs_[current_subgraph_index_][current_operator_index_];
+  }
+
+  // All cost records, indexed by subgraph and then operator, or nullptr.
+  MicroOpCost** GetOpCosts() { return op_costs_; }
+
  private:
+  // What the invoke loop needs of one operator.
+  struct InvokeStep {
+    TfLiteStatus (*invoke)(TfLiteContext* context, TfLiteNode* node);
+    TfLiteNode* node;
+    uint32_t operator_idx;
+  };
+
+  struct InvokePlan {
+    InvokeStep* steps;
+    uint32_t size;
+  };
+
+  // A weight tensor that is copied before its operator runs.
+  struct StagedTensor {
+    TfLiteEvalTensor* tensor;
+    // Where the tensor's data is in the model.
+    void* model_data;
+    // Where the copy goes, from the start of a staging buffer half.
+    uint32_t offset;
+    uint32_t size;
+  };
+
+  // The staged tensors of one step of the invoke plan of subgraph 0.
+  struct StagedStep {
+    StagedTensor* tensors;
+    uint32_t size;
+  };
+
+  // Allocates one cost record per operator and fills in the tensor byte
+  // counts, before the kernels see them in Prepare.
+  TfLiteStatus AllocateOpCosts();
+
+  // Returns true if FoldConstants() can evaluate the operator now.
+  bool IsFoldable(int subgraph_idx, const NodeAndRegistration& op) const;
+
+  // InvokeSubgraph() without a profiler, once the plans are built.
+  TfLiteStatus InvokeSubgraphPlan(int subgraph_idx);
+
+  // Picks the weights of a step that fit in a staging buffer half, and fills
+  // in `tensors` unless it is nullptr. Returns how many were picked.
+  uint32_t SelectStagedTensors(const InvokeStep& step, uint32_t half_size,
+                               StagedTensor* tensors) const;
+
+  // Starts copying the weights of step `step_idx` of subgraph 0 into the
+  // staging buffer half that is not in use.
+  void StartStagingCopy(uint32_t step_idx);
+
+  // Waits for the weights of step `step_idx` of subgraph 0, points its
+  // tensors at them and starts copying those of the step after it.
+  void BeginStagedStep(uint32_t step_idx);
+
+  // Points the tensors of step `step_idx` back into the model.
+  void EndStagedStep(uint32_t step_idx);
+
+  // Logs and converts the status of an operator that did not return
+  // kTfLiteOk.
+  TfLiteStatus InvokeFailed(int subgraph_idx, uint32_t operator_idx,
+                            TfLiteStatus invoke_status);
+
   TfLiteContext* context_;
   const Model* model_;
   MicroAllocator* allocator_;
@@ -106,6 +209,22 @@ class MicroInterpreterGraph : public MicroGraph {
   int current_subgraph_index_;
   uint32_t current_operator_index_;
   MicroResourceVariables* resource_variables_;
+  // Indexed by subgraph, then operator.
+  MicroOpCost** op_costs_ = nullptr;
+  // Indexed by subgraph, or nullptr until BuildInvokePlans().
+  InvokePlan* invoke_plans_ = nullptr;
+  size_t folded_operators_size_ = 0;
+  // Indexed by the steps of the invoke plan of subgraph 0, or nullptr when
+  // weights are not staged.
+  StagedStep* staged_steps_ = nullptr;
+  WeightCopyEngine* weight_copy_engine_ = nullptr;
+  uint8_t* staging_buffer_ = nullptr;
+  uint32_t staging_half_size_ = 0;
+  // The half that holds, or receives, the weights of the next step to run.
+  int staging_half_ = 0;
+  // Whether the weights of the first step have been requested.
+  bool staging_primed_ = false;
+  size_t staged_weight_bytes_ = 0;
   const flatbuffers::Vector<flatbuffers::Offset<SubGraph>>* subgraphs_ =
       nullptr;  // Initialized as nullptr to prevent any possible issues
                 // related to accessing uninitialized memory.
@@ -0,0 +1,320 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_model_verifier.h"
+
+#include <cstdint>
+
+#include "tensorflow/lite/core/api/flatbuffer_conversions.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+namespace tflite {
+namespace {
+
+// The generated Verify() of Model and SubGraph recurse into every tensor,
+// operator and buffer. Those two tables are instead checked one level deep
+// through the flatbuffers::Table they privately inherit from.
+const flatbuffers::Table* AsTable(const void* table) {
+  return reinterpret_cast<const flatbuffers::Table*>(table);
+}
+
+// Largest tensor the allocator can size: TfLiteTensor::bytes and the memory
+// planner use int arithmetic.
+constexpr int64_t kMaxTensorBytes = INT32_MAX;
+
+}  // namespace
+
+MicroModelVerifier::MicroModelVerifier(const Model* model,
+                                       const uint8_t* model_data,
+                                       size_t model_size)
+    : model_(model), model_data_(model_data), verifier_(model_data, model_size) {}
+
+TfLiteStatus MicroModelVerifier::VerifyModel() {
+  // The root offset is read by GetModel().
+  const size_t root_offset = verifier_.VerifyOffset(0);
+  if (root_offset == 0 ||
+      reinterpret_cast<const uint8_t*>(model_) != model_data_ + root_offset) {
+    MicroPrintf("Model: the model is not the root of its buffer");
+    return kTfLiteError;
+  }
+
+  const flatbuffers::Table* root = AsTable(model_);
+  if (!root->VerifyTableStart(verifier_) ||
+      !root->VerifyOffset(verifier_, Model::VT_OPERATOR_CODES) ||
+      !verifier_.VerifyVector(model_->operator_codes()) ||
+      !root->VerifyOffsetRequired(verifier_, Model::VT_SUBGRAPHS) ||
+      !verifier_.VerifyVector(model_->subgraphs()) ||
+      !root->VerifyOffsetRequired(verifier_, Model::VT_BUFFERS) ||
+      !verifier_.VerifyVector(model_->buffers()) ||
+      !root->VerifyOffset(verifier_, Model::VT_METADATA) ||
+      !verifier_.VerifyVectorOfTables(model_->metadata()) ||
+      !verifier_.EndTable()) {
+    MicroPrintf("Model: invalid root table");
+    return kTfLiteError;
+  }
+  if (model_->subgraphs()->size() == 0) {
+    MicroPrintf("Model: no subgraphs");
+    return kTfLiteError;
+  }
+
+  // Metadata is looked up by name before any tensor is read, and its buffers
+  // hold the offline memory plan, block sparsity and requantization tables.
+  if (model_->metadata() != nullptr) {
+    for (size_t i = 0; i < model_->metadata()->size(); ++i) {
+      TF_LITE_ENSURE_STATUS(VerifyBuffer(model_->metadata()->Get(i)->buffer()));
+    }
+  }
+
+  for (size_t i = 0; i < model_->subgraphs()->size(); ++i) {
+    TF_LITE_ENSURE_STATUS(VerifySubgraph(i));
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroModelVerifier::VerifyTensor(size_t subgraph_idx,
+                                              size_t tensor_idx, bool packed) {
+  if (subgraph_idx >= model_->subgraphs()->size()) {
+    MicroPrintf("Model: invalid subgraph index %u",
+                static_cast<unsigned>(subgraph_idx));
+    return kTfLiteError;
+  }
+  const auto* tensors = model_->subgraphs()->Get(subgraph_idx)->tensors();
+  if (tensor_idx >= tensors->size()) {
+    MicroPrintf("Model: invalid tensor index %u in subgraph %u",
+                static_cast<unsigned>(tensor_idx),
+                static_cast<unsigned>(subgraph_idx));
+    return kTfLiteError;
+  }
+  const Tensor* tensor = tensors->Get(tensor_idx);
+  if (!verifier_.VerifyTable(tensor)) {
+    MicroPrintf("Model: invalid table for tensor %u in subgraph %u",
+                static_cast<unsigned>(tensor_idx),
+                static_cast<unsigned>(subgraph_idx));
+    return kTfLiteError;
+  }
+
+  TfLiteType type;
+  TF_LITE_ENSURE_STATUS(ConvertTensorType(tensor->type(), &type));
+
+  int64_t elements = 1;
+  if (tensor->shape() != nullptr) {
+    for (size_t i = 0; i < tensor->shape()->size(); ++i) {
+      const int32_t dim = tensor->shape()->Get(i);
+      if (dim < 0 || (dim > 0 && elements > kMaxTensorBytes / dim)) {
+        MicroPrintf("Model: tensor %u in subgraph %u has an invalid shape",
+                    static_cast<unsigned>(tensor_idx),
+                    static_cast<unsigned>(subgraph_idx));
+        return kTfLiteError;
+      }
+      elements *= dim;
+    }
+  }
+
+  const QuantizationParameters* quantization = tensor->quantization();
+  if (quantization != nullptr && quantization->scale() != nullptr &&
+      quantization->scale()->size() > 1) {
+    // Per-channel parameters: one per slice along the quantized dimension.
+    const int32_t dimension = quantization->quantized_dimension();
+    if (tensor->shape() == nullptr || dimension < 0 ||
+        static_cast<size_t>(dimension) >= tensor->shape()->size() ||
+        static_cast<size_t>(tensor->shape()->Get(dimension)) !=
+            quantization->scale()->size()) {
+      MicroPrintf(
+          "Model: tensor %u in subgraph %u has per-channel quantization that "
+          "does not match its shape",
+          static_cast<unsigned>(tensor_idx),
+          static_cast<unsigned>(subgraph_idx));
+      return kTfLiteError;
+    }
+  }
+
+  TF_LITE_ENSURE_STATUS(VerifyBuffer(tensor->buffer()));
+  const auto* data = model_->buffers()->Get(tensor->buffer())->data();
+  if (data == nullptr || data->size() == 0 || packed) {
+    return kTfLiteOk;
+  }
+  size_t type_size;
+  if (TfLiteTypeSizeOf(type, &type_size) != kTfLiteOk) {
+    // Strings and resources have no fixed size per element.
+    return kTfLiteOk;
+  }
+  const int64_t bytes = type == kTfLiteInt4
+                            ? (elements + 1) / 2
+                            : elements * static_cast<int64_t>(type_size);
+  if (bytes > kMaxTensorBytes || static_cast<int64_t>(data->size()) < bytes) {
+    MicroPrintf(
+        "Model: tensor %u in subgraph %u needs %u bytes but its buffer holds "
+        "%u",
+        static_cast<unsigned>(tensor_idx), static_cast<unsigned>(subgraph_idx),
+        static_cast<unsigned>(bytes), static_cast<unsigned>(data->size()));
+    return kTfLiteError;
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroModelVerifier::VerifyOperator(size_t subgraph_idx,
+                                                size_t operator_idx) {
+  const SubGraph* subgraph = model_->subgraphs()->Get(subgraph_idx);
+  const Operator* op = subgraph->operators()->Get(operator_idx);
+  if (!verifier_.VerifyTable(op)) {
+    MicroPrintf("Model: invalid table for operator %u in subgraph %u",
+                static_cast<unsigned>(operator_idx),
+                static_cast<unsigned>(subgraph_idx));
+    return kTfLiteError;
+  }
+
+  const size_t tensors_size = subgraph->tensors()->size();
+  if (VerifyTensorIndices(op->inputs(), tensors_size, true) != kTfLiteOk ||
+      VerifyTensorIndices(op->outputs(), tensors_size, true) != kTfLiteOk ||
+      VerifyTensorIndices(op->intermediates(), tensors_size, false) !=
+          kTfLiteOk) {
+    MicroPrintf("Model: operator %u in subgraph %u has an invalid tensor index",
+                static_cast<unsigned>(operator_idx),
+                static_cast<unsigned>(subgraph_idx));
+    return kTfLiteError;
+  }
+
+  const auto* opcodes = model_->operator_codes();
+  if (opcodes == nullptr || op->opcode_index() >= opcodes->size()) {
+    MicroPrintf("Model: operator %u in subgraph %u has invalid opcode_index %u",
+                static_cast<unsigned>(operator_idx),
+                static_cast<unsigned>(subgraph_idx),
+                static_cast<unsigned>(op->opcode_index()));
+    return kTfLiteError;
+  }
+  const OperatorCode* opcode = opcodes->Get(op->opcode_index());
+  if (!verifier_.VerifyTable(opcode) ||
+      opcode->deprecated_builtin_code() < 0 ||
+      opcode->builtin_code() < BuiltinOperator_MIN ||
+      opcode->builtin_code() > BuiltinOperator_MAX) {
+    MicroPrintf("Model: invalid operator code %u",
+                static_cast<unsigned>(op->opcode_index()));
+    return kTfLiteError;
+  }
+
+  switch (GetBuiltinCode(opcode)) {
+    case BuiltinOperator_IF:
+      if (const IfOptions* options = op->builtin_options_as_IfOptions()) {
+        TF_LITE_ENSURE_STATUS(
+            VerifySubgraphIndex(options->then_subgraph_index()));
+        TF_LITE_ENSURE_STATUS(
+            VerifySubgraphIndex(options->else_subgraph_index()));
+      }
+      break;
+    case BuiltinOperator_WHILE:
+      if (const WhileOptions* options = op->builtin_options_as_WhileOptions()) {
+        TF_LITE_ENSURE_STATUS(
+            VerifySubgraphIndex(options->cond_subgraph_index()));
+        TF_LITE_ENSURE_STATUS(
+            VerifySubgraphIndex(options->body_subgraph_index()));
+      }
+      break;
+    case BuiltinOperator_CALL_ONCE:
+      if (const CallOnceOptions* options =
+              op->builtin_options_as_CallOnceOptions()) {
+        TF_LITE_ENSURE_STATUS(
+            VerifySubgraphIndex(options->init_subgraph_index()));
+      }
+      break;
+    default:
+      break;
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroModelVerifier::VerifyBuffer(size_t buffer_idx) {
+  const auto* buffers = model_->buffers();
+  if (buffer_idx >= buffers->size()) {
+    MicroPrintf("Model: invalid buffer index %u",
+                static_cast<unsigned>(buffer_idx));
+    return kTfLiteError;
+  }
+  const Buffer* buffer = buffers->Get(buffer_idx);
+  if (!verifier_.VerifyTable(buffer)) {
+    MicroPrintf("Model: invalid table for buffer %u",
+                static_cast<unsigned>(buffer_idx));
+    return kTfLiteError;
+  }
+  // Offsets 0 and 1 mean the data, if any, is inside the flatbuffer. TFLM
+  // does not read data stored after it and would treat such a tensor as one
+  // to allocate in the arena.
+  if (buffer->offset() > 1) {
+    MicroPrintf("Model: buffer %u is stored outside the flatbuffer",
+                static_cast<unsigned>(buffer_idx));
+    return kTfLiteError;
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroModelVerifier::VerifySubgraph(size_t subgraph_idx) {
+  const SubGraph* subgraph = model_->subgraphs()->Get(subgraph_idx);
+  const flatbuffers::Table* table = AsTable(subgraph);
+  if (!table->VerifyTableStart(verifier_) ||
+      !table->VerifyOffsetRequired(verifier_, SubGraph::VT_TENSORS) ||
+      !verifier_.VerifyVector(subgraph->tensors()) ||
+      !table->VerifyOffsetRequired(verifier_, SubGraph::VT_INPUTS) ||
+      !verifier_.VerifyVector(subgraph->inputs()) ||
+      !table->VerifyOffset(verifier_, SubGraph::VT_OUTPUTS) ||
+      !verifier_.VerifyVector(subgraph->outputs()) ||
+      !table->VerifyOffset(verifier_, SubGraph::VT_OPERATORS) ||
+      !verifier_.VerifyVector(subgraph->operators()) ||
+      !verifier_.EndTable()) {
+    MicroPrintf("Model: invalid table for subgraph %u",
+                static_cast<unsigned>(subgraph_idx));
+    return kTfLiteError;
+  }
+  const size_t tensors_size = subgraph->tensors()->size();
+  if (VerifyTensorIndices(subgraph->inputs(), tensors_size, false) !=
+          kTfLiteOk ||
+      VerifyTensorIndices(subgraph->outputs(), tensors_size, false) !=
+          kTfLiteOk) {
+    MicroPrintf("Model: subgraph %u has an invalid input or output index",
+                static_cast<unsigned>(subgraph_idx));
+    return kTfLiteError;
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroModelVerifier::VerifyTensorIndices(
+    const flatbuffers::Vector<int32_t>* indices, size_t tensors_size,
+    bool allow_optional) {
+  if (indices == nullptr) {
+    return kTfLiteOk;
+  }
+  for (size_t i = 0; i < indices->size(); ++i) {
+    const int32_t index = indices->Get(i);
+    if (index == kTfLiteOptionalTensor && allow_optional) {
+      continue;
+    }
+    if (index < 0 || static_cast<size_t>(index) >= tensors_size) {
+      return kTfLiteError;
+    }
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroModelVerifier::VerifySubgraphIndex(int32_t subgraph_idx) {
+  if (subgraph_idx < 0 ||
+      static_cast<size_t>(subgraph_idx) >= model_->subgraphs()->size()) {
+    MicroPrintf("Model: invalid subgraph index %d in control flow options",
+                static_cast<int>(subgraph_idx));
+    return kTfLiteError;
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace tflite
@@ -0,0 +1,82 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_MODEL_VERIFIER_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_MODEL_VERIFIER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "third_party/flatbuffers/include/flatbuffers/flatbuffers.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+
+// Checks the parts of a model flatbuffer that the interpreter reads, as the
+// allocator reaches them, instead of verifying the whole flatbuffer up front
+// with VerifyModelBuffer().
+//
+// VerifyModel() checks the root table and the subgraph tables: the vectors
+// they point to lie inside the model and the subgraph input and output
+// indices are in range. VerifyTensor() and VerifyOperator() check one tensor
+// or operator, and the buffer or operator code it refers to, right before
+// the allocator first reads it. Each object is visited once by the walk
+// AllocateTensors() already does, so verification adds no pass of its own.
+//
+// Beyond the flatbuffer structure, the checks cover the indices TFLM uses
+// without bounds checks: tensor indices of operators, buffer indices of
+// tensors, operator code indices and the subgraph indices of control flow
+// operators. Builtin codes must be in range and the data of a constant
+// tensor must hold as many bytes as its shape needs.
+//
+// Fields TFLM does not read (names, signature defs, sparsity parameters,
+// descriptions) are not checked, so a model this accepts may still fail the
+// full flatbuffer verifier.
+class MicroModelVerifier {
+ public:
+  // `model` must be the root of the `model_size` bytes at `model_data`.
+  MicroModelVerifier(const Model* model, const uint8_t* model_data,
+                     size_t model_size);
+
+  // Checks the root table, the subgraph tables and the metadata entries with
+  // the buffers they refer to.
+  TfLiteStatus VerifyModel();
+
+  // Checks tensor `tensor_idx` of subgraph `subgraph_idx` and its buffer.
+  // `packed` tensors (block-sparse or compressed) store fewer bytes than
+  // their shape needs, so their data size is left to the code unpacking it.
+  TfLiteStatus VerifyTensor(size_t subgraph_idx, size_t tensor_idx,
+                            bool packed);
+
+  // Checks operator `operator_idx` of subgraph `subgraph_idx`, its options
+  // and its operator code.
+  TfLiteStatus VerifyOperator(size_t subgraph_idx, size_t operator_idx);
+
+ private:
+  TfLiteStatus VerifyBuffer(size_t buffer_idx);
+  TfLiteStatus VerifySubgraph(size_t subgraph_idx);
+  TfLiteStatus VerifyTensorIndices(const flatbuffers::Vector<int32_t>* indices,
+                                   size_t tensors_size, bool allow_optional);
+  TfLiteStatus VerifySubgraphIndex(int32_t subgraph_idx);
+
+  const Model* model_;
+  const uint8_t* model_data_;
+  flatbuffers::Verifier verifier_;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_MODEL_VERIFIER_H_
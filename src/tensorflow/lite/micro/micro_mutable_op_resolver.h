@@ -15,8 +15,10 @@ limitations under the License.
 #ifndef TENSORFLOW_LITE_MICRO_MICRO_MUTABLE_OP_RESOLVER_H_
 #define TENSORFLOW_LITE_MICRO_MICRO_MUTABLE_OP_RESOLVER_H_
 
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <type_traits>
 
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/core/api/flatbuffer_conversions.h"
@@ -41,6 +43,13 @@ limitations under the License.
 namespace tflite {
 TFLMRegistration* Register_DETECTION_POSTPROCESS();
 
+namespace internal {
+constexpr unsigned int PowerOfTwoAtLeast(unsigned int n,
+                                         unsigned int power = 1) {
+  return power >= n ? power : PowerOfTwoAtLeast(n, power * 2);
+}
+}  // namespace internal
+
 template <unsigned int tOpCount>
 class MicroMutableOpResolver : public MicroOpResolver {
  public:
@@ -49,35 +58,19 @@ class MicroMutableOpResolver : public MicroOpResolver {
   explicit MicroMutableOpResolver() {}
 
   const TFLMRegistration* FindOp(tflite::BuiltinOperator op) const override {
-    if (op == BuiltinOperator_CUSTOM) return nullptr;
-
-    for (unsigned int i = 0; i < registrations_len_; ++i) {
-      const TFLMRegistration& registration = registrations_[i];
-      if (registration.builtin_code == op) {
-        return &registration;
-      }
-    }
-    return nullptr;
+    const int index = BuiltinIndex(op);
+    return index < 0 ? nullptr : &registrations_[index];
   }
 
   const TFLMRegistration* FindOp(const char* op) const override {
-    for (unsigned int i = 0; i < registrations_len_; ++i) {
-      const TFLMRegistration& registration = registrations_[i];
-      if ((registration.builtin_code == BuiltinOperator_CUSTOM) &&
-          (strcmp(registration.custom_name, op) == 0)) {
-        return &registration;
-      }
-    }
-    return nullptr;
+    const int index = CustomIndex(op);
+    return index < 0 ? nullptr : &registrations_[index];
   }
 
   TfLiteBridgeBuiltinParseFunction GetOpDataParser(
       BuiltinOperator op) const override {
-    TFLITE_DCHECK(num_buitin_ops_ <= tOpCount);
-    for (unsigned int i = 0; i < num_buitin_ops_; ++i) {
-      if (builtin_codes_[i] == op) return builtin_parsers_[i];
-    }
-    return nullptr;
+    const int index = BuiltinIndex(op);
+    return index < 0 ? nullptr : builtin_parsers_[index];
   }
 
   // Registers a Custom Operator with the MicroOpResolver.
@@ -102,7 +95,14 @@ class MicroMutableOpResolver : public MicroOpResolver {
       return kTfLiteError;
     }
 
+    unsigned int slot = HashCustomName(name) & (kCustomSlots - 1);
+    while (custom_slots_[slot] != 0) {
+      slot = (slot + 1) & (kCustomSlots - 1);
+    }
+    custom_slots_[slot] = static_cast<Slot>(registrations_len_ + 1);
+
     TFLMRegistration* new_registration = &registrations_[registrations_len_];
+    builtin_parsers_[registrations_len_] = nullptr;
     registrations_len_ += 1;
 
     *new_registration = *registration;
@@ -687,23 +687,65 @@ class MicroMutableOpResolver : public MicroOpResolver {
     // Strictly speaking, the builtin_code is not necessary for TFLM but filling
     // it in regardless.
     registrations_[registrations_len_].builtin_code = op;
+    builtin_parsers_[registrations_len_] = parser;
     registrations_len_++;
-
-    builtin_codes_[num_buitin_ops_] = op;
-    builtin_parsers_[num_buitin_ops_] = parser;
-    num_buitin_ops_++;
+    builtin_slots_[op] = static_cast<Slot>(registrations_len_);
 
     return kTfLiteOk;
   }
 
+  // The index into registrations_ of a builtin operator, or -1 if it is not
+  // registered. Operators outside the schema this was built with, as in
+  // models from a newer converter, are never registered.
+  int BuiltinIndex(tflite::BuiltinOperator op) const {
+    if (op < BuiltinOperator_MIN || op > BuiltinOperator_MAX) return -1;
+    return static_cast<int>(builtin_slots_[op]) - 1;
+  }
+
+  // The index into registrations_ of a custom operator, or -1 if it is not
+  // registered. custom_slots_ is at most half full, so probing always ends
+  // at an empty slot.
+  int CustomIndex(const char* name) const {
+    unsigned int slot = HashCustomName(name) & (kCustomSlots - 1);
+    while (custom_slots_[slot] != 0) {
+      const int index = static_cast<int>(custom_slots_[slot]) - 1;
+      if (strcmp(registrations_[index].custom_name, name) == 0) {
+        return index;
+      }
+      slot = (slot + 1) & (kCustomSlots - 1);
+    }
+    return -1;
+  }
+
+  // 32-bit FNV-1a.
+  static uint32_t HashCustomName(const char* name) {
+    uint32_t hash = 2166136261u;
+    for (; *name != '\0'; ++name) {
+      hash = (hash ^ static_cast<uint8_t>(*name)) * 16777619u;
+    }
+    return hash;
+  }
+
+  // Slots hold an index into registrations_ plus one, so that zero is empty.
+  using Slot = typename std::conditional<(tOpCount < UINT8_MAX), uint8_t,
+                                         uint16_t>::type;
+  static_assert(tOpCount < UINT16_MAX, "resolver size is too large");
+
+  static constexpr unsigned int kCustomSlots =
+      internal::PowerOfTwoAtLeast(2 * tOpCount);
+
   TFLMRegistration registrations_[tOpCount];
   unsigned int registrations_len_ = 0;
 
-  // Arrays (and counter) to store the builtin codes and their corresponding
-  // parse functions as these are registered with the Op Resolver.
-  BuiltinOperator builtin_codes_[tOpCount];
+  // The parse function of each registration, nullptr for custom operators.
   TfLiteBridgeBuiltinParseFunction builtin_parsers_[tOpCount];
-  unsigned int num_buitin_ops_ = 0;
+
+  // Lookup tables from a builtin code, or from the hash of a custom name
+  // (open addressing with linear probing), to the registration, so that
+  // FindOp() and GetOpDataParser() do not scan the registrations for every
+  // operator of every model that is allocated.
+  Slot builtin_slots_[BuiltinOperator_MAX + 1] = {};
+  Slot custom_slots_[kCustomSlots] = {};
 };
 
 };  // namespace tflite
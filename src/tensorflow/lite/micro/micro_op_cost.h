@@ -0,0 +1,54 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_OP_COST_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_OP_COST_H_
+
+#include <cstdint>
+
+namespace tflite {
+
+// Static cost of one invocation of an operator, worked out at Prepare time from
+// its shapes. Together with the measured ticks this places each node on a
+// roofline: MACs per tick for compute, bytes per tick for memory traffic.
+//
+// The interpreter fills in the byte counts from the node's tensors before
+// Prepare (inputs backed by the model are counted as weights). Kernels that
+// know better, for example because they skip pruned blocks, overwrite them,
+// and kernels that multiply-accumulate set `macs`.
+//
+// The arena usage is filled in by the allocator once the memory plan is
+// committed (see RecordOpArenaUsage), so that the node live at the arena
+// peak can be lined up with its ticks.
+struct MicroOpCost {
+  uint32_t macs;
+  uint32_t weight_bytes;
+  uint32_t input_bytes;
+  uint32_t output_bytes;
+  // Bytes of all planned buffers live while the operator runs: activations,
+  // its own scratch buffers and any scratch buffers of enclosing operators.
+  uint32_t live_bytes;
+  // Bytes of the scratch buffers the operator requested at Prepare.
+  uint32_t scratch_bytes;
+};
+
+// Total bytes read and written by one invocation.
+inline uint32_t MicroOpCostBytes(const MicroOpCost& cost) {
+  return cost.weight_bytes + cost.input_bytes + cost.output_bytes;
+}
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_OP_COST_H_
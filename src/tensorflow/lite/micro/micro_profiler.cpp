@@ -56,21 +56,22 @@ void MicroProfiler::Log() const {
 #if !defined(TF_LITE_STRIP_ERROR_STRINGS)
   for (int i = 0; i < num_events_; ++i) {
     uint32_t ticks = end_ticks_[i] - start_ticks_[i];
-    MicroPrintf("%s took %u ticks (%d ms).", tags_[i], ticks, TicksToMs(ticks));
+    MicroPrintf("%s took %u ticks (%u us).", tags_[i], ticks, TicksToUs(ticks));
   }
 #endif
 }
 
 void MicroProfiler::LogCsv() const {
 #if !defined(TF_LITE_STRIP_ERROR_STRINGS)
-  MicroPrintf("\"Event\",\"Tag\",\"Ticks\"");
+  MicroPrintf("\"Event\",\"Tag\",\"Ticks\",\"Microseconds\"");
   for (int i = 0; i < num_events_; ++i) {
 #if defined(HEXAGON) || defined(CMSIS_NN)
     int ticks = end_ticks_[i] - start_ticks_[i];
-    MicroPrintf("%d,%s,%d", i, tags_[i], ticks);
+    MicroPrintf("%d,%s,%d,%u", i, tags_[i], ticks, TicksToUs(ticks));
 #else
     uint32_t ticks = end_ticks_[i] - start_ticks_[i];
-    MicroPrintf("%d,%s,%" PRIu32, i, tags_[i], ticks);
+    MicroPrintf("%d,%s,%" PRIu32 ",%" PRIu32, i, tags_[i], ticks,
+                TicksToUs(ticks));
 #endif
   }
 #endif
@@ -53,11 +53,12 @@ class MicroProfiler : public MicroProfilerInterface {
   uint32_t GetTotalTicks() const;
 
   // Prints the profiling information of each of the events in human readable
-  // form.
+  // form, as ticks (CPU cycles where the platform has a cycle counter) and
+  // microseconds.
   void Log() const;
 
   // Prints the profiling information of each of the events in CSV (Comma
-  // Separated Value) form.
+  // Separated Value) form, with the same tick and microsecond columns.
   void LogCsv() const;
 
   // Prints  total ticks for each unique tag in CSV format.
@@ -99,6 +100,7 @@ class ScopedMicroProfiler {
  public:
   explicit ScopedMicroProfiler(const char* tag,
                                MicroProfilerInterface* profiler) {}
+  void SetCost(const MicroOpCost& cost) {}
 };
 
 #else
@@ -129,6 +131,13 @@ class ScopedMicroProfiler {
     }
   }
 
+  // Forwards the static cost of the profiled work to the profiler.
+  void SetCost(const MicroOpCost& cost) {
+    if (profiler_ != nullptr) {
+      profiler_->SetEventCost(event_handle_, cost);
+    }
+  }
+
  private:
   uint32_t event_handle_ = 0;
   MicroProfilerInterface* profiler_ = nullptr;
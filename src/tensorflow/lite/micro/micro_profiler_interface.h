@@ -18,6 +18,8 @@ limitations under the License.
 
 #include <cstdint>
 
+#include "tensorflow/lite/micro/micro_op_cost.h"
+
 namespace tflite {
 
 // Interface class that the TFLM framework relies on for profiling.
@@ -31,6 +33,12 @@ class MicroProfilerInterface {
 
   // Marks the end of an event associated with event_handle.
   virtual void EndEvent(uint32_t event_handle) = 0;
+
+  // Attaches the static cost of the work measured by event_handle. Called by
+  // the interpreter between BeginEvent and EndEvent for operator events when
+  // costs were collected at Prepare. Profilers that only record time can
+  // ignore it.
+  virtual void SetEventCost(uint32_t event_handle, const MicroOpCost& cost) {}
 };
 
 }  // namespace tflite
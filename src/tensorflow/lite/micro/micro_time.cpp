@@ -12,23 +12,185 @@ limitations under the License.
 
 // Raspberry Pi Pico-specific implementation of timing functions.
 
+
 #include "tensorflow/lite/micro/micro_time.h"
 
 #include "tensorflow/lite/micro/debug_log.h"
 
 // These are headers from the RP2's SDK.
-#include "hardware/timer.h"  // NOLINT
+#include "hardware/clocks.h"  // NOLINT
+#include "hardware/timer.h"   // NOLINT
+#include "pico/stdlib.h"      // NOLINT
+
+// Ticks are CPU cycles where the core has a usable cycle counter, so that
+// short kernels can be told apart in MicroProfiler output:
+//   - Cortex-M33 (RP2350): the DWT cycle counter.
+//   - Cortex-M0+ (RP2040): the 24-bit SysTick counter, extended to 32 bits
+//     against the 1 MHz system timer so that wraps are never missed.
+// RISC-V builds and targets that define TFLM_TICK_SOURCE_US use the
+// microsecond timer instead.
+//
+// Cycle counts are offset to the 1 MHz system timer's epoch, which both cores
+// share, so that ticks read on core 0 and core 1 can be compared (to within a
+// microsecond) on a trace timeline.
+#if !defined(TFLM_TICK_SOURCE_US) && !defined(__riscv)
+#if defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_7M__) || \
+    defined(__ARM_ARCH_7EM__)
+#define TFLM_TICK_SOURCE_DWT
+#elif defined(__ARM_ARCH_6M__)
+#define TFLM_TICK_SOURCE_SYSTICK
+#endif
+#endif
 
 namespace tflite {
 namespace {
 // Pico's time_us_32() returns microseconds.
 const uint32_t kClocksPerSecond = 1000000;
+
+#if defined(TFLM_TICK_SOURCE_DWT) || defined(TFLM_TICK_SOURCE_SYSTICK)
+// clk_sys in cycles per microsecond, as integer and 0.32 fraction.
+struct CycleRate {
+  uint32_t per_us;
+  uint32_t per_us_frac;
+};
+
+CycleRate GetCycleRate() {
+  const uint32_t hz = clock_get_hz(clk_sys);
+  CycleRate rate;
+  rate.per_us = hz / 1000000u;
+  rate.per_us_frac = static_cast<uint32_t>(
+      (static_cast<uint64_t>(hz % 1000000u) << 32) / 1000000u);
+  return rate;
+}
+
+// Cycles elapsed in `time_us` microseconds, modulo 2^32.
+uint32_t UsToCycles(const CycleRate& rate, uint64_t time_us) {
+  const uint64_t low = time_us & 0xFFFFFFFFu;
+  const uint32_t high = static_cast<uint32_t>(time_us >> 32);
+  return static_cast<uint32_t>(time_us * rate.per_us +
+                               ((low * rate.per_us_frac) >> 32)) +
+         high * rate.per_us_frac;
+}
+#endif
+
+#if defined(TFLM_TICK_SOURCE_DWT)
+// Debug registers from the ARMv7-M/ARMv8-M architecture reference manuals.
+volatile uint32_t* const kDemcr = reinterpret_cast<uint32_t*>(0xE000EDFC);
+volatile uint32_t* const kDwtCtrl = reinterpret_cast<uint32_t*>(0xE0001000);
+volatile uint32_t* const kDwtCyccnt = reinterpret_cast<uint32_t*>(0xE0001004);
+constexpr uint32_t kDemcrTrcena = 1u << 24;
+constexpr uint32_t kDwtCtrlCyccntena = 1u << 0;
+constexpr uint32_t kDwtCtrlNocyccnt = 1u << 25;
+
+// Each core has its own DWT, so the counter is enabled on first use per core,
+// recording the timer epoch's cycle count at the moment it starts from zero.
+bool cycle_counter_enabled[NUM_CORES] = {};
+uint32_t cycle_counter_origin[NUM_CORES] = {};
+bool cycle_counter_missing = false;
+
+bool EnableCycleCounter() {
+  if (cycle_counter_missing) {
+    return false;
+  }
+  const unsigned int core = get_core_num();
+  if (!cycle_counter_enabled[core]) {
+    *kDemcr |= kDemcrTrcena;
+    if ((*kDwtCtrl & kDwtCtrlNocyccnt) != 0) {
+      cycle_counter_missing = true;
+      return false;
+    }
+    const CycleRate rate = GetCycleRate();
+    cycle_counter_origin[core] = UsToCycles(rate, time_us_64());
+    *kDwtCyccnt = 0;
+    *kDwtCtrl |= kDwtCtrlCyccntena;
+    cycle_counter_enabled[core] = true;
+  }
+  return true;
+}
+
+uint32_t ReadCycleCounter() {
+  return cycle_counter_origin[get_core_num()] + *kDwtCyccnt;
+}
+
+#elif defined(TFLM_TICK_SOURCE_SYSTICK)
+// SysTick registers from the ARMv6-M architecture reference manual.
+volatile uint32_t* const kSystCsr = reinterpret_cast<uint32_t*>(0xE000E010);
+volatile uint32_t* const kSystRvr = reinterpret_cast<uint32_t*>(0xE000E014);
+volatile uint32_t* const kSystCvr = reinterpret_cast<uint32_t*>(0xE000E018);
+constexpr uint32_t kSystCsrEnable = 1u << 0;
+constexpr uint32_t kSystCsrClkSource = 1u << 2;
+constexpr uint32_t kSysTickMask = 0x00FFFFFF;
+
+// SysTick wraps every 2^24 cycles (about 130 ms at 125 MHz), which is
+// shorter than many inferences. Each reading is therefore paired with the
+// 1 MHz timer: the timer gives the cycle count to within a few hundred
+// cycles, and SysTick supplies the low 24 bits exactly.
+struct SysTickOrigin {
+  bool enabled;
+  CycleRate rate;
+  uint32_t systick;
+  // Timer epoch cycle count when `systick` was read.
+  uint32_t cycles;
+};
+SysTickOrigin systick_origin[NUM_CORES] = {};
+
+bool EnableCycleCounter() {
+  SysTickOrigin& origin = systick_origin[get_core_num()];
+  if (!origin.enabled) {
+    *kSystRvr = kSysTickMask;
+    *kSystCvr = 0;
+    *kSystCsr = kSystCsrEnable | kSystCsrClkSource;
+    origin.rate = GetCycleRate();
+    origin.cycles = UsToCycles(origin.rate, time_us_64());
+    origin.systick = *kSystCvr;
+    origin.enabled = true;
+  }
+  return true;
+}
+
+uint32_t ReadCycleCounter() {
+  const SysTickOrigin& origin = systick_origin[get_core_num()];
+  const uint32_t systick = *kSystCvr;
+  const uint64_t time_us = time_us_64();
+  // SysTick counts down.
+  const uint32_t fine =
+      origin.cycles + ((origin.systick - systick) & kSysTickMask);
+  const uint32_t coarse = UsToCycles(origin.rate, time_us);
+  // Pick the count with the right low 24 bits that is nearest to `coarse`.
+  int32_t delta = static_cast<int32_t>((fine - coarse) & kSysTickMask);
+  if (delta >= (1 << 23)) {
+    delta -= 1 << 24;
+  }
+  return coarse + delta;
+}
+#endif
+
 }  // namespace
 
+#if defined(TFLM_TICK_SOURCE_DWT) || defined(TFLM_TICK_SOURCE_SYSTICK)
+
+uint32_t ticks_per_second() {
+  if (!EnableCycleCounter()) {
+    return kClocksPerSecond;
+  }
+  return clock_get_hz(clk_sys);
+}
+
+uint32_t GetCurrentTimeTicks() {
+  if (!EnableCycleCounter()) {
+    return static_cast<uint32_t>(time_us_32());
+  }
+  return ReadCycleCounter();
+}
+
+#else
+
 uint32_t ticks_per_second() { return kClocksPerSecond; }
 
 uint32_t GetCurrentTimeTicks() {
   return static_cast<uint32_t>(time_us_32());
 }
 
-}  // namespace tflite
\ No newline at end of file
+#endif
+
+}  // namespace tflite
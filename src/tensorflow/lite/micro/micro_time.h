@@ -23,7 +23,9 @@ namespace tflite {
 // accurate tick count along with how many ticks there are per second.
 uint32_t ticks_per_second();
 
-// Return time in ticks.  The meaning of a tick varies per platform.
+// Return time in ticks.  The meaning of a tick varies per platform; on the
+// RP2040/RP2350 and x86 hosts a tick is one CPU cycle, so short kernels
+// resolve to the cycle.
 uint32_t GetCurrentTimeTicks();
 
 inline uint32_t TicksToMs(int32_t ticks) {
@@ -34,6 +36,16 @@ inline uint32_t TicksToMs(int32_t ticks) {
                                static_cast<float>(_ticks_per_second));
 }
 
+// Converts a tick count, such as the duration of a profiled event, to
+// microseconds without overflowing for any 32-bit count.
+inline uint32_t TicksToUs(uint32_t ticks) {
+  uint32_t _ticks_per_second = ticks_per_second();
+  _ticks_per_second =
+      _ticks_per_second > 0 ? _ticks_per_second : 1;  // zero divide prevention
+  return static_cast<uint32_t>(static_cast<uint64_t>(ticks) * 1000000u /
+                               _ticks_per_second);
+}
+
 }  // namespace tflite
 
 #endif  // TENSORFLOW_LITE_MICRO_MICRO_TIME_H_
@@ -0,0 +1,321 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/model_store.h"
+
+#include <cstring>
+#include <new>
+
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace tflite {
+namespace {
+
+constexpr uint32_t kHeaderWords = sizeof(ModelSlotHeader) / sizeof(uint32_t);
+// The header fields covered by header_crc32.
+constexpr size_t kHeaderCrcBytes = sizeof(ModelSlotHeader) - sizeof(uint32_t);
+
+uint32_t ReadLittleEndianUint32(const uint8_t* bytes) {
+  return static_cast<uint32_t>(bytes[0]) |
+         (static_cast<uint32_t>(bytes[1]) << 8) |
+         (static_cast<uint32_t>(bytes[2]) << 16) |
+         (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+void WriteLittleEndianUint32(uint32_t value, uint8_t* bytes) {
+  bytes[0] = static_cast<uint8_t>(value);
+  bytes[1] = static_cast<uint8_t>(value >> 8);
+  bytes[2] = static_cast<uint8_t>(value >> 16);
+  bytes[3] = static_cast<uint8_t>(value >> 24);
+}
+
+// Bitwise CRC-32: installs and verification are rare, and a table would cost
+// 1 KiB of flash.
+uint32_t UpdateCrc32(uint32_t crc, const uint8_t* data, size_t size) {
+  crc = ~crc;
+  for (size_t i = 0; i < size; ++i) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+  }
+  return ~crc;
+}
+
+// The header as stored, so that its CRC does not depend on host byte order.
+void SerializeHeader(const ModelSlotHeader& header, uint8_t* bytes) {
+  const uint32_t fields[kHeaderWords] = {
+      header.magic,      header.version,     header.sequence,
+      header.model_size, header.model_crc32, header.header_crc32};
+  for (uint32_t i = 0; i < kHeaderWords; ++i) {
+    WriteLittleEndianUint32(fields[i], bytes + 4 * i);
+  }
+}
+
+// Whether `sequence` was written after `other`, allowing for wraparound.
+bool IsNewer(uint32_t sequence, uint32_t other) {
+  return static_cast<int32_t>(sequence - other) > 0;
+}
+
+}  // namespace
+
+ModelStore::ModelStore(FlashPartition& partition)
+    : partition_(partition),
+      slot_size_(partition.size() / kSlotCount / FlashPartition::kSectorSize *
+                 FlashPartition::kSectorSize) {}
+
+const uint8_t* ModelStore::slot_data(int slot) const {
+  return partition_.data() + slot_offset(slot);
+}
+
+uint32_t ModelStore::slot_offset(int slot) const {
+  return static_cast<uint32_t>(slot) * slot_size_;
+}
+
+bool ModelStore::ReadHeader(int slot, ModelSlotHeader* header) const {
+  const uint8_t* bytes = slot_data(slot);
+  header->magic = ReadLittleEndianUint32(bytes);
+  header->version = ReadLittleEndianUint32(bytes + 4);
+  header->sequence = ReadLittleEndianUint32(bytes + 8);
+  header->model_size = ReadLittleEndianUint32(bytes + 12);
+  header->model_crc32 = ReadLittleEndianUint32(bytes + 16);
+  header->header_crc32 = ReadLittleEndianUint32(bytes + 20);
+  return header->magic == kModelSlotMagic &&
+         header->version == kModelSlotVersion &&
+         header->header_crc32 == UpdateCrc32(0, bytes, kHeaderCrcBytes);
+}
+
+bool ModelStore::IsValidSlot(int slot, ModelSlotHeader* header) const {
+  if (!ReadHeader(slot, header)) {
+    return false;
+  }
+  // The root table offset and the file identifier.
+  if (header->model_size < 8 || header->model_size > model_capacity()) {
+    MicroPrintf("ModelStore: slot %d has an invalid model size %u", slot,
+                static_cast<unsigned>(header->model_size));
+    return false;
+  }
+  const uint8_t* model_data = slot_data(slot) + kModelOffset;
+  if (!ModelBufferHasIdentifier(model_data) ||
+      ReadLittleEndianUint32(model_data) >= header->model_size) {
+    MicroPrintf("ModelStore: slot %d does not hold a .tflite model", slot);
+    return false;
+  }
+  if (GetModel(model_data)->version() != TFLITE_SCHEMA_VERSION) {
+    MicroPrintf("ModelStore: slot %d model schema version %u, expected %d",
+                slot, static_cast<unsigned>(GetModel(model_data)->version()),
+                TFLITE_SCHEMA_VERSION);
+    return false;
+  }
+  return true;
+}
+
+bool ModelStore::Mount() {
+  active_slot_ = -1;
+  active_sequence_ = 0;
+  if (partition_.data() == nullptr || slot_size_ <= kModelOffset) {
+    return false;
+  }
+  for (int slot = 0; slot < kSlotCount; ++slot) {
+    ModelSlotHeader header;
+    if (!IsValidSlot(slot, &header)) {
+      continue;
+    }
+    if (active_slot_ < 0 || IsNewer(header.sequence, active_sequence_)) {
+      active_slot_ = slot;
+      active_sequence_ = header.sequence;
+    }
+  }
+  return active_slot_ >= 0;
+}
+
+const Model* ModelStore::model() const {
+  return active_slot_ < 0 ? nullptr : GetModel(model_data());
+}
+
+const uint8_t* ModelStore::model_data() const {
+  return active_slot_ < 0 ? nullptr : slot_data(active_slot_) + kModelOffset;
+}
+
+uint32_t ModelStore::model_size() const {
+  return active_slot_ < 0
+             ? 0
+             : ReadLittleEndianUint32(slot_data(active_slot_) + 12);
+}
+
+bool ModelStore::BeginInstall(uint32_t model_size) {
+  install_slot_ = -1;
+  if (partition_.data() == nullptr || model_size > model_capacity()) {
+    MicroPrintf("ModelStore: a %u byte model does not fit in a %u byte slot",
+                static_cast<unsigned>(model_size),
+                static_cast<unsigned>(model_capacity()));
+    return false;
+  }
+  // The slot that is not active, or the first one of an empty store.
+  const int slot = active_slot_ == 0 ? 1 : 0;
+  if (!partition_.Erase(slot_offset(slot), slot_size_)) {
+    MicroPrintf("ModelStore: erasing slot %d failed", slot);
+    return false;
+  }
+  install_slot_ = slot;
+  install_size_ = model_size;
+  install_written_ = 0;
+  install_crc32_ = 0;
+  page_fill_ = 0;
+  return true;
+}
+
+bool ModelStore::ProgramPage() {
+  std::memset(page_ + page_fill_, 0xFF, FlashPartition::kPageSize - page_fill_);
+  const uint32_t offset = slot_offset(install_slot_) + kModelOffset +
+                          install_written_ - page_fill_;
+  page_fill_ = 0;
+  return partition_.Program(offset, page_, FlashPartition::kPageSize);
+}
+
+bool ModelStore::Write(const uint8_t* data, uint32_t size) {
+  if (install_slot_ < 0 || size > install_size_ - install_written_) {
+    return false;
+  }
+  install_crc32_ = UpdateCrc32(install_crc32_, data, size);
+  while (size > 0) {
+    uint32_t chunk = FlashPartition::kPageSize - page_fill_;
+    if (chunk > size) {
+      chunk = size;
+    }
+    std::memcpy(page_ + page_fill_, data, chunk);
+    page_fill_ += chunk;
+    install_written_ += chunk;
+    data += chunk;
+    size -= chunk;
+    if (page_fill_ == FlashPartition::kPageSize && !ProgramPage()) {
+      install_slot_ = -1;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ModelStore::CommitInstall() {
+  const int slot = install_slot_;
+  install_slot_ = -1;
+  if (slot < 0 || install_written_ != install_size_) {
+    MicroPrintf("ModelStore: install incomplete");
+    return false;
+  }
+  if (page_fill_ > 0) {
+    install_slot_ = slot;
+    const bool programmed = ProgramPage();
+    install_slot_ = -1;
+    if (!programmed) {
+      return false;
+    }
+  }
+  const uint8_t* model_data = slot_data(slot) + kModelOffset;
+  if (UpdateCrc32(0, model_data, install_size_) != install_crc32_) {
+    MicroPrintf("ModelStore: slot %d does not read back as written", slot);
+    return false;
+  }
+  if (!ModelBufferHasIdentifier(model_data) ||
+      GetModel(model_data)->version() != TFLITE_SCHEMA_VERSION) {
+    MicroPrintf("ModelStore: the installed data is not a .tflite model");
+    return false;
+  }
+
+  ModelSlotHeader header;
+  header.magic = kModelSlotMagic;
+  header.version = kModelSlotVersion;
+  header.sequence = active_slot_ < 0 ? 1 : active_sequence_ + 1;
+  header.model_size = install_size_;
+  header.model_crc32 = install_crc32_;
+  header.header_crc32 = 0;
+  std::memset(page_, 0xFF, sizeof(page_));
+  SerializeHeader(header, page_);
+  header.header_crc32 = UpdateCrc32(0, page_, kHeaderCrcBytes);
+  SerializeHeader(header, page_);
+
+  // Only the header makes the model active.
+  if (!partition_.Program(slot_offset(slot), page_,
+                          FlashPartition::kPageSize)) {
+    return false;
+  }
+  return Mount() && active_slot_ == slot;
+}
+
+bool ModelStore::Install(const uint8_t* data, uint32_t size) {
+  return BeginInstall(size) && Write(data, size) && CommitInstall();
+}
+
+bool ModelStore::Rollback() {
+  if (active_slot_ < 0) {
+    return false;
+  }
+  const int other = 1 - active_slot_;
+  ModelSlotHeader header;
+  if (!IsValidSlot(other, &header)) {
+    return false;
+  }
+  // Clearing bits needs no erase: a zeroed header page is never valid.
+  std::memset(page_, 0, sizeof(page_));
+  if (!partition_.Program(slot_offset(active_slot_), page_,
+                          FlashPartition::kPageSize)) {
+    return false;
+  }
+  return Mount();
+}
+
+bool ModelStore::VerifyActiveModel() const {
+  if (active_slot_ < 0) {
+    return false;
+  }
+  ModelSlotHeader header;
+  return ReadHeader(active_slot_, &header) &&
+         UpdateCrc32(0, model_data(), header.model_size) == header.model_crc32;
+}
+
+HotSwapInterpreter::HotSwapInterpreter(const MicroOpResolver& op_resolver,
+                                       uint8_t* tensor_arena,
+                                       size_t tensor_arena_size,
+                                       MicroProfilerInterface* profiler)
+    : op_resolver_(op_resolver),
+      tensor_arena_(tensor_arena),
+      tensor_arena_size_(tensor_arena_size),
+      profiler_(profiler) {}
+
+HotSwapInterpreter::~HotSwapInterpreter() { Unload(); }
+
+TfLiteStatus HotSwapInterpreter::Load(const Model* model) {
+  Unload();
+  if (model == nullptr) {
+    return kTfLiteError;
+  }
+  interpreter_ = new (storage_)
+      MicroInterpreter(model, op_resolver_, tensor_arena_, tensor_arena_size_,
+                       /*resource_variables=*/nullptr, profiler_);
+  if (interpreter_->AllocateTensors() != kTfLiteOk) {
+    Unload();
+    return kTfLiteError;
+  }
+  return kTfLiteOk;
+}
+
+void HotSwapInterpreter::Unload() {
+  if (interpreter_ != nullptr) {
+    interpreter_->~MicroInterpreter();
+    interpreter_ = nullptr;
+  }
+}
+
+}  // namespace tflite
@@ -0,0 +1,160 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MODEL_STORE_H_
+#define TENSORFLOW_LITE_MICRO_MODEL_STORE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/flash_partition.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+
+//
+// Model store
+//
+// Keeps .tflite models in two slots (A and B) of a flash partition, so that a
+// new model can be installed without reflashing the firmware, and the model
+// the interpreter runs is read from flash in place. A model is installed into
+// the inactive slot and becomes active only once it is completely written and
+// checked, so an interrupted install leaves the previous model active.
+//
+// Each slot starts with a ModelSlotHeader in its own flash page, followed by
+// the model. All header fields are little-endian uint32_t.
+//
+
+static constexpr uint32_t kModelSlotMagic = 0x534D4654;  // "TFMS"
+static constexpr uint32_t kModelSlotVersion = 1;
+
+struct ModelSlotHeader {
+  uint32_t magic;
+  uint32_t version;
+  // One more than the sequence of the slot that was active when the model
+  // was installed. The valid slot with the newest sequence is active.
+  uint32_t sequence;
+  uint32_t model_size;
+  // CRC-32 (IEEE 802.3) of the model bytes.
+  uint32_t model_crc32;
+  // CRC-32 of the fields above.
+  uint32_t header_crc32;
+};
+
+class ModelStore {
+ public:
+  static constexpr int kSlotCount = 2;
+  // Models start one flash page into their slot, which keeps them as aligned
+  // as the flatbuffer needs.
+  static constexpr uint32_t kModelOffset = FlashPartition::kPageSize;
+
+  // The partition is split into two slots of whole flash sectors.
+  explicit ModelStore(FlashPartition& partition);
+
+  // Reads the slot headers and makes the newest valid slot active. Only the
+  // headers and the flatbuffer identifier and schema version of the models
+  // are checked, not every model byte, so this is cheap enough for every
+  // boot. Returns false if no slot holds a valid model.
+  bool Mount();
+
+  // Index of the active slot, or -1 if there is none.
+  int active_slot() const { return active_slot_; }
+
+  // The active model, read in place from flash, or nullptr.
+  const Model* model() const;
+  const uint8_t* model_data() const;
+  uint32_t model_size() const;
+
+  // Bytes available to a model in each slot.
+  uint32_t model_capacity() const { return slot_size_ - kModelOffset; }
+
+  // Installs a model into the inactive slot in pieces, so that a model
+  // received over a serial link never needs to be in RAM whole. BeginInstall
+  // erases the slot, Write appends to the model, and CommitInstall checks the
+  // written bytes against their CRC-32 and the model header, then writes the
+  // slot header, which makes the new model active.
+  bool BeginInstall(uint32_t model_size);
+  bool Write(const uint8_t* data, uint32_t size);
+  bool CommitInstall();
+
+  // Installs a whole model. `data` may point into flash.
+  bool Install(const uint8_t* data, uint32_t size);
+
+  // Invalidates the active slot, making the other one active, if it holds a
+  // valid model. Returns false, and changes nothing, if it does not.
+  bool Rollback();
+
+  // Checks every byte of the active model against the CRC-32 in its header.
+  bool VerifyActiveModel() const;
+
+ private:
+  const uint8_t* slot_data(int slot) const;
+  uint32_t slot_offset(int slot) const;
+  bool ReadHeader(int slot, ModelSlotHeader* header) const;
+  bool IsValidSlot(int slot, ModelSlotHeader* header) const;
+  bool ProgramPage();
+
+  FlashPartition& partition_;
+  uint32_t slot_size_;
+  int active_slot_ = -1;
+  uint32_t active_sequence_ = 0;
+
+  // State of the install in progress.
+  int install_slot_ = -1;
+  uint32_t install_size_ = 0;
+  uint32_t install_written_ = 0;
+  uint32_t install_crc32_ = 0;
+  uint32_t page_fill_ = 0;
+  uint8_t page_[FlashPartition::kPageSize];
+};
+
+// Owns the MicroInterpreter of a model, and rebuilds it in place when the
+// model changes, for example after ModelStore installed a new one. The arena
+// is reused and the model is read where it is, so a swap costs the teardown
+// of the old interpreter and AllocateTensors() of the new one.
+class HotSwapInterpreter {
+ public:
+  HotSwapInterpreter(const MicroOpResolver& op_resolver, uint8_t* tensor_arena,
+                     size_t tensor_arena_size,
+                     MicroProfilerInterface* profiler = nullptr);
+  ~HotSwapInterpreter();
+
+  HotSwapInterpreter(const HotSwapInterpreter&) = delete;
+  HotSwapInterpreter& operator=(const HotSwapInterpreter&) = delete;
+
+  // Tears down the current interpreter, then builds one for `model` and
+  // allocates its tensors. On failure no interpreter is left.
+  TfLiteStatus Load(const Model* model);
+  void Unload();
+
+  // The interpreter of the loaded model, or nullptr.
+  MicroInterpreter* interpreter() { return interpreter_; }
+
+ private:
+  const MicroOpResolver& op_resolver_;
+  uint8_t* tensor_arena_;
+  size_t tensor_arena_size_;
+  MicroProfilerInterface* profiler_;
+  MicroInterpreter* interpreter_ = nullptr;
+  alignas(MicroInterpreter) uint8_t storage_[sizeof(MicroInterpreter)];
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MODEL_STORE_H_
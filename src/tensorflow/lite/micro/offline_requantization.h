@@ -0,0 +1,70 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_OFFLINE_REQUANTIZATION_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_OFFLINE_REQUANTIZATION_H_
+
+#include <cstdint>
+
+namespace tflite {
+
+//
+// Offline requantization tables
+//
+// Quantized convolutions rescale their accumulators with one fixed-point
+// multiplier and shift per output channel. Kernels normally derive them from
+// the float scales of the input, filter and output in Prepare(), which needs
+// double precision math and an arena array per table. A model can instead
+// carry the tables, computed on the host by
+// tools/precompute_requantization.py, and kernels then read them from the
+// model in place.
+//
+
+static constexpr const char* kOfflineRequantizationMetadataString =
+    "OFFLINE_REQUANTIZATION_METADATA";
+
+// Version of the serialized metadata understood by this runtime.
+static constexpr uint32_t kOfflineRequantizationMetadataVersion = 1;
+
+// Serialized layout of the metadata buffer. All fields are little-endian
+// uint32_t:
+//
+//   version
+//   entry_count
+//   entry_count x { subgraph, operator, channels, table_buffer }
+//
+// `table_buffer` is the index of a model buffer holding `channels` int32_t
+// multipliers followed by `channels` int32_t shifts, as
+// PopulateConvolutionQuantizationParams() would compute them.
+struct OfflineRequantizationMetadataHeader {
+  uint32_t version;
+  uint32_t entry_count;
+};
+
+struct OfflineRequantizationMetadataEntry {
+  uint32_t subgraph;
+  uint32_t op;
+  uint32_t channels;
+  uint32_t table_buffer;
+};
+
+struct OfflineRequantizationData {
+  const int32_t* multipliers;  // Pointer into FlatBuffer buffers.
+  const int32_t* shifts;       // Pointer into FlatBuffer buffers.
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_OFFLINE_REQUANTIZATION_H_
@@ -488,6 +488,117 @@ const Model* BuildModelWithUnusedOperatorOutputs() {
   return model;
 }
 
+const Model* BuildModelWithFoldableOperators() {
+  using flatbuffers::Offset;
+  flatbuffers::FlatBufferBuilder* builder = BuilderInstance();
+
+  constexpr size_t buffer_data_size = 4;
+  const uint8_t buffer_data[buffer_data_size] = {2, 4, 6, 8};
+  constexpr size_t buffers_size = 2;
+  const Offset<Buffer> buffers[buffers_size] = {
+      CreateBuffer(*builder),
+      CreateBuffer(*builder,
+                   builder->CreateVector(buffer_data, buffer_data_size))};
+  constexpr size_t quant_params_size = 1;
+  const float scale_array[quant_params_size] = {0.5f};
+  const int64_t zero_point_array[quant_params_size] = {0};
+  const Offset<QuantizationParameters> quant_params =
+      CreateQuantizationParameters(
+          *builder, /*min=*/0, /*max=*/0,
+          /*scale=*/
+          builder->CreateVector<float>(scale_array, quant_params_size),
+          /*zero_point=*/
+          builder->CreateVector<int64_t>(zero_point_array, quant_params_size));
+  constexpr size_t tensor_shape_size = 2;
+  const int32_t tensor_shape[tensor_shape_size] = {1, 4};
+  constexpr size_t shape_shape_size = 1;
+  const int32_t shape_shape[shape_shape_size] = {2};
+  constexpr size_t tensors_size = 6;
+  const Offset<Tensor> tensors[tensors_size] = {
+      CreateTensor(*builder,
+                   builder->CreateVector(tensor_shape, tensor_shape_size),
+                   TensorType_FLOAT32, 0,
+                   builder->CreateString("test_input_tensor"), 0, false),
+      CreateTensor(*builder,
+                   builder->CreateVector(tensor_shape, tensor_shape_size),
+                   TensorType_INT8, 1,
+                   builder->CreateString("test_weight_tensor"), quant_params,
+                   false),
+      CreateTensor(*builder,
+                   builder->CreateVector(tensor_shape, tensor_shape_size),
+                   TensorType_FLOAT32, 0,
+                   builder->CreateString("test_dequantized_tensor"), 0,
+                   false),
+      CreateTensor(*builder,
+                   builder->CreateVector(tensor_shape, tensor_shape_size),
+                   TensorType_FLOAT32, 0,
+                   builder->CreateString("test_sum_tensor"), 0, false),
+      CreateTensor(*builder,
+                   builder->CreateVector(shape_shape, shape_shape_size),
+                   TensorType_INT32, 0,
+                   builder->CreateString("test_shape_tensor"), 0, false),
+      CreateTensor(*builder,
+                   builder->CreateVector(tensor_shape, tensor_shape_size),
+                   TensorType_FLOAT32, 0,
+                   builder->CreateString("test_output_tensor"), 0, false),
+  };
+  constexpr size_t inputs_size = 1;
+  const int32_t inputs[inputs_size] = {0};
+  constexpr size_t outputs_size = 1;
+  const int32_t outputs[outputs_size] = {5};
+  const int32_t dequantize_inputs[] = {1};
+  const int32_t dequantize_outputs[] = {2};
+  const int32_t add_inputs[] = {0, 2};
+  const int32_t add_outputs[] = {3};
+  const int32_t shape_inputs[] = {0};
+  const int32_t shape_outputs[] = {4};
+  const int32_t reshape_inputs[] = {3, 4};
+  const int32_t reshape_outputs[] = {5};
+  constexpr size_t operators_size = 4;
+  const Offset<Operator> operators[operators_size] = {
+      CreateOperator(*builder, 0, builder->CreateVector(dequantize_inputs, 1),
+                     builder->CreateVector(dequantize_outputs, 1),
+                     BuiltinOptions_NONE),
+      CreateOperator(*builder, 1, builder->CreateVector(add_inputs, 2),
+                     builder->CreateVector(add_outputs, 1),
+                     BuiltinOptions_AddOptions,
+                     CreateAddOptions(*builder).Union()),
+      CreateOperator(*builder, 2, builder->CreateVector(shape_inputs, 1),
+                     builder->CreateVector(shape_outputs, 1),
+                     BuiltinOptions_ShapeOptions,
+                     CreateShapeOptions(*builder, TensorType_INT32).Union()),
+      CreateOperator(*builder, 3, builder->CreateVector(reshape_inputs, 2),
+                     builder->CreateVector(reshape_outputs, 1),
+                     BuiltinOptions_NONE),
+  };
+  constexpr size_t subgraphs_size = 1;
+  const Offset<SubGraph> subgraphs[subgraphs_size] = {
+      CreateSubGraph(*builder, builder->CreateVector(tensors, tensors_size),
+                     builder->CreateVector(inputs, inputs_size),
+                     builder->CreateVector(outputs, outputs_size),
+                     builder->CreateVector(operators, operators_size),
+                     builder->CreateString("test_subgraph"))};
+  constexpr size_t operator_codes_size = 4;
+  const Offset<OperatorCode> operator_codes[operator_codes_size] = {
+      CreateOperatorCode(*builder, /*deprecated_builtin_code=*/0, 0,
+                         /*version=*/0, BuiltinOperator_DEQUANTIZE),
+      CreateOperatorCode(*builder, /*deprecated_builtin_code=*/0, 0,
+                         /*version=*/0, BuiltinOperator_ADD),
+      CreateOperatorCode(*builder, /*deprecated_builtin_code=*/0, 0,
+                         /*version=*/0, BuiltinOperator_SHAPE),
+      CreateOperatorCode(*builder, /*deprecated_builtin_code=*/0, 0,
+                         /*version=*/0, BuiltinOperator_RESHAPE)};
+  const Offset<Model> model_offset = CreateModel(
+      *builder, 0, builder->CreateVector(operator_codes, operator_codes_size),
+      builder->CreateVector(subgraphs, subgraphs_size),
+      builder->CreateString("test_model"),
+      builder->CreateVector(buffers, buffers_size));
+  FinishModelBuffer(*builder, model_offset);
+  void* model_pointer = builder->GetBufferPointer();
+  const Model* model = flatbuffers::GetRoot<Model>(model_pointer);
+  return model;
+}
+
 const Model* BuildModelWith256x256Tensor() {
   using flatbuffers::Offset;
   flatbuffers::FlatBufferBuilder* fb_builder = BuilderInstance();
@@ -1805,6 +1916,14 @@ const Model* GetModelWithUnusedOperatorOutputs() {
   return model;
 }
 
+const Model* GetModelWithFoldableOperators() {
+  static Model* model = nullptr;
+  if (!model) {
+    model = const_cast<Model*>(BuildModelWithFoldableOperators());
+  }
+  return model;
+}
+
 const Model* GetModelWith256x256Tensor() {
   static const Model* model = BuildModelWith256x256Tensor();
   return model;
@@ -171,6 +171,11 @@ const Model* GetModelWithUnusedInputs();
 // (one unused).
 const Model* GetModelWithUnusedOperatorOutputs();
 
+// Returns a flatbuffer computing RESHAPE(ADD(input, DEQUANTIZE(weights)),
+// SHAPE(input)) on float [1, 4] tensors, with the int8 weights {2, 4, 6, 8}
+// at scale 0.5. DEQUANTIZE and SHAPE can be folded at AllocateTensors().
+const Model* GetModelWithFoldableOperators();
+
 // Returns a flatbuffer model with `simple_stateful_op`
 const Model* GetSimpleStatefulModel();
 
@@ -0,0 +1,203 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/trace_micro_profiler.h"
+
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_time.h"
+
+// This is a header from the RP2's SDK.
+#include "pico/stdlib.h"  // NOLINT
+
+namespace tflite {
+namespace {
+
+constexpr int kMaxLineLength = 192;
+
+// Converts ticks to nanoseconds, printed as microseconds with three decimals
+// since Chrome trace timestamps are in microseconds.
+uint64_t TicksToNs(uint32_t ticks, uint32_t ticks_per_sec) {
+  return static_cast<uint64_t>(ticks) * 1000000000u / ticks_per_sec;
+}
+
+// Builds a trace line without MicroSnprintf, which is stubbed out when error
+// strings are stripped, so that WriteChromeTrace still works in such builds.
+// Text beyond kMaxLineLength - 1 characters is dropped.
+class LineBuilder {
+ public:
+  LineBuilder() { line_[0] = '\0'; }
+
+  LineBuilder& Append(const char* text) {
+    while (*text != '\0' && length_ < kMaxLineLength - 1) {
+      line_[length_++] = *text++;
+    }
+    line_[length_] = '\0';
+    return *this;
+  }
+
+  LineBuilder& Append(uint64_t value) {
+    char text[21];
+    int start = sizeof(text) - 1;
+    text[start] = '\0';
+    do {
+      text[--start] = static_cast<char>('0' + value % 10);
+      value /= 10;
+    } while (value != 0);
+    return Append(text + start);
+  }
+
+  // Appends nanoseconds as microseconds with three decimals.
+  LineBuilder& AppendMicroseconds(uint64_t ns) {
+    const uint32_t fraction = static_cast<uint32_t>(ns % 1000);
+    Append(ns / 1000).Append(".");
+    if (fraction < 100) {
+      Append("0");
+    }
+    if (fraction < 10) {
+      Append("0");
+    }
+    return Append(static_cast<uint64_t>(fraction));
+  }
+
+  const char* line() const { return line_; }
+
+ private:
+  char line_[kMaxLineLength];
+  int length_ = 0;
+};
+
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+void PrintLine(const char* line, void* context) { MicroPrintf("%s", line); }
+#endif
+
+}  // namespace
+
+TraceMicroProfiler::TraceMicroProfiler(Event* events, int max_events_per_core)
+    : events_(events), max_events_per_core_(max_events_per_core) {}
+
+int TraceMicroProfiler::CurrentCore() {
+  const unsigned int core = get_core_num();
+  return core < kMaxCores ? static_cast<int>(core) : kMaxCores - 1;
+}
+
+uint32_t TraceMicroProfiler::BeginEvent(const char* tag) {
+  const int core = CurrentCore();
+  if (num_events_[core] >= max_events_per_core_) {
+    ++dropped_events_[core];
+    return kDroppedEvent;
+  }
+
+  const int index = core * max_events_per_core_ + num_events_[core]++;
+  Event& event = events_[index];
+  event.tag = tag;
+  event.depth = depth_[core]++;
+  event.start_ticks = GetCurrentTimeTicks();
+  event.end_ticks = event.start_ticks;
+  return static_cast<uint32_t>(index);
+}
+
+void TraceMicroProfiler::EndEvent(uint32_t event_handle) {
+  const uint32_t end_ticks = GetCurrentTimeTicks();
+  if (event_handle == kDroppedEvent) {
+    return;
+  }
+  TFLITE_DCHECK(event_handle <
+                static_cast<uint32_t>(kMaxCores * max_events_per_core_));
+
+  const int core = event_handle / max_events_per_core_;
+  events_[event_handle].end_ticks = end_ticks;
+  if (depth_[core] > 0) {
+    --depth_[core];
+  }
+}
+
+void TraceMicroProfiler::ClearEvents() {
+  for (int core = 0; core < kMaxCores; ++core) {
+    num_events_[core] = 0;
+    depth_[core] = 0;
+    dropped_events_[core] = 0;
+  }
+}
+
+void TraceMicroProfiler::LogChromeTrace() const {
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+  WriteChromeTrace(PrintLine, nullptr);
+#endif
+}
+
+void TraceMicroProfiler::WriteChromeTrace(LineWriter writer,
+                                          void* context) const {
+  // Timestamps are relative to the earliest event on any core. Ticks wrap,
+  // so events are compared by their signed distance from an arbitrary one.
+  bool have_base = false;
+  uint32_t base_ticks = 0;
+  for (int core = 0; core < kMaxCores; ++core) {
+    for (int i = 0; i < num_events_[core]; ++i) {
+      const uint32_t start = event(core, i).start_ticks;
+      if (!have_base || static_cast<int32_t>(start - base_ticks) < 0) {
+        base_ticks = start;
+        have_base = true;
+      }
+    }
+  }
+  uint32_t ticks_per_sec = ticks_per_second();
+  ticks_per_sec = ticks_per_sec > 0 ? ticks_per_sec : 1;
+
+  writer("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", context);
+  for (int core = 0; core < kMaxCores; ++core) {
+    LineBuilder line;
+    line.Append(core == 0 ? "" : ",")
+        .Append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":")
+        .Append(static_cast<uint64_t>(core))
+        .Append(",\"args\":{\"name\":\"core ")
+        .Append(static_cast<uint64_t>(core))
+        .Append("\"}}");
+    writer(line.line(), context);
+  }
+  for (int core = 0; core < kMaxCores; ++core) {
+    for (int i = 0; i < num_events_[core]; ++i) {
+      const Event& e = event(core, i);
+      const uint64_t ts =
+          TicksToNs(e.start_ticks - base_ticks, ticks_per_sec);
+      const uint64_t dur =
+          TicksToNs(e.end_ticks - e.start_ticks, ticks_per_sec);
+      LineBuilder line;
+      line.Append(",{\"name\":\"")
+          .Append(e.tag)
+          .Append("\",\"ph\":\"X\",\"pid\":0,\"tid\":")
+          .Append(static_cast<uint64_t>(core))
+          .Append(",\"ts\":")
+          .AppendMicroseconds(ts)
+          .Append(",\"dur\":")
+          .AppendMicroseconds(dur)
+          .Append(",\"args\":{\"depth\":")
+          .Append(static_cast<uint64_t>(e.depth))
+          .Append("}}");
+      writer(line.line(), context);
+    }
+  }
+  writer("]}", context);
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+  if (dropped_events() > 0) {
+    MicroPrintf("%u trace events dropped, more than %d per core.",
+                static_cast<unsigned>(dropped_events()), max_events_per_core_);
+  }
+#endif
+}
+
+}  // namespace tflite
@@ -0,0 +1,107 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_TRACE_MICRO_PROFILER_H_
+#define TENSORFLOW_LITE_MICRO_TRACE_MICRO_PROFILER_H_
+
+#include <cstdint>
+
+#include "tensorflow/lite/micro/compatibility.h"
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+
+namespace tflite {
+
+// A profiler that records a timeline of events per core, with the nesting
+// depth of each, and writes it as Chrome trace event JSON. The output loads in
+// chrome://tracing and https://ui.perfetto.dev, with one track per core.
+//
+// Each core appends to its own event buffer, so events can be recorded from
+// core 1 (for example kernel regions of the multicore matmul, see
+// kernel_region_profiler.h) while core 0 runs the interpreter. Call
+// ClearEvents() and the Log/Write functions only while core 1 is idle.
+//
+// Use StaticTraceMicroProfiler<N> to provide storage for N events per core.
+class TraceMicroProfiler : public MicroProfilerInterface {
+ public:
+  static constexpr int kMaxCores = 2;
+
+  // Returned by BeginEvent when the core's event buffer is full.
+  static constexpr uint32_t kDroppedEvent = 0xFFFFFFFF;
+
+  struct Event {
+    const char* tag;
+    uint32_t start_ticks;
+    uint32_t end_ticks;
+    uint32_t depth;
+  };
+
+  // Receives the JSON output one line at a time, without a newline.
+  typedef void (*LineWriter)(const char* line, void* context);
+
+  // `events` must hold kMaxCores * max_events_per_core entries and outlive
+  // the profiler.
+  TraceMicroProfiler(Event* events, int max_events_per_core);
+  virtual ~TraceMicroProfiler() = default;
+
+  virtual uint32_t BeginEvent(const char* tag) override;
+  virtual void EndEvent(uint32_t event_handle) override;
+
+  // Forgets the events of every core.
+  void ClearEvents();
+
+  int num_events(int core) const { return num_events_[core]; }
+  const Event& event(int core, int index) const {
+    return events_[core * max_events_per_core_ + index];
+  }
+  uint32_t dropped_events() const {
+    return dropped_events_[0] + dropped_events_[1];
+  }
+
+  // Prints the trace with MicroPrintf, for capture over the serial port. The
+  // trace is everything from the {"displayTimeUnit" line to the "]}" line.
+  void LogChromeTrace() const;
+
+  // Passes the trace to `writer` line by line, for example to save it to a
+  // file on the host. Unlike LogChromeTrace, this also works when error
+  // strings are stripped.
+  void WriteChromeTrace(LineWriter writer, void* context) const;
+
+ private:
+  static int CurrentCore();
+
+  Event* events_;
+  int max_events_per_core_;
+  int num_events_[kMaxCores] = {};
+  uint32_t depth_[kMaxCores] = {};
+  uint32_t dropped_events_[kMaxCores] = {};
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+template <int tMaxEventsPerCore>
+class StaticTraceMicroProfiler : public TraceMicroProfiler {
+ public:
+  StaticTraceMicroProfiler()
+      : TraceMicroProfiler(storage_, tMaxEventsPerCore) {}
+
+ private:
+  Event storage_[kMaxCores * tMaxEventsPerCore];
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_TRACE_MICRO_PROFILER_H_
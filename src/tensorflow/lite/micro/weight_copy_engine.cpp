@@ -0,0 +1,127 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/weight_copy_engine.h"
+
+#include <cstring>
+
+// These are headers from the RP2's SDK.
+#include "hardware/dma.h"  // NOLINT
+#include "pico/stdlib.h"   // NOLINT
+
+// A batch uses two DMA channels. The control channel writes one control
+// block at a time into the alias 1 registers of the data channel (CTRL,
+// READ_ADDR, WRITE_ADDR, TRANS_COUNT_TRIG), which starts the data channel on
+// one region. When the region is done the data channel chains back to the
+// control channel, which loads the next block. The last block is all zeros:
+// a zero written to a trigger register does not start the channel, so the
+// chain stops there.
+
+namespace tflite {
+namespace {
+
+// The same flash bytes, read past the XIP cache without allocating in it.
+uintptr_t NonAllocatingAddress(const void* source) {
+  const uintptr_t address = reinterpret_cast<uintptr_t>(source);
+  if (address >= XIP_BASE && address < XIP_BASE + PICO_FLASH_SIZE_BYTES) {
+    return address - XIP_BASE + XIP_NOCACHE_NOALLOC_BASE;
+  }
+  return address;
+}
+
+}  // namespace
+
+WeightCopyEngine::~WeightCopyEngine() {
+  Wait();
+  if (control_channel_ >= 0) {
+    dma_channel_unclaim(control_channel_);
+    dma_channel_unclaim(data_channel_);
+  }
+}
+
+void WeightCopyEngine::Start(const Copy* copies, int count) {
+  Wait();
+  if (count > kMaxCopies) {
+    count = kMaxCopies;
+  }
+  if (control_channel_ < 0) {
+    data_channel_ = dma_claim_unused_channel(/*required=*/false);
+    control_channel_ = dma_claim_unused_channel(/*required=*/false);
+    if (data_channel_ < 0 || control_channel_ < 0) {
+      if (data_channel_ >= 0) {
+        dma_channel_unclaim(data_channel_);
+      }
+      if (control_channel_ >= 0) {
+        dma_channel_unclaim(control_channel_);
+      }
+      data_channel_ = -1;
+      control_channel_ = -1;
+    }
+  }
+  if (control_channel_ < 0) {
+    for (int i = 0; i < count; ++i) {
+      std::memcpy(copies[i].destination, copies[i].source, copies[i].size);
+    }
+    return;
+  }
+
+  uint32_t* block = control_blocks_;
+  for (int i = 0; i < count; ++i) {
+    const uintptr_t source = NonAllocatingAddress(copies[i].source);
+    const uintptr_t destination =
+        reinterpret_cast<uintptr_t>(copies[i].destination);
+    const bool words = ((source | destination | copies[i].size) & 3) == 0;
+    dma_channel_config config = dma_channel_get_default_config(data_channel_);
+    channel_config_set_transfer_data_size(&config,
+                                          words ? DMA_SIZE_32 : DMA_SIZE_8);
+    channel_config_set_read_increment(&config, true);
+    channel_config_set_write_increment(&config, true);
+    channel_config_set_chain_to(&config, control_channel_);
+    channel_config_set_irq_quiet(&config, true);
+    block[0] = channel_config_get_ctrl_value(&config);
+    block[1] = static_cast<uint32_t>(source);
+    block[2] = static_cast<uint32_t>(destination);
+    block[3] = words ? copies[i].size / 4 : copies[i].size;
+    block += 4;
+  }
+  std::memset(block, 0, 4 * sizeof(uint32_t));
+  control_blocks_end_ = block + 4;
+
+  dma_channel_config config = dma_channel_get_default_config(control_channel_);
+  channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+  channel_config_set_read_increment(&config, true);
+  channel_config_set_write_increment(&config, true);
+  // Wraps the writes around the four alias 1 registers.
+  channel_config_set_ring(&config, /*write=*/true, /*size_bits=*/4);
+  __compiler_memory_barrier();
+  dma_channel_configure(control_channel_, &config,
+                        &dma_hw->ch[data_channel_].al1_ctrl, control_blocks_,
+                        /*transfer_count=*/4, /*trigger=*/true);
+}
+
+void WeightCopyEngine::Wait() {
+  if (control_blocks_end_ == nullptr) {
+    return;
+  }
+  const uintptr_t end = reinterpret_cast<uintptr_t>(control_blocks_end_);
+  while (dma_hw->ch[control_channel_].read_addr != end ||
+         dma_channel_is_busy(control_channel_) ||
+         dma_channel_is_busy(data_channel_)) {
+    tight_loop_contents();
+  }
+  control_blocks_end_ = nullptr;
+}
+
+}  // namespace tflite
@@ -0,0 +1,71 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_WEIGHT_COPY_ENGINE_H_
+#define TENSORFLOW_LITE_MICRO_WEIGHT_COPY_ENGINE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tflite {
+
+// Copies batches of memory regions, typically weights from flash into SRAM,
+// while the CPU does other work. Used by the interpreter to stage the weights
+// of the next operator while the current one runs.
+//
+// On the RP2 a batch is one DMA transfer per region, chained through DMA
+// control blocks so that it needs no interrupts. Weights are read through
+// the non-allocating XIP alias, so streaming them does not evict the code and
+// data the running kernel keeps in the XIP cache. On the host each region is
+// copied with memcpy() when the batch is started.
+class WeightCopyEngine {
+ public:
+  static constexpr int kMaxCopies = 8;
+
+  struct Copy {
+    void* destination;
+    const void* source;
+    uint32_t size;
+  };
+
+  WeightCopyEngine() = default;
+  // Waits for the batch in flight and releases the DMA channels.
+  ~WeightCopyEngine();
+
+  WeightCopyEngine(const WeightCopyEngine&) = delete;
+  WeightCopyEngine& operator=(const WeightCopyEngine&) = delete;
+
+  // Waits for the previous batch, then starts copying up to kMaxCopies
+  // regions. `copies` is read before Start() returns. If no DMA channels are
+  // free the batch is copied before Start() returns.
+  void Start(const Copy* copies, int count);
+
+  // Blocks until every region of the batch Start() began has been copied.
+  void Wait();
+
+ private:
+  int data_channel_ = -1;
+  int control_channel_ = -1;
+  // Where the control channel's read address ends up once it has loaded the
+  // null block of the batch in flight, or nullptr if none is.
+  const uint32_t* control_blocks_end_ = nullptr;
+  // One control block (CTRL, READ_ADDR, WRITE_ADDR, TRANS_COUNT) per region,
+  // then a null block that stops the chain.
+  alignas(16) uint32_t control_blocks_[(kMaxCopies + 1) * 4];
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_WEIGHT_COPY_ENGINE_H_
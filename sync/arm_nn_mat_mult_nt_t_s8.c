@@ -47,6 +47,8 @@
 #include "pico/stdlib.h"
 #include "pico/multicore.h"
 
+#include "tensorflow/lite/micro/kernel_region_profiler.h"
+
 typedef struct {
     int32_t rhs_rows_start;
     int32_t rhs_rows_end;
@@ -272,6 +274,8 @@ static void mat_mul_task(const MatMulArgs* args) {
     int32_t activation_max = args->activation_max;
     int32_t lhs_cols_offset = args->lhs_cols_offset;
 
+    // Both cores record their share, so a trace shows how they overlap.
+    const uint32_t region = TfLiteMicroRegionBegin(TF_LITE_MICRO_REGION_MATMUL);
     calculate_row_range(
         rhs_rows_start,
         rhs_rows_end,
@@ -289,6 +293,7 @@ static void mat_mul_task(const MatMulArgs* args) {
         activation_min,
         activation_max,
         lhs_cols_offset);
+    TfLiteMicroRegionEnd(region);
 }
 
 static void core1_mat_mul_worker(void) {
@@ -923,7 +928,9 @@ arm_cmsis_nn_status arm_nn_mat_mult_nt_t_s8(const int8_t *lhs,
 
     // A result of ARM_CMSIS_NN_SUCCESS means success. Blocks until core 1 is
     // done.
+    const uint32_t wait_region = TfLiteMicroRegionBegin(TF_LITE_MICRO_REGION_MATMUL_WAIT);
     const uint32_t core1_result = multicore_fifo_pop_blocking();
+    TfLiteMicroRegionEnd(wait_region);
     if (core1_result != ARM_CMSIS_NN_SUCCESS) {
         return core1_result;
     }
@@ -78,6 +78,19 @@ namespace tflite {
 inline void InitializeTest() { InitializeTarget(); }
 }  // namespace tflite
 
+// On the board the test binary repeats forever so that the results can be
+// read whenever a serial console attaches. Host builds run the tests once and
+// report failure through the exit status so that ctest can pick it up.
+#ifdef TFLM_HOST_PLATFORM
+#define TF_LITE_MICRO_TESTS_LOOP_BEGIN do {
+#define TF_LITE_MICRO_TESTS_LOOP_END \
+  } while (false);                   \
+  return micro_test::tests_failed == 0 ? 0 : 1;
+#else
+#define TF_LITE_MICRO_TESTS_LOOP_BEGIN while (true) {
+#define TF_LITE_MICRO_TESTS_LOOP_END }
+#endif  // TFLM_HOST_PLATFORM
+
 #define TF_LITE_MICRO_TESTS_BEGIN   \
   namespace micro_test {            \
   int tests_passed;                 \
@@ -88,7 +101,7 @@ inline void InitializeTest() { InitializeTarget(); }
                                     \
   int main(int argc, char** argv) { \
     tflite::InitializeTest();       \
-    while (true) {                  \
+    TF_LITE_MICRO_TESTS_LOOP_BEGIN  \
     micro_test::tests_passed = 0;   \
     micro_test::tests_failed = 0;
 
@@ -100,7 +113,7 @@ inline void InitializeTest() { InitializeTarget(); }
   } else {                                                            \
     MicroPrintf("~~~SOME TESTS FAILED~~~\n");                         \
   }                                                                   \
-  }                                                                   \
+  TF_LITE_MICRO_TESTS_LOOP_END                                        \
   }
 
 // TODO(petewarden): I'm going to hell for what I'm doing to this poor for loop.
@@ -37,6 +37,11 @@ python3 sync/create_tflm_arduino.py \
   --base_dir="${TFLM_TREE_DIR}" \
   --manifest_file=sync/MANIFEST.ini
 
+# Save the files this fork adds or changes, see sync/LOCAL_FILES.
+LOCAL_FILES_DIR="$(mktemp -d /tmp/local_files.XXXXXXXXX)" || exit 1
+grep -v -e '^#' -e '^$' sync/LOCAL_FILES | \
+  xargs cp --parents -t "${LOCAL_FILES_DIR}"
+
 # Copy over the bulk of TFLM source files.
 rm -rf src
 mkdir src
@@ -68,6 +73,10 @@ cp sync/micro_benchmark.h src/tensorflow/lite/micro/benchmarks
 mkdir -p src/tensorflow/lite/micro/testing
 cp sync/micro_test.h src/tensorflow/lite/micro/testing
 
+# Restore the files this fork adds or changes.
+cp -r "${LOCAL_FILES_DIR}/." .
+rm -rf "${LOCAL_FILES_DIR}"
+
 rm -rf CMakeLists.txt
 SOURCE_LIST_FILE="$(mktemp /tmp/source_file_list.XXXXXXXXX)" || exit 1
 find src \( -iname "*.cpp" -o -iname "*.c" -o -iname "*.h" \) | \
@@ -87,4 +96,14 @@ sync/replace_string_with_file_contents.py \
   "{{LIBRARY_SOURCES}}" \
   ${TEST_LIST_FILE} \
   "{{TEST_FOLDERS}}" \
-  > CMakeLists.txt
\ No newline at end of file
+  > CMakeLists.txt
+
+# With RUN_HOST_BENCHMARKS=1, benchmark the synced tree on the host against
+# benchmarks/baseline.json, so that a kernel performance regression fails the
+# sync. The host baseline must have been recorded on the same machine.
+if [ "${RUN_HOST_BENCHMARKS}" = "1" ]; then
+  HOST_BUILD_DIR=${BUILD_DIR}/host
+  cmake -S . -B "${HOST_BUILD_DIR}" -DPICO_TFLMICRO_HOST=ON -DCMAKE_BUILD_TYPE=Release
+  cmake --build "${HOST_BUILD_DIR}" -j
+  python3 benchmarks/check_benchmarks.py --build-dir "${HOST_BUILD_DIR}"
+fi
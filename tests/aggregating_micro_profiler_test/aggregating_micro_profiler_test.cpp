@@ -0,0 +1,172 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/aggregating_micro_profiler.h"
+
+#include <cstdint>
+
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace {
+
+constexpr int kMaxRecords = 16;
+
+struct RecordLog {
+  uint8_t records[kMaxRecords][tflite::AggregatingMicroProfiler::kRecordSize];
+  int count;
+};
+
+void CollectRecord(const uint8_t* record, int size, void* context) {
+  RecordLog* log = static_cast<RecordLog*>(context);
+  if (log->count < kMaxRecords &&
+      size == tflite::AggregatingMicroProfiler::kRecordSize) {
+    for (int i = 0; i < size; ++i) {
+      log->records[log->count][i] = record[i];
+    }
+    ++log->count;
+  }
+}
+
+// Runs one "invocation" of three nodes, the second containing a nested event.
+void RunInvocation(tflite::AggregatingMicroProfiler& profiler) {
+  profiler.ClearEvents();
+  profiler.EndEvent(profiler.BeginEvent("CONV_2D"));
+  uint32_t outer = profiler.BeginEvent("DEPTHWISE_CONV_2D");
+  profiler.EndEvent(profiler.BeginEvent("im2col"));
+  profiler.EndEvent(outer);
+  profiler.EndEvent(profiler.BeginEvent("SOFTMAX"));
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestAggregatesPerNode) {
+  tflite::StaticAggregatingMicroProfiler<8> profiler;
+  for (int i = 0; i < 120; ++i) {
+    RunInvocation(profiler);
+  }
+
+  TF_LITE_MICRO_EXPECT_EQ(4, profiler.num_nodes());
+  TF_LITE_MICRO_EXPECT_EQ(0u, profiler.dropped_events());
+  const char* expected_tags[] = {"CONV_2D", "DEPTHWISE_CONV_2D", "im2col",
+                                 "SOFTMAX"};
+  for (int n = 0; n < profiler.num_nodes(); ++n) {
+    const tflite::AggregatingMicroProfiler::NodeStats& node = profiler.node(n);
+    TF_LITE_MICRO_EXPECT_STRING_EQ(expected_tags[n], node.tag);
+    TF_LITE_MICRO_EXPECT_EQ(120u, node.count);
+    const uint32_t mean = tflite::AggregatingMicroProfiler::MeanTicks(node);
+    const uint32_t p99 = tflite::AggregatingMicroProfiler::P99Ticks(node);
+    TF_LITE_MICRO_EXPECT_LE(node.min_ticks, mean);
+    TF_LITE_MICRO_EXPECT_LE(mean, node.max_ticks);
+    TF_LITE_MICRO_EXPECT_LE(node.min_ticks, p99);
+    TF_LITE_MICRO_EXPECT_LE(p99, node.max_ticks);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestDropsEventsBeyondCapacity) {
+  tflite::StaticAggregatingMicroProfiler<2> profiler;
+  RunInvocation(profiler);
+
+  TF_LITE_MICRO_EXPECT_EQ(2, profiler.num_nodes());
+  TF_LITE_MICRO_EXPECT_EQ(2u, profiler.dropped_events());
+}
+
+TF_LITE_MICRO_TEST(TestRestartsWhenSequenceChanges) {
+  tflite::StaticAggregatingMicroProfiler<8> profiler;
+  RunInvocation(profiler);
+  RunInvocation(profiler);
+
+  profiler.ClearEvents();
+  profiler.EndEvent(profiler.BeginEvent("CONV_2D"));
+  profiler.EndEvent(profiler.BeginEvent("FULLY_CONNECTED"));
+
+  TF_LITE_MICRO_EXPECT_EQ(2, profiler.num_nodes());
+  TF_LITE_MICRO_EXPECT_EQ(3u, profiler.node(0).count);
+  TF_LITE_MICRO_EXPECT_STRING_EQ("FULLY_CONNECTED", profiler.node(1).tag);
+  TF_LITE_MICRO_EXPECT_EQ(1u, profiler.node(1).count);
+}
+
+TF_LITE_MICRO_TEST(TestStreamsBinaryRecords) {
+  tflite::StaticAggregatingMicroProfiler<8> profiler;
+  RecordLog log = {};
+  profiler.SetRecordSink(CollectRecord, &log);
+  RunInvocation(profiler);
+
+  // Records are emitted in completion order: the nested event first.
+  TF_LITE_MICRO_EXPECT_EQ(4, log.count);
+  const int expected_nodes[] = {0, 2, 1, 3};
+  for (int i = 0; i < log.count; ++i) {
+    const uint8_t* record = log.records[i];
+    TF_LITE_MICRO_EXPECT_EQ(tflite::AggregatingMicroProfiler::kRecordSync,
+                            record[0]);
+    TF_LITE_MICRO_EXPECT_EQ(1, record[1]);
+    TF_LITE_MICRO_EXPECT_EQ(expected_nodes[i], record[2] | (record[3] << 8));
+    const uint32_t ticks = record[4] | (record[5] << 8) | (record[6] << 16) |
+                           (static_cast<uint32_t>(record[7]) << 24);
+    TF_LITE_MICRO_EXPECT_EQ(profiler.node(expected_nodes[i]).max_ticks, ticks);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestTotalTicksCountsOutermostEvents) {
+  tflite::StaticAggregatingMicroProfiler<8> profiler;
+  RunInvocation(profiler);
+
+  uint32_t expected = 0;
+  expected += profiler.node(0).max_ticks;
+  expected += profiler.node(1).max_ticks;
+  expected += profiler.node(3).max_ticks;
+  TF_LITE_MICRO_EXPECT_EQ(expected, profiler.GetTotalTicks());
+}
+
+TF_LITE_MICRO_TEST(TestKeepsEventCosts) {
+  tflite::StaticAggregatingMicroProfiler<8> profiler;
+  tflite::MicroOpCost cost = {};
+  cost.macs = 1000;
+  cost.weight_bytes = 200;
+  cost.input_bytes = 50;
+  cost.output_bytes = 25;
+  profiler.ClearEvents();
+  uint32_t handle = profiler.BeginEvent("CONV_2D");
+  profiler.SetEventCost(handle, cost);
+  profiler.EndEvent(handle);
+  profiler.EndEvent(profiler.BeginEvent("SOFTMAX"));
+
+  const tflite::AggregatingMicroProfiler::NodeStats& conv = profiler.node(0);
+  TF_LITE_MICRO_EXPECT_EQ(1000u, conv.cost.macs);
+  TF_LITE_MICRO_EXPECT_EQ(275u, tflite::MicroOpCostBytes(conv.cost));
+  TF_LITE_MICRO_EXPECT_EQ(0u, profiler.node(1).cost.macs);
+
+  // The cost survives into later invocations that do not report it again.
+  RunInvocation(profiler);
+  TF_LITE_MICRO_EXPECT_EQ(1000u, profiler.node(0).cost.macs);
+
+  tflite::AggregatingMicroProfiler::NodeStats node = {};
+  node.count = 2;
+  node.total_ticks = 800;
+  TF_LITE_MICRO_EXPECT_EQ(250u,
+                          tflite::AggregatingMicroProfiler::PerTickX100(
+                              node, /*amount=*/1000));
+  node.count = 1;
+  node.total_ticks = 1;
+  TF_LITE_MICRO_EXPECT_EQ(UINT32_MAX,
+                          tflite::AggregatingMicroProfiler::PerTickX100(
+                              node, /*amount=*/100000000));
+  node.count = 0;
+  TF_LITE_MICRO_EXPECT_EQ(
+      0u, tflite::AggregatingMicroProfiler::PerTickX100(node, 1000));
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -18,6 +18,7 @@ limitations under the License.
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/micro/kernels/kernel_runner.h"
+#include "tensorflow/lite/micro/kernels/strided_copy.h"
 #include "tensorflow/lite/micro/test_helpers.h"
 #include "tensorflow/lite/micro/testing/micro_test.h"
 
@@ -246,6 +247,51 @@ void TestConcatenateQuantizedTwoInputsCompressed(
 
 #endif  // USE_TFLM_COMPRESSION
 
+void TestConcatenateThreeInt8Inputs(int* input1_dims_data,
+                                    const int8_t* input1_data,
+                                    int* input2_dims_data,
+                                    const int8_t* input2_data,
+                                    int* input3_dims_data,
+                                    const int8_t* input3_data, int axis,
+                                    int* output_dims_data,
+                                    const int8_t* expected_output_data,
+                                    int8_t* output_data) {
+  TfLiteIntArray* input1_dims = IntArrayFromInts(input1_dims_data);
+  TfLiteIntArray* input2_dims = IntArrayFromInts(input2_dims_data);
+  TfLiteIntArray* input3_dims = IntArrayFromInts(input3_dims_data);
+  TfLiteIntArray* output_dims = IntArrayFromInts(output_dims_data);
+
+  constexpr int tensors_size = 4;
+  TfLiteTensor tensors[tensors_size] = {
+      CreateQuantizedTensor(input1_data, input1_dims, 1.0f, 0),
+      CreateQuantizedTensor(input2_data, input2_dims, 1.0f, 0),
+      CreateQuantizedTensor(input3_data, input3_dims, 1.0f, 0),
+      CreateQuantizedTensor(output_data, output_dims, 1.0f, 0)};
+
+  int inputs_array_data[] = {3, 0, 1, 2};
+  TfLiteIntArray* inputs_array = IntArrayFromInts(inputs_array_data);
+  int outputs_array_data[] = {1, 3};
+  TfLiteIntArray* outputs_array = IntArrayFromInts(outputs_array_data);
+
+  TfLiteConcatenationParams builtin_data = {
+      .axis = axis,
+      .activation = kTfLiteActNone  // Only activation supported in this impl
+  };
+
+  const TFLMRegistration registration = Register_CONCATENATION();
+  micro::KernelRunner runner(registration, tensors, tensors_size, inputs_array,
+                             outputs_array,
+                             reinterpret_cast<void*>(&builtin_data));
+
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.InitAndPrepare());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.Invoke());
+
+  const int output_dims_count = ElementCount(*output_dims);
+  for (int i = 0; i < output_dims_count; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(expected_output_data[i], output_data[i]);
+  }
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace tflite
@@ -582,4 +628,90 @@ TF_LITE_MICRO_TEST(TwoInputsQuantizedInt8FiveDimensions) {
       output_zero_point, output_data);
 }
 
+TF_LITE_MICRO_TEST(ThreeInputsInt8MiddleAxis) {
+  // Each input fills a slot of a different width in every output row, so the
+  // rows of the copy plans are not contiguous in the output and stay
+  // separate runs.
+  int input1_shape[] = {3, 2, 1, 3};
+  int input2_shape[] = {3, 2, 2, 3};
+  int input3_shape[] = {3, 2, 3, 3};
+  int output_shape[] = {3, 2, 6, 3};
+  const int8_t input1_values[] = {1, 2, 3, 4, 5, 6};
+  const int8_t input2_values[] = {10, 11, 12, 13, 14, 15,
+                                  16, 17, 18, 19, 20, 21};
+  const int8_t input3_values[] = {30, 31, 32, 33, 34, 35, 36, 37, 38,
+                                  39, 40, 41, 42, 43, 44, 45, 46, 47};
+  const int8_t output_values[] = {
+      1,  2,  3,  10, 11, 12, 13, 14, 15, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+      4,  5,  6,  16, 17, 18, 19, 20, 21, 39, 40, 41, 42, 43, 44, 45, 46, 47};
+  int8_t output_data[36];
+  tflite::testing::TestConcatenateThreeInt8Inputs(
+      input1_shape, input1_values, input2_shape, input2_values, input3_shape,
+      input3_values, /*axis=*/1, output_shape, output_values, output_data);
+}
+
+TF_LITE_MICRO_TEST(ThreeInputsInt8OuterAxis) {
+  // Along axis 0 every input is one contiguous block of the output, so each
+  // plan merges all dimensions into a single memcpy.
+  int input1_shape[] = {3, 1, 2, 2};
+  int input2_shape[] = {3, 2, 2, 2};
+  int input3_shape[] = {3, 1, 2, 2};
+  int output_shape[] = {3, 4, 2, 2};
+  const int8_t input1_values[] = {1, 2, 3, 4};
+  const int8_t input2_values[] = {5, 6, 7, 8, 9, 10, 11, 12};
+  const int8_t input3_values[] = {13, 14, 15, 16};
+  const int8_t output_values[] = {1, 2,  3,  4,  5,  6,  7,  8,
+                                  9, 10, 11, 12, 13, 14, 15, 16};
+  int8_t output_data[16];
+  tflite::testing::TestConcatenateThreeInt8Inputs(
+      input1_shape, input1_values, input2_shape, input2_values, input3_shape,
+      input3_values, /*axis=*/0, output_shape, output_values, output_data);
+}
+
+TF_LITE_MICRO_TEST(CopyPlanMergesOnlyContiguousDimensions) {
+  // A dense 2x3x4 copy merges into one memcpy.
+  const int32_t extents[] = {2, 3, 4};
+  const int32_t dense_strides[] = {12, 4, 1};
+  tflite::StridedCopyPlan plan;
+  tflite::BuildStridedCopyPlan(3, extents, dense_strides, dense_strides,
+                               /*src_offset=*/0, /*dst_offset=*/0,
+                               /*element_bytes=*/2, &plan);
+  TF_LITE_MICRO_EXPECT_EQ(0, plan.num_dims);
+  TF_LITE_MICRO_EXPECT_EQ(48, plan.run_bytes);
+
+  // Reading 4 of every 5 source elements: the outer two dimensions still
+  // merge, the inner one stays a run of its own.
+  const int32_t cropped_src_strides[] = {15, 5, 1};
+  tflite::BuildStridedCopyPlan(3, extents, cropped_src_strides, dense_strides,
+                               /*src_offset=*/1, /*dst_offset=*/0,
+                               /*element_bytes=*/1, &plan);
+  TF_LITE_MICRO_EXPECT_EQ(1, plan.num_dims);
+  TF_LITE_MICRO_EXPECT_EQ(6, plan.extents[0]);
+  TF_LITE_MICRO_EXPECT_EQ(5, plan.src_strides[0]);
+  TF_LITE_MICRO_EXPECT_EQ(4, plan.dst_strides[0]);
+  TF_LITE_MICRO_EXPECT_EQ(4, plan.run_bytes);
+  TF_LITE_MICRO_EXPECT_EQ(1, plan.src_offset);
+
+  // A reversed inner dimension must not merge or turn into a memcpy.
+  const int32_t reversed_src_strides[] = {12, 4, -1};
+  tflite::BuildStridedCopyPlan(3, extents, reversed_src_strides,
+                               dense_strides, /*src_offset=*/3,
+                               /*dst_offset=*/0, /*element_bytes=*/1, &plan);
+  TF_LITE_MICRO_EXPECT_EQ(2, plan.num_dims);
+  TF_LITE_MICRO_EXPECT_EQ(6, plan.extents[0]);
+  TF_LITE_MICRO_EXPECT_EQ(4, plan.extents[1]);
+  TF_LITE_MICRO_EXPECT_EQ(-1, plan.src_strides[1]);
+  TF_LITE_MICRO_EXPECT_EQ(1, plan.run_bytes);
+  TF_LITE_MICRO_EXPECT(!plan.blocked_transpose);
+
+  // Unit dimensions are dropped wherever they are.
+  const int32_t unit_extents[] = {1, 3, 1, 4};
+  const int32_t unit_strides[] = {12, 4, 4, 1};
+  tflite::BuildStridedCopyPlan(4, unit_extents, unit_strides, unit_strides,
+                               /*src_offset=*/0, /*dst_offset=*/0,
+                               /*element_bytes=*/4, &plan);
+  TF_LITE_MICRO_EXPECT_EQ(0, plan.num_dims);
+  TF_LITE_MICRO_EXPECT_EQ(48, plan.run_bytes);
+}
+
 TF_LITE_MICRO_TESTS_END
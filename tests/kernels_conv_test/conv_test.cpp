@@ -19,6 +19,7 @@ limitations under the License.
 
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
 #include "tensorflow/lite/micro/kernels/kernel_runner.h"
 #include "tensorflow/lite/micro/kernels/testdata/conv_test_data.h"
 #include "tensorflow/lite/micro/micro_utils.h"
@@ -142,6 +143,291 @@ static TfLiteConvParams common_conv_params = {
     kTfLiteNoType         // quantized_bias_type
 };
 
+// Runs CONV_2D on `tensors` ({input, filter, bias, output}), optionally with
+// the filter marked block-sparse.
+TfLiteStatus InvokeConvBlockSparse(TfLiteTensor* tensors,
+                                   TfLiteConvParams* conv_params,
+                                   const BlockSparseTensorList* sparse_list) {
+  int inputs_array_data[] = {3, 0, 1, 2};
+  TfLiteIntArray* inputs_array = IntArrayFromInts(inputs_array_data);
+  int outputs_array_data[] = {1, 3};
+  TfLiteIntArray* outputs_array = IntArrayFromInts(outputs_array_data);
+
+  const TFLMRegistration registration = Register_CONV_2D();
+  micro::KernelRunner runner(registration, tensors, 4, inputs_array,
+                             outputs_array, conv_params);
+  runner.SetBlockSparseTensors(sparse_list);
+  TF_LITE_ENSURE_STATUS(runner.InitAndPrepare());
+  return runner.Invoke();
+}
+
+// Runs a square int8 convolution with stride 1 once with a dense filter and
+// once with the same filter stored block-sparse, and checks that both give
+// the same output. Bit b of `block_masks[o]` marks block b of output channel
+// o as present; the filter is zero outside the present blocks.
+void TestConvBlockSparseMatchesDense(TfLiteConvParams* conv_params,
+                                     int spatial, int kernel, int depth,
+                                     int out_channels, int block_size,
+                                     const uint16_t* block_masks) {
+  constexpr int kMaxElements = 128;
+  constexpr int kMaxChannels = 4;
+  const int row_depth = kernel * kernel * depth;
+  const int blocks_per_row = row_depth / block_size;
+  const int input_elements = spatial * spatial * depth;
+  const int filter_elements = out_channels * row_depth;
+  const int output_elements = spatial * spatial * out_channels;
+  TF_LITE_MICRO_EXPECT_LE(input_elements, kMaxElements);
+  TF_LITE_MICRO_EXPECT_LE(filter_elements, kMaxElements);
+  TF_LITE_MICRO_EXPECT_LE(output_elements, kMaxElements);
+  TF_LITE_MICRO_EXPECT_LE(out_channels, kMaxChannels);
+
+  int input_shape[] = {4, 1, spatial, spatial, depth};
+  int filter_shape[] = {4, out_channels, kernel, kernel, depth};
+  int bias_shape[] = {1, out_channels};
+  int output_shape[] = {4, 1, spatial, spatial, out_channels};
+
+  float input_data[kMaxElements];
+  float filter_data[kMaxElements];
+  float bias_data[kMaxChannels];
+  for (int i = 0; i < input_elements; ++i) {
+    input_data[i] = (i % 7) - 3;
+  }
+  for (int o = 0; o < out_channels; ++o) {
+    for (int e = 0; e < row_depth; ++e) {
+      const bool present = ((block_masks[o] >> (e / block_size)) & 1) != 0;
+      filter_data[o * row_depth + e] =
+          present ? ((o * 7 + e * 3) % 9) - 4 : 0;
+    }
+    bias_data[o] = o * 4 - 5;
+  }
+
+  const float input_scale = 0.5f;
+  const int input_zero_point = 3;
+  const float output_scale = 2.0f;
+  const int output_zero_point = -2;
+
+  int8_t input_quantized[kMaxElements];
+  int8_t filter_quantized[kMaxElements];
+  int32_t bias_quantized[kMaxChannels];
+  int8_t dense_output[kMaxElements];
+  int8_t sparse_output[kMaxElements];
+  int filter_zero_points[kMaxChannels + 1];
+  float filter_scales[kMaxChannels + 1];
+  int bias_zero_points[kMaxChannels + 1];
+  float bias_scales[kMaxChannels + 1];
+  TfLiteAffineQuantization filter_quant;
+  TfLiteAffineQuantization bias_quant;
+
+  TfLiteTensor input_tensor =
+      CreateQuantizedTensor(input_data, input_quantized,
+                            IntArrayFromInts(input_shape), input_scale,
+                            input_zero_point);
+  float input_scales[] = {1, input_scale};
+  int input_zero_points[] = {1, input_zero_point};
+  TfLiteAffineQuantization input_quant = {
+      FloatArrayFromFloats(input_scales), IntArrayFromInts(input_zero_points),
+      0};
+  input_tensor.quantization = {kTfLiteAffineQuantization, &input_quant};
+
+  TfLiteTensor filter_tensor = CreateSymmetricPerChannelQuantizedTensor(
+      filter_data, filter_quantized, IntArrayFromInts(filter_shape),
+      filter_scales, filter_zero_points, &filter_quant, 0);
+  TfLiteTensor bias_tensor = CreatePerChannelQuantizedBiasTensor(
+      bias_data, bias_quantized, IntArrayFromInts(bias_shape), input_scale,
+      &filter_scales[1], bias_scales, bias_zero_points, &bias_quant, 0);
+
+  float output_scales[] = {1, output_scale};
+  int output_zero_points[] = {1, output_zero_point};
+  TfLiteAffineQuantization output_quant = {
+      FloatArrayFromFloats(output_scales), IntArrayFromInts(output_zero_points),
+      0};
+
+  TfLiteTensor dense_tensors[] = {
+      input_tensor, filter_tensor, bias_tensor,
+      CreateQuantizedTensor(dense_output, IntArrayFromInts(output_shape),
+                            output_scale, output_zero_point)};
+  dense_tensors[3].quantization = {kTfLiteAffineQuantization, &output_quant};
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, InvokeConvBlockSparse(dense_tensors, conv_params, nullptr));
+
+  // Pack the nonzero blocks and build the block mask.
+  int8_t packed_filter[kMaxElements];
+  uint8_t block_mask[(kMaxElements + 7) / 8] = {};
+  int packed = 0;
+  int nonzero_blocks = 0;
+  for (int block = 0; block < out_channels * blocks_per_row; ++block) {
+    bool present = false;
+    for (int c = 0; c < block_size; ++c) {
+      present |= filter_quantized[block * block_size + c] != 0;
+    }
+    if (present) {
+      block_mask[block / 8] |= 1 << (block % 8);
+      for (int c = 0; c < block_size; ++c) {
+        packed_filter[packed++] = filter_quantized[block * block_size + c];
+      }
+      ++nonzero_blocks;
+    }
+  }
+  TF_LITE_MICRO_EXPECT_LT(nonzero_blocks, out_channels * blocks_per_row);
+
+  BlockSparseTensorData sparsity;
+  sparsity.block_mask = block_mask;
+  sparsity.rows = out_channels;
+  sparsity.row_depth = row_depth;
+  sparsity.block_size = block_size;
+  sparsity.blocks_per_row = blocks_per_row;
+  sparsity.nonzero_blocks = nonzero_blocks;
+  const BlockSparseTensorData* sparse_tensors[] = {nullptr, &sparsity,
+                                                   nullptr, nullptr};
+  BlockSparseTensorList sparse_list = {sparse_tensors};
+
+  TfLiteTensor sparse_tensors_in[] = {
+      input_tensor, filter_tensor, bias_tensor,
+      CreateQuantizedTensor(sparse_output, IntArrayFromInts(output_shape),
+                            output_scale, output_zero_point)};
+  sparse_tensors_in[1].data.int8 = packed_filter;
+  sparse_tensors_in[3].quantization = {kTfLiteAffineQuantization,
+                                       &output_quant};
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          InvokeConvBlockSparse(sparse_tensors_in, conv_params,
+                                                &sparse_list));
+
+  for (int i = 0; i < output_elements; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(dense_output[i], sparse_output[i]);
+  }
+}
+
+
+// Runs CONV_2D on `tensors` ({input, filter, bias, output}), optionally with
+// per-channel requantization tables as if read from the model.
+TfLiteStatus InvokeConvOfflineRequantization(
+    TfLiteTensor* tensors, TfLiteConvParams* conv_params,
+    const OfflineRequantizationData* requantization, int channels) {
+  int inputs_array_data[] = {3, 0, 1, 2};
+  TfLiteIntArray* inputs_array = IntArrayFromInts(inputs_array_data);
+  int outputs_array_data[] = {1, 3};
+  TfLiteIntArray* outputs_array = IntArrayFromInts(outputs_array_data);
+
+  const TFLMRegistration registration = Register_CONV_2D();
+  micro::KernelRunner runner(registration, tensors, 4, inputs_array,
+                             outputs_array, conv_params);
+  runner.SetOfflineRequantization(requantization, channels);
+  TF_LITE_ENSURE_STATUS(runner.InitAndPrepare());
+  return runner.Invoke();
+}
+
+// Runs a 3x3 SAME int8 convolution once computing the requantization tables
+// in Prepare() and once reading them as offline tables, computed here the
+// way tools/precompute_requantization.py does. With `zero_multipliers` the
+// offline multipliers are zeroed, so only the output zero point remains.
+void TestConvOfflineRequantization(bool zero_multipliers) {
+  constexpr int kChannels = 2;
+  constexpr int kInputElements = 18;
+  constexpr int kFilterElements = 36;
+  constexpr int kOutputElements = 18;
+  TfLiteConvParams conv_params = {
+      kTfLitePaddingSame, 1, 1, kTfLiteActNone, 1, 1, kTfLiteNoType};
+  int input_shape[] = {4, 1, 3, 3, 2};
+  int filter_shape[] = {4, kChannels, 3, 3, 2};
+  int bias_shape[] = {1, kChannels};
+  int output_shape[] = {4, 1, 3, 3, kChannels};
+
+  float input_data[kInputElements];
+  float filter_data[kFilterElements];
+  const float bias_data[kChannels] = {3, -5};
+  for (int e = 0; e < kInputElements; ++e) {
+    input_data[e] = (e % 7) - 3;
+  }
+  for (int e = 0; e < kFilterElements; ++e) {
+    filter_data[e] = ((e * 5) % 9) - 4;
+  }
+
+  const float input_scale = 0.5f;
+  const int input_zero_point = 3;
+  const float output_scale = 1.5f;
+  const int output_zero_point = -2;
+
+  int8_t input_quantized[kInputElements];
+  int8_t filter_quantized[kFilterElements];
+  int32_t bias_quantized[kChannels];
+  int8_t computed_output[kOutputElements];
+  int8_t offline_output[kOutputElements];
+  int filter_zero_points[kChannels + 1];
+  float filter_scales[kChannels + 1];
+  int bias_zero_points[kChannels + 1];
+  float bias_scales[kChannels + 1];
+  TfLiteAffineQuantization filter_quant;
+  TfLiteAffineQuantization bias_quant;
+
+  TfLiteTensor input_tensor =
+      CreateQuantizedTensor(input_data, input_quantized,
+                            IntArrayFromInts(input_shape), input_scale,
+                            input_zero_point);
+  float input_scales[] = {1, input_scale};
+  int input_zero_points[] = {1, input_zero_point};
+  TfLiteAffineQuantization input_quant = {
+      FloatArrayFromFloats(input_scales), IntArrayFromInts(input_zero_points),
+      0};
+  input_tensor.quantization = {kTfLiteAffineQuantization, &input_quant};
+
+  TfLiteTensor filter_tensor = CreateSymmetricPerChannelQuantizedTensor(
+      filter_data, filter_quantized, IntArrayFromInts(filter_shape),
+      filter_scales, filter_zero_points, &filter_quant, 0);
+  TfLiteTensor bias_tensor = CreatePerChannelQuantizedBiasTensor(
+      bias_data, bias_quantized, IntArrayFromInts(bias_shape), input_scale,
+      &filter_scales[1], bias_scales, bias_zero_points, &bias_quant, 0);
+
+  float output_scales[] = {1, output_scale};
+  int output_zero_points[] = {1, output_zero_point};
+  TfLiteAffineQuantization output_quant = {
+      FloatArrayFromFloats(output_scales), IntArrayFromInts(output_zero_points),
+      0};
+
+  TfLiteTensor computed_tensors[] = {
+      input_tensor, filter_tensor, bias_tensor,
+      CreateQuantizedTensor(computed_output, IntArrayFromInts(output_shape),
+                            output_scale, output_zero_point)};
+  computed_tensors[3].quantization = {kTfLiteAffineQuantization,
+                                      &output_quant};
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, InvokeConvOfflineRequantization(
+                     computed_tensors, &conv_params, nullptr, kChannels));
+
+  int32_t multipliers[kChannels];
+  int32_t shifts[kChannels];
+  for (int c = 0; c < kChannels; ++c) {
+    const double effective_scale = static_cast<double>(input_scale) *
+                                   static_cast<double>(filter_scales[c + 1]) /
+                                   static_cast<double>(output_scale);
+    int shift;
+    QuantizeMultiplier(effective_scale, &multipliers[c], &shift);
+    shifts[c] = shift;
+    if (zero_multipliers) {
+      multipliers[c] = 0;
+    }
+  }
+  const OfflineRequantizationData requantization = {multipliers, shifts};
+
+  TfLiteTensor offline_tensors[] = {
+      input_tensor, filter_tensor, bias_tensor,
+      CreateQuantizedTensor(offline_output, IntArrayFromInts(output_shape),
+                            output_scale, output_zero_point)};
+  offline_tensors[3].quantization = {kTfLiteAffineQuantization,
+                                     &output_quant};
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk,
+      InvokeConvOfflineRequantization(offline_tensors, &conv_params,
+                                      &requantization, kChannels));
+
+  for (int e = 0; e < kOutputElements; ++e) {
+    if (zero_multipliers) {
+      TF_LITE_MICRO_EXPECT_EQ(output_zero_point, offline_output[e]);
+    } else {
+      TF_LITE_MICRO_EXPECT_EQ(computed_output[e], offline_output[e]);
+    }
+  }
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace tflite
@@ -768,6 +1054,70 @@ TF_LITE_MICRO_TEST(Kernel1x1QuantizedPerChannel) {
                      &conv_params, tflite::Register_CONV_2D(), output_data));
 }
 
+TF_LITE_MICRO_TEST(BlockSparseQuantizedPerChannelPaddingSameMatchesDense) {
+  // 3x3 SAME convolution with a nonzero input zero point, so the padded
+  // border of the gathered patches is exercised. The block size equals the
+  // input depth, so each block is one filter tap. Channel 0 uses the
+  // diagonal taps, channel 1 the edge midpoints.
+  TfLiteConvParams conv_params = {
+      kTfLitePaddingSame, 1, 1, kTfLiteActNone, 1, 1, kTfLiteNoType};
+  const uint16_t block_masks[] = {0x111, 0x0AA};
+  tflite::testing::TestConvBlockSparseMatchesDense(&conv_params, 3, 3, 4, 2, 4,
+                                                   block_masks);
+}
+
+TF_LITE_MICRO_TEST(BlockSparseQuantizedPerChannel1x1MatchesDense) {
+  // Unpadded 1x1 convolution: the kernel reads each input pixel in place
+  // instead of gathering it into the scratch buffer.
+  TfLiteConvParams conv_params = {
+      kTfLitePaddingValid, 1, 1, kTfLiteActNone, 1, 1, kTfLiteNoType};
+  const uint16_t block_masks[] = {0x1, 0x2, 0x3, 0x0};
+  tflite::testing::TestConvBlockSparseMatchesDense(&conv_params, 3, 1, 8, 4, 4,
+                                                   block_masks);
+}
+
+TF_LITE_MICRO_TEST(BlockSparseFilterRejectedForInt16) {
+  TfLiteConvParams conv_params = {
+      kTfLitePaddingValid, 1, 1, kTfLiteActNone, 1, 1, kTfLiteNoType};
+  int input_shape[] = {4, 1, 1, 1, 4};
+  int filter_shape[] = {4, 2, 1, 1, 4};
+  int bias_shape[] = {1, 2};
+  int output_shape[] = {4, 1, 1, 1, 2};
+  int16_t input_data[4] = {};
+  int8_t filter_data[4] = {1, 2, 3, 4};
+  int64_t bias_data[2] = {};
+  int16_t output_data[2];
+  TfLiteTensor tensors[] = {
+      tflite::testing::CreateQuantizedTensor(
+          input_data, tflite::testing::IntArrayFromInts(input_shape), 1.0f, 0),
+      tflite::testing::CreateQuantizedTensor(
+          filter_data, tflite::testing::IntArrayFromInts(filter_shape), 1.0f,
+          0),
+      tflite::testing::CreateTensor(
+          bias_data, tflite::testing::IntArrayFromInts(bias_shape)),
+      tflite::testing::CreateQuantizedTensor(
+          output_data, tflite::testing::IntArrayFromInts(output_shape), 1.0f,
+          0)};
+
+  // One present block out of two.
+  const uint8_t block_mask[] = {0x1};
+  tflite::BlockSparseTensorData sparsity = {block_mask, 2, 4, 4, 1, 1};
+  const tflite::BlockSparseTensorData* sparse_tensors[] = {nullptr, &sparsity,
+                                                           nullptr, nullptr};
+  tflite::BlockSparseTensorList sparse_list = {sparse_tensors};
+  TF_LITE_MICRO_EXPECT_NE(kTfLiteOk,
+                          tflite::testing::InvokeConvBlockSparse(
+                              tensors, &conv_params, &sparse_list));
+}
+
+TF_LITE_MICRO_TEST(OfflineRequantizationMatchesComputed) {
+  tflite::testing::TestConvOfflineRequantization(/*zero_multipliers=*/false);
+}
+
+TF_LITE_MICRO_TEST(OfflineRequantizationTablesAreUsed) {
+  tflite::testing::TestConvOfflineRequantization(/*zero_multipliers=*/true);
+}
+
 TF_LITE_MICRO_TEST(Kernel1x1QuantizedPerChannelRelu6) {
   // conv params:
   // padding, stride_<width,height>, activation, dilation_<width, height>
@@ -385,6 +385,99 @@ void TestDepthwiseConvFloat(
 
 #endif  // !defined(XTENSA)
 
+
+// Runs an int8 depthwise convolution reading zeroed multipliers from offline
+// requantization tables instead of computing them in Prepare(), so every
+// output is the output zero point.
+void TestDepthwiseConvOfflineRequantizationIsUsed() {
+  constexpr int kChannels = 2;
+  int input_shape[] = {4, 1, 3, 2, 2};
+  const float input_values[] = {1, 2, 7, 8, 3, 4, 9, 10, 5, 6, 11, 12};
+  int filter_shape[] = {4, 1, 2, 2, kChannels};
+  const float filter_values[] = {1, 2, 3, 4, -9, 10, -11, 12};
+  int bias_shape[] = {4, 1, 1, 1, kChannels};
+  const float bias_values[] = {1, 2};
+  int output_shape[] = {4, 1, 2, 1, kChannels};
+  constexpr int kOutputElements = 4;
+
+  const float input_scale = 0.5f;
+  const int input_zero_point = 0;
+  const float output_scale = 1.0f;
+  const int output_zero_point = -3;
+
+  int8_t input_quantized[12];
+  int8_t filter_quantized[8];
+  int32_t bias_quantized[kChannels];
+  int8_t output_data[kOutputElements];
+  int filter_zero_points[kChannels + 1];
+  float filter_scales[kChannels + 1];
+  int bias_zero_points[kChannels + 1];
+  float bias_scales[kChannels + 1];
+  TfLiteAffineQuantization filter_quant;
+  TfLiteAffineQuantization bias_quant;
+
+  TfLiteTensor input_tensor = CreateQuantizedTensor(
+      input_values, input_quantized, IntArrayFromInts(input_shape),
+      input_scale, input_zero_point);
+  float input_scales[] = {1, input_scale};
+  int input_zero_points[] = {1, input_zero_point};
+  TfLiteAffineQuantization input_quant = {FloatArrayFromFloats(input_scales),
+                                          IntArrayFromInts(input_zero_points),
+                                          0};
+  input_tensor.quantization = {kTfLiteAffineQuantization, &input_quant};
+
+  TfLiteTensor output_tensor =
+      CreateQuantizedTensor(output_data, IntArrayFromInts(output_shape),
+                            output_scale, output_zero_point);
+  float output_scales[] = {1, output_scale};
+  int output_zero_points[] = {1, output_zero_point};
+  TfLiteAffineQuantization output_quant = {FloatArrayFromFloats(output_scales),
+                                           IntArrayFromInts(output_zero_points),
+                                           0};
+  output_tensor.quantization = {kTfLiteAffineQuantization, &output_quant};
+
+  TfLiteTensor tensors[] = {
+      input_tensor,
+      CreateSymmetricPerChannelQuantizedTensor(
+          filter_values, filter_quantized, IntArrayFromInts(filter_shape),
+          filter_scales, filter_zero_points, &filter_quant,
+          3 /* quantized dimension */),
+      CreatePerChannelQuantizedBiasTensor(
+          bias_values, bias_quantized, IntArrayFromInts(bias_shape),
+          input_scale, &filter_scales[1], bias_scales, bias_zero_points,
+          &bias_quant, 3 /* quantized dimension */),
+      output_tensor,
+  };
+
+  int inputs_array_data[] = {3, 0, 1, 2};
+  int outputs_array_data[] = {1, 3};
+  TfLiteDepthwiseConvParams conv_params = {};
+  conv_params.padding = kTfLitePaddingValid;
+  conv_params.depth_multiplier = 1;
+  conv_params.activation = kTfLiteActNone;
+  conv_params.dilation_width_factor = 1;
+  conv_params.dilation_height_factor = 1;
+  conv_params.stride_height = 1;
+  conv_params.stride_width = 1;
+
+  const int32_t multipliers[kChannels] = {0, 0};
+  const int32_t shifts[kChannels] = {0, 0};
+  const OfflineRequantizationData requantization = {multipliers, shifts};
+
+  const TFLMRegistration registration = Register_DEPTHWISE_CONV_2D();
+  micro::KernelRunner runner(registration, tensors, 4,
+                             IntArrayFromInts(inputs_array_data),
+                             IntArrayFromInts(outputs_array_data),
+                             reinterpret_cast<void*>(&conv_params));
+  runner.SetOfflineRequantization(&requantization, kChannels);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.InitAndPrepare());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.Invoke());
+
+  for (int e = 0; e < kOutputElements; ++e) {
+    TF_LITE_MICRO_EXPECT_EQ(output_zero_point, output_data[e]);
+  }
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace tflite
@@ -545,6 +638,10 @@ TF_LITE_MICRO_TEST(SimpleTestQuantizedPerChannelDepthMultiplier1) {
       output_scale, output_zero_point, &conv_params);
 }
 
+TF_LITE_MICRO_TEST(OfflineRequantizationTablesAreUsed) {
+  tflite::testing::TestDepthwiseConvOfflineRequantizationIsUsed();
+}
+
 TF_LITE_MICRO_TEST(TestQuantizedPerChannelDepthMultiplier1Relu6) {
   const int input_elements = 24;
   int input_shape[] = {4, 1, 3, 2, 4};
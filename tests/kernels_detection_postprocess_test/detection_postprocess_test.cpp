@@ -13,6 +13,8 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <algorithm>
+
 #include "flatbuffers/flexbuffers.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
@@ -159,6 +161,137 @@ void TestDetectionPostprocess(int* input_dims_data1, const float* input_data1,
     TF_LITE_MICRO_EXPECT_NEAR(golden4[i], output_data4[i], tolerance);
   }
 }
+
+constexpr int kMaxBoxes = 8;
+constexpr int kMaxDetections = 3;
+
+// Builds the custom options of the op for two classes without background,
+// up to three detections of one class each, a score threshold of 0 and an
+// IoU threshold of 0.5. The box scales make all-zero box encodings decode
+// to the anchors themselves. Returns the size written to `buffer`.
+int BuildDetectionOptions(bool use_regular_nms, int detections_per_class,
+                          unsigned char* buffer, int buffer_size) {
+  flexbuffers::Builder fbb;
+  fbb.Map([&]() {
+    fbb.Int("max_detections", kMaxDetections);
+    fbb.Int("max_classes_per_detection", 1);
+    fbb.Int("detections_per_class", detections_per_class);
+    fbb.Bool("use_regular_nms", use_regular_nms);
+    fbb.Float("nms_score_threshold", 0.0f);
+    fbb.Float("nms_iou_threshold", 0.5f);
+    fbb.Int("num_classes", 2);
+    fbb.Float("y_scale", 10.0f);
+    fbb.Float("x_scale", 10.0f);
+    fbb.Float("h_scale", 5.0f);
+    fbb.Float("w_scale", 5.0f);
+  });
+  fbb.Finish();
+  const std::vector<uint8_t>& options = fbb.GetBuffer();
+  const int size = static_cast<int>(options.size());
+  TF_LITE_MICRO_EXPECT_LE(size, buffer_size);
+  std::copy(options.begin(), options.begin() + std::min(size, buffer_size),
+            buffer);
+  return size;
+}
+
+// Runs the op on `num_boxes` anchors given as (ycenter, xcenter, h, w) with
+// zero box encodings, so every decoded box equals its anchor. `scores` holds
+// two class scores per anchor. Outputs that the op leaves unset stay zero.
+void RunDetectionPostprocess(int num_boxes, const float* anchors,
+                             const float* scores, bool use_regular_nms,
+                             int detections_per_class, float* output_boxes,
+                             float* output_classes, float* output_scores,
+                             float* num_detections) {
+  TF_LITE_MICRO_EXPECT_LE(num_boxes, kMaxBoxes);
+  const float box_encodings[kMaxBoxes * 4] = {};
+  int box_encodings_dims[] = {3, 1, num_boxes, 4};
+  int scores_dims[] = {3, 1, num_boxes, 2};
+  int anchors_dims[] = {2, num_boxes, 4};
+  int output_boxes_dims[] = {3, 1, kMaxDetections, 4};
+  int output_classes_dims[] = {2, 1, kMaxDetections};
+  int output_scores_dims[] = {2, 1, kMaxDetections};
+  int num_detections_dims[] = {1, 1};
+  std::fill(output_boxes, output_boxes + kMaxDetections * 4, 0.0f);
+  std::fill(output_classes, output_classes + kMaxDetections, 0.0f);
+  std::fill(output_scores, output_scores + kMaxDetections, 0.0f);
+  num_detections[0] = 0.0f;
+
+  constexpr int tensors_size = 7;
+  TfLiteTensor tensors[tensors_size] = {
+      CreateTensor(box_encodings, IntArrayFromInts(box_encodings_dims)),
+      CreateTensor(scores, IntArrayFromInts(scores_dims)),
+      CreateTensor(anchors, IntArrayFromInts(anchors_dims)),
+      CreateTensor(output_boxes, IntArrayFromInts(output_boxes_dims)),
+      CreateTensor(output_classes, IntArrayFromInts(output_classes_dims)),
+      CreateTensor(output_scores, IntArrayFromInts(output_scores_dims)),
+      CreateTensor(num_detections, IntArrayFromInts(num_detections_dims)),
+  };
+
+  MicroMutableOpResolver<1> resolver;
+  TF_LITE_MICRO_EXPECT_EQ(resolver.AddDetectionPostprocess(), kTfLiteOk);
+  const TFLMRegistration* registration =
+      resolver.FindOp("TFLite_Detection_PostProcess");
+  TF_LITE_MICRO_EXPECT(registration != nullptr);
+
+  int inputs_array_data[] = {3, 0, 1, 2};
+  int outputs_array_data[] = {4, 3, 4, 5, 6};
+  micro::KernelRunner runner(*registration, tensors, tensors_size,
+                             IntArrayFromInts(inputs_array_data),
+                             IntArrayFromInts(outputs_array_data), nullptr);
+
+  alignas(8) unsigned char options[512];
+  const int options_size = BuildDetectionOptions(
+      use_regular_nms, detections_per_class, options, sizeof(options));
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, runner.InitAndPrepare(reinterpret_cast<const char*>(options),
+                                       options_size));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.Invoke());
+}
+
+void ExpectDetections(const float* output_boxes, const float* output_classes,
+                      const float* output_scores, const float* num_detections,
+                      const float* golden_boxes, const float* golden_classes,
+                      const float* golden_scores, float golden_num_detections) {
+  constexpr float kTolerance = 1e-5f;
+  for (int i = 0; i < kMaxDetections * 4; ++i) {
+    TF_LITE_MICRO_EXPECT_NEAR(golden_boxes[i], output_boxes[i],
+                              kTolerance * (1.0f + std::abs(golden_boxes[i])));
+  }
+  for (int i = 0; i < kMaxDetections; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(golden_classes[i], output_classes[i]);
+    TF_LITE_MICRO_EXPECT_NEAR(golden_scores[i], output_scores[i], kTolerance);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(golden_num_detections, num_detections[0]);
+}
+
+// Only class 0 has scores at or above the threshold, so fast and regular
+// NMS must select the same boxes. Runs both and checks them against the same
+// golden outputs.
+void TestSingleClassDetections(int num_boxes, const float* anchors,
+                               const float* class_scores,
+                               const float* golden_boxes,
+                               const float* golden_scores,
+                               float golden_num_detections) {
+  float scores[kMaxBoxes * 2];
+  for (int box = 0; box < num_boxes; ++box) {
+    scores[box * 2] = class_scores[box];
+    scores[box * 2 + 1] = -1.0f;
+  }
+  const float golden_classes[kMaxDetections] = {};
+  float output_boxes[kMaxDetections * 4];
+  float output_classes[kMaxDetections];
+  float output_scores[kMaxDetections];
+  float num_detections[1];
+  for (int regular = 0; regular < 2; ++regular) {
+    RunDetectionPostprocess(num_boxes, anchors, scores, regular == 1,
+                            /*detections_per_class=*/kMaxDetections,
+                            output_boxes, output_classes, output_scores,
+                            num_detections);
+    ExpectDetections(output_boxes, output_classes, output_scores,
+                     num_detections, golden_boxes, golden_classes,
+                     golden_scores, golden_num_detections);
+  }
+}
 }  // namespace
 }  // namespace testing
 }  // namespace tflite
@@ -340,4 +473,97 @@ TF_LITE_MICRO_TEST(
       /* tolerance */ 3e-1, /* Use regular NMS: */ false);
 }
 
+TF_LITE_MICRO_TEST(DetectionPostprocessOutlierAnchorKeepsSuppression) {
+  // A far away box must not change how the overlap of the others is judged:
+  // box #2 overlaps box #1 with an IoU of 0.82 and is suppressed.
+  const float anchors[] = {
+      0.5, 0.5,       1.0, 1.0,  // [0, 0, 1, 1]
+      0.5, 0.6,       1.0, 1.0,  // [0, 0.1, 1, 1.1]
+      0.5, 1000000.0, 1.0, 1.0,  // [0, 999999.5, 1, 1000000.5]
+  };
+  const float class_scores[] = {.9, .8, .7};
+  const float golden_boxes[] = {0.0, 0.0,      1.0, 1.0,       //
+                                0.0, 999999.5, 1.0, 1000000.5,  //
+                                0.0, 0.0,      0.0, 0.0};
+  const float golden_scores[] = {.9, .7, 0.0};
+  tflite::testing::TestSingleClassDetections(3, anchors, class_scores,
+                                             golden_boxes, golden_scores, 2.0);
+}
+
+TF_LITE_MICRO_TEST(DetectionPostprocessTiedScoresPreferLowerIndex) {
+  // Box #2 ties with box #1 and overlaps it, so it is the one suppressed.
+  const float anchors[] = {
+      0.5, 0.5,  1.0, 1.0,  // [0, 0, 1, 1]
+      0.5, 0.6,  1.0, 1.0,  // [0, 0.1, 1, 1.1]
+      0.5, 10.5, 1.0, 1.0,  // [0, 10, 1, 11]
+      0.5, 20.5, 1.0, 1.0,  // [0, 20, 1, 21]
+  };
+  const float class_scores[] = {.5, .5, .5, .5};
+  const float golden_boxes[] = {0.0, 0.0,  1.0, 1.0,   //
+                                0.0, 10.0, 1.0, 11.0,  //
+                                0.0, 20.0, 1.0, 21.0};
+  const float golden_scores[] = {.5, .5, .5};
+  tflite::testing::TestSingleClassDetections(4, anchors, class_scores,
+                                             golden_boxes, golden_scores, 3.0);
+}
+
+TF_LITE_MICRO_TEST(DetectionPostprocessTinyBoxesInsideLargeBox) {
+  // The unit boxes overlap the large box by far less than the threshold, but
+  // the two unit boxes in the same corner overlap each other.
+  const float anchors[] = {
+      50.0, 50.0, 100.0, 100.0,  // [0, 0, 100, 100]
+      0.5,  0.5,  1.0,   1.0,    // [0, 0, 1, 1]
+      0.5,  0.6,  1.0,   1.0,    // [0, 0.1, 1, 1.1]
+      99.5, 99.5, 1.0,   1.0,    // [99, 99, 100, 100]
+  };
+  const float class_scores[] = {.9, .8, .7, .6};
+  const float golden_boxes[] = {0.0,  0.0,  100.0, 100.0,  //
+                                0.0,  0.0,  1.0,   1.0,    //
+                                99.0, 99.0, 100.0, 100.0};
+  const float golden_scores[] = {.9, .8, .6};
+  tflite::testing::TestSingleClassDetections(4, anchors, class_scores,
+                                             golden_boxes, golden_scores, 3.0);
+}
+
+TF_LITE_MICRO_TEST(DetectionPostprocessSkipsAnchorsBelowScoreThreshold) {
+  // Anchors #1 and #3 have no class score at or above the threshold of 0, so
+  // they are never decoded or considered, although anchor #1 would overlap
+  // anchor #2.
+  const float anchors[] = {
+      0.5, 0.5,  1.0, 1.0,  // [0, 0, 1, 1]
+      0.5, 0.6,  1.0, 1.0,  // [0, 0.1, 1, 1.1]
+      0.5, 5.5,  1.0, 1.0,  // [0, 5, 1, 6]
+      0.5, 10.5, 1.0, 1.0,  // [0, 10, 1, 11]
+  };
+  const float scores[] = {-.5, -.2, .6, .1, -.1, -.3, .2, .7};
+  const float golden_boxes[] = {0.0, 10.0, 1.0, 11.0,  //
+                                0.0, 0.1,  1.0, 1.1,   //
+                                0.0, 0.0,  0.0, 0.0};
+  const float golden_classes[] = {1.0, 0.0, 0.0};
+  const float golden_scores[] = {.7, .6, 0.0};
+
+  float output_boxes[12];
+  float output_classes[3];
+  float output_scores[3];
+  float num_detections[1];
+  // Fast NMS ranks anchor #4 by its class 1 score.
+  tflite::testing::RunDetectionPostprocess(
+      4, anchors, scores, /*use_regular_nms=*/false,
+      /*detections_per_class=*/1, output_boxes, output_classes, output_scores,
+      num_detections);
+  tflite::testing::ExpectDetections(output_boxes, output_classes,
+                                    output_scores, num_detections,
+                                    golden_boxes, golden_classes,
+                                    golden_scores, 2.0);
+  // Regular NMS keeps anchor #2 for class 0 and anchor #4 for class 1.
+  tflite::testing::RunDetectionPostprocess(
+      4, anchors, scores, /*use_regular_nms=*/true,
+      /*detections_per_class=*/1, output_boxes, output_classes, output_scores,
+      num_detections);
+  tflite::testing::ExpectDetections(output_boxes, output_classes,
+                                    output_scores, num_detections,
+                                    golden_boxes, golden_classes,
+                                    golden_scores, 2.0);
+}
+
 TF_LITE_MICRO_TESTS_END
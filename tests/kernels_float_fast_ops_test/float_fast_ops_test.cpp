@@ -0,0 +1,345 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/float_fast_ops.h"
+
+#include <cmath>
+#include <limits>
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/reference/add.h"
+#include "tensorflow/lite/kernels/internal/reference/conv.h"
+#include "tensorflow/lite/kernels/internal/reference/depthwiseconv_float.h"
+#include "tensorflow/lite/kernels/internal/reference/fully_connected.h"
+#include "tensorflow/lite/kernels/internal/reference/mul.h"
+#include "tensorflow/lite/micro/kernels/add.h"
+#include "tensorflow/lite/micro/kernels/kernel_runner.h"
+#include "tensorflow/lite/micro/kernels/mul.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace tflite {
+namespace testing {
+namespace {
+
+constexpr int kMaxElements = 256;
+
+// The fast kernels may fuse multiply-adds and sum in a different order than
+// the reference kernels, so results agree only up to rounding.
+constexpr float kRelativeTolerance = 1e-4f;
+
+void FillData(float* data, int count, int seed) {
+  for (int i = 0; i < count; ++i) {
+    data[i] = ((i * seed + 3) % 23 - 11) * 0.1f;
+  }
+}
+
+void ExpectNearReference(const float* expected, const float* actual,
+                         int count) {
+  for (int i = 0; i < count; ++i) {
+    const float tolerance =
+        kRelativeTolerance * (1.0f + std::fabs(expected[i]));
+    TF_LITE_MICRO_EXPECT_NEAR(expected[i], actual[i], tolerance);
+  }
+}
+
+void SetActivationRange(float min, float max, float* activation_min,
+                        float* activation_max) {
+  *activation_min = min;
+  *activation_max = max;
+}
+
+void TestFullyConnected(int batches, int accum_depth, int output_depth) {
+  float input[kMaxElements];
+  float weights[kMaxElements];
+  float bias[kMaxElements];
+  float expected[kMaxElements];
+  float actual[kMaxElements];
+  FillData(input, batches * accum_depth, 7);
+  FillData(weights, output_depth * accum_depth, 5);
+  FillData(bias, output_depth, 3);
+
+  const int input_dims[] = {batches, accum_depth};
+  const int weights_dims[] = {output_depth, accum_depth};
+  const int output_dims[] = {batches, output_depth};
+  const RuntimeShape input_shape(2, input_dims);
+  const RuntimeShape weights_shape(2, weights_dims);
+  const RuntimeShape bias_shape(1, &output_depth);
+  const RuntimeShape output_shape(2, output_dims);
+  FullyConnectedParams params = {};
+  SetActivationRange(std::numeric_limits<float>::lowest(),
+                     std::numeric_limits<float>::max(),
+                     &params.float_activation_min,
+                     &params.float_activation_max);
+
+  reference_ops::FullyConnected(params, input_shape, input, weights_shape,
+                                weights, bias_shape, bias, output_shape,
+                                expected);
+  float_ops::FullyConnected(params, input_shape, input, weights_shape, weights,
+                            bias_shape, bias, output_shape, actual);
+  ExpectNearReference(expected, actual, batches * output_depth);
+}
+
+// Square NHWC convolution with one batch.
+struct ConvShape {
+  int input_size;
+  int input_depth;
+  int filter_size;
+  int output_size;
+  int output_depth;
+  int stride;
+  int dilation;
+  int padding;
+};
+
+void TestConv(const ConvShape& shape, float activation_min,
+              float activation_max) {
+  const int input_count = shape.input_size * shape.input_size *
+                          shape.input_depth;
+  const int filter_count = shape.output_depth * shape.filter_size *
+                           shape.filter_size * shape.input_depth;
+  const int output_count = shape.output_size * shape.output_size *
+                           shape.output_depth;
+  float input[kMaxElements];
+  float filter[kMaxElements * 2];
+  float bias[kMaxElements];
+  float expected[kMaxElements];
+  float actual[kMaxElements];
+  TF_LITE_MICRO_EXPECT_LE(input_count, kMaxElements);
+  TF_LITE_MICRO_EXPECT_LE(filter_count, kMaxElements * 2);
+  TF_LITE_MICRO_EXPECT_LE(output_count, kMaxElements);
+  FillData(input, input_count, 7);
+  FillData(filter, filter_count, 5);
+  FillData(bias, shape.output_depth, 3);
+
+  const int input_dims[] = {1, shape.input_size, shape.input_size,
+                            shape.input_depth};
+  const int filter_dims[] = {shape.output_depth, shape.filter_size,
+                             shape.filter_size, shape.input_depth};
+  const int output_dims[] = {1, shape.output_size, shape.output_size,
+                             shape.output_depth};
+  const RuntimeShape input_shape(4, input_dims);
+  const RuntimeShape filter_shape(4, filter_dims);
+  const RuntimeShape bias_shape(1, &shape.output_depth);
+  const RuntimeShape output_shape(4, output_dims);
+  ConvParams params = {};
+  params.padding_values.width = shape.padding;
+  params.padding_values.height = shape.padding;
+  params.stride_width = shape.stride;
+  params.stride_height = shape.stride;
+  params.dilation_width_factor = shape.dilation;
+  params.dilation_height_factor = shape.dilation;
+  SetActivationRange(activation_min, activation_max,
+                     &params.float_activation_min,
+                     &params.float_activation_max);
+
+  reference_ops::Conv(params, input_shape, input, filter_shape, filter,
+                      bias_shape, bias, output_shape, expected, RuntimeShape(),
+                      nullptr);
+  float_ops::Conv(params, input_shape, input, filter_shape, filter,
+                  bias_shape, bias, output_shape, actual);
+  ExpectNearReference(expected, actual, output_count);
+}
+
+void TestDepthwiseConv(const ConvShape& shape, int depth_multiplier) {
+  const int output_depth = shape.input_depth * depth_multiplier;
+  const int input_count = shape.input_size * shape.input_size *
+                          shape.input_depth;
+  const int filter_count = shape.filter_size * shape.filter_size *
+                           output_depth;
+  const int output_count = shape.output_size * shape.output_size *
+                           output_depth;
+  float input[kMaxElements];
+  float filter[kMaxElements];
+  float bias[kMaxElements];
+  float expected[kMaxElements];
+  float actual[kMaxElements];
+  TF_LITE_MICRO_EXPECT_LE(input_count, kMaxElements);
+  TF_LITE_MICRO_EXPECT_LE(filter_count, kMaxElements);
+  TF_LITE_MICRO_EXPECT_LE(output_count, kMaxElements);
+  FillData(input, input_count, 7);
+  FillData(filter, filter_count, 5);
+  FillData(bias, output_depth, 3);
+
+  const int input_dims[] = {1, shape.input_size, shape.input_size,
+                            shape.input_depth};
+  const int filter_dims[] = {1, shape.filter_size, shape.filter_size,
+                             output_depth};
+  const int output_dims[] = {1, shape.output_size, shape.output_size,
+                             output_depth};
+  const RuntimeShape input_shape(4, input_dims);
+  const RuntimeShape filter_shape(4, filter_dims);
+  const RuntimeShape bias_shape(1, &output_depth);
+  const RuntimeShape output_shape(4, output_dims);
+  DepthwiseParams params = {};
+  params.padding_values.width = shape.padding;
+  params.padding_values.height = shape.padding;
+  params.stride_width = shape.stride;
+  params.stride_height = shape.stride;
+  params.dilation_width_factor = shape.dilation;
+  params.dilation_height_factor = shape.dilation;
+  params.depth_multiplier = depth_multiplier;
+  SetActivationRange(std::numeric_limits<float>::lowest(),
+                     std::numeric_limits<float>::max(),
+                     &params.float_activation_min,
+                     &params.float_activation_max);
+
+  reference_ops::DepthwiseConv(params, input_shape, input, filter_shape,
+                               filter, bias_shape, bias, output_shape,
+                               expected);
+  float_ops::DepthwiseConv(params, input_shape, input, filter_shape, filter,
+                           bias_shape, bias, output_shape, actual);
+  ExpectNearReference(expected, actual, output_count);
+}
+
+// Runs the registered float ADD or MUL kernel on inputs of different shapes,
+// which takes the broadcast path, and compares with the reference kernel.
+void TestBroadcastArithmetic(const TFLMRegistration& registration, bool is_add,
+                             int* input1_dims_data, int* input2_dims_data,
+                             int* output_dims_data) {
+  TfLiteIntArray* input1_dims = IntArrayFromInts(input1_dims_data);
+  TfLiteIntArray* input2_dims = IntArrayFromInts(input2_dims_data);
+  TfLiteIntArray* output_dims = IntArrayFromInts(output_dims_data);
+  const int input1_count = ElementCount(*input1_dims);
+  const int input2_count = ElementCount(*input2_dims);
+  const int output_count = ElementCount(*output_dims);
+
+  float input1[kMaxElements];
+  float input2[kMaxElements];
+  float expected[kMaxElements];
+  float actual[kMaxElements];
+  FillData(input1, input1_count, 7);
+  FillData(input2, input2_count, 5);
+
+  TfLiteTensor tensors[] = {
+      CreateTensor(input1, input1_dims),
+      CreateTensor(input2, input2_dims),
+      CreateTensor(actual, output_dims),
+  };
+  int inputs_array_data[] = {2, 0, 1};
+  int outputs_array_data[] = {1, 2};
+  TfLiteAddParams add_params = {};
+  add_params.activation = kTfLiteActNone;
+  TfLiteMulParams mul_params = {};
+  mul_params.activation = kTfLiteActNone;
+  void* builtin_data = is_add ? static_cast<void*>(&add_params)
+                              : static_cast<void*>(&mul_params);
+  micro::KernelRunner runner(registration, tensors, 3,
+                             IntArrayFromInts(inputs_array_data),
+                             IntArrayFromInts(outputs_array_data),
+                             builtin_data);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.InitAndPrepare());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.Invoke());
+
+  ArithmeticParams params = {};
+  SetActivationRange(std::numeric_limits<float>::lowest(),
+                     std::numeric_limits<float>::max(),
+                     &params.float_activation_min,
+                     &params.float_activation_max);
+  const RuntimeShape input1_shape(input1_dims->size, input1_dims->data);
+  const RuntimeShape input2_shape(input2_dims->size, input2_dims->data);
+  const RuntimeShape output_shape(output_dims->size, output_dims->data);
+  if (is_add) {
+    reference_ops::BroadcastAdd4DSlow(params, input1_shape, input1,
+                                      input2_shape, input2, output_shape,
+                                      expected);
+  } else {
+    reference_ops::BroadcastMul4DSlow(params, input1_shape, input1,
+                                      input2_shape, input2, output_shape,
+                                      expected);
+  }
+  ExpectNearReference(expected, actual, output_count);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace tflite
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(FullyConnectedOutputBlockTails) {
+  // Four outputs are computed per block; 5, 6 and 7 leave one to three
+  // outputs for the tail loop.
+  for (int output_depth = 4; output_depth <= 7; ++output_depth) {
+    tflite::testing::TestFullyConnected(/*batches=*/2, /*accum_depth=*/13,
+                                        output_depth);
+  }
+}
+
+TF_LITE_MICRO_TEST(ConvOutputBlockTails) {
+  for (int output_depth = 5; output_depth <= 7; ++output_depth) {
+    const tflite::testing::ConvShape shape = {
+        /*input_size=*/5, /*input_depth=*/3, /*filter_size=*/3,
+        /*output_size=*/5, output_depth,     /*stride=*/1,
+        /*dilation=*/1,     /*padding=*/1};
+    tflite::testing::TestConv(shape, std::numeric_limits<float>::lowest(),
+                              std::numeric_limits<float>::max());
+  }
+}
+
+TF_LITE_MICRO_TEST(ConvDilatedWithActivation) {
+  const tflite::testing::ConvShape shape = {
+      /*input_size=*/7, /*input_depth=*/3, /*filter_size=*/3,
+      /*output_size=*/3, /*output_depth=*/6, /*stride=*/1,
+      /*dilation=*/2,    /*padding=*/0};
+  tflite::testing::TestConv(shape, -1.5f, 1.5f);
+}
+
+TF_LITE_MICRO_TEST(ConvStridedPadded) {
+  const tflite::testing::ConvShape shape = {
+      /*input_size=*/6, /*input_depth=*/4, /*filter_size=*/3,
+      /*output_size=*/3, /*output_depth=*/5, /*stride=*/2,
+      /*dilation=*/1,    /*padding=*/1};
+  tflite::testing::TestConv(shape, std::numeric_limits<float>::lowest(),
+                            std::numeric_limits<float>::max());
+}
+
+TF_LITE_MICRO_TEST(DepthwiseConvDepthMultiplierTwo) {
+  const tflite::testing::ConvShape shape = {
+      /*input_size=*/5, /*input_depth=*/3, /*filter_size=*/3,
+      /*output_size=*/5, /*output_depth=*/6, /*stride=*/1,
+      /*dilation=*/1,    /*padding=*/1};
+  tflite::testing::TestDepthwiseConv(shape, /*depth_multiplier=*/2);
+}
+
+TF_LITE_MICRO_TEST(DepthwiseConvDilatedChannelTail) {
+  // Depth 5 leaves one channel after the unrolled groups of four.
+  const tflite::testing::ConvShape shape = {
+      /*input_size=*/7, /*input_depth=*/5, /*filter_size=*/3,
+      /*output_size=*/3, /*output_depth=*/5, /*stride=*/1,
+      /*dilation=*/2,    /*padding=*/0};
+  tflite::testing::TestDepthwiseConv(shape, /*depth_multiplier=*/1);
+}
+
+TF_LITE_MICRO_TEST(BroadcastAdd) {
+  int input1_dims[] = {4, 1, 2, 3, 4};
+  int input2_dims[] = {4, 1, 1, 1, 4};
+  int output_dims[] = {4, 1, 2, 3, 4};
+  tflite::testing::TestBroadcastArithmetic(tflite::Register_ADD(),
+                                           /*is_add=*/true, input1_dims,
+                                           input2_dims, output_dims);
+}
+
+TF_LITE_MICRO_TEST(BroadcastMul) {
+  int input1_dims[] = {4, 1, 2, 1, 4};
+  int input2_dims[] = {4, 1, 1, 3, 1};
+  int output_dims[] = {4, 1, 2, 3, 4};
+  tflite::testing::TestBroadcastArithmetic(tflite::Register_MUL(),
+                                           /*is_add=*/false, input1_dims,
+                                           input2_dims, output_dims);
+}
+
+TF_LITE_MICRO_TESTS_END
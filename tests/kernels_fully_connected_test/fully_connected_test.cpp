@@ -439,6 +439,85 @@ TfLiteStatus TestFullyConnectedQuantized(
                                        golden_quantized, output_data);
 }
 
+// Block-sparse weights: 3x10 with blocks of 5, stored without the all-zero
+// blocks. Dense equivalent:
+//   u = 0: 1,  2,  3,  4,  5,  0,  0,  0,  0,  0
+//   u = 1: 0,  0,  0,  0,  0, -6, -7, -8, -9, -10
+//   u = 2: 1,  2,  3,  4,  5,  6,  7,  8,  9,  10
+const int8_t block_sparse_packed_weights[] = {
+    1, 2, 3, 4, 5, -6, -7, -8, -9, -10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+};
+// One bit per block, LSB first: blocks 0, 3, 4 and 5 are present.
+const uint8_t block_sparse_mask[] = {0x39};
+const float block_sparse_golden[] = {
+    56, 30, 26, 56, -4, 60,
+};
+
+TfLiteStatus TestFullyConnectedBlockSparseInt8(const float* golden,
+                                               int8_t* golden_quantized,
+                                               int8_t* output_data) {
+  const float input_scale = 1.0f;
+  const int input_zero_point = -1;
+  const float weights_scale = 1.0f;
+  const float output_scale = 0.5f;
+  const int output_zero_point = -1;
+
+  TfLiteIntArray* input_dims = IntArrayFromInts(relu_input_dims);
+  TfLiteIntArray* weights_dims = IntArrayFromInts(relu_weights_dims);
+  TfLiteIntArray* bias_dims = IntArrayFromInts(relu_bias_dims);
+  TfLiteIntArray* output_dims = IntArrayFromInts(relu_output_dims);
+
+  int8_t input_quantized[relu_input_size];
+  int32_t bias_quantized[3];
+  constexpr int tensors_size = 4;
+  TfLiteTensor tensors[tensors_size] = {
+      CreateQuantizedTensor(relu_input_data, input_quantized, input_dims,
+                            input_scale, input_zero_point),
+      CreateQuantizedTensor(block_sparse_packed_weights, weights_dims,
+                            weights_scale, 0),
+      CreateQuantizedBiasTensor(relu_bias_data, bias_quantized, bias_dims,
+                                input_scale, weights_scale),
+      CreateQuantizedTensor(output_data, output_dims, output_scale,
+                            output_zero_point),
+  };
+
+  BlockSparseTensorData sparsity;
+  sparsity.block_mask = block_sparse_mask;
+  sparsity.rows = 3;
+  sparsity.row_depth = 10;
+  sparsity.block_size = 5;
+  sparsity.blocks_per_row = 2;
+  sparsity.nonzero_blocks = 4;
+  const BlockSparseTensorData* sparse_tensors[tensors_size] = {
+      nullptr, &sparsity, nullptr, nullptr};
+  BlockSparseTensorList sparse_list = {sparse_tensors};
+
+  int inputs_array_data[] = {3, 0, 1, 2};
+  TfLiteIntArray* inputs_array = IntArrayFromInts(inputs_array_data);
+  int outputs_array_data[] = {1, 3};
+  TfLiteIntArray* outputs_array = IntArrayFromInts(outputs_array_data);
+
+  TfLiteFullyConnectedParams builtin_data = {
+      kTfLiteActNone, kTfLiteFullyConnectedWeightsFormatDefault, false, false,
+      kTfLiteNoType};
+  const TFLMRegistration registration = Register_FULLY_CONNECTED();
+  micro::KernelRunner runner(registration, tensors, tensors_size, inputs_array,
+                             outputs_array,
+                             reinterpret_cast<void*>(&builtin_data));
+  runner.SetBlockSparseTensors(&sparse_list);
+
+  TF_LITE_ENSURE_STATUS(runner.InitAndPrepare());
+  TF_LITE_ENSURE_STATUS(runner.Invoke());
+
+  const int output_len = ElementCount(*output_dims);
+  Quantize(golden, golden_quantized, output_len, output_scale,
+           output_zero_point);
+  for (int i = 0; i < output_len; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(golden_quantized[i], output_data[i]);
+  }
+  return kTfLiteOk;
+}
+
 #ifdef USE_TFLM_COMPRESSION
 
 template <typename TIO, typename TW, typename TB>
@@ -857,6 +936,56 @@ TF_LITE_MICRO_TEST(Representative1x64Input1x16OutputQuantizedInt8) {
       kTfLiteOk);
 }
 
+TF_LITE_MICRO_TEST(BlockSparseTestQuantizedInt8) {
+  int8_t golden_quantized[tflite::testing::relu_output_size];
+  int8_t output_data[tflite::testing::relu_output_size];
+
+  TF_LITE_MICRO_EXPECT_EQ(
+      tflite::testing::TestFullyConnectedBlockSparseInt8(
+          tflite::testing::block_sparse_golden, golden_quantized, output_data),
+      kTfLiteOk);
+}
+
+TF_LITE_MICRO_TEST(BlockSparseFloatWeightsRejected) {
+  // The float path reads the weights densely, so it must refuse the packed
+  // 3x10 weights instead of reading past them.
+  int weights_dims_data[] = {2, 3, 10};
+  int input_dims_data[] = {2, 2, 10};
+  int output_dims_data[] = {2, 2, 3};
+  float packed_weights[20] = {};
+  float input_data[20] = {};
+  float output_data[6];
+  TfLiteTensor tensors[] = {
+      tflite::testing::CreateTensor(
+          input_data, tflite::testing::IntArrayFromInts(input_dims_data)),
+      tflite::testing::CreateTensor(
+          packed_weights,
+          tflite::testing::IntArrayFromInts(weights_dims_data)),
+      tflite::testing::CreateTensor(
+          output_data, tflite::testing::IntArrayFromInts(output_dims_data)),
+  };
+
+  tflite::BlockSparseTensorData sparsity = {
+      tflite::testing::block_sparse_mask, 3, 10, 5, 2, 4};
+  const tflite::BlockSparseTensorData* sparse_tensors[] = {nullptr, &sparsity,
+                                                           nullptr};
+  tflite::BlockSparseTensorList sparse_list = {sparse_tensors};
+
+  int inputs_array_data[] = {3, 0, 1, kTfLiteOptionalTensor};
+  int outputs_array_data[] = {1, 2};
+  TfLiteFullyConnectedParams builtin_data = {
+      kTfLiteActNone, kTfLiteFullyConnectedWeightsFormatDefault, false, false,
+      kTfLiteNoType};
+  const TFLMRegistration registration = tflite::Register_FULLY_CONNECTED();
+  tflite::micro::KernelRunner runner(
+      registration, tensors, 3,
+      tflite::testing::IntArrayFromInts(inputs_array_data),
+      tflite::testing::IntArrayFromInts(outputs_array_data),
+      reinterpret_cast<void*>(&builtin_data));
+  runner.SetBlockSparseTensors(&sparse_list);
+  TF_LITE_MICRO_EXPECT_NE(kTfLiteOk, runner.InitAndPrepare());
+}
+
 TF_LITE_MICRO_TEST(SimpleTestQuantizedInt8NullBias) {
   const float input_scale = 1.0f;
   const int input_zero_point = -1;
@@ -326,4 +326,60 @@ TF_LITE_MICRO_TEST(ThreeDimensionalResizeInt8) {
       output_dims, output_data, &params, /*tolerance=*/1);
 }
 
+TF_LITE_MICRO_TEST(HalfPixelCentersResizeInt8) {
+  int input_dims[] = {4, 1, 3, 2, 2};
+  const int8_t input_data[] = {
+      -128, -64, 0,   64,   //
+      127,  32,  -16, 8,    //
+      3,    9,   -7,  100,  //
+  };
+  const int32_t expected_size_data[] = {5, 3};
+  const int8_t expected_output_data[] = {
+      -128, -64, -64, 0,   0,   64,   //
+      -26,  -26, -16, 8,   -6,  42,   //
+      127,  32,  55,  20,  -16, 8,    //
+      53,   18,  21,  41,  -11, 63,   //
+      3,    9,   -2,  55,  -7,  100,  //
+  };
+  int output_dims[] = {4, 1, 5, 3, 2};
+  int8_t output_data[30];
+
+  TfLiteResizeBilinearParams params = {
+      false, /*align_corners*/
+      true   /*half pixel centers*/
+  };
+
+  tflite::testing::TestResizeBilinear<int8_t>(
+      input_dims, input_data, expected_size_data, expected_output_data,
+      output_dims, output_data, &params);
+}
+
+TF_LITE_MICRO_TEST(AlignCornersResizeInt8) {
+  int input_dims[] = {4, 1, 3, 2, 2};
+  const int8_t input_data[] = {
+      -128, -64, 0,   64,   //
+      127,  32,  -16, 8,    //
+      3,    9,   -7,  100,  //
+  };
+  const int32_t expected_size_data[] = {5, 3};
+  const int8_t expected_output_data[] = {
+      -128, -64, -64, 0,   0,   64,   //
+      -1,   -16, -4,  10,  -8,  36,   //
+      127,  32,  56,  20,  -16, 8,    //
+      65,   21,  27,  37,  -12, 54,   //
+      3,    9,   -2,  55,  -7,  100,  //
+  };
+  int output_dims[] = {4, 1, 5, 3, 2};
+  int8_t output_data[30];
+
+  TfLiteResizeBilinearParams params = {
+      true, /*align_corners*/
+      false /*half pixel centers*/
+  };
+
+  tflite::testing::TestResizeBilinear<int8_t>(
+      input_dims, input_data, expected_size_data, expected_output_data,
+      output_dims, output_data, &params);
+}
+
 TF_LITE_MICRO_TESTS_END
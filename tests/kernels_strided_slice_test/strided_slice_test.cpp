@@ -1265,4 +1265,161 @@ TF_LITE_MICRO_TEST(OutOfBounds) {
       golden, false, 1, true);
 }
 
+TF_LITE_MICRO_TEST(In4D_FullInnerDimsCopiedInOneRun) {
+  // The slice takes whole rows of the three inner dimensions, which the copy
+  // plan merges into a single memcpy.
+  int input_shape[] = {4, 2, 3, 4, 5};
+  int begin_shape[] = {1, 4};
+  int end_shape[] = {1, 4};
+  int strides_shape[] = {1, 4};
+  int output_shape[] = {4, 1, 3, 4, 5};
+  float input_data[120];
+  for (int n = 0; n < 120; ++n) {
+    input_data[n] = n;
+  }
+  int32_t begin_data[] = {1, 0, 0, 0};
+  int32_t end_data[] = {2, 3, 4, 5};
+  int32_t strides_data[] = {1, 1, 1, 1};
+  float golden[60];
+  for (int n = 0; n < 60; ++n) {
+    golden[n] = 60 + n;
+  }
+  float output_data[60];
+
+  TfLiteStridedSliceParams builtin_data = {};
+
+  tflite::testing::TestStridedSliceFloat(
+      input_shape, begin_shape, end_shape, strides_shape, &builtin_data,
+      input_data, begin_data, end_data, strides_data, output_shape, output_data,
+      golden, false);
+}
+
+TF_LITE_MICRO_TEST(In4D_CroppedInnerDimNotMerged) {
+  // Cropping the innermost dimension leaves runs of 3 elements; the outer
+  // dimensions still merge around them.
+  int input_shape[] = {4, 2, 3, 4, 5};
+  int begin_shape[] = {1, 4};
+  int end_shape[] = {1, 4};
+  int strides_shape[] = {1, 4};
+  int output_shape[] = {4, 2, 3, 4, 3};
+  int8_t input_data[120];
+  for (int n = 0; n < 120; ++n) {
+    input_data[n] = n;
+  }
+  int32_t begin_data[] = {0, 0, 0, 1};
+  int32_t end_data[] = {2, 3, 4, 4};
+  int32_t strides_data[] = {1, 1, 1, 1};
+  int8_t golden[72];
+  for (int row = 0; row < 24; ++row) {
+    for (int col = 0; col < 3; ++col) {
+      golden[row * 3 + col] = row * 5 + col + 1;
+    }
+  }
+  int8_t output_data[72];
+
+  TfLiteStridedSliceParams builtin_data = {};
+
+  tflite::testing::TestStridedSliceQuantized(
+      input_shape, begin_shape, end_shape, strides_shape, &builtin_data,
+      input_data, begin_data, end_data, strides_data, output_shape, output_data,
+      golden, false);
+}
+
+TF_LITE_MICRO_TEST(In3D_ReversedInnerDimWithShrink) {
+  // Shrinks axis 0 to its second entry and reverses the innermost axis, so
+  // the plan steps backwards through the source one element at a time.
+  int input_shape[] = {3, 2, 3, 4};
+  int begin_shape[] = {1, 3};
+  int end_shape[] = {1, 3};
+  int strides_shape[] = {1, 3};
+  int output_shape[] = {2, 3, 4};
+  float input_data[24];
+  for (int n = 0; n < 24; ++n) {
+    input_data[n] = n;
+  }
+  int32_t begin_data[] = {1, 0, 3};
+  int32_t end_data[] = {2, 3, 0};
+  int32_t strides_data[] = {1, 1, -1};
+  float golden[12];
+  for (int row = 0; row < 3; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      golden[row * 4 + col] = 12 + row * 4 + (3 - col);
+    }
+  }
+  float output_data[12];
+
+  TfLiteStridedSliceParams builtin_data = {};
+  builtin_data.end_mask = 4;
+  builtin_data.shrink_axis_mask = 1;
+
+  tflite::testing::TestStridedSliceFloat(
+      input_shape, begin_shape, end_shape, strides_shape, &builtin_data,
+      input_data, begin_data, end_data, strides_data, output_shape, output_data,
+      golden, false);
+}
+
+TF_LITE_MICRO_TEST(In3D_ReversedOuterDimCopiesInnerRuns) {
+  // Reverses the outermost axis only: the two inner axes merge into a run of
+  // 8 elements and the plan walks the runs with a negative stride.
+  int input_shape[] = {3, 3, 2, 4};
+  int begin_shape[] = {1, 3};
+  int end_shape[] = {1, 3};
+  int strides_shape[] = {1, 3};
+  int output_shape[] = {3, 3, 2, 4};
+  int8_t input_data[24];
+  for (int n = 0; n < 24; ++n) {
+    input_data[n] = n;
+  }
+  int32_t begin_data[] = {2, 0, 0};
+  int32_t end_data[] = {0, 2, 4};
+  int32_t strides_data[] = {-1, 1, 1};
+  int8_t golden[24];
+  for (int block = 0; block < 3; ++block) {
+    for (int n = 0; n < 8; ++n) {
+      golden[block * 8 + n] = (2 - block) * 8 + n;
+    }
+  }
+  int8_t output_data[24];
+
+  TfLiteStridedSliceParams builtin_data = {};
+  builtin_data.end_mask = 1;
+
+  tflite::testing::TestStridedSliceQuantized(
+      input_shape, begin_shape, end_shape, strides_shape, &builtin_data,
+      input_data, begin_data, end_data, strides_data, output_shape, output_data,
+      golden, false);
+}
+
+TF_LITE_MICRO_TEST(In3D_BeginMaskWithStrideTwo) {
+  // Every other row with begin_mask: rows are 3 elements apart in the
+  // output but 6 apart in the source, so they stay separate runs.
+  int input_shape[] = {3, 2, 4, 3};
+  int begin_shape[] = {1, 3};
+  int end_shape[] = {1, 3};
+  int strides_shape[] = {1, 3};
+  int output_shape[] = {3, 2, 2, 3};
+  float input_data[24];
+  for (int n = 0; n < 24; ++n) {
+    input_data[n] = n;
+  }
+  int32_t begin_data[] = {0, 3, 0};
+  int32_t end_data[] = {2, 4, 3};
+  int32_t strides_data[] = {1, 2, 1};
+  float golden[12];
+  for (int row = 0; row < 4; ++row) {
+    for (int col = 0; col < 3; ++col) {
+      golden[row * 3 + col] = row * 6 + col;
+    }
+  }
+  float output_data[12];
+
+  TfLiteStridedSliceParams builtin_data = {};
+  builtin_data.begin_mask = 2;
+
+  tflite::testing::TestStridedSliceFloat(
+      input_shape, begin_shape, end_shape, strides_shape, &builtin_data,
+      input_data, begin_data, end_data, strides_data, output_shape, output_data,
+      golden, false);
+}
+
 TF_LITE_MICRO_TESTS_END
@@ -100,7 +100,7 @@ TfLiteStatus ValidateTranspose(TfLiteTensor* tensors, int tensors_size,
 template <typename T>
 void TestTranspose(int* input_dims_data, T* input_data, int* output_dims_data,
                    const T* expected_output_data, T* output_data,
-                   TransposeParams* params) {
+                   TransposeParams* params, bool constant_perm = false) {
   TfLiteIntArray* input_dims = IntArrayFromInts(input_dims_data);
   TfLiteIntArray* output_dims = IntArrayFromInts(output_dims_data);
   const int input_size = ElementCount(*input_dims);
@@ -123,6 +123,10 @@ void TestTranspose(int* input_dims_data, T* input_data, int* output_dims_data,
       CreateTensor(params->perm, perm_dims),
       CreateTensor(output_data, output_dims),
   };
+  if (constant_perm) {
+    // The kernel then builds its copy plan once, at Prepare.
+    tensors[1].allocation_type = kTfLiteMmapRo;
+  }
 
   TF_LITE_MICRO_EXPECT_EQ(
       kTfLiteOk, ValidateTranspose(tensors, tensors_size, expected_output_data,
@@ -610,4 +614,85 @@ TF_LITE_MICRO_TEST(Complex5DTestWithReorder) {
                                  expected_output_data, output_data, &params);
 }
 
+TF_LITE_MICRO_TEST(Int8TransposeSpanningSeveralTiles) {
+  // 20x18 is not a multiple of the transpose tile edge, so both partial row
+  // and partial column tiles are exercised.
+  int input_dims_data[] = {3, 1, 20, 18};
+  int output_dims_data[] = {3, 1, 18, 20};
+  const int32_t shape[] = {1, 20, 18};
+
+  int8_t input_data[360];
+  int8_t output_data[360];
+  int8_t expected_output_data[360];
+
+  tflite::TransposeParams params = {3, {0, 2, 1}};
+
+  tflite::testing::RunTestPermutation<int8_t>(
+      3, shape, params.perm, input_data, expected_output_data);
+  tflite::testing::TestTranspose(input_dims_data, input_data, output_dims_data,
+                                 expected_output_data, output_data, &params);
+}
+
+TF_LITE_MICRO_TEST(Int8TransposeWithConstantPerm) {
+  int input_dims_data[] = {4, 2, 3, 4, 5};
+  int output_dims_data[] = {4, 5, 2, 4, 3};
+  const int32_t shape[] = {2, 3, 4, 5};
+
+  int8_t input_data[120];
+  int8_t output_data[120];
+  int8_t expected_output_data[120];
+
+  tflite::TransposeParams params = {4, {3, 0, 2, 1}};
+
+  tflite::testing::RunTestPermutation<int8_t>(
+      4, shape, params.perm, input_data, expected_output_data);
+  tflite::testing::TestTranspose(input_dims_data, input_data, output_dims_data,
+                                 expected_output_data, output_data, &params,
+                                 /*constant_perm=*/true);
+}
+
+TF_LITE_MICRO_TEST(PermChangedBetweenInvocations) {
+  int input_dims_data[] = {2, 2, 3};
+  int output_dims_data[] = {2, 2, 3};
+  int perm_dims_data[] = {1, 2};
+  TfLiteIntArray* input_dims =
+      tflite::testing::IntArrayFromInts(input_dims_data);
+  TfLiteIntArray* output_dims =
+      tflite::testing::IntArrayFromInts(output_dims_data);
+  TfLiteIntArray* perm_dims = tflite::testing::IntArrayFromInts(perm_dims_data);
+
+  const float input_data[] = {0, 1, 2, 3, 4, 5};
+  int32_t perm_data[] = {0, 1};
+  float output_data[6];
+  TfLiteTensor tensors[] = {
+      tflite::testing::CreateTensor(input_data, input_dims),
+      tflite::testing::CreateTensor(perm_data, perm_dims),
+      tflite::testing::CreateTensor(output_data, output_dims),
+  };
+
+  int inputs_array_data[] = {2, 0, 1};
+  int outputs_array_data[] = {1, 2};
+  const TFLMRegistration registration = tflite::Register_TRANSPOSE();
+  tflite::micro::KernelRunner runner(
+      registration, tensors, 3,
+      tflite::testing::IntArrayFromInts(inputs_array_data),
+      tflite::testing::IntArrayFromInts(outputs_array_data),
+      /*builtin_data=*/nullptr);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.InitAndPrepare());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.Invoke());
+  for (int n = 0; n < 6; ++n) {
+    TF_LITE_MICRO_EXPECT_EQ(input_data[n], output_data[n]);
+  }
+
+  // perm is not constant, so the kernel must follow it on every Invoke. The
+  // output shape is left alone, only the element order is checked.
+  perm_data[0] = 1;
+  perm_data[1] = 0;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.Invoke());
+  const float expected_output_data[] = {0, 3, 1, 4, 2, 5};
+  for (int n = 0; n < 6; ++n) {
+    TF_LITE_MICRO_EXPECT_EQ(expected_output_data[n], output_data[n]);
+  }
+}
+
 TF_LITE_MICRO_TESTS_END
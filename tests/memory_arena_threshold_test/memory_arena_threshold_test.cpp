@@ -57,21 +57,21 @@ constexpr int kKeywordModelNodeAndRegistrationCount = 15;
 // Total size contributed by the keyword model excluding the
 // RecordingMicroAllocator's overhead
 // TODO(b/207157610): replace magic number that depends on OPs
-constexpr int kKeywordModelOnlyTotalSize = 14472;
+constexpr int kKeywordModelOnlyTotalSize = 14856;
 // Tail size contributed by the kdyword model excluding the
 // RecordingMicroAllocator's overhead
 // TODO(b/207157610): replace magic number that depends on OPs
-constexpr int kKeywordModelOnlyTailSize = 13800;
+constexpr int kKeywordModelOnlyTailSize = 14184;
 constexpr int kKeywordModelPersistentTfLiteTensorDataSize = 128;
 #else
 // Total size contributed by the keyword model excluding the
 // RecordingMicroAllocator's overhead.
 // TODO(b/207157610): replace magic number that depends on OPs
-constexpr int kKeywordModelOnlyTotalSize = 14936;
+constexpr int kKeywordModelOnlyTotalSize = 15320;
 // Tail size contributed by the keyword model excluding the
 // RecordingMicroAllocator's overhead
 // TODO(b/207157610): replace magic number that depends on OPs
-constexpr int kKeywordModelOnlyTailSize = 14264;
+constexpr int kKeywordModelOnlyTailSize = 14648;
 constexpr int kKeywordModelPersistentTfLiteTensorDataSize = 224;
 #endif
 constexpr int kKeywordModelHeadSize = 672;
@@ -85,38 +85,54 @@ uint8_t test_conv_tensor_arena[kTestConvModelArenaSize];
 constexpr int kTestConvModelTensorCount = 15;
 constexpr int kTestConvModelNodeAndRegistrationCount = 7;
 
+// The persistent buffers include the interpreter's invoke plan, one step per
+// operator.
 #if defined(USE_TFLM_COMPRESSION)
-constexpr int kKeywordModelPersistentBufferDataSize = 920;
+constexpr int kKeywordModelPersistentBufferDataSize = 1304;
+#elif defined(CMSIS_NN)
+// The CMSIS-NN kernels keep more state per op than the reference kernels.
+constexpr int kKeywordModelPersistentBufferDataSize = 1472;
 #else
-constexpr int kKeywordModelPersistentBufferDataSize = 840;
+constexpr int kKeywordModelPersistentBufferDataSize = 1224;
 #endif
 
 // NOTE: These values are measured on x86-64:
 // TODO(b/158651472): Consider auditing these values on non-64 bit systems.
-#ifdef TF_LITE_STATIC_MEMORY
+#if defined(TF_LITE_STATIC_MEMORY) && defined(CMSIS_NN)
+// The CMSIS-NN CONV_2D kernel keeps more state per op and requests an im2col
+// scratch buffer, which the head holds.
+constexpr int kTestConvModelOnlyTotalSize = 10456;
+constexpr int kTestConvModelOnlyTailSize = 2136;
+constexpr int kTestConvModelPersistentTfLiteTensorDataSize = 128;
+constexpr int kTestConvModelPersistentBufferDataSize = 1036;
+#elif defined(TF_LITE_STATIC_MEMORY)
 // Total size contributed by the conv model excluding the
 // RecordingMicroAllocator's overhead
 // TODO(b/207157610): replace magic number that depends on OPs
-constexpr int kTestConvModelOnlyTotalSize = 9576;
+constexpr int kTestConvModelOnlyTotalSize = 9768;
 // Tail size contributed by the conv model excluding the
 // RecordingMicroAllocator's overhead
 // TODO(b/207157610): replace magic number that depends on OPs
-constexpr int kTestConvModelOnlyTailSize = 1832;
+constexpr int kTestConvModelOnlyTailSize = 2024;
 constexpr int kTestConvModelPersistentTfLiteTensorDataSize = 128;
-constexpr int kTestConvModelPersistentBufferDataSize = 748;
+constexpr int kTestConvModelPersistentBufferDataSize = 940;
 #else
 // Total size contributed by the conv model excluding the
 // RecordingMicroAllocator's overhead
 // TODO(b/207157610): replace magic number that depends on OPs
-constexpr int kTestConvModelOnlyTotalSize = 9832;
+constexpr int kTestConvModelOnlyTotalSize = 10024;
 // Tail size contributed by the conv model excluding the
 // RecordingMicroAllocator's overhead
 // TODO(b/207157610): replace magic number that depends on OPs
-constexpr int kTestConvModelOnlyTailSize = 2088;
+constexpr int kTestConvModelOnlyTailSize = 2280;
 constexpr int kTestConvModelPersistentTfLiteTensorDataSize = 224;
-constexpr int kTestConvModelPersistentBufferDataSize = 740;
+constexpr int kTestConvModelPersistentBufferDataSize = 932;
 #endif
+#if defined(CMSIS_NN)
+constexpr int kTestConvModelHeadSize = 8320;
+#else
 constexpr int kTestConvModelHeadSize = 7744;
+#endif
 constexpr int kTestConvModelOpRuntimeDataSize = 136;
 constexpr int kTestConvModelPersistentTfLiteTensorQuantizationData = 0;
 
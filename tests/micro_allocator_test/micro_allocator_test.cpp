@@ -19,12 +19,14 @@ limitations under the License.
 
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/micro/arena_allocator/single_arena_buffer_allocator.h"
+#include "tensorflow/lite/micro/block_sparsity.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/memory_helpers.h"
 #include "tensorflow/lite/micro/memory_planner/greedy_memory_planner.h"
 #include "tensorflow/lite/micro/memory_planner/non_persistent_buffer_planner_shim.h"
 #include "tensorflow/lite/micro/micro_allocator.h"
 #include "tensorflow/lite/micro/micro_arena_constants.h"
+#include "tensorflow/lite/micro/micro_model_verifier.h"
 #include "tensorflow/lite/micro/test_helpers.h"
 #include "tensorflow/lite/micro/testing/micro_test.h"
 #include "tensorflow/lite/micro/testing/test_conv_model.h"
@@ -157,6 +159,88 @@ size_t GetArenaUsedBytesBySimpleMockModel(bool is_memory_planner_injected) {
          activation_tensor_buffer;
 }
 
+// The flatbuffers allocator of the builders below. TFLM's flatbuffers has no
+// implicit default allocator.
+flatbuffers::DefaultAllocator builder_allocator;
+
+// Builds a model with one operator reading a block-sparse 3x10 int8 filter
+// (tensor 1) in blocks of 5, with blocks 0, 3, 4 and 5 present. The
+// BLOCK_SPARSITY_METADATA buffer holds `metadata_words` as little-endian
+// uint32 values.
+const Model* BuildBlockSparseModel(flatbuffers::FlatBufferBuilder* builder,
+                                   const uint32_t* metadata_words,
+                                   size_t metadata_word_count,
+                                   BuiltinOperator op_code,
+                                   bool filter_is_second_input = true) {
+  using flatbuffers::Offset;
+  uint8_t metadata_bytes[64];
+  TFLITE_DCHECK(metadata_word_count * 4 <= sizeof(metadata_bytes));
+  for (size_t word = 0; word < metadata_word_count; ++word) {
+    for (int byte = 0; byte < 4; ++byte) {
+      metadata_bytes[word * 4 + byte] =
+          static_cast<uint8_t>(metadata_words[word] >> (8 * byte));
+    }
+  }
+  const int8_t packed_weights[20] = {1, 2, 3, 4,  5,  -6, -7, -8, -9, -10,
+                                     1, 2, 3, 4,  5,  6,  7,  8,  9,  10};
+  const uint8_t block_mask[1] = {0x39};
+
+  constexpr size_t buffers_size = 4;
+  const Offset<Buffer> buffers[buffers_size] = {
+      CreateBuffer(*builder),
+      CreateBuffer(*builder,
+                   builder->CreateVector(
+                       reinterpret_cast<const uint8_t*>(packed_weights),
+                       sizeof(packed_weights))),
+      CreateBuffer(*builder,
+                   builder->CreateVector(block_mask, sizeof(block_mask))),
+      CreateBuffer(*builder, builder->CreateVector(metadata_bytes,
+                                                   metadata_word_count * 4))};
+  const int32_t input_shape[] = {1, 10};
+  const int32_t filter_shape[] = {3, 10};
+  const int32_t output_shape[] = {1, 3};
+  constexpr size_t tensors_size = 3;
+  const Offset<Tensor> tensors[tensors_size] = {
+      CreateTensor(*builder, builder->CreateVector(input_shape, 2),
+                   TensorType_INT8, 0, builder->CreateString("input")),
+      CreateTensor(*builder, builder->CreateVector(filter_shape, 2),
+                   TensorType_INT8, 1, builder->CreateString("filter")),
+      CreateTensor(*builder, builder->CreateVector(output_shape, 2),
+                   TensorType_INT8, 0, builder->CreateString("output")),
+  };
+  const int32_t inputs[] = {0};
+  const int32_t outputs[] = {2};
+  const int32_t operator_inputs[] = {filter_is_second_input ? 0 : 1,
+                                     filter_is_second_input ? 1 : 0};
+  const Offset<Operator> operators[] = {CreateOperator(
+      *builder, 0, builder->CreateVector(operator_inputs, 2),
+      builder->CreateVector(outputs, 1), BuiltinOptions_NONE)};
+  const Offset<SubGraph> subgraphs[] = {CreateSubGraph(
+      *builder, builder->CreateVector(tensors, tensors_size),
+      builder->CreateVector(inputs, 1), builder->CreateVector(outputs, 1),
+      builder->CreateVector(operators, 1))};
+  const Offset<OperatorCode> operator_codes[] = {
+      CreateOperatorCode(*builder, /*deprecated_builtin_code=*/0,
+                         /*custom_code=*/0, /*version=*/1, op_code)};
+  const Offset<Metadata> metadata[] = {CreateMetadata(
+      *builder, builder->CreateString(kBlockSparsityMetadataString), 3)};
+  const Offset<Model> model_offset = CreateModel(
+      *builder, 0, builder->CreateVector(operator_codes, 1),
+      builder->CreateVector(subgraphs, 1), builder->CreateString("test_model"),
+      builder->CreateVector(buffers, buffers_size), 0,
+      builder->CreateVector(metadata, 1));
+  FinishModelBuffer(*builder, model_offset);
+  return flatbuffers::GetRoot<Model>(builder->GetBufferPointer());
+}
+
+// Returns whether StartModelAllocation accepts `model`.
+bool StartsBlockSparseModelAllocation(const Model* model) {
+  constexpr size_t arena_size = 2048;
+  alignas(16) uint8_t arena[arena_size];
+  MicroAllocator* allocator = MicroAllocator::Create(arena, arena_size);
+  return allocator->StartModelAllocation(model) != nullptr;
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace tflite
@@ -1384,4 +1468,139 @@ TF_LITE_MICRO_TEST(TestMultiSubgraphNumScratchAllocations) {
                           used_bytes + sizeof(tflite::ScratchBufferHandle) * 2);
 }
 
+TF_LITE_MICRO_TEST(TestBlockSparsityMetadataAllocation) {
+  const uint32_t metadata[] = {1, 1, 0, 1, 5, 2};
+  flatbuffers::FlatBufferBuilder builder(
+      /*initial_size=*/1024, &tflite::testing::builder_allocator);
+  const tflite::Model* model = tflite::testing::BuildBlockSparseModel(
+      &builder, metadata, 6, tflite::BuiltinOperator_FULLY_CONNECTED);
+  constexpr size_t arena_size = 2048;
+  alignas(16) uint8_t arena[arena_size];
+  tflite::MicroAllocator* allocator =
+      tflite::MicroAllocator::Create(arena, arena_size);
+  tflite::SubgraphAllocations* subgraph_allocations =
+      allocator->StartModelAllocation(model);
+  TF_LITE_MICRO_EXPECT(nullptr != subgraph_allocations);
+  if (subgraph_allocations != nullptr) {
+    const tflite::BlockSparseTensorData** tensors =
+        subgraph_allocations[0].block_sparse.tensors;
+    TF_LITE_MICRO_EXPECT(nullptr != tensors);
+    TF_LITE_MICRO_EXPECT(nullptr == tensors[0]);
+    TF_LITE_MICRO_EXPECT(nullptr == tensors[2]);
+    const tflite::BlockSparseTensorData* filter = tensors[1];
+    TF_LITE_MICRO_EXPECT(nullptr != filter);
+    TF_LITE_MICRO_EXPECT_EQ(3, filter->rows);
+    TF_LITE_MICRO_EXPECT_EQ(10, filter->row_depth);
+    TF_LITE_MICRO_EXPECT_EQ(5, filter->block_size);
+    TF_LITE_MICRO_EXPECT_EQ(2, filter->blocks_per_row);
+    TF_LITE_MICRO_EXPECT_EQ(4, filter->nonzero_blocks);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestBlockSparsityMetadataTruncated) {
+  // Header only, and a header announcing more entries than follow.
+  const uint32_t header_only[] = {1, 1};
+  flatbuffers::FlatBufferBuilder builder(
+      /*initial_size=*/1024, &tflite::testing::builder_allocator);
+  TF_LITE_MICRO_EXPECT(!tflite::testing::StartsBlockSparseModelAllocation(
+      tflite::testing::BuildBlockSparseModel(
+          &builder, header_only, 2, tflite::BuiltinOperator_FULLY_CONNECTED)));
+
+  const uint32_t short_entry[] = {1, 1, 0, 1, 5};
+  flatbuffers::FlatBufferBuilder short_builder(
+      /*initial_size=*/1024, &tflite::testing::builder_allocator);
+  TF_LITE_MICRO_EXPECT(!tflite::testing::StartsBlockSparseModelAllocation(
+      tflite::testing::BuildBlockSparseModel(
+          &short_builder, short_entry, 5,
+          tflite::BuiltinOperator_FULLY_CONNECTED)));
+
+  // entry_count * 16 wraps to 0 in 32 bits.
+  const uint32_t wrapping_count[] = {1, 0x10000000u, 0, 1, 5, 2};
+  flatbuffers::FlatBufferBuilder wrapping_builder(
+      /*initial_size=*/1024, &tflite::testing::builder_allocator);
+  TF_LITE_MICRO_EXPECT(!tflite::testing::StartsBlockSparseModelAllocation(
+      tflite::testing::BuildBlockSparseModel(
+          &wrapping_builder, wrapping_count, 6,
+          tflite::BuiltinOperator_FULLY_CONNECTED)));
+}
+
+TF_LITE_MICRO_TEST(TestBlockSparsityMetadataMalformedEntry) {
+  // Block size that does not divide the row depth.
+  const uint32_t bad_block_size[] = {1, 1, 0, 1, 3, 2};
+  flatbuffers::FlatBufferBuilder block_builder(
+      /*initial_size=*/1024, &tflite::testing::builder_allocator);
+  TF_LITE_MICRO_EXPECT(!tflite::testing::StartsBlockSparseModelAllocation(
+      tflite::testing::BuildBlockSparseModel(
+          &block_builder, bad_block_size, 6,
+          tflite::BuiltinOperator_FULLY_CONNECTED)));
+
+  // Out of range subgraph, tensor and mask buffer.
+  const uint32_t bad_subgraph[] = {1, 1, 1, 1, 5, 2};
+  flatbuffers::FlatBufferBuilder subgraph_builder(
+      /*initial_size=*/1024, &tflite::testing::builder_allocator);
+  TF_LITE_MICRO_EXPECT(!tflite::testing::StartsBlockSparseModelAllocation(
+      tflite::testing::BuildBlockSparseModel(
+          &subgraph_builder, bad_subgraph, 6,
+          tflite::BuiltinOperator_FULLY_CONNECTED)));
+  const uint32_t bad_tensor[] = {1, 1, 0, 7, 5, 2};
+  flatbuffers::FlatBufferBuilder tensor_builder(
+      /*initial_size=*/1024, &tflite::testing::builder_allocator);
+  TF_LITE_MICRO_EXPECT(!tflite::testing::StartsBlockSparseModelAllocation(
+      tflite::testing::BuildBlockSparseModel(
+          &tensor_builder, bad_tensor, 6,
+          tflite::BuiltinOperator_FULLY_CONNECTED)));
+  const uint32_t bad_mask[] = {1, 1, 0, 1, 5, 9};
+  flatbuffers::FlatBufferBuilder mask_builder(
+      /*initial_size=*/1024, &tflite::testing::builder_allocator);
+  TF_LITE_MICRO_EXPECT(!tflite::testing::StartsBlockSparseModelAllocation(
+      tflite::testing::BuildBlockSparseModel(
+          &mask_builder, bad_mask, 6,
+          tflite::BuiltinOperator_FULLY_CONNECTED)));
+
+  // With one block per row the mask marks a single 10 byte block, but 20
+  // bytes are packed.
+  const uint32_t wrong_mask[] = {1, 1, 0, 1, 10, 2};
+  flatbuffers::FlatBufferBuilder wrong_builder(
+      /*initial_size=*/1024, &tflite::testing::builder_allocator);
+  TF_LITE_MICRO_EXPECT(!tflite::testing::StartsBlockSparseModelAllocation(
+      tflite::testing::BuildBlockSparseModel(
+          &wrong_builder, wrong_mask, 6,
+          tflite::BuiltinOperator_FULLY_CONNECTED)));
+}
+
+TF_LITE_MICRO_TEST(TestBlockSparsityRejectedForUnsupportedOps) {
+  const uint32_t metadata[] = {1, 1, 0, 1, 5, 2};
+  flatbuffers::FlatBufferBuilder add_builder(
+      /*initial_size=*/1024, &tflite::testing::builder_allocator);
+  TF_LITE_MICRO_EXPECT(!tflite::testing::StartsBlockSparseModelAllocation(
+      tflite::testing::BuildBlockSparseModel(&add_builder, metadata, 6,
+                                             tflite::BuiltinOperator_ADD)));
+
+  // The sparse tensor is the input, not the filter, of the op.
+  flatbuffers::FlatBufferBuilder swapped_builder(
+      /*initial_size=*/1024, &tflite::testing::builder_allocator);
+  TF_LITE_MICRO_EXPECT(!tflite::testing::StartsBlockSparseModelAllocation(
+      tflite::testing::BuildBlockSparseModel(
+          &swapped_builder, metadata, 6,
+          tflite::BuiltinOperator_FULLY_CONNECTED,
+          /*filter_is_second_input=*/false)));
+}
+
+TF_LITE_MICRO_TEST(TestBlockSparseModelPassesVerification) {
+  // The packed filter holds 20 of the 30 bytes its shape needs.
+  const uint32_t metadata[] = {1, 1, 0, 1, 5, 2};
+  flatbuffers::FlatBufferBuilder builder(
+      /*initial_size=*/1024, &tflite::testing::builder_allocator);
+  const tflite::Model* model = tflite::testing::BuildBlockSparseModel(
+      &builder, metadata, 6, tflite::BuiltinOperator_FULLY_CONNECTED);
+  tflite::MicroModelVerifier verifier(model, builder.GetBufferPointer(),
+                                      builder.GetSize());
+  constexpr size_t arena_size = 2048;
+  alignas(16) uint8_t arena[arena_size];
+  tflite::MicroAllocator* allocator =
+      tflite::MicroAllocator::Create(arena, arena_size);
+  allocator->SetModelVerifier(&verifier);
+  TF_LITE_MICRO_EXPECT(nullptr != allocator->StartModelAllocation(model));
+}
+
 TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,203 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_arena_timeline.h"
+
+#include <cstring>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_profiler.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace tflite {
+namespace testing {
+namespace {
+
+constexpr size_t kArenaSize = 4096;
+constexpr size_t kTimelineSize = 2048;
+
+struct Timeline {
+  char text[kTimelineSize];
+  size_t length;
+  int lines;
+};
+
+void AppendLine(const char* line, void* context) {
+  Timeline* timeline = static_cast<Timeline*>(context);
+  const size_t line_length = strlen(line);
+  if (timeline->length + line_length < kTimelineSize) {
+    memcpy(timeline->text + timeline->length, line, line_length + 1);
+    timeline->length += line_length;
+  }
+  ++timeline->lines;
+}
+
+bool Contains(const Timeline& timeline, const char* text) {
+  return strstr(timeline.text, text) != nullptr;
+}
+
+// An interpreter over the testing ops with its own arena, and a profiler if
+// asked for, so that op costs are collected.
+struct TestInterpreter {
+  TestInterpreter(const Model* model, bool with_profiler)
+      : resolver_status(GetTestingOpResolver(op_resolver)),
+        interpreter(model, op_resolver, arena, kArenaSize,
+                    /*resource_variables=*/nullptr,
+                    with_profiler ? &profiler : nullptr) {}
+
+  TestingOpResolver op_resolver;
+  TfLiteStatus resolver_status;
+  uint8_t arena[kArenaSize];
+  MicroProfiler profiler;
+  MicroInterpreter interpreter;
+};
+
+}  // namespace
+}  // namespace testing
+}  // namespace tflite
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestTimelineOfModelWithBranches) {
+  const tflite::Model* model = tflite::testing::GetSimpleModelWithBranch();
+  uint8_t arena[tflite::testing::kArenaSize];
+  tflite::MicroAllocator* allocator =
+      tflite::MicroAllocator::Create(arena, tflite::testing::kArenaSize);
+  TF_LITE_MICRO_EXPECT(nullptr != allocator);
+
+  tflite::testing::Timeline timeline = {};
+  allocator->SetArenaTimelineWriter(tflite::testing::AppendLine, &timeline);
+  tflite::SubgraphAllocations* subgraph_allocations =
+      allocator->StartModelAllocation(model);
+  TF_LITE_MICRO_EXPECT(nullptr != subgraph_allocations);
+  tflite::ScratchBufferHandle* scratch_buffer_handles = nullptr;
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, allocator->FinishModelAllocation(model, subgraph_allocations,
+                                                  &scratch_buffer_handles));
+
+  TF_LITE_MICRO_EXPECT(timeline.lines > 0);
+  TF_LITE_MICRO_EXPECT(timeline.length < tflite::testing::kTimelineSize - 1);
+  TF_LITE_MICRO_EXPECT(tflite::testing::Contains(
+      timeline,
+      "{\"arena_timeline\":1,\"arena_bytes\":144,\"subgraphs\":1,"
+      "\"scopes\":4,"));
+  TF_LITE_MICRO_EXPECT(tflite::testing::Contains(
+      timeline,
+      "\"ops\":[{\"scope\":1,\"subgraph\":0,\"node\":0,"
+      "\"op\":\"mock_custom\"},{\"scope\":2,"));
+  // See the placement checks of TestAllocationForModelsWithBranches.
+  TF_LITE_MICRO_EXPECT(tflite::testing::Contains(
+      timeline,
+      "{\"id\":0,\"kind\":\"tensor\",\"subgraph\":0,\"index\":0,\"op\":-1,"
+      "\"offset\":0,\"size\":48,\"first\":0,\"last\":2,\"offline\":false}"));
+  TF_LITE_MICRO_EXPECT(tflite::testing::Contains(
+      timeline,
+      "{\"id\":1,\"kind\":\"tensor\",\"subgraph\":0,\"index\":1,\"op\":0,"
+      "\"offset\":96,\"size\":48,\"first\":1,\"last\":3,"));
+  TF_LITE_MICRO_EXPECT(tflite::testing::Contains(
+      timeline,
+      "{\"id\":2,\"kind\":\"tensor\",\"subgraph\":0,\"index\":2,\"op\":1,"
+      "\"offset\":48,\"size\":48,\"first\":2,\"last\":3,"));
+  TF_LITE_MICRO_EXPECT(tflite::testing::Contains(
+      timeline,
+      "{\"id\":3,\"kind\":\"tensor\",\"subgraph\":0,\"index\":3,\"op\":2,"
+      "\"offset\":0,\"size\":48,\"first\":3,\"last\":3,\"offline\":false}]}"));
+}
+
+TF_LITE_MICRO_TEST(TestTimelineNamesScratchBufferOwner) {
+  tflite::testing::TestInterpreter test(
+      tflite::testing::GetSimpleStatefulModel(), /*with_profiler=*/false);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, test.resolver_status);
+
+  tflite::testing::Timeline timeline = {};
+  test.interpreter.SetArenaTimelineWriter(tflite::testing::AppendLine,
+                                          &timeline);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, test.interpreter.AllocateTensors());
+
+  TF_LITE_MICRO_EXPECT(tflite::testing::Contains(
+      timeline, "\"op\":\"simple_stateful_op\"}"));
+  TF_LITE_MICRO_EXPECT(tflite::testing::Contains(
+      timeline,
+      "\"kind\":\"scratch\",\"subgraph\":0,\"index\":0,\"op\":0,"
+      "\"offset\":"));
+}
+
+TF_LITE_MICRO_TEST(TestNoTimelineWithoutWriter) {
+  tflite::testing::TestInterpreter test(
+      tflite::testing::GetSimpleModelWithBranch(), /*with_profiler=*/false);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, test.resolver_status);
+
+  tflite::testing::Timeline timeline = {};
+  test.interpreter.SetArenaTimelineWriter(tflite::testing::AppendLine,
+                                          &timeline);
+  test.interpreter.SetArenaTimelineWriter(nullptr, nullptr);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, test.interpreter.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_EQ(0, timeline.lines);
+}
+
+TF_LITE_MICRO_TEST(TestOpCostsHoldLiveArenaBytes) {
+  tflite::testing::TestInterpreter test(
+      tflite::testing::GetSimpleModelWithBranch(), /*with_profiler=*/true);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, test.resolver_status);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, test.interpreter.AllocateTensors());
+
+  // Same lifetimes as in TestTimelineOfModelWithBranches: node 0 runs with
+  // tensors 0 and 1 live, nodes 1 and 2 with three tensors each.
+  const uint32_t expected_live_bytes[] = {96, 144, 144};
+  for (int op_index = 0; op_index < 3; ++op_index) {
+    const tflite::MicroOpCost* cost = test.interpreter.GetOpCost(op_index);
+    TF_LITE_MICRO_EXPECT(nullptr != cost);
+    TF_LITE_MICRO_EXPECT_EQ(expected_live_bytes[op_index], cost->live_bytes);
+    TF_LITE_MICRO_EXPECT_EQ(0u, cost->scratch_bytes);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestNoOpCostOutOfRange) {
+  tflite::testing::TestInterpreter test(
+      tflite::testing::GetSimpleModelWithBranch(), /*with_profiler=*/true);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, test.resolver_status);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, test.interpreter.AllocateTensors());
+
+  TF_LITE_MICRO_EXPECT(nullptr != test.interpreter.GetOpCost(2));
+  TF_LITE_MICRO_EXPECT(nullptr == test.interpreter.GetOpCost(3));
+  TF_LITE_MICRO_EXPECT(nullptr == test.interpreter.GetOpCost(-1));
+  TF_LITE_MICRO_EXPECT(nullptr == test.interpreter.GetOpCost(0, 1));
+  TF_LITE_MICRO_EXPECT(nullptr == test.interpreter.GetOpCost(0, -1));
+}
+
+TF_LITE_MICRO_TEST(TestOpCostsHoldScratchBytes) {
+  tflite::testing::TestInterpreter test(
+      tflite::testing::GetSimpleStatefulModel(), /*with_profiler=*/true);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, test.resolver_status);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, test.interpreter.AllocateTensors());
+
+  const tflite::MicroOpCost* cost = test.interpreter.GetOpCost(0);
+  TF_LITE_MICRO_EXPECT(nullptr != cost);
+  TF_LITE_MICRO_EXPECT(cost->scratch_bytes > 0);
+  TF_LITE_MICRO_EXPECT(cost->live_bytes > cost->scratch_bytes);
+}
+
+TF_LITE_MICRO_TEST(TestNoOpCostsWithoutProfiler) {
+  tflite::testing::TestInterpreter test(
+      tflite::testing::GetSimpleModelWithBranch(), /*with_profiler=*/false);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, test.resolver_status);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, test.interpreter.AllocateTensors());
+  TF_LITE_MICRO_EXPECT(nullptr == test.interpreter.GetOpCost(0));
+}
+
+TF_LITE_MICRO_TESTS_END
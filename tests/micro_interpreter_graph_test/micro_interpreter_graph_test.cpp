@@ -0,0 +1,285 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_interpreter_graph.h"
+
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace tflite {
+namespace testing {
+namespace {
+
+constexpr size_t kArenaSize = 2048;
+// Enough invocations that temp TfLiteTensor structs which are never reset
+// would run out of arena.
+constexpr int kInvokeCount = 200;
+
+alignas(16) uint8_t arena[kArenaSize];
+// One 16-byte half per operator of the simple mock model, whose weight is a
+// single byte.
+constexpr size_t kStagingBufferSize = 32;
+alignas(16) uint8_t staging_buffer[kStagingBufferSize];
+
+class CountingProfiler : public MicroProfilerInterface {
+ public:
+  uint32_t BeginEvent(const char* tag) override { return begin_count_++; }
+  void EndEvent(uint32_t event_handle) override { end_count_++; }
+
+  int begin_count() const { return begin_count_; }
+  int end_count() const { return end_count_; }
+
+ private:
+  int begin_count_ = 0;
+  int end_count_ = 0;
+};
+
+// MockCustom, but building a TfLiteTensor for its input in Eval as older
+// kernels do.
+TfLiteStatus TempTensorInvoke(TfLiteContext* context, TfLiteNode* node) {
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, 0);
+  TF_LITE_ENSURE(context, input != nullptr);
+  micro_context->DeallocateTempTfLiteTensor(input);
+  return MockCustom::Invoke(context, node);
+}
+
+// Where the last MockCustom invocation read its weight from.
+const uint8_t* last_weight_data = nullptr;
+
+// MockCustom, recording where its weight is.
+TfLiteStatus WeightRecordingInvoke(TfLiteContext* context, TfLiteNode* node) {
+  last_weight_data = micro::GetEvalInput(context, node, 1)->data.uint8;
+  return MockCustom::Invoke(context, node);
+}
+
+bool IsInStagingBuffer(const uint8_t* data) {
+  return data >= staging_buffer && data < staging_buffer + kStagingBufferSize;
+}
+
+void ExpectMockOutputs(MicroInterpreter& interpreter, int32_t input) {
+  // The weight of the simple mock model is 21.
+  TF_LITE_MICRO_EXPECT_EQ(input + 21, interpreter.output(0)->data.i32[0]);
+  TF_LITE_MICRO_EXPECT_EQ(input + 21, interpreter.output(1)->data.i32[0]);
+}
+
+using FoldingOpResolver = MicroMutableOpResolver<4>;
+
+TfLiteStatus GetFoldingOpResolver(FoldingOpResolver& op_resolver) {
+  TF_LITE_ENSURE_STATUS(op_resolver.AddAdd());
+  TF_LITE_ENSURE_STATUS(op_resolver.AddDequantize());
+  TF_LITE_ENSURE_STATUS(op_resolver.AddReshape());
+  TF_LITE_ENSURE_STATUS(op_resolver.AddShape());
+  return kTfLiteOk;
+}
+
+// The weights of GetModelWithFoldableOperators(), dequantized.
+constexpr float kDequantizedWeights[] = {1.0f, 2.0f, 3.0f, 4.0f};
+
+void ExpectFoldedOutputs(MicroInterpreter& interpreter) {
+  const float inputs[] = {10.0f, 20.0f, 30.0f, 40.0f};
+  for (int n = 0; n < 4; ++n) {
+    interpreter.input(0)->data.f[n] = inputs[n];
+  }
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+  for (int n = 0; n < 4; ++n) {
+    TF_LITE_MICRO_EXPECT_EQ(inputs[n] + kDequantizedWeights[n],
+                            interpreter.output(0)->data.f[n]);
+  }
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace tflite
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestInvokeWithoutProfilerRunsEveryOperator) {
+  tflite::testing::TestingOpResolver op_resolver;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          tflite::testing::GetTestingOpResolver(op_resolver));
+  tflite::MicroInterpreter interpreter(tflite::testing::GetSimpleMockModel(),
+                                       op_resolver, tflite::testing::arena,
+                                       tflite::testing::kArenaSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+
+  for (int32_t input = 0; input < 3; ++input) {
+    interpreter.input(0)->data.i32[0] = input;
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+    tflite::testing::ExpectMockOutputs(interpreter, input);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestInvokeWithProfilerSeesEveryOperator) {
+  tflite::testing::TestingOpResolver op_resolver;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          tflite::testing::GetTestingOpResolver(op_resolver));
+  tflite::testing::CountingProfiler profiler;
+  tflite::MicroInterpreter interpreter(
+      tflite::testing::GetSimpleMockModel(), op_resolver,
+      tflite::testing::arena, tflite::testing::kArenaSize,
+      /*resource_variables=*/nullptr, &profiler);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+
+  interpreter.input(0)->data.i32[0] = 4;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+  tflite::testing::ExpectMockOutputs(interpreter, 4);
+  TF_LITE_MICRO_EXPECT_EQ(2, profiler.begin_count());
+  TF_LITE_MICRO_EXPECT_EQ(2, profiler.end_count());
+}
+
+TF_LITE_MICRO_TEST(TestTempTensorsFromEvalAreReset) {
+  TFLMRegistration registration =
+      *tflite::testing::MockCustom::getRegistration();
+  registration.invoke = tflite::testing::TempTensorInvoke;
+  tflite::MicroMutableOpResolver<1> op_resolver;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          op_resolver.AddCustom("mock_custom", &registration));
+  tflite::MicroInterpreter interpreter(tflite::testing::GetSimpleMockModel(),
+                                       op_resolver, tflite::testing::arena,
+                                       tflite::testing::kArenaSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+
+  interpreter.input(0)->data.i32[0] = 1;
+  for (int n = 0; n < tflite::testing::kInvokeCount; ++n) {
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+  }
+  tflite::testing::ExpectMockOutputs(interpreter, 1);
+}
+
+TF_LITE_MICRO_TEST(TestConstantOperatorsAreFolded) {
+  tflite::testing::FoldingOpResolver op_resolver;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          tflite::testing::GetFoldingOpResolver(op_resolver));
+  tflite::MicroInterpreter interpreter(
+      tflite::testing::GetModelWithFoldableOperators(), op_resolver,
+      tflite::testing::arena, tflite::testing::kArenaSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+
+  // DEQUANTIZE of the weights and SHAPE of the input.
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<size_t>(2),
+                          interpreter.folded_operators_size());
+  // The folded outputs keep their values across invocations.
+  tflite::testing::ExpectFoldedOutputs(interpreter);
+  tflite::testing::ExpectFoldedOutputs(interpreter);
+}
+
+TF_LITE_MICRO_TEST(TestFoldedOperatorsAreNotProfiled) {
+  tflite::testing::FoldingOpResolver op_resolver;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          tflite::testing::GetFoldingOpResolver(op_resolver));
+  tflite::testing::CountingProfiler profiler;
+  tflite::MicroInterpreter interpreter(
+      tflite::testing::GetModelWithFoldableOperators(), op_resolver,
+      tflite::testing::arena, tflite::testing::kArenaSize,
+      /*resource_variables=*/nullptr, &profiler);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+
+  tflite::testing::ExpectFoldedOutputs(interpreter);
+  // Only ADD and RESHAPE run.
+  TF_LITE_MICRO_EXPECT_EQ(2, profiler.begin_count());
+  TF_LITE_MICRO_EXPECT_EQ(2, profiler.end_count());
+}
+
+TF_LITE_MICRO_TEST(TestKernelsReadStagedWeights) {
+  TFLMRegistration registration =
+      *tflite::testing::MockCustom::getRegistration();
+  registration.invoke = tflite::testing::WeightRecordingInvoke;
+  tflite::MicroMutableOpResolver<1> op_resolver;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          op_resolver.AddCustom("mock_custom", &registration));
+  tflite::MicroInterpreter interpreter(tflite::testing::GetSimpleMockModel(),
+                                       op_resolver, tflite::testing::arena,
+                                       tflite::testing::kArenaSize);
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, interpreter.SetWeightStagingBuffer(
+                     tflite::testing::staging_buffer,
+                     tflite::testing::kStagingBufferSize));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  // Both operators read the same one-byte weight.
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<size_t>(2),
+                          interpreter.staged_weight_bytes());
+
+  for (int32_t input = 0; input < 3; ++input) {
+    tflite::testing::last_weight_data = nullptr;
+    interpreter.input(0)->data.i32[0] = input;
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+    tflite::testing::ExpectMockOutputs(interpreter, input);
+    TF_LITE_MICRO_EXPECT(
+        tflite::testing::IsInStagingBuffer(tflite::testing::last_weight_data));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteError, interpreter.SetWeightStagingBuffer(
+                        tflite::testing::staging_buffer,
+                        tflite::testing::kStagingBufferSize));
+}
+
+TF_LITE_MICRO_TEST(TestStagingIsProfiled) {
+  tflite::testing::TestingOpResolver op_resolver;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          tflite::testing::GetTestingOpResolver(op_resolver));
+  tflite::testing::CountingProfiler profiler;
+  tflite::MicroInterpreter interpreter(
+      tflite::testing::GetSimpleMockModel(), op_resolver,
+      tflite::testing::arena, tflite::testing::kArenaSize,
+      /*resource_variables=*/nullptr, &profiler);
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, interpreter.SetWeightStagingBuffer(
+                     tflite::testing::staging_buffer,
+                     tflite::testing::kStagingBufferSize));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+
+  interpreter.input(0)->data.i32[0] = 4;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+  tflite::testing::ExpectMockOutputs(interpreter, 4);
+  // A STAGE_WEIGHTS event before each operator.
+  TF_LITE_MICRO_EXPECT_EQ(4, profiler.begin_count());
+  TF_LITE_MICRO_EXPECT_EQ(4, profiler.end_count());
+}
+
+TF_LITE_MICRO_TEST(TestWeightsLargerThanHalfTheBufferAreNotStaged) {
+  TFLMRegistration registration =
+      *tflite::testing::MockCustom::getRegistration();
+  registration.invoke = tflite::testing::WeightRecordingInvoke;
+  tflite::MicroMutableOpResolver<1> op_resolver;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          op_resolver.AddCustom("mock_custom", &registration));
+  tflite::MicroInterpreter interpreter(tflite::testing::GetSimpleMockModel(),
+                                       op_resolver, tflite::testing::arena,
+                                       tflite::testing::kArenaSize);
+  // Split in two, 16 bytes leave no room for a 16-byte aligned copy.
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk,
+      interpreter.SetWeightStagingBuffer(tflite::testing::staging_buffer, 16));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<size_t>(0),
+                          interpreter.staged_weight_bytes());
+
+  interpreter.input(0)->data.i32[0] = 2;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+  tflite::testing::ExpectMockOutputs(interpreter, 2);
+  TF_LITE_MICRO_EXPECT(
+      !tflite::testing::IsInStagingBuffer(tflite::testing::last_weight_data));
+}
+
+TF_LITE_MICRO_TESTS_END
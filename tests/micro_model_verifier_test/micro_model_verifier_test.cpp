@@ -0,0 +1,193 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_model_verifier.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+namespace testing {
+namespace {
+
+constexpr size_t kArenaSize = 2048;
+alignas(16) uint8_t arena[kArenaSize];
+
+constexpr size_t kMaxModelSize = 1024;
+alignas(16) uint8_t model_data[kMaxModelSize];
+
+flatbuffers::DefaultAllocator builder_allocator;
+
+// The fields of the test model that the tests below corrupt.
+struct ModelParams {
+  uint32_t weights_buffer = 1;
+  int32_t weights_dim = 4;
+  int32_t add_input = 1;
+  uint32_t opcode_index = 0;
+  BuiltinOperator builtin_code = BuiltinOperator_ADD;
+  int32_t subgraph_output = 2;
+};
+
+// Builds a model computing output = input + weights, with float tensors of
+// shape [1, 4] and the four weights in buffer 1, into `model_data`. Returns
+// the size of the model.
+size_t BuildModel(const ModelParams& params) {
+  using flatbuffers::Offset;
+  flatbuffers::FlatBufferBuilder builder(kMaxModelSize, &builder_allocator);
+  const float weights[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+  builder.ForceVectorAlignment(sizeof(weights), sizeof(uint8_t), 16);
+  const Offset<Buffer> buffers[] = {
+      CreateBuffer(builder),
+      CreateBuffer(builder, builder.CreateVector(
+                                reinterpret_cast<const uint8_t*>(weights),
+                                sizeof(weights)))};
+  const int32_t shape[] = {1, 4};
+  const int32_t weights_shape[] = {1, params.weights_dim};
+  const Offset<Tensor> tensors[] = {
+      CreateTensor(builder, builder.CreateVector(shape, 2),
+                   TensorType_FLOAT32, 0),
+      CreateTensor(builder, builder.CreateVector(weights_shape, 2),
+                   TensorType_FLOAT32, params.weights_buffer),
+      CreateTensor(builder, builder.CreateVector(shape, 2),
+                   TensorType_FLOAT32, 0)};
+  const int32_t inputs[] = {0};
+  const int32_t outputs[] = {params.subgraph_output};
+  const int32_t add_inputs[] = {0, params.add_input};
+  const int32_t add_outputs[] = {2};
+  const Offset<Operator> operators[] = {CreateOperator(
+      builder, params.opcode_index, builder.CreateVector(add_inputs, 2),
+      builder.CreateVector(add_outputs, 1))};
+  const Offset<SubGraph> subgraphs[] = {CreateSubGraph(
+      builder, builder.CreateVector(tensors, 3), builder.CreateVector(inputs, 1),
+      builder.CreateVector(outputs, 1), builder.CreateVector(operators, 1))};
+  const Offset<OperatorCode> operator_codes[] = {CreateOperatorCode(
+      builder, /*deprecated_builtin_code=*/0, /*custom_code=*/0,
+      /*version=*/1, params.builtin_code)};
+  const Offset<Model> model = CreateModel(
+      builder, TFLITE_SCHEMA_VERSION, builder.CreateVector(operator_codes, 1),
+      builder.CreateVector(subgraphs, 1), /*description=*/0,
+      builder.CreateVector(buffers, 2));
+  FinishModelBuffer(builder, model);
+  TFLITE_DCHECK(builder.GetSize() <= kMaxModelSize);
+  std::memcpy(model_data, builder.GetBufferPointer(), builder.GetSize());
+  return builder.GetSize();
+}
+
+TfLiteStatus AllocateVerified(size_t model_size) {
+  MicroMutableOpResolver<1> op_resolver;
+  op_resolver.AddAdd();
+  MicroInterpreter interpreter(GetModel(model_data), op_resolver, arena,
+                               kArenaSize);
+  TF_LITE_ENSURE_STATUS(
+      interpreter.SetModelVerification(model_data, model_size));
+  return interpreter.AllocateTensors();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace tflite
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestValidModelIsAcceptedAndRuns) {
+  const size_t model_size =
+      tflite::testing::BuildModel(tflite::testing::ModelParams());
+  tflite::MicroMutableOpResolver<1> op_resolver;
+  op_resolver.AddAdd();
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(tflite::testing::model_data), op_resolver,
+      tflite::testing::arena, tflite::testing::kArenaSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          interpreter.SetModelVerification(
+                              tflite::testing::model_data, model_size));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+
+  for (int element = 0; element < 4; ++element) {
+    interpreter.input(0)->data.f[element] = 10.0f;
+  }
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+  TF_LITE_MICRO_EXPECT_EQ(11.0f, interpreter.output(0)->data.f[0]);
+  TF_LITE_MICRO_EXPECT_EQ(14.0f, interpreter.output(0)->data.f[3]);
+
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError,
+                          interpreter.SetModelVerification(
+                              tflite::testing::model_data, model_size));
+}
+
+TF_LITE_MICRO_TEST(TestInvalidIndicesAreRejected) {
+  tflite::testing::ModelParams buffer;
+  buffer.weights_buffer = 7;
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteError, tflite::testing::AllocateVerified(
+                        tflite::testing::BuildModel(buffer)));
+
+  tflite::testing::ModelParams input;
+  input.add_input = 3;
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteError, tflite::testing::AllocateVerified(
+                        tflite::testing::BuildModel(input)));
+
+  tflite::testing::ModelParams output;
+  output.subgraph_output = -2;
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteError, tflite::testing::AllocateVerified(
+                        tflite::testing::BuildModel(output)));
+
+  tflite::testing::ModelParams opcode;
+  opcode.opcode_index = 1;
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteError, tflite::testing::AllocateVerified(
+                        tflite::testing::BuildModel(opcode)));
+}
+
+TF_LITE_MICRO_TEST(TestBuiltinCodeOutOfRangeIsRejected) {
+  tflite::testing::ModelParams params;
+  params.builtin_code = static_cast<tflite::BuiltinOperator>(
+      tflite::BuiltinOperator_MAX + 1);
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteError, tflite::testing::AllocateVerified(
+                        tflite::testing::BuildModel(params)));
+}
+
+TF_LITE_MICRO_TEST(TestWeightsShorterThanTheirShapeAreRejected) {
+  // Eight weights, but the buffer holds four.
+  tflite::testing::ModelParams short_weights;
+  short_weights.weights_dim = 8;
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteError, tflite::testing::AllocateVerified(
+                        tflite::testing::BuildModel(short_weights)));
+
+  tflite::testing::ModelParams negative_dim;
+  negative_dim.weights_dim = -4;
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteError, tflite::testing::AllocateVerified(
+                        tflite::testing::BuildModel(negative_dim)));
+}
+
+TF_LITE_MICRO_TEST(TestTruncatedModelIsRejected) {
+  // The weights are written first, so they end the flatbuffer.
+  const size_t model_size =
+      tflite::testing::BuildModel(tflite::testing::ModelParams());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError,
+                          tflite::testing::AllocateVerified(model_size - 8));
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -15,6 +15,8 @@ limitations under the License.
 
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
 
+#include <cstring>
+
 #include "tensorflow/lite/micro/micro_op_resolver.h"
 #include "tensorflow/lite/micro/testing/micro_test.h"
 
@@ -95,4 +97,70 @@ TF_LITE_MICRO_TEST(TestOperations) {
   registration = resolver->FindOp("nonexistent_custom");
   TF_LITE_MICRO_EXPECT(nullptr == registration);
 }
+
+TF_LITE_MICRO_TEST(TestBuiltinAndCustomLookups) {
+  using tflite::BuiltinOperator_CONV_2D;
+  using tflite::BuiltinOperator_CUSTOM;
+  using tflite::BuiltinOperator_MAX;
+  using tflite::BuiltinOperator_RELU;
+  using tflite::BuiltinOperator_SOFTMAX;
+  using tflite::MicroMutableOpResolver;
+
+  static TFLMRegistration r = {};
+  r.init = tflite::MockInit;
+  r.free = tflite::MockFree;
+  r.prepare = tflite::MockPrepare;
+  r.invoke = tflite::MockInvoke;
+
+  static const char* const kCustomNames[] = {
+      "custom_a", "custom_b", "custom_c", "custom_d", "custom_e", "custom_f",
+  };
+  constexpr int kCustomCount = sizeof(kCustomNames) / sizeof(kCustomNames[0]);
+
+  MicroMutableOpResolver<kCustomCount + 2> micro_op_resolver;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, micro_op_resolver.AddConv2D(r));
+  for (int n = 0; n < kCustomCount; ++n) {
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                            micro_op_resolver.AddCustom(kCustomNames[n], &r));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, micro_op_resolver.AddSoftmax(r));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, micro_op_resolver.AddConv2D(r));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError,
+                          micro_op_resolver.AddCustom("custom_g", &r));
+
+  tflite::MicroOpResolver* resolver = &micro_op_resolver;
+
+  const TFLMRegistration* registration =
+      resolver->FindOp(BuiltinOperator_CONV_2D);
+  TF_LITE_MICRO_EXPECT(nullptr != registration);
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int32_t>(BuiltinOperator_CONV_2D),
+                          registration->builtin_code);
+  registration = resolver->FindOp(BuiltinOperator_SOFTMAX);
+  TF_LITE_MICRO_EXPECT(nullptr != registration);
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int32_t>(BuiltinOperator_SOFTMAX),
+                          registration->builtin_code);
+  TF_LITE_MICRO_EXPECT(nullptr == resolver->FindOp(BuiltinOperator_RELU));
+  TF_LITE_MICRO_EXPECT(nullptr == resolver->FindOp(BuiltinOperator_CUSTOM));
+  // Codes from a newer schema than the one the resolver was built with.
+  const auto unknown_op = static_cast<tflite::BuiltinOperator>(
+      static_cast<int>(BuiltinOperator_MAX) + 1);
+  TF_LITE_MICRO_EXPECT(nullptr == resolver->FindOp(unknown_op));
+
+  TF_LITE_MICRO_EXPECT(tflite::ParseConv2D ==
+                       resolver->GetOpDataParser(BuiltinOperator_CONV_2D));
+  TF_LITE_MICRO_EXPECT(tflite::ParseSoftmax ==
+                       resolver->GetOpDataParser(BuiltinOperator_SOFTMAX));
+  TF_LITE_MICRO_EXPECT(nullptr ==
+                       resolver->GetOpDataParser(BuiltinOperator_RELU));
+  TF_LITE_MICRO_EXPECT(nullptr == resolver->GetOpDataParser(unknown_op));
+
+  for (int n = 0; n < kCustomCount; ++n) {
+    registration = resolver->FindOp(kCustomNames[n]);
+    TF_LITE_MICRO_EXPECT(nullptr != registration);
+    TF_LITE_MICRO_EXPECT_EQ(0,
+                            strcmp(kCustomNames[n], registration->custom_name));
+  }
+  TF_LITE_MICRO_EXPECT(nullptr == resolver->FindOp("custom_g"));
+  TF_LITE_MICRO_EXPECT(nullptr == resolver->FindOp("custom"));
+}
 TF_LITE_MICRO_TESTS_END
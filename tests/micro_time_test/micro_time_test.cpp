@@ -17,6 +17,28 @@ limitations under the License.
 
 #include "tensorflow/lite/micro/testing/micro_test.h"
 
+#ifdef TFLM_HOST_PLATFORM
+#include <time.h>
+#else
+#include "pico/time.h"  // NOLINT
+#endif
+
+namespace {
+
+// Microseconds from the clock that ticks are calibrated against.
+uint64_t ReferenceMicroseconds() {
+#ifdef TFLM_HOST_PLATFORM
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000u +
+         static_cast<uint64_t>(ts.tv_nsec) / 1000u;
+#else
+  return time_us_64();
+#endif
+}
+
+}  // namespace
+
 TF_LITE_MICRO_TESTS_BEGIN
 
 TF_LITE_MICRO_TEST(TestBasicTimerFunctionality) {
@@ -45,4 +67,36 @@ TF_LITE_MICRO_TEST(TestBasicTimerFunctionality) {
                        tflite::GetCurrentTimeTicks() - start_time > 0);
 }
 
+TF_LITE_MICRO_TEST(TestTicksToUs) {
+  const uint32_t ticks_per_second = tflite::ticks_per_second();
+
+  TF_LITE_MICRO_EXPECT_EQ(0u, tflite::TicksToUs(0));
+  // One second's worth of ticks must not overflow the conversion, even with
+  // a GHz cycle counter.
+  TF_LITE_MICRO_EXPECT(ticks_per_second == 0 ||
+                       tflite::TicksToUs(ticks_per_second) == 1000000u);
+}
+
+TF_LITE_MICRO_TEST(TestTicksFollowReferenceClock) {
+  // Long enough for the microsecond resolution of the reference to be
+  // negligible, and short enough for 32-bit ticks not to wrap.
+  constexpr uint64_t kIntervalUs = 50000;
+  // Allows for calibration error and for preemption between the two reads
+  // at each end.
+  constexpr uint64_t kToleranceUs = kIntervalUs / 50;
+
+  const uint64_t start_us = ReferenceMicroseconds();
+  const uint32_t start_ticks = tflite::GetCurrentTimeTicks();
+  uint64_t now_us = start_us;
+  while (now_us - start_us < kIntervalUs) {
+    now_us = ReferenceMicroseconds();
+  }
+  const uint32_t elapsed_ticks = tflite::GetCurrentTimeTicks() - start_ticks;
+
+  const uint64_t elapsed_us = now_us - start_us;
+  const uint64_t ticks_us = tflite::TicksToUs(elapsed_ticks);
+  TF_LITE_MICRO_EXPECT(ticks_us + kToleranceUs >= elapsed_us);
+  TF_LITE_MICRO_EXPECT(ticks_us <= elapsed_us + kToleranceUs);
+}
+
 TF_LITE_MICRO_TESTS_END
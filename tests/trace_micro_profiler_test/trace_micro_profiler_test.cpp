@@ -0,0 +1,130 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/trace_micro_profiler.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "pico/multicore.h"
+#include "tensorflow/lite/micro/kernel_region_profiler.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace {
+
+constexpr int kMaxLines = 16;
+
+struct LineLog {
+  char lines[kMaxLines][192];
+  int count;
+};
+
+void CollectLine(const char* line, void* context) {
+  LineLog* log = static_cast<LineLog*>(context);
+  if (log->count < kMaxLines) {
+    strncpy(log->lines[log->count], line, sizeof(log->lines[0]) - 1);
+    ++log->count;
+  }
+}
+
+void Core1RegionWorker() {
+  const uint32_t region = TfLiteMicroRegionBegin(TF_LITE_MICRO_REGION_MATMUL);
+  TfLiteMicroRegionEnd(region);
+  multicore_fifo_push_blocking(0);
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestRecordsNestingDepth) {
+  tflite::StaticTraceMicroProfiler<8> profiler;
+  uint32_t outer = profiler.BeginEvent("CONV_2D");
+  profiler.EndEvent(profiler.BeginEvent(TF_LITE_MICRO_REGION_DECOMPRESS));
+  profiler.EndEvent(profiler.BeginEvent(TF_LITE_MICRO_REGION_MATMUL));
+  profiler.EndEvent(outer);
+  profiler.EndEvent(profiler.BeginEvent("SOFTMAX"));
+
+  TF_LITE_MICRO_EXPECT_EQ(4, profiler.num_events(0));
+  TF_LITE_MICRO_EXPECT_EQ(0, profiler.num_events(1));
+  const uint32_t expected_depths[] = {0, 1, 1, 0};
+  for (int n = 0; n < profiler.num_events(0); ++n) {
+    const tflite::TraceMicroProfiler::Event& event = profiler.event(0, n);
+    TF_LITE_MICRO_EXPECT_EQ(expected_depths[n], event.depth);
+    TF_LITE_MICRO_EXPECT_LE(event.start_ticks, event.end_ticks);
+  }
+  TF_LITE_MICRO_EXPECT_STRING_EQ("matmul", profiler.event(0, 2).tag);
+}
+
+TF_LITE_MICRO_TEST(TestDropsEventsBeyondCapacity) {
+  tflite::StaticTraceMicroProfiler<2> profiler;
+  for (int n = 0; n < 3; ++n) {
+    profiler.EndEvent(profiler.BeginEvent("ADD"));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(2, profiler.num_events(0));
+  TF_LITE_MICRO_EXPECT_EQ(1u, profiler.dropped_events());
+
+  profiler.ClearEvents();
+  TF_LITE_MICRO_EXPECT_EQ(0, profiler.num_events(0));
+  TF_LITE_MICRO_EXPECT_EQ(0u, profiler.dropped_events());
+}
+
+TF_LITE_MICRO_TEST(TestRecordsKernelRegionsOnBothCores) {
+  tflite::StaticTraceMicroProfiler<8> profiler;
+  tflite::SetKernelRegionProfiler(&profiler);
+
+  uint32_t op = profiler.BeginEvent("FULLY_CONNECTED");
+  multicore_reset_core1();
+  multicore_launch_core1(Core1RegionWorker);
+  {
+    tflite::ScopedKernelRegion region(TF_LITE_MICRO_REGION_MATMUL);
+  }
+  multicore_fifo_pop_blocking();
+  profiler.EndEvent(op);
+  tflite::SetKernelRegionProfiler(nullptr);
+
+  // Regions are not recorded once the profiler is removed.
+  tflite::ScopedKernelRegion ignored(TF_LITE_MICRO_REGION_DECOMPRESS);
+
+  TF_LITE_MICRO_EXPECT_EQ(2, profiler.num_events(0));
+  TF_LITE_MICRO_EXPECT_EQ(1u, profiler.event(0, 1).depth);
+  TF_LITE_MICRO_EXPECT_EQ(1, profiler.num_events(1));
+  TF_LITE_MICRO_EXPECT_EQ(0u, profiler.event(1, 0).depth);
+  TF_LITE_MICRO_EXPECT_STRING_EQ("matmul", profiler.event(1, 0).tag);
+}
+
+TF_LITE_MICRO_TEST(TestWritesChromeTrace) {
+  tflite::StaticTraceMicroProfiler<8> profiler;
+  profiler.EndEvent(profiler.BeginEvent("CONV_2D"));
+  profiler.EndEvent(profiler.BeginEvent("SOFTMAX"));
+
+  LineLog log = {};
+  profiler.WriteChromeTrace(CollectLine, &log);
+
+  // Opening line, a name for each core's track, two events, closing line.
+  TF_LITE_MICRO_EXPECT_EQ(6, log.count);
+  TF_LITE_MICRO_EXPECT_STRING_EQ(
+      "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", log.lines[0]);
+  TF_LITE_MICRO_EXPECT(strstr(log.lines[2], "\"name\":\"core 1\"") != nullptr);
+  TF_LITE_MICRO_EXPECT(
+      strstr(log.lines[3], ",{\"name\":\"CONV_2D\",\"ph\":\"X\"") ==
+      log.lines[3]);
+  TF_LITE_MICRO_EXPECT(strstr(log.lines[3], "\"ts\":0.000,") != nullptr);
+  TF_LITE_MICRO_EXPECT(strstr(log.lines[4], "\"name\":\"SOFTMAX\"") !=
+                       nullptr);
+  TF_LITE_MICRO_EXPECT_STRING_EQ("]}", log.lines[5]);
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,825 @@
+#!/usr/bin/env python3
+# Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+"""Compiles a .tflite model ahead of time into straight-line C++.
+
+The generated class calls the CMSIS-NN functions that the TFLM CMSIS-NN
+kernels dispatch to, in operator order, with every parameter the kernels
+compute in Prepare() folded into constants: quantized multipliers and
+shifts, activation ranges, padding and tensor dimensions. Weights and biases
+are emitted as constant arrays and activations live at fixed offsets of a
+caller-provided arena, planned here, so neither the flatbuffer nor the
+interpreter, op resolver or allocator is needed at runtime.
+
+The constants are computed exactly as the kernels compute them, so the
+output matches MicroInterpreter bit for bit. Only int8 models made of the
+ops below are supported; anything else is an error and should run on
+MicroInterpreter.
+
+  AVERAGE_POOL_2D, CONV_2D, DEPTHWISE_CONV_2D, FULLY_CONNECTED, MAX_POOL_2D,
+  RESHAPE, SOFTMAX
+
+  aot_compile.py examples/micro_speech_small/kws_model_data.cc \\
+      --class-name KwsModelAot \\
+      --header examples/micro_speech_small/kws_model_aot.h \\
+      --source examples/micro_speech_small/kws_model_aot.cc
+"""
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import argparse
+import math
+import os
+import re
+import struct
+import sys
+
+from tflite_model import ROOT
+from tflite_model import float32
+from tflite_model import load_model
+from tflite_model import per_channel_quantization
+from tflite_model import quantize_multiplier
+from tflite_model import round_half_away
+
+# Arena offsets are aligned like MicroAllocator aligns tensor buffers.
+ALIGNMENT = 16
+
+TFLITE_SCHEMA_VERSION = 3
+
+# Metadata that changes how the kernels read weights; not supported here.
+UNSUPPORTED_METADATA = ("BLOCK_SPARSITY_METADATA", "COMPRESSION_METADATA")
+
+PADDING_SAME = 0
+
+ACTIVATION_NONE = 0
+ACTIVATION_RELU = 1
+ACTIVATION_RELU_N1_TO_1 = 2
+ACTIVATION_RELU6 = 3
+
+INT8_MIN = -128
+INT8_MAX = 127
+
+
+class CompileError(ValueError):
+  pass
+
+
+def activation_range(activation, output):
+  """CalculateActivationRangeQuantized() for an int8 output."""
+
+  def quantize(value):
+    # Quantize() divides and rounds in float.
+    return output.zero_point + round_half_away(
+        float32(value / float32(output.scale)))
+
+  if activation == ACTIVATION_NONE:
+    return INT8_MIN, INT8_MAX
+  if activation == ACTIVATION_RELU:
+    return max(INT8_MIN, quantize(0.0)), INT8_MAX
+  if activation == ACTIVATION_RELU6:
+    return max(INT8_MIN, quantize(0.0)), min(INT8_MAX, quantize(6.0))
+  if activation == ACTIVATION_RELU_N1_TO_1:
+    return max(INT8_MIN, quantize(-1.0)), min(INT8_MAX, quantize(1.0))
+  raise CompileError("fused activation %d is not supported" % activation)
+
+
+def same_or_valid_padding(padding, stride, dilation, in_size, filter_size):
+  """ComputePaddingHeightWidth() for one dimension: (out_size, padding)."""
+  effective = (filter_size - 1) * dilation + 1
+  if padding == PADDING_SAME:
+    out_size = (in_size + stride - 1) // stride
+  else:
+    out_size = (in_size + stride - effective) // stride
+  total = max(0, (out_size - 1) * stride + effective - in_size)
+  return out_size, total // 2
+
+
+def align(size):
+  return (size + ALIGNMENT - 1) // ALIGNMENT * ALIGNMENT
+
+
+def dims(n, h, w, c):
+  return "{%d, %d, %d, %d}" % (n, h, w, c)
+
+
+def int_array(values, per_line=12):
+  lines = []
+  for start in range(0, len(values), per_line):
+    lines.append("    " + ", ".join("%d" % v
+                                     for v in values[start:start + per_line]) +
+                 ",")
+  return "\n".join(lines)
+
+
+def float_literal(value):
+  return "%.9gf" % value
+
+
+class Lowered(object):
+  """The generated code of one operator.
+
+  `constants` are namespace-scope definitions, `function` and `arguments` the
+  call that runs the operator, `scratch` the bytes of arena scratch memory it
+  needs and `scratch_checks` the get_buffer_size() functions and arguments
+  whose result must fit in it.
+  An operator without a function needs no code.
+  """
+
+  def __init__(self, function, arguments=None):
+    self.function = function
+    self.arguments = arguments or []
+    self.constants = []
+    self.comment = ""
+    self.scratch = 0
+    self.scratch_checks = []
+
+
+class Compiler(object):
+
+  def __init__(self, model, source_name):
+    self.model = model
+    self.source_name = source_name
+    self.tensors = model.tensors
+    # Tensors that share the arena bytes of another tensor.
+    self.alias = {}
+    self.data_constants = {}
+    self.lowered = []
+
+  def check_model(self):
+    if self.model.version != TFLITE_SCHEMA_VERSION:
+      raise CompileError("schema version %d is not %d" %
+                         (self.model.version, TFLITE_SCHEMA_VERSION))
+    if self.model.subgraph_count != 1:
+      raise CompileError("models with %d subgraphs are not supported" %
+                         self.model.subgraph_count)
+    for name in self.model.metadata:
+      if name in UNSUPPORTED_METADATA:
+        raise CompileError("%s is not supported" % name)
+    for tensor in self.tensors:
+      if tensor.is_variable:
+        raise CompileError("variable tensor %d is not supported" %
+                           tensor.index)
+    for index in self.model.inputs + self.model.outputs:
+      if self.tensors[index].dtype != "int8":
+        raise CompileError("model input or output %d is %s, not int8" %
+                           (index, self.tensors[index].dtype))
+
+  def root(self, index):
+    while index in self.alias:
+      index = self.alias[index]
+    return index
+
+  def activation(self, index):
+    tensor = self.tensors[index]
+    if tensor.constant:
+      raise CompileError("tensor %d is a constant activation" % index)
+    if tensor.dtype != "int8":
+      raise CompileError("tensor %d is %s; only int8 activations are "
+                         "supported" % (index, tensor.dtype))
+    return "tensor%d" % self.root(index)
+
+  def constant(self, index, dtype):
+    tensor = self.tensors[index]
+    if not tensor.constant:
+      raise CompileError("tensor %d must be constant" % index)
+    if tensor.dtype != dtype:
+      raise CompileError("tensor %d is %s, not %s" %
+                         (index, tensor.dtype, dtype))
+    name = "kTensor%dData" % index
+    if index not in self.data_constants:
+      if dtype == "int8":
+        values = list(struct.unpack("<%db" % len(tensor.data), tensor.data))
+        ctype = "int8_t"
+      else:
+        values = list(
+            struct.unpack("<%di" % (len(tensor.data) // 4), tensor.data))
+        ctype = "int32_t"
+      self.data_constants[index] = (
+          "// %s\nalignas(%d) const %s %s[%d] = {\n%s\n};" %
+          (tensor.name or "tensor %d" % index, ALIGNMENT, ctype, name,
+           len(values), int_array(values)))
+    return name
+
+  def bias(self, op, position, channels):
+    if len(op.inputs) <= position or op.inputs[position] < 0:
+      return "nullptr"
+    name = self.constant(op.inputs[position], "int32")
+    if self.tensors[op.inputs[position]].elements() != channels:
+      raise CompileError("bias of operator %d has the wrong size" % op.index)
+    return name
+
+  def quantization_arrays(self, lowered, prefix, multipliers, shifts):
+    lowered.constants.append("const int32_t %sMultiplier[%d] = {\n%s\n};" %
+                             (prefix, len(multipliers),
+                              int_array(multipliers, 6)))
+    lowered.constants.append("const int32_t %sShift[%d] = {\n%s\n};" %
+                             (prefix, len(shifts), int_array(shifts)))
+
+  def weighted_arguments(self, op, prefix, filter_data, bias_data):
+    """Arguments of the CMSIS-NN functions with filter and bias tensors."""
+    return [
+        "&ctx", "&%sParams" % prefix, "&%sQuant" % prefix,
+        "&%sInputDims" % prefix, self.activation(op.inputs[0]),
+        "&%sFilterDims" % prefix, filter_data, "&%sBiasDims" % prefix,
+        bias_data, "&%sOutputDims" % prefix, self.activation(op.outputs[0])
+    ]
+
+  def lower(self):
+    for op in self.model.operators:
+      method = getattr(self, "lower_" + op.tag.lower(), None)
+      if method is None:
+        raise CompileError("operator %d (%s) is not supported; run this model "
+                           "on MicroInterpreter" % (op.index, op.tag))
+      self.lowered.append(method(op))
+
+  def lower_reshape(self, op):
+    # Reshape only renames the bytes, so the output shares its input's.
+    source = op.inputs[0]
+    output = op.outputs[0]
+    self.activation(source)
+    if self.tensors[output].elements() != self.tensors[source].elements():
+      raise CompileError("reshape %d changes the element count" % op.index)
+    self.alias[output] = source
+    lowered = Lowered(None)
+    lowered.comment = ("Tensor %d is tensor %d reshaped; nothing to do." %
+                       (output, self.root(source)))
+    return lowered
+
+  def lower_conv_2d(self, op):
+    options = op.options
+    input_tensor = self.tensors[op.inputs[0]]
+    filter_tensor = self.tensors[op.inputs[1]]
+    output = self.tensors[op.outputs[0]]
+    prefix = "kOp%d" % op.index
+    lowered = Lowered("arm_convolve_wrapper_s8")
+    padding = options.scalar(0, "b")
+    stride_w = options.scalar(1, "i")
+    stride_h = options.scalar(2, "i")
+    activation = options.scalar(3, "b")
+    dilation_w = options.scalar(4, "i", 1)
+    dilation_h = options.scalar(5, "i", 1)
+    n, in_h, in_w, in_c = input_tensor.shape
+    out_c, filter_h, filter_w, filter_c = filter_tensor.shape
+    _, out_h, out_w, _ = output.shape
+    if filter_c != in_c:
+      raise CompileError("grouped CONV_2D %d is not supported" % op.index)
+    _, pad_h = same_or_valid_padding(padding, stride_h, dilation_h, in_h,
+                                     filter_h)
+    _, pad_w = same_or_valid_padding(padding, stride_w, dilation_w, in_w,
+                                     filter_w)
+    act_min, act_max = activation_range(activation, output)
+    multipliers, shifts = per_channel_quantization(input_tensor,
+                                                   filter_tensor, output,
+                                                   out_c)
+    filter_data = self.constant(op.inputs[1], "int8")
+    bias_data = self.bias(op, 2, out_c)
+    self.quantization_arrays(lowered, prefix, multipliers, shifts)
+    lowered.constants.append(
+        "const cmsis_nn_conv_params %sParams = {%d, %d, {%d, %d}, {%d, %d}, "
+        "{%d, %d}, {%d, %d}};" %
+        (prefix, -input_tensor.zero_point, output.zero_point, stride_w,
+         stride_h, pad_w, pad_h, dilation_w, dilation_h, act_min, act_max))
+    lowered.constants.append(
+        "const cmsis_nn_per_channel_quant_params %sQuant = {\n"
+        "    const_cast<int32_t*>(%sMultiplier), "
+        "const_cast<int32_t*>(%sShift)};" % (prefix, prefix, prefix))
+    lowered.constants.append(
+        "const cmsis_nn_dims %sInputDims = %s;\n"
+        "const cmsis_nn_dims %sFilterDims = %s;\n"
+        "const cmsis_nn_dims %sBiasDims = %s;\n"
+        "const cmsis_nn_dims %sOutputDims = %s;" %
+        (prefix, dims(n, in_h, in_w, in_c), prefix,
+         dims(1, filter_h, filter_w, filter_c), prefix, dims(1, 1, 1, out_c),
+         prefix, dims(n, out_h, out_w, out_c)))
+    # arm_convolve_wrapper_s8_get_buffer_size() of the DSP build, which asks
+    # for the most on the M0+ and M33 targets.
+    rhs_cols = filter_w * filter_h * in_c
+    conv_s8_size = 2 * ((rhs_cols + 3) // 4 * 4) * 2
+    if (pad_w == 0 and pad_h == 0 and filter_w == 1 and filter_h == 1 and
+        dilation_w == 1 and dilation_h == 1):
+      lowered.scratch = (2 * in_c * 2 if stride_w == 1 and stride_h == 1 else
+                         0)
+    else:
+      lowered.scratch = conv_s8_size
+    lowered.scratch_checks.append(
+        ("arm_convolve_wrapper_s8_get_buffer_size",
+         ["&%s%s" % (prefix, name)
+          for name in ("Params", "InputDims", "FilterDims", "OutputDims")]))
+    lowered.arguments = self.weighted_arguments(op, prefix, filter_data,
+                                                bias_data)
+    return lowered
+
+  def lower_depthwise_conv_2d(self, op):
+    options = op.options
+    input_tensor = self.tensors[op.inputs[0]]
+    filter_tensor = self.tensors[op.inputs[1]]
+    output = self.tensors[op.outputs[0]]
+    prefix = "kOp%d" % op.index
+    lowered = Lowered("arm_depthwise_conv_wrapper_s8")
+    padding = options.scalar(0, "b")
+    stride_w = options.scalar(1, "i")
+    stride_h = options.scalar(2, "i")
+    depth_multiplier = options.scalar(3, "i")
+    activation = options.scalar(4, "b")
+    dilation_w = options.scalar(5, "i", 1)
+    dilation_h = options.scalar(6, "i", 1)
+    n, in_h, in_w, in_c = input_tensor.shape
+    filter_n, filter_h, filter_w, out_c = filter_tensor.shape
+    _, out_h, out_w, _ = output.shape
+    if n != 1:
+      raise CompileError("DEPTHWISE_CONV_2D %d has batch %d; only 1 is "
+                         "supported" % (op.index, n))
+    _, pad_h = same_or_valid_padding(padding, stride_h, dilation_h, in_h,
+                                     filter_h)
+    _, pad_w = same_or_valid_padding(padding, stride_w, dilation_w, in_w,
+                                     filter_w)
+    act_min, act_max = activation_range(activation, output)
+    multipliers, shifts = per_channel_quantization(input_tensor,
+                                                   filter_tensor, output,
+                                                   out_c)
+    filter_data = self.constant(op.inputs[1], "int8")
+    bias_data = self.bias(op, 2, out_c)
+    self.quantization_arrays(lowered, prefix, multipliers, shifts)
+    lowered.constants.append(
+        "const cmsis_nn_dw_conv_params %sParams = {%d, %d, %d, {%d, %d}, "
+        "{%d, %d}, {%d, %d}, {%d, %d}};" %
+        (prefix, -input_tensor.zero_point, output.zero_point,
+         depth_multiplier, stride_w, stride_h, pad_w, pad_h, dilation_w,
+         dilation_h, act_min, act_max))
+    lowered.constants.append(
+        "const cmsis_nn_per_channel_quant_params %sQuant = {\n"
+        "    const_cast<int32_t*>(%sMultiplier), "
+        "const_cast<int32_t*>(%sShift)};" % (prefix, prefix, prefix))
+    lowered.constants.append(
+        "const cmsis_nn_dims %sInputDims = %s;\n"
+        "const cmsis_nn_dims %sFilterDims = %s;\n"
+        "const cmsis_nn_dims %sBiasDims = %s;\n"
+        "const cmsis_nn_dims %sOutputDims = %s;" %
+        (prefix, dims(n, in_h, in_w, in_c), prefix,
+         dims(filter_n, filter_h, filter_w, out_c), prefix,
+         dims(1, 1, 1, out_c), prefix, dims(n, out_h, out_w, out_c)))
+    # arm_depthwise_conv_wrapper_s8_get_buffer_size() of the DSP build.
+    lowered.scratch = 0
+    if in_c == out_c and dilation_w == 1 and dilation_h == 1:
+      if not (filter_w == 3 and filter_h == 3 and pad_h <= 1 and pad_w <= 1):
+        lowered.scratch = in_c * filter_w * filter_h * 2
+    lowered.scratch_checks.append(
+        ("arm_depthwise_conv_wrapper_s8_get_buffer_size",
+         ["&%s%s" % (prefix, name)
+          for name in ("Params", "InputDims", "FilterDims", "OutputDims")]))
+    lowered.arguments = self.weighted_arguments(op, prefix, filter_data,
+                                                bias_data)
+    return lowered
+
+  def lower_fully_connected(self, op):
+    options = op.options
+    input_tensor = self.tensors[op.inputs[0]]
+    filter_tensor = self.tensors[op.inputs[1]]
+    output = self.tensors[op.outputs[0]]
+    prefix = "kOp%d" % op.index
+    activation = options.scalar(0, "b") if options is not None else 0
+    if options is not None and options.scalar(1, "b") != 0:
+      raise CompileError("FULLY_CONNECTED %d has shuffled weights" % op.index)
+    if filter_tensor.zero_point != 0:
+      raise CompileError("FULLY_CONNECTED %d has a filter zero point" %
+                         op.index)
+    accum_depth = filter_tensor.shape[-1]
+    output_depth = output.shape[-1]
+    batches = output.elements() // output_depth
+    per_channel = len(filter_tensor.scales) > 1
+    if per_channel:
+      multipliers, shifts = per_channel_quantization(input_tensor,
+                                                     filter_tensor, output,
+                                                     output_depth)
+    else:
+      # GetQuantizedConvolutionMultipler() multiplies the scales in float.
+      real_multiplier = (float32(input_tensor.scale * filter_tensor.scale) /
+                         output.scale)
+      multiplier, shift = quantize_multiplier(real_multiplier)
+      multipliers, shifts = [multiplier], [shift]
+    act_min, act_max = activation_range(activation, output)
+    filter_data = self.constant(op.inputs[1], "int8")
+    bias_data = self.bias(op, 2, output_depth)
+    input_dims = dims(batches, 1, 1, accum_depth)
+    output_dims = dims(batches, 1, 1, output_depth)
+
+    if len(output.shape) > 2 and accum_depth % 4 == 0:
+      # The kernel runs this as a 1x1 convolution with per-channel
+      # parameters, filling them from the per-tensor ones on every call.
+      lowered = Lowered("arm_convolve_1x1_s8_fast")
+      if not per_channel:
+        multipliers = multipliers * output_depth
+        shifts = shifts * output_depth
+      self.quantization_arrays(lowered, prefix, multipliers, shifts)
+      lowered.constants.append(
+          "const cmsis_nn_conv_params %sParams = {%d, %d, {1, 1}, {0, 0}, "
+          "{1, 1}, {%d, %d}};" % (prefix, -input_tensor.zero_point,
+                                  output.zero_point, act_min, act_max))
+      lowered.constants.append(
+          "const cmsis_nn_per_channel_quant_params %sQuant = {\n"
+          "    const_cast<int32_t*>(%sMultiplier), "
+          "const_cast<int32_t*>(%sShift)};" % (prefix, prefix, prefix))
+      lowered.scratch = 2 * accum_depth * 2
+      lowered.scratch_checks.append(
+          ("arm_convolve_1x1_s8_fast_get_buffer_size",
+           ["&%sInputDims" % prefix]))
+    else:
+      lowered = Lowered("arm_fully_connected_wrapper_s8")
+      self.quantization_arrays(lowered, prefix, multipliers, shifts)
+      lowered.constants.append(
+          "const cmsis_nn_fc_params %sParams = {%d, %d, %d, {%d, %d}};" %
+          (prefix, -input_tensor.zero_point, -filter_tensor.zero_point,
+           output.zero_point, act_min, act_max))
+      lowered.constants.append(
+          "const cmsis_nn_quant_params %sQuant = {\n"
+          "    const_cast<int32_t*>(%sMultiplier), "
+          "const_cast<int32_t*>(%sShift), %d};" %
+          (prefix, prefix, prefix, 1 if per_channel else 0))
+      # Only the MVE build asks for a buffer, for kernel sums that the
+      # kernel would compute on every call.
+      lowered.scratch = 0
+      lowered.scratch_checks.append(
+          ("arm_fully_connected_s8_get_buffer_size",
+           ["&%sFilterDims" % prefix]))
+    lowered.constants.append(
+        "const cmsis_nn_dims %sInputDims = %s;\n"
+        "const cmsis_nn_dims %sFilterDims = %s;\n"
+        "const cmsis_nn_dims %sBiasDims = %s;\n"
+        "const cmsis_nn_dims %sOutputDims = %s;" %
+        (prefix, input_dims, prefix, dims(accum_depth, 1, 1, output_depth),
+         prefix, dims(1, 1, 1, output_depth), prefix, output_dims))
+    lowered.arguments = self.weighted_arguments(op, prefix, filter_data,
+                                                bias_data)
+    return lowered
+
+  def lower_pool(self, op, function):
+    options = op.options
+    input_tensor = self.tensors[op.inputs[0]]
+    output = self.tensors[op.outputs[0]]
+    prefix = "kOp%d" % op.index
+    lowered = Lowered(function)
+    padding = options.scalar(0, "b")
+    stride_w = options.scalar(1, "i")
+    stride_h = options.scalar(2, "i")
+    filter_w = options.scalar(3, "i")
+    filter_h = options.scalar(4, "i")
+    activation = options.scalar(5, "b")
+    _, in_h, in_w, depth = input_tensor.shape
+    _, out_h, out_w, _ = output.shape
+    _, pad_h = same_or_valid_padding(padding, stride_h, 1, in_h, filter_h)
+    _, pad_w = same_or_valid_padding(padding, stride_w, 1, in_w, filter_w)
+    act_min, act_max = activation_range(activation, output)
+    lowered.constants.append(
+        "const cmsis_nn_pool_params %sParams = {{%d, %d}, {%d, %d}, "
+        "{%d, %d}};" %
+        (prefix, stride_w, stride_h, pad_w, pad_h, act_min, act_max))
+    lowered.constants.append(
+        "const cmsis_nn_dims %sInputDims = %s;\n"
+        "const cmsis_nn_dims %sFilterDims = %s;\n"
+        "const cmsis_nn_dims %sOutputDims = %s;" %
+        (prefix, dims(1, in_h, in_w, depth), prefix,
+         dims(1, filter_h, filter_w, 1), prefix,
+         dims(1, out_h, out_w, depth)))
+    lowered.arguments = [
+        "&ctx", "&%sParams" % prefix, "&%sInputDims" % prefix,
+        self.activation(op.inputs[0]), "&%sFilterDims" % prefix,
+        "&%sOutputDims" % prefix, self.activation(op.outputs[0])
+    ]
+    return lowered
+
+  def lower_average_pool_2d(self, op):
+    lowered = self.lower_pool(op, "arm_avgpool_s8")
+    # arm_avgpool_s8_get_buffer_size() of the DSP build.
+    depth = self.tensors[op.inputs[0]].shape[3]
+    lowered.scratch = depth * 4
+    lowered.scratch_checks.append(
+        ("arm_avgpool_s8_get_buffer_size",
+         ["kOp%dOutputDims.w" % op.index, "kOp%dOutputDims.c" % op.index]))
+    return lowered
+
+  def lower_max_pool_2d(self, op):
+    return self.lower_pool(op, "arm_max_pool_s8")
+
+  def lower_softmax(self, op):
+    input_tensor = self.tensors[op.inputs[0]]
+    output = self.tensors[op.outputs[0]]
+    if output.zero_point != -128 or output.scale != 1.0 / 256:
+      raise CompileError("SOFTMAX %d must output scale 1/256 and zero point "
+                         "-128" % op.index)
+    beta = op.options.scalar(0, "f") if op.options is not None else 0.0
+    # PreprocessSoftmaxScaling() with kScaledDiffIntegerBits = 5.
+    scaled_diff_integer_bits = 5
+    real_multiplier = min(
+        beta * input_tensor.scale * (1 << (31 - scaled_diff_integer_bits)),
+        (1 << 31) - 1.0)
+    if real_multiplier <= 1.0:
+      raise CompileError("SOFTMAX %d has too small a beta * scale" % op.index)
+    multiplier, left_shift = quantize_multiplier(real_multiplier)
+    # CalculateInputRadius() with 31 total signed bits.
+    radius = int(
+        math.floor(1.0 * ((1 << scaled_diff_integer_bits) - 1) *
+                   (1 << (31 - scaled_diff_integer_bits)) /
+                   (1 << left_shift)))
+    row_size = input_tensor.shape[-1]
+    num_rows = input_tensor.elements() // row_size
+    # arm_softmax_s8() returns nothing and needs no context.
+    return Lowered("arm_softmax_s8", [
+        self.activation(op.inputs[0]), "%d" % num_rows, "%d" % row_size,
+        "%d" % multiplier, "%d" % left_shift, "%d" % -radius,
+        self.activation(op.outputs[0])
+    ])
+
+  def plan(self):
+    """Places every buffer like GreedyMemoryPlanner: largest first, each at
+    the lowest offset free over its lifetime."""
+    op_count = len(self.model.operators)
+    first = {}
+    last = {}
+
+    def use(index, at):
+      index = self.root(index)
+      first[index] = min(first.get(index, at), at)
+      last[index] = max(last.get(index, at), at)
+
+    for index in self.model.inputs:
+      use(index, -1)
+    for op in self.model.operators:
+      for index in op.inputs + op.outputs:
+        if index >= 0 and not self.tensors[index].constant:
+          use(index, op.index)
+    for index in self.model.outputs:
+      use(index, op_count)
+
+    buffers = []
+    for index in first:
+      buffers.append(("Tensor%d" % index, self.tensors[index].elements(),
+                      first[index], last[index]))
+    for op, lowered in zip(self.model.operators, self.lowered):
+      if lowered.scratch > 0:
+        buffers.append(("Op%dScratch" % op.index, lowered.scratch, op.index,
+                        op.index))
+    buffers.sort(key=lambda buffer: (-buffer[1], buffer[2], buffer[0]))
+
+    placed = []
+    for name, size, begin, end in buffers:
+      offset = 0
+      for other_offset, other_size, other_begin, other_end in sorted(placed):
+        if other_end < begin or other_begin > end:
+          continue
+        if offset + size <= other_offset:
+          break
+        offset = max(offset, align(other_offset + other_size))
+      placed.append((offset, size, begin, end))
+      self.offsets[name] = (offset, size, begin, end)
+    return max(align(offset + size) for offset, size, _, _ in placed)
+
+  def compile(self):
+    self.check_model()
+    self.lower()
+    self.offsets = {}
+    self.arena_size = self.plan()
+
+
+def generated_notice(source_name, command):
+  lines = ["// Generated by tools/aot_compile.py from", "//   %s." % source_name,
+           "// Do not edit; regenerate with:"]
+  current = "//  "
+  for word in command.split():
+    if len(current) + len(word) + 3 > 80:
+      lines.append(current + " \\")
+      current = "//     "
+    current += " " + word
+  lines.append(current)
+  return "\n".join(lines) + "\n"
+
+
+def write_header(compiler, class_name, guard, command):
+  model = compiler.model
+  tensors = compiler.tensors
+
+  def arrays(name, values):
+    return "  static constexpr %s[] = {%s};\n" % (name, ", ".join(values))
+
+  inputs = [tensors[i] for i in model.inputs]
+  outputs = [tensors[i] for i in model.outputs]
+  lines = [
+      generated_notice(compiler.source_name, command),
+      "#ifndef %s\n#define %s\n" % (guard, guard),
+      "#include <cstddef>\n#include <cstdint>\n",
+      '#include "tensorflow/lite/c/common.h"\n',
+      "// Runs the model as straight-line calls into CMSIS-NN, with the",
+      "// parameters MicroInterpreter would compute in AllocateTensors() folded",
+      "// into constants. Outputs match MicroInterpreter bit for bit.",
+      "class %s {" % class_name,
+      " public:",
+      "  // Bytes of activation and scratch memory the model needs.",
+      "  static constexpr int kArenaSize = %d;\n" % compiler.arena_size,
+      arrays("size_t kInputBytes",
+             ["%d" % t.elements() for t in inputs]) +
+      arrays("float kInputScales",
+             [float_literal(t.scale) for t in inputs]) +
+      arrays("int32_t kInputZeroPoints",
+             ["%d" % t.zero_point for t in inputs]) +
+      arrays("size_t kOutputBytes",
+             ["%d" % t.elements() for t in outputs]) +
+      arrays("float kOutputScales",
+             [float_literal(t.scale) for t in outputs]) +
+      arrays("int32_t kOutputZeroPoints",
+             ["%d" % t.zero_point for t in outputs]),
+      "  // `arena` must be 16-byte aligned, hold kArenaSize bytes and stay",
+      "  // untouched between Invoke() and reading the outputs.",
+      "  explicit %s(uint8_t* arena);\n" % class_name,
+      "  size_t inputs_size() const { return %d; }" % len(inputs),
+      "  size_t outputs_size() const { return %d; }" % len(outputs),
+      "  int8_t* input(size_t index) {",
+      "    return reinterpret_cast<int8_t*>(arena_ + kInputOffsets[index]);",
+      "  }",
+      "  const int8_t* output(size_t index) const {",
+      "    return reinterpret_cast<const int8_t*>(arena_ +",
+      "                                           kOutputOffsets[index]);",
+      "  }\n",
+      "  TfLiteStatus Invoke();\n",
+      " private:",
+      arrays("int kInputOffsets", [
+          "%d" % compiler.offsets["Tensor%d" % compiler.root(i)][0]
+          for i in model.inputs
+      ]) + arrays("int kOutputOffsets", [
+          "%d" % compiler.offsets["Tensor%d" % compiler.root(i)][0]
+          for i in model.outputs
+      ]),
+      "  uint8_t* arena_;",
+      "};\n",
+      "#endif  // %s" % guard,
+  ]
+  return "\n".join(lines) + "\n"
+
+
+def format_call(indent, head, arguments, tail):
+  """Formats `head(arguments)tail` within 80 columns, as clang-format would
+  for a call that does not fit on one line."""
+  line = " " * indent + head + "(" + ", ".join(arguments) + ")" + tail
+  if len(line) <= 80:
+    return [line]
+  # The arguments of a call in an if condition are indented past the "if (".
+  continuation = indent + (8 if head.startswith("if (") else 4)
+  lines = [" " * indent + head + "("]
+  current = " " * continuation
+  for position, argument in enumerate(arguments):
+    text = argument + (", " if position + 1 < len(arguments) else ")" + tail)
+    if current.strip() and len(current + text.rstrip()) > 80:
+      lines.append(current.rstrip())
+      current = " " * continuation
+    current += text
+  lines.append(current.rstrip())
+  return lines
+
+
+def wrap_definition(definition):
+  """Breaks namespace-scope definitions that do not fit after the "="."""
+  lines = []
+  for line in definition.split("\n"):
+    if len(line) > 80 and " = " in line:
+      head, _, value = line.partition(" = ")
+      lines.append(head + " =")
+      lines.append("    " + value)
+    else:
+      lines.append(line)
+  return "\n".join(lines)
+
+
+def write_source(compiler, class_name, header_include, command):
+  model = compiler.model
+  lines = [
+      generated_notice(compiler.source_name, command),
+      '#include "%s"\n' % header_include,
+      "#include <cstdint>\n",
+      '#include "tensorflow/lite/kernels/internal/compatibility.h"',
+      '#include "third_party/cmsis_nn/Include/arm_nnfunctions.h"\n',
+      "namespace {\n",
+      "// Arena plan: offset, bytes and the operators that use each buffer.",
+  ]
+  for name, (offset, size, begin, end) in sorted(
+      compiler.offsets.items(), key=lambda item: (item[1][0], item[0])):
+    lines.append("constexpr int k%sOffset = %d;  // %d bytes, ops %d..%d" %
+                 (name, offset, size, begin, end))
+  lines.append("")
+  emitted = set()
+  for op, lowered in zip(model.operators, compiler.lowered):
+    if not lowered.constants and not any(
+        index in compiler.data_constants for index in op.inputs):
+      continue
+    lines.append("// Operator %d: %s" % (op.index, op.tag))
+    for index in op.inputs:
+      if index in compiler.data_constants and index not in emitted:
+        lines.append(compiler.data_constants[index])
+        emitted.add(index)
+    lines.extend(wrap_definition(constant) for constant in lowered.constants)
+    lines.append("")
+  lines.append("}  // namespace\n")
+
+  lines.append("%s::%s(uint8_t* arena) : arena_(arena) {" %
+               (class_name, class_name))
+  lines.append("  TFLITE_DCHECK(reinterpret_cast<uintptr_t>(arena) % 16 == 0);")
+  checks = []
+  for lowered in compiler.lowered:
+    for function, arguments in lowered.scratch_checks:
+      line = "  TFLITE_DCHECK_LE(%s(%s), %d);" % (
+          function, ", ".join(arguments), lowered.scratch)
+      if len(line) <= 80:
+        checks.append(line)
+        continue
+      checks.append("  TFLITE_DCHECK_LE(")
+      checks.extend(format_call(6, function, arguments, ","))
+      checks.append("      %d);" % lowered.scratch)
+  if checks:
+    lines.append("  // Scratch buffers are planned for the DSP build of "
+                 "CMSIS-NN, which asks")
+    lines.append("  // for the most on these targets.")
+    lines.extend(checks)
+  lines.append("}\n")
+
+  lines.append("TfLiteStatus %s::Invoke() {" % class_name)
+  for name in sorted(compiler.offsets, key=lambda name: int(name[6:]) if
+                     name.startswith("Tensor") else -1):
+    if name.startswith("Tensor"):
+      lines.append("  int8_t* const tensor%s = reinterpret_cast<int8_t*>("
+                   "arena_ + k%sOffset);" % (name[6:], name))
+  lines.append("")
+  for op, lowered in zip(model.operators, compiler.lowered):
+    lines.append("  // Operator %d: %s" % (op.index, op.tag))
+    if lowered.function is None:
+      lines.append("  // " + lowered.comment)
+      continue
+    if not lowered.arguments or lowered.arguments[0] != "&ctx":
+      lines.extend(format_call(2, lowered.function, lowered.arguments, ";"))
+      continue
+    lines.append("  {")
+    if lowered.scratch > 0:
+      lines.append("    const cmsis_nn_context ctx = {arena_ + "
+                   "kOp%dScratchOffset, %d};" % (op.index, lowered.scratch))
+    else:
+      lines.append("    const cmsis_nn_context ctx = {nullptr, 0};")
+    lines.extend(format_call(4, "if (" + lowered.function, lowered.arguments,
+                             " != ARM_CMSIS_NN_SUCCESS) {"))
+    lines.append("      return kTfLiteError;")
+    lines.append("    }")
+    lines.append("  }")
+  lines.append("  return kTfLiteOk;")
+  lines.append("}")
+  return "\n".join(lines) + "\n"
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+  parser.add_argument("model", help="A .tflite file or a C array source.")
+  parser.add_argument("--class-name", required=True)
+  parser.add_argument("--header", required=True,
+                      help="Path of the generated header.")
+  parser.add_argument("--source", required=True,
+                      help="Path of the generated source.")
+  args = parser.parse_args()
+
+  source_name = os.path.relpath(os.path.abspath(args.model), ROOT)
+  command = "python3 tools/aot_compile.py %s --class-name %s --header %s " \
+            "--source %s" % (source_name, args.class_name,
+                             os.path.relpath(os.path.abspath(args.header),
+                                             ROOT),
+                             os.path.relpath(os.path.abspath(args.source),
+                                             ROOT))
+  compiler = Compiler(load_model(args.model), source_name)
+  try:
+    compiler.compile()
+  except ValueError as error:
+    print("%s: %s" % (args.model, error), file=sys.stderr)
+    return 1
+
+  guard = re.sub(r"[^A-Z0-9]", "_",
+                 os.path.relpath(os.path.abspath(args.header),
+                                 ROOT).upper()) + "_"
+  with open(args.header, "w") as f:
+    f.write(write_header(compiler, args.class_name, guard, command))
+  with open(args.source, "w") as f:
+    f.write(
+        write_source(compiler, args.class_name,
+                     os.path.basename(args.header), command))
+  print("%s: %d ops, %d byte arena" %
+        (args.class_name, len(compiler.model.operators), compiler.arena_size))
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(main())
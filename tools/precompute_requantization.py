@@ -0,0 +1,304 @@
+# Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+"""Precomputes the per-channel requantization tables of a model into it.
+
+For every int8 or int16 CONV_2D and DEPTHWISE_CONV_2D of the first subgraph,
+the multipliers and shifts that PopulateConvolutionQuantizationParams() would
+compute in Prepare() are stored in a model buffer, and an
+OFFLINE_REQUANTIZATION_METADATA entry (see
+src/tensorflow/lite/micro/offline_requantization.h) tells the CMSIS-NN kernels
+where to find them. The kernels then read the tables from the model instead
+of computing them into the arena.
+
+The input model is kept byte for byte: the new root table, vectors and
+buffers are written in front of it, where they can reference the existing
+tables with forward offsets. So the tool needs no flatbuffers package.
+
+  precompute_requantization.py examples/micro_speech_small/kws_model_data.cc \\
+      --array-name g_kws_model_requant_data \\
+      --header examples/micro_speech_small/kws_model_requant_data.h \\
+      --source examples/micro_speech_small/kws_model_requant_data.cc
+"""
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import argparse
+import os
+import struct
+import sys
+
+from tflite_model import Model
+from tflite_model import ROOT
+from tflite_model import per_channel_quantization
+from tflite_model import read_model_bytes
+from tflite_model import root_table
+
+METADATA_NAME = "OFFLINE_REQUANTIZATION_METADATA"
+METADATA_VERSION = 1
+
+# Model buffers are 16-byte aligned, like the converter aligns them.
+ALIGNMENT = 16
+
+# Quantized dimension of the filter, per operator.
+QUANTIZED_DIMENSION = {"CONV_2D": 0, "DEPTHWISE_CONV_2D": 3}
+
+# Fields of the Model table of schema.fbs.
+MODEL_VERSION = 0
+MODEL_BUFFERS = 4
+MODEL_METADATA = 6
+MODEL_FIELD_COUNT = 8
+
+
+def requantization_tables(model):
+  """Returns [(operator index, channels, multipliers, shifts)]."""
+  tables = []
+  for op in model.operators:
+    if op.tag not in QUANTIZED_DIMENSION:
+      continue
+    input_tensor = model.tensors[op.inputs[0]]
+    filter_tensor = model.tensors[op.inputs[1]]
+    output = model.tensors[op.outputs[0]]
+    if input_tensor.dtype not in ("int8", "int16"):
+      continue
+    channels = filter_tensor.shape[QUANTIZED_DIMENSION[op.tag]]
+    multipliers, shifts = per_channel_quantization(input_tensor,
+                                                   filter_tensor, output,
+                                                   channels)
+    tables.append((op.index, channels, multipliers, shifts))
+  return tables
+
+
+class Prefix(object):
+  """Bytes written in front of the model, with offsets patched in later."""
+
+  def __init__(self):
+    self.data = bytearray()
+    self.patches = []
+
+  def pad(self, alignment, extra=0):
+    while (len(self.data) + extra) % alignment:
+      self.data.append(0)
+
+  def u32(self, value=0):
+    at = len(self.data)
+    self.data += struct.pack("<I", value)
+    return at
+
+  def offset_to(self, target):
+    """A uoffset to `target`, a callable returning an absolute position."""
+    at = self.u32()
+    self.patches.append((at, target))
+
+  def vtable(self, field_offsets, table_size):
+    self.pad(2)
+    at = len(self.data)
+    self.data += struct.pack("<HH", 4 + 2 * len(field_offsets), table_size)
+    for offset in field_offsets:
+      self.data += struct.pack("<H", offset)
+    return at
+
+  def table_start(self, vtable):
+    self.pad(4)
+    at = len(self.data)
+    self.data += struct.pack("<i", at - vtable)
+    return at
+
+  def byte_vector(self, payload):
+    self.pad(ALIGNMENT, extra=4)
+    at = self.u32(len(payload))
+    self.data += payload
+    return at
+
+  def finish(self, base_shift):
+    for at, target in self.patches:
+      struct.pack_into("<I", self.data, at, target(base_shift) - at)
+
+
+def add_requantization(data, tables):
+  """Returns the model bytes with `tables` added as metadata."""
+  root = root_table(data)
+  old_buffers = root.tables(MODEL_BUFFERS)
+  old_metadata = root.tables(MODEL_METADATA)
+  for entry in old_metadata:
+    if entry.string(0) == METADATA_NAME:
+      raise ValueError("the model already carries %s" % METADATA_NAME)
+
+  metadata_buffer = len(old_buffers)
+  entries = []
+  for index, (op, channels, _, _) in enumerate(tables):
+    entries.append((0, op, channels, metadata_buffer + 1 + index))
+  payloads = [struct.pack("<II", METADATA_VERSION, len(entries)) +
+              b"".join(struct.pack("<IIII", *entry) for entry in entries)]
+  for _, channels, multipliers, shifts in tables:
+    payloads.append(struct.pack("<%di" % (2 * channels),
+                                *(multipliers + shifts)))
+
+  prefix = Prefix()
+  positions = {}
+
+  def at(name):
+    return lambda shift: positions[name]
+
+  def old(pos):
+    return lambda shift: shift + pos
+
+  prefix.offset_to(at("model"))
+  prefix.data += data[4:8]  # The file identifier.
+
+  # The Model table: every field but the buffers and metadata points into
+  # the original model.
+  fields = list(range(MODEL_FIELD_COUNT))
+  present = [f for f in fields if f == MODEL_VERSION or root._offset(f) != 0
+             or f in (MODEL_BUFFERS, MODEL_METADATA)]
+  field_offsets = []
+  for f in fields:
+    field_offsets.append(4 + 4 * present.index(f) if f in present else 0)
+  vtable = prefix.vtable(field_offsets, 4 + 4 * len(present))
+  positions["model"] = prefix.table_start(vtable)
+  for f in present:
+    if f == MODEL_VERSION:
+      prefix.u32(root.scalar(MODEL_VERSION, "I"))
+    elif f == MODEL_BUFFERS:
+      prefix.offset_to(at("buffers"))
+    elif f == MODEL_METADATA:
+      prefix.offset_to(at("metadata"))
+    else:
+      prefix.offset_to(old(root._target(f)))
+
+  positions["buffers"] = prefix.u32(len(old_buffers) + len(payloads))
+  for buffer in old_buffers:
+    prefix.offset_to(old(buffer.pos))
+  for index in range(len(payloads)):
+    prefix.offset_to(at("buffer%d" % index))
+
+  positions["metadata"] = prefix.u32(len(old_metadata) + 1)
+  for entry in old_metadata:
+    prefix.offset_to(old(entry.pos))
+  prefix.offset_to(at("entry"))
+
+  vtable = prefix.vtable([4, 8], 12)
+  positions["entry"] = prefix.table_start(vtable)
+  prefix.offset_to(at("name"))
+  prefix.u32(metadata_buffer)
+
+  vtable = prefix.vtable([4], 8)
+  for index in range(len(payloads)):
+    positions["buffer%d" % index] = prefix.table_start(vtable)
+    prefix.offset_to(at("data%d" % index))
+
+  prefix.pad(4)
+  positions["name"] = prefix.u32(len(METADATA_NAME))
+  prefix.data += METADATA_NAME.encode("ascii") + b"\0"
+
+  for index, payload in enumerate(payloads):
+    positions["data%d" % index] = prefix.byte_vector(payload)
+
+  # Keep the original model 16-byte aligned, so its buffers stay aligned.
+  prefix.pad(ALIGNMENT)
+  prefix.finish(len(prefix.data))
+  return bytes(prefix.data) + bytes(data)
+
+
+def generated_notice(source_name, command):
+  lines = ["// Generated by tools/precompute_requantization.py from",
+           "//   %s." % source_name, "// Do not edit; regenerate with:"]
+  current = "//  "
+  for word in command.split():
+    if len(current) + len(word) + 3 > 80:
+      lines.append(current + " \\")
+      current = "//     "
+    current += " " + word
+  lines.append(current)
+  return lines
+
+
+def write_source(path, header_path, array_name, data, notice):
+  lines = notice + [
+      "",
+      '#include "%s"' % os.path.basename(header_path),
+      "",
+      "alignas(16) const unsigned char %s[] = {" % array_name,
+  ]
+  for start in range(0, len(data), 12):
+    lines.append("    " + ", ".join("0x%02x" % b
+                                     for b in data[start:start + 12]) + ",")
+  lines[-1] = lines[-1][:-1] + "};"
+  lines += ["", "const unsigned int %s_len = %d;" % (array_name, len(data))]
+  with open(path, "w") as f:
+    f.write("\n".join(lines) + "\n")
+
+
+def write_header(path, array_name, notice):
+  guard = os.path.relpath(os.path.abspath(path), ROOT).upper()
+  guard = "".join(c if c.isalnum() else "_" for c in guard) + "_"
+  lines = notice + [
+      "",
+      "#ifndef %s" % guard,
+      "#define %s" % guard,
+      "",
+      "extern const unsigned char %s[];" % array_name,
+      "extern const unsigned int %s_len;" % array_name,
+      "",
+      "#endif  // %s" % guard,
+  ]
+  with open(path, "w") as f:
+    f.write("\n".join(lines) + "\n")
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+  parser.add_argument("model", help="A .tflite file or a C array source.")
+  parser.add_argument("--output", help="Path of the .tflite to write.")
+  parser.add_argument("--array-name",
+                      help="Name of the byte array of a C++ source.")
+  parser.add_argument("--header", help="Path of the generated header.")
+  parser.add_argument("--source", help="Path of the generated source.")
+  args = parser.parse_args()
+  if not args.output and not (args.array_name and args.header and
+                              args.source):
+    parser.error("give --output, or --array-name, --header and --source")
+
+  data = read_model_bytes(args.model)
+  try:
+    tables = requantization_tables(Model(data))
+    result = add_requantization(data, tables)
+  except ValueError as error:
+    print("%s: %s" % (args.model, error), file=sys.stderr)
+    return 1
+
+  if args.output:
+    with open(args.output, "wb") as f:
+      f.write(result)
+  else:
+    source_name = os.path.relpath(os.path.abspath(args.model), ROOT)
+    command = "python3 tools/precompute_requantization.py %s " \
+              "--array-name %s --header %s --source %s" % (
+                  source_name, args.array_name,
+                  os.path.relpath(os.path.abspath(args.header), ROOT),
+                  os.path.relpath(os.path.abspath(args.source), ROOT))
+    notice = generated_notice(source_name, command)
+    write_header(args.header, args.array_name, notice)
+    write_source(args.source, args.header, args.array_name, result, notice)
+
+  table_bytes = sum(8 * channels for _, channels, _, _ in tables)
+  print("%d operators, %d table bytes, model %d -> %d bytes" %
+        (len(tables), table_bytes, len(data), len(result)))
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(main())
@@ -0,0 +1,274 @@
+# Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+"""Reads .tflite models without the flatbuffers Python package.
+
+The host tools of this repository only need a few tables of the schema, so
+they read the flatbuffer directly. The enums come from the schema header of
+the tree, so they always match the library that runs the model.
+"""
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import math
+import os
+import re
+import struct
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SCHEMA_HEADER = os.path.join(ROOT, "src", "tensorflow", "lite", "schema",
+                             "schema_generated.h")
+
+
+def read_schema_enum(text, name):
+  values = {}
+  for match in re.finditer(r"\b%s_(\w+) = (-?\d+)," % name, text):
+    values[int(match.group(2))] = match.group(1)
+  return values
+
+
+with open(SCHEMA_HEADER) as schema:
+  _SCHEMA_TEXT = schema.read()
+BUILTIN_OPERATORS = read_schema_enum(_SCHEMA_TEXT, "BuiltinOperator")
+TENSOR_TYPES = read_schema_enum(_SCHEMA_TEXT, "TensorType")
+del _SCHEMA_TEXT
+
+
+def float32(value):
+  """Rounds a double to the nearest float, as a C++ float conversion does."""
+  return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+def round_half_away(value):
+  """std::round: halfway cases go away from zero."""
+  magnitude = math.floor(abs(value))
+  if abs(value) - magnitude >= 0.5:
+    magnitude += 1
+  return int(-magnitude if value < 0 else magnitude)
+
+
+def quantize_multiplier(double_multiplier):
+  """QuantizeMultiplier() of quantization_util.cpp."""
+  if double_multiplier == 0.0:
+    return 0, 0
+  q, shift = math.frexp(double_multiplier)
+  q_fixed = round_half_away(q * (1 << 31))
+  if q_fixed > (1 << 31):
+    raise ValueError("multiplier %r does not fit" % double_multiplier)
+  if q_fixed == (1 << 31):
+    q_fixed //= 2
+    shift += 1
+  if shift < -31:
+    shift = 0
+    q_fixed = 0
+  return q_fixed, shift
+
+
+def per_channel_quantization(input_tensor, filter_tensor, output, channels):
+  """PopulateConvolutionQuantizationParams() for int8 and int16 inputs."""
+  if len(filter_tensor.scales) not in (1, channels):
+    raise ValueError("filter %d has %d scales for %d channels" %
+                     (filter_tensor.index, len(filter_tensor.scales),
+                      channels))
+  multipliers = []
+  shifts = []
+  for channel in range(channels):
+    scale = filter_tensor.scales[channel if len(filter_tensor.scales) > 1
+                                 else 0]
+    effective_scale = input_tensor.scale * scale / output.scale
+    multiplier, shift = quantize_multiplier(effective_scale)
+    multipliers.append(multiplier)
+    shifts.append(shift)
+  return multipliers, shifts
+
+
+class Table(object):
+  """A flatbuffer table, read without the generated Python code."""
+
+  def __init__(self, buf, pos):
+    self.buf = buf
+    self.pos = pos
+    self.vtable = pos - struct.unpack_from("<i", buf, pos)[0]
+    self.vtable_size = struct.unpack_from("<H", buf, self.vtable)[0]
+
+  def _offset(self, field):
+    entry = 4 + 2 * field
+    if entry >= self.vtable_size:
+      return 0
+    return struct.unpack_from("<H", self.buf, self.vtable + entry)[0]
+
+  def _target(self, field):
+    offset = self._offset(field)
+    if offset == 0:
+      return None
+    at = self.pos + offset
+    return at + struct.unpack_from("<I", self.buf, at)[0]
+
+  def scalar(self, field, fmt, default=0):
+    offset = self._offset(field)
+    if offset == 0:
+      return default
+    return struct.unpack_from("<" + fmt, self.buf, self.pos + offset)[0]
+
+  def table(self, field):
+    at = self._target(field)
+    return None if at is None else Table(self.buf, at)
+
+  def length(self, field):
+    at = self._target(field)
+    return 0 if at is None else struct.unpack_from("<I", self.buf, at)[0]
+
+  def vector(self, field, fmt):
+    at = self._target(field)
+    if at is None:
+      return []
+    count = struct.unpack_from("<I", self.buf, at)[0]
+    return list(struct.unpack_from("<%d%s" % (count, fmt), self.buf, at + 4))
+
+  def bytes(self, field):
+    at = self._target(field)
+    if at is None:
+      return b""
+    count = struct.unpack_from("<I", self.buf, at)[0]
+    return bytes(self.buf[at + 4:at + 4 + count])
+
+  def tables(self, field):
+    at = self._target(field)
+    if at is None:
+      return []
+    count = struct.unpack_from("<I", self.buf, at)[0]
+    result = []
+    for index in range(count):
+      element = at + 4 + 4 * index
+      result.append(
+          Table(self.buf, element + struct.unpack_from("<I", self.buf,
+                                                       element)[0]))
+    return result
+
+  def string(self, field):
+    at = self._target(field)
+    if at is None:
+      return ""
+    count = struct.unpack_from("<I", self.buf, at)[0]
+    return self.buf[at + 4:at + 4 + count].decode("utf-8", "replace")
+
+
+def read_model_bytes(path):
+  """Reads a .tflite file, or the byte array of a C or C++ model source."""
+  if path.endswith(".tflite"):
+    with open(path, "rb") as f:
+      return f.read()
+  with open(path) as f:
+    text = f.read()
+  match = re.search(r"\[\]\s*=\s*\{([^}]*)\}", text)
+  if match is None:
+    raise ValueError("%s has no byte array" % path)
+  return bytes(int(token, 0) for token in re.findall(r"0[xX][0-9a-fA-F]+|\d+",
+                                                    match.group(1)))
+
+
+def root_table(data):
+  return Table(data, struct.unpack_from("<I", data, 0)[0])
+
+
+class Tensor(object):
+  """A tensor of a subgraph, with its constant data if it has any."""
+
+  def __init__(self, index, table, buffers):
+    self.index = index
+    self.name = table.string(3)
+    self.shape = table.vector(0, "i")
+    self.dtype = TENSOR_TYPES.get(table.scalar(1, "b"), "unknown").lower()
+    self.is_variable = bool(table.scalar(5, "B"))
+    self.data = None
+    buffer_index = table.scalar(2, "I")
+    if 0 < buffer_index < len(buffers):
+      buffer = buffers[buffer_index]
+      if buffer.scalar(1, "Q") > 1:
+        raise ValueError("tensor %d is stored outside the flatbuffer" % index)
+      if buffer.length(0) > 0:
+        self.data = buffer.bytes(0)
+    quantization = table.table(4)
+    self.scales = []
+    self.zero_points = []
+    self.quantized_dimension = 0
+    if quantization is not None:
+      self.scales = quantization.vector(2, "f")
+      self.zero_points = quantization.vector(3, "q")
+      self.quantized_dimension = quantization.scalar(6, "i")
+
+  @property
+  def constant(self):
+    return self.data is not None
+
+  @property
+  def scale(self):
+    return self.scales[0] if self.scales else 0.0
+
+  @property
+  def zero_point(self):
+    return self.zero_points[0] if self.zero_points else 0
+
+  def elements(self):
+    count = 1
+    for dim in self.shape:
+      count *= dim
+    return count
+
+
+class Operator(object):
+  """An operator of a subgraph. Optional inputs are -1."""
+
+  def __init__(self, index, table, opcodes):
+    self.index = index
+    self.tag = opcodes[table.scalar(0, "I")]
+    self.inputs = table.vector(1, "i")
+    self.outputs = table.vector(2, "i")
+    self.options = table.table(4)
+
+
+class Model(object):
+  """The first subgraph of a model, with its metadata names."""
+
+  def __init__(self, data):
+    self.data = data
+    root = root_table(data)
+    self.version = root.scalar(0, "I")
+    opcodes = []
+    for code in root.tables(1):
+      builtin = max(code.scalar(0, "b"), code.scalar(3, "i"))
+      name = BUILTIN_OPERATORS.get(builtin, "BUILTIN_%d" % builtin)
+      opcodes.append(code.string(1) if name == "CUSTOM" else name)
+    buffers = root.tables(4)
+    subgraphs = root.tables(2)
+    self.subgraph_count = len(subgraphs)
+    subgraph = subgraphs[0]
+    self.tensors = [
+        Tensor(index, table, buffers)
+        for index, table in enumerate(subgraph.tables(0))
+    ]
+    self.inputs = subgraph.vector(1, "i")
+    self.outputs = subgraph.vector(2, "i")
+    self.operators = [
+        Operator(index, table, opcodes)
+        for index, table in enumerate(subgraph.tables(3))
+    ]
+    self.metadata = [entry.string(0) for entry in root.tables(6)]
+
+
+def load_model(path):
+  return Model(read_model_bytes(path))